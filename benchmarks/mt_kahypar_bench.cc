@@ -0,0 +1,734 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/datastructures/concurrent_bucket_map.h"
+#include "mt-kahypar/datastructures/priority_queue.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/partition/coarsening/multilevel_vertex_pair_rater.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
+#include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
+#include "mt-kahypar/partition/registries/registry.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/hash.h"
+#include "mt-kahypar/utils/randomize.h"
+
+/**
+ * Micro- and meso-benchmarks for the core kernels of Mt-KaHyPar.
+ *
+ * Usage: MtKaHyPar-Bench [--instance=<file>]... [--threads=<int>] [<google benchmark flags>]
+ *
+ * Without --instance, the benchmarks run on a fixed set of instances from tests/instances.
+ * Files ending with '.graph' are read in Metis format, all other files in hMetis format.
+ * Refinement benchmarks start from a reference partition that is computed once per
+ * instance and k with the default preset and a fixed seed, which is not part of the
+ * measured time. All random choices inside the measured kernels use a fixed seed as well.
+ */
+
+namespace mt_kahypar {
+namespace {
+
+using TypeTraits = StaticHypergraphTypeTraits;
+using Hypergraph = typename TypeTraits::Hypergraph;
+using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+static constexpr int kSeed = 420;
+static constexpr double kEpsilon = 0.03;
+
+const std::vector<std::string> kDefaultInstances = {
+  "ibm01.hgr",
+  "powersim.mtx.hgr",
+  "sat14_atco_enc1_opt2_10_16.cnf.primal.hgr",
+  "delaunay_n15.graph.hgr"
+};
+
+std::string baseName(const std::string& filename) {
+  const size_t pos = filename.find_last_of('/');
+  return pos == std::string::npos ? filename : filename.substr(pos + 1);
+}
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+  return str.size() >= suffix.size() &&
+    str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+Context createContext(const PresetType preset,
+                      const PartitionID k,
+                      const Hypergraph& hypergraph) {
+  Context context;
+  std::vector<option> preset_options = loadPreset(preset);
+  presetToContext(context, preset_options, true);
+  context.partition.k = k;
+  context.partition.epsilon = kEpsilon;
+  context.partition.objective = Objective::km1;
+  context.partition.seed = kSeed;
+  context.partition.verbose_output = false;
+  context.partition.instance_type = InstanceType::hypergraph;
+  context.partition.partition_type = PartitionedHypergraph::TYPE;
+  context.shared_memory.original_num_threads = TBBInitializer::instance().total_number_of_threads();
+  context.shared_memory.num_threads = TBBInitializer::instance().total_number_of_threads();
+  context.partition.large_hyperedge_size_threshold = std::max(hypergraph.initialNumNodes() *
+    context.partition.large_hyperedge_size_threshold_factor, 100.0);
+  context.sanityCheck(nullptr);
+  context.setupPartWeights(hypergraph.totalWeight());
+  context.setupContractionLimit(hypergraph.totalWeight());
+  context.setupThreadsPerFlowSearch();
+  return context;
+}
+
+/**
+ * Input of a benchmark. Stores the raw edge list (input of the construction
+ * benchmark), the constructed hypergraph and the cached reference partitions.
+ */
+class Instance {
+
+ public:
+  explicit Instance(const std::string& filename) :
+    _name(baseName(filename)),
+    _num_hyperedges(0),
+    _num_hypernodes(0),
+    _hyperedges(),
+    _hyperedge_weights(),
+    _hypernode_weights(),
+    _hypergraph(),
+    _clustering(),
+    _partitions() {
+    if ( endsWith(filename, ".graph") ) {
+      io::readGraphFile(filename, _num_hyperedges, _num_hypernodes,
+        _hyperedges, _hyperedge_weights, _hypernode_weights);
+    } else {
+      HyperedgeID num_removed_single_pin_hyperedges = 0;
+      io::readHypergraphFile(filename, _num_hyperedges, _num_hypernodes,
+        num_removed_single_pin_hyperedges, _hyperedges, _hyperedge_weights, _hypernode_weights);
+    }
+    _hypergraph = construct();
+    computeClustering();
+  }
+
+  const std::string& name() const {
+    return _name;
+  }
+
+  Hypergraph& hypergraph() {
+    return _hypergraph;
+  }
+
+  Hypergraph construct() const {
+    return Hypergraph::Factory::construct(_num_hypernodes, _num_hyperedges, _hyperedges,
+      _hyperedge_weights.data(), _hypernode_weights.data());
+  }
+
+  // ! Clustering that matches each node with at most one unmatched pin
+  // ! of its incident nets (similar to one pass of a matching-based coarsener)
+  const vec<HypernodeID>& clustering() const {
+    return _clustering;
+  }
+
+  // ! Partition computed with the default preset. It is computed on first access.
+  const vec<PartitionID>& referencePartition(const PartitionID k) {
+    auto it = _partitions.find(k);
+    if ( it == _partitions.end() ) {
+      Hypergraph hypergraph = _hypergraph.copy(parallel_tag_t());
+      Context context = createContext(PresetType::default_preset, k, hypergraph);
+      utils::Randomize::instance().setSeed(kSeed);
+      PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hypergraph, context);
+      vec<PartitionID> partition(hypergraph.initialNumNodes(), kInvalidPartition);
+      phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        partition[hn] = phg.partID(hn);
+      });
+      it = _partitions.emplace(k, std::move(partition)).first;
+    }
+    return it->second;
+  }
+
+  // ! Returns a partitioned hypergraph on the hypergraph of the instance
+  // ! that is initialized with the reference partition
+  std::unique_ptr<PartitionedHypergraph> partitionedHypergraph(const PartitionID k) {
+    const vec<PartitionID>& partition = referencePartition(k);
+    auto phg = std::make_unique<PartitionedHypergraph>(k, _hypergraph, parallel_tag_t());
+    phg->doParallelForAllNodes([&](const HypernodeID& hn) {
+      phg->setOnlyNodePart(hn, partition[hn]);
+    });
+    phg->initializePartition();
+    return phg;
+  }
+
+ private:
+  void computeClustering() {
+    _clustering.assign(_hypergraph.initialNumNodes(), kInvalidHypernode);
+    for ( const HypernodeID& hn : _hypergraph.nodes() ) {
+      if ( _clustering[hn] == kInvalidHypernode ) {
+        _clustering[hn] = hn;
+        for ( const HyperedgeID& he : _hypergraph.incidentEdges(hn) ) {
+          bool matched = false;
+          for ( const HypernodeID& pin : _hypergraph.pins(he) ) {
+            if ( _clustering[pin] == kInvalidHypernode ) {
+              _clustering[pin] = hn;
+              matched = true;
+              break;
+            }
+          }
+          if ( matched ) break;
+        }
+      }
+    }
+  }
+
+  const std::string _name;
+  HyperedgeID _num_hyperedges;
+  HypernodeID _num_hypernodes;
+  io::HyperedgeVector _hyperedges;
+  vec<HyperedgeWeight> _hyperedge_weights;
+  vec<HypernodeWeight> _hypernode_weights;
+  Hypergraph _hypergraph;
+  vec<HypernodeID> _clustering;
+  std::unordered_map<PartitionID, vec<PartitionID>> _partitions;
+};
+
+// ####################### Benchmarks #######################
+
+void BM_Construction(benchmark::State& state, Instance* instance) {
+  for ( auto _ : state ) {
+    Hypergraph hypergraph = instance->construct();
+    benchmark::DoNotOptimize(hypergraph.initialNumPins());
+    state.PauseTiming();
+    hypergraph = Hypergraph();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * instance->hypergraph().initialNumPins());
+}
+
+void BM_Contract(benchmark::State& state, Instance* instance) {
+  Hypergraph& hypergraph = instance->hypergraph();
+  for ( auto _ : state ) {
+    state.PauseTiming();
+    vec<HypernodeID> clustering = instance->clustering();
+    state.ResumeTiming();
+    Hypergraph coarse_hypergraph = hypergraph.contract(clustering);
+    benchmark::DoNotOptimize(coarse_hypergraph.initialNumNodes());
+    state.PauseTiming();
+    state.counters["coarse_nodes"] = coarse_hypergraph.initialNumNodes();
+    coarse_hypergraph = Hypergraph();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * hypergraph.initialNumPins());
+}
+
+/**
+ * Inserts the footprints of the hyperedges contracted with the clustering of the
+ * instance into a bucket map and detects parallel hyperedges as the contraction
+ * does. With Arg(0), the bucket is determined by the lower bits of the footprint,
+ * with Arg(1), by the hash of the footprint. The counter max_bucket_size shows
+ * how evenly the footprints are distributed among the buckets.
+ */
+void BM_ParallelNetDetection(benchmark::State& state, Instance* instance) {
+  struct Footprint {
+    size_t hash;
+    HyperedgeID he;
+    HypernodeID size;
+  };
+
+  const bool hashed_keys = state.range(0);
+  Hypergraph& hypergraph = instance->hypergraph();
+  const vec<HypernodeID>& clustering = instance->clustering();
+  vec<Footprint> footprints(hypergraph.initialNumEdges());
+  hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+    vec<HypernodeID> pins;
+    for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+      pins.push_back(clustering[pin]);
+    }
+    std::sort(pins.begin(), pins.end());
+    pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+    size_t footprint = kEdgeHashSeed;
+    for ( const HypernodeID& pin : pins ) {
+      footprint += pin * pin;
+    }
+    footprints[he] = Footprint { footprint, he, static_cast<HypernodeID>(pins.size()) };
+  });
+
+  ds::ConcurrentBucketMap<Footprint> bucket_map;
+  size_t num_identical = 0;
+  for ( auto _ : state ) {
+    state.PauseTiming();
+    bucket_map.reserve_for_estimated_number_of_insertions(footprints.size());
+    state.ResumeTiming();
+
+    tbb::parallel_for(UL(0), footprints.size(), [&](const size_t i) {
+      Footprint footprint = footprints[i];
+      if ( hashed_keys ) {
+        bucket_map.insertWithHashedKey(footprint.hash, std::move(footprint));
+      } else {
+        bucket_map.insert(footprint.hash, std::move(footprint));
+      }
+    });
+    state.PauseTiming();
+    state.counters["max_bucket_size"] = bucket_map.maxBucketSize();
+    state.ResumeTiming();
+
+    tbb::enumerable_thread_specific<size_t> local_num_identical(0);
+    bucket_map.doParallelForAllBuckets([&](const size_t bucket) {
+      bucket_map.sortBucket(bucket, [&](const Footprint& lhs, const Footprint& rhs) {
+        return std::tie(lhs.hash, lhs.size, lhs.he) < std::tie(rhs.hash, rhs.size, rhs.he);
+      });
+      const auto& entries = bucket_map.getBucket(bucket);
+      for ( size_t i = 1; i < entries.size(); ++i ) {
+        if ( entries[i].hash == entries[i - 1].hash && entries[i].size == entries[i - 1].size ) {
+          ++local_num_identical.local();
+        }
+      }
+      bucket_map.free(bucket);
+    });
+    num_identical = local_num_identical.combine(std::plus<>());
+  }
+  state.counters["identical_footprints"] = num_identical;
+  state.SetItemsProcessed(state.iterations() * footprints.size());
+}
+
+/**
+ * Computes the footprints of all nets for identical net detection. Arg(0) sums up
+ * the squared pins of each net sequentially as the contraction does, Arg(1) uses the
+ * batched kernel with the same hash function and Arg(2) the batched kernel with
+ * tabulation hashing.
+ */
+void BM_Footprints(benchmark::State& state, Instance* instance) {
+  const int variant = state.range(0);
+  Hypergraph& hypergraph = instance->hypergraph();
+  vec<HypernodeID> pins;
+  vec<size_t> offsets(1, 0);
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+      pins.push_back(pin);
+    }
+    offsets.push_back(pins.size());
+  }
+  const size_t num_nets = offsets.size() - 1;
+  const hashing::SquareHash<HypernodeID> square_hash;
+  const hashing::HashTabulated<HypernodeID> tabulation_hash(kSeed);
+  vec<size_t> footprints(num_nets, 0);
+
+  for ( auto _ : state ) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(UL(0), num_nets, UL(1024)),
+      [&](const tbb::blocked_range<size_t>& range) {
+      const size_t first = range.begin();
+      if ( variant == 0 ) {
+        for ( size_t he = first; he < range.end(); ++he ) {
+          size_t footprint = kEdgeHashSeed;
+          for ( size_t pos = offsets[he]; pos < offsets[he + 1]; ++pos ) {
+            footprint += square_hash(pins[pos]);
+          }
+          footprints[he] = footprint;
+        }
+      } else if ( variant == 1 ) {
+        hashing::batchedFootprints(pins.data(), offsets.data() + first, range.size(),
+          kEdgeHashSeed, square_hash, footprints.data() + first);
+      } else {
+        hashing::batchedFootprints(pins.data(), offsets.data() + first, range.size(),
+          kEdgeHashSeed, tabulation_hash, footprints.data() + first);
+      }
+    });
+    benchmark::DoNotOptimize(footprints.data());
+  }
+  state.SetItemsProcessed(state.iterations() * pins.size());
+}
+
+/**
+ * Rates all nodes of the hypergraph as the first pass of the multilevel coarsener
+ * does (each node forms its own cluster). The rating mostly accesses the sizes and
+ * weights of the incident nets and the weights of the neighbors.
+ */
+void BM_Rating(benchmark::State& state, Instance* instance) {
+  using Rater = MultilevelVertexPairRater<HeavyEdgeScore, NoWeightPenalty, BestRatingPreferringUnmatched>;
+  using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+  const Hypergraph& hypergraph = instance->hypergraph();
+  Context context = createContext(PresetType::default_preset, 2, hypergraph);
+  context.setupMaximumAllowedNodeWeight(hypergraph.totalWeight());
+  const HypernodeID num_nodes = hypergraph.initialNumNodes();
+  Rater rater(num_nodes, hypergraph.maxEdgeSize(), context);
+  vec<HypernodeID> cluster_ids(num_nodes);
+  vec<AtomicWeight> cluster_weight(num_nodes);
+  hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+    cluster_ids[hn] = hn;
+    cluster_weight[hn].store(hypergraph.nodeWeight(hn), std::memory_order_relaxed);
+  });
+  const ds::FixedVertexSupport<Hypergraph>& fixed_vertices = hypergraph.fixedVertexSupport();
+  const HypernodeWeight max_allowed_node_weight = context.coarsening.max_allowed_node_weight;
+
+  for ( auto _ : state ) {
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      const auto rating = rater.rate<false>(hypergraph, hn,
+        cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+      benchmark::DoNotOptimize(rating.target);
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * hypergraph.initialNumPins());
+}
+
+void BM_InitializeGainCache(benchmark::State& state, Instance* instance) {
+  const PartitionID k = state.range(0);
+  std::unique_ptr<PartitionedHypergraph> phg = instance->partitionedHypergraph(k);
+  Context context = createContext(PresetType::default_preset, k, instance->hypergraph());
+  Km1GainCache gain_cache(context);
+  for ( auto _ : state ) {
+    state.PauseTiming();
+    gain_cache.reset();
+    state.ResumeTiming();
+    gain_cache.initializeGainCache(*phg);
+  }
+  state.SetItemsProcessed(state.iterations() * instance->hypergraph().initialNumPins());
+}
+
+enum class RefinerType {
+  fm,
+  label_propagation,
+  flows
+};
+
+/**
+ * Runs one call to refine(...) of the corresponding refiner per iteration.
+ * Each iteration starts from the reference partition with an initialized gain cache.
+ */
+void BM_Refinement(benchmark::State& state, Instance* instance, const RefinerType type) {
+  const PartitionID k = state.range(0);
+  const Hypergraph& hypergraph = instance->hypergraph();
+  Context context = createContext(type == RefinerType::flows ?
+    PresetType::quality : PresetType::default_preset, k, hypergraph);
+  context.refinement.fm.multitry_rounds = 1;
+
+  gain_cache_t gain_cache = GainCachePtr::constructGainCache(context);
+  std::unique_ptr<IRebalancer> rebalancer = RebalancerFactory::getInstance().createObject(
+    context.refinement.rebalancing.algorithm, hypergraph.initialNumNodes(), context, gain_cache);
+  std::unique_ptr<IRefiner> refiner;
+  switch ( type ) {
+    case RefinerType::fm:
+      refiner = FMFactory::getInstance().createObject(context.refinement.fm.algorithm,
+        hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+      break;
+    case RefinerType::label_propagation:
+      refiner = LabelPropagationFactory::getInstance().createObject(
+        context.refinement.label_propagation.algorithm, hypergraph.initialNumNodes(),
+        hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+      break;
+    case RefinerType::flows:
+      refiner = FlowSchedulerFactory::getInstance().createObject(context.refinement.flows.algorithm,
+        hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache);
+      break;
+  }
+
+  std::unique_ptr<PartitionedHypergraph> phg;
+  Metrics metrics;
+  for ( auto _ : state ) {
+    state.PauseTiming();
+    phg.reset();
+    phg = instance->partitionedHypergraph(k);
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(*phg);
+    GainCachePtr::resetGainCache(gain_cache);
+    GainCachePtr::initializeGainCache(*phg, gain_cache);
+    rebalancer->initialize(partitioned_hg);
+    refiner->initialize(partitioned_hg);
+    metrics = Metrics { metrics::quality(*phg, context), metrics::imbalance(*phg, context) };
+    const HyperedgeWeight initial_quality = metrics.quality;
+    utils::Randomize::instance().setSeed(kSeed);
+    state.ResumeTiming();
+
+    refiner->refine(partitioned_hg, {}, metrics, std::numeric_limits<double>::max());
+
+    state.PauseTiming();
+    state.counters["improvement"] = initial_quality - metrics.quality;
+    state.ResumeTiming();
+  }
+  state.counters["km1"] = metrics.quality;
+  phg.reset();
+  GainCachePtr::deleteGainCache(gain_cache);
+}
+
+void BM_ParallelLouvain(benchmark::State& state, Instance* instance) {
+  Hypergraph& hypergraph = instance->hypergraph();
+  Context context = createContext(PresetType::default_preset, 2, hypergraph);
+  LouvainEdgeWeight edge_weight_function = context.preprocessing.community_detection.edge_weight_function;
+  if ( edge_weight_function == LouvainEdgeWeight::hybrid ) {
+    // The partitioner resolves the hybrid edge weight based on the density
+    // of the hypergraph, here we use a fixed choice
+    edge_weight_function = LouvainEdgeWeight::uniform;
+  }
+  for ( auto _ : state ) {
+    state.PauseTiming();
+    std::unique_ptr<Graph<Hypergraph>> graph =
+      std::make_unique<Graph<Hypergraph>>(hypergraph, edge_weight_function);
+    if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+      graph->allocateContractionBuffers();
+    }
+    utils::Randomize::instance().setSeed(kSeed);
+    state.ResumeTiming();
+
+    ds::Clustering communities = community_detection::run_parallel_louvain(*graph, context);
+    benchmark::DoNotOptimize(communities.data());
+
+    state.PauseTiming();
+    graph.reset();
+    state.ResumeTiming();
+  }
+}
+
+// FM-like workload on a heap with state.range(0) elements: gain updates of random
+// elements interleaved with extracting the element with maximum gain.
+template<uint32_t arity>
+void BM_Heap(benchmark::State& state) {
+  using Heap = ds::ExclusiveHandleHeap<ds::MaxHeap<Gain, HypernodeID, arity>>;
+  const HypernodeID num_elements = state.range(0);
+  const size_t num_operations = 10 * std::max(num_elements, ID(100000));
+  std::mt19937 rng(kSeed);
+  std::uniform_int_distribution<HypernodeID> element_dist(0, num_elements - 1);
+  std::uniform_int_distribution<Gain> gain_dist(-1000, 1000);
+  vec<std::pair<HypernodeID, Gain>> updates(num_operations);
+  for ( auto& update : updates ) {
+    update = std::make_pair(element_dist(rng), gain_dist(rng));
+  }
+
+  Heap heap(num_elements);
+  for ( auto _ : state ) {
+    state.PauseTiming();
+    heap.clear();
+    for ( HypernodeID u = 0; u < num_elements; ++u ) {
+      heap.insert(u, gain_dist(rng));
+    }
+    state.ResumeTiming();
+
+    for ( size_t i = 0; i < num_operations; ++i ) {
+      const auto& [u, gain] = updates[i];
+      if ( i % 4 == 3 ) {
+        const HypernodeID top = heap.top();
+        heap.deleteTop();
+        heap.insert(top, gain);
+      } else {
+        heap.insertOrAdjustKey(u, gain);
+      }
+    }
+    benchmark::DoNotOptimize(heap.topKey());
+  }
+  state.SetItemsProcessed(state.iterations() * num_operations);
+}
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+// Synchronized moves on a grid graph with state.range(0) x state.range(0) nodes. In each
+// round, all nodes are moved to the next block in parallel, such that both endpoints of
+// most edges are moved concurrently. Smaller grids lead to more contention on the edges.
+void BM_GraphChangeNodePart(benchmark::State& state) {
+  using Graph = typename StaticGraphTypeTraits::Hypergraph;
+  using PartitionedGraph = typename StaticGraphTypeTraits::PartitionedHypergraph;
+  const PartitionID k = 8;
+  const HypernodeID side = state.range(0);
+  const HypernodeID num_nodes = side * side;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    if ( u % side + 1 < side ) edges.push_back({ u, u + 1 });
+    if ( u + side < num_nodes ) edges.push_back({ u, u + side });
+  }
+  Graph graph = Graph::Factory::construct(num_nodes, edges.size(), edges);
+  PartitionedGraph partitioned_graph(k, graph, parallel_tag_t());
+  partitioned_graph.doParallelForAllNodes([&](const HypernodeID& hn) {
+    partitioned_graph.setOnlyNodePart(hn, hn % k);
+  });
+  partitioned_graph.initializePartition();
+
+  const size_t num_rounds = std::max(UL(1), ( UL(1) << 22 ) / num_nodes);
+  for ( auto _ : state ) {
+    for ( size_t round = 0; round < num_rounds; ++round ) {
+      partitioned_graph.doParallelForAllNodes([&](const HypernodeID& hn) {
+        const PartitionID from = partitioned_graph.partID(hn);
+        partitioned_graph.changeNodePart(hn, from, (from + 1) % k);
+      });
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_rounds * num_nodes);
+}
+
+#ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+// Neighbor iteration on a grid graph with 1024 x 1024 nodes after contracting each 2 x 2
+// square into one node. The incident edges of a contracted node are spread over the
+// incident edge lists of its four original nodes. If state.range(0) is one, single-pin
+// and parallel edges are removed before, i.e., each list only contains active edges.
+void BM_DynamicGraphNeighborIteration(benchmark::State& state) {
+  using Graph = typename DynamicGraphTypeTraits::Hypergraph;
+  const HypernodeID side = 1024;
+  const HypernodeID num_nodes = side * side;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    if ( u % side + 1 < side ) edges.push_back({ u, u + 1 });
+    if ( u + side < num_nodes ) edges.push_back({ u, u + side });
+  }
+  Graph graph = Graph::Factory::construct(num_nodes, edges.size(), edges);
+  for ( HypernodeID v = 0; v < num_nodes; ++v ) {
+    if ( v % 2 == 1 ) {
+      graph.registerContraction(v - 1, v);
+      graph.contract(v);
+    }
+  }
+  for ( HypernodeID v = 0; v < num_nodes; ++v ) {
+    if ( v % 2 == 0 && ( v / side ) % 2 == 1 ) {
+      graph.registerContraction(v - side, v);
+      graph.contract(v);
+    }
+  }
+  if ( state.range(0) == 1 ) {
+    graph.removeSinglePinAndParallelHyperedges();
+  }
+
+  for ( auto _ : state ) {
+    tbb::enumerable_thread_specific<HypernodeID> local_sum(0);
+    graph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      HypernodeID& sum = local_sum.local();
+      for ( const HyperedgeID& he : graph.incidentEdges(hn) ) {
+        sum += graph.edgeTarget(he);
+      }
+    });
+    benchmark::DoNotOptimize(local_sum.combine(std::plus<HypernodeID>()));
+  }
+  state.SetItemsProcessed(state.iterations() * graph.initialNumEdges());
+}
+#endif
+#endif
+
+void registerHeapBenchmarks() {
+  auto configure = [](benchmark::internal::Benchmark* benchmark) {
+    benchmark->Unit(benchmark::kMillisecond)->RangeMultiplier(100)->Range(100, 1000000);
+    return benchmark;
+  };
+  configure(benchmark::RegisterBenchmark("Heap/arity:2", BM_Heap<2>));
+  configure(benchmark::RegisterBenchmark("Heap/arity:4", BM_Heap<4>));
+  configure(benchmark::RegisterBenchmark("Heap/arity:8", BM_Heap<8>));
+  #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+  benchmark::RegisterBenchmark("GraphChangeNodePart", BM_GraphChangeNodePart)
+    ->Unit(benchmark::kMillisecond)->Arg(16)->Arg(128)->Arg(1024);
+  #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+  benchmark::RegisterBenchmark("DynamicGraphNeighborIteration", BM_DynamicGraphNeighborIteration)
+    ->Unit(benchmark::kMillisecond)->Arg(0)->Arg(1);
+  #endif
+  #endif
+}
+
+void registerBenchmarks(Instance* instance) {
+  const std::string& name = instance->name();
+  auto configure = [](benchmark::internal::Benchmark* benchmark) {
+    benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+    return benchmark;
+  };
+  configure(benchmark::RegisterBenchmark(("Construction/" + name).c_str(), BM_Construction, instance));
+  configure(benchmark::RegisterBenchmark(("Contract/" + name).c_str(), BM_Contract, instance));
+  configure(benchmark::RegisterBenchmark(("ParallelNetDetection/" + name).c_str(),
+    BM_ParallelNetDetection, instance))->Arg(0)->Arg(1);
+  configure(benchmark::RegisterBenchmark(("Footprints/" + name).c_str(),
+    BM_Footprints, instance))->Arg(0)->Arg(1)->Arg(2);
+  configure(benchmark::RegisterBenchmark(("Rating/" + name).c_str(), BM_Rating, instance));
+  configure(benchmark::RegisterBenchmark(("InitializeGainCache/" + name).c_str(),
+    BM_InitializeGainCache, instance))->Arg(8)->Arg(64);
+  configure(benchmark::RegisterBenchmark(("MultiTryKWayFM/" + name).c_str(),
+    BM_Refinement, instance, RefinerType::fm))->Arg(8);
+  configure(benchmark::RegisterBenchmark(("LabelPropagationRefiner/" + name).c_str(),
+    BM_Refinement, instance, RefinerType::label_propagation))->Arg(8);
+  // With k = 2, the flow refinement always works on the block pair (0,1)
+  configure(benchmark::RegisterBenchmark(("FlowRefinement/" + name).c_str(),
+    BM_Refinement, instance, RefinerType::flows))->Arg(2);
+  configure(benchmark::RegisterBenchmark(("ParallelLouvain/" + name).c_str(),
+    BM_ParallelLouvain, instance));
+}
+
+}  // namespace
+}  // namespace mt_kahypar
+
+int main(int argc, char* argv[]) {
+  using namespace mt_kahypar;
+
+  // Extract our own flags, the remaining ones are passed to google benchmark
+  std::vector<std::string> filenames;
+  size_t num_threads = std::thread::hardware_concurrency();
+  std::vector<char*> benchmark_args;
+  for ( int i = 0; i < argc; ++i ) {
+    if ( std::strncmp(argv[i], "--instance=", 11) == 0 ) {
+      filenames.emplace_back(argv[i] + 11);
+    } else if ( std::strncmp(argv[i], "--threads=", 10) == 0 ) {
+      num_threads = std::stoul(argv[i] + 10);
+    } else {
+      benchmark_args.push_back(argv[i]);
+    }
+  }
+  if ( filenames.empty() ) {
+    for ( const std::string& instance : kDefaultInstances ) {
+      filenames.push_back(std::string(KAHYPAR_BENCHMARK_INSTANCE_DIR) + "/" + instance);
+    }
+  }
+
+  TBBInitializer::instance(num_threads);
+  register_algorithms_and_policies();
+
+  registerHeapBenchmarks();
+  std::vector<std::unique_ptr<Instance>> instances;
+  for ( const std::string& filename : filenames ) {
+    instances.push_back(std::make_unique<Instance>(filename));
+    registerBenchmarks(instances.back().get());
+  }
+
+  int benchmark_argc = benchmark_args.size();
+  benchmark::Initialize(&benchmark_argc, benchmark_args.data());
+  if ( benchmark::ReportUnrecognizedArguments(benchmark_argc, benchmark_args.data()) ) {
+    return 1;
+  }
+  benchmark::AddCustomContext("num_threads", std::to_string(num_threads));
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  instances.clear();
+  TBBInitializer::instance().terminate();
+  return 0;
+}
@@ -36,6 +36,8 @@
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/nested_partitions.h"
+#include "mt-kahypar/partition/block_ordering.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/exception.h"
@@ -260,6 +262,44 @@ void get_partition(mt_kahypar_partitioned_hypergraph_t p, mt_kahypar_partition_i
   });
 }
 
+template<bool Throwing>
+void get_nested_partition(mt_kahypar_partitioned_hypergraph_t p,
+                          const PartitionID num_blocks,
+                          mt_kahypar_partition_id_t* partition) {
+  ASSERT(partition != nullptr);
+  switch_phg<int, Throwing>(p, [&](const auto& phg) {
+    if ( !nested::isNestedPartition(phg.k(), num_blocks) ) {
+      throw InvalidParameterException("Number of blocks (" + std::to_string(num_blocks) +
+        ") must be a power of two smaller than k (" + std::to_string(phg.k()) + ") or k");
+    }
+    nested::getNestedPartition(phg, num_blocks, partition);
+    return 0;
+  });
+}
+
+template<bool Throwing>
+void get_block_ordering(mt_kahypar_partitioned_hypergraph_t p,
+                        mt_kahypar_hypernode_id_t* permutation,
+                        mt_kahypar_hypernode_id_t* block_offsets,
+                        mt_kahypar_hypernode_id_t* halo_offsets,
+                        mt_kahypar_hyperedge_id_t* cut_nets,
+                        mt_kahypar_hyperedge_id_t* num_cut_nets) {
+  ASSERT(permutation != nullptr && block_offsets != nullptr && halo_offsets != nullptr);
+  switch_phg<int, Throwing>(p, [&](const auto& phg) {
+    const block_ordering::BlockOrdering ordering = block_ordering::computeBlockOrdering(phg);
+    std::copy(ordering.permutation.begin(), ordering.permutation.end(), permutation);
+    std::copy(ordering.block_offsets.begin(), ordering.block_offsets.end(), block_offsets);
+    std::copy(ordering.halo_offsets.begin(), ordering.halo_offsets.end(), halo_offsets);
+    if ( cut_nets != nullptr ) {
+      std::copy(ordering.cut_nets.begin(), ordering.cut_nets.end(), cut_nets);
+    }
+    if ( num_cut_nets != nullptr ) {
+      *num_cut_nets = ordering.cut_nets.size();
+    }
+    return 0;
+  });
+}
+
 template<bool Throwing>
 void get_block_weights(mt_kahypar_partitioned_hypergraph_t p, mt_kahypar_hypernode_weight_t* block_weights) {
   ASSERT(block_weights != nullptr);
@@ -339,14 +379,21 @@ HypernodeID num_pins_in_block(mt_kahypar_partitioned_hypergraph_t p, HyperedgeID
   });
 }
 
+template<typename PartitionedHypergraphT>
+void check_number_of_blocks(const PartitionedHypergraphT& phg, const Context& context) {
+  if (context.partition.k != phg.k()) {
+    std::stringstream ss;
+    ss << "Mismatched number of blocks: the context specifies " << context.partition.k
+       << " blocks, but the partition has " << phg.k() << " blocks";
+    throw InvalidInputException(ss.str());
+  }
+}
+
 template<bool Throwing>
 double imbalance(mt_kahypar_partitioned_hypergraph_t p, const Context& context) {
   return switch_phg<double, Throwing>(p, [&](const auto& phg) {
-    if (Throwing && context.partition.k != phg.k()) {
-      std::stringstream ss;
-      ss << "Mismatched number of blocks: the context specifies " << context.partition.k
-         << " blocks, but the partition has " << phg.k() << " blocks";
-      throw InvalidInputException(ss.str());
+    if constexpr (Throwing) {
+      check_number_of_blocks(phg, context);
     }
     Context c(context);
     c.setupPartWeights(phg.totalWeight());
@@ -354,6 +401,45 @@ double imbalance(mt_kahypar_partitioned_hypergraph_t p, const Context& context)
   });
 }
 
+template<bool Throwing>
+PartitionMetrics compute_metrics(mt_kahypar_partitioned_hypergraph_t p, const Context& context) {
+  return switch_phg<PartitionMetrics, Throwing>(p, [&](const auto& phg) {
+    if constexpr (Throwing) {
+      check_number_of_blocks(phg, context);
+    }
+    Context c(context);
+    c.setupPartWeights(phg.totalWeight());
+    return metrics::allMetrics(phg, c);
+  });
+}
+
+template<bool Throwing>
+void apply_moves(mt_kahypar_partitioned_hypergraph_t p,
+                 const Context& context,
+                 const size_t num_moves,
+                 const mt_kahypar_hypernode_id_t* nodes,
+                 const mt_kahypar_partition_id_t* blocks,
+                 PartitionMetrics& partition_metrics) {
+  switch_phg<int, Throwing>(p, [&](auto& phg) {
+    if constexpr (Throwing) {
+      check_number_of_blocks(phg, context);
+    }
+    vec<Move> moves(num_moves);
+    for ( size_t i = 0; i < num_moves; ++i ) {
+      if constexpr (Throwing) {
+        check_hypernode_is_valid(phg, nodes[i]);
+        check_block_is_valid(phg, blocks[i]);
+      }
+      moves[i].node = nodes[i];
+      moves[i].to = blocks[i];
+    }
+    Context c(context);
+    c.setupPartWeights(phg.totalWeight());
+    metrics::applyMoves(phg, c, moves, partition_metrics);
+    return 0;
+  });
+}
+
 template<bool Throwing>
 HyperedgeWeight cut(mt_kahypar_partitioned_hypergraph_t p) {
   return switch_phg<HyperedgeWeight, Throwing>(p, [&](const auto& phg) {
@@ -26,11 +26,27 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <string>
 #include <sstream>
+#include <shared_mutex>
 #include <type_traits>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
 
 #include "mtkahypartypes.h"
+#include "lib_generic_impls.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
@@ -39,9 +55,13 @@
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/registries/registry.h"
+#include "mt-kahypar/partition/registries/register_memory_pool.h"
+#include "mt-kahypar/parallel/memory_pool.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/io/shared_memory.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
 #include "mt-kahypar/utils/exception.h"
 #include "mt-kahypar/io/command_line_options.h"
 #include "mt-kahypar/io/presets.h"
@@ -69,7 +89,19 @@ namespace lib {
 
 // ####################### General Helper Functions #######################
 
-void initialize(const size_t num_threads, const bool interleaved_allocations, const bool print_warnings) {
+// ! Partitioning sessions keep the memory pool allocated between calls and only
+// ! activate it while they hold exclusive access to it. All other calls that
+// ! construct data structures take shared access, which guarantees that they
+// ! never observe an active memory pool.
+std::shared_timed_mutex& memory_pool_mutex() {
+  static std::shared_timed_mutex mutex;
+  return mutex;
+}
+
+void initialize(const size_t num_threads,
+                const bool interleaved_allocations,
+                const bool print_warnings,
+                const bool global_thread_control = true) {
   size_t P = num_threads;
   #ifndef KAHYPAR_DISABLE_HWLOC
     size_t num_available_cpus = HardwareTopology::instance().num_cpus();
@@ -83,7 +115,7 @@ void initialize(const size_t num_threads, const bool interleaved_allocations, co
   #endif
 
   // Initialize TBB task arenas on numa nodes
-  TBBInitializer::instance(P);
+  TBBInitializer::instance(P, global_thread_control);
 
   #ifndef KAHYPAR_DISABLE_HWLOC
     if ( interleaved_allocations ) {
@@ -118,8 +150,10 @@ bool is_compatible(mt_kahypar_partitioned_hypergraph_t partitioned_hg, mt_kahypa
     case DEFAULT:
     case QUALITY:
     case DETERMINISTIC:
+      // The multilevel presets use the sparse connectivity information for medium k
       return partitioned_hg.type == MULTILEVEL_GRAPH_PARTITIONING ||
-             partitioned_hg.type == MULTILEVEL_HYPERGRAPH_PARTITIONING;
+             partitioned_hg.type == MULTILEVEL_HYPERGRAPH_PARTITIONING ||
+             partitioned_hg.type == LARGE_K_PARTITIONING;
     case LARGE_K:
       return partitioned_hg.type == MULTILEVEL_GRAPH_PARTITIONING ||
              partitioned_hg.type == LARGE_K_PARTITIONING;
@@ -163,10 +197,35 @@ Context context_from_preset(PresetType preset) {
   return context;
 }
 
-void prepare_context(Context& context) {
-  context.shared_memory.original_num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
-  context.shared_memory.num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
-  context.utility_id = mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects();
+// ! Maximum number of threads of a library call with the given context
+size_t max_num_threads(const Context& context) {
+  const size_t num_threads = mt_kahypar::TBBInitializer::instance().total_number_of_threads();
+  return context.shared_memory.thread_limit > 0 ?
+    std::min(num_threads, context.shared_memory.thread_limit) : num_threads;
+}
+
+// ! Executes the function inside a task arena with at most max_num_threads(context)
+// ! threads. If the task arena of the caller is not larger, it is used directly.
+template<typename F>
+auto execute_with_thread_limit(const Context& context, const F& f) {
+  const int num_threads = static_cast<int>(std::max(max_num_threads(context), UL(1)));
+  if ( num_threads < tbb::this_task_arena::max_concurrency() ) {
+    tbb::task_arena arena(num_threads, 1);
+    return arena.execute(f);
+  }
+  return f();
+}
+
+void prepare_context(Context& context, const bool register_utility_objects = true) {
+  // Calls executed inside a smaller task arena (e.g., batch partitioning or
+  // an arena of the caller) only use the threads of that arena
+  const size_t num_threads = std::min(max_num_threads(context),
+    static_cast<size_t>(tbb::this_task_arena::max_concurrency()));
+  context.shared_memory.original_num_threads = num_threads;
+  context.shared_memory.num_threads = num_threads;
+  if ( register_utility_objects ) {
+    context.utility_id = mt_kahypar::utils::Utilities::instance().registerNewUtilityObjects();
+  }
 
   context.partition.perfect_balance_part_weights.clear();
   if ( !context.partition.use_individual_part_weights ) {
@@ -210,6 +269,7 @@ mt_kahypar_preset_type_t get_preset_c_type(const PresetType preset) {
     case PresetType::highest_quality: return HIGHEST_QUALITY;
     case PresetType::deterministic: return DETERMINISTIC;
     case PresetType::large_k: return LARGE_K;
+    case PresetType::automatic:
     case PresetType::UNDEFINED: return DEFAULT;
   }
   return DEFAULT;
@@ -289,7 +349,38 @@ mt_kahypar_hypergraph_t hypergraph_from_file(const std::string& file_name,
                                              const Context& context,
                                              const InstanceType instance_type,
                                              const FileFormat file_format) {
-  return io::readInputFile(file_name, context.partition.preset_type, instance_type, file_format, true);
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  return io::readInputFile(file_name, context.partition.preset_type, instance_type, file_format,
+    true, true, context.preprocessing.sanitize_during_construction);
+}
+
+mt_kahypar_hypergraph_t hypergraph_from_shared_memory(const io::SharedMemoryHypergraph& shared_hg,
+                                                      const Context& context) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  return io::readSharedMemoryHypergraph(shared_hg, context.partition.preset_type, true);
+}
+
+void hypergraph_to_shared_memory(mt_kahypar_hypergraph_t hypergraph, const std::string& name) {
+  switch_hg<bool, true>(hypergraph, [&](const auto& hg) {
+    using Hypergraph = std::decay_t<decltype(hg)>;
+    io::HyperedgeVector hyperedges;
+    vec<HyperedgeWeight> hyperedges_weight;
+    vec<HypernodeWeight> hypernodes_weight(hg.initialNumNodes(), 0);
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      hypernodes_weight[hn] = hg.nodeWeight(hn);
+    }
+    for ( const HyperedgeID& he : hg.edges() ) {
+      if constexpr ( Hypergraph::is_graph ) {
+        // Each undirected edge is stored once
+        if ( hg.edgeSource(he) > hg.edgeTarget(he) ) continue;
+      }
+      hyperedges.emplace_back(hg.pins(he).begin(), hg.pins(he).end());
+      hyperedges_weight.push_back(hg.edgeWeight(he));
+    }
+    io::SharedMemoryHypergraph::create(name, hg.initialNumNodes(), hyperedges,
+      hyperedges_weight, hypernodes_weight, Hypergraph::is_graph);
+    return true;
+  });
 }
 
 mt_kahypar_hypergraph_t create_hypergraph(const Context& context,
@@ -298,11 +389,19 @@ mt_kahypar_hypergraph_t create_hypergraph(const Context& context,
                                           const vec<vec<HypernodeID>>& edge_vector,
                                           const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
                                           const mt_kahypar_hypernode_weight_t* vertex_weights) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   switch ( context.partition.preset_type ) {
     case PresetType::deterministic:
     case PresetType::large_k:
     case PresetType::default_preset:
     case PresetType::quality:
+      if ( context.preprocessing.sanitize_during_construction ) {
+        ds::InputSanitization sanitization;
+        return mt_kahypar_hypergraph_t {
+          reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticHypergraph(
+            StaticHypergraphFactory::construct_sanitized(num_vertices, num_hyperedges,
+              edge_vector, hyperedge_weights, vertex_weights, true, sanitization))), STATIC_HYPERGRAPH };
+      }
       return mt_kahypar_hypergraph_t {
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticHypergraph(
           StaticHypergraphFactory::construct(num_vertices, num_hyperedges,
@@ -312,6 +411,90 @@ mt_kahypar_hypergraph_t create_hypergraph(const Context& context,
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::DynamicHypergraph(
           DynamicHypergraphFactory::construct(num_vertices, num_hyperedges,
             edge_vector, hyperedge_weights, vertex_weights, true))), DYNAMIC_HYPERGRAPH };
+    case PresetType::automatic:
+    case PresetType::UNDEFINED:
+      break;
+  }
+  throw InvalidParameterException("Invalid preset type.");
+}
+
+// ! Converts the IDs of the interface in place into the ID type of the library, if the latter is smaller.
+// ! Element i is then moved from byte offset 2 * i * sizeof(HypernodeID) to i * sizeof(HypernodeID).
+// ! The elements in [2^k, 2^(k+1)) are moved in parallel in round k, since their targets only overlap
+// ! with elements moved in previous rounds. Throws if an ID is not smaller than num_ids.
+void narrow_ids_in_place(mt_kahypar_hyperedge_id_t* ids, const size_t size, const size_t num_ids) {
+  static_assert(sizeof(mt_kahypar_hyperedge_id_t) == sizeof(HypernodeID) ||
+                sizeof(mt_kahypar_hyperedge_id_t) == 2 * sizeof(HypernodeID));
+  if ( sizeof(mt_kahypar_hyperedge_id_t) == sizeof(HypernodeID) ) {
+    return;
+  }
+  char* data = reinterpret_cast<char*>(ids);
+  std::atomic_bool is_valid = true;
+  auto move = [&](const size_t i) {
+    mt_kahypar_hyperedge_id_t id;
+    std::memcpy(&id, data + i * sizeof(mt_kahypar_hyperedge_id_t), sizeof(mt_kahypar_hyperedge_id_t));
+    if ( id >= num_ids ) {
+      is_valid = false;
+    }
+    const HypernodeID narrowed_id = static_cast<HypernodeID>(id);
+    std::memcpy(data + i * sizeof(HypernodeID), &narrowed_id, sizeof(HypernodeID));
+  };
+  if ( size > 0 ) {
+    move(0);
+  }
+  for ( size_t begin = 1; begin < size; begin *= 2 ) {
+    tbb::parallel_for(begin, std::min(2 * begin, size), move);
+  }
+  if ( !is_valid ) {
+    throw InvalidInputException("Pins must be valid node IDs.");
+  }
+}
+
+mt_kahypar_hypergraph_t create_hypergraph_from_owned_buffers(const Context& context,
+                                                             const mt_kahypar_hypernode_id_t num_vertices,
+                                                             const mt_kahypar_hyperedge_id_t num_hyperedges,
+                                                             size_t* hyperedge_indices,
+                                                             mt_kahypar_hyperedge_id_t* hyperedges,
+                                                             const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                             const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                             mt_kahypar_free_callback_t free_callback,
+                                                             void* user_data) {
+  // The buffers are released when leaving this function, unless the pins are adopted by the hypergraph
+  auto free_buffer = [=](void* buffer) {
+    if ( free_callback ) {
+      free_callback(buffer, user_data);
+    }
+  };
+  std::unique_ptr<size_t, std::function<void(size_t*)>> indices(hyperedge_indices, free_buffer);
+  const size_t num_pins = hyperedge_indices[num_hyperedges];
+  if ( context.partition.preset_type == PresetType::highest_quality ) {
+    std::unique_ptr<mt_kahypar_hyperedge_id_t, std::function<void(mt_kahypar_hyperedge_id_t*)>> pins(
+      hyperedges, free_buffer);
+    vec<vec<HypernodeID>> edge_vector(num_hyperedges);
+    tbb::parallel_for<HyperedgeID>(0, num_hyperedges, [&](const HyperedgeID he) {
+      edge_vector[he].assign(hyperedges + hyperedge_indices[he], hyperedges + hyperedge_indices[he + 1]);
+    });
+    pins.reset();
+    indices.reset();
+    return create_hypergraph(context, num_vertices, num_hyperedges, edge_vector, hyperedge_weights, vertex_weights);
+  }
+
+  ds::Array<HypernodeID> pins;
+  pins.adopt(reinterpret_cast<HypernodeID*>(hyperedges), num_pins, free_buffer);
+  narrow_ids_in_place(hyperedges, num_pins, num_vertices);
+
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  switch ( context.partition.preset_type ) {
+    case PresetType::deterministic:
+    case PresetType::large_k:
+    case PresetType::default_preset:
+    case PresetType::quality:
+      return mt_kahypar_hypergraph_t {
+        reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticHypergraph(
+          StaticHypergraphFactory::construct_from_csr(num_vertices, num_hyperedges,
+            indices.get(), std::move(pins), hyperedge_weights, vertex_weights, true))), STATIC_HYPERGRAPH };
+    case PresetType::highest_quality:
+    case PresetType::automatic:
     case PresetType::UNDEFINED:
       break;
   }
@@ -324,6 +507,7 @@ mt_kahypar_hypergraph_t create_graph(const Context& context,
                                      const vec<std::pair<HypernodeID, HypernodeID>>& edge_vector,
                                      const mt_kahypar_hyperedge_weight_t* edge_weights,
                                      const mt_kahypar_hypernode_weight_t* vertex_weights) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   switch ( context.partition.preset_type ) {
     case PresetType::deterministic:
     case PresetType::large_k:
@@ -338,6 +522,68 @@ mt_kahypar_hypergraph_t create_graph(const Context& context,
         reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::DynamicGraph(
           DynamicGraphFactory::construct_from_graph_edges(num_vertices, num_edges,
             edge_vector, edge_weights, vertex_weights, true))), DYNAMIC_GRAPH };
+    case PresetType::automatic:
+    case PresetType::UNDEFINED:
+      break;
+  }
+  throw InvalidParameterException("Invalid preset type.");
+}
+
+mt_kahypar_hypergraph_t create_graph_from_csr(const Context& context,
+                                              const mt_kahypar_hypernode_id_t num_vertices,
+                                              const size_t* xadj,
+                                              const mt_kahypar_hypernode_id_t* adjncy,
+                                              const mt_kahypar_hyperedge_weight_t* edge_weights,
+                                              const mt_kahypar_hypernode_weight_t* vertex_weights) {
+  switch ( context.partition.preset_type ) {
+    case PresetType::deterministic:
+    case PresetType::large_k:
+    case PresetType::default_preset:
+    case PresetType::quality:
+      {
+        // The adjacency array is only copied if the ID types of the interface and library differ
+        const HypernodeID* neighbors = nullptr;
+        vec<HypernodeID> converted_neighbors;
+        if constexpr ( std::is_same_v<mt_kahypar_hypernode_id_t, HypernodeID> ) {
+          neighbors = reinterpret_cast<const HypernodeID*>(adjncy);
+        } else {
+          converted_neighbors.resize(xadj[num_vertices]);
+          tbb::parallel_for(UL(0), converted_neighbors.size(), [&](const size_t i) {
+            converted_neighbors[i] = adjncy[i];
+          });
+          neighbors = converted_neighbors.data();
+        }
+        std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+        return mt_kahypar_hypergraph_t {
+          reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticGraph(
+            StaticGraphFactory::construct_from_csr(num_vertices, xadj, neighbors,
+              edge_weights, vertex_weights))), STATIC_GRAPH };
+      }
+    case PresetType::highest_quality:
+      {
+        // The dynamic graph is constructed from the forward direction of each edge
+        const HyperedgeID num_edges = xadj[num_vertices] / 2;
+        vec<std::pair<HypernodeID, HypernodeID>> edge_vector;
+        vec<HyperedgeWeight> forward_edge_weights;
+        edge_vector.reserve(num_edges);
+        forward_edge_weights.reserve(edge_weights ? num_edges : 0);
+        for ( HypernodeID u = 0; u < num_vertices; ++u ) {
+          for ( size_t i = xadj[u]; i < xadj[u + 1]; ++i ) {
+            if ( adjncy[i] > u ) {
+              edge_vector.emplace_back(u, adjncy[i]);
+              if ( edge_weights ) {
+                forward_edge_weights.push_back(edge_weights[i]);
+              }
+            }
+          }
+        }
+        if ( edge_vector.size() != num_edges ) {
+          throw InvalidInputException("Adjacency array of the graph is not symmetric.");
+        }
+        return create_graph(context, num_vertices, num_edges, edge_vector,
+          edge_weights ? forward_edge_weights.data() : nullptr, vertex_weights);
+      }
+    case PresetType::automatic:
     case PresetType::UNDEFINED:
       break;
   }
@@ -354,6 +600,8 @@ mt_kahypar_partitioned_hypergraph_t create_partitioned_hypergraph(Hypergraph& hg
     partitioned_hg.setOnlyNodePart(hn, partition[hn]);
   });
   partitioned_hg.initializePartition();
+  // Border node queries of the interface then take constant time
+  partitioned_hg.initializeBorderNodes();
   return mt_kahypar_partitioned_hypergraph_t { reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
     new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE };
 }
@@ -362,6 +610,7 @@ mt_kahypar_partitioned_hypergraph_t create_partitioned_hypergraph(mt_kahypar_hyp
                                                                   const Context& context,
                                                                   const mt_kahypar_partition_id_t num_blocks,
                                                                   const mt_kahypar_partition_id_t* partition) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   if ( hypergraph.type == STATIC_GRAPH || hypergraph.type == DYNAMIC_GRAPH ) {
     switch ( context.partition.preset_type ) {
       case PresetType::large_k:
@@ -375,6 +624,7 @@ mt_kahypar_partitioned_hypergraph_t create_partitioned_hypergraph(mt_kahypar_hyp
         ASSERT(hypergraph.type == DYNAMIC_GRAPH);
         return create_partitioned_hypergraph<DynamicPartitionedGraph>(
           utils::cast<ds::DynamicGraph>(hypergraph), num_blocks, partition);
+      case PresetType::automatic:
       case PresetType::UNDEFINED: break;
     }
   } else {
@@ -393,6 +643,7 @@ mt_kahypar_partitioned_hypergraph_t create_partitioned_hypergraph(mt_kahypar_hyp
         ASSERT(hypergraph.type == DYNAMIC_HYPERGRAPH);
         return create_partitioned_hypergraph<DynamicPartitionedHypergraph>(
           utils::cast<ds::DynamicHypergraph>(hypergraph), num_blocks, partition);
+      case PresetType::automatic:
       case PresetType::UNDEFINED: break;
     }
   }
@@ -410,21 +661,593 @@ void set_individual_block_weights(Context& context,
 }
 
 
+// ####################### Partitioning Sessions #######################
+
+/**
+ * A partitioning session reuses the memory pool, the gain cache storage and
+ * the utility objects (timer and stats) across several partitioning calls.
+ * The memory chunks are registered for the largest instance seen so far and
+ * are only reallocated if an instance does not fit into them.
+ */
+class PartitioningSession {
+
+ public:
+  explicit PartitioningSession(const Context& context) :
+    _context(context),
+    _type(NULLPTR_HYPERGRAPH),
+    _capacity() {
+    _context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+  }
+
+  PartitioningSession(const PartitioningSession&) = delete;
+  PartitioningSession & operator= (const PartitioningSession &) = delete;
+
+  PartitioningSession(PartitioningSession&&) = delete;
+  PartitioningSession & operator= (PartitioningSession &&) = delete;
+
+  ~PartitioningSession() {
+    std::unique_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+    if ( memory_pool_owner() == this ) {
+      parallel::MemoryPool::instance().free_memory_chunks();
+      memory_pool_owner() = nullptr;
+    }
+  }
+
+  // ! Partitions the hypergraph and writes the block of each node to partition
+  void partition(mt_kahypar_hypergraph_t hypergraph, mt_kahypar_partition_id_t* partition);
+
+  // ! Registers the memory chunks for the given hypergraph (if they are not
+  // ! large enough) and activates the memory pool
+  void acquireMemoryPool(const mt_kahypar_hypergraph_t hypergraph, const Context& context) {
+    utils::Utilities::instance().getTimer(context.utility_id).clear();
+    utils::Utilities::instance().getStats(context.utility_id).clear();
+
+    auto& pool = parallel::MemoryPool::instance();
+    const MemoryPoolDimensions dimensions = memory_pool_dimensions(hypergraph);
+    if ( memory_pool_owner() != this || _type != hypergraph.type || !_capacity.contains(dimensions) ) {
+      if ( memory_pool_owner() == this && _type == hypergraph.type ) {
+        // Grow the memory chunks such that they also fit all previous instances
+        _capacity.num_hypernodes = std::max(_capacity.num_hypernodes, dimensions.num_hypernodes);
+        _capacity.num_hyperedges = std::max(_capacity.num_hyperedges, dimensions.num_hyperedges);
+        _capacity.num_pins = std::max(_capacity.num_pins, dimensions.num_pins);
+        _capacity.max_edge_size = std::max(_capacity.max_edge_size, dimensions.max_edge_size);
+      } else {
+        _capacity = dimensions;
+      }
+      _type = hypergraph.type;
+      pool.free_memory_chunks();
+      register_memory_pool(_type, _capacity, context);
+      memory_pool_owner() = this;
+    }
+    pool.activate();
+    // The memory chunks are reused in subsequent calls, which
+    // also pays off for chunks smaller than the minimum allocation size
+    pool.deactivate_minimum_allocation_size();
+  }
+
+  // ! Returns all memory chunks to the memory pool and deactivates it
+  void releaseMemoryPool() {
+    auto& pool = parallel::MemoryPool::instance();
+    pool.reset();
+    pool.activate_minimum_allocation_size();
+    pool.deactivate();
+  }
+
+ private:
+  // ! The session that registered the memory chunks currently held by the memory pool
+  static PartitioningSession*& memory_pool_owner() {
+    static PartitioningSession* owner = nullptr;
+    return owner;
+  }
+
+  Context _context;
+  mt_kahypar_hypergraph_type_t _type;
+  MemoryPoolDimensions _capacity;
+};
+
+
 // ####################### Partitioning #######################
 
-mt_kahypar_partitioned_hypergraph_t partition_impl(mt_kahypar_hypergraph_t hg, Context& context, TargetGraph* target_graph) {
+void report_partitioning_result(const mt_kahypar_partitioned_hypergraph_t phg,
+                                const Context& context,
+                                const HighResClockTimepoint& start) {
+  if ( context.partition.report_callback ) {
+    std::chrono::duration<double> elapsed_seconds(std::chrono::high_resolution_clock::now() - start);
+    const std::string json_report = PartitionerFacade::serializeJSON(phg, context, elapsed_seconds);
+    context.partition.report_callback(json_report.c_str(), context.partition.report_callback_data);
+  }
+}
+
+void setup_partitioning_context(mt_kahypar_hypergraph_t hg,
+                                Context& context,
+                                const bool register_utility_objects) {
   check_compatibility(hg, get_preset_c_type(context.partition.preset_type));
   check_if_all_relevant_parameters_are_set(context);
   context.partition.instance_type = get_instance_type(hg);
-  context.partition.partition_type = to_partition_c_type(context.partition.preset_type, context.partition.instance_type);
-  prepare_context(context);
+  context.partition.partition_type = PartitionerFacade::partitionType(hg, context);
+  prepare_context(context, register_utility_objects);
   context.partition.num_vcycles = 0;
-  return PartitionerFacade::partition(hg, context, target_graph);
+}
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+// ! Returns true, if the hypergraph uses the static hypergraph data structure,
+// ! but all of its nets are edges of a graph (two distinct pins)
+bool is_two_pin_hypergraph(mt_kahypar_hypergraph_t hg) {
+  if ( hg.type != STATIC_HYPERGRAPH ) {
+    return false;
+  }
+  const ds::StaticHypergraph& hypergraph = utils::cast<ds::StaticHypergraph>(hg);
+  return hypergraph.initialNumEdges() > 0 && tbb::parallel_reduce(
+    tbb::blocked_range<HyperedgeID>(ID(0), hypergraph.initialNumEdges()), true,
+    [&](const tbb::blocked_range<HyperedgeID>& range, bool is_graph) {
+      for ( HyperedgeID he = range.begin(); is_graph && he < range.end(); ++he ) {
+        if ( !hypergraph.edgeIsEnabled(he) || hypergraph.edgeSize(he) != 2 ) {
+          is_graph = false;
+        } else {
+          auto pins = hypergraph.pins(he);
+          auto it = pins.begin();
+          const HypernodeID u = *it;
+          is_graph = u != *(++it);
+        }
+      }
+      return is_graph;
+    }, [](const bool lhs, const bool rhs) {
+      return lhs && rhs;
+    });
+}
+
+// ! Constructs a static graph that contains an edge for each net of the hypergraph
+ds::StaticGraph to_static_graph(const ds::StaticHypergraph& hypergraph, const PartitionID k) {
+  const HypernodeID num_nodes = hypergraph.initialNumNodes();
+  const HyperedgeID num_edges = hypergraph.initialNumEdges();
+  vec<std::pair<HypernodeID, HypernodeID>> edges(num_edges);
+  vec<HyperedgeWeight> edge_weights(num_edges);
+  vec<HypernodeWeight> node_weights(num_nodes);
+  hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+    auto pins = hypergraph.pins(he);
+    auto it = pins.begin();
+    edges[he].first = *it;
+    edges[he].second = *(++it);
+    edge_weights[he] = hypergraph.edgeWeight(he);
+  });
+  hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+    node_weights[hn] = hypergraph.nodeWeight(hn);
+  });
+  ds::StaticGraph graph = StaticGraphFactory::construct_from_graph_edges(
+    num_nodes, num_edges, edges, edge_weights.data(), node_weights.data(), true);
+  graph.setNumRemovedHyperedges(hypergraph.numRemovedHyperedges());
+
+  if ( hypergraph.hasFixedVertices() ) {
+    vec<PartitionID> fixed_vertices(num_nodes, kInvalidPartition);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      if ( hypergraph.isFixed(hn) ) {
+        fixed_vertices[hn] = hypergraph.fixedVertexBlock(hn);
+      }
+    });
+    mt_kahypar_hypergraph_t graph_hg {
+      reinterpret_cast<mt_kahypar_hypergraph_s*>(&graph), STATIC_GRAPH };
+    io::addFixedVertices(graph_hg, fixed_vertices.data(), k);
+  }
+  return graph;
+}
+#endif
+
+mt_kahypar_partitioned_hypergraph_t partition_impl(mt_kahypar_hypergraph_t hg,
+                                                   Context& context,
+                                                   TargetGraph* target_graph,
+                                                   PartitioningSession* session = nullptr,
+                                                   const bool register_utility_objects = true);
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+// ! Hypergraphs that only contain two-pin nets are partitioned with the graph data
+// ! structures, which are faster and need less memory. The partition is then
+// ! transferred to a partitioned hypergraph on the original input.
+mt_kahypar_partitioned_hypergraph_t partition_as_graph(mt_kahypar_hypergraph_t hg,
+                                                       Context& context,
+                                                       TargetGraph* target_graph,
+                                                       PartitioningSession* session,
+                                                       const bool register_utility_objects) {
+  ASSERT(hg.type == STATIC_HYPERGRAPH);
+  ds::StaticHypergraph& hypergraph = utils::cast<ds::StaticHypergraph>(hg);
+  // The graph partitioner replaces the objective function and gain policy by their
+  // graph equivalents, which are restored for the partitioned hypergraph
+  const Objective objective = context.partition.objective;
+  const GainPolicy gain_policy = context.partition.gain_policy;
+  ds::StaticGraph graph = to_static_graph(hypergraph, context.partition.k);
+  mt_kahypar_hypergraph_t graph_hg {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(&graph), STATIC_GRAPH };
+  mt_kahypar_partitioned_hypergraph_t partitioned_graph =
+    partition_impl(graph_hg, context, target_graph, session, register_utility_objects);
+
+  vec<PartitionID> partition(hypergraph.initialNumNodes(), kInvalidPartition);
+  get_partition<true>(partitioned_graph, partition.data());
+  const PartitionID k = context.partition.k;
+  utils::delete_partitioned_hypergraph(partitioned_graph);
+
+  context.partition.instance_type = InstanceType::hypergraph;
+  context.partition.objective = objective;
+  context.partition.gain_policy = gain_policy;
+  context.partition.partition_type = PartitionerFacade::partitionType(hg, context);
+  if ( context.partition.partition_type == LARGE_K_PARTITIONING ) {
+    return create_partitioned_hypergraph<SparsePartitionedHypergraph>(hypergraph, k, partition.data());
+  }
+  return create_partitioned_hypergraph<StaticPartitionedHypergraph>(hypergraph, k, partition.data());
+}
+#endif
+
+// ! Partitions a shallow copy of the input hypergraph that shares its pins and incident nets.
+// ! The preprocessing and the partition only modify the copy. The partition is then
+// ! transferred to a partitioned hypergraph on the original input.
+mt_kahypar_partitioned_hypergraph_t partition_shared_input(mt_kahypar_hypergraph_t hg,
+                                                           Context& context,
+                                                           TargetGraph* target_graph,
+                                                           PartitioningSession* session,
+                                                           const bool register_utility_objects) {
+  ASSERT(hg.type == STATIC_HYPERGRAPH);
+  ds::StaticHypergraph& hypergraph = utils::cast<ds::StaticHypergraph>(hg);
+  ds::StaticHypergraph shallow_copy = hypergraph.shallowCopy(parallel_tag_t { });
+  mt_kahypar_hypergraph_t shallow_copy_hg {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(&shallow_copy), STATIC_HYPERGRAPH };
+  context.partition.shared_input = false;
+  mt_kahypar_partitioned_hypergraph_t partitioned_hg =
+    partition_impl(shallow_copy_hg, context, target_graph, session, register_utility_objects);
+  context.partition.shared_input = true;
+
+  vec<PartitionID> partition(hypergraph.initialNumNodes(), kInvalidPartition);
+  get_partition<true>(partitioned_hg, partition.data());
+  const PartitionID k = context.partition.k;
+  const mt_kahypar_partition_type_t partition_type = partitioned_hg.type;
+  utils::delete_partitioned_hypergraph(partitioned_hg);
+
+  if ( partition_type == LARGE_K_PARTITIONING ) {
+    return create_partitioned_hypergraph<SparsePartitionedHypergraph>(hypergraph, k, partition.data());
+  }
+  return create_partitioned_hypergraph<StaticPartitionedHypergraph>(hypergraph, k, partition.data());
+}
+
+mt_kahypar_partitioned_hypergraph_t partition_impl(mt_kahypar_hypergraph_t hg,
+                                                   Context& context,
+                                                   TargetGraph* target_graph,
+                                                   PartitioningSession* session,
+                                                   const bool register_utility_objects) {
+  #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+  if ( context.partition.partition_two_pin_hypergraphs_as_graphs && is_two_pin_hypergraph(hg) ) {
+    // Does not modify the input hypergraph
+    return partition_as_graph(hg, context, target_graph, session, register_utility_objects);
+  }
+  #endif
+  if ( context.partition.shared_input && hg.type == STATIC_HYPERGRAPH ) {
+    return partition_shared_input(hg, context, target_graph, session, register_utility_objects);
+  }
+  setup_partitioning_context(hg, context, register_utility_objects && session == nullptr);
+  if ( session ) {
+    session->acquireMemoryPool(hg, context);
+  }
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  mt_kahypar_partitioned_hypergraph_t phg = PartitionerFacade::partition(hg, context, target_graph);
+  report_partitioning_result(phg, context, start);
+  return phg;
 }
 
 mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hg, const Context& context) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  Context partition_context(context);
+  return execute_with_thread_limit(partition_context, [&] {
+    return partition_impl(hg, partition_context, nullptr);
+  });
+}
+
+void PartitioningSession::partition(mt_kahypar_hypergraph_t hypergraph, mt_kahypar_partition_id_t* partition) {
+  std::unique_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  Context context(_context);
+  mt_kahypar_partitioned_hypergraph_t phg { nullptr, NULLPTR_PARTITION };
+  try {
+    phg = execute_with_thread_limit(context, [&] {
+      return partition_impl(hypergraph, context, nullptr, this);
+    });
+    get_partition<true>(phg, partition);
+  } catch ( ... ) {
+    // The partitioned hypergraph holds memory chunks of the memory pool
+    // => must be destroyed before the memory pool is reset
+    utils::delete_partitioned_hypergraph(phg);
+    releaseMemoryPool();
+    throw;
+  }
+  utils::delete_partitioned_hypergraph(phg);
+  releaseMemoryPool();
+}
+
+// ! Partitions many independent (hyper)graphs concurrently. Each instance is partitioned
+// ! sequentially within a single-threaded task arena, which avoids the parallelization
+// ! overhead on small instances. The partition of failed instances is set to nullptr and
+// ! the exception of the first failed instance is returned (nullptr, if all succeeded).
+std::exception_ptr partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                   const Context* const* contexts,
+                                   const size_t num_instances,
+                                   mt_kahypar_partitioned_hypergraph_t* partitioned_hgs) {
+  struct SequentialWorker {
+    SequentialWorker() :
+      arena(1, 1),
+      utility_id(utils::Utilities::instance().registerNewUtilityObjects()) { }
+
+    tbb::task_arena arena;
+    // Reused by all instances partitioned by this worker
+    size_t utility_id;
+  };
+
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  tbb::enumerable_thread_specific<SequentialWorker> workers;
+  std::vector<std::exception_ptr> exceptions(num_instances);
+  tbb::parallel_for(UL(0), num_instances, [&](const size_t i) {
+    partitioned_hgs[i] = mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+    SequentialWorker& worker = workers.local();
+    worker.arena.execute([&] {
+      try {
+        Context context(*contexts[i]);
+        context.utility_id = worker.utility_id;
+        utils::Utilities::instance().getTimer(context.utility_id).clear();
+        utils::Utilities::instance().getStats(context.utility_id).clear();
+        partitioned_hgs[i] = partition_impl(hypergraphs[i], context, nullptr, nullptr, false);
+      } catch ( ... ) {
+        exceptions[i] = std::current_exception();
+      }
+    });
+  });
+
+  for ( const std::exception_ptr& ex : exceptions ) {
+    if ( ex ) {
+      return ex;
+    }
+  }
+  return nullptr;
+}
+
+// ####################### Buffered Streaming #######################
+
+/**
+ * Buffered streaming partitioner for graphs whose nodes arrive one after another
+ * (similar to HeiStream). The nodes are collected in a buffer of fixed size. A full
+ * buffer is partitioned with the multilevel partitioner together with one node per
+ * non-empty block, which is fixed to that block and carries the weight of all nodes
+ * already assigned to it. Edges to previously assigned nodes are redirected to the node
+ * of their block. Afterwards, the nodes of the buffer are permanently assigned.
+ *
+ * Besides the block of each node, the memory consumption only depends on the buffer size.
+ * The buffers are partitioned with a partitioning session, which reuses the memory pool.
+ */
+class StreamingPartitioner {
+
+ public:
+  StreamingPartitioner(const Context& context,
+                       const HypernodeID num_nodes,
+                       const HypernodeWeight total_weight,
+                       const HypernodeID buffer_size) :
+    _session(nullptr),
+    _context(context),
+    _k(context.partition.k),
+    _max_block_weight(0),
+    _partition(num_nodes, kInvalidPartition),
+    _block_weights(std::max(context.partition.k, 0), 0),
+    _block_sizes(std::max(context.partition.k, 0), 0),
+    _next_node(0),
+    _buffer_begin(0),
+    _buffer_size(buffer_size),
+    _buffer_weights(),
+    _buffer_offsets(1, 0),
+    _buffer_neighbors(),
+    _buffer_edge_weights() {
+    if ( _k < 2 ) {
+      throw InvalidParameterException("Number of blocks must be at least two");
+    }
+    if ( buffer_size == 0 ) {
+      throw InvalidParameterException("Buffer size must be greater than zero");
+    }
+    // The balance constraint refers to the total weight of the stream
+    _max_block_weight = std::ceil((1.0 + _context.partition.epsilon) *
+      std::ceil(static_cast<double>(total_weight) / _k));
+    const vec<HypernodeWeight> max_block_weights(_k, _max_block_weight);
+    set_individual_block_weights(_context, _k, max_block_weights.data());
+    _session = std::make_unique<PartitioningSession>(_context);
+  }
+
+  StreamingPartitioner(const StreamingPartitioner&) = delete;
+  StreamingPartitioner & operator= (const StreamingPartitioner &) = delete;
+
+  StreamingPartitioner(StreamingPartitioner&&) = delete;
+  StreamingPartitioner & operator= (StreamingPartitioner &&) = delete;
+
+  // ! Adds the next node of the stream (its ID is the number of previously added nodes).
+  // ! Only edges to previously added nodes are considered, i.e., the adjacency list may
+  // ! contain all neighbors or only the neighbors that arrived earlier.
+  void addNode(const mt_kahypar_hypernode_weight_t weight,
+               const mt_kahypar_hypernode_id_t* neighbors,
+               const mt_kahypar_hyperedge_weight_t* edge_weights,
+               const size_t degree) {
+    if ( _next_node >= _partition.size() ) {
+      throw InvalidInputException("Stream contains more nodes than announced");
+    }
+    for ( size_t i = 0; i < degree; ++i ) {
+      if ( neighbors[i] >= _partition.size() ) {
+        throw InvalidInputException("Node " + STR(neighbors[i]) + " does not exist");
+      }
+      if ( neighbors[i] < _next_node ) {
+        _buffer_neighbors.push_back(neighbors[i]);
+        _buffer_edge_weights.push_back(edge_weights ? edge_weights[i] : 1);
+      }
+    }
+    _buffer_weights.push_back(weight);
+    _buffer_offsets.push_back(_buffer_neighbors.size());
+    ++_next_node;
+    if ( _next_node - _buffer_begin == _buffer_size ) {
+      partitionBuffer();
+    }
+  }
+
+  // ! Partitions the nodes that remain in the buffer
+  void flush() {
+    if ( _next_node > _buffer_begin ) {
+      partitionBuffer();
+    }
+  }
+
+  // ! Block of each node (kInvalidPartition, if the node is not assigned yet)
+  const vec<PartitionID>& partition() const {
+    return _partition;
+  }
+
+ private:
+  void partitionBuffer() {
+    const HypernodeID num_buffer_nodes = _next_node - _buffer_begin;
+    // Nodes of the model: buffer nodes followed by one node per non-empty block
+    vec<HypernodeID> block_node(_k, kInvalidHypernode);
+    vec<HypernodeWeight> node_weights(_buffer_weights.begin(), _buffer_weights.end());
+    for ( PartitionID block = 0; block < _k; ++block ) {
+      if ( _block_sizes[block] > 0 ) {
+        block_node[block] = node_weights.size();
+        node_weights.push_back(_block_weights[block]);
+      }
+    }
+
+    // Edges of the model, parallel edges are merged
+    using WeightedEdge = std::pair<std::pair<HypernodeID, HypernodeID>, HyperedgeWeight>;
+    vec<WeightedEdge> edges;
+    for ( HypernodeID u = 0; u < num_buffer_nodes; ++u ) {
+      for ( size_t i = _buffer_offsets[u]; i < _buffer_offsets[u + 1]; ++i ) {
+        const HypernodeID v = _buffer_neighbors[i];
+        const HypernodeID target = v >= _buffer_begin ? v - _buffer_begin : block_node[_partition[v]];
+        ASSERT(target != kInvalidHypernode && target != u);
+        edges.push_back({ std::make_pair(std::min(u, target), std::max(u, target)), _buffer_edge_weights[i] });
+      }
+    }
+    std::sort(edges.begin(), edges.end());
+    vec<std::pair<HypernodeID, HypernodeID>> edge_vector;
+    vec<HyperedgeWeight> edge_weights;
+    for ( const WeightedEdge& edge : edges ) {
+      if ( !edge_vector.empty() && edge_vector.back() == edge.first ) {
+        edge_weights.back() += edge.second;
+      } else {
+        edge_vector.push_back(edge.first);
+        edge_weights.push_back(edge.second);
+      }
+    }
+
+    const HypernodeID num_model_nodes = node_weights.size();
+    vec<PartitionID> fixed_vertices(num_model_nodes, kInvalidPartition);
+    for ( PartitionID block = 0; block < _k; ++block ) {
+      if ( block_node[block] != kInvalidHypernode ) {
+        fixed_vertices[block_node[block]] = block;
+      }
+    }
+
+    mt_kahypar_hypergraph_t model = create_graph(_context, num_model_nodes, edge_vector.size(),
+      edge_vector, edge_weights.data(), node_weights.data());
+    vec<PartitionID> model_partition(num_model_nodes, kInvalidPartition);
+    try {
+      io::addFixedVertices(model, fixed_vertices.data(), _k);
+      _session->partition(model, model_partition.data());
+    } catch ( ... ) {
+      utils::delete_hypergraph(model);
+      throw;
+    }
+    utils::delete_hypergraph(model);
+
+    for ( HypernodeID u = 0; u < num_buffer_nodes; ++u ) {
+      const PartitionID block = model_partition[u];
+      ASSERT(block >= 0 && block < _k);
+      _partition[_buffer_begin + u] = block;
+      _block_weights[block] += _buffer_weights[u];
+      ++_block_sizes[block];
+    }
+
+    _buffer_begin = _next_node;
+    _buffer_weights.clear();
+    _buffer_offsets.assign(1, 0);
+    _buffer_neighbors.clear();
+    _buffer_edge_weights.clear();
+  }
+
+  std::unique_ptr<PartitioningSession> _session;
+  Context _context;
+  const PartitionID _k;
+  HypernodeWeight _max_block_weight;
+  vec<PartitionID> _partition;
+  vec<HypernodeWeight> _block_weights;
+  vec<HypernodeID> _block_sizes;
+  // ! ID of the next node of the stream
+  HypernodeID _next_node;
+  // ! ID of the first node in the buffer
+  HypernodeID _buffer_begin;
+  const HypernodeID _buffer_size;
+  // ! Adjacency of the buffer nodes (only edges to previously added nodes)
+  vec<HypernodeWeight> _buffer_weights;
+  vec<size_t> _buffer_offsets;
+  vec<HypernodeID> _buffer_neighbors;
+  vec<HyperedgeWeight> _buffer_edge_weights;
+};
+
+
+// ####################### Coarsening Hierarchies #######################
+
+mt_kahypar_hierarchy_t create_hierarchy(mt_kahypar_hypergraph_t hg, const Context& context) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  Context hierarchy_context(context);
+  return execute_with_thread_limit(hierarchy_context, [&] {
+    setup_partitioning_context(hg, hierarchy_context, true);
+    return PartitionerFacade::coarsen(hg, hierarchy_context);
+  });
+}
+
+mt_kahypar_hierarchy_t read_hierarchy(mt_kahypar_hypergraph_t hg,
+                                      const Context& context,
+                                      const std::string& file_name) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  Context hierarchy_context(context);
+  return execute_with_thread_limit(hierarchy_context, [&] {
+    setup_partitioning_context(hg, hierarchy_context, true);
+    return PartitionerFacade::readHierarchy(hg, hierarchy_context, file_name);
+  });
+}
+
+mt_kahypar_partitioned_hypergraph_t partition_with_hierarchy(mt_kahypar_hypergraph_t hg,
+                                                             const mt_kahypar_hierarchy_t hierarchy,
+                                                             const Context& context) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  Context partition_context(context);
+  return execute_with_thread_limit(partition_context, [&] {
+    setup_partitioning_context(hg, partition_context, true);
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    mt_kahypar_partitioned_hypergraph_t phg =
+      PartitionerFacade::partition(hg, partition_context, hierarchy);
+    report_partitioning_result(phg, partition_context, start);
+    return phg;
+  });
+}
+
+mt_kahypar_partitioned_hypergraph_t repartition(mt_kahypar_hypergraph_t hg,
+                                                const Context& context,
+                                                const mt_kahypar_partition_id_t* previous_partition,
+                                                const mt_kahypar_hypernode_id_t* touched_nodes,
+                                                const size_t num_touched_nodes) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   Context partition_context(context);
-  return partition_impl(hg, partition_context, nullptr);
+  return execute_with_thread_limit(partition_context, [&] {
+    setup_partitioning_context(hg, partition_context, true);
+
+    vec<PartitionID> partition(previous_partition, previous_partition + num_nodes<true>(hg));
+    vec<HypernodeID> touched(touched_nodes, touched_nodes + num_touched_nodes);
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    mt_kahypar_partitioned_hypergraph_t phg =
+      PartitionerFacade::repartition(hg, partition_context, partition, touched);
+    report_partitioning_result(phg, partition_context, start);
+    return phg;
+  });
+}
+
+void precompute_target_graph(TargetGraph& target_graph, const Context& context) {
+  const size_t max_steiner_tree_size = std::max(UL(2), std::min(
+    context.mapping.max_steiner_tree_size, UL(target_graph.numBlocks())));
+  target_graph.initialize(max_steiner_tree_size,
+    context.mapping.steiner_tree_cache_size * 1024 * 1024);
 }
 
 mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg, TargetGraph& target_graph, const Context& context) {
@@ -434,9 +1257,12 @@ mt_kahypar_partitioned_hypergraph_t map(mt_kahypar_hypergraph_t hg, TargetGraph&
         << " blocks, but the target graph has " << target_graph.graph().initialNumNodes() << " blocks";
     throw InvalidInputException(ss.str());
   }
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   Context partition_context(context);
   partition_context.partition.objective = Objective::steiner_tree;
-  return partition_impl(hg, partition_context, &target_graph);
+  return execute_with_thread_limit(partition_context, [&] {
+    return partition_impl(hg, partition_context, &target_graph);
+  });
 }
 
 
@@ -449,24 +1275,52 @@ void improve_impl(mt_kahypar_partitioned_hypergraph_t phg,
   check_compatibility(phg, get_preset_c_type(context.partition.preset_type));
   check_if_all_relevant_parameters_are_set(context);
   context.partition.instance_type = get_instance_type(phg);
-  context.partition.partition_type = to_partition_c_type(context.partition.preset_type, context.partition.instance_type);
+  context.partition.partition_type = phg.type;
   prepare_context(context);
   context.partition.num_vcycles = num_vcycles;
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   PartitionerFacade::improve(phg, context, target_graph);
+  report_partitioning_result(phg, context, start);
 }
 
 void improve(mt_kahypar_partitioned_hypergraph_t phg, const Context& context, const size_t num_vcycles) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
+  Context partition_context(context);
+  execute_with_thread_limit(partition_context, [&] {
+    improve_impl(phg, partition_context, num_vcycles, nullptr);
+  });
+}
+
+void improve_region(mt_kahypar_partitioned_hypergraph_t phg,
+                    const Context& context,
+                    const mt_kahypar_hypernode_id_t* region_nodes,
+                    const size_t num_region_nodes,
+                    const mt_kahypar_hypernode_id_t radius) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   Context partition_context(context);
-  improve_impl(phg, partition_context, num_vcycles, nullptr);
+  execute_with_thread_limit(partition_context, [&] {
+    check_compatibility(phg, get_preset_c_type(partition_context.partition.preset_type));
+    check_if_all_relevant_parameters_are_set(partition_context);
+    partition_context.partition.instance_type = get_instance_type(phg);
+    partition_context.partition.partition_type = phg.type;
+    prepare_context(partition_context);
+    vec<HypernodeID> nodes(region_nodes, region_nodes + num_region_nodes);
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    PartitionerFacade::improveRegion(phg, partition_context, nodes, radius);
+    report_partitioning_result(phg, partition_context, start);
+  });
 }
 
 void improve_mapping(mt_kahypar_partitioned_hypergraph_t phg,
                     TargetGraph& target_graph,
                     const Context& context,
                     const size_t num_vcycles) {
+  std::shared_lock<std::shared_timed_mutex> lock(memory_pool_mutex());
   Context partition_context(context);
   partition_context.partition.objective = Objective::steiner_tree;
-  improve_impl(phg, partition_context, num_vcycles, &target_graph);
+  execute_with_thread_limit(partition_context, [&] {
+    improve_impl(phg, partition_context, num_vcycles, &target_graph);
+  });
 }
 
 } // namespace lib
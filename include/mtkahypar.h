@@ -107,6 +107,29 @@ MT_KAHYPAR_API mt_kahypar_objective_t mt_kahypar_get_objective(const mt_kahypar_
  */
 MT_KAHYPAR_API void mt_kahypar_set_seed(const size_t seed);
 
+/**
+ * Returns true, if the library is built with 64-bit vertex and hyperedge IDs (KAHYPAR_USE_64_BIT_IDS).
+ * Otherwise, 32-bit IDs are used internally and creating (hyper)graphs with more than 2^32 - 1
+ * vertices, hyperedges or pins fails with INVALID_INPUT.
+ */
+MT_KAHYPAR_API bool mt_kahypar_uses_64_bit_ids();
+
+/**
+ * Enables or disables huge page (2MB) backed storage for large internal arrays (not thread-safe).
+ * This reduces TLB misses on large (hyper)graphs, but only affects (hyper)graphs that are
+ * created or partitioned afterwards. Has no effect if transparent huge pages are disabled on the system.
+ */
+MT_KAHYPAR_API void mt_kahypar_set_huge_page_allocation(const bool enable);
+
+/**
+ * Enables or disables asynchronous deallocation (not thread-safe). If enabled, mt_kahypar_free_hypergraph(...),
+ * mt_kahypar_free_partitioned_hypergraph(...) and mt_kahypar_free_hierarchy(...) return immediately and the
+ * memory is freed on a background thread. The partitioner then also frees large internal data structures
+ * (e.g., the levels of the coarsening hierarchy) concurrently with the next phase.
+ * Disabling it blocks until all pending deallocations are finished.
+ */
+MT_KAHYPAR_API void mt_kahypar_set_asynchronous_deallocation(const bool enable);
+
 /**
  * Sets individual target block weights for each block of the partition.
  * A balanced partition then satisfies that the weight of each block is smaller or equal than the
@@ -118,6 +141,35 @@ MT_KAHYPAR_API void mt_kahypar_set_individual_target_block_weights(mt_kahypar_co
                                                                    const mt_kahypar_partition_id_t num_blocks,
                                                                    const mt_kahypar_hypernode_weight_t* block_weights);
 
+/**
+ * Registers a callback that is invoked at the end of each partitioning, mapping or improvement
+ * call with this context. It receives a JSON object containing the resulting partition metrics,
+ * the full hierarchy of phase timings, all stats counters and the memory consumption of the
+ * partitioned (hyper)graph and the memory pool. Passing NULL as callback disables the report.
+ */
+MT_KAHYPAR_API void mt_kahypar_set_report_callback(mt_kahypar_context_t* context,
+                                                   mt_kahypar_report_callback_t callback,
+                                                   void* user_data);
+
+/**
+ * Registers a callback that is invoked during partitioning, mapping or improvement calls with
+ * this context after each coarsening and refinement level, after initial partitioning and before
+ * each V-cycle. Passing NULL as callback disables it.
+ */
+MT_KAHYPAR_API void mt_kahypar_set_progress_callback(mt_kahypar_context_t* context,
+                                                     mt_kahypar_progress_callback_t callback,
+                                                     void* user_data);
+
+/**
+ * Registers a callback that is polled at safe points of partitioning, mapping or improvement calls
+ * with this context (e.g., between levels of the multilevel hierarchy and between rounds of the
+ * refinement algorithms). Once it returns true, the call stops as fast as possible, releases all
+ * intermediate data and returns with status CANCELLED. Passing NULL as callback disables it.
+ */
+MT_KAHYPAR_API void mt_kahypar_set_cancel_callback(mt_kahypar_context_t* context,
+                                                   mt_kahypar_cancel_callback_t callback,
+                                                   void* user_data);
+
 
 // ####################### Thread Pool Initialization #######################
 
@@ -125,9 +177,42 @@ MT_KAHYPAR_API void mt_kahypar_set_individual_target_block_weights(mt_kahypar_co
  * Must be called once for global initialization, before trying to create or partition any (hyper)graph.
  *
  * Note: if 'num_threads' is larger than the number of actually available CPUs, only a reduced number of threads will be used.
+ * If 'interleaved_allocations' is false, the default first-touch policy of the operating system is kept. Large internal
+ * arrays are initialized with a static assignment of index ranges to threads, such that each range is placed on the
+ * NUMA node of the thread that initialized it.
+ * The number of threads is an upper bound for all calls. Single calls can use fewer threads via the MAX_THREADS
+ * context parameter, in which case their thread-local data structures are sized accordingly.
  */
 MT_KAHYPAR_API void mt_kahypar_initialize(const size_t num_threads, const bool interleaved_allocations);
 
+/**
+ * Alternative to mt_kahypar_initialize(...) for applications that manage their own threads, e.g., with
+ * their own TBB task arenas or an OpenMP thread pool. The TBB parallelism of the process is not limited
+ * globally and threads are not pinned to CPUs. Each call runs inside the task arena of the caller and
+ * uses at most 'max_num_threads' threads. The MAX_THREADS context parameter further limits single calls,
+ * such that several concurrent calls can share the cores predictably.
+ *
+ * Note: must be called once instead of mt_kahypar_initialize(...), before any other function.
+ */
+MT_KAHYPAR_API void mt_kahypar_initialize_embedded(const size_t max_num_threads);
+
+/**
+ * Uses the given hardware topology in hwloc XML format (e.g., exported with mt_kahypar_export_hardware_topology(...)
+ * or 'lstopo topology.xml') instead of discovering the topology of the machine, which reduces the startup time on
+ * large machines. Must be called before mt_kahypar_initialize(...).
+ *
+ * Note: fails if the XML is invalid, if the topology was already loaded or if the library was built without hwloc.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_set_hardware_topology(const char* xml,
+                                                                    mt_kahypar_error_t* error);
+
+/**
+ * Writes the hardware topology in hwloc XML format to the buffer (including the terminating null character).
+ * Similar to snprintf, the output is truncated if the buffer is too small. Returns the required buffer size,
+ * or 0 if the library was built without hwloc.
+ */
+MT_KAHYPAR_API size_t mt_kahypar_export_hardware_topology(char* buffer, const size_t buffer_size);
+
 
 // ####################### Error Handling #######################
 
@@ -153,6 +238,10 @@ MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_read_hypergraph_from_file(cons
 /**
  * Reads a target graph in Metis file format. The target graph can be used in the
  * 'mt_kahypar_map' function to map a (hyper)graph onto it.
+ *
+ * \note If '<file_name>.steiner_trees_<m>.bin' exists and matches the target graph, the
+ * precomputed Steiner trees are memory-mapped from it instead of being recomputed. If the
+ * context parameter WRITE_STEINER_TREE_TABLES is set, the file is written after the precomputation.
  */
 MT_KAHYPAR_API mt_kahypar_target_graph_t* mt_kahypar_read_target_graph_from_file(const char* file_name,
                                                                                  const mt_kahypar_context_t* context,
@@ -178,6 +267,31 @@ MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kah
                                                                     const mt_kahypar_hypernode_weight_t* vertex_weights,
                                                                     mt_kahypar_error_t* error);
 
+/**
+ * Constructs a hypergraph from a given adjacency array like 'mt_kahypar_create_hypergraph', but
+ * transfers the ownership of hyperedge_indices and hyperedges to the library. This avoids that
+ * the input and a copy of it are resident at the same time during construction.
+ *
+ * For all presets except HIGHEST_QUALITY, the hyperedges array is reused as pin storage of the
+ * hypergraph (the pin IDs are converted in place if the ID types of the interface and the library
+ * differ). It is released with free_callback(hyperedges, user_data) when the hypergraph is freed.
+ * hyperedge_indices is released with free_callback(hyperedge_indices, user_data) after construction.
+ * Both buffers are also released if the construction fails.
+ *
+ * \note The buffers must not be accessed by the caller after calling this function.
+ * \note free_callback might be called from a different thread than the one that created the buffers.
+ */
+MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph_from_owned_buffers(const mt_kahypar_context_t* context,
+                                                                                       const mt_kahypar_hypernode_id_t num_vertices,
+                                                                                       const mt_kahypar_hyperedge_id_t num_hyperedges,
+                                                                                       size_t* hyperedge_indices,
+                                                                                       mt_kahypar_hyperedge_id_t* hyperedges,
+                                                                                       const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                                                       const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                                                       mt_kahypar_free_callback_t free_callback,
+                                                                                       void* user_data,
+                                                                                       mt_kahypar_error_t* error);
+
 /**
  * Constructs a graph from a given edge list vector.
  *
@@ -195,6 +309,30 @@ MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_
                                                                const mt_kahypar_hyperedge_weight_t* edge_weights,
                                                                const mt_kahypar_hypernode_weight_t* vertex_weights,
                                                                mt_kahypar_error_t* error);
+
+/**
+ * Constructs a graph from an adjacency array in CSR format (as in METIS). The neighbors of
+ * vertex u are stored in adjncy[xadj[u]], ..., adjncy[xadj[u + 1] - 1], i.e., xadj has
+ * num_vertices + 1 entries and each edge is contained twice in adjncy (once per direction).
+ *
+ * Example:
+ * xadj:         | 0 2 4 6 8 |
+ * adjncy:       | 1 2 | 0 3 | 0 3 | 1 2 |
+ * Defines the same graph as the example of 'mt_kahypar_create_graph'.
+ *
+ * \note Self-loops and parallel edges are not allowed. If edge_weights is given, it must have the
+ *       same size as adjncy and both directions of an edge must have the same weight.
+ * \note The graph is built directly from the adjacency array without sorting the edges.
+ * \note After construction, the arguments of this function are no longer needed and can be deleted.
+ */
+MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_create_graph_from_csr(const mt_kahypar_context_t* context,
+                                                                        const mt_kahypar_hypernode_id_t num_vertices,
+                                                                        const size_t* xadj,
+                                                                        const mt_kahypar_hypernode_id_t* adjncy,
+                                                                        const mt_kahypar_hyperedge_weight_t* edge_weights,
+                                                                        const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                                        mt_kahypar_error_t* error);
+
 /**
  * Constructs a target graph from a given edge list vector. The target graph can be used in the
  * 'mt_kahypar_map' function to map a (hyper)graph onto it.
@@ -213,6 +351,17 @@ MT_KAHYPAR_API mt_kahypar_target_graph_t* mt_kahypar_create_target_graph(const m
                                                                          const mt_kahypar_hyperedge_weight_t* edge_weights,
                                                                          mt_kahypar_error_t* error);
 
+/**
+ * Precomputes the Steiner trees of the target graph for the mapping parameters of the context.
+ * Afterwards, the target graph is immutable and can be reused by several (also concurrent) calls
+ * of 'mt_kahypar_map' and 'mt_kahypar_improve_mapping' without repeating the precomputation.
+ *
+ * \note If the target graph is not precomputed, the first call of 'mt_kahypar_map' precomputes it.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_precompute_target_graph(mt_kahypar_target_graph_t* target_graph,
+                                                                      const mt_kahypar_context_t* context,
+                                                                      mt_kahypar_error_t* error);
+
 /**
  * Deletes the (hyper)graph object.
  */
@@ -394,6 +543,171 @@ MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hyp
                                                                   const mt_kahypar_context_t* context,
                                                                   mt_kahypar_error_t* error);
 
+/**
+ * Repartitions a (hyper)graph that was obtained from a previously partitioned (hyper)graph by a small
+ * number of modifications (e.g., inserted or removed nodes, hyperedges or pins).
+ *
+ * The previous partition is projected onto the (hyper)graph, where previous_partition[u] is the block
+ * of node u in the previous partition or -1 if node u is new. New nodes are greedily assigned to the block
+ * to which they are most strongly connected. Afterwards, the partition is rebalanced (if necessary) and
+ * improved with localized refinement that is seeded only from the touched nodes (e.g., the new nodes and
+ * the pins of modified hyperedges). No multilevel cycle is executed, so the running time mainly depends on
+ * the size of the modified region.
+ *
+ * \note The array previous_partition must be of size mt_kahypar_num_hypernodes(hypergraph).
+ * \note The Steiner tree objective is not supported.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_repartition(mt_kahypar_hypergraph_t hypergraph,
+                                                                          const mt_kahypar_context_t* context,
+                                                                          const mt_kahypar_partition_id_t* previous_partition,
+                                                                          const mt_kahypar_hypernode_id_t* touched_nodes,
+                                                                          const size_t num_touched_nodes,
+                                                                          mt_kahypar_error_t* error);
+
+/**
+ * Partitions many independent (hyper)graphs concurrently. The i-th (hyper)graph is partitioned
+ * with the i-th context and the result is stored in partitioned_hgs[i].
+ *
+ * The instances are distributed among all threads and each instance is partitioned sequentially
+ * by a single thread. This maximizes the throughput for a large number of small instances
+ * (e.g., less than 10000 nodes), which do not benefit from internal parallelism.
+ *
+ * \note If an instance cannot be partitioned, the corresponding partitioned hypergraph is set to nullptr
+ *       while all other instances are still partitioned. The error of the first failed instance is reported.
+ *       All successfully partitioned hypergraphs must be freed by the caller in any case.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                                              const mt_kahypar_context_t* const* contexts,
+                                                              const size_t num_instances,
+                                                              mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                                              mt_kahypar_error_t* error);
+
+/**
+ * Creates a partitioning session with a copy of the given partitioning context.
+ *
+ * A session keeps the internal memory pool (including the gain cache storage) and its utility
+ * objects allocated between successive calls to mt_kahypar_session_partition(...). The memory is
+ * sized for the largest (hyper)graph partitioned with the session so far and only grows if an
+ * instance does not fit. This significantly reduces the per-call overhead when partitioning many
+ * small or medium-sized instances.
+ *
+ * \note Calls on sessions are executed one at a time and wait for all other running partitioning
+ *       or construction calls. The memory pool can only be held by one session. Alternating
+ *       between several sessions therefore reallocates it.
+ */
+MT_KAHYPAR_API mt_kahypar_session_t* mt_kahypar_create_session(const mt_kahypar_context_t* context);
+
+/**
+ * Frees a partitioning session and the memory held by it.
+ */
+MT_KAHYPAR_API void mt_kahypar_free_session(mt_kahypar_session_t* session);
+
+/**
+ * Partitions a (hyper)graph with the configuration of the session and writes the block ID of
+ * each node to the given partition array (must be of size mt_kahypar_num_hypernodes(hypergraph)).
+ *
+ * \note The same requirements as for mt_kahypar_partition(...) apply to the context of the session.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_session_partition(mt_kahypar_session_t* session,
+                                                                mt_kahypar_hypergraph_t hypergraph,
+                                                                mt_kahypar_partition_id_t* partition,
+                                                                mt_kahypar_error_t* error);
+
+/**
+ * Creates a buffered streaming partitioner for a graph with num_nodes nodes of total weight
+ * total_weight, whose nodes are added one after another with mt_kahypar_stream_node(...).
+ * Whenever buffer_size nodes are buffered, they are partitioned with the configuration of the
+ * context, while all previously assigned nodes stay fixed to their blocks. The balance
+ * constraint refers to the total weight of the stream.
+ *
+ * \note The memory consumption depends only on the buffer size and the number of nodes.
+ * \note The streaming partitioner must be freed with mt_kahypar_free_streaming_partitioner(...).
+ */
+MT_KAHYPAR_API mt_kahypar_streaming_partitioner_t* mt_kahypar_create_streaming_partitioner(const mt_kahypar_context_t* context,
+                                                                                          const mt_kahypar_hypernode_id_t num_nodes,
+                                                                                          const mt_kahypar_hypernode_weight_t total_weight,
+                                                                                          const mt_kahypar_hypernode_id_t buffer_size,
+                                                                                          mt_kahypar_error_t* error);
+
+/**
+ * Frees a streaming partitioner.
+ */
+MT_KAHYPAR_API void mt_kahypar_free_streaming_partitioner(mt_kahypar_streaming_partitioner_t* streaming_partitioner);
+
+/**
+ * Adds the next node of the stream (the i-th added node has ID i) with its weight and neighbors.
+ * Edges to nodes that are added later are ignored, i.e., the neighbors may either contain the
+ * complete adjacency list or only the neighbors that were added before. The edge weights can be
+ * NULL (unit edge weights).
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_stream_node(mt_kahypar_streaming_partitioner_t* streaming_partitioner,
+                                                          const mt_kahypar_hypernode_weight_t weight,
+                                                          const mt_kahypar_hypernode_id_t* neighbors,
+                                                          const mt_kahypar_hyperedge_weight_t* edge_weights,
+                                                          const size_t num_neighbors,
+                                                          mt_kahypar_error_t* error);
+
+/**
+ * Partitions the nodes that remain in the buffer. Must be called after the last node of the stream.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_flush_stream(mt_kahypar_streaming_partitioner_t* streaming_partitioner,
+                                                           mt_kahypar_error_t* error);
+
+/**
+ * Writes the block ID of each node to the given partition array (must be of size num_nodes).
+ * Nodes that are not assigned yet have block ID -1.
+ */
+MT_KAHYPAR_API void mt_kahypar_get_stream_partition(const mt_kahypar_streaming_partitioner_t* streaming_partitioner,
+                                                    mt_kahypar_partition_id_t* partition);
+
+/**
+ * Computes the community structure and the multilevel hierarchy of a (hyper)graph once. The
+ * hierarchy can then be used to partition the (hyper)graph several times with different numbers
+ * of blocks and imbalance factors (see mt_kahypar_partition_with_hierarchy(...)), which skips
+ * community detection and coarsening. The context should be configured for the smallest number
+ * of blocks, since the hierarchy is only coarsened further if it is not coarse enough.
+ *
+ * \note Only supported for the DEFAULT, QUALITY, DETERMINISTIC and LARGE_K presets
+ *       and (hyper)graphs without fixed vertices.
+ * \note The hierarchy must be freed with mt_kahypar_free_hierarchy(...).
+ */
+MT_KAHYPAR_API mt_kahypar_hierarchy_t mt_kahypar_create_hierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                                                  const mt_kahypar_context_t* context,
+                                                                  mt_kahypar_error_t* error);
+
+/**
+ * Partitions a (hyper)graph starting from a hierarchy computed with mt_kahypar_create_hierarchy(...)
+ * or mt_kahypar_read_hierarchy_from_file(...). Only initial partitioning and uncoarsening are performed.
+ *
+ * \note Parameters other than the number of blocks and the imbalance should be the same
+ *       as when the hierarchy was computed.
+ */
+MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition_with_hierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                                                                       const mt_kahypar_hierarchy_t hierarchy,
+                                                                                       const mt_kahypar_context_t* context,
+                                                                                       mt_kahypar_error_t* error);
+
+/**
+ * Writes a coarsening hierarchy to a file. Only the community structure and the clusterings of
+ * each level are stored, the coarse (hyper)graphs are recontracted when the file is read.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_write_hierarchy_to_file(const mt_kahypar_hierarchy_t hierarchy,
+                                                                      const char* file_name,
+                                                                      mt_kahypar_error_t* error);
+
+/**
+ * Reads a coarsening hierarchy of the given (hyper)graph from a file.
+ */
+MT_KAHYPAR_API mt_kahypar_hierarchy_t mt_kahypar_read_hierarchy_from_file(mt_kahypar_hypergraph_t hypergraph,
+                                                                          const mt_kahypar_context_t* context,
+                                                                          const char* file_name,
+                                                                          mt_kahypar_error_t* error);
+
+/**
+ * Frees a coarsening hierarchy.
+ */
+MT_KAHYPAR_API void mt_kahypar_free_hierarchy(mt_kahypar_hierarchy_t hierarchy);
+
 /**
  * Checks whether or not the given partitioned hypergraph can
  * be improved with the corresponding preset.
@@ -413,6 +727,26 @@ MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_improve_partition(mt_kahypar_parti
                                                                 const size_t num_vcycles,
                                                                 mt_kahypar_error_t* error);
 
+/**
+ * Improves a given partition locally around a set of nodes (e.g., a modified region of a floorplan).
+ *
+ * The region consists of the given nodes and all nodes that are reachable from them via at most
+ * radius hyperedges (radius = 0 restricts the region to the given nodes). Label propagation and FM
+ * are seeded only from the region and only nodes of the region are moved, while all other nodes are
+ * implicitly fixed to their current block. The hypergraph is not copied, so the running time mainly
+ * depends on the size of the region. No multilevel cycle is executed.
+ *
+ * \note The number of blocks specified in the partitioning context must be equal to the
+ *       number of blocks of the given partition.
+ * \note The Steiner tree objective is not supported.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_improve_partition_in_region(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                          const mt_kahypar_context_t* context,
+                                                                          const mt_kahypar_hypernode_id_t* region_nodes,
+                                                                          const size_t num_region_nodes,
+                                                                          const mt_kahypar_hypernode_id_t radius,
+                                                                          mt_kahypar_error_t* error);
+
 /**
  * Improves a given mapping (using the V-cycle technique).
  *
@@ -495,6 +829,33 @@ MT_KAHYPAR_API mt_kahypar_hypernode_id_t mt_kahypar_num_pins_in_block(const mt_k
 MT_KAHYPAR_API void mt_kahypar_get_partition(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                              mt_kahypar_partition_id_t* partition);
 
+/**
+ * Extracts the nested partition with 'num_blocks' blocks from a k-way partition, which must be a power of two smaller
+ * than k (or k itself). The nested partitions for 2, 4, ..., 2^i < k blocks are obtained by merging the blocks that
+ * were split from the same block during recursive bisection. Hence, they are only meaningful if the partition was
+ * computed with the context parameter NESTED_PARTITIONS. The size of the provided array must be at least the number of nodes.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_get_nested_partition(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                                   const mt_kahypar_partition_id_t num_blocks,
+                                                                   mt_kahypar_partition_id_t* partition,
+                                                                   mt_kahypar_error_t* error);
+
+/**
+ * Computes a numbering of the nodes in which each block is contiguous, e.g., for storing each block on a different
+ * processing element. The nodes of block b are permutation[block_offsets[b], block_offsets[b + 1]). Within each block,
+ * the interior nodes come first, followed by the halo nodes (nodes incident to a cut net), which start at halo_offsets[b].
+ * Both are sorted by node ID. The provided arrays must have a size of at least the number of nodes (permutation),
+ * k + 1 (block_offsets) and k (halo_offsets). If cut_nets is not NULL, the (hyper)edges that span more than one
+ * block are written to it in increasing order (size at least the number of (hyper)edges; for graphs, the IDs of the
+ * undirected edges in the input) and their number to num_cut_nets.
+ */
+MT_KAHYPAR_API void mt_kahypar_get_block_ordering(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                  mt_kahypar_hypernode_id_t* permutation,
+                                                  mt_kahypar_hypernode_id_t* block_offsets,
+                                                  mt_kahypar_hypernode_id_t* halo_offsets,
+                                                  mt_kahypar_hyperedge_id_t* cut_nets,
+                                                  mt_kahypar_hyperedge_id_t* num_cut_nets);
+
 /**
  * Extracts the weight of each block from a partition. The size of the provided array must be at least the number of blocks.
  */
@@ -528,6 +889,27 @@ MT_KAHYPAR_API mt_kahypar_hyperedge_weight_t mt_kahypar_steiner_tree(const mt_ka
                                                                      mt_kahypar_target_graph_t* target_graph);
 
 
+/**
+ * Computes all objective functions and the imbalance of the partition in a single parallel pass.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_compute_metrics(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                              const mt_kahypar_context_t* context,
+                                                              mt_kahypar_metrics_t* metrics,
+                                                              mt_kahypar_error_t* error);
+
+/**
+ * Moves each node nodes[i] to block blocks[i] (in parallel) and updates the metrics incrementally
+ * without recomputing them from scratch. The metrics must match the partition before the moves
+ * (e.g., as computed by mt_kahypar_compute_metrics) and each node must occur at most once.
+ */
+MT_KAHYPAR_API mt_kahypar_status_t mt_kahypar_apply_moves(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                          const mt_kahypar_context_t* context,
+                                                          const size_t num_moves,
+                                                          const mt_kahypar_hypernode_id_t* nodes,
+                                                          const mt_kahypar_partition_id_t* blocks,
+                                                          mt_kahypar_metrics_t* metrics,
+                                                          mt_kahypar_error_t* error);
+
 /**
  * Deletes the partitioned (hyper)graph object.
  */
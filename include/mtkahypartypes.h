@@ -34,7 +34,9 @@ typedef enum {
   UNSUPPORTED_OPERATION,
   // errors originating from the OS, e.g. out of memory or failed mmap
   SYSTEM_ERROR,
-  OTHER_ERROR
+  OTHER_ERROR,
+  // the call was cancelled by the cancel callback of the context
+  CANCELLED
 } mt_kahypar_status_t;
 
 /**
@@ -56,6 +58,10 @@ struct mt_kahypar_context_s;
 typedef struct mt_kahypar_context_s mt_kahypar_context_t;
 struct mt_kahypar_target_graph_s;
 typedef struct mt_kahypar_target_graph_s mt_kahypar_target_graph_t;
+struct mt_kahypar_session_s;
+typedef struct mt_kahypar_session_s mt_kahypar_session_t;
+struct mt_kahypar_streaming_partitioner_s;
+typedef struct mt_kahypar_streaming_partitioner_s mt_kahypar_streaming_partitioner_t;
 
 typedef struct mt_kahypar_hypergraph_s mt_kahypar_hypergraph_s;
 typedef struct {
@@ -79,12 +85,80 @@ typedef struct {
   mt_kahypar_partition_type_t type;
 } mt_kahypar_partitioned_hypergraph_const_t;
 
+typedef struct mt_kahypar_hierarchy_s mt_kahypar_hierarchy_s;
+typedef struct {
+  mt_kahypar_hierarchy_s* hierarchy;
+  // type of the (hyper)graph for which the hierarchy was computed
+  mt_kahypar_hypergraph_type_t type;
+} mt_kahypar_hierarchy_t;
+
 typedef unsigned long int mt_kahypar_hypernode_id_t;
 typedef unsigned long int mt_kahypar_hyperedge_id_t;
 typedef int mt_kahypar_hypernode_weight_t;
 typedef int mt_kahypar_hyperedge_weight_t;
 typedef int mt_kahypar_partition_id_t;
 
+/**
+ * Objective values and imbalance of a partition.
+ */
+typedef struct {
+  mt_kahypar_hyperedge_weight_t cut;
+  mt_kahypar_hyperedge_weight_t km1;
+  mt_kahypar_hyperedge_weight_t soed;
+  // only computed if a target graph is attached to the partition (e.g., after mt_kahypar_steiner_tree)
+  mt_kahypar_hyperedge_weight_t steiner_tree;
+  double imbalance;
+} mt_kahypar_metrics_t;
+
+/**
+ * Receives a machine-readable report of a partitioning call as a JSON object
+ * (result metrics, timer hierarchy, stats counters and memory consumption).
+ * The string is only valid for the duration of the callback.
+ */
+typedef void (*mt_kahypar_report_callback_t)(const char* json_report, void* user_data);
+
+/**
+ * Phases of a partitioning call reported to the progress callback.
+ */
+typedef enum {
+  PROGRESS_COARSENING,
+  PROGRESS_INITIAL_PARTITIONING,
+  PROGRESS_REFINEMENT,
+  PROGRESS_VCYCLE
+} mt_kahypar_progress_phase_t;
+
+/**
+ * Progress of a partitioning call.
+ */
+typedef struct {
+  mt_kahypar_progress_phase_t phase;
+  // coarsening and refinement: number of finished levels (or batches for the n-level presets),
+  // V-cycles: number of the V-cycle that starts
+  size_t level;
+  // number of nodes of the current (coarse) hypergraph
+  mt_kahypar_hypernode_id_t num_nodes;
+  // objective of the current partition (0 during coarsening)
+  mt_kahypar_hyperedge_weight_t objective;
+  // elapsed wall-clock time since the start of the partitioning call
+  double elapsed_seconds;
+} mt_kahypar_progress_t;
+
+/**
+ * Receives the progress of a partitioning call after each level of the multilevel hierarchy.
+ */
+typedef void (*mt_kahypar_progress_callback_t)(const mt_kahypar_progress_t* progress, void* user_data);
+
+/**
+ * Polled at safe points of a partitioning call. If it returns true, the call is cancelled
+ * as fast as possible and fails with status CANCELLED. Might be called concurrently by several threads.
+ */
+typedef bool (*mt_kahypar_cancel_callback_t)(void* user_data);
+
+/**
+ * Releases a buffer whose ownership was transferred to the library.
+ */
+typedef void (*mt_kahypar_free_callback_t)(void* buffer, void* user_data);
+
 /**
  * Configurable parameters of the partitioning context.
  */
@@ -98,7 +172,35 @@ typedef enum {
   // number of V-cycles (integer)
   NUM_VCYCLES,
   // enables logging (bool: 1/0)
-  VERBOSE
+  VERBOSE,
+  // wall-clock time limit in seconds for a partitioning call, 0 = no limit (float)
+  TIME_LIMIT,
+  // memory budget in MB for a partitioning call, 0 = no limit (integer)
+  MEMORY_BUDGET,
+  // maximum number of threads used by a partitioning call, 0 = all threads of the calling task arena (integer)
+  MAX_THREADS,
+  // if set, partitioning calls do not modify the input hypergraph, which can then be partitioned
+  // by several concurrent calls without copying it (bool: 1/0, only for hypergraphs)
+  SHARED_INPUT,
+  // computes the partition with recursive bisection of the blocks (deep multilevel mode, if the
+  // preset uses direct k-way partitioning), such that nested partitions can be extracted with
+  // mt_kahypar_get_nested_partition(...) (bool: 1/0)
+  NESTED_PARTITIONS,
+  // removes duplicated pins and single-pin hyperedges and merges identical hyperedges while
+  // constructing a hypergraph (bool: 1/0, only for the static hypergraph of the default presets)
+  SANITIZE_DURING_CONSTRUCTION,
+  // V-cycles terminate early if a cycle improves the objective relatively by less than
+  // this threshold, 0 = always run all V-cycles (float)
+  VCYCLE_MIN_RELATIVE_IMPROVEMENT,
+  // if > 1, V-cycles first only coarsen down to this factor times the contraction limit,
+  // 1 = only full V-cycles (float)
+  VCYCLE_TRUNCATED_CONTRACTION_LIMIT_FACTOR,
+  // writes the precomputed steiner trees of target graphs read from a file next to the
+  // file, such that later processes memory-map them instead of recomputing them (bool: 1/0)
+  WRITE_STEINER_TREE_TABLES,
+  // partitions hypergraphs that only contain nets with two pins with the graph data structures,
+  // which are faster and need less memory (bool: 1/0, default: 1, only for hypergraphs)
+  PARTITION_TWO_PIN_HYPERGRAPHS_AS_GRAPHS
 } mt_kahypar_context_parameter_type_t;
 
 /**
@@ -133,7 +235,13 @@ typedef enum {
   // Standard file format for graphs
   METIS,
   // Standard file format for hypergraphs
-  HMETIS
+  HMETIS,
+  // Binary snapshot of a graph or hypergraph (can be loaded without parsing)
+  BINARY,
+  // SNAP edge list (read as graph)
+  SNAP,
+  // Matrix Market file in coordinate format (read as graph)
+  MATRIX_MARKET
 } mt_kahypar_file_format_type_t;
 
 #ifndef MT_KAHYPAR_API
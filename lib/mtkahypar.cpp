@@ -26,7 +26,12 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <string>
+#include <exception>
+#include <shared_mutex>
 #include <type_traits>
 #include <charconv>
 #include <boost/lexical_cast.hpp>
@@ -43,6 +48,8 @@
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/parallel/background_reclamation.h"
+#include "mt-kahypar/parallel/huge_pages.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
@@ -82,11 +89,26 @@ namespace {
       case PresetType::default_preset: return DEFAULT;
       case PresetType::quality: return QUALITY;
       case PresetType::highest_quality: return HIGHEST_QUALITY;
+      case PresetType::automatic:
       case PresetType::UNDEFINED: return static_cast<mt_kahypar_preset_type_t>(0);
     }
     return static_cast<mt_kahypar_preset_type_t>(0);
   }
 
+  // ! The C interface always uses 64-bit IDs, while the library might be built with 32-bit IDs
+  void check_id_range(const mt_kahypar_hypernode_id_t num_vertices,
+                      const mt_kahypar_hyperedge_id_t num_edges,
+                      const size_t num_pins) {
+    if ( num_vertices > std::numeric_limits<HypernodeID>::max() ||
+         num_edges > std::numeric_limits<HyperedgeID>::max() ||
+         num_pins > std::numeric_limits<HyperedgeID>::max() ) {
+      throw InvalidInputException(
+        "The number of vertices, edges or pins exceeds the range of the " +
+        std::to_string(8 * sizeof(HypernodeID)) + "-bit IDs of this library "
+        "(build with KAHYPAR_USE_64_BIT_IDS=ON for larger instances).");
+    }
+  }
+
   mt_kahypar_error_t to_error(mt_kahypar_status_t status, const char* msg) {
     mt_kahypar_error_t result;
     result.status = status;
@@ -109,9 +131,15 @@ namespace {
       return to_error(mt_kahypar_status_t::UNSUPPORTED_OPERATION, ex.what());
     } else if (dynamic_cast<const SystemException*>(&ex) != nullptr) {
       return to_error(mt_kahypar_status_t::SYSTEM_ERROR, ex.what());
+    } else if (dynamic_cast<const CancellationException*>(&ex) != nullptr) {
+      return to_error(mt_kahypar_status_t::CANCELLED, ex.what());
     }
     return to_error(mt_kahypar_status_t::OTHER_ERROR, ex.what());
   }
+
+  mt_kahypar_metrics_t to_c_metrics(const PartitionMetrics& metrics) {
+    return mt_kahypar_metrics_t { metrics.cut, metrics.km1, metrics.soed, metrics.steiner_tree, metrics.imbalance };
+  }
 }
 
 
@@ -161,6 +189,13 @@ mt_kahypar_status_t mt_kahypar_set_context_parameter(mt_kahypar_context_t* conte
     case NUM_BLOCKS: return parse_number(c.partition.k, "positive integer");
     case EPSILON: return parse_number(c.partition.epsilon, "floating point number");
     case NUM_VCYCLES: return parse_number(c.partition.num_vcycles, "positive integer");
+    case VCYCLE_MIN_RELATIVE_IMPROVEMENT:
+      return parse_number(c.partition.vcycle_min_relative_improvement, "floating point number");
+    case VCYCLE_TRUNCATED_CONTRACTION_LIMIT_FACTOR:
+      return parse_number(c.partition.vcycle_truncated_contraction_limit_factor, "floating point number");
+    case TIME_LIMIT: return parse_number(c.partition.time_limit, "floating point number");
+    case MEMORY_BUDGET: return parse_number(c.partition.memory_budget, "positive integer");
+    case MAX_THREADS: return parse_number(c.shared_memory.thread_limit, "positive integer");
     case OBJECTIVE: {
       std::string objective(value);
       if ( objective == "km1" ) {
@@ -184,6 +219,46 @@ mt_kahypar_status_t mt_kahypar_set_context_parameter(mt_kahypar_context_t* conte
         report_conversion_error("boolean");
         return mt_kahypar_status_t::INVALID_PARAMETER;
       }
+    case SHARED_INPUT:
+      try {
+        c.partition.shared_input = boost::lexical_cast<bool>(value);
+        return mt_kahypar_status_t::SUCCESS;
+      } catch ( boost::bad_lexical_cast& ) {
+        report_conversion_error("boolean");
+        return mt_kahypar_status_t::INVALID_PARAMETER;
+      }
+    case NESTED_PARTITIONS:
+      try {
+        c.partition.nested_partitions = boost::lexical_cast<bool>(value);
+        return mt_kahypar_status_t::SUCCESS;
+      } catch ( boost::bad_lexical_cast& ) {
+        report_conversion_error("boolean");
+        return mt_kahypar_status_t::INVALID_PARAMETER;
+      }
+    case SANITIZE_DURING_CONSTRUCTION:
+      try {
+        c.preprocessing.sanitize_during_construction = boost::lexical_cast<bool>(value);
+        return mt_kahypar_status_t::SUCCESS;
+      } catch ( boost::bad_lexical_cast& ) {
+        report_conversion_error("boolean");
+        return mt_kahypar_status_t::INVALID_PARAMETER;
+      }
+    case WRITE_STEINER_TREE_TABLES:
+      try {
+        c.mapping.write_steiner_tree_tables = boost::lexical_cast<bool>(value);
+        return mt_kahypar_status_t::SUCCESS;
+      } catch ( boost::bad_lexical_cast& ) {
+        report_conversion_error("boolean");
+        return mt_kahypar_status_t::INVALID_PARAMETER;
+      }
+    case PARTITION_TWO_PIN_HYPERGRAPHS_AS_GRAPHS:
+      try {
+        c.partition.partition_two_pin_hypergraphs_as_graphs = boost::lexical_cast<bool>(value);
+        return mt_kahypar_status_t::SUCCESS;
+      } catch ( boost::bad_lexical_cast& ) {
+        report_conversion_error("boolean");
+        return mt_kahypar_status_t::INVALID_PARAMETER;
+      }
   }
   *error = to_error(mt_kahypar_status_t::INVALID_PARAMETER,
                     "Type must be a valid value of mt_kahypar_context_parameter_type_t");
@@ -239,16 +314,99 @@ void mt_kahypar_set_seed(const size_t seed) {
   utils::Randomize::instance().setSeed(seed);
 }
 
+bool mt_kahypar_uses_64_bit_ids() {
+  return sizeof(HypernodeID) == 8;
+}
+
+void mt_kahypar_set_huge_page_allocation(const bool enable) {
+  if ( enable ) {
+    parallel::HugePages::instance().activate();
+  } else {
+    parallel::HugePages::instance().deactivate();
+  }
+}
+
+void mt_kahypar_set_asynchronous_deallocation(const bool enable) {
+  if ( enable ) {
+    parallel::BackgroundReclamation::instance().activate();
+  } else {
+    parallel::BackgroundReclamation::instance().deactivate();
+  }
+}
+
 void mt_kahypar_set_individual_target_block_weights(mt_kahypar_context_t* context,
                                                     const mt_kahypar_partition_id_t num_blocks,
                                                     const mt_kahypar_hypernode_weight_t* block_weights) {
   lib::set_individual_block_weights(reinterpret_cast<Context&>(*context), num_blocks, block_weights);
 }
 
+void mt_kahypar_set_report_callback(mt_kahypar_context_t* context,
+                                    mt_kahypar_report_callback_t callback,
+                                    void* user_data) {
+  Context& c = *reinterpret_cast<Context*>(context);
+  c.partition.report_callback = callback;
+  c.partition.report_callback_data = user_data;
+}
+
+void mt_kahypar_set_progress_callback(mt_kahypar_context_t* context,
+                                      mt_kahypar_progress_callback_t callback,
+                                      void* user_data) {
+  Context& c = *reinterpret_cast<Context*>(context);
+  c.partition.progress_callback = callback;
+  c.partition.progress_callback_data = user_data;
+}
+
+void mt_kahypar_set_cancel_callback(mt_kahypar_context_t* context,
+                                    mt_kahypar_cancel_callback_t callback,
+                                    void* user_data) {
+  Context& c = *reinterpret_cast<Context*>(context);
+  c.partition.cancel_callback = callback;
+  c.partition.cancel_callback_data = user_data;
+}
+
 void mt_kahypar_initialize(const size_t num_threads, const bool interleaved_allocations) {
   lib::initialize(num_threads, interleaved_allocations, false);
 }
 
+void mt_kahypar_initialize_embedded(const size_t max_num_threads) {
+  lib::initialize(max_num_threads, false, false, false);
+}
+
+mt_kahypar_status_t mt_kahypar_set_hardware_topology(const char* xml,
+                                                     mt_kahypar_error_t* error) {
+  try {
+    #ifndef KAHYPAR_DISABLE_HWLOC
+    if ( !parallel::HwlocTopology::set_xml(xml) ) {
+      throw InvalidInputException(
+        "Invalid hardware topology or topology was already loaded");
+    }
+    #else
+    unused(xml);
+    throw UnsupportedOperationException("Mt-KaHyPar was built without hwloc");
+    #endif
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+size_t mt_kahypar_export_hardware_topology(char* buffer, const size_t buffer_size) {
+  #ifndef KAHYPAR_DISABLE_HWLOC
+  const std::string xml = HardwareTopology::instance().export_topology();
+  if ( buffer != nullptr && buffer_size > 0 ) {
+    const size_t length = std::min(xml.size(), buffer_size - 1);
+    std::memcpy(buffer, xml.data(), length);
+    buffer[length] = '\0';
+  }
+  return xml.size() + 1;
+  #else
+  unused(buffer);
+  unused(buffer_size);
+  return 0;
+  #endif
+}
+
 void mt_kahypar_free_error_content(mt_kahypar_error_t* error) {
   free(const_cast<char*>(error->msg));
   error->status = mt_kahypar_status_t::SUCCESS;
@@ -261,9 +419,12 @@ mt_kahypar_hypergraph_t mt_kahypar_read_hypergraph_from_file(const char* file_na
                                                              const mt_kahypar_file_format_type_t file_format,
                                                              mt_kahypar_error_t* error) {
   const Context& c = *reinterpret_cast<const Context*>(context);
-  const InstanceType instance = file_format == HMETIS ? InstanceType::hypergraph : InstanceType::graph;
-  const FileFormat format = file_format == HMETIS ? FileFormat::hMetis : FileFormat::Metis;
+  const FileFormat format = file_format == HMETIS ? FileFormat::hMetis :
+                            file_format == BINARY ? FileFormat::binary :
+                            file_format == SNAP ? FileFormat::SNAP :
+                            file_format == MATRIX_MARKET ? FileFormat::MatrixMarket : FileFormat::Metis;
   try {
+    const InstanceType instance = io::instanceTypeOfInputFile(file_name, format);
     return lib::hypergraph_from_file(file_name, c, instance, format);
   } catch ( std::exception& ex ) {
     *error = to_error(ex);
@@ -274,11 +435,14 @@ mt_kahypar_hypergraph_t mt_kahypar_read_hypergraph_from_file(const char* file_na
 mt_kahypar_target_graph_t* mt_kahypar_read_target_graph_from_file(const char* file_name,
                                                                   const mt_kahypar_context_t* context,
                                                                   mt_kahypar_error_t* error) {
-  unused(context);
+  const bool write_tables = context != nullptr &&
+    reinterpret_cast<const Context*>(context)->mapping.write_steiner_tree_tables;
   TargetGraph* target_graph = nullptr;
   try {
+    std::shared_lock<std::shared_timed_mutex> lock(lib::memory_pool_mutex());
     ds::StaticGraph graph = io::readInputFile<ds::StaticGraph>(file_name, FileFormat::Metis, true);
     target_graph = new TargetGraph(std::move(graph));
+    target_graph->setPrecomputedTablesFile(file_name, write_tables);
   } catch ( std::exception& ex ) {
     *error = to_error(ex);
   }
@@ -294,6 +458,13 @@ mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kahypar_context_t*
                                                      const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
                                                      const mt_kahypar_hypernode_weight_t* vertex_weights,
                                                      mt_kahypar_error_t* error) {
+  try {
+    check_id_range(num_vertices, num_hyperedges, hyperedge_indices[num_hyperedges]);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
   // Transform adjacence array into adjacency list
   vec<vec<HypernodeID>> edge_vector(num_hyperedges);
   tbb::parallel_for<HyperedgeID>(0, num_hyperedges, [&](const mt_kahypar::HyperedgeID& he) {
@@ -313,6 +484,37 @@ mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kahypar_context_t*
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
 
+mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph_from_owned_buffers(const mt_kahypar_context_t* context,
+                                                                        const mt_kahypar_hypernode_id_t num_vertices,
+                                                                        const mt_kahypar_hyperedge_id_t num_hyperedges,
+                                                                        size_t* hyperedge_indices,
+                                                                        mt_kahypar_hyperedge_id_t* hyperedges,
+                                                                        const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                                        const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                                        mt_kahypar_free_callback_t free_callback,
+                                                                        void* user_data,
+                                                                        mt_kahypar_error_t* error) {
+  try {
+    check_id_range(num_vertices, num_hyperedges, hyperedge_indices[num_hyperedges]);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    if ( free_callback ) {
+      free_callback(hyperedge_indices, user_data);
+      free_callback(hyperedges, user_data);
+    }
+    return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
+  const Context& c = *reinterpret_cast<const Context*>(context);
+  try {
+    return lib::create_hypergraph_from_owned_buffers(c, num_vertices, num_hyperedges, hyperedge_indices,
+      hyperedges, hyperedge_weights, vertex_weights, free_callback, user_data);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
 mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_context_t* context,
                                                 const mt_kahypar_hypernode_id_t num_vertices,
                                                 const mt_kahypar_hyperedge_id_t num_edges,
@@ -320,6 +522,14 @@ mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_context_t* cont
                                                 const mt_kahypar_hyperedge_weight_t* edge_weights,
                                                 const mt_kahypar_hypernode_weight_t* vertex_weights,
                                                 mt_kahypar_error_t* error) {
+  try {
+    // Each edge is stored in both directions
+    check_id_range(num_vertices, 2 * num_edges, 2 * num_edges);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
   // Transform adjacence array into adjacence list
   vec<std::pair<mt_kahypar::HypernodeID, mt_kahypar::HypernodeID>> edge_vector(num_edges);
   tbb::parallel_for<mt_kahypar::HyperedgeID>(0, num_edges, [&](const mt_kahypar::HyperedgeID& he) {
@@ -335,6 +545,23 @@ mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_context_t* cont
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
 
+mt_kahypar_hypergraph_t mt_kahypar_create_graph_from_csr(const mt_kahypar_context_t* context,
+                                                         const mt_kahypar_hypernode_id_t num_vertices,
+                                                         const size_t* xadj,
+                                                         const mt_kahypar_hypernode_id_t* adjncy,
+                                                         const mt_kahypar_hyperedge_weight_t* edge_weights,
+                                                         const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                         mt_kahypar_error_t* error) {
+  const Context& c = *reinterpret_cast<const Context*>(context);
+  try {
+    check_id_range(num_vertices, xadj[num_vertices], xadj[num_vertices]);
+    return lib::create_graph_from_csr(c, num_vertices, xadj, adjncy, edge_weights, vertex_weights);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
 mt_kahypar_target_graph_t* mt_kahypar_create_target_graph(const mt_kahypar_context_t* context,
                                                           const mt_kahypar_hypernode_id_t num_vertices,
                                                           const mt_kahypar_hyperedge_id_t num_edges,
@@ -350,6 +577,7 @@ mt_kahypar_target_graph_t* mt_kahypar_create_target_graph(const mt_kahypar_conte
 
   TargetGraph* target_graph = nullptr;
   try {
+    std::shared_lock<std::shared_timed_mutex> lock(lib::memory_pool_mutex());
     ds::StaticGraph graph = StaticGraphFactory::construct_from_graph_edges(
       num_vertices, num_edges, edge_vector, edge_weights, nullptr, true);
     target_graph = new TargetGraph(std::move(graph));
@@ -359,9 +587,24 @@ mt_kahypar_target_graph_t* mt_kahypar_create_target_graph(const mt_kahypar_conte
   return reinterpret_cast<mt_kahypar_target_graph_t*>(target_graph);
 }
 
+mt_kahypar_status_t mt_kahypar_precompute_target_graph(mt_kahypar_target_graph_t* target_graph,
+                                                       const mt_kahypar_context_t* context,
+                                                       mt_kahypar_error_t* error) {
+  try {
+    lib::precompute_target_graph(reinterpret_cast<TargetGraph&>(*target_graph),
+                                 reinterpret_cast<const Context&>(*context));
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
 
 void mt_kahypar_free_hypergraph(mt_kahypar_hypergraph_t hypergraph) {
-  utils::delete_hypergraph(hypergraph);
+  parallel::BackgroundReclamation::instance().defer([hypergraph] {
+    utils::delete_hypergraph(hypergraph);
+  });
 }
 
 void mt_kahypar_free_target_graph(mt_kahypar_target_graph_t* target_graph) {
@@ -371,7 +614,9 @@ void mt_kahypar_free_target_graph(mt_kahypar_target_graph_t* target_graph) {
 }
 
 void mt_kahypar_free_partitioned_hypergraph(mt_kahypar_partitioned_hypergraph_t partitioned_hg) {
-  utils::delete_partitioned_hypergraph(partitioned_hg);
+  parallel::BackgroundReclamation::instance().defer([partitioned_hg] {
+    utils::delete_partitioned_hypergraph(partitioned_hg);
+  });
 }
 
 mt_kahypar_hypernode_id_t mt_kahypar_num_hypernodes(mt_kahypar_hypergraph_t hypergraph) {
@@ -529,6 +774,170 @@ mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hypergraph_t hyper
   return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
 }
 
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_repartition(mt_kahypar_hypergraph_t hypergraph,
+                                                           const mt_kahypar_context_t* context,
+                                                           const mt_kahypar_partition_id_t* previous_partition,
+                                                           const mt_kahypar_hypernode_id_t* touched_nodes,
+                                                           const size_t num_touched_nodes,
+                                                           mt_kahypar_error_t* error) {
+  try {
+    return lib::repartition(hypergraph, reinterpret_cast<const Context&>(*context),
+                            previous_partition, touched_nodes, num_touched_nodes);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+}
+
+mt_kahypar_status_t mt_kahypar_partition_batch(const mt_kahypar_hypergraph_t* hypergraphs,
+                                               const mt_kahypar_context_t* const* contexts,
+                                               const size_t num_instances,
+                                               mt_kahypar_partitioned_hypergraph_t* partitioned_hgs,
+                                               mt_kahypar_error_t* error) {
+  try {
+    std::exception_ptr ex = lib::partition_batch(hypergraphs,
+      reinterpret_cast<const Context* const*>(contexts), num_instances, partitioned_hgs);
+    if ( ex ) {
+      std::rethrow_exception(ex);
+    }
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_session_t* mt_kahypar_create_session(const mt_kahypar_context_t* context) {
+  return reinterpret_cast<mt_kahypar_session_t*>(
+    new lib::PartitioningSession(reinterpret_cast<const Context&>(*context)));
+}
+
+void mt_kahypar_free_session(mt_kahypar_session_t* session) {
+  if ( session ) {
+    delete reinterpret_cast<lib::PartitioningSession*>(session);
+  }
+}
+
+mt_kahypar_status_t mt_kahypar_session_partition(mt_kahypar_session_t* session,
+                                                 mt_kahypar_hypergraph_t hypergraph,
+                                                 mt_kahypar_partition_id_t* partition,
+                                                 mt_kahypar_error_t* error) {
+  try {
+    reinterpret_cast<lib::PartitioningSession*>(session)->partition(hypergraph, partition);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_streaming_partitioner_t* mt_kahypar_create_streaming_partitioner(const mt_kahypar_context_t* context,
+                                                                           const mt_kahypar_hypernode_id_t num_nodes,
+                                                                           const mt_kahypar_hypernode_weight_t total_weight,
+                                                                           const mt_kahypar_hypernode_id_t buffer_size,
+                                                                           mt_kahypar_error_t* error) {
+  try {
+    return reinterpret_cast<mt_kahypar_streaming_partitioner_t*>(new lib::StreamingPartitioner(
+      reinterpret_cast<const Context&>(*context), num_nodes, total_weight, buffer_size));
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return nullptr;
+}
+
+void mt_kahypar_free_streaming_partitioner(mt_kahypar_streaming_partitioner_t* streaming_partitioner) {
+  if ( streaming_partitioner ) {
+    delete reinterpret_cast<lib::StreamingPartitioner*>(streaming_partitioner);
+  }
+}
+
+mt_kahypar_status_t mt_kahypar_stream_node(mt_kahypar_streaming_partitioner_t* streaming_partitioner,
+                                           const mt_kahypar_hypernode_weight_t weight,
+                                           const mt_kahypar_hypernode_id_t* neighbors,
+                                           const mt_kahypar_hyperedge_weight_t* edge_weights,
+                                           const size_t num_neighbors,
+                                           mt_kahypar_error_t* error) {
+  try {
+    reinterpret_cast<lib::StreamingPartitioner*>(streaming_partitioner)->addNode(
+      weight, neighbors, edge_weights, num_neighbors);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_status_t mt_kahypar_flush_stream(mt_kahypar_streaming_partitioner_t* streaming_partitioner,
+                                            mt_kahypar_error_t* error) {
+  try {
+    reinterpret_cast<lib::StreamingPartitioner*>(streaming_partitioner)->flush();
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+void mt_kahypar_get_stream_partition(const mt_kahypar_streaming_partitioner_t* streaming_partitioner,
+                                     mt_kahypar_partition_id_t* partition) {
+  const vec<PartitionID>& stream_partition =
+    reinterpret_cast<const lib::StreamingPartitioner*>(streaming_partitioner)->partition();
+  std::copy(stream_partition.begin(), stream_partition.end(), partition);
+}
+
+mt_kahypar_hierarchy_t mt_kahypar_create_hierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                                   const mt_kahypar_context_t* context,
+                                                   mt_kahypar_error_t* error) {
+  try {
+    return lib::create_hierarchy(hypergraph, reinterpret_cast<const Context&>(*context));
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_hierarchy_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
+mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition_with_hierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                                                        const mt_kahypar_hierarchy_t hierarchy,
+                                                                        const mt_kahypar_context_t* context,
+                                                                        mt_kahypar_error_t* error) {
+  try {
+    return lib::partition_with_hierarchy(hypergraph, hierarchy, reinterpret_cast<const Context&>(*context));
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+}
+
+mt_kahypar_status_t mt_kahypar_write_hierarchy_to_file(const mt_kahypar_hierarchy_t hierarchy,
+                                                       const char* file_name,
+                                                       mt_kahypar_error_t* error) {
+  try {
+    PartitionerFacade::writeHierarchy(hierarchy, file_name);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_hierarchy_t mt_kahypar_read_hierarchy_from_file(mt_kahypar_hypergraph_t hypergraph,
+                                                           const mt_kahypar_context_t* context,
+                                                           const char* file_name,
+                                                           mt_kahypar_error_t* error) {
+  try {
+    return lib::read_hierarchy(hypergraph, reinterpret_cast<const Context&>(*context), file_name);
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+  }
+  return mt_kahypar_hierarchy_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
+void mt_kahypar_free_hierarchy(mt_kahypar_hierarchy_t hierarchy) {
+  parallel::BackgroundReclamation::instance().defer([hierarchy] {
+    utils::delete_hierarchy(hierarchy);
+  });
+}
+
 MT_KAHYPAR_API bool mt_kahypar_check_partition_compatibility(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                              mt_kahypar_preset_type_t preset) {
   return lib::is_compatible(partitioned_hg, preset);
@@ -547,6 +956,22 @@ mt_kahypar_status_t mt_kahypar_improve_partition(mt_kahypar_partitioned_hypergra
   }
 }
 
+mt_kahypar_status_t mt_kahypar_improve_partition_in_region(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                           const mt_kahypar_context_t* context,
+                                                           const mt_kahypar_hypernode_id_t* region_nodes,
+                                                           const size_t num_region_nodes,
+                                                           const mt_kahypar_hypernode_id_t radius,
+                                                           mt_kahypar_error_t* error) {
+  try {
+    lib::improve_region(partitioned_hg, reinterpret_cast<const Context&>(*context),
+                        region_nodes, num_region_nodes, radius);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
 mt_kahypar_status_t mt_kahypar_improve_mapping(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                mt_kahypar_target_graph_t* target_graph,
                                                const mt_kahypar_context_t* context,
@@ -641,6 +1066,28 @@ void mt_kahypar_get_partition(const mt_kahypar_partitioned_hypergraph_t partitio
   lib::get_partition<false>(partitioned_hg, partition);
 }
 
+mt_kahypar_status_t mt_kahypar_get_nested_partition(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                    const mt_kahypar_partition_id_t num_blocks,
+                                                    mt_kahypar_partition_id_t* partition,
+                                                    mt_kahypar_error_t* error) {
+  try {
+    lib::get_nested_partition<true>(partitioned_hg, num_blocks, partition);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+void mt_kahypar_get_block_ordering(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                   mt_kahypar_hypernode_id_t* permutation,
+                                   mt_kahypar_hypernode_id_t* block_offsets,
+                                   mt_kahypar_hypernode_id_t* halo_offsets,
+                                   mt_kahypar_hyperedge_id_t* cut_nets,
+                                   mt_kahypar_hyperedge_id_t* num_cut_nets) {
+  lib::get_block_ordering<false>(partitioned_hg, permutation, block_offsets, halo_offsets, cut_nets, num_cut_nets);
+}
+
 void mt_kahypar_get_block_weights(const mt_kahypar_partitioned_hypergraph_t partitioned_hg, mt_kahypar_hypernode_weight_t* block_weights) {
   lib::get_block_weights<false>(partitioned_hg, block_weights);
 }
@@ -661,12 +1108,47 @@ mt_kahypar_hyperedge_weight_t mt_kahypar_soed(const mt_kahypar_partitioned_hyper
   return lib::soed<false>(partitioned_hg);
 }
 
+mt_kahypar_status_t mt_kahypar_compute_metrics(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                               const mt_kahypar_context_t* context,
+                                               mt_kahypar_metrics_t* metrics,
+                                               mt_kahypar_error_t* error) {
+  try {
+    *metrics = to_c_metrics(lib::compute_metrics<true>(
+      partitioned_hg, *reinterpret_cast<const Context*>(context)));
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
+mt_kahypar_status_t mt_kahypar_apply_moves(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                           const mt_kahypar_context_t* context,
+                                           const size_t num_moves,
+                                           const mt_kahypar_hypernode_id_t* nodes,
+                                           const mt_kahypar_partition_id_t* blocks,
+                                           mt_kahypar_metrics_t* metrics,
+                                           mt_kahypar_error_t* error) {
+  try {
+    PartitionMetrics partition_metrics;
+    partition_metrics.cut = metrics->cut;
+    partition_metrics.km1 = metrics->km1;
+    partition_metrics.soed = metrics->soed;
+    partition_metrics.steiner_tree = metrics->steiner_tree;
+    lib::apply_moves<true>(partitioned_hg, *reinterpret_cast<const Context*>(context),
+      num_moves, nodes, blocks, partition_metrics);
+    *metrics = to_c_metrics(partition_metrics);
+    return mt_kahypar_status_t::SUCCESS;
+  } catch ( std::exception& ex ) {
+    *error = to_error(ex);
+    return error->status;
+  }
+}
+
 mt_kahypar_hyperedge_weight_t mt_kahypar_steiner_tree(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                       mt_kahypar_target_graph_t* target_graph) {
   TargetGraph* target = reinterpret_cast<TargetGraph*>(target_graph);
-  if ( !target->isInitialized() ) {
-    target->precomputeDistances(4);
-  }
+  target->initialize(4);
   return lib::switch_phg<mt_kahypar_hyperedge_weight_t, false>(partitioned_hg, [&](auto& phg) {
     phg.setTargetGraph(target);
     return metrics::quality(phg, Objective::steiner_tree);
@@ -25,33 +25,59 @@
  * SOFTWARE.
  ******************************************************************************/
 
+
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/command_line_options.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/instance_cache.h"
+#include "mt-kahypar/io/json_output.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/parallel/background_reclamation.h"
+#include "mt-kahypar/parallel/huge_pages.h"
 #include "mt-kahypar/partition/partitioner_facade.h"
+#include "mt-kahypar/partition/preset_selection.h"
 #include "mt-kahypar/partition/registries/register_memory_pool.h"
 #include "mt-kahypar/partition/registries/registry.h"
 #include "mt-kahypar/partition/conversion.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/memory_sampler.h"
 #include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/utils/exception.h"
 
 using namespace mt_kahypar;
 
-int main(int argc, char* argv[]) {
+namespace {
 
-  Context context(false);
+// ! Determines the instance type (graph or hypergraph) and the partition type
+void setInstanceAndPartitionType(Context& context) {
+  if ( context.partition.instance_type == InstanceType::UNDEFINED ) {
+    context.partition.instance_type = io::instanceTypeOfInputFile(
+      context.partition.graph_filename, context.partition.file_format);
+  }
+  if ( context.partition.preset_type != PresetType::automatic ) {
+    context.partition.partition_type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type);
+  }
+}
+
+void parseContext(Context& context, int argc, char* argv[]) {
   processCommandLineInput(context, argc, argv, nullptr);
 
   if ( context.partition.preset_file == "" ) {
-    if ( context.partition.preset_type != PresetType::UNDEFINED ) {
+    if ( context.partition.preset_type == PresetType::automatic ) {
+      // The preset is selected after reading the input (see readHypergraphAndSelectPreset(...))
+    } else if ( context.partition.preset_type != PresetType::UNDEFINED ) {
       // Only a preset type specified => load according preset
       auto preset_option_list = loadPreset(context.partition.preset_type);
       processCommandLineInput(context, argc, argv, &preset_option_list);
@@ -59,27 +85,48 @@ int main(int argc, char* argv[]) {
       throw InvalidInputException("No preset specified");
     }
   }
+  setInstanceAndPartitionType(context);
+}
 
-  // Determine instance (graph or hypergraph) and partition type
-  if ( context.partition.instance_type == InstanceType::UNDEFINED ) {
-    context.partition.instance_type = to_instance_type(context.partition.file_format);
-  }
-  context.partition.partition_type = to_partition_c_type(
-    context.partition.preset_type, context.partition.instance_type);
-
-
-  context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
-  if (context.partition.verbose_output) {
-    io::printBanner();
-  }
-
+void setupRandomization(const Context& context) {
   utils::Randomize::instance().setSeed(context.partition.seed);
   if ( context.shared_memory.use_localized_random_shuffle ) {
     utils::Randomize::instance().enableLocalizedParallelShuffle(
       context.shared_memory.shuffle_block_size);
   }
+}
 
+// ! Records the spans of the parallel tasks if a trace output file is requested
+// ! and samples the memory consumption if a sampling interval is given
+void setupTracing(const Context& context) {
+  utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+  if ( !context.partition.trace_output_file.empty() ) {
+    timer.enableTracing();
+  } else {
+    timer.disableTracing();
+  }
+  if ( context.partition.memory_sampling_interval > 0 ) {
+    utils::MemorySampler::instance().start(context.partition.memory_sampling_interval);
+  } else {
+    utils::MemorySampler::instance().stop();
+  }
+}
+
+// ! Initializes the thread pool and the memory policies of the process
+void initializeThreadsAndMemory(Context& context) {
   #ifndef KAHYPAR_DISABLE_HWLOC
+    if ( context.shared_memory.hwloc_topology_file != "" ) {
+      std::ifstream file(context.shared_memory.hwloc_topology_file);
+      if ( !file ) {
+        throw InvalidInputException(
+          "Could not open hwloc topology file: " + context.shared_memory.hwloc_topology_file);
+      }
+      const std::string xml((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      if ( !parallel::HwlocTopology::set_xml(xml) ) {
+        throw InvalidInputException(
+          "Invalid hwloc topology file: " + context.shared_memory.hwloc_topology_file);
+      }
+    }
     size_t num_available_cpus = HardwareTopology::instance().num_cpus();
     if ( num_available_cpus < context.shared_memory.num_threads ) {
       WARNING("There are currently only" << num_available_cpus << "cpus available."
@@ -93,54 +140,131 @@ int main(int argc, char* argv[]) {
   TBBInitializer::instance(context.shared_memory.num_threads);
 
   #ifndef KAHYPAR_DISABLE_HWLOC
-    // We set the membind policy to interleaved allocations in order to
-    // distribute allocations evenly across NUMA nodes
     hwloc_cpuset_t cpuset = TBBInitializer::instance().used_cpuset();
-    parallel::HardwareTopology<>::instance().activate_interleaved_membind_policy(cpuset);
+    if ( context.shared_memory.use_numa_aware_placement ) {
+      // Pages are placed on the NUMA node of the thread that touches them first.
+      // Large arrays are initialized with a static assignment of index ranges to
+      // threads (see parallel/numa_placement.h).
+      parallel::HardwareTopology<>::instance().activate_first_touch_membind_policy(cpuset);
+    } else {
+      // We set the membind policy to interleaved allocations in order to
+      // distribute allocations evenly across NUMA nodes
+      parallel::HardwareTopology<>::instance().activate_interleaved_membind_policy(cpuset);
+    }
     hwloc_bitmap_free(cpuset);
   #endif
 
-  // Read Hypergraph
+  if ( context.shared_memory.use_huge_pages ) {
+    // Must be activated before the hypergraph is read
+    parallel::HugePages::instance().activate();
+  }
+
+  if ( context.shared_memory.use_background_reclamation ) {
+    parallel::BackgroundReclamation::instance().activate();
+  }
+}
+
+mt_kahypar_hypergraph_t readHypergraph(const Context& context) {
   utils::Timer& timer =
     utils::Utilities::instance().getTimer(context.utility_id);
   timer.start_timer("io_hypergraph", "I/O Hypergraph");
   mt_kahypar_hypergraph_t hypergraph = io::readInputFile(
       context.partition.graph_filename, context.partition.preset_type,
       context.partition.instance_type, context.partition.file_format,
-      context.preprocessing.stable_construction_of_incident_edges);
+      context.preprocessing.stable_construction_of_incident_edges, true,
+      context.preprocessing.sanitize_during_construction);
   timer.stop_timer("io_hypergraph");
+  return hypergraph;
+}
 
-  // Read Target Graph
+// ! Reads the input, selects the preset, mode and instance type based on cheap statistics
+// ! of the input (see preset_selection.h) and loads the selected preset. Options that are
+// ! explicitly set on the command line take precedence over the selection.
+mt_kahypar_hypergraph_t readHypergraphAndSelectPreset(Context& context, int argc, char* argv[]) {
+  Context cmd_context(false);
+  processCommandLineInput(cmd_context, argc, argv, nullptr);
+  const bool allow_instance_type_change =
+    cmd_context.partition.instance_type == InstanceType::UNDEFINED &&
+    context.partition.file_format == FileFormat::hMetis;
+
+  // The statistics are computed on the static representation of the input
+  context.partition.preset_type = PresetType::default_preset;
+  mt_kahypar_hypergraph_t hypergraph = readHypergraph(context);
+
+  utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+  timer.start_timer("preset_selection", "Preset Selection");
+  InstanceStatistics stats;
+  switch ( hypergraph.type ) {
+    case STATIC_HYPERGRAPH:
+      stats = preset_selection::computeStatistics(utils::cast_const<ds::StaticHypergraph>(hypergraph));
+      break;
+    ENABLE_GRAPHS(case STATIC_GRAPH:
+      stats = preset_selection::computeStatistics(utils::cast_const<ds::StaticGraph>(hypergraph));
+      break;)
+    default:
+      throw UnsupportedOperationException("Input is not a valid hypergraph.");
+  }
+  const PresetSelection selection = preset_selection::select(stats, context, allow_instance_type_change);
+  timer.stop_timer("preset_selection");
+
+  auto preset_option_list = loadPreset(selection.preset);
+  processCommandLineInput(context, argc, argv, &preset_option_list);
+  context.partition.preset_type = selection.preset;
+  context.partition.instance_type = selection.instance_type;
+  if ( cmd_context.partition.mode == Mode::UNDEFINED ) {
+    context.partition.mode = selection.mode;
+  }
+  context.partition.partition_type = to_partition_c_type(
+    context.partition.preset_type, context.partition.instance_type);
+
+  if ( context.partition.verbose_output ) {
+    LOG << "Automatic preset selection: preset =" << context.partition.preset_type
+        << ", mode =" << context.partition.mode
+        << ", instance type =" << context.partition.instance_type;
+    for ( const std::string& reason : selection.reasons ) {
+      LOG << "  -" << reason;
+    }
+  }
+
+  if ( to_hypergraph_c_type(context.partition.preset_type, context.partition.instance_type) != hypergraph.type ) {
+    // The selected preset uses a different (hyper)graph data structure
+    utils::delete_hypergraph(hypergraph);
+    hypergraph = readHypergraph(context);
+  }
+  return hypergraph;
+}
+
+std::unique_ptr<TargetGraph> readTargetGraph(const Context& context) {
   std::unique_ptr<TargetGraph> target_graph;
   if ( context.partition.objective == Objective::steiner_tree ) {
     if ( context.mapping.target_graph_file != "" ) {
       target_graph = std::make_unique<TargetGraph>(
         io::readInputFile<ds::StaticGraph>(
           context.mapping.target_graph_file, FileFormat::Metis, true));
+      target_graph->setPrecomputedTablesFile(
+        context.mapping.target_graph_file, context.mapping.write_steiner_tree_tables);
     } else {
       throw InvalidInputException("No target graph file specified (use -g <file> or --target-graph-file=<file>)!");
     }
   }
+  return target_graph;
+}
 
+void addFixedVertices(mt_kahypar_hypergraph_t hypergraph, const Context& context) {
   if ( context.partition.fixed_vertex_filename != "" ) {
+    utils::Timer& timer =
+      utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("read_fixed_vertices", "Read Fixed Vertex File");
     io::addFixedVerticesFromFile(hypergraph,
       context.partition.fixed_vertex_filename, context.partition.k);
     timer.stop_timer("read_fixed_vertices");
   }
+}
 
-  // Initialize Memory Pool and Algorithm/Policy Registries
-  register_memory_pool(hypergraph, context);
-  register_algorithms_and_policies();
-
-  // Partition Hypergraph
-  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-  mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph =
-    PartitionerFacade::partition(hypergraph, context, target_graph.get());
-  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
-
-  // Print Stats
-  std::chrono::duration<double> elapsed_seconds(end - start);
+// ! Prints the results and writes all requested output files
+void writeResults(const mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph,
+                  const Context& context,
+                  const std::chrono::duration<double>& elapsed_seconds) {
   PartitionerFacade::printPartitioningResults(
     partitioned_hypergraph, context, elapsed_seconds);
 
@@ -154,11 +278,275 @@ int main(int argc, char* argv[]) {
       partitioned_hypergraph, context, elapsed_seconds) << std::endl;
   }
 
+  if ( !context.partition.json_output_file.empty() ) {
+    std::ofstream out(context.partition.json_output_file);
+    if ( !out ) {
+      throw InvalidInputException("Could not open JSON output file: " + context.partition.json_output_file);
+    }
+    out << PartitionerFacade::serializeJSON(
+      partitioned_hypergraph, context, elapsed_seconds) << std::endl;
+  }
+
+  if ( !context.partition.trace_output_file.empty() ) {
+    std::ofstream out(context.partition.trace_output_file);
+    if ( !out ) {
+      throw InvalidInputException("Could not open trace output file: " + context.partition.trace_output_file);
+    }
+    out << io::json::serializeChromeTrace(
+      utils::Utilities::instance().getTimer(context.utility_id)) << std::endl;
+  }
+
   if (context.partition.write_partition_file) {
     PartitionerFacade::writePartitionFile(
-      partitioned_hypergraph, context.partition.graph_partition_filename);
+      partitioned_hypergraph, context.partition.graph_partition_filename,
+      context.partition.binary_partition_file);
+    if ( context.partition.nested_partitions ) {
+      PartitionerFacade::writeNestedPartitionFiles(
+        partitioned_hypergraph, context.partition.graph_partition_filename,
+        context.partition.binary_partition_file);
+    }
+    if ( context.partition.write_block_ordering ) {
+      PartitionerFacade::writeBlockOrderingFile(
+        partitioned_hypergraph, context.partition.graph_partition_filename);
+    }
+  }
+}
+
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t toHypergraph(Hypergraph&& hypergraph) {
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(new Hypergraph(std::move(hypergraph))), Hypergraph::TYPE };
+}
+
+// ! Copy of a (hyper)graph that is partitioned instead of the cached input
+mt_kahypar_hypergraph_t copyHypergraph(const mt_kahypar_hypergraph_t hypergraph) {
+  switch ( hypergraph.type ) {
+    case STATIC_HYPERGRAPH:
+      // Shares the pins and incident nets with the input, which are not modified
+      return toHypergraph(utils::cast_const<ds::StaticHypergraph>(hypergraph).shallowCopy(parallel_tag_t()));
+    ENABLE_GRAPHS(case STATIC_GRAPH:
+      return toHypergraph(utils::cast_const<ds::StaticGraph>(hypergraph).copy(parallel_tag_t()));)
+    ENABLE_HIGHEST_QUALITY(case DYNAMIC_HYPERGRAPH:
+      return toHypergraph(utils::cast_const<ds::DynamicHypergraph>(hypergraph).copy(parallel_tag_t()));)
+    ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(case DYNAMIC_GRAPH:
+      return toHypergraph(utils::cast_const<ds::DynamicGraph>(hypergraph).copy(parallel_tag_t()));)
+    default:
+      throw UnsupportedOperationException("Input is not a valid hypergraph.");
+  }
+  return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
+// The server reads jobs line by line from an input stream. Each line contains the
+// command line options of one partitioning call. In contrast to separate processes,
+// the thread pool, the hardware topology, the registries and the memory pool are only
+// initialized once, and the most recently used input (hyper)graphs are kept in memory.
+class PartitioningServer {
+
+  // ! Settings that determine which memory chunks are registered in the memory pool
+  struct MemoryPoolLayout {
+    mt_kahypar_hypergraph_type_t hypergraph_type = NULLPTR_HYPERGRAPH;
+    mt_kahypar_partition_type_t partition_type = NULLPTR_PARTITION;
+    PresetType preset_type = PresetType::UNDEFINED;
+    Mode mode = Mode::UNDEFINED;
+    Objective objective = Objective::UNDEFINED;
+    PartitionID k = 0;
+
+    bool operator== (const MemoryPoolLayout& other) const {
+      return hypergraph_type == other.hypergraph_type && partition_type == other.partition_type &&
+             preset_type == other.preset_type && mode == other.mode &&
+             objective == other.objective && k == other.k;
+    }
+  };
+
+ public:
+  PartitioningServer(const Context& server_context, const size_t max_cached_instances) :
+    _server_context(server_context),
+    _cache(max_cached_instances),
+    _layout(),
+    _capacity() { }
+
+  PartitioningServer(const PartitioningServer&) = delete;
+  PartitioningServer & operator= (const PartitioningServer &) = delete;
+
+  PartitioningServer(PartitioningServer&&) = delete;
+  PartitioningServer & operator= (PartitioningServer &&) = delete;
+
+  void run(std::istream& in, std::ostream& out) {
+    std::string line;
+    while ( std::getline(in, line) ) {
+      if ( line.find_first_not_of(" \t\r") == std::string::npos ) {
+        continue;
+      } else if ( line == "quit" ) {
+        break;
+      }
+
+      try {
+        const std::string result = runJob(line);
+        out << "DONE " << result << std::endl;
+      } catch ( const std::exception& e ) {
+        std::string msg(e.what());
+        std::replace(msg.begin(), msg.end(), '\n', ' ');
+        out << "ERROR " << msg << std::endl;
+      }
+    }
+  }
+
+ private:
+  std::string runJob(const std::string& line) {
+    Context context(false);
+    processServerJob(context, line);
+    setInstanceAndPartitionType(context);
+    // The process-wide settings of the server override the ones of the job
+    context.shared_memory = _server_context.shared_memory;
+    context.utility_id = _server_context.utility_id;
+    utils::Utilities::instance().getTimer(context.utility_id).clear();
+    utils::Utilities::instance().getStats(context.utility_id).clear();
+    setupTracing(context);
+    if ( context.partition.verbose_output ) {
+      io::printBanner();
+    }
+    setupRandomization(context);
+
+    // Partition a copy of the (cached) input
+    std::unique_ptr<TargetGraph> target_graph = readTargetGraph(context);
+    mt_kahypar_hypergraph_t hypergraph = copyHypergraph(_cache.get(context, readHypergraph));
+    mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph { nullptr, NULLPTR_PARTITION };
+    std::string result;
+    try {
+      addFixedVertices(hypergraph, context);
+      context.partition.partition_type = PartitionerFacade::partitionType(hypergraph, context);
+      acquireMemoryPool(hypergraph, context);
+
+      HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+      partitioned_hypergraph = PartitionerFacade::partition(hypergraph, context, target_graph.get());
+      HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+      std::chrono::duration<double> elapsed_seconds(end - start);
+
+      writeResults(partitioned_hypergraph, context, elapsed_seconds);
+      result = PartitionerFacade::serializeJSON(partitioned_hypergraph, context, elapsed_seconds);
+      utils::MemorySampler::instance().stop();
+    } catch ( ... ) {
+      utils::MemorySampler::instance().stop();
+      releaseJob(hypergraph, partitioned_hypergraph);
+      throw;
+    }
+    releaseJob(hypergraph, partitioned_hypergraph);
+    return result;
+  }
+
+  // ! Reuses the memory chunks of the previous job, if they were registered
+  // ! for the same settings and are large enough for the current instance
+  void acquireMemoryPool(const mt_kahypar_hypergraph_t hypergraph, const Context& context) {
+    auto& pool = parallel::MemoryPool::instance();
+    MemoryPoolLayout layout;
+    layout.hypergraph_type = hypergraph.type;
+    layout.partition_type = context.partition.partition_type;
+    layout.preset_type = context.partition.preset_type;
+    layout.mode = context.partition.mode;
+    layout.objective = context.partition.objective;
+    layout.k = context.partition.k;
+    const MemoryPoolDimensions dimensions = memory_pool_dimensions(hypergraph);
+    if ( !(_layout == layout) || !_capacity.contains(dimensions) ) {
+      if ( _layout == layout ) {
+        // Grow the memory chunks such that they also fit all previous instances
+        _capacity.num_hypernodes = std::max(_capacity.num_hypernodes, dimensions.num_hypernodes);
+        _capacity.num_hyperedges = std::max(_capacity.num_hyperedges, dimensions.num_hyperedges);
+        _capacity.num_pins = std::max(_capacity.num_pins, dimensions.num_pins);
+        _capacity.max_edge_size = std::max(_capacity.max_edge_size, dimensions.max_edge_size);
+      } else {
+        _capacity = dimensions;
+      }
+      _layout = layout;
+      pool.free_memory_chunks();
+      register_memory_pool(_layout.hypergraph_type, _capacity, context);
+    }
+    pool.activate();
+    // The memory chunks are reused in subsequent jobs, which
+    // also pays off for chunks smaller than the minimum allocation size
+    pool.deactivate_minimum_allocation_size();
+  }
+
+  void releaseJob(mt_kahypar_hypergraph_t hypergraph,
+                  mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph) {
+    // The partitioned hypergraph holds memory chunks of the memory pool
+    // => must be destroyed before the memory pool is reset
+    utils::delete_partitioned_hypergraph(partitioned_hypergraph);
+    utils::delete_hypergraph(hypergraph);
+    parallel::MemoryPool::instance().reset();
+  }
+
+  const Context& _server_context;
+  io::InstanceCache _cache;
+  MemoryPoolLayout _layout;
+  MemoryPoolDimensions _capacity;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+
+  Context context(false);
+  size_t max_cached_instances = 0;
+  if ( processServerCommandLineInput(context, max_cached_instances, argc, argv) ) {
+    context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+    initializeThreadsAndMemory(context);
+    register_algorithms_and_policies();
+    {
+      PartitioningServer server(context, max_cached_instances);
+      server.run(std::cin, std::cout);
+    }
+    parallel::BackgroundReclamation::instance().deactivate();
+    parallel::MemoryPool::instance().free_memory_chunks();
+    TBBInitializer::instance().terminate();
+    return 0;
+  }
+
+  parseContext(context, argc, argv);
+
+  context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+  setupTracing(context);
+  if (context.partition.verbose_output) {
+    io::printBanner();
+  }
+
+  setupRandomization(context);
+  initializeThreadsAndMemory(context);
+
+  // Read Hypergraph
+  mt_kahypar_hypergraph_t hypergraph { nullptr, NULLPTR_HYPERGRAPH };
+  if ( context.partition.preset_type == PresetType::automatic ) {
+    hypergraph = readHypergraphAndSelectPreset(context, argc, argv);
+    // The selected preset may change the randomization settings
+    setupRandomization(context);
+  } else {
+    hypergraph = readHypergraph(context);
   }
 
+  // Read Target Graph
+  std::unique_ptr<TargetGraph> target_graph = readTargetGraph(context);
+
+  addFixedVertices(hypergraph, context);
+
+  // The multilevel presets use the sparse connectivity information
+  // for hypergraphs with mostly small nets if k is large enough
+  context.partition.partition_type = PartitionerFacade::partitionType(hypergraph, context);
+
+  // Initialize Memory Pool and Algorithm/Policy Registries
+  register_memory_pool(hypergraph, context);
+  register_algorithms_and_policies();
+
+  // Partition Hypergraph
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  mt_kahypar_partitioned_hypergraph_t partitioned_hypergraph =
+    PartitionerFacade::partition(hypergraph, context, target_graph.get());
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+
+  // Print Stats
+  std::chrono::duration<double> elapsed_seconds(end - start);
+  writeResults(partitioned_hypergraph, context, elapsed_seconds);
+  utils::MemorySampler::instance().stop();
+
+  parallel::BackgroundReclamation::instance().deactivate();
   parallel::MemoryPool::instance().free_memory_chunks();
   TBBInitializer::instance().terminate();
 
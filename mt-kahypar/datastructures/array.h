@@ -27,7 +27,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <thread>
+#include <functional>
 #include <memory>
 #include <iterator>
 
@@ -36,8 +38,11 @@
 #include <tbb/parallel_invoke.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/huge_pages.h"
 #include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/parallel/numa_placement.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
+#include "mt-kahypar/parallel/stl/zero_allocator.h"
 #include "mt-kahypar/utils/exception.h"
 
 namespace mt_kahypar {
@@ -161,19 +166,19 @@ class Array {
   using const_iterator  = const ArrayIterator;
 
   Array() :
-    _group(""),
-    _key(""),
+    _mem_chunk_handle(),
     _size(0),
     _data(nullptr),
-    _underlying_data(nullptr) { }
+    _underlying_data(nullptr),
+    _external_deleter() { }
 
   Array(const size_type size,
          const value_type init_value = value_type()) :
-    _group(""),
-    _key(""),
+    _mem_chunk_handle(),
     _size(0),
     _data(nullptr),
-    _underlying_data(nullptr) {
+    _underlying_data(nullptr),
+    _external_deleter() {
     resize(size, init_value);
   }
 
@@ -182,11 +187,11 @@ class Array {
          const size_type size,
          const bool zero_initialize = false,
          const bool assign_parallel = true) :
-    _group(""),
-    _key(""),
+    _mem_chunk_handle(),
     _size(size),
     _data(nullptr),
-    _underlying_data(nullptr) {
+    _underlying_data(nullptr),
+    _external_deleter() {
     resize(group, key, size, zero_initialize, assign_parallel);
   }
 
@@ -194,33 +199,39 @@ class Array {
   Array & operator= (const Array &) = delete;
 
   Array(Array&& other) :
-    _group(std::move(other._group)),
-    _key(std::move(other._key)),
+    _mem_chunk_handle(other._mem_chunk_handle),
     _size(other._size),
     _data(std::move(other._data)),
-    _underlying_data(std::move(other._underlying_data)) {
+    _underlying_data(std::move(other._underlying_data)),
+    _external_deleter(std::move(other._external_deleter)) {
+    other._mem_chunk_handle = parallel::MemoryChunkHandle();
     other._size = 0;
     other._data = nullptr;
     other._underlying_data = nullptr;
+    other._external_deleter = nullptr;
   }
 
   Array & operator=(Array&& other) {
-    _group = std::move(other._group);
-    _key = std::move(other._key);
+    release_external_memory();
+    _mem_chunk_handle = other._mem_chunk_handle;
     _size = other._size;
     _data = std::move(other._data);
     _underlying_data = std::move(other._underlying_data);
+    _external_deleter = std::move(other._external_deleter);
+    other._mem_chunk_handle = parallel::MemoryChunkHandle();
     other._size = 0;
     other._data = nullptr;
     other._underlying_data = nullptr;
+    other._external_deleter = nullptr;
     return *this;
   }
 
   ~Array() {
-    if ( !_data && _underlying_data && !_group.empty() && !_key.empty() ) {
+    release_external_memory();
+    if ( !_data && _underlying_data && _mem_chunk_handle.exists() ) {
       // Memory was allocated from memory pool
       // => Release Memory
-      parallel::MemoryPool::instance().release_mem_chunk(_group, _key);
+      parallel::MemoryPool::instance().release_mem_chunk(_mem_chunk_handle);
     }
   }
 
@@ -290,14 +301,38 @@ class Array {
     return _size;
   }
 
+  // ! Returns an array that refers to the memory of this array without owning it.
+  // ! This array must outlive the returned array.
+  Array view() const {
+    Array array;
+    array._size = _size;
+    array._underlying_data = _underlying_data;
+    return array;
+  }
+
   // ####################### Initialization #######################
 
+  // ! Takes ownership of memory allocated by someone else (e.g., the caller of the library).
+  // ! The memory is released with the given deleter when the array is destroyed.
+  void adopt(value_type* data, const size_type size, std::function<void(value_type*)> deleter) {
+    if ( _data || _underlying_data ) {
+      throw SystemException("Memory of vector already allocated");
+    }
+    _size = size;
+    _underlying_data = data;
+    _external_deleter = std::move(deleter);
+  }
+
   void resize(const size_type size,
               const value_type init_value = value_type(),
               const bool assign_parallel = true) {
     if ( _data || _underlying_data ) {
       throw SystemException("Memory of vector already allocated");
     }
+    if ( is_zero(init_value) && allocate_zero_pages(size) ) {
+      // Fresh pages of the operating system are already zero-initialized
+      return;
+    }
     allocate_data(size);
     assign(size, init_value, assign_parallel);
   }
@@ -314,12 +349,21 @@ class Array {
               const size_type size,
               const bool zero_initialize = false,
               const bool assign_parallel = true) {
+    resize(parallel::MemoryPool::instance().memory_chunk_handle(group, key),
+      size, zero_initialize, assign_parallel);
+  }
+
+  // ! Same as resize(group, key, ...), but with a handle that was resolved
+  // ! before via MemoryPool::memory_chunk_handle(group, key)
+  void resize(const parallel::MemoryChunkHandle& handle,
+              const size_type size,
+              const bool zero_initialize = false,
+              const bool assign_parallel = true) {
     _size = size;
     char* data = parallel::MemoryPool::instance().request_mem_chunk(
-      group, key, size, sizeof(value_type));
+      handle, size, sizeof(value_type));
     if ( data ) {
-      _group = group;
-      _key = key;
+      _mem_chunk_handle = handle;
       _underlying_data = reinterpret_cast<value_type*>(data);
       if ( zero_initialize ) {
         assign(size, value_type(), assign_parallel);
@@ -351,9 +395,12 @@ class Array {
     if ( _underlying_data ) {
       ASSERT(count <= _size);
       if ( assign_parallel ) {
-        const size_t step = std::max(count / std::thread::hardware_concurrency(), UL(1));
-        tbb::parallel_for(UL(0), count, step, [&](const size_type i) {
-          for ( size_t j = i; j < std::min(i + step, count); ++j ) {
+        // Static assignment of index ranges to threads such that the
+        // pages of the array are first touched by the threads that own
+        // the corresponding range (see parallel/numa_placement.h)
+        parallel::static_parallel_for_ranges(UL(0), count,
+          [&](const size_type start, const size_type end) {
+          for ( size_t j = start; j < end; ++j ) {
             _underlying_data[j] = value;
           }
         });
@@ -368,17 +415,50 @@ class Array {
   }
 
  private:
+  void release_external_memory() {
+    if ( _external_deleter && _underlying_data ) {
+      _external_deleter(_underlying_data);
+      _external_deleter = nullptr;
+    }
+  }
+
   void allocate_data(const size_type size) {
     _data = parallel::make_unique<value_type>(size);
     _underlying_data = _data.get();
     _size = size;
+    parallel::HugePages::instance().advise(_underlying_data, size * sizeof(value_type));
+  }
+
+  // ! Maps large arrays from the operating system, which zero-initializes the pages
+  // ! lazily on first touch (see parallel::ZeroPages). Returns false for small arrays.
+  bool allocate_zero_pages(const size_type size) {
+    const size_t size_in_bytes = size * sizeof(value_type);
+    if ( !parallel::ZeroPages::isMapped(size_in_bytes) ) {
+      return false;
+    }
+    value_type* data = static_cast<value_type*>(parallel::ZeroPages::allocate(size_in_bytes));
+    if ( !data ) {
+      return false;
+    }
+    adopt(data, size, [size_in_bytes](value_type* ptr) {
+      parallel::ZeroPages::deallocate(ptr, size_in_bytes);
+    });
+    return true;
+  }
+
+  static bool is_zero(const value_type& value) {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    return std::all_of(bytes, bytes + sizeof(value_type), [](const char b) { return b == 0; });
   }
 
-  std::string _group;
-  std::string _key;
+  // ! Handle of the memory pool chunk, if the memory was requested from the memory pool
+  parallel::MemoryChunkHandle _mem_chunk_handle;
   size_type _size;
   parallel::tbb_unique_ptr<value_type> _data;
   value_type* _underlying_data;
+  // ! Releases the memory if it is owned but was not allocated by the array
+  // ! (see adopt(...) and allocate_zero_pages(...))
+  std::function<void(value_type*)> _external_deleter;
 };
 
 
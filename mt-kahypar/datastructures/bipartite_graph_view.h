@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/enumerable_thread_specific.h>
+
+#include <boost/range/irange.hpp>
+
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/range.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Implicit representation of the bipartite star expansion of a hypergraph.
+ * Node u < initialNumNodes() represents hypernode u and node initialNumNodes() + e
+ * represents hyperedge e. In contrast to the Graph data structure, the arcs are
+ * not materialized, but computed on the fly from the incident nets and pins of the
+ * hypergraph. Only the node volumes are stored. It can be used as input for the
+ * first level of the Louvain method, which avoids the copy of the hypergraph.
+ */
+template<typename Hypergraph>
+class BipartiteGraphView {
+
+  static_assert(Hypergraph::is_static_hypergraph && !Hypergraph::is_graph,
+    "Bipartite graph view requires a static hypergraph");
+
+  using IncidentNetsIterator = std::remove_const_t<typename Hypergraph::IncidentNetsIterator>;
+  using IncidenceIterator = std::remove_const_t<typename Hypergraph::IncidenceIterator>;
+
+ public:
+  /*!
+   * Iterates over the arcs of a node. If the node represents a hypernode, the
+   * arcs point to its incident nets, otherwise they point to the pins of the
+   * corresponding hyperedge.
+   */
+  class ArcIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Arc;
+    using reference = const Arc&;
+    using pointer = const Arc*;
+    using difference_type = std::ptrdiff_t;
+
+    ArcIterator(const BipartiteGraphView* view,
+                const NodeID u,
+                const size_t pos) :
+      _view(view),
+      _is_hypernode(u < view->_num_hypernodes),
+      _u(u),
+      _pos(pos),
+      _net_it(),
+      _pin_it(),
+      _arc() {
+      if ( _is_hypernode ) {
+        _net_it = view->_hg.incidentEdges(u).begin() + pos;
+      } else {
+        _pin_it = view->_hg.pins(u - view->_num_hypernodes).begin() + pos;
+      }
+    }
+
+    reference operator*() {
+      computeArc();
+      return _arc;
+    }
+
+    pointer operator->() {
+      computeArc();
+      return &_arc;
+    }
+
+    ArcIterator& operator++() {
+      ++_pos;
+      if ( _is_hypernode ) {
+        ++_net_it;
+      } else {
+        ++_pin_it;
+      }
+      return *this;
+    }
+
+    bool operator==(const ArcIterator& other) const {
+      return _u == other._u && _pos == other._pos;
+    }
+
+    bool operator!=(const ArcIterator& other) const {
+      return !(*this == other);
+    }
+
+   private:
+    void computeArc() {
+      if ( _is_hypernode ) {
+        const HyperedgeID he = *_net_it;
+        _arc = Arc(_view->_num_hypernodes + he, _view->arcWeight(he, _u));
+      } else {
+        const HypernodeID pin = *_pin_it;
+        _arc = Arc(pin, _view->arcWeight(_u - _view->_num_hypernodes, pin));
+      }
+    }
+
+    const BipartiteGraphView* _view;
+    bool _is_hypernode;
+    NodeID _u;
+    size_t _pos;
+    IncidentNetsIterator _net_it;
+    IncidenceIterator _pin_it;
+    Arc _arc;
+  };
+
+  using AdjacenceIterator = ArcIterator;
+
+  BipartiteGraphView(const Hypergraph& hypergraph, const LouvainEdgeWeight edge_weight_type) :
+    _hg(hypergraph),
+    _edge_weight_type(edge_weight_type),
+    _num_hypernodes(hypergraph.initialNumNodes()),
+    _num_nodes(hypergraph.initialNumNodes() + hypergraph.initialNumEdges()),
+    _num_arcs(2 * hypergraph.initialNumPins()),
+    _total_volume(0),
+    _max_degree(0),
+    _node_volumes() {
+    if ( _edge_weight_type != LouvainEdgeWeight::uniform &&
+         _edge_weight_type != LouvainEdgeWeight::non_uniform &&
+         _edge_weight_type != LouvainEdgeWeight::degree ) {
+      throw InvalidInputException("No valid louvain edge weight");
+    }
+
+    _node_volumes.resize("Preprocessing", "node_volumes", _num_nodes);
+    tbb::enumerable_thread_specific<size_t> local_max_degree(0);
+    tbb::parallel_for(ID(0), static_cast<NodeID>(_num_nodes), [&](const NodeID u) {
+      ArcWeight volume = 0.0;
+      for ( const Arc& arc : arcsOf(u) ) {
+        volume += arc.weight;
+      }
+      _node_volumes[u] = volume;
+      local_max_degree.local() = std::max(local_max_degree.local(), degree(u));
+    });
+    _max_degree = local_max_degree.combine([&](const size_t lhs, const size_t rhs) {
+      return std::max(lhs, rhs);
+    });
+
+    // deterministic reduce of node volumes since double addition is not commutative or associative
+    auto aggregate_volume = [&](const tbb::blocked_range<NodeID>& r, ArcWeight partial_volume) -> ArcWeight {
+      for (NodeID u = r.begin(); u < r.end(); ++u) {
+        partial_volume += nodeVolume(u);
+      }
+      return partial_volume;
+    };
+    auto r = tbb::blocked_range<NodeID>(ID(0), _num_nodes, 1000);
+    _total_volume = tbb::parallel_deterministic_reduce(r, 0.0, aggregate_volume, std::plus<>());
+  }
+
+  BipartiteGraphView(const BipartiteGraphView&) = delete;
+  BipartiteGraphView& operator= (const BipartiteGraphView&) = delete;
+
+  // ! Number of nodes in the graph
+  size_t numNodes() const {
+    return _num_nodes;
+  }
+
+  // ! Number of arcs in the graph
+  size_t numArcs() const {
+    return _num_arcs;
+  }
+
+  // ! Iterator over all nodes of the graph
+  auto nodes() const {
+    return boost::irange<NodeID>(0, static_cast<NodeID>(numNodes()));
+  }
+
+  // ! Iterator over all adjacent vertices of u
+  // ! If 'n' is set, then only an iterator over the first n elements is returned
+  IteratorRange<ArcIterator> arcsOf(const NodeID u,
+                                    const size_t n = std::numeric_limits<size_t>::max()) const {
+    ASSERT(u < _num_nodes);
+    return IteratorRange<ArcIterator>(ArcIterator(this, u, 0),
+      ArcIterator(this, u, std::min(n, degree(u))));
+  }
+
+  // ! Degree of vertex u
+  size_t degree(const NodeID u) const {
+    ASSERT(u < _num_nodes);
+    return u < _num_hypernodes ? _hg.nodeDegree(u) : _hg.edgeSize(u - _num_hypernodes);
+  }
+
+  // ! Maximum degree of a vertex
+  size_t max_degree() const {
+    return _max_degree;
+  }
+
+  // ! Total Volume of the graph
+  ArcWeight totalVolume() const {
+    return _total_volume;
+  }
+
+  // ! Node volume of vertex u
+  ArcWeight nodeVolume(const NodeID u) const {
+    ASSERT(u < _num_nodes);
+    return _node_volumes[u];
+  }
+
+  // ! Projects the clustering of the star-expansion graph to the hypergraph
+  void restrictClusteringToHypernodes(const Hypergraph& hg, ds::Clustering& C) const {
+    C.resize(hg.initialNumNodes());
+  }
+
+  bool canBeUsed(const bool = true) const {
+    return _node_volumes.size() >= numNodes();
+  }
+
+ private:
+  ArcWeight arcWeight(const HyperedgeID he, const HypernodeID hn) const {
+    const ArcWeight edge_weight = _hg.edgeWeight(he);
+    switch ( _edge_weight_type ) {
+      case LouvainEdgeWeight::non_uniform:
+        return edge_weight / static_cast<ArcWeight>(_hg.edgeSize(he));
+      case LouvainEdgeWeight::degree:
+        return edge_weight * (static_cast<ArcWeight>(_hg.nodeDegree(hn)) /
+                              static_cast<ArcWeight>(_hg.edgeSize(he)));
+      default:
+        return edge_weight;
+    }
+  }
+
+  const Hypergraph& _hg;
+  const LouvainEdgeWeight _edge_weight_type;
+  const NodeID _num_hypernodes;
+  const size_t _num_nodes;
+  const size_t _num_arcs;
+  ArcWeight _total_volume;
+  size_t _max_degree;
+  // ! Node Volumes (= sum of arc weights for each node)
+  ds::Array<ArcWeight> _node_volumes;
+};
+
+}  // namespace ds
+
+// expose
+template<typename Hypergraph>
+using BipartiteGraphView = ds::BipartiteGraphView<Hypergraph>;
+
+}  // namespace mt_kahypar
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -86,7 +87,7 @@ class Bitset {
     std::memcpy(_bitset.data(), blocks, sizeof(Block) * num_blocks);
   }
 
-  bool isSet(const size_t pos) {
+  bool isSet(const size_t pos) const {
     ASSERT(pos < _size);
     const size_t block_idx = pos >> DIV_SHIFT; // pos / BITS_PER_BLOCK;
     const size_t idx = pos & MOD_MASK; // pos % BITS_PER_BLOCK;
@@ -107,6 +108,32 @@ class Bitset {
     _bitset[block_idx] &= ~(static_cast<Block>(1) << idx);
   }
 
+  // ! Computes the union with the given blocks (must not be more than numBlocks())
+  void unionWith(const size_t num_blocks, const Block* blocks) {
+    ASSERT(num_blocks <= _bitset.size());
+    Block* bitset = _bitset.data();
+    for ( size_t i = 0; i < num_blocks; ++i ) {
+      bitset[i] |= blocks[i];
+    }
+  }
+
+  // ! Computes the intersection with the given blocks (missing blocks are treated as zero)
+  void intersectWith(const size_t num_blocks, const Block* blocks) {
+    const size_t num_common_blocks = std::min(num_blocks, _bitset.size());
+    Block* bitset = _bitset.data();
+    for ( size_t i = 0; i < num_common_blocks; ++i ) {
+      bitset[i] &= blocks[i];
+    }
+    for ( size_t i = num_common_blocks; i < _bitset.size(); ++i ) {
+      bitset[i] = 0;
+    }
+  }
+
+  // ! Returns the number of one bits in the bitset
+  int popcount() const {
+    return utils::popcount_blocks(_bitset.data(), _bitset.size());
+  }
+
  private:
   friend class StaticBitset;
 
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Incrementally maintained set of border nodes. For each node, we store the number of
+ * incident cut hyperedges. The partitioned (hyper)graph updates the counters of all pins
+ * of a hyperedge when it becomes cut or non-cut, which it detects from the pin counts after
+ * a node move (see SynchronizedEdgeUpdate). A node is appended to the border node list when
+ * its counter becomes positive. Nodes whose counter drops to zero are removed lazily,
+ * i.e., stale entries remain in the list until the next call to doParallelForAllBorderNodes(...).
+ *
+ * Note that counters can temporarily become negative, since the counter updates of a hyperedge
+ * that becomes cut and the updates of a subsequent move that removes it from the cut again
+ * are not synchronized with each other.
+ */
+class BorderNodes {
+
+  using Counter = int32_t;
+
+ public:
+  BorderNodes() :
+    _is_valid(false),
+    _num_incident_cut_hes(),
+    _in_list(),
+    _nodes(),
+    _size(0) { }
+
+  BorderNodes(const BorderNodes&) = delete;
+  BorderNodes & operator= (const BorderNodes &) = delete;
+
+  BorderNodes(BorderNodes&&) = default;
+  BorderNodes & operator= (BorderNodes&&) = default;
+
+  // ! True, if the counters reflect the current partition
+  bool isValid() const {
+    return _is_valid.load(std::memory_order_relaxed);
+  }
+
+  // ! Must be called on all modifications of the partition or the hypergraph
+  // ! that do not report the pin count changes of the hyperedges
+  void invalidate() {
+    if ( isValid() ) {
+      _is_valid.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  // ! Computes the counters from scratch. num_incident_cut_hes(u) must return
+  // ! the number of cut hyperedges incident to node u (or zero if u is not enabled).
+  template<typename F>
+  void initialize(const HypernodeID num_nodes, const F& num_incident_cut_hes) {
+    if ( _num_incident_cut_hes.size() < num_nodes ) {
+      _num_incident_cut_hes.resize(num_nodes);
+      _in_list.resize(num_nodes);
+      _nodes.resize(num_nodes);
+    }
+    _size.store(0, std::memory_order_relaxed);
+    tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), num_nodes),
+      [&](const tbb::blocked_range<HypernodeID>& r) {
+        vec<HypernodeID> local_border_nodes;
+        for ( HypernodeID u = r.begin(); u < r.end(); ++u ) {
+          const Counter count = num_incident_cut_hes(u);
+          _num_incident_cut_hes[u].store(count, std::memory_order_relaxed);
+          _in_list[u].store(count > 0, std::memory_order_relaxed);
+          if ( count > 0 ) {
+            local_border_nodes.push_back(u);
+          }
+        }
+        // Reserve one contiguous range of the list per block instead of one slot per node
+        const size_t start = _size.fetch_add(local_border_nodes.size(), std::memory_order_relaxed);
+        std::copy(local_border_nodes.begin(), local_border_nodes.end(), _nodes.begin() + start);
+      });
+    _is_valid.store(true, std::memory_order_relaxed);
+  }
+
+  bool isBorderNode(const HypernodeID u) const {
+    ASSERT(isValid());
+    ASSERT(u < _num_incident_cut_hes.size());
+    return _num_incident_cut_hes[u].load(std::memory_order_relaxed) > 0;
+  }
+
+  HyperedgeID numIncidentCutHyperedges(const HypernodeID u) const {
+    ASSERT(isValid());
+    ASSERT(u < _num_incident_cut_hes.size());
+    return std::max(_num_incident_cut_hes[u].load(std::memory_order_relaxed), Counter(0));
+  }
+
+  // ! A hyperedge incident to u becomes cut (thread-safe)
+  void increment(const HypernodeID u) {
+    ASSERT(u < _num_incident_cut_hes.size());
+    if ( _num_incident_cut_hes[u].add_fetch(1, std::memory_order_relaxed) == 1 ) {
+      insert(u);
+    }
+  }
+
+  // ! A hyperedge incident to u becomes non-cut (thread-safe)
+  void decrement(const HypernodeID u) {
+    ASSERT(u < _num_incident_cut_hes.size());
+    _num_incident_cut_hes[u].sub_fetch(1, std::memory_order_relaxed);
+  }
+
+  // ! Removes stale entries from the border node list and calls f(u) in parallel for
+  // ! each border node u. Must not be called concurrently with node moves.
+  template<typename F>
+  void doParallelForAllBorderNodes(const F& f) {
+    ASSERT(isValid());
+    compact();
+    tbb::parallel_for(UL(0), _size.load(std::memory_order_relaxed), [&](const size_t i) {
+      f(_nodes[i]);
+    });
+  }
+
+  // ! Number of entries in the border node list (including stale entries)
+  size_t size() const {
+    return _size.load(std::memory_order_relaxed);
+  }
+
+  size_t memoryConsumption() const {
+    return _num_incident_cut_hes.size() * ( sizeof(CAtomic<Counter>) +
+      sizeof(CAtomic<bool>) + sizeof(HypernodeID) );
+  }
+
+ private:
+  void insert(const HypernodeID u) {
+    bool expected = false;
+    if ( _in_list[u].compare_exchange_strong(expected, true, std::memory_order_relaxed) ) {
+      const size_t pos = _size.fetch_add(1, std::memory_order_relaxed);
+      ASSERT(pos < _nodes.size());
+      _nodes[pos] = u;
+    }
+  }
+
+  void compact() {
+    const size_t size = _size.load(std::memory_order_relaxed);
+    // Border nodes keep their relative order, which is determined via a prefix sum
+    vec<size_t> position(size + 1, 0);
+    tbb::parallel_for(UL(0), size, [&](const size_t i) {
+      const HypernodeID u = _nodes[i];
+      const bool is_border_node = _num_incident_cut_hes[u].load(std::memory_order_relaxed) > 0;
+      if ( !is_border_node ) {
+        _in_list[u].store(false, std::memory_order_relaxed);
+      }
+      position[i + 1] = is_border_node;
+    });
+    parallel_prefix_sum(position.begin(), position.end(), position.begin(), std::plus<size_t>(), UL(0));
+    if ( position.back() < size ) {
+      vec<HypernodeID> border_nodes(position.back());
+      tbb::parallel_for(UL(0), size, [&](const size_t i) {
+        if ( position[i + 1] != position[i] ) {
+          border_nodes[position[i]] = _nodes[i];
+        }
+      });
+      std::copy(border_nodes.begin(), border_nodes.end(), _nodes.begin());
+      _size.store(border_nodes.size(), std::memory_order_relaxed);
+    }
+  }
+
+  // ! True, if the counters reflect the current partition
+  CAtomic<bool> _is_valid;
+  // ! Number of cut hyperedges incident to each node
+  vec<CAtomic<Counter>> _num_incident_cut_hes;
+  // ! True, if the node is contained in the border node list
+  vec<CAtomic<bool>> _in_list;
+  // ! Border node list (may contain stale entries)
+  vec<HypernodeID> _nodes;
+  CAtomic<size_t> _size;
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
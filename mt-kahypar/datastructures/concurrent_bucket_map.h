@@ -33,12 +33,14 @@
 
 #include <tbb/task_arena.h>
 #include <tbb/task_group.h>
+#include <tbb/parallel_sort.h>
 
 #include "kahypar-resources/meta/mandatory.h"
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/hash.h"
 
 namespace mt_kahypar {
 namespace ds {
@@ -57,12 +59,20 @@ namespace ds {
  * bucket by computing key % num_buckets. To insert the key-value
  * pair, we acquire a lock on the corresponding bucket. Note,
  * key must be of type uint64_t.
+ * Footprints of hyperedges are often far from uniformly distributed in
+ * their lower bits (e.g., sum of squared pin IDs). In that case, the
+ * key-value pair should be inserted with insertWithHashedKey(...), which
+ * scrambles the key before computing its bucket. Buckets that still become
+ * large (e.g., many hyperedges with the same footprint) can be sorted
+ * in parallel with sortBucket(...).
  */
 template <typename Value>
 class ConcurrentBucketMap {
 
   static constexpr bool debug = false;
   static constexpr size_t BUCKET_FACTOR = 128;
+  // ! Buckets larger than this threshold are sorted in parallel
+  static constexpr size_t PARALLEL_SORT_THRESHOLD = 10000;
 
   using Bucket = parallel::scalable_vector<Value>;
 
@@ -95,12 +105,29 @@ class ConcurrentBucketMap {
     return _num_buckets;
   }
 
+  size_t size_in_bytes() const {
+    size_t size = 0;
+    for ( const Bucket& bucket : _buckets ) {
+      size += bucket.capacity() * sizeof(Value);
+    }
+    return size;
+  }
+
   // ! Returns the corresponding bucket
   Bucket& getBucket(const size_t bucket) {
     ASSERT(bucket < _num_buckets);
     return _buckets[bucket];
   }
 
+  // ! Returns the size of the largest bucket
+  size_t maxBucketSize() const {
+    size_t max_size = 0;
+    for ( const Bucket& bucket : _buckets ) {
+      max_size = std::max(max_size, bucket.size());
+    }
+    return max_size;
+  }
+
   // ! Reserves memory in each bucket such that the estimated number of insertions
   // ! can be handled without the need (with high probability) of expensive bucket resizing.
   void reserve_for_estimated_number_of_insertions(const size_t estimated_num_insertions) {
@@ -121,6 +148,25 @@ class ConcurrentBucketMap {
     _spin_locks[bucket].unlock();
   }
 
+  // ! Inserts a key-value pair into the bucket determined by the hash of the key.
+  // ! Should be used if the lower bits of the keys are not evenly distributed.
+  void insertWithHashedKey(const size_t& key, Value&& value) {
+    insert(hashing::integer::hash64(key), std::move(value));
+  }
+
+  // ! Sorts the corresponding bucket. Large buckets are sorted in parallel
+  // ! such that a skewed key distribution does not serialize the caller.
+  template<typename Compare>
+  void sortBucket(const size_t bucket, const Compare& comp) {
+    ASSERT(bucket < _num_buckets);
+    Bucket& b = _buckets[bucket];
+    if ( b.size() > PARALLEL_SORT_THRESHOLD ) {
+      tbb::parallel_sort(b.begin(), b.end(), comp);
+    } else {
+      std::sort(b.begin(), b.end(), comp);
+    }
+  }
+
   // ! Frees the memory of all buckets
   void free() {
     parallel::parallel_free(_buckets);
@@ -90,6 +90,10 @@ class ConcurrentFlatMap {
     return _map_size;
   }
 
+  size_t size_in_bytes() const {
+    return _map_size * sizeof(MapElement);
+  }
+
   void setMaxSize(const size_t max_size) {
     if ( 4 * max_size > _map_size ) {
       freeInternalData();
@@ -35,32 +35,57 @@
 namespace mt_kahypar {
 namespace ds {
 
+/*!
+ * Pin counts and connectivity sets of all hyperedges. For small k, the connectivity
+ * bitset and the pin counts of a hyperedge are co-located in one record that does not
+ * cross a cache line boundary (word 0 stores the bitset, the following words the pin
+ * counts). Thus, updating a hyperedge in changeNodePart(...) touches one cache line
+ * instead of two. Otherwise, both are stored in separate arrays.
+ */
 class ConnectivityInfo {
 
+  static constexpr size_t CACHE_LINE_WORDS = 8;
+  static constexpr PartitionID MAX_CO_LOCATED_K = 32;
+
  public:
   using Iterator = typename ConnectivitySets::Iterator;
 
+  // ! The connectivity set of a hyperedge is stored as a dense bitset
+  static constexpr bool has_dense_connectivity_set = true;
+  // ! Supports moving a pin between two blocks without locking (see movePinAtomically(...))
+  static constexpr bool supports_atomic_pin_moves = true;
+
   ConnectivityInfo() :
     _pin_counts(),
-    _con_set() { }
+    _con_set(),
+    _records() { }
 
   ConnectivityInfo(const HyperedgeID num_hyperedges,
                    const PartitionID k,
                    const HypernodeID max_value) :
-    _pin_counts(num_hyperedges, k, max_value, false),
-    _con_set(num_hyperedges, k, false) { }
+    _pin_counts(),
+    _con_set(),
+    _records() {
+    if ( !initializeCoLocatedRecords(num_hyperedges, k, max_value, false) ) {
+      _pin_counts.initialize(num_hyperedges, k, max_value, false);
+      _con_set = ConnectivitySets(num_hyperedges, k, false);
+    }
+  }
 
   ConnectivityInfo(const HyperedgeID num_hyperedges,
                    const PartitionID k,
                    const HypernodeID max_value,
                    parallel_tag_t) :
     _pin_counts(),
-    _con_set() {
-    tbb::parallel_invoke([&] {
-      _pin_counts.initialize(num_hyperedges, k, max_value, true);
-    }, [&] {
-      _con_set = ConnectivitySets(num_hyperedges, k, true);
-    });
+    _con_set(),
+    _records() {
+    if ( !initializeCoLocatedRecords(num_hyperedges, k, max_value, true) ) {
+      tbb::parallel_invoke([&] {
+        _pin_counts.initialize(num_hyperedges, k, max_value, true);
+      }, [&] {
+        _con_set = ConnectivitySets(num_hyperedges, k, true);
+      });
+    }
   }
 
   ConnectivityInfo(const ConnectivityInfo&) = delete;
@@ -68,14 +93,35 @@ class ConnectivityInfo {
 
   ConnectivityInfo(ConnectivityInfo&& other) :
     _pin_counts(std::move(other._pin_counts)),
-    _con_set(std::move(other._con_set)) { }
+    _con_set(std::move(other._con_set)),
+    _records(std::move(other._records)) { }
 
   ConnectivityInfo & operator= (ConnectivityInfo&& other) {
     _pin_counts = std::move(other._pin_counts);
     _con_set = std::move(other._con_set);
+    _records = std::move(other._records);
     return *this;
   }
 
+  // ! Number of words per hyperedge if the connectivity set and the pin counts are
+  // ! co-located (see initializeCoLocatedRecords(...)) or zero otherwise.
+  static size_t num_record_words(const PartitionID k, const HypernodeID max_value) {
+    if ( k > MAX_CO_LOCATED_K ) {
+      return 0;
+    }
+    const size_t required_words = 1 + PinCountLayout::num_values_per_hyperedge(k, max_value);
+    size_t record_words = 2;
+    while ( record_words < required_words ) {
+      record_words *= 2;
+    }
+    return record_words <= CACHE_LINE_WORDS ? record_words : 0;
+  }
+
+  // ! True, if the connectivity set and the pin counts of a hyperedge are co-located
+  bool isCoLocated() const {
+    return _records.size() > 0;
+  }
+
   // ################## Connectivity Set ##################
 
   inline void addBlock(const HyperedgeID he, const PartitionID p) {
@@ -110,8 +156,18 @@ class ConnectivityInfo {
     return _con_set.deepCopy(he);
   }
 
+  // ! Returns the i-th 64-bit block of the connectivity set bitset of hyperedge he
+  inline StaticBitset::Block connectivitySetBlock(const HyperedgeID he, const size_t i) const {
+    return _con_set.bitsetBlock(he, i);
+  }
+
   // ################## Pin Count In Part ##################
 
+  // ! Prefetches the pin counts of the hyperedge
+  inline void prefetchPinCounts(const HyperedgeID he) const {
+    _pin_counts.prefetch(he);
+  }
+
   // ! Returns the pin count of the hyperedge in the corresponding block
   inline HypernodeID pinCountInPart(const HyperedgeID he,
                                     const PartitionID id) const {
@@ -142,15 +198,40 @@ class ConnectivityInfo {
     return _pin_counts.snapshot(he);
   }
 
+  // ! True, if movePinAtomically(...) can be used
+  inline bool canMovePinAtomically() const {
+    return _pin_counts.isStoredInOneWord();
+  }
+
+  // ! Moves a pin of the hyperedge from block from to block to without locking. The pin
+  // ! counts of both blocks are updated with one CAS operation. Only the thread that
+  // ! decreases a pin count to zero (increases to one) toggles the corresponding bit of
+  // ! the connectivity set. Returns the pin counts of both blocks after the move.
+  inline std::pair<HypernodeID, HypernodeID> movePinAtomically(const HyperedgeID he,
+                                                               const PartitionID from,
+                                                               const PartitionID to) {
+    const std::pair<HypernodeID, HypernodeID> pin_counts_after =
+      _pin_counts.movePinAtomically(he, from, to);
+    if ( pin_counts_after.first == 0 ) {
+      _con_set.remove(he, from);
+    }
+    if ( pin_counts_after.second == 1 ) {
+      _con_set.add(he, to);
+    }
+    return pin_counts_after;
+  }
+
   // ################## Miscellaneous ##################
 
   // ! Returns the size in bytes of this data structure
   size_t size_in_bytes() const {
-    return _pin_counts.size_in_bytes() /* + connectivity set */;
+    return _pin_counts.size_in_bytes() + sizeof(PinCountInPart::Value) * _records.size() /* + connectivity set */;
   }
 
   void reset(const bool reset_parallel = false) {
-    if ( reset_parallel ) {
+    if ( isCoLocated() ) {
+      _records.assign(_records.size(), 0, reset_parallel);
+    } else if ( reset_parallel ) {
       tbb::parallel_invoke(
         [&] { _pin_counts.reset(true); },
         [&] { _con_set.reset(true); });
@@ -163,23 +244,52 @@ class ConnectivityInfo {
   void freeInternalData() {
     tbb::parallel_invoke(
       [&] { _pin_counts.freeInternalData(); },
-      [&] { _con_set.freeInternalData(); });
+      [&] { _con_set.freeInternalData(); },
+      [&] { parallel::free(_records); });
   }
 
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
     ASSERT(parent);
-    _pin_counts.memoryConsumption(parent);
-    _con_set.memoryConsumption(parent);
+    if ( isCoLocated() ) {
+      parent->addChild("Connectivity Records", sizeof(PinCountInPart::Value) * _records.size());
+    } else {
+      _pin_counts.memoryConsumption(parent);
+      _con_set.memoryConsumption(parent);
+    }
   }
 
 
  private:
+  bool initializeCoLocatedRecords(const HyperedgeID num_hyperedges,
+                                  const PartitionID k,
+                                  const HypernodeID max_value,
+                                  const bool assign_parallel) {
+    const size_t record_words = num_record_words(k, max_value);
+    if ( num_hyperedges == 0 || record_words == 0 ) {
+      return false;
+    }
+    // Additional words to align the first record with a cache line
+    _records.resize(static_cast<size_t>(num_hyperedges) * record_words + CACHE_LINE_WORDS,
+      PinCountInPart::Value(0), assign_parallel);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(_records.data());
+    const uintptr_t cache_line_size = CACHE_LINE_WORDS * sizeof(PinCountInPart::Value);
+    PinCountInPart::Value* records = reinterpret_cast<PinCountInPart::Value*>(
+      (address + cache_line_size - 1) & ~(cache_line_size - 1));
+    _con_set = ConnectivitySets(num_hyperedges, k, records, record_words);
+    _pin_counts.initialize(num_hyperedges, k, max_value, records + 1, record_words);
+    return true;
+  }
+
   // ! For each hyperedge and each block, _pins_in_part stores the
   // ! number of pins in that block
   PinCountInPart _pin_counts;
 
   // ! For each hyperedge, _connectivity_set stores the set of blocks that the hyperedge spans
   ConnectivitySets _con_set;
+
+  // ! Co-located connectivity sets and pin counts (if used, _pin_counts and _con_set
+  // ! operate on this memory)
+  Array<PinCountInPart::Value> _records;
 };
 
 class SparseConnectivityInfo {
@@ -187,6 +297,9 @@ class SparseConnectivityInfo {
  public:
   using Iterator = typename SparsePinCounts::Iterator;
 
+  static constexpr bool has_dense_connectivity_set = false;
+  static constexpr bool supports_atomic_pin_moves = false;
+
   SparseConnectivityInfo() :
     _pin_counts() { }
 
@@ -250,6 +363,11 @@ class SparseConnectivityInfo {
 
   // ################## Pin Count In Part ##################
 
+  // ! Prefetches the pin counts of the hyperedge
+  inline void prefetchPinCounts(const HyperedgeID he) const {
+    _pin_counts.prefetch(he);
+  }
+
   // ! Returns the pin count of the hyperedge in the corresponding block
   inline HypernodeID pinCountInPart(const HyperedgeID he,
                                     const PartitionID id) const {
@@ -58,6 +58,8 @@ namespace ds {
  *      to add a part. One correct way is to keep an atomic count of pins for each hyperedge and part. Then only the thread
  *      raising the counter from zero to one performs the add, and only the thread decreasing the counter from one to zero
  *      performs the removal.
+ *      The bitsets can also be stored in external memory with a fixed stride between the bitsets of consecutive
+ *      hyperedges (see ConnectivityInfo, which co-locates the bitset with the pin counts of a hyperedge).
  */
 class ConnectivitySets {
 public:
@@ -72,6 +74,8 @@ public:
     ENABLE_ASSERTIONS(_k(0) COMMA)
     ENABLE_ASSERTIONS(_num_hyperedges(0) COMMA)
     _num_blocks_per_hyperedge(0),
+    _stride(0),
+    _data(nullptr),
     _bits(),
     _deep_copy_bitset(),
     _shallow_copy_bitset() { }
@@ -82,6 +86,8 @@ public:
     ENABLE_ASSERTIONS(_k(k) COMMA)
     ENABLE_ASSERTIONS(_num_hyperedges(num_hyperedges) COMMA)
     _num_blocks_per_hyperedge(k / BITS_PER_BLOCK + (k % BITS_PER_BLOCK != 0)),
+    _stride(_num_blocks_per_hyperedge),
+    _data(nullptr),
     _bits(),
     _deep_copy_bitset(),
     _shallow_copy_bitset() {
@@ -90,14 +96,34 @@ public:
           static_cast<size_t>(num_hyperedges) * _num_blocks_per_hyperedge
           + 1 /* The nextBlockID() implementation performs a (masked out) load past the end */
           , true, assign_parallel);
+        _data = _bits.data();
       }
     }
 
+  // ! Connectivity sets stored in external (zero-initialized) memory owned by the caller.
+  // ! The bitset of hyperedge he starts at data + he * stride. Note that the memory must
+  // ! contain at least one more block after the last bitset (see above).
+  ConnectivitySets(const HyperedgeID num_hyperedges,
+                   const PartitionID k,
+                   UnsafeBlock* data,
+                   const size_t stride) :
+    ENABLE_ASSERTIONS(_k(k) COMMA)
+    ENABLE_ASSERTIONS(_num_hyperedges(num_hyperedges) COMMA)
+    _num_blocks_per_hyperedge(k / BITS_PER_BLOCK + (k % BITS_PER_BLOCK != 0)),
+    _stride(stride),
+    _data(data),
+    _bits(),
+    _deep_copy_bitset(),
+    _shallow_copy_bitset() {
+      ASSERT(stride >= static_cast<size_t>(_num_blocks_per_hyperedge));
+      (void) num_hyperedges;
+    }
+
   IteratorRange<Iterator> connectivitySet(const HyperedgeID he) const {
     return IteratorRange<Iterator>(
-      Iterator(_num_blocks_per_hyperedge, _bits.data() + he * _num_blocks_per_hyperedge, -1),
-      Iterator(_num_blocks_per_hyperedge, _bits.data() +
-        he * _num_blocks_per_hyperedge, _num_blocks_per_hyperedge * BITS_PER_BLOCK));
+      Iterator(_num_blocks_per_hyperedge, _data + he * _stride, -1),
+      Iterator(_num_blocks_per_hyperedge, _data + he * _stride,
+        _num_blocks_per_hyperedge * BITS_PER_BLOCK));
   }
 
   void add(const HyperedgeID he, const PartitionID p) {
@@ -111,19 +137,20 @@ public:
   bool contains(const HyperedgeID he, const PartitionID p) const {
     const size_t div = p / BITS_PER_BLOCK;
     const size_t rem = p % BITS_PER_BLOCK;
-    const size_t pos = static_cast<size_t>(he) * _num_blocks_per_hyperedge + div;
-    return __atomic_load_n(&_bits[pos], __ATOMIC_RELAXED) & (UnsafeBlock(1) << rem);
+    const size_t pos = static_cast<size_t>(he) * _stride + div;
+    return __atomic_load_n(&_data[pos], __ATOMIC_RELAXED) & (UnsafeBlock(1) << rem);
   }
 
   // not threadsafe
   void clear(const HyperedgeID he) {
-    const size_t start = static_cast<size_t>(he) * _num_blocks_per_hyperedge;
-    const size_t end = ( static_cast<size_t>(he) + 1 ) * _num_blocks_per_hyperedge;
+    const size_t start = static_cast<size_t>(he) * _stride;
+    const size_t end = start + _num_blocks_per_hyperedge;
     for (size_t i = start; i < end; ++i) {
-      __atomic_store_n(&_bits[i], 0, __ATOMIC_RELAXED);
+      __atomic_store_n(&_data[i], 0, __ATOMIC_RELAXED);
     }
   }
 
+  // ! Note, connectivity sets stored in external memory are reset by the owner of the memory
   void reset(const bool reset_parallel = false) {
     if ( reset_parallel ) {
       tbb::parallel_for(UL(0), _bits.size(), [&](const size_t i) {
@@ -138,19 +165,54 @@ public:
 
   PartitionID connectivity(const HyperedgeID he) const {
     PartitionID conn = 0;
-    const size_t start = static_cast<size_t>(he) * _num_blocks_per_hyperedge;
-    const size_t end = ( static_cast<size_t>(he) + 1 ) * _num_blocks_per_hyperedge;
+    const size_t start = static_cast<size_t>(he) * _stride;
+    const size_t end = start + _num_blocks_per_hyperedge;
     for (size_t i = start; i < end; ++i) {
-      conn += utils::popcount_64(__atomic_load_n(&_bits[i], __ATOMIC_RELAXED));
+      conn += utils::popcount_64(__atomic_load_n(&_data[i], __ATOMIC_RELAXED));
     }
     return conn;
   }
 
+  // ! Calls f(block) for each block in the connectivity set of hyperedge he.
+  // ! Faster than iterating over connectivitySet(he), since the bits are
+  // ! extracted from each 64-bit block in a tight loop.
+  template<typename F>
+  void doForAllBlocks(const HyperedgeID he, const F& f) const {
+    shallowBitset(he).doForAllOneBits(f);
+  }
+
+  // ! Adds the connectivity sets of all given hyperedges to result, e.g.,
+  // ! for the incident nets of a node this computes its adjacent blocks.
+  // ! The bitset must have at least k bits.
+  template<typename EdgeRange>
+  void unionOfConnectivitySets(const EdgeRange& edges, Bitset& result) const {
+    ASSERT(result.numBlocks() >= static_cast<size_t>(_num_blocks_per_hyperedge));
+    if ( _num_blocks_per_hyperedge == 1 ) {
+      // Accumulate in a register instead of writing to the bitset for each hyperedge
+      UnsafeBlock bits = 0;
+      for ( const HyperedgeID& he : edges ) {
+        bits |= __atomic_load_n(&_data[static_cast<size_t>(he) * _stride], __ATOMIC_RELAXED);
+      }
+      result.unionWith(1, &bits);
+    } else {
+      for ( const HyperedgeID& he : edges ) {
+        result.unionWith(_num_blocks_per_hyperedge,
+          &_data[static_cast<size_t>(he) * _stride]);
+      }
+    }
+  }
+
+  // ! Returns the i-th 64-bit block of the connectivity set bitset of hyperedge he
+  UnsafeBlock bitsetBlock(const HyperedgeID he, const size_t i) const {
+    ASSERT(i < _num_blocks_per_hyperedge);
+    return __atomic_load_n(&_data[static_cast<size_t>(he) * _stride + i], __ATOMIC_RELAXED);
+  }
+
   // Creates a shallow copy of the connectivity set of hyperedge he
   StaticBitset& shallowCopy(const HyperedgeID he) const {
     StaticBitset& shallow_copy = _shallow_copy_bitset.local();
     shallow_copy.set(_num_blocks_per_hyperedge,
-      &_bits[UL(he) * _num_blocks_per_hyperedge]);
+      &_data[UL(he) * _stride]);
     return shallow_copy;
   }
 
@@ -158,12 +220,13 @@ public:
   Bitset& deepCopy(const HyperedgeID he) const {
     Bitset& deep_copy = _deep_copy_bitset.local();
     deep_copy.copy(_num_blocks_per_hyperedge,
-      &_bits[UL(he) * _num_blocks_per_hyperedge]);
+      &_data[UL(he) * _stride]);
     return deep_copy;
   }
 
   void freeInternalData() {
     parallel::free(_bits);
+    _data = nullptr;
   }
 
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
@@ -177,18 +240,27 @@ public:
   }
 
 private:
+  StaticBitset shallowBitset(const HyperedgeID he) const {
+    return StaticBitset(_num_blocks_per_hyperedge,
+      &_data[static_cast<size_t>(he) * _stride]);
+  }
+
 	void toggle(const HyperedgeID he, const PartitionID p) {
 	  ASSERT(p < _k);
 	  ASSERT(he < _num_hyperedges);
     const size_t div = p / BITS_PER_BLOCK, rem = p % BITS_PER_BLOCK;
-    const size_t idx = static_cast<size_t>(he) * _num_blocks_per_hyperedge + div;
-    ASSERT(idx < _bits.size());
-    __atomic_xor_fetch(&_bits[idx], UnsafeBlock(1) << rem, __ATOMIC_RELAXED);
+    const size_t idx = static_cast<size_t>(he) * _stride + div;
+    ASSERT(_bits.size() == 0 || idx < _bits.size());
+    __atomic_xor_fetch(&_data[idx], UnsafeBlock(1) << rem, __ATOMIC_RELAXED);
 	}
 
 	ENABLE_ASSERTIONS(PartitionID _k;)
 	ENABLE_ASSERTIONS(HyperedgeID _num_hyperedges;)
 	PartitionID _num_blocks_per_hyperedge;
+	// ! Number of blocks between the bitsets of consecutive hyperedges
+	size_t _stride;
+	// ! Points to _bits or to external memory
+	UnsafeBlock* _data;
 	Array<UnsafeBlock> _bits;
 
   // Bitsets to create shallow and deep copies of the connectivity set
@@ -141,22 +141,21 @@ void ContractionTree::finalize(const size_t num_versions) {
     tmp_version_roots[i].clear_parallel();
   });
 
-  // Compute subtree sizes of each root in parallel via dfs
-  tbb::parallel_for(UL(0), _roots.size(), [&](const size_t i) {
-    parallel::scalable_vector<HypernodeID> dfs;
-    dfs.push_back(_roots[i]);
-    while( !dfs.empty() ) {
-      const HypernodeID u = dfs.back();
-      if ( subtreeSize(u) == 0 ) {
-        // Visit u for the first time => push all childs on the dfs stack
-        for ( const HypernodeID& v : childs(u)) {
-          dfs.push_back(v);
+  // Compute subtree sizes bottom-up. After reversing the parent pointers,
+  // incidence_array_pos[u] is the number of childs of u, which we use as counter
+  // for the childs of u whose subtree size is not computed yet. Each leaf walks
+  // up the tree and the last child of a vertex continues with its parent. In
+  // contrast to a dfs from each root, this does not serialize on large subtrees.
+  tbb::parallel_for(ID(0), _num_hypernodes, [&](const HypernodeID hn) {
+    if ( incidence_array_pos[hn] == 0 ) {
+      HypernodeID u = hn;
+      node(u).setSubtreeSize(0);
+      while ( node(u).parent() != u ) {
+        u = node(u).parent();
+        if ( --incidence_array_pos[u] > 0 ) {
+          // Some childs of u are not finished yet
+          break;
         }
-        // Mark u as visited
-        node(u).setSubtreeSize(1);
-      } else {
-        // Visit u for second time => accumulate subtree sizes and pop u
-        dfs.pop_back();
         HypernodeID subtree_size = 0;
         for ( const HypernodeID& v : childs(u) ) {
           subtree_size += ( subtreeSize(v) + 1 );
@@ -295,6 +294,9 @@ using ChildIterator = typename ContractionTree::ChildIterator;
 struct PQBatchUncontractionElement {
   int64_t _objective;
   std::pair<ChildIterator, ChildIterator> _iterator;
+  // ! Smallest batch index to which the next uncontraction of the
+  // ! iterator can be assigned
+  size_t _min_batch_index;
 };
 
 struct PQElementComparator {
@@ -372,7 +374,7 @@ BatchVector ContractionTree::createBatchUncontractionHierarchyForVersion(BatchIn
             (i2.start <= i1.end && i2.end >= i1.end);
   };
 
-  auto push_into_pq = [&](PQ& prio_q, const HypernodeID& u) {
+  auto push_into_pq = [&](PQ& prio_q, const HypernodeID& u, const size_t min_batch_index) {
     auto it = childs(u);
     auto current = it.begin();
     auto end = it.end();
@@ -381,43 +383,100 @@ BatchVector ContractionTree::createBatchUncontractionHierarchyForVersion(BatchIn
     }
     if ( current != end ) {
       prio_q.push(PQBatchUncontractionElement {
-        subtreeSize(*current), std::make_pair(current, end) } );
+        subtreeSize(*current), std::make_pair(current, end), min_batch_index } );
     }
   };
 
+  // The priority queues of the current and next BFS level of each thread.
+  // Both are protected by a spin lock such that idle threads can steal
+  // subtrees from other threads.
+  struct LocalQueues {
+    SpinLock lock;
+    PQ pq;
+    PQ next_pq;
+  };
+
   // Distribute roots of the contraction tree to local priority queues of
   // each thread.
   const size_t num_hardware_threads = std::thread::hardware_concurrency();
-  parallel::scalable_vector<PQ> local_pqs(num_hardware_threads);
+  parallel::scalable_vector<LocalQueues> local_queues(num_hardware_threads);
   const parallel::scalable_vector<HypernodeID>& roots = roots_of_version(version);
   tbb::parallel_for(UL(0), roots.size(), [&](const size_t i) {
     const int cpu_id = THREAD_ID;
-    push_into_pq(local_pqs[cpu_id], roots[i]);
+    push_into_pq(local_queues[cpu_id].pq, roots[i], UL(0));
   });
 
   using LocalBatchAssignments = parallel::scalable_vector<BatchAssignment>;
   parallel::scalable_vector<LocalBatchAssignments> local_batch_assignments(num_hardware_threads);
   parallel::scalable_vector<size_t> local_batch_indices(num_hardware_threads, 0);
+
+  // Removes the next element from the local queues of a thread. If the current
+  // BFS level is exhausted, we proceed with the next level. Assumes that the
+  // lock of the local queues is held by the calling thread.
+  auto pop_local = [&](const size_t i, PQBatchUncontractionElement& elem) {
+    LocalQueues& local = local_queues[i];
+    if ( local.pq.empty() ) {
+      if ( local.next_pq.empty() ) {
+        return false;
+      }
+      std::swap(local.pq, local.next_pq);
+      // Compute minimum batch index to which a thread assigned last.
+      // Afterwards, transmit information to batch assigner to speed up
+      // batch index computation.
+      size_t& current_batch_index = local_batch_indices[i];
+      ++current_batch_index;
+      size_t min_batch_index = current_batch_index;
+      for ( const size_t& batch_index : local_batch_indices ) {
+        min_batch_index = std::min(min_batch_index, batch_index);
+      }
+      batch_assigner.increaseHighWaterMark(min_batch_index);
+    }
+    elem = local.pq.top();
+    local.pq.pop();
+    return true;
+  };
+
+  // Steals the largest subtree from the queues of an other thread. Since each
+  // element stores the smallest batch index to which it can be assigned, the
+  // stolen subtree can be processed independently of the BFS level of the thief.
+  auto steal = [&](const size_t i, PQBatchUncontractionElement& elem) {
+    for ( size_t j = 1; j < num_hardware_threads; ++j ) {
+      LocalQueues& victim = local_queues[(i + j) % num_hardware_threads];
+      victim.lock.lock();
+      PQ* victim_pq = !victim.pq.empty() ? &victim.pq :
+        ( !victim.next_pq.empty() ? &victim.next_pq : nullptr );
+      if ( victim_pq ) {
+        elem = victim_pq->top();
+        victim_pq->pop();
+      }
+      victim.lock.unlock();
+      if ( victim_pq ) {
+        return true;
+      }
+    }
+    return false;
+  };
+
   tbb::parallel_for(UL(0), num_hardware_threads, [&](const size_t i) {
     size_t& current_batch_index = local_batch_indices[i];
     LocalBatchAssignments& batch_assignments = local_batch_assignments[i];
-    PQ& pq = local_pqs[i];
-    PQ next_pq;
+    LocalQueues& local = local_queues[i];
 
-    while ( !pq.empty() ) {
+    PQBatchUncontractionElement elem;
+    local.lock.lock();
+    bool has_element = pop_local(i, elem);
+    local.lock.unlock();
+    while ( has_element || steal(i, elem) ) {
       // Iterator over the childs of a active vertex
-      auto it = pq.top()._iterator;
+      auto it = elem._iterator;
       ASSERT(it.first != it.second);
       const HypernodeID v = *it.first;
       ASSERT(this->version(v) == version);
-      pq.pop();
 
       const size_t start_idx = batch_assignments.size();
       size_t num_uncontractions = 1;
       const HypernodeID u = parent(v);
       batch_assignments.push_back(BatchAssignment { u, v, UL(0), UL(0) });
-      // Push contraction partner into pq for the next BFS level
-      push_into_pq(next_pq, v);
 
       // Insert all childs of u that intersect the contraction time interval of
       // (u,v) into the current batch
@@ -432,40 +491,35 @@ BatchVector ContractionTree::createBatchUncontractionHierarchyForVersion(BatchIn
           batch_assignments.push_back(BatchAssignment { u, w, UL(0), UL(0) });
           current_ival.start = std::min(current_ival.start, w_ival.start);
           current_ival.end = std::max(current_ival.end, w_ival.end);
-          push_into_pq(next_pq, w);
         } else {
           break;
         }
         ++it.first;
       }
 
-      // If there are still childs left of u, we push the iterator again into the
-      // priority queue of the current BFS level.
-      if ( it.first != it.second && this->version(*it.first) == version ) {
-        pq.push(PQBatchUncontractionElement { subtreeSize(*it.first), it });
-      }
-
       // Request batch index and its position within that batch
       BatchAssignment assignment = batch_assigner.getBatchIndex(
-        current_batch_index, num_uncontractions);
+        std::max(current_batch_index, elem._min_batch_index), num_uncontractions);
       for ( size_t j = start_idx; j < start_idx + num_uncontractions; ++j ) {
         batch_assignments[j].batch_index = assignment.batch_index;
         batch_assignments[j].batch_pos = assignment.batch_pos + (j - start_idx);
       }
       current_batch_index = assignment.batch_index;
 
-      if ( pq.empty() ) {
-        std::swap(pq, next_pq);
-        // Compute minimum batch index to which a thread assigned last.
-        // Afterwards, transmit information to batch assigner to speed up
-        // batch index computation.
-        ++current_batch_index;
-        size_t min_batch_index = current_batch_index;
-        for ( const size_t& batch_index : local_batch_indices ) {
-          min_batch_index = std::min(min_batch_index, batch_index);
-        }
-        batch_assigner.increaseHighWaterMark(min_batch_index);
+      local.lock.lock();
+      // Push contraction partners into pq for the next BFS level. Their
+      // uncontractions must be assigned to a later batch.
+      for ( size_t j = start_idx; j < start_idx + num_uncontractions; ++j ) {
+        push_into_pq(local.next_pq, batch_assignments[j].v, assignment.batch_index + 1);
       }
+      // If there are still childs left of u, we push the iterator again into the
+      // priority queue of the current BFS level.
+      if ( it.first != it.second && this->version(*it.first) == version ) {
+        local.pq.push(PQBatchUncontractionElement {
+          subtreeSize(*it.first), it, assignment.batch_index });
+      }
+      has_element = pop_local(i, elem);
+      local.lock.unlock();
     }
   });
 
@@ -500,5 +554,38 @@ BatchVector ContractionTree::createBatchUncontractionHierarchyForVersion(BatchIn
   return batches;
 }
 
+VersionedBatchVector ContractionTree::createBatchUncontractionHierarchy(const size_t batch_size) {
+  ASSERT(_finalized, "Information currently not available");
+  const size_t num_versions = _version_roots.size();
+
+  // Count the uncontractions of each version. The number of batches of a version is
+  // bounded by its number of uncontractions, since each batch index requested from
+  // the batch assigner is at most one larger than the largest non-empty batch.
+  tbb::enumerable_thread_specific<parallel::scalable_vector<HypernodeID>>
+    local_num_uncontractions(num_versions, 0);
+  tbb::parallel_for(ID(0), _num_hypernodes, [&](const HypernodeID u) {
+    if ( node(u).parent() != u ) {
+      ASSERT(version(u) < num_versions);
+      ++local_num_uncontractions.local()[version(u)];
+    }
+  });
+  parallel::scalable_vector<HypernodeID> num_uncontractions(num_versions, 0);
+  for ( const parallel::scalable_vector<HypernodeID>& local : local_num_uncontractions ) {
+    for ( size_t version = 0; version < num_versions; ++version ) {
+      num_uncontractions[version] += local[version];
+    }
+  }
+
+  // The uncontractions of different versions are independent of each other. Thus, each
+  // version uses its own batch assigner and the hierarchies are computed concurrently.
+  VersionedBatchVector versioned_batches(num_versions);
+  tbb::parallel_for(UL(0), num_versions, [&](const size_t version) {
+    BatchIndexAssigner batch_index_assigner(num_uncontractions[version] + 1, batch_size);
+    versioned_batches[version] =
+      createBatchUncontractionHierarchyForVersion(batch_index_assigner, version);
+  });
+  return versioned_batches;
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -177,12 +177,20 @@ class ContractionTree {
    * associated with that node.
    */
   class Node {
+
+    // ! Versions are stored with 32 bits, since their number is bounded by the
+    // ! number of times the n-level coarsener removes single-pin and parallel
+    // ! nets. This reduces the size of a tree node from 32 to 24 bytes.
+    using CompactVersion = uint32_t;
+    static constexpr CompactVersion kInvalidCompactVersion =
+      std::numeric_limits<CompactVersion>::max();
+
     public:
       Node() :
         _parent(0),
         _pending_contractions(0),
         _subtree_size(0),
-        _version(kInvalidVersion),
+        _version(kInvalidCompactVersion),
         _interval() { }
 
       inline HypernodeID parent() const {
@@ -214,11 +222,13 @@ class ContractionTree {
       }
 
       inline size_t version() const {
-        return _version;
+        return _version == kInvalidCompactVersion ? kInvalidVersion : _version;
       }
 
       inline void setVersion(const size_t version) {
-        _version = version;
+        ASSERT(version == kInvalidVersion || version < kInvalidCompactVersion);
+        _version = version == kInvalidVersion ? kInvalidCompactVersion :
+          static_cast<CompactVersion>(version);
       }
 
       inline Interval interval() const {
@@ -235,7 +245,7 @@ class ContractionTree {
         _parent = u;
         _pending_contractions = 0;
         _subtree_size = 0;
-        _version = kInvalidVersion;
+        _version = kInvalidCompactVersion;
         _interval.start = kInvalidHypernode;
         _interval.end = kInvalidHypernode;
       }
@@ -248,12 +258,13 @@ class ContractionTree {
       // ! Size of the subtree
       HypernodeID _subtree_size;
       // ! Version number of the hypergraph for which contract the corresponding vertex
-      size_t _version;
+      CompactVersion _version;
       // ! "Time" interval on which the contraction of this node takes place
       Interval _interval;
   };
 
   static_assert(std::is_trivially_copyable<Node>::value, "Node is not trivially copyable");
+  static_assert(sizeof(Node) == 6 * sizeof(HypernodeID), "Node is not tightly packed");
 
  public:
   // ! Iterator to iterate over the childs of a tree node
@@ -481,6 +492,10 @@ class ContractionTree {
   BatchVector createBatchUncontractionHierarchyForVersion(BatchIndexAssigner& batch_assigner,
                                                           const size_t version);
 
+  // ! Computes the batch uncontraction hierarchies of all versions in parallel.
+  // ! Requires that the contraction tree is finalized.
+  VersionedBatchVector createBatchUncontractionHierarchy(const size_t batch_size);
+
   // ! Only for testing
   void setParent(const HypernodeID u, const HypernodeID v, const size_t version = 0) {
     node(u).setParent(v);
@@ -219,13 +219,8 @@ public:
     ds::StaticBitset& connectivity_set = _connectivity_set->shallowCopy(he);
     const size_t* entry = _touched_hes.get_if_contained(he);
     if ( entry ) {
-      PartitionID connectivity = 0;
-      const UnsafeBlock* original_data = connectivity_set.data();
-      const UnsafeBlock* delta_data = &_delta_connectivity_set[*entry];
-      for ( size_t i = 0; i < _num_blocks_per_hyperedge; ++i ) {
-        connectivity += utils::popcount_64( *(original_data + i) ^ *(delta_data + i) );
-      }
-      return connectivity;
+      return utils::xor_popcount_blocks(connectivity_set.data(),
+        &_delta_connectivity_set[*entry], _num_blocks_per_hyperedge);
     } else {
       return connectivity_set.popcount();
     }
@@ -40,6 +40,7 @@ IncidentEdgeIterator::IncidentEdgeIterator(const HypernodeID u,
     _u(u),
     _current_u(u),
     _current_size(dynamic_adjacency_array->header(u).size()),
+    _current_first_active(dynamic_adjacency_array->firstActiveEdge(u)),
     _current_pos(pos),
     _dynamic_adjacency_array(dynamic_adjacency_array),
     _end(end) {
@@ -52,7 +53,7 @@ IncidentEdgeIterator::IncidentEdgeIterator(const HypernodeID u,
 }
 
 HyperedgeID IncidentEdgeIterator::operator* () const {
-  return _dynamic_adjacency_array->firstActiveEdge(_current_u) + _current_pos;
+  return _current_first_active + _current_pos;
 }
 
 IncidentEdgeIterator & IncidentEdgeIterator::operator++ () {
@@ -76,14 +77,15 @@ void IncidentEdgeIterator::traverse_headers() {
     const HypernodeID last_u = _current_u;
     _current_u = _dynamic_adjacency_array->header(last_u).it_next;
     _current_pos -= _current_size;
-    _current_size = _dynamic_adjacency_array->header(_current_u).size();
+    const auto& current_header = _dynamic_adjacency_array->header(_current_u);
+    _current_size = current_header.size();
+    _current_first_active = current_header.first_active;
     // It can happen that due to a contraction the current vertex
     // we iterate over becomes empty or the head of the current vertex
     // changes. Therefore, we set the end flag if we reach the current
     // head of the list or it_next is equal with the current vertex (means
     // that list becomes empty due to a contraction)
-    if ( _dynamic_adjacency_array->header(_current_u).is_head ||
-         last_u == _current_u ) {
+    if ( current_header.is_head || last_u == _current_u ) {
       _end = true;
       break;
     }
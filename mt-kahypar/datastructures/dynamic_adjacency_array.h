@@ -84,6 +84,9 @@ class IncidentEdgeIterator {
   HypernodeID _u;
   HypernodeID _current_u;
   HypernodeID _current_size;
+  // ! First active edge of the current incident edge list, cached such that
+  // ! dereferencing the iterator does not touch the header array
+  HyperedgeID _current_first_active;
   HyperedgeID _current_pos;
   const DynamicAdjacencyArray* _dynamic_adjacency_array;
   bool _end;
@@ -260,20 +260,7 @@ VersionedBatchVector DynamicGraph::createBatchUncontractionHierarchy(const size_
   // and contains subtree size for each  tree node
   _contraction_tree.finalize(num_versions);
 
-  VersionedBatchVector versioned_batches(num_versions);
-  parallel::scalable_vector<size_t> batch_sizes_prefix_sum(num_versions, 0);
-  BatchIndexAssigner batch_index_assigner(numNodes(), batch_size);
-  for ( size_t version = 0; version < num_versions; ++version ) {
-    versioned_batches[version] =
-      _contraction_tree.createBatchUncontractionHierarchyForVersion(batch_index_assigner, version);
-    if ( version > 0 ) {
-      batch_sizes_prefix_sum[version] =
-        batch_sizes_prefix_sum[version - 1] + versioned_batches[version - 1].size();
-    }
-    batch_index_assigner.reset(versioned_batches[version].size());
-  }
-
-  return versioned_batches;
+  return _contraction_tree.createBatchUncontractionHierarchy(batch_size);
 }
 
 /**
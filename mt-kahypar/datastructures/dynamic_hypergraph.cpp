@@ -33,6 +33,7 @@
 #include <tbb/parallel_reduce.h>
 #include <tbb/concurrent_queue.h>
 
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/parallel/stl/scalable_queue.h"
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
 #include "mt-kahypar/datastructures/streaming_vector.h"
@@ -41,6 +42,47 @@
 namespace mt_kahypar {
 namespace ds {
 
+namespace {
+// ! Replaces active_ids by the IDs of the current iteration domain (active_ids or [0, num_ids))
+// ! that are enabled, if the ratio of disabled IDs in the domain exceeds max_ratio_of_disabled_ids
+template<typename ID_T, typename F>
+void collectEnabledIDs(parallel::scalable_vector<ID_T>& active_ids,
+                       bool& has_active_ids,
+                       const ID_T num_ids,
+                       const double max_ratio_of_disabled_ids,
+                       const F& is_enabled) {
+  const size_t domain_size = has_active_ids ? active_ids.size() : num_ids;
+  auto id_at = [&](const size_t i) {
+    return has_active_ids ? active_ids[i] : static_cast<ID_T>(i);
+  };
+  const size_t num_enabled = tbb::parallel_reduce(
+    tbb::blocked_range<size_t>(UL(0), domain_size), UL(0),
+    [&](const tbb::blocked_range<size_t>& range, size_t count) {
+      for ( size_t i = range.begin(); i < range.end(); ++i ) {
+        count += is_enabled(id_at(i)) ? 1 : 0;
+      }
+      return count;
+    }, std::plus<>());
+
+  if ( domain_size - num_enabled > max_ratio_of_disabled_ids * domain_size ) {
+    parallel::scalable_vector<size_t> prefix_sum(domain_size, 0);
+    tbb::parallel_for(UL(0), domain_size, [&](const size_t i) {
+      prefix_sum[i] = is_enabled(id_at(i)) ? 1 : 0;
+    });
+    parallel_prefix_sum(prefix_sum.begin(), prefix_sum.end(), prefix_sum.begin(), std::plus<>(), UL(0));
+    parallel::scalable_vector<ID_T> enabled_ids(num_enabled);
+    tbb::parallel_for(UL(0), domain_size, [&](const size_t i) {
+      const ID_T id = id_at(i);
+      if ( is_enabled(id) ) {
+        enabled_ids[prefix_sum[i] - 1] = id;
+      }
+    });
+    active_ids = std::move(enabled_ids);
+    has_active_ids = true;
+  }
+}
+} // namespace
+
 // ! Recomputes the total weight of the hypergraph (parallel)
 void DynamicHypergraph::updateTotalWeight(parallel_tag_t) {
   _total_weight = tbb::parallel_reduce(tbb::blocked_range<HypernodeID>(ID(0), _num_hypernodes), 0,
@@ -120,6 +162,9 @@ void DynamicHypergraph::uncontract(const Batch& batch,
                                    const UncontractionFunction& case_one_func,
                                    const UncontractionFunction& case_two_func) {
   ASSERT(batch.size() > UL(0));
+  // Uncontraction enables hypernodes and restores hyperedges of size one
+  _has_active_hypernodes = false;
+  _has_active_hyperedges = false;
   ASSERT([&] {
     const HypernodeID expected_batch_index = hypernode(batch[0].v).batchIndex();
     for ( const Memento& memento : batch ) {
@@ -203,18 +248,12 @@ VersionedBatchVector DynamicHypergraph::createBatchUncontractionHierarchy(const
   // and contains subtree size for each  tree node
   _contraction_tree.finalize(num_versions);
 
-  VersionedBatchVector versioned_batches(num_versions);
+  VersionedBatchVector versioned_batches =
+    _contraction_tree.createBatchUncontractionHierarchy(batch_size);
   parallel::scalable_vector<size_t> batch_sizes_prefix_sum(num_versions, 0);
-  BatchIndexAssigner batch_index_assigner(_num_hypernodes, batch_size);
-  for ( size_t version = 0; version < num_versions; ++version ) {
-    versioned_batches[version] =
-      createBatchUncontractionHierarchyForVersion(
-        batch_index_assigner, version);
-    if ( version > 0 ) {
-      batch_sizes_prefix_sum[version] =
-        batch_sizes_prefix_sum[version - 1] + versioned_batches[version - 1].size();
-    }
-    batch_index_assigner.reset(versioned_batches[version].size());
+  for ( size_t version = 1; version < num_versions; ++version ) {
+    batch_sizes_prefix_sum[version] =
+      batch_sizes_prefix_sum[version - 1] + versioned_batches[version - 1].size();
   }
 
   if ( !test ) {
@@ -267,7 +306,7 @@ parallel::scalable_vector<DynamicHypergraph::ParallelHyperedge> DynamicHypergrap
       const size_t footprint = e.hash();
       std::sort(_incidence_array.begin() + e.firstEntry(),
                 _incidence_array.begin() + e.firstInvalidEntry());
-      hyperedge_hash_map.insert(footprint,
+      hyperedge_hash_map.insertWithHashedKey(footprint,
         ContractedHyperedgeInformation { he, footprint, edge_size, true });
     } else {
       hyperedge(he).disable();
@@ -305,12 +344,12 @@ parallel::scalable_vector<DynamicHypergraph::ParallelHyperedge> DynamicHypergrap
   // hyperedges are detected by comparing the pins of hyperedges with
   // the same hash.
   tbb::parallel_for(UL(0), hyperedge_hash_map.numBuckets(), [&](const size_t bucket) {
-    auto& hyperedge_bucket = hyperedge_hash_map.getBucket(bucket);
-    std::sort(hyperedge_bucket.begin(), hyperedge_bucket.end(),
+    hyperedge_hash_map.sortBucket(bucket,
       [&](const ContractedHyperedgeInformation& lhs, const ContractedHyperedgeInformation& rhs) {
         return lhs.hash < rhs.hash || (lhs.hash == rhs.hash && lhs.size < rhs.size)||
           (lhs.hash == rhs.hash && lhs.size == rhs.size && lhs.he < rhs.he);
       });
+    auto& hyperedge_bucket = hyperedge_hash_map.getBucket(bucket);
 
     // Parallel Hyperedge Detection
     for ( size_t i = 0; i < hyperedge_bucket.size(); ++i ) {
@@ -349,6 +388,7 @@ parallel::scalable_vector<DynamicHypergraph::ParallelHyperedge> DynamicHypergrap
 
   parallel::scalable_vector<ParallelHyperedge> removed_hyperedges = tmp_removed_hyperedges.copy_parallel();
   tmp_removed_hyperedges.clear_parallel();
+  compactActiveElements();
 
   ++_version;
   return removed_hyperedges;
@@ -359,6 +399,7 @@ parallel::scalable_vector<DynamicHypergraph::ParallelHyperedge> DynamicHypergrap
  * must be exactly the same and given in the reverse order as returned by removeSinglePinAndParallelNets(...).
  */
 void DynamicHypergraph::restoreSinglePinAndParallelNets(const parallel::scalable_vector<ParallelHyperedge>& hes_to_restore) {
+  _has_active_hyperedges = false;
   // Restores all previously removed hyperedges
   tbb::parallel_for(UL(0), hes_to_restore.size(), [&](const size_t i) {
     const ParallelHyperedge& parallel_he = hes_to_restore[i];
@@ -382,6 +423,16 @@ void DynamicHypergraph::restoreSinglePinAndParallelNets(const parallel::scalable
   --_version;
 }
 
+void DynamicHypergraph::compactActiveElements() {
+  tbb::parallel_invoke([&] {
+    collectEnabledIDs(_active_hypernodes, _has_active_hypernodes, _num_hypernodes,
+      MAX_RATIO_OF_DISABLED_IDS, [&](const HypernodeID hn) { return nodeIsEnabled(hn); });
+  }, [&] {
+    collectEnabledIDs(_active_hyperedges, _has_active_hyperedges, _num_hyperedges,
+      MAX_RATIO_OF_DISABLED_IDS, [&](const HyperedgeID he) { return edgeIsEnabled(he); });
+  });
+}
+
 // ! Copy dynamic hypergraph in parallel
 DynamicHypergraph DynamicHypergraph::copy(parallel_tag_t) const {
   DynamicHypergraph hypergraph;
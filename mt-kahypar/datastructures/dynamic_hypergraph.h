@@ -60,6 +60,9 @@ class DynamicHypergraph {
 
   static constexpr bool debug = false;
   static constexpr bool enable_heavy_assert = false;
+  // ! Parallel iteration over nodes (edges) is restricted to the enabled IDs once the
+  // ! ratio of disabled IDs in the current iteration domain exceeds this threshold
+  static constexpr double MAX_RATIO_OF_DISABLED_IDS = 0.5;
 
   static_assert(std::is_unsigned<HypernodeID>::value, "Hypernode ID must be unsigned");
   static_assert(std::is_unsigned<HyperedgeID>::value, "Hyperedge ID must be unsigned");
@@ -432,6 +435,10 @@ class DynamicHypergraph {
     _failed_hyperedge_contractions(),
     _he_bitset(),
     _removable_single_pin_and_parallel_nets(),
+    _active_hypernodes(),
+    _active_hyperedges(),
+    _has_active_hypernodes(false),
+    _has_active_hyperedges(false),
     _fixed_vertices() { }
 
   DynamicHypergraph(const DynamicHypergraph&) = delete;
@@ -460,6 +467,10 @@ class DynamicHypergraph {
     _failed_hyperedge_contractions(std::move(other._failed_hyperedge_contractions)),
     _he_bitset(std::move(other._he_bitset)),
     _removable_single_pin_and_parallel_nets(std::move(other._removable_single_pin_and_parallel_nets)),
+    _active_hypernodes(std::move(other._active_hypernodes)),
+    _active_hyperedges(std::move(other._active_hyperedges)),
+    _has_active_hypernodes(other._has_active_hypernodes),
+    _has_active_hyperedges(other._has_active_hyperedges),
     _fixed_vertices(std::move(other._fixed_vertices)) {
     _fixed_vertices.setHypergraph(this);
   }
@@ -487,6 +498,10 @@ class DynamicHypergraph {
     _failed_hyperedge_contractions = std::move(other._failed_hyperedge_contractions);
     _he_bitset = std::move(other._he_bitset);
     _removable_single_pin_and_parallel_nets = std::move(other._removable_single_pin_and_parallel_nets);
+    _active_hypernodes = std::move(other._active_hypernodes);
+    _active_hyperedges = std::move(other._active_hyperedges);
+    _has_active_hypernodes = other._has_active_hypernodes;
+    _has_active_hyperedges = other._has_active_hyperedges;
     _fixed_vertices = std::move(other._fixed_vertices);
     _fixed_vertices.setHypergraph(this);
     return *this;
@@ -562,11 +577,20 @@ class DynamicHypergraph {
   // ! for each vertex
   template<typename F>
   void doParallelForAllNodes(const F& f) const {
-    tbb::parallel_for(ID(0), _num_hypernodes, [&](const HypernodeID& hn) {
-      if ( nodeIsEnabled(hn) ) {
-        f(hn);
-      }
-    });
+    if ( _has_active_hypernodes ) {
+      tbb::parallel_for(UL(0), _active_hypernodes.size(), [&](const size_t i) {
+        const HypernodeID hn = _active_hypernodes[i];
+        if ( nodeIsEnabled(hn) ) {
+          f(hn);
+        }
+      });
+    } else {
+      tbb::parallel_for(ID(0), _num_hypernodes, [&](const HypernodeID& hn) {
+        if ( nodeIsEnabled(hn) ) {
+          f(hn);
+        }
+      });
+    }
   }
 
   // ! Iterates in parallel over all active edges and calls function f
@@ -580,11 +604,20 @@ class DynamicHypergraph {
   // ! for each net
   template<typename F>
   void doParallelForAllEdges(const F& f) const {
-    tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
-      if ( edgeIsEnabled(he) ) {
-        f(he);
-      }
-    });
+    if ( _has_active_hyperedges ) {
+      tbb::parallel_for(UL(0), _active_hyperedges.size(), [&](const size_t i) {
+        const HyperedgeID he = _active_hyperedges[i];
+        if ( edgeIsEnabled(he) ) {
+          f(he);
+        }
+      });
+    } else {
+      tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
+        if ( edgeIsEnabled(he) ) {
+          f(he);
+        }
+      });
+    }
   }
 
   // ! Returns a range of the active nodes of the hypergraph
@@ -644,6 +677,7 @@ class DynamicHypergraph {
   // ! Enables a hypernode (must be disabled before)
   void enableHypernode(const HypernodeID u) {
     hypernode(u).enable();
+    _has_active_hypernodes = false;
   }
 
   // ! Disables a hypernode (must be enabled before)
@@ -667,6 +701,7 @@ class DynamicHypergraph {
   // ! Restores a degree zero hypernode
   void restoreDegreeZeroHypernode(const HypernodeID u) {
     hypernode(u).enable();
+    _has_active_hypernodes = false;
     ASSERT(nodeDegree(u) == 0);
     _removed_degree_zero_hn_weight -= nodeWeight(u);
   }
@@ -710,6 +745,7 @@ class DynamicHypergraph {
   // ! Enables a hyperedge (must be disabled before)
   void enableHyperedge(const HyperedgeID e) {
     hyperedge(e).enable();
+    _has_active_hyperedges = false;
   }
 
   // ! Disabled a hyperedge (must be enabled before)
@@ -919,6 +955,17 @@ class DynamicHypergraph {
    */
   void restoreSinglePinAndParallelNets(const parallel::scalable_vector<ParallelHyperedge>& hes_to_restore);
 
+  /*!
+   * Nodes and edges are only disabled while we contract the hypergraph. Thus, a list of the
+   * enabled IDs remains a superset of the enabled IDs until we enable an element again.
+   * If the ratio of disabled IDs in the current iteration domain exceeds MAX_RATIO_OF_DISABLED_IDS,
+   * this function collects the enabled IDs such that doParallelForAllNodes(...) and
+   * doParallelForAllEdges(...) no longer scan the disabled ones. The incident net and pin lists
+   * are not touched, since they already keep their active entries in a contiguous prefix.
+   * Must be called at a safe point between two contraction batches.
+   */
+  void compactActiveElements();
+
   // ####################### Initialization / Reset Functions #######################
 
   // ! Reset internal community information
@@ -943,6 +990,8 @@ class DynamicHypergraph {
     _contraction_tree.reset();
     _incident_nets.reset();
     _version = 0;
+    _has_active_hypernodes = false;
+    _has_active_hyperedges = false;
   }
 
   // ! Free internal data in parallel
@@ -1159,6 +1208,12 @@ class DynamicHypergraph {
   ThreadLocalBitset _he_bitset;
   // ! Single-pin and parallel nets are marked within that vector during the algorithm
   kahypar::ds::FastResetFlagArray<> _removable_single_pin_and_parallel_nets;
+  // ! Superset of the enabled hypernodes (only valid if _has_active_hypernodes is true)
+  parallel::scalable_vector<HypernodeID> _active_hypernodes;
+  // ! Superset of the enabled hyperedges (only valid if _has_active_hyperedges is true)
+  parallel::scalable_vector<HyperedgeID> _active_hyperedges;
+  bool _has_active_hypernodes;
+  bool _has_active_hyperedges;
 
   // ! Fixed Vertex Support
   FixedVertexSupport<DynamicHypergraph> _fixed_vertices;
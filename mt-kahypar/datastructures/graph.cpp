@@ -32,8 +32,10 @@
 #include <tbb/parallel_reduce.h>
 #include <tbb/parallel_invoke.h>
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_arena.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/bipartite_graph_view.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/timer.h"
@@ -51,7 +53,8 @@ namespace mt_kahypar::ds {
     _indices(),
     _arcs(),
     _node_volumes(),
-    _tmp_graph_buffer(nullptr) {
+    _tmp_graph_buffer(nullptr),
+    _low_memory_buffer(nullptr) {
 
     switch( edge_weight_type ) {
       case LouvainEdgeWeight::uniform:
@@ -96,12 +99,14 @@ namespace mt_kahypar::ds {
     _indices(std::move(other._indices)),
     _arcs(std::move(other._arcs)),
     _node_volumes(std::move(other._node_volumes)),
-    _tmp_graph_buffer(other._tmp_graph_buffer) {
+    _tmp_graph_buffer(other._tmp_graph_buffer),
+    _low_memory_buffer(other._low_memory_buffer) {
     other._num_nodes = 0;
     other._num_arcs = 0;
     other._total_volume = 0;
     other._max_degree = 0;
     other._tmp_graph_buffer = nullptr;
+    other._low_memory_buffer = nullptr;
   }
 
   template<typename Hypergraph>
@@ -114,11 +119,13 @@ namespace mt_kahypar::ds {
     _arcs = std::move(other._arcs);
     _node_volumes = std::move(other._node_volumes);
     _tmp_graph_buffer = std::move(other._tmp_graph_buffer);
+    _low_memory_buffer = other._low_memory_buffer;
     other._num_nodes = 0;
     other._num_arcs = 0;
     other._total_volume = 0;
     other._max_degree = 0;
     other._tmp_graph_buffer = nullptr;
+    other._low_memory_buffer = nullptr;
     return *this;
   }
 
@@ -127,37 +134,71 @@ namespace mt_kahypar::ds {
     if ( _tmp_graph_buffer ) {
       delete(_tmp_graph_buffer);
     }
+    if ( _low_memory_buffer ) {
+      delete(_low_memory_buffer);
+    }
   }
 
   template<typename Hypergraph>
   Graph<Hypergraph> Graph<Hypergraph>::contract_low_memory(Clustering& communities) {
+    LowMemoryContractionBuffer* buffer = _low_memory_buffer;
+    _low_memory_buffer = nullptr;
+    return contract_low_memory(*this, communities, nullptr, buffer);
+  }
+
+  template<typename Hypergraph>
+  Graph<Hypergraph> Graph<Hypergraph>::contract_low_memory(Clustering& communities, Graph& recycled_graph) {
+    ASSERT(&recycled_graph != this);
+    LowMemoryContractionBuffer* buffer = _low_memory_buffer;
+    _low_memory_buffer = nullptr;
+    return contract_low_memory(*this, communities, &recycled_graph, buffer);
+  }
+
+  template<typename Hypergraph>
+  template<typename GraphView>
+  Graph<Hypergraph> Graph<Hypergraph>::contract_low_memory(const GraphView& graph, Clustering& communities) {
+    return contract_low_memory(graph, communities, nullptr, nullptr);
+  }
+
+  template<typename Hypergraph>
+  template<typename GraphView>
+  Graph<Hypergraph> Graph<Hypergraph>::contract_low_memory(const GraphView& graph,
+                                                           Clustering& communities,
+                                                           Graph* recycled_graph,
+                                                           LowMemoryContractionBuffer* buffer) {
     // map cluster IDs to consecutive range
-    vec<NodeID> mapping(numNodes(), 0);   // TODO use memory pool?
-    tbb::parallel_for(UL(0), numNodes(), [&](NodeID u) { mapping[communities[u]] = 1; });
-    parallel_prefix_sum(mapping.begin(), mapping.begin() + numNodes(), mapping.begin(), std::plus<>(), 0);
-    NodeID num_coarse_nodes = mapping[numNodes() - 1];
+    vec<NodeID> mapping = buffer ? std::move(buffer->mapping) : vec<NodeID>();
+    if ( mapping.size() < graph.numNodes() ) {
+      mapping.resize(graph.numNodes());
+    }
+    tbb::parallel_for(UL(0), graph.numNodes(), [&](NodeID u) { mapping[u] = 0; });
+    tbb::parallel_for(UL(0), graph.numNodes(), [&](NodeID u) { mapping[communities[u]] = 1; });
+    parallel_prefix_sum(mapping.begin(), mapping.begin() + graph.numNodes(), mapping.begin(), std::plus<>(), 0);
+    NodeID num_coarse_nodes = mapping[graph.numNodes() - 1];
     // apply mapping to cluster IDs. subtract one because prefix sum is inclusive
-    tbb::parallel_for(UL(0), numNodes(), [&](NodeID u) { communities[u] = mapping[communities[u]] - 1; });
+    tbb::parallel_for(UL(0), graph.numNodes(), [&](NodeID u) { communities[u] = mapping[communities[u]] - 1; });
 
     // sort nodes by cluster
     auto get_cluster = [&](NodeID u) { assert(u < communities.size()); return communities[u]; };
     vec<NodeID> nodes_sorted_by_cluster(std::move(mapping));    // reuse memory from mapping since it's no longer needed
-    auto cluster_bounds = parallel::counting_sort(nodes(), nodes_sorted_by_cluster, num_coarse_nodes,
-                                                  get_cluster, TBBInitializer::instance().total_number_of_threads());
+    auto cluster_bounds = parallel::counting_sort(graph.nodes(), nodes_sorted_by_cluster, num_coarse_nodes,
+                                                  get_cluster, tbb::this_task_arena::max_concurrency());
 
     Graph coarse_graph;
     coarse_graph._num_nodes = num_coarse_nodes;
-    coarse_graph._indices.resize(num_coarse_nodes + 1);
-    coarse_graph._node_volumes.resize(num_coarse_nodes);
-    coarse_graph._total_volume = totalVolume();
-
-    struct ClearList {
-      vec<NodeID> used;
-      vec<ArcWeight> values;
-
-      ClearList(size_t n) : values(n, 0.0) { }
-    };
-    tbb::enumerable_thread_specific<ClearList> clear_lists(num_coarse_nodes);
+    reuseOrAllocate(coarse_graph._indices, recycled_graph ? &recycled_graph->_indices : nullptr, num_coarse_nodes + 1);
+    reuseOrAllocate(coarse_graph._node_volumes, recycled_graph ? &recycled_graph->_node_volumes : nullptr, num_coarse_nodes);
+    coarse_graph._indices[0] = 0;
+    coarse_graph._total_volume = graph.totalVolume();
+
+    // The clear lists are only reset to zero after each use. Thus, they can be reused
+    // on all levels as the number of coarse nodes decreases.
+    if ( !buffer ) {
+      buffer = new LowMemoryContractionBuffer(num_coarse_nodes);
+    }
+    ASSERT(num_coarse_nodes <= buffer->max_num_coarse_nodes);
+    coarse_graph._low_memory_buffer = buffer;
+    auto& clear_lists = buffer->clear_lists;
     tbb::enumerable_thread_specific<size_t> local_max_degree(0);
 
     // first pass generating unique coarse arcs to determine coarse node degrees
@@ -166,8 +207,8 @@ namespace mt_kahypar::ds {
       ArcWeight volume_cu = 0.0;
       for (auto i = cluster_bounds[cu]; i < cluster_bounds[cu + 1]; ++i) {
         NodeID fu = nodes_sorted_by_cluster[i];
-        volume_cu += nodeVolume(fu);
-        for (const Arc& arc : arcsOf(fu)) {
+        volume_cu += graph.nodeVolume(fu);
+        for (const Arc& arc : graph.arcsOf(fu)) {
           NodeID cv = get_cluster(arc.head);
           if (cv != cu && clear_list.values[cv] == 0.0) {
             clear_list.used.push_back(cv);
@@ -185,9 +226,10 @@ namespace mt_kahypar::ds {
     });
 
     // prefix sum coarse node degrees for offsets to write the coarse arcs in second pass
-    parallel_prefix_sum(coarse_graph._indices.begin(), coarse_graph._indices.end(), coarse_graph._indices.begin(), std::plus<>(), UL(0));
-    size_t num_coarse_arcs = coarse_graph._indices.back();
-    coarse_graph._arcs.resize(num_coarse_arcs);
+    parallel_prefix_sum(coarse_graph._indices.begin(), coarse_graph._indices.begin() + num_coarse_nodes + 1,
+                        coarse_graph._indices.begin(), std::plus<>(), UL(0));
+    size_t num_coarse_arcs = coarse_graph._indices[num_coarse_nodes];
+    reuseOrAllocate(coarse_graph._arcs, recycled_graph ? &recycled_graph->_arcs : nullptr, num_coarse_arcs);
     coarse_graph._num_arcs = num_coarse_arcs;
     coarse_graph._max_degree = local_max_degree.combine([](size_t lhs, size_t rhs) { return std::max(lhs, rhs); });
 
@@ -195,7 +237,7 @@ namespace mt_kahypar::ds {
     tbb::parallel_for(ID(0), num_coarse_nodes, [&](NodeID cu) {
       auto& clear_list = clear_lists.local();
       for (auto i = cluster_bounds[cu]; i < cluster_bounds[cu+1]; ++i) {
-        for (const Arc& arc : arcsOf(nodes_sorted_by_cluster[i])) {
+        for (const Arc& arc : graph.arcsOf(nodes_sorted_by_cluster[i])) {
           NodeID cv = get_cluster(arc.head);
           if (cv != cu) {
             if (clear_list.values[cv] == 0.0) {
@@ -213,6 +255,7 @@ namespace mt_kahypar::ds {
       clear_list.used.clear();
     });
 
+    buffer->mapping = std::move(nodes_sorted_by_cluster);
     return coarse_graph;
   }
 
@@ -376,7 +419,8 @@ namespace mt_kahypar::ds {
     _indices(),
     _arcs(),
     _node_volumes(),
-    _tmp_graph_buffer(nullptr) { }
+    _tmp_graph_buffer(nullptr),
+    _low_memory_buffer(nullptr) { }
 
   /*!
    * Constructs a graph from a given hypergraph.
@@ -535,4 +579,7 @@ namespace mt_kahypar::ds {
 
   INSTANTIATE_CLASS_WITH_HYPERGRAPHS(Graph)
 
+  template Graph<StaticHypergraph> Graph<StaticHypergraph>::contract_low_memory(
+    const BipartiteGraphView<StaticHypergraph>&, Clustering&);
+
 } // namespace mt_kahypar::ds
\ No newline at end of file
@@ -31,6 +31,8 @@
 #include <cmath>
 #include <boost/range/irange.hpp>
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
@@ -65,6 +67,26 @@ class Graph {
     ds::Array<size_t> valid_arcs;
   };
 
+  // ! Scratch memory of the low memory contraction. It is allocated for the first
+  // ! contraction and then handed down to the coarser graphs.
+  struct LowMemoryContractionBuffer {
+    struct ClearList {
+      vec<NodeID> used;
+      vec<ArcWeight> values;
+
+      ClearList(size_t n) : values(n, 0.0) { }
+    };
+
+    explicit LowMemoryContractionBuffer(const size_t num_coarse_nodes) :
+      max_num_coarse_nodes(num_coarse_nodes),
+      mapping(),
+      clear_lists(num_coarse_nodes) { }
+
+    const size_t max_num_coarse_nodes;
+    vec<NodeID> mapping;
+    tbb::enumerable_thread_specific<ClearList> clear_lists;
+  };
+
  public:
   using AdjacenceIterator = typename ds::Array<Arc>::const_iterator;
 
@@ -144,6 +166,18 @@ class Graph {
 
   Graph contract_low_memory(Clustering& communities);
 
+  // ! Contracts a graph based on the community structure passed as argument without
+  // ! using additional buffers. The graph must provide the same interface as this class, but
+  // ! can also be an implicit representation of a graph (e.g., a BipartiteGraphView).
+  template<typename GraphView>
+  static Graph contract_low_memory(const GraphView& graph, Clustering& communities);
+
+  // ! Same as contract_low_memory(communities), but the coarse graph is written into the
+  // ! arrays of recycled_graph, which must not be used afterwards. A coarse graph is never
+  // ! larger than the graph one level above it. Thus, the louvain method can alternate between
+  // ! the memory of two graphs and only allocates the arrays of the first two levels.
+  Graph contract_low_memory(Clustering& communities, Graph& recycled_graph);
+
   void allocateContractionBuffers() {
     _tmp_graph_buffer = new TmpGraphBuffer(_num_nodes, _num_arcs);
   }
@@ -164,6 +198,22 @@ class Graph {
   void constructGraph(const Hypergraph& hypergraph,
                       const F& edge_weight_func);
 
+  template<typename GraphView>
+  static Graph contract_low_memory(const GraphView& graph,
+                                   Clustering& communities,
+                                   Graph* recycled_graph,
+                                   LowMemoryContractionBuffer* buffer);
+
+  // ! Takes over the array of the recycled graph, if it is large enough
+  template<typename T>
+  static void reuseOrAllocate(ds::Array<T>& array, ds::Array<T>* recycled, const size_t size) {
+    if ( recycled && recycled->size() >= size ) {
+      array = std::move(*recycled);
+    } else {
+      array.resize(size);
+    }
+  }
+
   ArcWeight computeNodeVolume(const NodeID u) {
     ASSERT(u < _num_nodes);
     ArcWeight x = 0.0;
@@ -192,6 +242,8 @@ class Graph {
   // ! Data that is reused throughout the louvain method
   // ! to construct and contract a graph and to prevent expensive allocations
   TmpGraphBuffer* _tmp_graph_buffer;
+  // ! Scratch memory that is reused on all levels of the low memory contraction
+  LowMemoryContractionBuffer* _low_memory_buffer;
 };
 
 }  // namespace ds
@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Addressable bucket priority queue with one queue for each block. It supports the
+ * same operations as the k-way priority queue of KaHyPar used by the greedy initial
+ * partitioners, but requires that all keys are in the range [-max_key, max_key].
+ * Each queue stores its elements in doubly-linked bucket lists, such that all operations
+ * except for deleteMax(...) run in constant time. The maximum bucket of a queue is tracked
+ * lazily and decreased in deleteMax(...) until a non-empty bucket is found. Elements with
+ * the same key are extracted in LIFO order.
+ *
+ * A queue is either enabled or disabled. Only enabled queues are considered in deleteMax(...).
+ * Inserting into a queue does not enable it and a queue becomes disabled once it is empty.
+ */
+class KWayBucketPriorityQueue {
+
+  static constexpr HypernodeID INVALID = std::numeric_limits<HypernodeID>::max();
+
+ public:
+  explicit KWayBucketPriorityQueue(const PartitionID k) :
+    _k(k),
+    _num_elements(0),
+    _max_key(0),
+    _num_buckets(1),
+    _num_non_empty_parts(0),
+    _num_enabled_parts(0),
+    _size(k, 0),
+    _enabled(k, false),
+    _max_bucket(k, 0),
+    _buckets(),
+    _next(),
+    _prev(),
+    _keys(),
+    _contained() { }
+
+  KWayBucketPriorityQueue(const KWayBucketPriorityQueue&) = delete;
+  KWayBucketPriorityQueue & operator= (const KWayBucketPriorityQueue &) = delete;
+
+  KWayBucketPriorityQueue(KWayBucketPriorityQueue&&) = default;
+  KWayBucketPriorityQueue & operator= (KWayBucketPriorityQueue &&) = default;
+
+  // ! Allocates the queues for the elements [0, num_elements) with keys in [-max_key, max_key]
+  void initialize(const HypernodeID num_elements, const Gain max_key) {
+    ASSERT(max_key >= 0);
+    _num_elements = num_elements;
+    _max_key = max_key;
+    _num_buckets = 2 * static_cast<size_t>(max_key) + 1;
+    _buckets.assign(_k * _num_buckets, INVALID);
+    _next.assign(_k * static_cast<size_t>(num_elements), INVALID);
+    _prev.assign(_k * static_cast<size_t>(num_elements), INVALID);
+    _keys.assign(_k * static_cast<size_t>(num_elements), 0);
+    _contained.assign(_k * static_cast<size_t>(num_elements), false);
+    clear();
+  }
+
+  void clear() {
+    for ( PartitionID part = 0; part < _k; ++part ) {
+      if ( _size[part] > 0 ) {
+        std::fill_n(_buckets.begin() + part * _num_buckets, _num_buckets, INVALID);
+        std::fill_n(_contained.begin() + part * static_cast<size_t>(_num_elements), _num_elements, false);
+      }
+      _size[part] = 0;
+      _enabled[part] = false;
+      _max_bucket[part] = 0;
+    }
+    _num_non_empty_parts = 0;
+    _num_enabled_parts = 0;
+  }
+
+  Gain maxKey() const {
+    return _max_key;
+  }
+
+  size_t size(const PartitionID part) const {
+    ASSERT(part < _k);
+    return _size[part];
+  }
+
+  size_t numNonEmptyParts() const {
+    return _num_non_empty_parts;
+  }
+
+  size_t numEnabledParts() const {
+    return _num_enabled_parts;
+  }
+
+  bool isEnabled(const PartitionID part) const {
+    ASSERT(part < _k);
+    return _enabled[part];
+  }
+
+  // ! Enables the queue of the block, if it is not empty
+  void enablePart(const PartitionID part) {
+    ASSERT(part < _k);
+    if ( !_enabled[part] && _size[part] > 0 ) {
+      _enabled[part] = true;
+      ++_num_enabled_parts;
+    }
+  }
+
+  void disablePart(const PartitionID part) {
+    ASSERT(part < _k);
+    if ( _enabled[part] ) {
+      _enabled[part] = false;
+      --_num_enabled_parts;
+    }
+  }
+
+  bool contains(const HypernodeID hn, const PartitionID part) const {
+    ASSERT(hn < _num_elements && part < _k);
+    return _contained[index(hn, part)];
+  }
+
+  Gain key(const HypernodeID hn, const PartitionID part) const {
+    ASSERT(contains(hn, part));
+    return _keys[index(hn, part)];
+  }
+
+  void insert(const HypernodeID hn, const PartitionID part, const Gain key) {
+    ASSERT(!contains(hn, part));
+    if ( _size[part]++ == 0 ) {
+      ++_num_non_empty_parts;
+    }
+    _contained[index(hn, part)] = true;
+    _keys[index(hn, part)] = key;
+    link(hn, part, key);
+  }
+
+  void remove(const HypernodeID hn, const PartitionID part) {
+    ASSERT(contains(hn, part));
+    unlink(hn, part);
+    _contained[index(hn, part)] = false;
+    if ( --_size[part] == 0 ) {
+      markEmpty(part);
+    }
+  }
+
+  void updateKeyBy(const HypernodeID hn, const PartitionID part, const Gain delta) {
+    ASSERT(contains(hn, part));
+    unlink(hn, part);
+    _keys[index(hn, part)] += delta;
+    link(hn, part, _keys[index(hn, part)]);
+  }
+
+  // ! Removes the element with the maximum key from the queue of the block
+  void deleteMaxFromPartition(HypernodeID& hn, Gain& key, const PartitionID part) {
+    ASSERT(_size[part] > 0);
+    size_t& max_bucket = _max_bucket[part];
+    while ( bucketHead(part, max_bucket) == INVALID ) {
+      ASSERT(max_bucket > 0);
+      --max_bucket;
+    }
+    hn = bucketHead(part, max_bucket);
+    key = _keys[index(hn, part)];
+    remove(hn, part);
+  }
+
+  // ! Removes the element with the maximum key from all enabled queues
+  void deleteMax(HypernodeID& hn, Gain& key, PartitionID& part) {
+    ASSERT(_num_enabled_parts > 0);
+    part = kInvalidPartition;
+    for ( PartitionID p = 0; p < _k; ++p ) {
+      if ( _enabled[p] ) {
+        size_t& max_bucket = _max_bucket[p];
+        while ( bucketHead(p, max_bucket) == INVALID ) {
+          ASSERT(max_bucket > 0);
+          --max_bucket;
+        }
+        if ( part == kInvalidPartition || max_bucket > _max_bucket[part] ) {
+          part = p;
+        }
+      }
+    }
+    ASSERT(part != kInvalidPartition);
+    deleteMaxFromPartition(hn, key, part);
+  }
+
+ private:
+  size_t index(const HypernodeID hn, const PartitionID part) const {
+    return static_cast<size_t>(part) * _num_elements + hn;
+  }
+
+  size_t bucket(const Gain key) const {
+    ASSERT(key >= -_max_key && key <= _max_key, V(key) << V(_max_key));
+    return static_cast<size_t>(key + _max_key);
+  }
+
+  HypernodeID& bucketHead(const PartitionID part, const size_t b) {
+    return _buckets[part * _num_buckets + b];
+  }
+
+  void link(const HypernodeID hn, const PartitionID part, const Gain key) {
+    const size_t b = bucket(key);
+    HypernodeID& head = bucketHead(part, b);
+    const size_t idx = index(hn, part);
+    _prev[idx] = INVALID;
+    _next[idx] = head;
+    if ( head != INVALID ) {
+      _prev[index(head, part)] = hn;
+    }
+    head = hn;
+    _max_bucket[part] = std::max(_max_bucket[part], b);
+  }
+
+  void unlink(const HypernodeID hn, const PartitionID part) {
+    const size_t idx = index(hn, part);
+    const HypernodeID prev = _prev[idx];
+    const HypernodeID next = _next[idx];
+    if ( prev != INVALID ) {
+      _next[index(prev, part)] = next;
+    } else {
+      bucketHead(part, bucket(_keys[idx])) = next;
+    }
+    if ( next != INVALID ) {
+      _prev[index(next, part)] = prev;
+    }
+  }
+
+  void markEmpty(const PartitionID part) {
+    disablePart(part);
+    --_num_non_empty_parts;
+    _max_bucket[part] = 0;
+  }
+
+  PartitionID _k;
+  HypernodeID _num_elements;
+  Gain _max_key;
+  size_t _num_buckets;
+  size_t _num_non_empty_parts;
+  size_t _num_enabled_parts;
+  vec<size_t> _size;
+  vec<bool> _enabled;
+  vec<size_t> _max_bucket;
+  vec<HypernodeID> _buckets;
+  vec<HypernodeID> _next;
+  vec<HypernodeID> _prev;
+  vec<Gain> _keys;
+  vec<bool> _contained;
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
@@ -38,12 +38,15 @@
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/bitset.h"
+#include "mt-kahypar/datastructures/border_nodes.h"
 #include "mt-kahypar/datastructures/connectivity_set.h"
 #include "mt-kahypar/datastructures/synchronized_edge_update.h"
 #include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/stl/thread_locals.h"
+#include "mt-kahypar/utils/prefetch.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/utils/timer.h"
 
@@ -141,15 +144,11 @@ private:
     unsigned int _iteration_count = 0;
   };
 
-  struct EdgeMove {
-    EdgeMove() :
-      block_of_smaller(kInvalidPartition),
-      block_of_larger(kInvalidPartition),
-      version(0) { }
-
-    PartitionID block_of_smaller;
-    PartitionID block_of_larger;
-    uint32_t version;
+  // ! Low 16 bits of the move sequence numbers of both endpoints at the time
+  // ! they last moved across the edge (see synchronizeMoveOnEdge(...))
+  struct EdgeStamps {
+    uint16_t of_smaller = 0;
+    uint16_t of_larger = 0;
   };
 
  public:
@@ -157,10 +156,11 @@ private:
   static constexpr bool is_graph = Hypergraph::is_graph;
   static constexpr bool is_partitioned = true;
   static constexpr bool supports_connectivity_set = true;
+  static constexpr bool has_dense_connectivity_set = false;
   static constexpr mt_kahypar_partition_type_t TYPE = PartitionedGraphType<Hypergraph>::TYPE;
 
   static constexpr HyperedgeID HIGH_DEGREE_THRESHOLD = ID(100000);
-  static constexpr size_t SIZE_OF_EDGE_LOCK = sizeof(EdgeMove);
+  static constexpr size_t SIZE_OF_EDGE_LOCK = sizeof(EdgeStamps);
 
   using UnderlyingHypergraph = Hypergraph;
   using HypernodeIterator = typename Hypergraph::HypernodeIterator;
@@ -184,15 +184,18 @@ private:
     _part_weights(k, CAtomic<HypernodeWeight>(0)),
     _part_ids(
       "Refinement", "part_ids", hypergraph.initialNumNodes(), false, false),
-    _edge_sync_version(0),
+    _node_moves(
+      "Refinement", "node_moves", hypergraph.initialNumNodes(), false, false),
     _edge_sync(
       "Refinement", "edge_sync", hypergraph.maxUniqueID(), false, false),
     _edge_sync_is_dirty(false),
     _edge_locks(
       "Refinement", "edge_locks", hypergraph.maxUniqueID(), false, false),
-    _edge_markers(Hypergraph::is_static_hypergraph ? 0 : hypergraph.maxUniqueID()) {
+    _edge_markers(Hypergraph::is_static_hypergraph ? 0 : hypergraph.maxUniqueID()),
+    _border_nodes() {
     _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition, false);
-    _edge_sync.assign(hypergraph.maxUniqueID(), EdgeMove(), false);
+    _node_moves.assign(hypergraph.initialNumNodes(), 0, false);
+    _edge_sync.assign(hypergraph.maxUniqueID(), EdgeStamps(), false);
     _edge_locks.assign(hypergraph.maxUniqueID(), SpinLock(), false);
   }
 
@@ -207,19 +210,24 @@ private:
     _target_graph(nullptr),
     _part_weights(k, CAtomic<HypernodeWeight>(0)),
     _part_ids(),
-    _edge_sync_version(0),
+    _node_moves(),
     _edge_sync(),
     _edge_sync_is_dirty(false),
     _edge_locks(),
-    _edge_markers() {
+    _edge_markers(),
+    _border_nodes() {
     tbb::parallel_invoke([&] {
       _part_ids.resize(
         "Refinement", "part_ids", hypergraph.initialNumNodes());
       _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition);
+    }, [&] {
+      _node_moves.resize(
+        "Refinement", "node_moves", hypergraph.initialNumNodes());
+      _node_moves.assign(hypergraph.initialNumNodes(), 0);
     }, [&] {
       _edge_sync.resize(
         "Refinement", "edge_sync", static_cast<size_t>(hypergraph.maxUniqueID()));
-      _edge_sync.assign(hypergraph.maxUniqueID(), EdgeMove());
+      _edge_sync.assign(hypergraph.maxUniqueID(), EdgeStamps());
     }, [&] {
       _edge_locks.resize(
         "Refinement", "edge_locks", static_cast<size_t>(hypergraph.maxUniqueID()));
@@ -242,13 +250,15 @@ private:
   }
 
   void resetData() {
+    _border_nodes.invalidate();
     tbb::parallel_invoke([&] {
+      _node_moves.assign(_node_moves.size(), 0);
     }, [&] {
       _part_ids.assign(_part_ids.size(), kInvalidPartition);
     }, [&] {
       for (auto& x : _part_weights) x.store(0, std::memory_order_relaxed);
     }, [&] {
-      _edge_sync.assign(_hg->maxUniqueID(), EdgeMove());
+      _edge_sync.assign(_hg->maxUniqueID(), EdgeStamps());
     });
   }
 
@@ -460,6 +470,7 @@ private:
 
   template<typename GainCache>
   void uncontract(const Batch& batch, GainCache& gain_cache) {
+    _border_nodes.invalidate();
     // Set block ids of contraction partners
     tbb::parallel_for(UL(0), batch.size(), [&](const size_t i) {
       const Memento& memento = batch[i];
@@ -474,10 +485,12 @@ private:
       [&](const HyperedgeID e) { return !_edge_markers.compare_and_set_to_true(uniqueEdgeID(e)); },
       [&](const HypernodeID u, const HypernodeID v, const HyperedgeID e) {
         // In this case, e was a single pin edge before uncontraction
+        resetEdgeStamps(e);
         gain_cache.uncontractUpdateAfterRestore(*this, u, v, e, 0);
       },
       [&](const HypernodeID u, const HypernodeID v, const HyperedgeID e) {
         // In this case, u is replaced by v in e
+        resetEdgeStamps(e);
         gain_cache.uncontractUpdateAfterReplacement(*this, u, v, e);
       });
 
@@ -488,24 +501,26 @@ private:
       });
     }
     gain_cache.batchUncontractionsCompleted();
-    ++_edge_sync_version;
   }
 
   // ####################### Restore Hyperedges #######################
 
   void restoreLargeEdge(const HyperedgeID& he) {
+    _border_nodes.invalidate();
     _hg->restoreLargeEdge(he);
   }
 
   template<typename GainCache>
   void restoreSinglePinAndParallelNets(const vec<typename Hypergraph::ParallelHyperedge>& hes_to_restore,
                                        GainCache& gain_cache) {
+    _border_nodes.invalidate();
     _edge_markers.reset();
     _hg->restoreSinglePinAndParallelNets(hes_to_restore);
 
     tbb::parallel_for(UL(0), hes_to_restore.size(), [&](const size_t i) {
       const HyperedgeID he = hes_to_restore[i].old_id;
       ASSERT(edgeIsEnabled(he));
+      resetEdgeStamps(he);
       const bool is_single_pin_he = edgeSize(he) == 1;
       if ( is_single_pin_he ) {
         // Restore single-pin net
@@ -518,7 +533,6 @@ private:
         gain_cache.restoreIdenticalHyperedge(*this, he);
       }
     });
-    ++_edge_sync_version;
   }
 
   // ####################### Partition Information #######################
@@ -529,7 +543,13 @@ private:
     return _part_ids[u];
   }
 
+  // ! Prefetches the block ID of node u (see utils/prefetch.h)
+  void prefetchPartID(const HypernodeID u) const {
+    utils::prefetch(_part_ids.data() + u);
+  }
+
   void extractPartIDs(Array<PartitionID>& part_ids) {
+    _border_nodes.invalidate();
     // If we pass the input hypergraph to initial partitioning, then initial partitioning
     // will pass an part ID vector of size |V'|, where V' are the number of nodes of
     // smallest hypergraph, while the _part_ids vector of the input hypergraph is initialized
@@ -554,6 +574,7 @@ private:
 
   void setNodePart(const HypernodeID u, PartitionID p) {
     ASSERT(_part_ids[u] == kInvalidPartition);
+    _border_nodes.invalidate();
     setOnlyNodePart(u, p);
     _part_weights[p].fetch_add(nodeWeight(u), std::memory_order_relaxed);
   }
@@ -651,9 +672,13 @@ private:
   }
 
   // ! Returns whether hypernode u is adjacent to a least one cut hyperedge.
+  // ! Takes constant time if the border nodes are tracked (see initializeBorderNodes()).
   bool isBorderNode(const HypernodeID u) const {
     const PartitionID part_id = partID(u);
     if ( nodeDegree(u) <= HIGH_DEGREE_THRESHOLD ) {
+      if ( _border_nodes.isValid() ) {
+        return _border_nodes.isBorderNode(u);
+      }
       for ( const HyperedgeID& he : incidentEdges(u) ) {
         if ( partID(edgeTarget(he)) != part_id ) {
           return true;
@@ -664,14 +689,35 @@ private:
   }
 
   HypernodeID numIncidentCutHyperedges(const HypernodeID u) const {
-    const PartitionID part_id = partID(u);
-    HypernodeID num_incident_cut_hyperedges = 0;
-    for ( const HyperedgeID& he : incidentEdges(u) ) {
-      if ( partID(edgeTarget(he)) != part_id ) {
-        ++num_incident_cut_hyperedges;
-      }
+    if ( _border_nodes.isValid() ) {
+      return _border_nodes.numIncidentCutHyperedges(u);
     }
-    return num_incident_cut_hyperedges;
+    return numIncidentCutHyperedgesRecomputed(u);
+  }
+
+  // ####################### Border Nodes #######################
+
+  // ! Computes the number of incident cut edges of all nodes. Afterwards, the counters
+  // ! and the set of border nodes are maintained incrementally on each synchronized node
+  // ! move, until the partition or the graph is modified otherwise (e.g., via uncontractions
+  // ! or changeNodePartNoSync(...)).
+  void initializeBorderNodes() {
+    _border_nodes.initialize(initialNumNodes(), [&](const HypernodeID u) {
+      return nodeIsEnabled(u) ? numIncidentCutHyperedgesRecomputed(u) : 0;
+    });
+  }
+
+  bool isTrackingBorderNodes() const {
+    return _border_nodes.isValid();
+  }
+
+  // ! Calls f(u) in parallel for all nodes u incident to at least one cut edge.
+  // ! Requires that the border nodes are tracked. Runs in time linear in the number
+  // ! of border nodes and must not be called concurrently with node moves.
+  template<typename F>
+  void doParallelForAllBorderNodes(const F& f) {
+    ASSERT(isTrackingBorderNodes());
+    _border_nodes.doParallelForAllBorderNodes(f);
   }
 
   // ! Number of blocks which pins of hyperedge e belongs to
@@ -742,13 +788,40 @@ private:
   // ! Initializes the partition of the hypergraph, if block ids are assigned with
   // ! setOnlyNodePart(...). In that case, block weights must be initialized explicitly here.
   void initializePartition() {
+    _border_nodes.invalidate();
     initializeBlockWeights();
   }
 
+  // ! Assigns each node to the block returned by block_of(...) and
+  // ! initializes the block weights in the same sweep over the nodes.
+  template<typename F>
+  void initializePartition(const F& block_of) {
+    _border_nodes.invalidate();
+    tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), initialNumNodes()),
+      [&](tbb::blocked_range<HypernodeID>& r) {
+        // this is not enumerable_thread_specific because of the static partitioner
+        parallel::scalable_vector<HypernodeWeight> part_weight_deltas(_k, 0);
+        for (HypernodeID node = r.begin(); node < r.end(); ++node) {
+          if (nodeIsEnabled(node)) {
+            const PartitionID block = block_of(node);
+            setOnlyNodePart(node, block);
+            part_weight_deltas[block] += nodeWeight(node);
+          }
+        }
+        for (PartitionID p = 0; p < _k; ++p) {
+          _part_weights[p].fetch_add(part_weight_deltas[p], std::memory_order_relaxed);
+        }
+      },
+      tbb::static_partitioner()
+    );
+  }
+
   // ! Reset partition (not thread-safe)
   void resetPartition() {
+    _border_nodes.invalidate();
     _part_ids.assign(_part_ids.size(), kInvalidPartition, false);
-    _edge_sync.assign(_hg->maxUniqueID(), EdgeMove(), false);
+    _node_moves.assign(_node_moves.size(), 0, false);
+    _edge_sync.assign(_hg->maxUniqueID(), EdgeStamps(), false);
     for (auto& weight : _part_weights) {
       weight.store(0, std::memory_order_relaxed);
     }
@@ -756,7 +829,6 @@ private:
 
   // ! Reset synchronization. Necessary after changeNodePartNoSync (not thread-safe)
   void resetEdgeSynchronization() {
-    ++_edge_sync_version;
     _edge_sync_is_dirty = false;
   }
 
@@ -792,6 +864,17 @@ private:
       }
     }
 
+    if ( _border_nodes.isValid() ) {
+      for (HypernodeID u : nodes()) {
+        if ( _border_nodes.numIncidentCutHyperedges(u) != numIncidentCutHyperedgesRecomputed(u) ) {
+          LOG << "Number of incident cut edges of node" << u << "=>" <<
+              "Expected:" << V(numIncidentCutHyperedgesRecomputed(u)) << "," <<
+              "Actual:" << V(_border_nodes.numIncidentCutHyperedges(u));
+          success = false;
+        }
+      }
+    }
+
     return success;
   }
 
@@ -850,26 +933,39 @@ private:
   // ####################### Fixed Vertex Support #######################
 
   bool hasFixedVertices() const {
-    return _hg->hasFixedVertices();
+    return _hg->hasFixedVertices() || _movable_region;
   }
 
   bool isFixed(const HypernodeID hn) const {
-    return _hg->isFixed(hn);
+    return _hg->isFixed(hn) || ( _movable_region && !_movable_region->isSet(hn) );
   }
 
   PartitionID fixedVertexBlock(const HypernodeID hn) const {
+    if ( _movable_region && !_hg->isFixed(hn) ) {
+      return _movable_region->isSet(hn) ? kInvalidPartition : partID(hn);
+    }
     return _hg->fixedVertexBlock(hn);
   }
 
+  // ! Restricts all moves to the nodes contained in the given region. All other nodes
+  // ! are treated as if they were fixed to their current block. The region is not
+  // ! copied and must outlive the restriction (nullptr removes the restriction).
+  void setMovableRegion(const Bitset* region) {
+    ASSERT(!region || region->numBlocks() * 64 >= initialNumNodes());
+    _movable_region = region;
+  }
+
   // ####################### Memory Consumption #######################
 
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
     ASSERT(parent);
     parent->addChild("Part Weights", sizeof(CAtomic<HypernodeWeight>) * _k);
     parent->addChild("Part IDs", sizeof(PartitionID) * _hg->initialNumNodes());
-    parent->addChild("Edge Synchronization", sizeof(EdgeMove) * _edge_sync.size());
+    parent->addChild("Node Move Sequences", sizeof(uint64_t) * _node_moves.size());
+    parent->addChild("Edge Synchronization", sizeof(EdgeStamps) * _edge_sync.size());
     parent->addChild("Edge Locks", sizeof(SpinLock) * _edge_locks.size());
     parent->addChild("Edge Markers", sizeof(uint8_t) * _edge_markers.size());
+    parent->addChild("Border Nodes", _border_nodes.memoryConsumption());
   }
 
   // ####################### Extract Block #######################
@@ -892,24 +988,40 @@ private:
     // Compactify vertex ids
     ExtractedBlock extracted_block;
     vec<HypernodeID>& node_mapping = extracted_block.hn_mapping;
-    node_mapping.assign(_hg->initialNumNodes(), kInvalidHypernode);
-    vec<HyperedgeID> he_mapping(_hg->initialNumEdges(), kInvalidHyperedge);
+    vec<HyperedgeID> he_mapping;
     HypernodeID num_nodes = 0;
     HypernodeID num_edges = 0;
+    // The IDs are computed via a parallel prefix sum over the contained nodes and
+    // edges, which yields the same IDs as a sequential scan in increasing ID order
+    auto is_contained = [&](const HyperedgeID edge) {
+      const HypernodeID source = edgeSource(edge);
+      const HypernodeID target = edgeTarget(edge);
+      return partID(source) == block && partID(target) == block && source < target;
+    };
     tbb::parallel_invoke([&] {
-      for (const HypernodeID& node : nodes()) {
-        if (partID(node) == block) {
-          node_mapping[node] = num_nodes++;
-        }
-      }
+      node_mapping.assign(_hg->initialNumNodes(), 0);
+      doParallelForAllNodes([&](const HypernodeID& node) {
+        node_mapping[node] = partID(node) == block;
+      });
+      parallel_prefix_sum(node_mapping.begin(), node_mapping.end(),
+        node_mapping.begin(), std::plus<HypernodeID>(), 0);
+      num_nodes = node_mapping.empty() ? 0 : node_mapping.back();
+      tbb::parallel_for(static_cast<HypernodeID>(0), _hg->initialNumNodes(), [&](const HypernodeID& node) {
+        const bool contained = nodeIsEnabled(node) && partID(node) == block;
+        node_mapping[node] = contained ? node_mapping[node] - 1 : kInvalidHypernode;
+      });
     }, [&] {
-      for (const HyperedgeID& edge : edges()) {
-        const HypernodeID source = edgeSource(edge);
-        const HypernodeID target = edgeTarget(edge);
-        if (partID(source) == block && partID(target) == block && source < target) {
-          he_mapping[edge] = num_edges++;
-        }
-      }
+      he_mapping.assign(_hg->initialNumEdges(), 0);
+      doParallelForAllEdges([&](const HyperedgeID& edge) {
+        he_mapping[edge] = is_contained(edge);
+      });
+      parallel_prefix_sum(he_mapping.begin(), he_mapping.end(),
+        he_mapping.begin(), std::plus<HyperedgeID>(), 0);
+      num_edges = he_mapping.empty() ? 0 : he_mapping.back();
+      tbb::parallel_for(static_cast<HyperedgeID>(0), _hg->initialNumEdges(), [&](const HyperedgeID& edge) {
+        const bool contained = edgeIsEnabled(edge) && is_contained(edge);
+        he_mapping[edge] = contained ? he_mapping[edge] - 1 : kInvalidHyperedge;
+      });
     });
 
     // Extract plain hypergraph data for corresponding block
@@ -1093,7 +1205,7 @@ private:
 
   void freeInternalData() {
     if ( _k > 0 ) {
-      parallel::parallel_free(_part_ids, _edge_sync, _edge_locks);
+      parallel::parallel_free(_part_ids, _node_moves, _edge_sync, _edge_locks);
     }
     _k = 0;
   }
@@ -1127,22 +1239,30 @@ private:
         sync_update.to = to;
         sync_update.target_graph = _target_graph;
         sync_update.edge_locks = &_edge_locks;
+        // An odd sequence number marks u as being moved to block 'to'
+        const uint32_t sequence = moveSequence(__atomic_load_n(&_node_moves[u], __ATOMIC_RELAXED)) + 1;
+        __atomic_store_n(&_node_moves[u], nodeMove(sequence, to), __ATOMIC_RELAXED);
         for (const HyperedgeID edge : incidentEdges(u)) {
           if (!isSinglePin(edge)) {
             sync_update.he = edge;
             sync_update.edge_weight = edgeWeight(edge);
             sync_update.edge_size = edgeSize(edge);
-            synchronizeMoveOnEdge<notify>(sync_update, edge, u, to, notify_func);
+            synchronizeMoveOnEdge<notify>(sync_update, edge, u, sequence, notify_func);
+            updateBorderNodes(sync_update, u, edge);
             sync_update.pin_count_in_from_part_after = sync_update.block_of_other_node == from ? 1 : 0;
             sync_update.pin_count_in_to_part_after = sync_update.block_of_other_node == to ? 2 : 1;
             delta_func(sync_update);
           }
         }
+        __atomic_store_n(&_part_ids[u], to, __ATOMIC_RELAXED);
+        __atomic_store_n(&_node_moves[u], nodeMove(sequence + 1, to), __ATOMIC_RELEASE);
       } else {
         // small hack to only set this when assertions are enabled
         ASSERT(_edge_sync_is_dirty = true);
+        // Without synchronization, we do not know the blocks of the neighbors
+        _border_nodes.invalidate();
+        __atomic_store_n(&_part_ids[u], to, __ATOMIC_RELAXED);
       }
-      __atomic_store_n(&_part_ids[u], to, __ATOMIC_RELAXED);
       DBG << "Done changing node part: " << V(u) << " >>>";
       return true;
     } else {
@@ -1151,6 +1271,35 @@ private:
     }
   }
 
+  // ! If the border nodes are tracked and the edge becomes cut or non-cut due
+  // ! to the move of u, the counters of both endpoints are updated
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateBorderNodes(const SynchronizedEdgeUpdate& sync_update,
+                                                            const HypernodeID u,
+                                                            const HyperedgeID edge) {
+    if ( _border_nodes.isValid() ) {
+      const bool was_cut = sync_update.block_of_other_node != sync_update.from;
+      const bool is_cut = sync_update.block_of_other_node != sync_update.to;
+      if ( !was_cut && is_cut ) {
+        _border_nodes.increment(u);
+        _border_nodes.increment(edgeTarget(edge));
+      } else if ( was_cut && !is_cut ) {
+        _border_nodes.decrement(u);
+        _border_nodes.decrement(edgeTarget(edge));
+      }
+    }
+  }
+
+  HypernodeID numIncidentCutHyperedgesRecomputed(const HypernodeID u) const {
+    const PartitionID part_id = partID(u);
+    HypernodeID num_incident_cut_hyperedges = 0;
+    for ( const HyperedgeID& he : incidentEdges(u) ) {
+      if ( partID(edgeTarget(he)) != part_id ) {
+        ++num_incident_cut_hyperedges;
+      }
+    }
+    return num_incident_cut_hyperedges;
+  }
+
   void initializeBlockWeights() {
     tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), initialNumNodes()),
       [&](tbb::blocked_range<HypernodeID>& r) {
@@ -1171,49 +1320,71 @@ private:
 
   // ####################### Edge Locks #######################
 
+  // ! Packs the move sequence number and the target block of a node into one word,
+  // ! such that both can be read atomically
+  static uint64_t nodeMove(const uint32_t sequence, const PartitionID to) {
+    return (static_cast<uint64_t>(sequence) << 32) | static_cast<uint32_t>(to);
+  }
+
+  static uint32_t moveSequence(const uint64_t node_move) {
+    return node_move >> 32;
+  }
+
+  static PartitionID moveTarget(const uint64_t node_move) {
+    return static_cast<PartitionID>(static_cast<uint32_t>(node_move));
+  }
+
+  // ! Stamps are only compared against odd sequence numbers, so zero never matches
+  void resetEdgeStamps(const HyperedgeID e) {
+    _edge_sync[uniqueEdgeID(e)] = EdgeStamps();
+  }
+
   // This function synchronizes a move on an edge and returns the block ID
   // of the target node of the corresponding edge. The function assumes that
-  // node u is moved to the block 'to'.
+  // node u is currently moved with the given (odd) sequence number.
+  //
+  // Each node increments its move sequence number when it starts and when it finishes
+  // a move, i.e., the number is odd while the node is moved. Under the edge lock, a node
+  // stamps the edge with its sequence number. If the other node v is moved concurrently
+  // and already stamped the edge during its current move, we observe the target block of v.
+  // Otherwise, v processes the edge after us and observes our target block, while we
+  // observe the block of v before its move (_part_ids is only updated after all incident
+  // edges of v are processed). This replaces a per-edge record of the blocks of both
+  // endpoints with a per-node sequence number and 16-bit stamps per edge. Since a node
+  // stamps all of its incident edges during each move, the stamp of v on the edge is
+  // either its current or its previous sequence number, which differ in the low 16 bits.
   template<bool notify>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   PartitionID synchronizeMoveOnEdge(SynchronizedEdgeUpdate& sync_update,
                                     const HyperedgeID edge,
                                     const HypernodeID u,
-                                    const PartitionID to,
+                                    const uint32_t sequence,
                                     const NotificationFunc& notify_func) {
     const HyperedgeID unique_id = uniqueEdgeID(edge);
     const HypernodeID v = edgeTarget(edge);
-    PartitionID block_of_v = __atomic_load_n(&_part_ids[v], __ATOMIC_RELAXED);
-    EdgeMove& edge_move = _edge_sync[unique_id];
-
-    // Note: It is important that `edge_move` tracks the block of both nodes.
-    // Previously, the struct only contained the block of the node that was moved most recently.
-    // However, this caused a race condition if a move is applied and then immediately reverted.
-    // If the other node is moved concurrently and the concurrent move acquired the lock first
-    // but did not update _part_ids yet, the reverting move would incorrectly use the old part id.
-    auto execute_sychnronization = [&](PartitionID& move_block_u, PartitionID& move_block_v) {
-      _edge_locks[unique_id].lock();
-      if ( move_block_v != kInvalidPartition && edge_move.version == _edge_sync_version ) {
-        ASSERT(move_block_v < _k);
-        block_of_v = move_block_v;
-      } else if ( edge_move.version != _edge_sync_version ) {
-        move_block_v = kInvalidPartition;
-      }
-      move_block_u = to;
-      edge_move.version = _edge_sync_version;
-      sync_update.block_of_other_node = block_of_v;
-      if constexpr ( notify ) {
-        notify_func(sync_update);
-      }
-      _edge_locks[unique_id].unlock();
-    };
-
-    if (u < v) {
-      execute_sychnronization(edge_move.block_of_smaller, edge_move.block_of_larger);
+    EdgeStamps& stamps = _edge_sync[unique_id];
+    uint16_t& stamp_of_u = u < v ? stamps.of_smaller : stamps.of_larger;
+    const uint16_t& stamp_of_v = u < v ? stamps.of_larger : stamps.of_smaller;
+    ASSERT(u != v);
+
+    _edge_locks[unique_id].lock();
+    // Note that the acquire load synchronizes with the release store at the end of the
+    // move of v, which ensures that we see the updated block ID of v in _part_ids.
+    const uint64_t move_of_v = __atomic_load_n(&_node_moves[v], __ATOMIC_ACQUIRE);
+    const uint32_t sequence_of_v = moveSequence(move_of_v);
+    PartitionID block_of_v;
+    if ( ( sequence_of_v & 1 ) && stamp_of_v == static_cast<uint16_t>(sequence_of_v) ) {
+      block_of_v = moveTarget(move_of_v);
+      ASSERT(block_of_v < _k);
     } else {
-      ASSERT(u > v);
-      execute_sychnronization(edge_move.block_of_larger, edge_move.block_of_smaller);
+      block_of_v = __atomic_load_n(&_part_ids[v], __ATOMIC_RELAXED);
+    }
+    stamp_of_u = static_cast<uint16_t>(sequence);
+    sync_update.block_of_other_node = block_of_v;
+    if constexpr ( notify ) {
+      notify_func(sync_update);
     }
+    _edge_locks[unique_id].unlock();
     return block_of_v;
   }
 
@@ -1232,18 +1403,20 @@ private:
   // ! Target graph on which this graph is mapped
   const TargetGraph* _target_graph;
 
+  // ! Nodes that are allowed to move (if set, all other nodes are implicitly fixed)
+  const Bitset* _movable_region = nullptr;
+
   // ! Weight and information for all blocks.
   parallel::scalable_vector< CAtomic<HypernodeWeight> > _part_weights;
 
   // ! Current block IDs of the vertices
   Array< PartitionID > _part_ids;
 
-  // ! Incrementing this counter invalidates all EdgeMove objects (see _edge_sync)
-  // ! with a version < _edge_sync_version
-  uint32_t _edge_sync_version;
+  // ! Move sequence number and target block of each vertex (see synchronizeMoveOnEdge(...))
+  Array< uint64_t > _node_moves;
 
   // ! Used to syncronize moves on edges
-  Array< EdgeMove > _edge_sync;
+  Array< EdgeStamps > _edge_sync;
   bool _edge_sync_is_dirty;
 
   // ! Lock to syncronize moves on edges
@@ -1252,6 +1425,9 @@ private:
   // ! We need to synchronize uncontractions via atomic markers
   ThreadSafeFastResetFlagArray<uint8_t> _edge_markers;
 
+  // ! Number of incident cut edges and set of border nodes (if tracked)
+  BorderNodes _border_nodes;
+
   // ! Bitsets to create shallow and deep copies of the connectivity set
   // ! They are only required to implement the same interface of our hypergraph
   // ! data structure but should not be required in practice.
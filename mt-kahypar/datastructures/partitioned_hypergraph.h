@@ -36,12 +36,16 @@
 #include "kahypar-resources/meta/mandatory.h"
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/bitset.h"
+#include "mt-kahypar/datastructures/border_nodes.h"
 #include "mt-kahypar/datastructures/connectivity_info.h"
 #include "mt-kahypar/datastructures/streaming_vector.h"
 #include "mt-kahypar/datastructures/synchronized_edge_update.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/stl/thread_locals.h"
+#include "mt-kahypar/utils/prefetch.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/exception.h"
@@ -82,6 +86,7 @@ class PartitionedHypergraph {
   static constexpr bool is_graph = Hypergraph::is_graph;
   static constexpr bool is_partitioned = true;
   static constexpr bool supports_connectivity_set = true;
+  static constexpr bool has_dense_connectivity_set = ConnectivityInformation::has_dense_connectivity_set;
   static constexpr mt_kahypar_partition_type_t TYPE =
     PartitionedHypergraphType<Hypergraph, ConnectivityInformation>::TYPE;
 
@@ -113,7 +118,8 @@ class PartitionedHypergraph {
         "Refinement", "part_ids", hypergraph.initialNumNodes(), false, false),
     _con_info(hypergraph.initialNumEdges(), k, hypergraph.maxEdgeSize()),
     _pin_count_update_ownership(
-        "Refinement", "pin_count_update_ownership", hypergraph.initialNumEdges(), true, false) {
+        "Refinement", "pin_count_update_ownership", hypergraph.initialNumEdges(), true, false),
+    _border_nodes() {
     _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition, false);
   }
 
@@ -128,12 +134,15 @@ class PartitionedHypergraph {
     _part_weights(k, CAtomic<HypernodeWeight>(0)),
     _part_ids(),
     _con_info(),
-    _pin_count_update_ownership() {
+    _pin_count_update_ownership(),
+    _border_nodes() {
+    // The part IDs are initialized from the calling thread such that the static
+    // assignment of vertex ranges to threads in Array::assign(...) determines
+    // on which NUMA node the vertex ranges are placed (first-touch policy)
+    _part_ids.resize(
+      "Refinement", "vertex_part_info", hypergraph.initialNumNodes());
+    _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition);
     tbb::parallel_invoke([&] {
-      _part_ids.resize(
-        "Refinement", "vertex_part_info", hypergraph.initialNumNodes());
-      _part_ids.assign(hypergraph.initialNumNodes(), kInvalidPartition);
-    }, [&] {
       _con_info = ConnectivityInformation(
         hypergraph.initialNumEdges(), k, hypergraph.maxEdgeSize(), parallel_tag_t { });
     }, [&] {
@@ -154,6 +163,7 @@ class PartitionedHypergraph {
   }
 
   void resetData() {
+    _border_nodes.invalidate();
     tbb::parallel_invoke([&] {
     }, [&] {
       _part_ids.assign(_part_ids.size(), kInvalidPartition);
@@ -303,6 +313,13 @@ class PartitionedHypergraph {
     return _con_info.connectivitySet(e);
   }
 
+  // ! Returns the i-th 64-bit block of the connectivity set bitset of hyperedge e.
+  // ! Only available if the connectivity information stores dense bitsets.
+  StaticBitset::Block connectivitySetBlock(const HyperedgeID e, const size_t i) const {
+    ASSERT(e < _hg->initialNumEdges(), "Hyperedge" << e << "does not exist");
+    return _con_info.connectivitySetBlock(e, i);
+  }
+
   // ####################### Hypernode Information #######################
 
   // ! Weight of a vertex
@@ -413,6 +430,7 @@ class PartitionedHypergraph {
    */
   template<typename GainCache>
   void uncontract(const Batch& batch, GainCache& gain_cache) {
+    _border_nodes.invalidate();
     // Set block ids of contraction partners
     tbb::parallel_for(UL(0), batch.size(), [&](const size_t i) {
       const Memento& memento = batch[i];
@@ -450,6 +468,7 @@ class PartitionedHypergraph {
    * Restores a large hyperedge previously removed from the hypergraph.
    */
   void restoreLargeEdge(const HyperedgeID& he) {
+    _border_nodes.invalidate();
     _hg->restoreLargeEdge(he);
 
     // Recalculate pin count in parts
@@ -483,6 +502,7 @@ class PartitionedHypergraph {
   template<typename GainCache>
   void restoreSinglePinAndParallelNets(const vec<typename Hypergraph::ParallelHyperedge>& hes_to_restore,
                                        GainCache& gain_cache) {
+    _border_nodes.invalidate();
     // Restore hyperedges in hypergraph
     _hg->restoreSinglePinAndParallelNets(hes_to_restore);
 
@@ -540,7 +560,13 @@ class PartitionedHypergraph {
     return _part_ids[u];
   }
 
+  // ! Prefetches the block ID of node u (see utils/prefetch.h)
+  void prefetchPartID(const HypernodeID u) const {
+    utils::prefetch(_part_ids.data() + u);
+  }
+
   void extractPartIDs(Array<PartitionID>& part_ids) {
+    _border_nodes.invalidate();
     // If we pass the input hypergraph to initial partitioning, then initial partitioning
     // will pass an part ID vector of size |V'|, where V' are the number of nodes of
     // smallest hypergraph, while the _part_ids vector of the input hypergraph is initialized
@@ -563,6 +589,7 @@ class PartitionedHypergraph {
   }
 
   void setNodePart(const HypernodeID u, PartitionID p) {
+    _border_nodes.invalidate();
     setOnlyNodePart(u, p);
     _part_weights[p].fetch_add(nodeWeight(u), std::memory_order_relaxed);
     for (HyperedgeID he : incidentEdges(u)) {
@@ -580,31 +607,9 @@ class PartitionedHypergraph {
                       HypernodeWeight max_weight_to,
                       SuccessFunc&& report_success,
                       const DeltaFunction& delta_func,
-                      const NotificationFunc& notify_func = NOOP_NOTIFY_FUNC,
                       const bool force_moving_fixed_vertices = false) {
-    unused(force_moving_fixed_vertices);
-    ASSERT(partID(u) == from);
-    ASSERT(from != to);
-    ASSERT(force_moving_fixed_vertices || !isFixed(u));
-    const HypernodeWeight wu = nodeWeight(u);
-    const HypernodeWeight to_weight_after = _part_weights[to].add_fetch(wu, std::memory_order_relaxed);
-    if (to_weight_after <= max_weight_to) {
-      _part_ids[u] = to;
-      _part_weights[from].fetch_sub(wu, std::memory_order_relaxed);
-      report_success();
-      SynchronizedEdgeUpdate sync_update;
-      sync_update.from = from;
-      sync_update.to = to;
-      sync_update.target_graph = _target_graph;
-      sync_update.edge_locks = &_pin_count_update_ownership;
-      for ( const HyperedgeID he : incidentEdges(u) ) {
-        updatePinCountOfHyperedge(he, from, to, sync_update, delta_func, notify_func);
-      }
-      return true;
-    } else {
-      _part_weights[to].fetch_sub(wu, std::memory_order_relaxed);
-      return false;
-    }
+    return changeNodePartImpl<false>(u, from, to, max_weight_to,
+      report_success, delta_func, NOOP_NOTIFY_FUNC, force_moving_fixed_vertices);
   }
 
   // curry
@@ -615,7 +620,7 @@ class PartitionedHypergraph {
                             const bool force_moving_fixed_vertex = false) {
     return changeNodePart(u, from, to,
       std::numeric_limits<HypernodeWeight>::max(), []{},
-        NOOP_FUNC, NOOP_NOTIFY_FUNC, force_moving_fixed_vertex);
+        NOOP_FUNC, force_moving_fixed_vertex);
   }
 
   template<typename SuccessFunc>
@@ -626,7 +631,7 @@ class PartitionedHypergraph {
                             HypernodeWeight max_weight_to,
                             SuccessFunc&& report_success) {
     return changeNodePart(u, from, to,
-      max_weight_to, report_success, NOOP_FUNC, NOOP_NOTIFY_FUNC);
+      max_weight_to, report_success, NOOP_FUNC);
   }
 
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
@@ -635,7 +640,7 @@ class PartitionedHypergraph {
                       PartitionID to,
                       const DeltaFunction& delta_func) {
     return changeNodePart(u, from, to,
-      std::numeric_limits<HypernodeWeight>::max(), []{}, delta_func, NOOP_NOTIFY_FUNC);
+      std::numeric_limits<HypernodeWeight>::max(), []{}, delta_func);
   }
 
   template<typename GainCache, typename SuccessFunc>
@@ -654,12 +659,12 @@ class PartitionedHypergraph {
     if constexpr ( !GainCache::requires_notification_before_update ) {
       return changeNodePart(u, from, to, max_weight_to, report_success, my_delta_func);
     } else {
-      return changeNodePart(u, from, to, max_weight_to, report_success, my_delta_func,
+      return changeNodePartImpl<true>(u, from, to, max_weight_to, report_success, my_delta_func,
         [&](SynchronizedEdgeUpdate& sync_update) {
           sync_update.pin_count_in_from_part_after = pinCountInPart(sync_update.he, from) - 1;
           sync_update.pin_count_in_to_part_after = pinCountInPart(sync_update.he, to) + 1;
           gain_cache.notifyBeforeDeltaGainUpdate(*this, sync_update);
-        });
+        }, false);
     }
   }
 
@@ -668,8 +673,7 @@ class PartitionedHypergraph {
                             PartitionID from,
                             PartitionID to) {
     return changeNodePart(u, from, to,
-      std::numeric_limits<HypernodeWeight>::max(), []{},
-        NOOP_FUNC, NOOP_NOTIFY_FUNC, false);
+      std::numeric_limits<HypernodeWeight>::max(), []{}, NOOP_FUNC);
   }
 
   template<typename GainCache>
@@ -689,8 +693,12 @@ class PartitionedHypergraph {
   }
 
   // ! Returns, whether hypernode u is adjacent to a least one cut hyperedge.
+  // ! Takes constant time if the border nodes are tracked (see initializeBorderNodes()).
   bool isBorderNode(const HypernodeID u) const {
     if ( nodeDegree(u) <= HIGH_DEGREE_THRESHOLD ) {
+      if ( _border_nodes.isValid() ) {
+        return _border_nodes.isBorderNode(u);
+      }
       for ( const HyperedgeID& he : incidentEdges(u) ) {
         if ( connectivity(he) > 1 ) {
           return true;
@@ -707,13 +715,34 @@ class PartitionedHypergraph {
   }
 
   HypernodeID numIncidentCutHyperedges(const HypernodeID u) const {
-    HypernodeID num_incident_cut_hyperedges = 0;
-    for ( const HyperedgeID& he : incidentEdges(u) ) {
-      if ( connectivity(he) > 1 ) {
-        ++num_incident_cut_hyperedges;
-      }
+    if ( _border_nodes.isValid() ) {
+      return _border_nodes.numIncidentCutHyperedges(u);
     }
-    return num_incident_cut_hyperedges;
+    return numIncidentCutHyperedgesRecomputed(u);
+  }
+
+  // ####################### Border Nodes #######################
+
+  // ! Computes the number of incident cut hyperedges of all nodes. Afterwards, the counters
+  // ! and the set of border nodes are maintained incrementally on each node move, until the
+  // ! partition or the hypergraph is modified otherwise (e.g., via uncontractions).
+  void initializeBorderNodes() {
+    _border_nodes.initialize(initialNumNodes(), [&](const HypernodeID u) {
+      return nodeIsEnabled(u) ? numIncidentCutHyperedgesRecomputed(u) : 0;
+    });
+  }
+
+  bool isTrackingBorderNodes() const {
+    return _border_nodes.isValid();
+  }
+
+  // ! Calls f(u) in parallel for all nodes u incident to at least one cut hyperedge.
+  // ! Requires that the border nodes are tracked. Runs in time linear in the number
+  // ! of border nodes and must not be called concurrently with node moves.
+  template<typename F>
+  void doParallelForAllBorderNodes(const F& f) {
+    ASSERT(isTrackingBorderNodes());
+    _border_nodes.doParallelForAllBorderNodes(f);
   }
 
   // ! Number of blocks which pins of hyperedge e belongs to
@@ -731,6 +760,11 @@ class PartitionedHypergraph {
     return _con_info.pinCountInPart(e, p);
   }
 
+  // ! Prefetches the pin counts of hyperedge e (see utils/prefetch.h)
+  void prefetchPinCounts(const HyperedgeID e) const {
+    _con_info.prefetchPinCounts(e);
+  }
+
   // ! Creates a shallow copy of the connectivity set of hyperedge he
   StaticBitset& shallowCopyOfConnectivitySet(const HyperedgeID he) const {
     return _con_info.shallowCopy(he);
@@ -765,14 +799,29 @@ class PartitionedHypergraph {
   // ! setOnlyNodePart(...). In that case, block weights and pin counts in part for
   // ! each hyperedge must be initialized explicitly here.
   void initializePartition() {
+    _border_nodes.invalidate();
     tbb::parallel_invoke(
             [&] { initializeBlockWeights(); },
-            [&] { initializePinCountInPart(); }
+            [&] { initializePinCountInPart([&](const HypernodeID hn) { return partID(hn); }); }
+    );
+  }
+
+  // ! Assigns each node to the block returned by block_of(...) and initializes block
+  // ! weights and pin counts in part. Since the pin counts are computed from block_of(...)
+  // ! instead of the assigned block ids, the sweeps over the nodes and pins run concurrently
+  // ! (e.g., when projecting the partition of a coarser level).
+  template<typename F>
+  void initializePartition(const F& block_of) {
+    _border_nodes.invalidate();
+    tbb::parallel_invoke(
+            [&] { assignPartIDsAndInitializeBlockWeights(block_of); },
+            [&] { initializePinCountInPart(block_of); }
     );
   }
 
   // ! Reset partition (not thread-safe)
   void resetPartition() {
+    _border_nodes.invalidate();
     _part_ids.assign(_part_ids.size(), kInvalidPartition, false);
     for (auto& x : _part_weights) x.store(0, std::memory_order_relaxed);
 
@@ -819,6 +868,17 @@ class PartitionedHypergraph {
         success = false;
       }
     }
+
+    if ( _border_nodes.isValid() ) {
+      for (HypernodeID u : nodes()) {
+        if ( _border_nodes.numIncidentCutHyperedges(u) != numIncidentCutHyperedgesRecomputed(u) ) {
+          LOG << "Number of incident cut hyperedges of node" << u << "=>" <<
+              "Expected:" << V(numIncidentCutHyperedgesRecomputed(u)) << "," <<
+              "Actual:" << V(_border_nodes.numIncidentCutHyperedges(u));
+          success = false;
+        }
+      }
+    }
     return success;
   }
 
@@ -884,17 +944,28 @@ class PartitionedHypergraph {
   // ####################### Fixed Vertex Support #######################
 
   bool hasFixedVertices() const {
-    return _hg->hasFixedVertices();
+    return _hg->hasFixedVertices() || _movable_region;
   }
 
   bool isFixed(const HypernodeID hn) const {
-    return _hg->isFixed(hn);
+    return _hg->isFixed(hn) || ( _movable_region && !_movable_region->isSet(hn) );
   }
 
   PartitionID fixedVertexBlock(const HypernodeID hn) const {
+    if ( _movable_region && !_hg->isFixed(hn) ) {
+      return _movable_region->isSet(hn) ? kInvalidPartition : partID(hn);
+    }
     return _hg->fixedVertexBlock(hn);
   }
 
+  // ! Restricts all moves to the nodes contained in the given region. All other nodes
+  // ! are treated as if they were fixed to their current block. The region is not
+  // ! copied and must outlive the restriction (nullptr removes the restriction).
+  void setMovableRegion(const Bitset* region) {
+    ASSERT(!region || region->numBlocks() * 64 >= initialNumNodes());
+    _movable_region = region;
+  }
+
   // ####################### Memory Consumption #######################
 
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
@@ -908,6 +979,7 @@ class PartitionedHypergraph {
     parent->addChild("Part Weights", sizeof(CAtomic<HypernodeWeight>) * _k);
     parent->addChild("Part IDs", sizeof(PartitionID) * _hg->initialNumNodes());
     parent->addChild("HE Ownership", sizeof(SpinLock) * _hg->initialNumNodes());
+    parent->addChild("Border Nodes", _border_nodes.memoryConsumption());
   }
 
   // ####################### Extract Block #######################
@@ -930,23 +1002,37 @@ class PartitionedHypergraph {
     // Compactify vertex ids
     ExtractedBlock extracted_block;
     vec<HypernodeID>& hn_mapping = extracted_block.hn_mapping;
-    hn_mapping.assign(_hg->initialNumNodes(), kInvalidHypernode);
-    vec<HyperedgeID> he_mapping(_hg->initialNumEdges(), kInvalidHyperedge);
+    vec<HyperedgeID> he_mapping;
     HypernodeID num_hypernodes = 0;
     HypernodeID num_hyperedges = 0;
+    // The IDs are computed via a parallel prefix sum over the contained nodes and
+    // hyperedges, which yields the same IDs as a sequential scan in increasing ID order
     tbb::parallel_invoke([&] {
-      for ( const HypernodeID& hn : nodes() ) {
-        if ( partID(hn) == block ) {
-          hn_mapping[hn] = num_hypernodes++;
-        }
-      }
+      hn_mapping.assign(_hg->initialNumNodes(), 0);
+      doParallelForAllNodes([&](const HypernodeID& hn) {
+        hn_mapping[hn] = partID(hn) == block;
+      });
+      parallel_prefix_sum(hn_mapping.begin(), hn_mapping.end(),
+        hn_mapping.begin(), std::plus<HypernodeID>(), 0);
+      num_hypernodes = hn_mapping.empty() ? 0 : hn_mapping.back();
+      tbb::parallel_for(static_cast<HypernodeID>(0), _hg->initialNumNodes(), [&](const HypernodeID& hn) {
+        const bool contained = nodeIsEnabled(hn) && partID(hn) == block;
+        hn_mapping[hn] = contained ? hn_mapping[hn] - 1 : kInvalidHypernode;
+      });
     }, [&] {
-      for ( const HyperedgeID& he : edges() ) {
-        if ( pinCountInPart(he, block) > 1 &&
-             (cut_net_splitting || connectivity(he) == 1) ) {
-          he_mapping[he] = num_hyperedges++;
-        }
-      }
+      he_mapping.assign(_hg->initialNumEdges(), 0);
+      doParallelForAllEdges([&](const HyperedgeID& he) {
+        he_mapping[he] = pinCountInPart(he, block) > 1 &&
+          (cut_net_splitting || connectivity(he) == 1);
+      });
+      parallel_prefix_sum(he_mapping.begin(), he_mapping.end(),
+        he_mapping.begin(), std::plus<HyperedgeID>(), 0);
+      num_hyperedges = he_mapping.empty() ? 0 : he_mapping.back();
+      tbb::parallel_for(static_cast<HyperedgeID>(0), _hg->initialNumEdges(), [&](const HyperedgeID& he) {
+        const bool contained = edgeIsEnabled(he) && pinCountInPart(he, block) > 1 &&
+          (cut_net_splitting || connectivity(he) == 1);
+        he_mapping[he] = contained ? he_mapping[he] - 1 : kInvalidHyperedge;
+      });
     });
 
     // Extract plain hypergraph data for corresponding block
@@ -963,6 +1049,7 @@ class PartitionedHypergraph {
              (cut_net_splitting || connectivity(he) == 1) ) {
           ASSERT(he_mapping[he] < num_hyperedges);
           hyperedge_weight[he_mapping[he]] = edgeWeight(he);
+          edge_vector[he_mapping[he]].reserve(pinCountInPart(he, block));
           for ( const HypernodeID& pin : pins(he) ) {
             if ( partID(pin) == block ) {
               edge_vector[he_mapping[he]].push_back(hn_mapping[pin]);
@@ -1096,6 +1183,7 @@ class PartitionedHypergraph {
         tbb::parallel_for(UL(0), hes2block[p].size(), [&, p](const size_t i) {
           const HyperedgeID he = hes2block[p][i];
           he_weight[p][i] = edgeWeight(he);
+          edge_vector[p][i].reserve(pinCountInPart(he, p));
           for ( const HypernodeID& pin : pins(he) ) {
             if ( partID(pin) == p ) {
               edge_vector[p][i].push_back(hn_mapping[pin]);
@@ -1182,25 +1270,53 @@ class PartitionedHypergraph {
     );
   }
 
-  void initializePinCountInPart() {
+  template<typename F>
+  void assignPartIDsAndInitializeBlockWeights(const F& block_of) {
+    auto assign = [&](tbb::blocked_range<HypernodeID>& r) {
+      vec<HypernodeWeight> pws(_k, 0);  // this is not enumerable_thread_specific because of the static partitioner
+      for (HypernodeID u = r.begin(); u < r.end(); ++u) {
+        if ( nodeIsEnabled(u) ) {
+          const PartitionID pu = block_of(u);
+          setOnlyNodePart(u, pu);
+          pws[pu] += nodeWeight(u);
+        }
+      }
+      applyPartWeightUpdates(pws);
+    };
+
+    tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), initialNumNodes()),
+                      assign,
+                      tbb::static_partitioner()
+    );
+  }
+
+  template<typename F>
+  void initializePinCountInPart(const F& block_of) {
+    // Only the blocks that occur in a hyperedge are visited (instead of all k blocks)
     tls_enumerable_thread_specific< vec<HypernodeID> > ets_pin_count_in_part(_k, 0);
+    tls_enumerable_thread_specific< vec<PartitionID> > ets_blocks;
 
     auto assign = [&](tbb::blocked_range<HyperedgeID>& r) {
       vec<HypernodeID>& pin_counts = ets_pin_count_in_part.local();
+      vec<PartitionID>& blocks = ets_blocks.local();
       for (HyperedgeID he = r.begin(); he < r.end(); ++he) {
         if ( edgeIsEnabled(he) ) {
           for (const HypernodeID& pin : pins(he)) {
-            ++pin_counts[partID(pin)];
+            const PartitionID block = block_of(pin);
+            if ( pin_counts[block]++ == 0 ) {
+              blocks.push_back(block);
+            }
           }
 
-          for (PartitionID p = 0; p < _k; ++p) {
+          // Blocks are added in increasing order
+          std::sort(blocks.begin(), blocks.end());
+          for (const PartitionID p : blocks) {
             ASSERT(pinCountInPart(he, p) == 0);
-            if (pin_counts[p] > 0) {
-              _con_info.addBlock(he, p);
-              _con_info.setPinCountInPart(he, p, pin_counts[p]);
-            }
+            _con_info.addBlock(he, p);
+            _con_info.setPinCountInPart(he, p, pin_counts[p]);
             pin_counts[p] = 0;
           }
+          blocks.clear();
         }
       }
     };
@@ -1218,7 +1334,50 @@ class PartitionedHypergraph {
     return pcip;
   }
 
-  // ! Updates pin count in part using a spinlock.
+  // ! If has_notification is true, notify_func is called for each incident hyperedge of u
+  // ! while holding its lock and before its pin counts are updated.
+  template<bool has_notification, typename SuccessFunc>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  bool changeNodePartImpl(const HypernodeID u,
+                          PartitionID from,
+                          PartitionID to,
+                          HypernodeWeight max_weight_to,
+                          SuccessFunc&& report_success,
+                          const DeltaFunction& delta_func,
+                          const NotificationFunc& notify_func,
+                          const bool force_moving_fixed_vertices) {
+    unused(force_moving_fixed_vertices);
+    ASSERT(partID(u) == from);
+    ASSERT(from != to);
+    ASSERT(force_moving_fixed_vertices || !isFixed(u));
+    const HypernodeWeight wu = nodeWeight(u);
+    const HypernodeWeight to_weight_after = _part_weights[to].add_fetch(wu, std::memory_order_relaxed);
+    if (to_weight_after <= max_weight_to) {
+      _part_ids[u] = to;
+      _part_weights[from].fetch_sub(wu, std::memory_order_relaxed);
+      report_success();
+      SynchronizedEdgeUpdate sync_update;
+      sync_update.from = from;
+      sync_update.to = to;
+      sync_update.target_graph = _target_graph;
+      sync_update.edge_locks = &_pin_count_update_ownership;
+      for ( const HyperedgeID he : incidentEdges(u) ) {
+        updatePinCountOfHyperedge<has_notification>(he, from, to, sync_update, delta_func, notify_func);
+      }
+      return true;
+    } else {
+      _part_weights[to].fetch_sub(wu, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+
+  // ! Updates pin count in part using a spinlock. If the pin counts of a hyperedge are
+  // ! stored in one 64-bit word and neither a notification nor a snapshot for the target
+  // ! graph is required, the pin counts are updated lock-free with one CAS operation.
+  // ! The lock is still needed otherwise, since the notification and the snapshot must
+  // ! observe the same state as the pin count update.
+  template<bool has_notification>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updatePinCountOfHyperedge(const HyperedgeID he,
                                                                     const PartitionID from,
                                                                     const PartitionID to,
@@ -1229,16 +1388,71 @@ class PartitionedHypergraph {
     sync_update.he = he;
     sync_update.edge_weight = edgeWeight(he);
     sync_update.edge_size = edgeSize(he);
-    _pin_count_update_ownership[he].lock();
-    notify_func(sync_update);
-    sync_update.pin_count_in_from_part_after = decrementPinCountOfBlock(he, from);
-    sync_update.pin_count_in_to_part_after = incrementPinCountOfBlock(he, to);
+    if constexpr ( ConnectivityInformation::supports_atomic_pin_moves && !has_notification ) {
+      if ( !hasTargetGraph() && _con_info.canMovePinAtomically() ) {
+        std::tie(sync_update.pin_count_in_from_part_after, sync_update.pin_count_in_to_part_after) =
+          _con_info.movePinAtomically(he, from, to);
+        sync_update.connectivity_set_after = nullptr;
+        sync_update.pin_counts_after = nullptr;
+        updateBorderNodes(sync_update);
+        delta_func(sync_update);
+        return;
+      }
+    }
+
+    _pin_count_update_ownership[he].lock(parallel::ContentionSite::pin_count_update);
+    const auto lock_start = parallel::ContentionStats::now();
+    if constexpr ( has_notification ) {
+      notify_func(sync_update);
+    }
+    if constexpr ( ConnectivityInformation::supports_atomic_pin_moves ) {
+      if ( _con_info.canMovePinAtomically() ) {
+        // Other threads might update the pin counts of the hyperedge without holding the lock
+        std::tie(sync_update.pin_count_in_from_part_after, sync_update.pin_count_in_to_part_after) =
+          _con_info.movePinAtomically(he, from, to);
+      } else {
+        sync_update.pin_count_in_from_part_after = decrementPinCountOfBlock(he, from);
+        sync_update.pin_count_in_to_part_after = incrementPinCountOfBlock(he, to);
+      }
+    } else {
+      sync_update.pin_count_in_from_part_after = decrementPinCountOfBlock(he, from);
+      sync_update.pin_count_in_to_part_after = incrementPinCountOfBlock(he, to);
+    }
     sync_update.connectivity_set_after = hasTargetGraph() ? &deepCopyOfConnectivitySet(he) : nullptr;
     sync_update.pin_counts_after = hasTargetGraph() ? &_con_info.pinCountSnapshot(he) : nullptr;
+    parallel::ContentionStats::recordHoldTime(parallel::ContentionSite::pin_count_update, lock_start);
     _pin_count_update_ownership[he].unlock();
+    updateBorderNodes(sync_update);
     delta_func(sync_update);
   }
 
+  // ! If the border nodes are tracked and the hyperedge becomes cut or non-cut
+  // ! due to the node move, the counters of all its pins are updated
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateBorderNodes(const SynchronizedEdgeUpdate& sync_update) {
+    if ( _border_nodes.isValid() && sync_update.edge_size > 1 ) {
+      if ( sync_update.pin_count_in_from_part_after == sync_update.edge_size - 1 ) {
+        // All pins were contained in the source block before the move
+        for ( const HypernodeID& pin : pins(sync_update.he) ) {
+          _border_nodes.increment(pin);
+        }
+      } else if ( sync_update.pin_count_in_to_part_after == sync_update.edge_size ) {
+        for ( const HypernodeID& pin : pins(sync_update.he) ) {
+          _border_nodes.decrement(pin);
+        }
+      }
+    }
+  }
+
+  HypernodeID numIncidentCutHyperedgesRecomputed(const HypernodeID u) const {
+    HypernodeID num_incident_cut_hyperedges = 0;
+    for ( const HyperedgeID& he : incidentEdges(u) ) {
+      if ( connectivity(he) > 1 ) {
+        ++num_incident_cut_hyperedges;
+      }
+    }
+    return num_incident_cut_hyperedges;
+  }
+
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   HypernodeID decrementPinCountOfBlock(const HyperedgeID e, const PartitionID p) {
     ASSERT(e < _hg->initialNumEdges(), "Hyperedge" << e << "does not exist");
@@ -1279,6 +1493,9 @@ class PartitionedHypergraph {
   // ! Target graph on which this hypergraph is mapped
   const TargetGraph* _target_graph;
 
+  // ! Nodes that are allowed to move (if set, all other nodes are implicitly fixed)
+  const Bitset* _movable_region = nullptr;
+
   // ! Weight and information for all blocks.
   vec< CAtomic<HypernodeWeight> > _part_weights;
 
@@ -1291,6 +1508,9 @@ class PartitionedHypergraph {
   // ! In order to update the pin count of a hyperedge thread-safe, a thread must acquire
   // ! the ownership of a hyperedge via a CAS operation.
   Array<SpinLock> _pin_count_update_ownership;
+
+  // ! Number of incident cut hyperedges and set of border nodes (if tracked)
+  BorderNodes _border_nodes;
 };
 
 } // namespace ds
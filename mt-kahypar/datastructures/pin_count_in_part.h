@@ -35,7 +35,9 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/pin_count_layout.h"
 #include "mt-kahypar/datastructures/pin_count_snapshot.h"
+#include "mt-kahypar/utils/prefetch.h"
 
 
 namespace mt_kahypar {
@@ -48,7 +50,12 @@ namespace ds {
  * of a hyperedge). The pin counts are then stored in a compressed form where
  * each entry occupies exactly the number of bits it requires to store the
  * maximum value. To do so, we store several pin count entries in a 64-bit unsigned
- * integer.
+ * integer. For small k, each entry occupies an aligned byte, short or int lane
+ * instead, such that accesses do not require shift and mask operations
+ * (see PinCountLayout).
+ * The pin counts can also be stored in external memory with a fixed stride between
+ * the entries of consecutive hyperedges (see ConnectivityInfo, which co-locates the
+ * pin counts with the connectivity set of a hyperedge).
  * Note, this data structure is not thread-safe. Updates of a pin count entry
  * of a hyperedge must be done exclusively. Different hyperedges can be updated
  * concurrently.
@@ -64,10 +71,13 @@ class PinCountInPart {
     _num_hyperedges(0),
     _k(0),
     _max_value(0),
+    _lane_bytes(0),
     _bits_per_element(0),
     _entries_per_value(0),
     _values_per_hyperedge(0),
     _extraction_mask(0),
+    _stride(0),
+    _data(nullptr),
     _pin_count_in_part(),
     _ets_pin_counts([&] { return initPinCountSnapshot(); }) { }
 
@@ -78,10 +88,13 @@ class PinCountInPart {
     _num_hyperedges(0),
     _k(0),
     _max_value(0),
+    _lane_bytes(0),
     _bits_per_element(0),
     _entries_per_value(0),
     _values_per_hyperedge(0),
     _extraction_mask(0),
+    _stride(0),
+    _data(nullptr),
     _pin_count_in_part(),
     _ets_pin_counts([&] { return initPinCountSnapshot(); }) {
     initialize(num_hyperedges, k, max_value, assign_parallel);
@@ -94,10 +107,13 @@ class PinCountInPart {
     _num_hyperedges(other._num_hyperedges),
     _k(other._k),
     _max_value(other._max_value),
+    _lane_bytes(other._lane_bytes),
     _bits_per_element(other._bits_per_element),
     _entries_per_value(other._entries_per_value),
     _values_per_hyperedge(other._values_per_hyperedge),
     _extraction_mask(other._extraction_mask),
+    _stride(other._stride),
+    _data(other._data),
     _pin_count_in_part(std::move(other._pin_count_in_part)),
     _ets_pin_counts([&] { return initPinCountSnapshot(); }) { }
 
@@ -105,10 +121,13 @@ class PinCountInPart {
     _num_hyperedges = other._num_hyperedges;
     _k = other._k;
     _max_value = other._max_value;
+    _lane_bytes = other._lane_bytes;
     _bits_per_element = other._bits_per_element;
     _entries_per_value = other._entries_per_value;
     _values_per_hyperedge = other._values_per_hyperedge;
     _extraction_mask = other._extraction_mask;
+    _stride = other._stride;
+    _data = other._data;
     _pin_count_in_part = std::move(other._pin_count_in_part);
     _ets_pin_counts = tbb::enumerable_thread_specific<PinCountSnapshot>([&] { return initPinCountSnapshot(); });
     return *this;
@@ -121,15 +140,28 @@ class PinCountInPart {
                   const bool assign_parallel = true) {
     ASSERT(_num_hyperedges == 0);
     if ( num_hyperedges > 0 ) {
-      _num_hyperedges = num_hyperedges;
-      _k = k;
-      _max_value = max_value;
-      _bits_per_element = num_bits_per_element(max_value);
-      _entries_per_value = num_entries_per_value(k, max_value);
-      _values_per_hyperedge = num_values_per_hyperedge(k, max_value);
-      _extraction_mask = std::pow(2UL, _bits_per_element) - UL(1);
+      initializeLayout(num_hyperedges, k, max_value);
+      _stride = _values_per_hyperedge;
       _pin_count_in_part.resize("Refinement", "pin_count_in_part",
         num_hyperedges * _values_per_hyperedge, true, assign_parallel);
+      _data = _pin_count_in_part.data();
+    }
+  }
+
+  // ! Initializes the data structure on external (zero-initialized) memory. The pin
+  // ! counts of hyperedge he start at data + he * stride. The memory is owned
+  // ! (and reset) by the caller.
+  void initialize(const HyperedgeID num_hyperedges,
+                  const PartitionID k,
+                  const HypernodeID max_value,
+                  Value* data,
+                  const size_t stride) {
+    ASSERT(_num_hyperedges == 0);
+    if ( num_hyperedges > 0 ) {
+      initializeLayout(num_hyperedges, k, max_value);
+      ASSERT(stride >= _values_per_hyperedge);
+      _stride = stride;
+      _data = data;
     }
   }
 
@@ -140,19 +172,30 @@ class PinCountInPart {
   // ! Returns a snapshot of the connectivity set of hyperedge he
   inline PinCountSnapshot& snapshot(const HyperedgeID he) {
     PinCountSnapshot& cpy = _ets_pin_counts.local();
-    cpy.snapshot(_pin_count_in_part.data() + he * _values_per_hyperedge);
+    cpy.snapshot(_data + he * _stride);
     return cpy;
   }
 
+  // ! Prefetches the pin count values of hyperedge he (see utils/prefetch.h)
+  inline void prefetch(const HyperedgeID he) const {
+    utils::prefetch(_data + he * _stride);
+  }
+
   // ! Returns the pin count of the hyperedge in the corresponding block
   inline HypernodeID pinCountInPart(const HyperedgeID he,
                                     const PartitionID id) const {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
+    switch ( _lane_bytes ) {
+      case 1: return lanes<PinCountLayout::Lane8>(he)[id];
+      case 2: return lanes<PinCountLayout::Lane16>(he)[id];
+      case 4: return lanes<PinCountLayout::Lane32>(he)[id];
+      default: break;
+    }
+    const size_t value_pos = he * _stride + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
-    return (_pin_count_in_part[value_pos] & mask) >> bit_pos;
+    return (_data[value_pos] & mask) >> bit_pos;
   }
 
   // ! Sets the pin count of the hyperedge in the corresponding block to value
@@ -161,9 +204,16 @@ class PinCountInPart {
                                 const HypernodeID value) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
+    ASSERT(value <= _max_value);
+    switch ( _lane_bytes ) {
+      case 1: lanes<PinCountLayout::Lane8>(he)[id] = value; return;
+      case 2: lanes<PinCountLayout::Lane16>(he)[id] = value; return;
+      case 4: lanes<PinCountLayout::Lane32>(he)[id] = value; return;
+      default: break;
+    }
+    const size_t value_pos = he * _stride + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
-    updateEntry(_pin_count_in_part[value_pos], bit_pos, value);
+    updateEntry(_data[value_pos], bit_pos, value);
   }
 
   // ! Increments the pin count of the hyperedge in the corresponding block
@@ -171,12 +221,18 @@ class PinCountInPart {
                                              const PartitionID id) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
+    ASSERT(pinCountInPart(he, id) + 1 <= _max_value);
+    switch ( _lane_bytes ) {
+      case 1: return ++lanes<PinCountLayout::Lane8>(he)[id];
+      case 2: return ++lanes<PinCountLayout::Lane16>(he)[id];
+      case 4: return ++lanes<PinCountLayout::Lane32>(he)[id];
+      default: break;
+    }
+    const size_t value_pos = he * _stride + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
-    Value& current_value = _pin_count_in_part[value_pos];
+    Value& current_value = _data[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
-    ASSERT(pin_count_in_part + 1 <= _max_value);
     updateEntry(current_value, bit_pos, pin_count_in_part + 1);
     return pin_count_in_part + 1;
   }
@@ -186,16 +242,52 @@ class PinCountInPart {
                                              const PartitionID id) {
     ASSERT(he < _num_hyperedges);
     ASSERT(id != kInvalidPartition && id < _k);
-    const size_t value_pos = he * _values_per_hyperedge + id / _entries_per_value;
+    ASSERT(pinCountInPart(he, id) > UL(0));
+    switch ( _lane_bytes ) {
+      case 1: return --lanes<PinCountLayout::Lane8>(he)[id];
+      case 2: return --lanes<PinCountLayout::Lane16>(he)[id];
+      case 4: return --lanes<PinCountLayout::Lane32>(he)[id];
+      default: break;
+    }
+    const size_t value_pos = he * _stride + id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
-    Value& current_value = _pin_count_in_part[value_pos];
+    Value& current_value = _data[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
-    ASSERT(pin_count_in_part > UL(0));
     updateEntry(current_value, bit_pos, pin_count_in_part - 1);
     return pin_count_in_part - 1;
   }
 
+  // ! True, if the pin counts of all blocks of a hyperedge are stored in one 64-bit word
+  inline bool isStoredInOneWord() const {
+    return _values_per_hyperedge == 1;
+  }
+
+  // ! Decrements the pin count of block from and increments the pin count of block to
+  // ! with one CAS operation. Requires that the pin counts of a hyperedge are stored in
+  // ! one 64-bit word. Returns the pin counts of both blocks after the update.
+  inline std::pair<HypernodeID, HypernodeID> movePinAtomically(const HyperedgeID he,
+                                                               const PartitionID from,
+                                                               const PartitionID to) {
+    ASSERT(he < _num_hyperedges);
+    ASSERT(isStoredInOneWord());
+    ASSERT(from != kInvalidPartition && from < _k);
+    ASSERT(to != kInvalidPartition && to < _k);
+    const size_t from_bit_pos = from * _bits_per_element;
+    const size_t to_bit_pos = to * _bits_per_element;
+    Value* word = _data + he * _stride;
+    Value current = __atomic_load_n(word, __ATOMIC_RELAXED);
+    Value desired = 0;
+    do {
+      ASSERT(( ( current >> from_bit_pos ) & _extraction_mask ) > 0);
+      ASSERT(( ( current >> to_bit_pos ) & _extraction_mask ) < _max_value);
+      desired = current - ( UL(1) << from_bit_pos ) + ( UL(1) << to_bit_pos );
+    } while ( !__atomic_compare_exchange_n(word, &current, desired,
+                false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) );
+    return std::make_pair(( desired >> from_bit_pos ) & _extraction_mask,
+                          ( desired >> to_bit_pos ) & _extraction_mask);
+  }
+
   // ! Returns the size in bytes of this data structure
   size_t size_in_bytes() const {
     return sizeof(Value) * _pin_count_in_part.size();
@@ -203,6 +295,7 @@ class PinCountInPart {
 
   void freeInternalData() {
     parallel::free(_pin_count_in_part);
+    _data = nullptr;
   }
 
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
@@ -213,10 +306,35 @@ class PinCountInPart {
   static size_t num_elements(const HyperedgeID num_hyperedges,
                              const PartitionID k,
                              const HypernodeID max_value) {
-    return num_hyperedges * num_values_per_hyperedge(k, max_value);
+    return num_hyperedges * PinCountLayout::num_values_per_hyperedge(k, max_value);
   }
 
  private:
+  template<typename Lane>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE const Lane* lanes(const HyperedgeID he) const {
+    ASSERT(_lane_bytes == sizeof(Lane));
+    return reinterpret_cast<const Lane*>(_data + he * _stride);
+  }
+
+  template<typename Lane>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE Lane* lanes(const HyperedgeID he) {
+    ASSERT(_lane_bytes == sizeof(Lane));
+    return reinterpret_cast<Lane*>(_data + he * _stride);
+  }
+
+  void initializeLayout(const HyperedgeID num_hyperedges,
+                        const PartitionID k,
+                        const HypernodeID max_value) {
+    _num_hyperedges = num_hyperedges;
+    _k = k;
+    _max_value = max_value;
+    _lane_bytes = PinCountLayout::num_lane_bytes(k, max_value);
+    _bits_per_element = PinCountLayout::num_bits_per_element(k, max_value);
+    _entries_per_value = PinCountLayout::num_entries_per_value(k, max_value);
+    _values_per_hyperedge = PinCountLayout::num_values_per_hyperedge(k, max_value);
+    _extraction_mask = PinCountLayout::extraction_mask(_bits_per_element);
+  }
+
   inline void updateEntry(Value& value,
                           const size_t bit_pos,
                           const Value new_value) {
@@ -230,32 +348,18 @@ class PinCountInPart {
     return PinCountSnapshot(_k, _max_value);
   }
 
-  static size_t num_values_per_hyperedge(const PartitionID k,
-                                         const HypernodeID max_value) {
-    const size_t entries_per_value = num_entries_per_value(k, max_value);
-    ASSERT(entries_per_value <= static_cast<size_t>(k));
-    return k / entries_per_value + (k % entries_per_value!= 0);
-  }
-
-  static size_t num_entries_per_value(const PartitionID k,
-                                      const HypernodeID max_value) {
-    const size_t bits_per_element = num_bits_per_element(max_value);
-    const size_t bits_per_value = sizeof(Value) * 8UL;
-    ASSERT(bits_per_element <= bits_per_value);
-    return std::min(bits_per_value / bits_per_element, static_cast<size_t>(k));
-  }
-
-  static size_t num_bits_per_element(const HypernodeID max_value) {
-    return std::ceil(std::log2(static_cast<double>(max_value + 1)));
-  }
-
   HyperedgeID _num_hyperedges;
   PartitionID _k;
   HypernodeID _max_value;
+  size_t _lane_bytes;
   size_t _bits_per_element;
   size_t _entries_per_value;
   size_t _values_per_hyperedge;
   Value _extraction_mask;
+  // ! Number of values between the pin counts of consecutive hyperedges
+  size_t _stride;
+  // ! Points to _pin_count_in_part or to external memory
+  Value* _data;
   Array<Value> _pin_count_in_part;
   tbb::enumerable_thread_specific<PinCountSnapshot> _ets_pin_counts;
 
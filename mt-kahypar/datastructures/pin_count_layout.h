@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/*!
+ * Determines how the pin counts of a hyperedge are stored in 64-bit words.
+ * If the pin counts of all k blocks fit into one cache line when each entry
+ * occupies a full byte, short or int lane, entries are stored in aligned lanes.
+ * Reading or updating an entry is then a plain load or store without any
+ * shift and mask operations. The pin counts of a hyperedge are stored
+ * contiguously, such that loops over all blocks can be vectorized by the
+ * compiler. Otherwise, entries use exactly the number of bits required to
+ * store the maximum value and are packed into the 64-bit words.
+ * The lane layout is equivalent to the packed layout with an element width
+ * of 8, 16 or 32 bits on little-endian machines.
+ */
+class PinCountLayout {
+
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+ public:
+  using Value = uint64_t;
+
+  // Lane types that are allowed to alias the underlying 64-bit words
+  typedef uint8_t Lane8;
+  typedef uint16_t __attribute__((__may_alias__)) Lane16;
+  typedef uint32_t __attribute__((__may_alias__)) Lane32;
+
+  // ! Returns the width of a lane in bytes or zero if entries are packed
+  static size_t num_lane_bytes(const PartitionID k,
+                               const HypernodeID max_value) {
+    const size_t lane_bytes = max_value <= std::numeric_limits<uint8_t>::max() ? 1 :
+      ( max_value <= std::numeric_limits<uint16_t>::max() ? 2 : 4 );
+    return static_cast<size_t>(k) * lane_bytes <= CACHE_LINE_SIZE ? lane_bytes : 0;
+  }
+
+  static size_t num_bits_per_element(const PartitionID k,
+                                     const HypernodeID max_value) {
+    const size_t lane_bytes = num_lane_bytes(k, max_value);
+    if ( lane_bytes > 0 ) {
+      return lane_bytes * 8UL;
+    }
+    return std::ceil(std::log2(static_cast<double>(max_value + 1)));
+  }
+
+  static size_t num_entries_per_value(const PartitionID k,
+                                      const HypernodeID max_value) {
+    const size_t bits_per_element = num_bits_per_element(k, max_value);
+    const size_t bits_per_value = sizeof(Value) * 8UL;
+    ASSERT(bits_per_element <= bits_per_value);
+    return std::min(bits_per_value / bits_per_element, static_cast<size_t>(k));
+  }
+
+  static size_t num_values_per_hyperedge(const PartitionID k,
+                                         const HypernodeID max_value) {
+    const size_t entries_per_value = num_entries_per_value(k, max_value);
+    ASSERT(entries_per_value <= static_cast<size_t>(k));
+    return k / entries_per_value + (k % entries_per_value!= 0);
+  }
+
+  static Value extraction_mask(const size_t bits_per_element) {
+    return bits_per_element >= sizeof(Value) * 8UL ?
+      std::numeric_limits<Value>::max() : (UL(1) << bits_per_element) - UL(1);
+  }
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
@@ -34,6 +34,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/pin_count_layout.h"
 
 
 namespace mt_kahypar {
@@ -50,12 +51,12 @@ class PinCountSnapshot {
                    const HypernodeID max_value) :
     _k(k),
     _max_value(max_value),
-    _bits_per_element(num_bits_per_element(max_value)),
-    _entries_per_value(num_entries_per_value(k, max_value)),
-    _extraction_mask(0),
+    _lane_bytes(PinCountLayout::num_lane_bytes(k, max_value)),
+    _bits_per_element(PinCountLayout::num_bits_per_element(k, max_value)),
+    _entries_per_value(PinCountLayout::num_entries_per_value(k, max_value)),
+    _extraction_mask(PinCountLayout::extraction_mask(_bits_per_element)),
     _pin_counts() {
-    _extraction_mask = std::pow(2UL, _bits_per_element) - UL(1);
-    _pin_counts.assign(num_values_per_hyperedge(k, max_value), 0);
+    _pin_counts.assign(PinCountLayout::num_values_per_hyperedge(k, max_value), 0);
   }
 
   PinCountSnapshot(const PinCountSnapshot&) = delete;
@@ -64,6 +65,7 @@ class PinCountSnapshot {
   PinCountSnapshot(PinCountSnapshot&& other) :
     _k(other._k),
     _max_value(other._max_value),
+    _lane_bytes(other._lane_bytes),
     _bits_per_element(other._bits_per_element),
     _entries_per_value(other._entries_per_value),
     _extraction_mask(other._extraction_mask),
@@ -72,6 +74,7 @@ class PinCountSnapshot {
   PinCountSnapshot & operator= (PinCountSnapshot&& other) {
     _k = other._k;
     _max_value = other._max_value;
+    _lane_bytes = other._lane_bytes;
     _bits_per_element = other._bits_per_element;
     _entries_per_value = other._entries_per_value;
     _extraction_mask = other._extraction_mask;
@@ -90,6 +93,12 @@ class PinCountSnapshot {
   // ! Returns the pin count of the hyperedge in the corresponding block
   inline HypernodeID pinCountInPart(const PartitionID id) const {
     ASSERT(id != kInvalidPartition && id < _k);
+    switch ( _lane_bytes ) {
+      case 1: return lanes<PinCountLayout::Lane8>()[id];
+      case 2: return lanes<PinCountLayout::Lane16>()[id];
+      case 4: return lanes<PinCountLayout::Lane32>()[id];
+      default: break;
+    }
     const size_t value_pos = id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
@@ -100,6 +109,13 @@ class PinCountSnapshot {
   inline void setPinCountInPart(const PartitionID id,
                                 const HypernodeID value) {
     ASSERT(id != kInvalidPartition && id < _k);
+    ASSERT(value <= _max_value);
+    switch ( _lane_bytes ) {
+      case 1: lanes<PinCountLayout::Lane8>()[id] = value; return;
+      case 2: lanes<PinCountLayout::Lane16>()[id] = value; return;
+      case 4: lanes<PinCountLayout::Lane32>()[id] = value; return;
+      default: break;
+    }
     const size_t value_pos = id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     updateEntry(_pin_counts[value_pos], bit_pos, value);
@@ -108,12 +124,18 @@ class PinCountSnapshot {
   // ! Increments the pin count of the hyperedge in the corresponding block
   inline HypernodeID incrementPinCountInPart(const PartitionID id) {
     ASSERT(id != kInvalidPartition && id < _k);
+    ASSERT(pinCountInPart(id) + 1 <= _max_value);
+    switch ( _lane_bytes ) {
+      case 1: return ++lanes<PinCountLayout::Lane8>()[id];
+      case 2: return ++lanes<PinCountLayout::Lane16>()[id];
+      case 4: return ++lanes<PinCountLayout::Lane32>()[id];
+      default: break;
+    }
     const size_t value_pos = id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
     Value& current_value = _pin_counts[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
-    ASSERT(pin_count_in_part + 1 <= _max_value);
     updateEntry(current_value, bit_pos, pin_count_in_part + 1);
     return pin_count_in_part + 1;
   }
@@ -121,17 +143,35 @@ class PinCountSnapshot {
   // ! Decrements the pin count of the hyperedge in the corresponding block
   inline HypernodeID decrementPinCountInPart(const PartitionID id) {
     ASSERT(id != kInvalidPartition && id < _k);
+    ASSERT(pinCountInPart(id) > UL(0));
+    switch ( _lane_bytes ) {
+      case 1: return --lanes<PinCountLayout::Lane8>()[id];
+      case 2: return --lanes<PinCountLayout::Lane16>()[id];
+      case 4: return --lanes<PinCountLayout::Lane32>()[id];
+      default: break;
+    }
     const size_t value_pos = id / _entries_per_value;
     const size_t bit_pos = (id % _entries_per_value) * _bits_per_element;
     const Value mask = _extraction_mask << bit_pos;
     Value& current_value = _pin_counts[value_pos];
     Value pin_count_in_part = (current_value & mask) >> bit_pos;
-    ASSERT(pin_count_in_part > UL(0));
     updateEntry(current_value, bit_pos, pin_count_in_part - 1);
     return pin_count_in_part - 1;
   }
 
  private:
+  template<typename Lane>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE const Lane* lanes() const {
+    ASSERT(_lane_bytes == sizeof(Lane));
+    return reinterpret_cast<const Lane*>(_pin_counts.data());
+  }
+
+  template<typename Lane>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE Lane* lanes() {
+    ASSERT(_lane_bytes == sizeof(Lane));
+    return reinterpret_cast<Lane*>(_pin_counts.data());
+  }
+
   inline void updateEntry(Value& value,
                           const size_t bit_pos,
                           const Value new_value) {
@@ -141,27 +181,9 @@ class PinCountSnapshot {
     value = (value & zero_mask) | value_mask;
   }
 
-  static size_t num_values_per_hyperedge(const PartitionID k,
-                                         const HypernodeID max_value) {
-    const size_t entries_per_value = num_entries_per_value(k, max_value);
-    ASSERT(entries_per_value <= static_cast<size_t>(k));
-    return k / entries_per_value + (k % entries_per_value!= 0);
-  }
-
-  static size_t num_entries_per_value(const PartitionID k,
-                                      const HypernodeID max_value) {
-    const size_t bits_per_element = num_bits_per_element(max_value);
-    const size_t bits_per_value = sizeof(Value) * size_t(8);
-    ASSERT(bits_per_element <= bits_per_value);
-    return std::min(bits_per_value / bits_per_element, static_cast<size_t>(k));
-  }
-
-  static size_t num_bits_per_element(const HypernodeID max_value) {
-    return std::ceil(std::log2(static_cast<double>(max_value + 1)));
-  }
-
   PartitionID _k;
   HypernodeID _max_value;
+  size_t _lane_bytes;
   size_t _bits_per_element;
   size_t _entries_per_value;
   Value _extraction_mask;
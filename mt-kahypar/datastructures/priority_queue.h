@@ -31,6 +31,9 @@
 #include <functional>
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
+
+#include "tbb/cache_aligned_allocator.h"
 
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
@@ -41,31 +44,40 @@ static constexpr PosT invalid_position = std::numeric_limits<PosT>::max();
 
 namespace ds {
 
+/**
+ * Addressable d-ary heap. For arity > 2, the heap array is allocated cache-line aligned
+ * and shifted by arity - 1 padding elements such that the children of a node start
+ * at a multiple of arity in the array. If arity * sizeof(HeapElement) divides the cache
+ * line size (e.g., 4-ary or 8-ary heaps with 32-bit keys and ids), all children of a node
+ * are located in the same cache line and siftDown touches one cache line per level.
+ */
 template<typename KeyT, typename IdT, typename Comparator = std::less<KeyT>, uint32_t arity = 4>
 class Heap {
 static constexpr bool enable_heavy_assert = false;
+// ! Number of unused elements at the front of the heap array
+static constexpr PosT PADDING = arity > 2 ? arity - 1 : 0;
 public:
   static_assert(arity > 1);
 
   explicit Heap(PosT* positions, size_t positions_size) :
     comp(),
-    heap(),
+    heap(PADDING),
     positions(positions),
     positions_size(positions_size) { }
 
   IdT top() const {
-    return heap[0].id;
+    return element(0).id;
   }
 
   KeyT topKey() const {
-    return heap[0].key;
+    return element(0).key;
   }
 
   void deleteTop() {
     assert(!empty());
-    positions[heap[0].id] = invalid_position;
+    positions[element(0).id] = invalid_position;
     positions[heap.back().id] = 0;
-    heap[0] = heap.back();
+    element(0) = heap.back();
     heap.pop_back();
     if (!empty()) {
       siftDown(0);
@@ -84,8 +96,8 @@ public:
   void remove(const IdT e) {
     assert(!empty() && contains(e));
     PosT pos = positions[e];
-    const KeyT removedKey = heap[pos].key, lastKey = heap.back().key;
-    heap[pos] = heap.back();
+    const KeyT removedKey = element(pos).key, lastKey = heap.back().key;
+    element(pos) = heap.back();
     positions[heap.back().id] = pos;
     positions[e] = invalid_position;
     heap.pop_back();
@@ -103,8 +115,8 @@ public:
   void increaseKey(const IdT e, const KeyT newKey) {
     assert(contains(e));
     const PosT pos = positions[e];
-    assert(comp(heap[pos].key, newKey));
-    heap[pos].key = newKey;
+    assert(comp(element(pos).key, newKey));
+    element(pos).key = newKey;
     siftUp(pos);
   }
 
@@ -112,24 +124,24 @@ public:
   void decreaseKey(const IdT e, const KeyT newKey) {
     assert(contains(e));
     const PosT pos = positions[e];
-    assert(comp(newKey, heap[pos].key));
-    heap[pos].key = newKey;
+    assert(comp(newKey, element(pos).key));
+    element(pos).key = newKey;
     siftDown(pos);
   }
 
   void adjustKey(const IdT e, const KeyT newKey) {
     assert(contains(e));
     const PosT pos = positions[e];
-    if (comp(heap[pos].key, newKey)) {
+    if (comp(element(pos).key, newKey)) {
       increaseKey(e, newKey);
-    } else if (comp(newKey, heap[pos].key)) {
+    } else if (comp(newKey, element(pos).key)) {
       decreaseKey(e, newKey);
     }
   }
 
   KeyT getKey(const IdT e) const {
     assert(contains(e));
-    return heap[positions[e]].key;
+    return element(positions[e]).key;
   }
 
   void insertOrAdjustKey(const IdT e, const KeyT newKey) {
@@ -141,16 +153,16 @@ public:
   }
 
   void clear() {
-    heap.clear();
+    heap.resize(PADDING);
   }
 
   bool contains(const IdT e) const {
     assert(fits(e));
-    return positions[e] < heap.size() && heap[positions[e]].id == e;
+    return positions[e] < size() && element(positions[e]).id == e;
   }
 
   PosT size() const {
-    return static_cast<PosT>(heap.size());
+    return static_cast<PosT>(heap.size() - PADDING);
   }
 
   bool empty() const {
@@ -158,15 +170,15 @@ public:
   }
 
   KeyT keyAtPos(const PosT pos) const {
-    return heap[pos].key;
+    return element(pos).key;
   }
 
   KeyT keyOf(const IdT id) const {
-    return heap[positions[id]].key;
+    return element(positions[id]).key;
   }
 
   IdT at(const PosT pos) const {
-    return heap[pos].id;
+    return element(pos).id;
   }
 
   void setHandle(PosT* pos, size_t pos_size) {
@@ -177,7 +189,7 @@ public:
 
   void print() {
     for (PosT i = 0; i < size(); ++i) {
-      std::cout << "(" << heap[i].id << "," << heap[i].key << ")" << " ";
+      std::cout << "(" << element(i).id << "," << element(i).key << ")" << " ";
     }
     std::cout << std::endl;
   }
@@ -191,8 +203,8 @@ protected:
 
   bool isHeap() const {
     for (PosT i = 1; i < size(); ++i) {
-      if (comp(heap[parent(i)].key, heap[i].key)) {
-        LOG << "heap property violation" << V(i) << V(parent(i)) << V(arity) << V(heap[i].key) << V(heap[parent(i)].key);
+      if (comp(element(parent(i)).key, element(i).key)) {
+        LOG << "heap property violation" << V(i) << V(parent(i)) << V(arity) << V(element(i).key) << V(element(parent(i)).key);
         return false;
       }
     }
@@ -201,9 +213,9 @@ protected:
 
   bool positionsMatch() const {
     for (PosT i = 0; i < size(); ++i) {
-      assert(size_t(heap[i].id) < positions_size);
-      if (positions[heap[i].id] != i) {
-        LOG << "position mismatch" << V(heap.size()) << V(i) << V(heap[i].id) << V(positions[heap[i].id]) << V(positions_size);
+      assert(size_t(element(i).id) < positions_size);
+      if (positions[element(i).id] != i) {
+        LOG << "position mismatch" << V(size()) << V(i) << V(element(i).id) << V(positions[element(i).id]) << V(positions_size);
         return false;
       }
     }
@@ -223,27 +235,27 @@ protected:
   }
 
   void siftUp(PosT pos) {
-    const KeyT k = heap[pos].key;
-    const IdT id = heap[pos].id;
+    const KeyT k = element(pos).key;
+    const IdT id = element(pos).id;
 
     PosT parent_pos = parent(pos);
-    while (pos > 0 && comp(heap[parent_pos].key, k)) {    // eliminate pos > 0 check by a sentinel at position zero?
-      positions[ heap[parent_pos].id ] = pos;
-      heap[pos] = heap[parent_pos];
+    while (pos > 0 && comp(element(parent_pos).key, k)) {    // eliminate pos > 0 check by a sentinel at position zero?
+      positions[ element(parent_pos).id ] = pos;
+      element(pos) = element(parent_pos);
       pos = parent_pos;
       parent_pos = parent(pos);
     }
     positions[id] = pos;
-    heap[pos].id = id;
-    heap[pos].key = k;
+    element(pos).id = id;
+    element(pos).key = k;
 
     //HEAVY_REFINEMENT_ASSERT(isHeap());
     //HEAVY_REFINEMENT_ASSERT(positionsMatch());
   }
 
   void siftDown(PosT pos) {
-    const KeyT k = heap[pos].key;
-    const IdT id = heap[pos].id;
+    const KeyT k = element(pos).key;
+    const IdT id = element(pos).id;
     const PosT initial_pos = pos;
 
     PosT first = firstChild(pos);
@@ -252,13 +264,13 @@ protected:
 
       if constexpr (arity > 2) {
         largestChild = first;
-        KeyT largestChildKey = heap[largestChild].key;
+        KeyT largestChildKey = element(largestChild).key;
 
         // find child with largest key for MaxHeap / smallest key for MinHeap
         const PosT firstInvalid = std::min(size(), firstChild(pos + 1));
         for (PosT c = first + 1; c < firstInvalid; ++c) {
-          if ( comp(largestChildKey, heap[c].key) ) {
-            largestChildKey = heap[c].key;
+          if ( comp(largestChildKey, element(c).key) ) {
+            largestChildKey = element(c).key;
             largestChild = c;
           }
         }
@@ -271,7 +283,7 @@ protected:
         assert(arity == 2);
 
         const PosT second = std::min(first + 1, size() - 1);    // TODO this branch is not cool. maybe make the while loop condition secondChild(pos) < size() ?
-        const KeyT k1 = heap[first].key, k2 = heap[second].key;
+        const KeyT k1 = element(first).key, k2 = element(second).key;
         const bool c2IsLarger = comp(k1, k2);
         const KeyT largestChildKey = c2IsLarger ? k2 : k1;
         if (comp(largestChildKey, k) || largestChildKey == k) {
@@ -280,16 +292,16 @@ protected:
         largestChild = c2IsLarger ? second : first;
       }
 
-      positions[ heap[largestChild].id ] = pos;
-      heap[pos] = heap[largestChild];
+      positions[ element(largestChild).id ] = pos;
+      element(pos) = element(largestChild);
       pos = largestChild;
       first = firstChild(pos);
     }
 
     if (pos != initial_pos) {
       positions[id] = pos;
-      heap[pos].key = k;
-      heap[pos].id = id;
+      element(pos).key = k;
+      element(pos).id = id;
     }
 
     //HEAVY_REFINEMENT_ASSERT(isHeap());
@@ -301,9 +313,20 @@ protected:
     IdT id;
   };
 
-  Comparator comp;                // comp(heap[parent(pos)].key, heap[pos].key) returns true if the element at pos should move upward --> comp = std::less for MaxHeaps
-                                  // similarly comp(heap[child(pos)].key, heap[pos].key) returns false if the element at pos should move downward
-  vec<HeapElement> heap;
+  using Storage = std::conditional_t<(arity > 2),
+    std::vector<HeapElement, tbb::cache_aligned_allocator<HeapElement>>, vec<HeapElement>>;
+
+  HeapElement& element(const PosT pos) {
+    return heap[pos + PADDING];
+  }
+
+  const HeapElement& element(const PosT pos) const {
+    return heap[pos + PADDING];
+  }
+
+  Comparator comp;                // comp(element(parent(pos)).key, element(pos).key) returns true if the element at pos should move upward --> comp = std::less for MaxHeaps
+                                  // similarly comp(element(child(pos)).key, element(pos).key) returns false if the element at pos should move downward
+  Storage heap;
   PosT* positions;
   size_t positions_size;
 };
@@ -336,8 +359,8 @@ public:
   }
 };
 
-template<typename KeyT, typename IdT>
-using MaxHeap = Heap<KeyT, IdT, std::less<KeyT>, 2>;
+template<typename KeyT, typename IdT, uint32_t arity = 2>
+using MaxHeap = Heap<KeyT, IdT, std::less<KeyT>, arity>;
 
 }
 }
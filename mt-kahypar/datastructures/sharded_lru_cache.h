@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/hash.h"
+#include "mt-kahypar/utils/memory_tree.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+/**
+ * Concurrent cache with a fixed memory budget that maps 64-bit fingerprints to values.
+ * The cache is split into shards, each protected by its own spin lock. Within a shard,
+ * the cache is set-associative: a fingerprint can only be stored in one of
+ * ASSOCIATIVITY slots of its bucket. If all slots are occupied, the least recently
+ * used entry of the bucket is evicted. The fingerprints are stored instead of the
+ * actual keys, so two keys with the same fingerprint are considered equal.
+ */
+template<typename Value>
+class ShardedLRUCache {
+
+  static constexpr size_t ASSOCIATIVITY = 4;
+  static constexpr uint32_t EMPTY = 0;
+
+  struct Entry {
+    uint64_t fingerprint;
+    Value value;
+    // ! Timestamp of the last access, EMPTY if the slot is unused
+    uint32_t last_access;
+  };
+
+  struct alignas(64) Shard {
+    Shard() :
+      lock(),
+      entries(),
+      clock(EMPTY),
+      size(0),
+      hits(0),
+      misses(0) { }
+
+    uint32_t nextTimestamp() {
+      if ( ++clock == EMPTY ) ++clock;
+      return clock;
+    }
+
+    SpinLock lock;
+    std::unique_ptr<Entry[]> entries;
+    uint32_t clock;
+    size_t size;
+    size_t hits;
+    size_t misses;
+  };
+
+ public:
+  ShardedLRUCache() :
+    _num_shards(0),
+    _num_buckets_per_shard(0),
+    _shards(nullptr) { }
+
+  ShardedLRUCache(const ShardedLRUCache&) = delete;
+  ShardedLRUCache & operator= (const ShardedLRUCache &) = delete;
+
+  ShardedLRUCache(ShardedLRUCache&&) = default;
+  ShardedLRUCache & operator= (ShardedLRUCache &&) = default;
+
+  // ! Allocates the cache such that it consumes at most max_size_in_bytes.
+  // ! The number of shards and buckets are rounded down to the next power of two.
+  void initialize(const size_t max_size_in_bytes, const size_t num_shards) {
+    _num_shards = round_down_to_power_of_two(std::max(num_shards, UL(1)));
+    const size_t max_entries_per_shard = max_size_in_bytes / (_num_shards * sizeof(Entry));
+    _num_buckets_per_shard = round_down_to_power_of_two(
+      std::max(max_entries_per_shard / ASSOCIATIVITY, UL(1)));
+    _shards = std::make_unique<Shard[]>(_num_shards);
+    for ( size_t i = 0; i < _num_shards; ++i ) {
+      _shards[i].entries = std::make_unique<Entry[]>(_num_buckets_per_shard * ASSOCIATIVITY);
+      clear(_shards[i]);
+    }
+  }
+
+  // ! Maximum number of entries that can be stored in the cache
+  size_t capacity() const {
+    return _num_shards * _num_buckets_per_shard * ASSOCIATIVITY;
+  }
+
+  // ! Returns true and writes the cached value to value, if the fingerprint is contained
+  bool find(const uint64_t fingerprint, Value& value) {
+    ASSERT(_shards);
+    const uint64_t hash = hashing::integer::hash64(fingerprint);
+    Shard& shard = _shards[shardIndex(hash)];
+    Entry* bucket = shard.entries.get() + bucketIndex(hash) * ASSOCIATIVITY;
+    bool found = false;
+    shard.lock.lock();
+    for ( size_t i = 0; i < ASSOCIATIVITY; ++i ) {
+      Entry& entry = bucket[i];
+      if ( entry.last_access != EMPTY && entry.fingerprint == fingerprint ) {
+        entry.last_access = shard.nextTimestamp();
+        value = entry.value;
+        found = true;
+        break;
+      }
+    }
+    found ? ++shard.hits : ++shard.misses;
+    shard.lock.unlock();
+    return found;
+  }
+
+  // ! Inserts the value for the fingerprint into the cache. If the bucket is full,
+  // ! the least recently used entry is replaced.
+  void insert(const uint64_t fingerprint, const Value& value) {
+    ASSERT(_shards);
+    const uint64_t hash = hashing::integer::hash64(fingerprint);
+    Shard& shard = _shards[shardIndex(hash)];
+    Entry* bucket = shard.entries.get() + bucketIndex(hash) * ASSOCIATIVITY;
+    shard.lock.lock();
+    Entry* target = bucket;
+    for ( size_t i = 0; i < ASSOCIATIVITY; ++i ) {
+      Entry& entry = bucket[i];
+      if ( entry.last_access != EMPTY && entry.fingerprint == fingerprint ) {
+        // Another thread has already inserted the fingerprint
+        target = &entry;
+        break;
+      } else if ( entry.last_access == EMPTY ) {
+        if ( target->last_access != EMPTY ) {
+          target = &entry;
+        }
+      } else if ( target->last_access != EMPTY &&
+                  isOlder(entry.last_access, target->last_access, shard.clock) ) {
+        target = &entry;
+      }
+    }
+    if ( target->last_access == EMPTY ) {
+      ++shard.size;
+    }
+    target->fingerprint = fingerprint;
+    target->value = value;
+    target->last_access = shard.nextTimestamp();
+    shard.lock.unlock();
+  }
+
+  // ! Number of entries currently stored in the cache (not thread-safe)
+  size_t size() const {
+    size_t size = 0;
+    for ( size_t i = 0; i < _num_shards; ++i ) size += _shards[i].size;
+    return size;
+  }
+
+  // ! Number of successful lookups (not thread-safe)
+  size_t hits() const {
+    size_t hits = 0;
+    for ( size_t i = 0; i < _num_shards; ++i ) hits += _shards[i].hits;
+    return hits;
+  }
+
+  // ! Number of unsuccessful lookups (not thread-safe)
+  size_t misses() const {
+    size_t misses = 0;
+    for ( size_t i = 0; i < _num_shards; ++i ) misses += _shards[i].misses;
+    return misses;
+  }
+
+  void resetStats() {
+    for ( size_t i = 0; i < _num_shards; ++i ) {
+      _shards[i].hits = 0;
+      _shards[i].misses = 0;
+    }
+  }
+
+  void clear() {
+    for ( size_t i = 0; i < _num_shards; ++i ) {
+      clear(_shards[i]);
+    }
+  }
+
+  size_t size_in_bytes() const {
+    return _num_shards * (sizeof(Shard) + _num_buckets_per_shard * ASSOCIATIVITY * sizeof(Entry));
+  }
+
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    ASSERT(parent);
+    parent->addChild("Sharded LRU Cache", size_in_bytes());
+  }
+
+ private:
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t shardIndex(const uint64_t hash) const {
+    return hash & (_num_shards - 1);
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t bucketIndex(const uint64_t hash) const {
+    return (hash >> 32) & (_num_buckets_per_shard - 1);
+  }
+
+  // ! Compares two timestamps relative to the current clock of the shard,
+  // ! which also handles overflows of the clock
+  static bool isOlder(const uint32_t lhs, const uint32_t rhs, const uint32_t clock) {
+    return static_cast<uint32_t>(clock - lhs) > static_cast<uint32_t>(clock - rhs);
+  }
+
+  void clear(Shard& shard) {
+    std::fill_n(shard.entries.get(), _num_buckets_per_shard * ASSOCIATIVITY,
+      Entry { 0, Value(), EMPTY });
+    shard.clock = EMPTY;
+    shard.size = 0;
+    shard.hits = 0;
+    shard.misses = 0;
+  }
+
+  static size_t round_down_to_power_of_two(const size_t n) {
+    ASSERT(n > 0);
+    size_t power = 1;
+    while ( 2 * power <= n ) power *= 2;
+    return power;
+  }
+
+  size_t _num_shards;
+  size_t _num_buckets_per_shard;
+  std::unique_ptr<Shard[]> _shards;
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
@@ -442,11 +442,21 @@ class FixedSizeSparseMap {
 };
 
 
+/*!
+ * Base class of open-addressing hash maps that grow dynamically. Each slot stores
+ * the timestamp of the last clear operation at which it was written. A slot is
+ * occupied if its timestamp equals the current timestamp, so clear() runs in constant
+ * time. Timestamps are 32-bit to keep the slots small. Once they overflow, all slots are
+ * reset explicitly.
+ */
 template <typename Key = Mandatory,
           typename Value = Mandatory,
           typename Derived = Mandatory>
 class DynamicMapBase {
 
+ protected:
+  using Timestamp = uint32_t;
+
  public:
   static constexpr size_t INVALID_POS_MASK = ~(std::numeric_limits<size_t>::max() >> 1); // MSB is set
   static constexpr size_t INITIAL_CAPACITY = 16;
@@ -519,7 +529,10 @@ class DynamicMapBase {
 
   void clear() {
     _size = 0;
-    ++_timestamp;
+    if ( ++_timestamp == std::numeric_limits<Timestamp>::max() ) {
+      memset(_data.get(), 0, static_cast<const Derived*>(this)->size_in_bytes());
+      _timestamp = 1;
+    }
   }
 
  private:
@@ -530,7 +543,7 @@ class DynamicMapBase {
   void grow() {
     const size_t old_size = _size;
     const size_t old_capacity = _capacity;
-    const size_t old_timestamp = _timestamp;
+    const Timestamp old_timestamp = _timestamp;
     const size_t new_capacity = 2UL * _capacity;
     const std::unique_ptr<uint8_t[]> old_data = std::move(_data);
     const uint8_t* old_data_begin = old_data.get();
@@ -551,7 +564,7 @@ class DynamicMapBase {
  protected:
   size_t _capacity;
   size_t _size;
-  size_t _timestamp;
+  Timestamp _timestamp;
   std::unique_ptr<uint8_t[]> _data;
 };
 
@@ -566,14 +579,15 @@ class DynamicSparseMap final : public DynamicMapBase<Key, Value, DynamicSparseMa
     Value value;
   };
 
+  using Base = DynamicMapBase<Key, Value, DynamicSparseMap<Key, Value>>;
+  using Base::INVALID_POS_MASK;
+  using typename Base::Timestamp;
+
   struct SparseElement {
     MapElement* element;
-    size_t timestamp;
+    Timestamp timestamp;
   };
 
-  using Base = DynamicMapBase<Key, Value, DynamicSparseMap<Key, Value>>;
-  using Base::INVALID_POS_MASK;
-
   friend Base;
 
  public:
@@ -653,7 +667,7 @@ class DynamicSparseMap final : public DynamicMapBase<Key, Value, DynamicSparseMa
   void rehashImpl(const uint8_t* old_data_begin,
                   const size_t old_size,
                   const size_t old_capacity,
-                  const size_t) {
+                  const Timestamp) {
     const MapElement* elements = reinterpret_cast<const MapElement*>(
       old_data_begin + sizeof(SparseElement) * old_capacity);
     for (size_t i = 0; i < old_size; ++i ) {
@@ -678,14 +692,17 @@ template <typename Key = Mandatory,
           typename Value = Mandatory>
 class DynamicFlatMap final : public DynamicMapBase<Key, Value, DynamicFlatMap<Key, Value>> {
 
+  using Base = DynamicMapBase<Key, Value, DynamicFlatMap<Key, Value>>;
+  using Base::INVALID_POS_MASK;
+  using typename Base::Timestamp;
+
+  // Key, value and timestamp are stored in the same slot such that a lookup
+  // usually touches a single cache line
   struct MapElement {
     Key key;
     Value value;
-    size_t timestamp;
+    Timestamp timestamp;
   };
-
-  using Base = DynamicMapBase<Key, Value, DynamicFlatMap<Key, Value>>;
-  using Base::INVALID_POS_MASK;
   friend Base;
 
  public:
@@ -746,7 +763,7 @@ class DynamicFlatMap final : public DynamicMapBase<Key, Value, DynamicFlatMap<Ke
   void rehashImpl(const uint8_t* old_data_begin,
                   const size_t old_size,
                   const size_t old_capacity,
-                  const size_t old_timestamp) {
+                  const Timestamp old_timestamp) {
     unused(old_size);
     const MapElement* elements = reinterpret_cast<const MapElement*>(old_data_begin);
     for (size_t i = 0; i < old_capacity; ++i ) {
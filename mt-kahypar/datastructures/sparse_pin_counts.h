@@ -38,6 +38,7 @@
 #include "mt-kahypar/datastructures/pin_count_snapshot.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/prefetch.h"
 #include "mt-kahypar/utils/range.h"
 
 
@@ -249,6 +250,11 @@ class SparsePinCounts {
     init_pin_count_of_hyperedge(he);
   }
 
+  // ! Prefetches the pin count entries of hyperedge he (see utils/prefetch.h)
+  inline void prefetch(const HyperedgeID he) const {
+    utils::prefetch(header(he));
+  }
+
   inline PartitionID connectivity(const HyperedgeID he) const {
     ASSERT(he < _num_hyperedges);
     const PinCountHeader* head = header(he);
@@ -433,6 +439,11 @@ class SparsePinCounts {
     return size_of_pin_counts_per_he * num_hyperedges;
   }
 
+  // ! Hyperedges with a larger connectivity store their pin counts in the external pin count list
+  static constexpr size_t maxEntriesPerHyperedge() {
+    return MAX_ENTRIES_PER_HYPEREDGE;
+  }
+
  private:
   inline void init_pin_count_of_hyperedge(const HyperedgeID& he) {
     PinCountHeader* head = header(he);
@@ -153,6 +153,10 @@ class StaticBitset {
     return const_iterator(_num_blocks, _bitset, _num_blocks * BITS_PER_BLOCK);
   }
 
+  size_t numBlocks() const {
+    return _num_blocks;
+  }
+
   const Block* data() const {
     return _bitset;
   }
@@ -174,6 +178,20 @@ class StaticBitset {
     return cnt;
   }
 
+  // ! Calls f(pos) for each one bit in the bitset in increasing order.
+  // ! In contrast to the iterator, this processes the bitset word by word
+  // ! in a tight loop and is therefore faster for bulk iteration.
+  template<typename F>
+  void doForAllOneBits(const F& f) const {
+    for ( size_t i = 0; i < _num_blocks; ++i ) {
+      Block b = __atomic_load_n(_bitset + i, __ATOMIC_RELAXED);
+      while ( b ) {
+        f(static_cast<PartitionID>(i * BITS_PER_BLOCK + utils::lowest_set_bit_64(b)));
+        b &= b - 1;
+      }
+    }
+  }
+
   Bitset copy() const {
     Bitset res(_num_blocks * BITS_PER_BLOCK);
     for ( size_t i = 0; i < _num_blocks; ++i ) {
@@ -191,6 +209,24 @@ class StaticBitset {
     return res;
   }
 
+  Bitset operator|(const StaticBitset& other) const {
+    ASSERT(_num_blocks == other._num_blocks);
+    Bitset res(_num_blocks * BITS_PER_BLOCK);
+    for ( size_t i = 0; i < _num_blocks; ++i ) {
+      res._bitset[i] = *( _bitset + i ) | *( other._bitset + i );
+    }
+    return res;
+  }
+
+  Bitset operator&(const StaticBitset& other) const {
+    ASSERT(_num_blocks == other._num_blocks);
+    Bitset res(_num_blocks * BITS_PER_BLOCK);
+    for ( size_t i = 0; i < _num_blocks; ++i ) {
+      res._bitset[i] = *( _bitset + i ) & *( other._bitset + i );
+    }
+    return res;
+  }
+
  private:
   size_t _num_blocks;
   const Block* _bitset;
@@ -168,7 +168,8 @@ namespace mt_kahypar::ds {
 
     // #################### STAGE 3 ####################
     // In this step, we deduplicate parallel edges. To this end, the incident edges
-    // of each vertex are sorted and aggregated. However, there is a special treatment
+    // of each vertex are sorted and aggregated (vertices with a medium degree aggregate
+    // their edges in a hash map first). However, there is a special treatment
     // for vertices with extremely high degree, as they might become a bottleneck
     // otherwise. Afterwards, for all parallel edges all but one are invalidated and
     // the weight of the remaining edge is set to the sum of the weights.
@@ -180,7 +181,10 @@ namespace mt_kahypar::ds {
       const size_t incident_edges_start = tmp_incident_edges_prefix_sum[coarse_node];
       const size_t incident_edges_end = tmp_incident_edges_prefix_sum[coarse_node + 1];
       const size_t tmp_degree = incident_edges_end - incident_edges_start;
-      if (tmp_degree <= HIGH_DEGREE_CONTRACTION_THRESHOLD) {
+      if (tmp_degree > HASH_AGGREGATION_THRESHOLD && tmp_degree <= MAX_HASH_AGGREGATION_DEGREE) {
+        node_sizes[coarse_node] = aggregateTmpEdges(tmp_edges.data() + incident_edges_start,
+          tmp_edges.data() + incident_edges_end, _tmp_contraction_buffer->edge_aggregation_map.local());
+      } else if (tmp_degree <= HIGH_DEGREE_CONTRACTION_THRESHOLD) {
         // if the degree is small enough, we directly deduplicate the edges
         node_sizes[coarse_node] = deduplicateTmpEdges(tmp_edges.data() + incident_edges_start,
                                                       tmp_edges.data() + incident_edges_end);
@@ -249,18 +253,27 @@ namespace mt_kahypar::ds {
 
       // We still sort the adjacent edges since this results in better cache locality when accessing the neighbors.
       // Also, sorting is necessary for deterministic partitioning.
+      // High degree vertices are sorted one after another with a parallel radix sort,
+      // which reuses its buffers across all vertices and levels.
       tbb::parallel_for(UL(0), resulting_ranges.size(), [&](const size_t i) {
         auto [start, end] = resulting_ranges[i];
         auto comparator = [](const TmpEdgeInformation& e1, const TmpEdgeInformation& e2) {
           return e1._target < e2._target;
         };
-        if (end - start > HIGH_DEGREE_CONTRACTION_THRESHOLD
-            || resulting_ranges.size() < 2 * static_cast<size_t>(tbb::this_task_arena::max_concurrency())) {
+        if (end - start > HIGH_DEGREE_CONTRACTION_THRESHOLD) {
+          return;
+        } else if (resulting_ranges.size() < 2 * static_cast<size_t>(tbb::this_task_arena::max_concurrency())) {
           tbb::parallel_sort(tmp_edges.begin() + start, tmp_edges.begin() + end, comparator);
         } else {
           std::sort(tmp_edges.begin() + start, tmp_edges.begin() + end, comparator);
         }
       });
+      for ( const auto& [start, end] : resulting_ranges ) {
+        if ( end - start > HIGH_DEGREE_CONTRACTION_THRESHOLD ) {
+          _tmp_contraction_buffer->edge_sorter.sort(tmp_edges.data() + start, tmp_edges.data() + end,
+            [](const TmpEdgeInformation& e) { return e._target; });
+        }
+      }
     }
 
     // #################### STAGE 4 ####################
@@ -444,6 +457,41 @@ namespace mt_kahypar::ds {
     return is_non_empty ? (valid_edge_index + 1) : 0;
   }
 
+  size_t StaticGraph::aggregateTmpEdges(TmpEdgeInformation* edge_start, TmpEdgeInformation* edge_end,
+                                        FixedSizeSparseMap<HypernodeID, HyperedgeID>& edge_positions) {
+    ASSERT(std::distance(edge_start, edge_end) >= 0);
+    ASSERT(static_cast<size_t>(std::distance(edge_start, edge_end)) < edge_positions.capacity());
+    // The first occurrence of each target is moved to the front of the range and all
+    // parallel edges are aggregated into it. Since the number of valid edges is at most
+    // the current position, no unprocessed edge is overwritten.
+    size_t num_valid_edges = 0;
+    for (TmpEdgeInformation* edge = edge_start; edge != edge_end; ++edge) {
+      if (!edge->isValid()) {
+        continue;
+      }
+      const HypernodeID target = edge->getTarget();
+      if (edge_positions.contains(target)) {
+        TmpEdgeInformation& valid_edge = edge_start[edge_positions.get(target)];
+        valid_edge.addWeight(edge->getWeight());
+        valid_edge.updateID(edge->getID());
+      } else {
+        edge_positions[target] = num_valid_edges;
+        edge_start[num_valid_edges++] = *edge;
+      }
+    }
+    edge_positions.clear();
+    for (TmpEdgeInformation* edge = edge_start + num_valid_edges; edge != edge_end; ++edge) {
+      edge->invalidate();
+    }
+
+    // Sorting is still required for cache locality and deterministic partitioning
+    std::sort(edge_start, edge_start + num_valid_edges,
+              [](const TmpEdgeInformation& e1, const TmpEdgeInformation& e2) {
+                return e1._target < e2._target;
+              });
+    return num_valid_edges;
+  }
+
   // ! Copy static hypergraph in parallel
   StaticGraph StaticGraph::copy(parallel_tag_t) const {
     StaticGraph hypergraph;
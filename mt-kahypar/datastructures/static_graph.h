@@ -30,6 +30,7 @@
 
 #include <boost/range/irange.hpp>
 
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
 
 #include "include/mtkahypartypes.h"
@@ -38,7 +39,9 @@
 #include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/fixed_vertex_support.h"
+#include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/parallel_radix_sort.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/memory_tree.h"
@@ -65,6 +68,14 @@ class StaticGraph {
   // than this threshold are contracted with a special procedure.
   static constexpr HyperedgeID HIGH_DEGREE_CONTRACTION_THRESHOLD = ID(350000);
 
+  // Vertices with a temporary degree in the range (HASH_AGGREGATION_THRESHOLD,
+  // MAX_HASH_AGGREGATION_DEGREE] aggregate their parallel edges in a thread-local
+  // hash map and only sort the deduplicated edges afterwards, which is much cheaper
+  // than sorting all temporary edges if a cluster has many parallel edges.
+  static constexpr HyperedgeID HASH_AGGREGATION_THRESHOLD = ID(256);
+  static constexpr HyperedgeID MAX_HASH_AGGREGATION_DEGREE =
+    FixedSizeSparseMap<HypernodeID, HyperedgeID>::MAP_SIZE / 3;
+
   static_assert(std::is_unsigned<HypernodeID>::value, "Node ID must be unsigned");
   static_assert(std::is_unsigned<HyperedgeID>::value, "Hyperedge ID must be unsigned");
 
@@ -406,7 +417,8 @@ class StaticGraph {
   // ! hypergraph such that memory can be reused in consecutive contractions.
   struct TmpContractionBuffer {
     explicit TmpContractionBuffer(const HypernodeID num_nodes,
-                                  const HyperedgeID num_edges) {
+                                  const HyperedgeID num_edges) :
+      edge_aggregation_map(ID(0)) {
       tbb::parallel_invoke([&] {
         mapping.resize("Coarsening", "mapping", num_nodes);
       }, [&] {
@@ -431,6 +443,10 @@ class StaticGraph {
     Array<parallel::IntegralAtomicWrapper<HypernodeWeight>> node_weights;
     Array<TmpEdgeInformation> tmp_edges;
     Array<HyperedgeID> edge_id_mapping;
+    // ! Sorts the incident edges of high degree vertices (keeps its buffers across levels)
+    parallel::ParallelRadixSorter<TmpEdgeInformation> edge_sorter;
+    // ! Maps the target of an incident edge to its position in the deduplicated range
+    tbb::enumerable_thread_specific<FixedSizeSparseMap<HypernodeID, HyperedgeID>> edge_aggregation_map;
   };
 
  public:
@@ -927,6 +943,11 @@ class StaticGraph {
   // ! Helper function for deduplication of temporary edges. Returns the number of remaining edges
   static size_t deduplicateTmpEdges(TmpEdgeInformation* edge_start, TmpEdgeInformation* edge_end);
 
+  // ! Same as deduplicateTmpEdges(...), but aggregates parallel edges in a hash map
+  // ! and only sorts the remaining edges. Returns the number of remaining edges
+  static size_t aggregateTmpEdges(TmpEdgeInformation* edge_start, TmpEdgeInformation* edge_end,
+                                  FixedSizeSparseMap<HypernodeID, HyperedgeID>& edge_positions);
+
   // ! Allocate the temporary contraction buffer
   void allocateTmpContractionBuffer() {
     if ( !_tmp_contraction_buffer ) {
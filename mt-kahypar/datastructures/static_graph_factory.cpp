@@ -28,6 +28,9 @@
 
 #include "static_graph_factory.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
@@ -185,4 +188,127 @@ namespace mt_kahypar::ds {
     graph.computeAndSetTotalNodeWeight(parallel_tag_t());
     return graph;
   }
-}
\ No newline at end of file
+
+  StaticGraph StaticGraphFactory::construct_from_csr(
+          const HypernodeID num_nodes,
+          const size_t* xadj,
+          const HypernodeID* adjncy,
+          const HyperedgeWeight* adjwgt,
+          const HypernodeWeight* node_weight) {
+    const size_t num_directed_edges = xadj[num_nodes];
+    if ( xadj[0] != 0 || num_directed_edges % 2 != 0 ) {
+      throw InvalidInputException(
+        "Adjacency array of the graph is invalid or not symmetric.");
+    }
+    const size_t num_edges = num_directed_edges / 2;
+
+    // Each edge obtains its unique ID from its forward direction (source < target).
+    // We count the forward edges of each node to compute the IDs in CSR order.
+    Counter forward_offset(num_nodes + 1, 0);
+    std::atomic_bool is_valid = true;
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID u) {
+      if ( xadj[u] > xadj[u + 1] ) {
+        is_valid = false;
+        return;
+      }
+      for ( size_t i = xadj[u]; i < xadj[u + 1]; ++i ) {
+        const HypernodeID v = adjncy[i];
+        if ( v >= num_nodes || v == u ) {
+          is_valid = false;
+        }
+        forward_offset[u + 1] += v > u;
+      }
+    });
+    if ( !is_valid ) {
+      throw InvalidInputException(
+        "Adjacency array of the graph contains invalid node IDs, self-loops or decreasing offsets.");
+    }
+    parallel::TBBPrefixSum<size_t> forward_prefix_sum(forward_offset);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(UL(0), forward_offset.size()), forward_prefix_sum);
+    if ( forward_offset[num_nodes] != num_edges ) {
+      throw InvalidInputException("Adjacency array of the graph is not symmetric.");
+    }
+
+    // The forward edges of each node sorted by target, which allows us to find
+    // the unique ID of the backward direction of an edge via binary search
+    parallel::scalable_vector<std::pair<HypernodeID, HyperedgeID>> forward_edges(num_edges);
+    parallel::scalable_vector<size_t> forward_position(num_edges);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID u) {
+      HyperedgeID id = forward_offset[u];
+      for ( size_t i = xadj[u]; i < xadj[u + 1]; ++i ) {
+        if ( adjncy[i] > u ) {
+          forward_edges[id] = std::make_pair(adjncy[i], id);
+          forward_position[id] = i;
+          ++id;
+        }
+      }
+      const auto begin = forward_edges.begin() + forward_offset[u];
+      const auto end = forward_edges.begin() + forward_offset[u + 1];
+      std::sort(begin, end);
+      if ( std::adjacent_find(begin, end, [](const auto& lhs, const auto& rhs) {
+             return lhs.first == rhs.first; }) != end ) {
+        is_valid = false;
+      }
+    });
+    if ( !is_valid ) {
+      throw InvalidInputException("Adjacency array of the graph contains parallel edges.");
+    }
+
+    StaticGraph graph;
+    graph._num_nodes = num_nodes;
+    graph._num_edges = num_directed_edges;
+    graph._nodes.resize(num_nodes + 1);
+    graph._edges.resize(num_directed_edges);
+    graph._unique_edge_ids.resize(num_directed_edges);
+
+    auto setup_nodes_and_edges = [&] {
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID u) {
+        StaticGraph::Node& node = graph._nodes[u];
+        node.enable();
+        node.setFirstEntry(xadj[u]);
+        if ( node_weight ) {
+          node.setWeight(node_weight[u]);
+        }
+
+        HyperedgeID forward_id = forward_offset[u];
+        for ( size_t i = xadj[u]; i < xadj[u + 1]; ++i ) {
+          const HypernodeID v = adjncy[i];
+          StaticGraph::Edge& edge = graph._edges[i];
+          edge.setSource(u);
+          edge.setTarget(v);
+          if ( adjwgt ) {
+            edge.setWeight(adjwgt[i]);
+          }
+          if ( v > u ) {
+            graph._unique_edge_ids[i] = forward_id++;
+          } else {
+            const auto begin = forward_edges.begin() + forward_offset[v];
+            const auto end = forward_edges.begin() + forward_offset[v + 1];
+            const auto it = std::lower_bound(begin, end, std::make_pair(u, HyperedgeID(0)));
+            if ( it == end || it->first != u ||
+                 ( adjwgt && adjwgt[forward_position[it->second]] != adjwgt[i] ) ) {
+              is_valid = false;
+            } else {
+              graph._unique_edge_ids[i] = it->second;
+            }
+          }
+        }
+      });
+    };
+
+    auto init_communities = [&] {
+      graph._community_ids.resize(num_nodes, 0);
+    };
+
+    tbb::parallel_invoke(setup_nodes_and_edges, init_communities);
+    if ( !is_valid ) {
+      throw InvalidInputException(
+        "Adjacency array of the graph is not symmetric or the weights of both directions of an edge differ.");
+    }
+
+    // Add Sentinel
+    graph._nodes.back() = StaticGraph::Node(graph._edges.size());
+    graph.computeAndSetTotalNodeWeight(parallel_tag_t());
+    return graph;
+  }
+}
@@ -63,6 +63,17 @@ class StaticGraphFactory {
                                                 const HypernodeWeight* node_weight = nullptr,
                                                 const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the graph directly from an adjacency array in CSR format (as in METIS),
+  // ! i.e., the neighbors of node u are adjncy[xadj[u]], ..., adjncy[xadj[u + 1] - 1].
+  // ! Each edge must be contained in both directions (with the same weight). Self-loops
+  // ! and parallel edges are not allowed. The incident edges of each node keep the order
+  // ! of the adjacency array.
+  static StaticGraph construct_from_csr(const HypernodeID num_nodes,
+                                        const size_t* xadj,
+                                        const HypernodeID* adjncy,
+                                        const HyperedgeWeight* adjwgt = nullptr,
+                                        const HypernodeWeight* node_weight = nullptr);
+
   static std::pair<StaticGraph, parallel::scalable_vector<HypernodeID> > compactify(const StaticGraph&) {
     throw UnsupportedOperationException(
       "Compactify not implemented for static graph.");
@@ -42,10 +42,12 @@ namespace mt_kahypar::ds {
   * This struct is used during multilevel coarsening to efficiently
   * detect parallel hyperedges.
   */
+  // Members are ordered by decreasing size to minimize padding, since
+  // an entry is stored for each hyperedge during contraction
   struct ContractedHyperedgeInformation {
-    HyperedgeID he = kInvalidHyperedge;
     size_t hash = kEdgeHashSeed;
-    size_t size = std::numeric_limits<size_t>::max();
+    HyperedgeID he = kInvalidHyperedge;
+    HypernodeID size = std::numeric_limits<HypernodeID>::max();
     bool valid = false;
   };
 
@@ -167,28 +169,33 @@ namespace mt_kahypar::ds {
             tmp_incidence_array[pos] = map_to_coarse_hypergraph(pin);
           }
 
-          // Remove duplicates and disabled vertices
-          auto first_entry_it = tmp_incidence_array.begin() + incidence_array_start;
-          std::sort(first_entry_it, tmp_incidence_array.begin() + incidence_array_end);
-          auto first_invalid_entry_it = std::unique(first_entry_it, tmp_incidence_array.begin() + incidence_array_end);
-          while ( first_entry_it != first_invalid_entry_it && *(first_invalid_entry_it - 1) == kInvalidHypernode ) {
-            --first_invalid_entry_it;
+          // Remove duplicates and disabled vertices. Disabled vertices are mapped to
+          // kInvalidHypernode and therefore placed at the end of the hyperedge after sorting.
+          // The hash of the contracted hyperedge is computed in the same sweep over the pins.
+          std::sort(tmp_incidence_array.begin() + incidence_array_start,
+                    tmp_incidence_array.begin() + incidence_array_end);
+          size_t footprint = kEdgeHashSeed;
+          size_t first_invalid_entry = incidence_array_start;
+          for ( size_t pos = incidence_array_start; pos < incidence_array_end; ++pos ) {
+            const HypernodeID pin = tmp_incidence_array[pos];
+            if ( pin == kInvalidHypernode ) {
+              break;
+            }
+            if ( first_invalid_entry == incidence_array_start ||
+                 tmp_incidence_array[first_invalid_entry - 1] != pin ) {
+              tmp_incidence_array[first_invalid_entry++] = pin;
+              footprint += cs2(pin);
+            }
           }
 
           // Update size of hyperedge in temporary hyperedge buffer
-          const size_t contracted_size = std::distance(
-                  tmp_incidence_array.begin() + incidence_array_start, first_invalid_entry_it);
+          const size_t contracted_size = first_invalid_entry - incidence_array_start;
           tmp_hyperedges[he].setSize(contracted_size);
 
 
           if ( contracted_size > 1 ) {
-            // Compute hash of contracted hyperedge
-            size_t footprint = kEdgeHashSeed;
-            for ( size_t pos = incidence_array_start; pos < incidence_array_start + contracted_size; ++pos ) {
-              footprint += cs2(tmp_incidence_array[pos]);
-            }
-            hyperedge_hash_map.insert(footprint,
-                                      ContractedHyperedgeInformation{ he, footprint, contracted_size, true });
+            hyperedge_hash_map.insertWithHashedKey(footprint, ContractedHyperedgeInformation{
+              footprint, he, static_cast<HypernodeID>(contracted_size), true });
           } else {
             // Hyperedge becomes a single-pin hyperedge
             valid_hyperedges[he] = 0;
@@ -289,8 +296,10 @@ namespace mt_kahypar::ds {
 
           if (deterministic) {
             // sort for determinism
-            tbb::parallel_sort(tmp_incident_nets.begin() + incident_nets_start,
-                               tmp_incident_nets.begin() + incident_nets_start + contracted_size);
+            _tmp_contraction_buffer->incident_nets_sorter.sort(
+              tmp_incident_nets.data() + incident_nets_start,
+              tmp_incident_nets.data() + incident_nets_start + contracted_size,
+              [](const HyperedgeID he) { return he; });
           }
         }
         duplicate_incident_nets_map.free();
@@ -328,11 +337,11 @@ namespace mt_kahypar::ds {
     };
 
     tbb::parallel_for(UL(0), hyperedge_hash_map.numBuckets(), [&](const size_t bucket) {
+      hyperedge_hash_map.sortBucket(bucket,
+        [&](const ContractedHyperedgeInformation& lhs, const ContractedHyperedgeInformation& rhs) {
+          return std::tie(lhs.hash, lhs.size, lhs.he) < std::tie(rhs.hash, rhs.size, rhs.he);
+        });
       auto& hyperedge_bucket = hyperedge_hash_map.getBucket(bucket);
-      std::sort(hyperedge_bucket.begin(), hyperedge_bucket.end(),
-                [&](const ContractedHyperedgeInformation& lhs, const ContractedHyperedgeInformation& rhs) {
-                  return std::tie(lhs.hash, lhs.size, lhs.he) < std::tie(rhs.hash, rhs.size, rhs.he);
-                });
 
       // Parallel Hyperedge Detection
       for ( size_t i = 0; i < hyperedge_bucket.size(); ++i ) {
@@ -570,6 +579,37 @@ namespace mt_kahypar::ds {
     return hypergraph;
   }
 
+  StaticHypergraph StaticHypergraph::shallowCopy(parallel_tag_t) const {
+    StaticHypergraph hypergraph;
+
+    hypergraph._num_hypernodes = _num_hypernodes;
+    hypergraph._num_removed_hypernodes = _num_removed_hypernodes;
+    hypergraph._num_hyperedges = _num_hyperedges;
+    hypergraph._num_removed_hyperedges = _num_removed_hyperedges;
+    hypergraph._max_edge_size = _max_edge_size;
+    hypergraph._num_pins = _num_pins;
+    hypergraph._total_degree = _total_degree;
+    hypergraph._total_weight = _total_weight;
+    hypergraph._incident_nets = _incident_nets.view();
+    hypergraph._incidence_array = _incidence_array.view();
+    hypergraph._shares_incident_nets = true;
+
+    tbb::parallel_invoke([&] {
+      hypergraph._hypernodes.resize(_hypernodes.size());
+      memcpy(hypergraph._hypernodes.data(), _hypernodes.data(),
+             sizeof(Hypernode) * _hypernodes.size());
+    }, [&] {
+      hypergraph._hyperedges.resize(_hyperedges.size());
+      memcpy(hypergraph._hyperedges.data(), _hyperedges.data(),
+             sizeof(Hyperedge) * _hyperedges.size());
+    }, [&] {
+      hypergraph._community_ids = _community_ids;
+    }, [&] {
+      hypergraph.addFixedVertexSupport(_fixed_vertices.copy());
+    });
+    return hypergraph;
+  }
+
   void StaticHypergraph::memoryConsumption(utils::MemoryTreeNode* parent) const {
     ASSERT(parent);
     parent->addChild("Hypernodes", sizeof(Hypernode) * _hypernodes.size());
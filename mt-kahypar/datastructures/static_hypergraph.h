@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <limits>
 
 #include <tbb/parallel_for.h>
 
@@ -37,6 +38,7 @@
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/fixed_vertex_support.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/parallel_radix_sort.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/memory_tree.h"
@@ -72,6 +74,47 @@ class StaticHypergraph {
   using UncontractionFunction = std::function<void (const HypernodeID, const HypernodeID, const HyperedgeID)>;
   #define NOOP_BATCH_FUNC [] (const HypernodeID, const HypernodeID, const HyperedgeID) { }
 
+  /*!
+   * Packs the index of the first element of a hypernode/hyperedge in the incidence
+   * array and its valid flag into one word. Together with the 32-bit size and
+   * weight, this keeps a hypernode/hyperedge record at 16 bytes (instead of 24 bytes),
+   * which reduces the memory traffic of loops that only access the sizes or weights
+   * (e.g., rating, gain cache initialization and metrics).
+   */
+  class FirstEntryAndValidFlag {
+    static constexpr size_t VALID_FLAG = UL(1) << (std::numeric_limits<size_t>::digits - 1);
+
+   public:
+    FirstEntryAndValidFlag(const size_t begin, const bool valid) :
+      _data(begin | (valid ? VALID_FLAG : 0)) {
+      ASSERT(begin < VALID_FLAG);
+    }
+
+    bool isValid() const {
+      return _data & VALID_FLAG;
+    }
+
+    void setValid(const bool valid) {
+      _data = valid ? (_data | VALID_FLAG) : (_data & ~VALID_FLAG);
+    }
+
+    size_t firstEntry() const {
+      return _data & ~VALID_FLAG;
+    }
+
+    void setFirstEntry(const size_t begin) {
+      ASSERT(begin < VALID_FLAG);
+      _data = begin | (_data & VALID_FLAG);
+    }
+
+    bool operator== (const FirstEntryAndValidFlag& rhs) const {
+      return firstEntry() == rhs.firstEntry();
+    }
+
+   private:
+    size_t _data;
+  };
+
   /**
    * Represents a hypernode of the hypergraph and contains all information
    * associated with a vertex.
@@ -81,52 +124,49 @@ class StaticHypergraph {
     using IDType = HypernodeID;
 
     Hypernode() :
-      _begin(0),
+      _begin(0, false),
       _size(0),
-      _weight(1),
-      _valid(false) { }
+      _weight(1) { }
 
     Hypernode(const bool valid) :
-      _begin(0),
+      _begin(0, valid),
       _size(0),
-      _weight(1),
-      _valid(valid) { }
+      _weight(1) { }
 
     // Sentinel Constructor
     Hypernode(const size_t begin) :
-      _begin(begin),
+      _begin(begin, false),
       _size(0),
-      _weight(1),
-      _valid(false) { }
+      _weight(1) { }
 
     bool isDisabled() const {
-      return _valid == false;
+      return !_begin.isValid();
     }
 
     void enable() {
       ASSERT(isDisabled());
-      _valid = true;
+      _begin.setValid(true);
     }
 
     void disable() {
       ASSERT(!isDisabled());
-      _valid = false;
+      _begin.setValid(false);
     }
 
     // ! Returns the index of the first element in _incident_nets
     size_t firstEntry() const {
-      return _begin;
+      return _begin.firstEntry();
     }
 
     // ! Sets the index of the first element in _incident_nets to begin
     void setFirstEntry(size_t begin) {
       ASSERT(!isDisabled());
-      _begin = begin;
+      _begin.setFirstEntry(begin);
     }
 
     // ! Returns the index of the first element in _incident_nets
     size_t firstInvalidEntry() const {
-      return _begin + _size;
+      return firstEntry() + _size;
     }
 
     size_t size() const {
@@ -136,6 +176,7 @@ class StaticHypergraph {
 
     void setSize(size_t size) {
       ASSERT(!isDisabled());
+      ASSERT(size <= std::numeric_limits<HyperedgeID>::max());
       _size = size;
     }
 
@@ -149,14 +190,13 @@ class StaticHypergraph {
     }
 
    private:
-    // ! Index of the first element in _incident_nets
-    size_t _begin;
+    // ! Index of the first element in _incident_nets and flag indicating
+    // ! whether or not the element is active
+    FirstEntryAndValidFlag _begin;
     // ! Number of incident nets
-    size_t _size;
+    HyperedgeID _size;
     // ! Hypernode weight
     HypernodeWeight _weight;
-    // ! Flag indicating whether or not the element is active.
-    bool _valid;
   };
 
   /**
@@ -168,48 +208,46 @@ class StaticHypergraph {
     using IDType = HyperedgeID;
 
     Hyperedge() :
-      _begin(0),
+      _begin(0, false),
       _size(0),
-      _weight(1),
-      _valid(false) { }
+      _weight(1) { }
 
     // Sentinel Constructor
     Hyperedge(const size_t begin) :
-      _begin(begin),
+      _begin(begin, false),
       _size(0),
-      _weight(1),
-      _valid(false) { }
+      _weight(1) { }
 
     // ! Disables the hypernode/hyperedge. Disable hypernodes/hyperedges will be skipped
     // ! when iterating over the set of all nodes/edges.
     void disable() {
       ASSERT(!isDisabled());
-      _valid = false;
+      _begin.setValid(false);
     }
 
     void enable() {
       ASSERT(isDisabled());
-      _valid = true;
+      _begin.setValid(true);
     }
 
     bool isDisabled() const {
-      return _valid == false;
+      return !_begin.isValid();
     }
 
     // ! Returns the index of the first element in _incidence_array
     size_t firstEntry() const {
-      return _begin;
+      return _begin.firstEntry();
     }
 
     // ! Sets the index of the first element in _incidence_array to begin
     void setFirstEntry(size_t begin) {
       ASSERT(!isDisabled());
-      _begin = begin;
+      _begin.setFirstEntry(begin);
     }
 
     // ! Returns the index of the first element in _incidence_array
     size_t firstInvalidEntry() const {
-      return _begin + _size;
+      return firstEntry() + _size;
     }
 
     size_t size() const {
@@ -219,6 +257,7 @@ class StaticHypergraph {
 
     void setSize(size_t size) {
       ASSERT(!isDisabled());
+      ASSERT(size <= std::numeric_limits<HypernodeID>::max());
       _size = size;
     }
 
@@ -237,18 +276,17 @@ class StaticHypergraph {
     }
 
     bool operator!= (const Hyperedge& rhs) const {
-      return _begin != rhs._begin || _size != rhs._size || _weight != rhs._weight;
+      return !(*this == rhs);
     }
 
    private:
-    // ! Index of the first element in _incidence_array
-    size_t _begin;
+    // ! Index of the first element in _incidence_array and flag indicating
+    // ! whether or not the element is active
+    FirstEntryAndValidFlag _begin;
     // ! Number of pins
-    size_t _size;
+    HypernodeID _size;
     // ! hyperedge weight
     HyperedgeWeight _weight;
-    // ! Flag indicating whether or not the element is active.
-    bool _valid;
   };
 
   /*!
@@ -380,6 +418,8 @@ class StaticHypergraph {
     IncidenceArray tmp_incidence_array;
     Array<size_t> he_sizes;
     Array<size_t> valid_hyperedges;
+    // ! Sorts the incident nets of high degree vertices (keeps its buffers across levels)
+    parallel::ParallelRadixSorter<HyperedgeID> incident_nets_sorter;
   };
 
  public:
@@ -422,6 +462,7 @@ class StaticHypergraph {
     _incidence_array(),
     _community_ids(0),
     _fixed_vertices(),
+    _shares_incident_nets(false),
     _tmp_contraction_buffer(nullptr) { }
 
   StaticHypergraph(const StaticHypergraph&) = delete;
@@ -443,6 +484,7 @@ class StaticHypergraph {
     _incidence_array(std::move(other._incidence_array)),
     _community_ids(std::move(other._community_ids)),
     _fixed_vertices(std::move(other._fixed_vertices)),
+    _shares_incident_nets(other._shares_incident_nets),
     _tmp_contraction_buffer(std::move(other._tmp_contraction_buffer)) {
     _fixed_vertices.setHypergraph(this);
     other._tmp_contraction_buffer = nullptr;
@@ -465,6 +507,7 @@ class StaticHypergraph {
     _community_ids = std::move(other._community_ids);
     _fixed_vertices = std::move(other._fixed_vertices);
     _fixed_vertices.setHypergraph(this);
+    _shares_incident_nets = other._shares_incident_nets;
     _tmp_contraction_buffer = std::move(other._tmp_contraction_buffer);
     other._tmp_contraction_buffer = nullptr;
     return *this;
@@ -780,6 +823,9 @@ class StaticHypergraph {
   */
   void removeEdge(const HyperedgeID he) {
     ASSERT(edgeIsEnabled(he), "Hyperedge" << he << "is disabled");
+    if ( _shares_incident_nets ) {
+      copySharedIncidentNets();
+    }
     for ( const HypernodeID& pin : pins(he) ) {
       removeIncidentEdgeFromHypernode(he, pin);
     }
@@ -797,6 +843,10 @@ class StaticHypergraph {
   */
   void removeLargeEdge(const HyperedgeID he) {
     ASSERT(edgeIsEnabled(he), "Hyperedge" << he << "is disabled");
+    if ( _shares_incident_nets ) {
+      // Copy-on-write: the incident nets are reordered below
+      copySharedIncidentNets();
+    }
     const size_t incidence_array_start = hyperedge(he).firstEntry();
     const size_t incidence_array_end = hyperedge(he).firstInvalidEntry();
     tbb::parallel_for(incidence_array_start, incidence_array_end, [&](const size_t pos) {
@@ -852,6 +902,13 @@ class StaticHypergraph {
   // ! Copy static hypergraph sequential
   StaticHypergraph copy() const;
 
+  // ! Creates a hypergraph that shares the pins and incident nets with this hypergraph
+  // ! and only copies the node, edge and community information. This hypergraph must
+  // ! outlive the copy and must not be modified while the copy is in use. The incident
+  // ! nets are copied on the first modification (i.e., if large hyperedges are removed).
+  // ! This allows several concurrent partitioning runs to share one input hypergraph.
+  StaticHypergraph shallowCopy(parallel_tag_t) const;
+
   // ! Reset internal data structure
   void reset() { }
 
@@ -965,6 +1022,16 @@ class StaticHypergraph {
     hn.setSize(hn.size() + 1);
   }
 
+  // ! Replaces the shared incident nets with a copy owned by this hypergraph
+  void copySharedIncidentNets() {
+    IncidentNets incident_nets;
+    incident_nets.resize(_incident_nets.size());
+    memcpy(incident_nets.data(), _incident_nets.data(),
+           sizeof(HyperedgeID) * _incident_nets.size());
+    _incident_nets = std::move(incident_nets);
+    _shares_incident_nets = false;
+  }
+
   // ! Allocate the temporary contraction buffer
   void allocateTmpContractionBuffer() {
     if ( !_tmp_contraction_buffer ) {
@@ -1007,6 +1074,9 @@ class StaticHypergraph {
   // ! Fixed Vertex Support
   FixedVertexSupport<StaticHypergraph> _fixed_vertices;
 
+  // ! True, if the pins and incident nets are shared with another hypergraph (see shallowCopy(...))
+  bool _shares_incident_nets;
+
   // ! Data that is reused throughout the multilevel hierarchy
   // ! to contract the hypergraph and to prevent expensive allocations
   TmpContractionBuffer* _tmp_contraction_buffer;
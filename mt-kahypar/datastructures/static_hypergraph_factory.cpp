@@ -27,10 +27,15 @@
 
 #include "static_hypergraph_factory.h"
 
+#include <atomic>
+
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
 
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/utils/hash.h"
 #include "mt-kahypar/utils/timer.h"
 
 namespace mt_kahypar::ds {
@@ -163,4 +168,255 @@ namespace mt_kahypar::ds {
     return hypergraph;
   }
 
-}
\ No newline at end of file
+  StaticHypergraph StaticHypergraphFactory::construct_from_csr(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const size_t* hyperedge_indices,
+          Array<HypernodeID>&& pins,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges) {
+    if ( hyperedge_indices[0] != 0 || hyperedge_indices[num_hyperedges] != pins.size() ) {
+      throw InvalidInputException("Hyperedge indices do not match the number of pins.");
+    }
+
+    StaticHypergraph hypergraph;
+    hypergraph._num_hypernodes = num_hypernodes;
+    hypergraph._num_hyperedges = num_hyperedges;
+    hypergraph._hypernodes.resize(num_hypernodes + 1);
+    hypergraph._hyperedges.resize(num_hyperedges + 1);
+
+    // Compute number of incident nets per vertex
+    ThreadLocalCounter local_incident_nets_per_vertex(num_hypernodes, 0);
+    tbb::enumerable_thread_specific<size_t> local_max_edge_size(UL(0));
+    std::atomic_bool is_valid = true;
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      if ( hyperedge_indices[he] > hyperedge_indices[he + 1] ) {
+        is_valid = false;
+        return;
+      }
+      Counter& num_incident_nets_per_vertex = local_incident_nets_per_vertex.local();
+      local_max_edge_size.local() = std::max(local_max_edge_size.local(),
+        hyperedge_indices[he + 1] - hyperedge_indices[he]);
+      for ( size_t i = hyperedge_indices[he]; i < hyperedge_indices[he + 1]; ++i ) {
+        if ( pins[i] >= num_hypernodes ) {
+          is_valid = false;
+          return;
+        }
+        ++num_incident_nets_per_vertex[pins[i]];
+      }
+    });
+    if ( !is_valid ) {
+      throw InvalidInputException(
+        "Hyperedge indices must be non-decreasing and pins must be valid node IDs.");
+    }
+    hypergraph._max_edge_size = local_max_edge_size.combine(
+            [&](const size_t lhs, const size_t rhs) {
+              return std::max(lhs, rhs);
+            });
+
+    Counter num_incident_nets_per_vertex(num_hypernodes, 0);
+    for ( Counter& c : local_incident_nets_per_vertex ) {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](const size_t pos) {
+        num_incident_nets_per_vertex[pos] += c[pos];
+      });
+    }
+    local_incident_nets_per_vertex.clear();
+    parallel::TBBPrefixSum<size_t> incident_net_prefix_sum(num_incident_nets_per_vertex);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(
+            UL(0), UI64(num_hypernodes)), incident_net_prefix_sum);
+
+    hypergraph._num_pins = pins.size();
+    hypergraph._total_degree = incident_net_prefix_sum.total_sum();
+    hypergraph._incidence_array = std::move(pins);
+    hypergraph._incident_nets.resize(hypergraph._num_pins);
+
+    AtomicCounter incident_nets_position(num_hypernodes,
+                                         parallel::IntegralAtomicWrapper<size_t>(0));
+
+    auto setup_hyperedges = [&] {
+      tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+        StaticHypergraph::Hyperedge& hyperedge = hypergraph._hyperedges[he];
+        hyperedge.enable();
+        hyperedge.setFirstEntry(hyperedge_indices[he]);
+        hyperedge.setSize(hyperedge_indices[he + 1] - hyperedge_indices[he]);
+        if ( hyperedge_weight ) {
+          hyperedge.setWeight(hyperedge_weight[he]);
+        }
+        for ( size_t i = hyperedge_indices[he]; i < hyperedge_indices[he + 1]; ++i ) {
+          const HypernodeID pin = hypergraph._incidence_array[i];
+          const size_t incident_nets_pos = incident_net_prefix_sum[pin] + incident_nets_position[pin]++;
+          ASSERT(incident_nets_pos < incident_net_prefix_sum[pin + 1]);
+          hypergraph._incident_nets[incident_nets_pos] = he;
+        }
+      });
+    };
+
+    auto setup_hypernodes = [&] {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](const size_t pos) {
+        StaticHypergraph::Hypernode& hypernode = hypergraph._hypernodes[pos];
+        hypernode.enable();
+        hypernode.setFirstEntry(incident_net_prefix_sum[pos]);
+        hypernode.setSize(incident_net_prefix_sum.value(pos));
+        if ( hypernode_weight ) {
+          hypernode.setWeight(hypernode_weight[pos]);
+        }
+      });
+    };
+
+    auto init_communities = [&] {
+      hypergraph._community_ids.resize(num_hypernodes, 0);
+    };
+
+    tbb::parallel_invoke(setup_hyperedges, setup_hypernodes, init_communities);
+
+    if (stable_construction_of_incident_edges) {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](HypernodeID u) {
+        auto b = hypergraph._incident_nets.begin() + hypergraph.hypernode(u).firstEntry();
+        auto e = hypergraph._incident_nets.begin() + hypergraph.hypernode(u).firstInvalidEntry();
+        std::sort(b, e);
+      });
+    }
+
+    // Add Sentinels
+    hypergraph._hypernodes.back() = StaticHypergraph::Hypernode(hypergraph._incident_nets.size());
+    hypergraph._hyperedges.back() = StaticHypergraph::Hyperedge(hypergraph._incidence_array.size());
+
+    hypergraph.computeAndSetTotalNodeWeight(parallel_tag_t());
+    return hypergraph;
+  }
+
+  StaticHypergraph StaticHypergraphFactory::construct_sanitized(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const HyperedgeVector& edge_vector,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges,
+          InputSanitization& sanitization) {
+    ASSERT(edge_vector.size() == num_hyperedges);
+
+    // Writes the distinct pins of a hyperedge in increasing order to a thread-local buffer
+    tbb::enumerable_thread_specific<vec<HypernodeID>> local_pins;
+    auto distinct_pins = [&](const HyperedgeID he) -> vec<HypernodeID>& {
+      vec<HypernodeID>& pins = local_pins.local();
+      pins.assign(edge_vector[he].begin(), edge_vector[he].end());
+      std::sort(pins.begin(), pins.end());
+      pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+      return pins;
+    };
+
+    // Count the distinct pins of each hyperedge and compute a fingerprint
+    // (independent of the order of the pins) to detect identical hyperedges
+    vec<HypernodeID> num_distinct_pins(num_hyperedges, 0);
+    vec<std::pair<uint64_t, HyperedgeID>> fingerprints(num_hyperedges);
+    tbb::enumerable_thread_specific<size_t> local_duplicated_pins(0);
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      const vec<HypernodeID>& pins = distinct_pins(he);
+      num_distinct_pins[he] = pins.size();
+      local_duplicated_pins.local() += edge_vector[he].size() - pins.size();
+      uint64_t fingerprint = pins.size();
+      for ( const HypernodeID& pin : pins ) {
+        ASSERT(pin < num_hypernodes, V(pin) << V(num_hypernodes));
+        fingerprint += hashing::integer::hash64(pin);
+      }
+      fingerprints[he] = std::make_pair(fingerprint, he);
+    });
+    sanitization.num_removed_duplicated_pins = local_duplicated_pins.combine(std::plus<size_t>());
+
+    // Identical hyperedges have the same fingerprint, which means that they are adjacent after
+    // sorting. Each group of equal fingerprints is resolved by comparing the pins, and the hyperedge
+    // with the smallest ID in a set of identical hyperedges becomes their representative.
+    tbb::parallel_sort(fingerprints.begin(), fingerprints.end());
+    vec<HyperedgeID> representative(num_hyperedges, kInvalidHyperedge);
+    vec<HyperedgeWeight> aggregated_weight(num_hyperedges, 0);
+    tbb::enumerable_thread_specific<vec<HypernodeID>> local_representative_pins;
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID i) {
+      if ( i > 0 && fingerprints[i - 1].first == fingerprints[i].first ) {
+        return;  // not the start of a group
+      }
+      HyperedgeID end = i + 1;
+      while ( end < num_hyperedges && fingerprints[end].first == fingerprints[i].first ) {
+        ++end;
+      }
+      vec<HypernodeID>& representative_pins = local_representative_pins.local();
+      for ( HyperedgeID j = i; j < end; ++j ) {
+        const HyperedgeID he = fingerprints[j].second;
+        if ( representative[he] != kInvalidHyperedge || num_distinct_pins[he] < 2 ) {
+          continue;
+        }
+        // he is the representative of all remaining identical hyperedges in the group
+        representative[he] = he;
+        aggregated_weight[he] = hyperedge_weight ? hyperedge_weight[he] : 1;
+        if ( end - j == 1 ) {
+          continue;
+        }
+        representative_pins = distinct_pins(he);
+        for ( HyperedgeID k = j + 1; k < end; ++k ) {
+          const HyperedgeID other = fingerprints[k].second;
+          if ( representative[other] == kInvalidHyperedge &&
+               num_distinct_pins[other] == num_distinct_pins[he] &&
+               distinct_pins(other) == representative_pins ) {
+            representative[other] = he;
+            aggregated_weight[he] += hyperedge_weight ? hyperedge_weight[other] : 1;
+          }
+        }
+      }
+    });
+    vec<std::pair<uint64_t, HyperedgeID>>().swap(fingerprints);
+
+    // Compute the IDs and pin offsets of the remaining hyperedges
+    vec<HyperedgeID> is_representative(num_hyperedges, 0);
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      is_representative[he] = representative[he] == he;
+    });
+    vec<HyperedgeID> new_id(num_hyperedges, 0);
+    parallel_prefix_sum(is_representative.begin(), is_representative.end(),
+      new_id.begin(), std::plus<HyperedgeID>(), ID(0));
+    const HyperedgeID num_sanitized_hyperedges = num_hyperedges > 0 ? new_id.back() : 0;
+    vec<size_t> sanitized_size(num_sanitized_hyperedges, 0);
+    vec<HyperedgeWeight> sanitized_weight(num_sanitized_hyperedges, 0);
+    sanitization.hyperedge_mapping.assign(num_hyperedges, kInvalidHyperedge);
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      if ( representative[he] != kInvalidHyperedge ) {
+        sanitization.hyperedge_mapping[he] = new_id[representative[he]] - 1;
+      }
+      if ( is_representative[he] ) {
+        sanitized_size[new_id[he] - 1] = num_distinct_pins[he];
+        sanitized_weight[new_id[he] - 1] = aggregated_weight[he];
+      }
+    });
+    vec<size_t> hyperedge_indices(num_sanitized_hyperedges + 1, 0);
+    parallel_prefix_sum(sanitized_size.begin(), sanitized_size.end(),
+      hyperedge_indices.begin() + 1, std::plus<size_t>(), UL(0));
+
+    const HyperedgeID num_single_pin_hyperedges = tbb::parallel_reduce(
+      tbb::blocked_range<HyperedgeID>(ID(0), num_hyperedges), ID(0),
+      [&](const tbb::blocked_range<HyperedgeID>& range, HyperedgeID count) {
+        for ( HyperedgeID he = range.begin(); he < range.end(); ++he ) {
+          count += num_distinct_pins[he] < 2;
+        }
+        return count;
+      }, std::plus<HyperedgeID>());
+    sanitization.num_removed_single_pin_hyperedges = num_single_pin_hyperedges;
+    sanitization.num_removed_identical_hyperedges =
+      num_hyperedges - num_single_pin_hyperedges - num_sanitized_hyperedges;
+
+    // Write the distinct pins of the remaining hyperedges
+    Array<HypernodeID> pins;
+    pins.resizeNoAssign(hyperedge_indices.back());
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      if ( is_representative[he] ) {
+        const vec<HypernodeID>& he_pins = distinct_pins(he);
+        std::copy(he_pins.begin(), he_pins.end(), pins.begin() + hyperedge_indices[new_id[he] - 1]);
+      }
+    });
+
+    StaticHypergraph hypergraph = construct_from_csr(num_hypernodes, num_sanitized_hyperedges,
+      hyperedge_indices.data(), std::move(pins), sanitized_weight.data(), hypernode_weight,
+      stable_construction_of_incident_edges);
+    hypergraph.setNumRemovedHyperedges(num_single_pin_hyperedges);
+    return hypergraph;
+  }
+
+}
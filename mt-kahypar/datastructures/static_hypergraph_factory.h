@@ -36,6 +36,16 @@
 
 namespace mt_kahypar::ds {
 
+// ! Result of the input sanitization performed by StaticHypergraphFactory::construct_sanitized(...)
+struct InputSanitization {
+  size_t num_removed_duplicated_pins = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  HyperedgeID num_removed_identical_hyperedges = 0;
+  // ! Hyperedge of the constructed hypergraph for each input hyperedge (kInvalidHyperedge
+  // ! for single-pin hyperedges). Identical hyperedges map to the same hyperedge.
+  vec<HyperedgeID> hyperedge_mapping;
+};
+
 class StaticHypergraphFactory {
 
   using HyperedgeVector = parallel::scalable_vector<parallel::scalable_vector<HypernodeID>>;
@@ -51,6 +61,30 @@ class StaticHypergraphFactory {
                                     const HypernodeWeight* hypernode_weight = nullptr,
                                     const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the hypergraph from a pin array in CSR format, where the pins of hyperedge e
+  // ! are stored in pins[hyperedge_indices[e]], ..., pins[hyperedge_indices[e + 1] - 1].
+  // ! The pin array is used as incidence array of the hypergraph without copying it
+  // ! (it can adopt memory of the caller, see Array::adopt(...)).
+  static StaticHypergraph construct_from_csr(const HypernodeID num_hypernodes,
+                                             const HyperedgeID num_hyperedges,
+                                             const size_t* hyperedge_indices,
+                                             Array<HypernodeID>&& pins,
+                                             const HyperedgeWeight* hyperedge_weight = nullptr,
+                                             const HypernodeWeight* hypernode_weight = nullptr,
+                                             const bool stable_construction_of_incident_edges = false);
+
+  // ! Constructs the hypergraph and sanitizes the input on the fly: duplicated pins are removed,
+  // ! hyperedges with less than two distinct pins are dropped, and identical hyperedges are merged
+  // ! into one hyperedge whose weight is the sum of their weights. All of this does not change the
+  // ! objective of any partition and happens in the parallel passes that build the incidence array.
+  static StaticHypergraph construct_sanitized(const HypernodeID num_hypernodes,
+                                              const HyperedgeID num_hyperedges,
+                                              const HyperedgeVector& edge_vector,
+                                              const HyperedgeWeight* hyperedge_weight,
+                                              const HypernodeWeight* hypernode_weight,
+                                              const bool stable_construction_of_incident_edges,
+                                              InputSanitization& sanitization);
+
   static std::pair<StaticHypergraph, vec<HypernodeID>> compactify(const StaticHypergraph&) {
     throw UnsupportedOperationException(
       "Compactify not implemented for static hypergraph.");
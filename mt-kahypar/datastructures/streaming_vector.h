@@ -100,13 +100,22 @@ class StreamingVector {
     return values;
   }
 
-  size_t copy_parallel(parallel::scalable_vector<Value>& values) {
+  // ! Copies the values into the given vector. In contrast to the copy
+  // ! functions above, the capacity of the vector is reused, which avoids
+  // ! allocating (and page-faulting) a new vector if called repeatedly.
+  size_t copy_sequential(parallel::scalable_vector<Value>& values) {
     const size_t size = init_prefix_sum();
+    values.resize(size);
 
-    // Resize if necassary
-    if ( size > values.size() ) {
-      values.resize(size);
+    for (int cpu_id = 0; cpu_id < (int)_cpu_buffer.size(); ++cpu_id) {
+      memcpy_from_cpu_buffer_to_destination(values, cpu_id, _prefix_sum[cpu_id]);
     }
+    return size;
+  }
+
+  size_t copy_parallel(parallel::scalable_vector<Value>& values) {
+    const size_t size = init_prefix_sum();
+    values.resize(size);
 
     tbb::parallel_for(0, static_cast<int>(_cpu_buffer.size()), [&](const int cpu_id) {
       memcpy_from_cpu_buffer_to_destination(values, cpu_id, _prefix_sum[cpu_id]);
@@ -35,6 +35,7 @@
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/zero_allocator.h"
 
 // based on http://upcoder.com/9/fast-resettable-flag-vector/
 
@@ -45,11 +46,9 @@ class ThreadSafeFastResetFlagArray {
 
 public:
   explicit ThreadSafeFastResetFlagArray(const size_t size) :
-    _v(std::make_unique<Type[]>(size)),
+    _v(parallel::make_zero_unique<Type>(size)),
     _threshold(1),
-    _size(size) {
-    initialize();
-  }
+    _size(size) { }
 
   ThreadSafeFastResetFlagArray() :
     _v(nullptr),
@@ -111,20 +110,28 @@ public:
     return _size;
   }
 
+  size_t size_in_bytes() const {
+    return _size * sizeof(Type);
+  }
+
   void setSize(const size_t size, const bool init = false) {
     ASSERT(_v == nullptr, "Error");
-    _v = std::make_unique<Type[]>(size);
+    _v = parallel::make_zero_unique<Type>(size);
     _size = size;
-    initialize(init);
+    if ( init ) {
+      initialize(init);
+    }
   }
 
   void resize(const size_t size, const bool init = false) {
     if ( size > _size ) {
-      std::unique_ptr<Type[]> tmp_v =
-        std::make_unique<Type[]>(size);
+      parallel::zero_unique_ptr<Type> tmp_v =
+        parallel::make_zero_unique<Type>(size);
       std::swap(_v, tmp_v);
       _size = size;
-      initialize(init);
+      if ( init ) {
+        initialize(init);
+      }
     } else {
       _size = size;
     }
@@ -142,7 +149,8 @@ public:
     }
   }
 
-  std::unique_ptr<Type[]> _v;
+  // ! Fresh allocations are zero-initialized (i.e., all flags are false)
+  parallel::zero_unique_ptr<Type> _v;
   Type _threshold;
   size_t _size;
 };
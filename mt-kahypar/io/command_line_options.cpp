@@ -36,7 +36,9 @@
 
 #include <fstream>
 #include <limits>
+#include <sstream>
 
+#include "mt-kahypar/io/presets.h"
 #include "mt-kahypar/utils/exception.h"
 
 namespace po = boost::program_options;
@@ -80,6 +82,19 @@ namespace mt_kahypar {
             ("write-partition-file",
              po::value<bool>(&context.partition.write_partition_file)->value_name("<bool>")->default_value(false),
              "If true, then partition output file is generated")
+            ("binary-partition-file",
+             po::value<bool>(&context.partition.binary_partition_file)->value_name("<bool>")->default_value(false),
+             "If true, then the partition output file is written in binary format (see docs/FileFormats.md)")
+            ("nested-partitions",
+             po::value<bool>(&context.partition.nested_partitions)->value_name("<bool>")->default_value(false),
+             "If true, the partition is computed with recursive bisection of the blocks (deep multilevel mode,\n"
+             "if the mode is direct) and the nested partitions into 2, 4, ..., 2^i < k blocks are written to\n"
+             "<partition file>.nested<2^i> along with the partition file")
+            ("block-ordering",
+             po::value<bool>(&context.partition.write_block_ordering)->value_name("<bool>")->default_value(false),
+             "If true, a numbering of the nodes in which each block is contiguous (interior nodes first, then\n"
+             "nodes incident to cut nets), the block offsets and the cut nets are written to\n"
+             "<partition file>.ordering along with the partition file (see block_ordering.h)")
             ("partition-output-folder",
              po::value<std::string>(&context.partition.graph_partition_output_folder)->value_name("<string>"),
              "Output folder for partition file")
@@ -98,11 +113,20 @@ namespace mt_kahypar {
                  context.partition.file_format = FileFormat::hMetis;
                } else if (s == "metis") {
                  context.partition.file_format = FileFormat::Metis;
+               } else if (s == "binary") {
+                 context.partition.file_format = FileFormat::binary;
+               } else if (s == "snap") {
+                 context.partition.file_format = FileFormat::SNAP;
+               } else if (s == "mtx") {
+                 context.partition.file_format = FileFormat::MatrixMarket;
                }
              }),
              "Input file format: \n"
              " - hmetis : hMETIS hypergraph file format \n"
-             " - metis : METIS graph file format")
+             " - metis : METIS graph file format \n"
+             " - binary : binary snapshot of a hypergraph or graph (see InputToBinary)\n"
+             " - snap : SNAP edge list (read as graph)\n"
+             " - mtx : Matrix Market file in coordinate format (read as graph)")
             ("instance-type",
              po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& type) {
                context.partition.instance_type = instanceTypeFromString(type);
@@ -119,7 +143,9 @@ namespace mt_kahypar {
              " - large_k\n"
              " - default\n"
              " - quality\n"
-             " - highest_quality"
+             " - highest_quality\n"
+             " - auto : selects the preset and mode based on the size and structure of the input,\n"
+             "          k and the time limit (see --time-limit)"
              )
             ("seed",
              po::value<int>(&context.partition.seed)->value_name("<int>")->default_value(0),
@@ -127,16 +153,51 @@ namespace mt_kahypar {
             ("num-vcycles",
              po::value<size_t>(&context.partition.num_vcycles)->value_name("<size_t>")->default_value(0),
              "Number of V-Cycles")
+            ("vcycle-min-relative-improvement",
+             po::value<double>(&context.partition.vcycle_min_relative_improvement)->value_name("<double>")->default_value(0.0),
+             "V-cycles terminate early if a cycle improves the objective relatively by less than this\n"
+             "threshold, e.g., 0.0001 stops if a cycle improves the objective by less than 0.01%.\n"
+             "(default: 0.0 = always perform --num-vcycles cycles)")
+            ("vcycle-truncated-contraction-limit-factor",
+             po::value<double>(&context.partition.vcycle_truncated_contraction_limit_factor)->value_name("<double>")->default_value(1.0),
+             "If > 1, V-cycles only coarsen down to this factor times the contraction limit (truncated cycles).\n"
+             "They are cheaper than full cycles, but mainly improve the partition on the finer levels. If a\n"
+             "truncated cycle does not improve the objective by at least --vcycle-min-relative-improvement,\n"
+             "the remaining cycles coarsen the full hierarchy. (default: 1.0 = only full cycles)")
             ("perform-parallel-recursion-in-deep-multilevel",
              po::value<bool>(&context.partition.perform_parallel_recursion_in_deep_multilevel)->value_name("<bool>")->default_value(true),
              "If true, then we perform parallel recursion within the deep multilevel scheme.")
+            ("deep-ml-copy-memory-limit",
+             po::value<size_t>(&context.partition.deep_ml_copy_memory_limit)->value_name("<size_t>")->default_value(0),
+             "Memory limit in MB for the hypergraph copies that are partitioned concurrently in the parallel\n"
+             "recursion of the deep multilevel scheme. The number of parallel recursive calls is reduced\n"
+             "such that their copies fit into the limit (0 = no limit).")
+            ("sparse-gain-cache",
+             po::value<bool>(&context.partition.use_sparse_gain_cache)->value_name("<bool>")->default_value(false),
+             "If true, the gain cache only stores the benefit terms of adjacent blocks for the connectivity metric\n"
+             "(only supported for large k partitioning)")
+            ("graph-gain-cache-on-the-fly-factor",
+             po::value<double>(&context.partition.graph_gain_cache_on_the_fly_factor)->value_name("<double>")->default_value(4.0),
+             "For graphs, the cut gain cache computes the incident weights of a node to all blocks on demand\n"
+             "instead of storing k entries per node, if k >= this factor times the average degree (0 = disabled)")
+            ("sparse-connectivity-min-k",
+             po::value<PartitionID>(&context.partition.sparse_connectivity_min_k)->value_name("<int>")->default_value(64),
+             "For k >= this threshold, the pin counts and connectivity sets are stored sparsely (as for large k partitioning)\n"
+             "if the hypergraph mostly contains small nets and the sparse representation needs less memory\n"
+             "(only used for the multilevel hypergraph partitioning presets)")
+            ("maxnet-removal",
+             po::value<bool>(&context.partition.remove_large_hyperedges)->value_name("<bool>")->default_value(false),
+             "If true, large hyperedges (see maxnet-removal-factor) are removed before partitioning and restored afterwards.\n"
+             "Otherwise, they are kept in the hypergraph. Their pin counts are maintained in constant time per move\n"
+             "and their pins are not visited when exploring neighbors (see maxnet-ignore).")
             ("smallest-maxnet-threshold",
             po::value<HypernodeID>(&context.partition.smallest_large_he_size_threshold)->value_name("<int>"),
             "No hyperedge whose size is smaller than this threshold is removed in the large hyperedge removal step (see maxnet-removal-factor)")
             ("maxnet-removal-factor",
              po::value<double>(&context.partition.large_hyperedge_size_threshold_factor)->value_name(
                      "<double>")->default_value(0.01),
-             "Hyperedges larger than max(|V| * (this factor), p-smallest-maxnet-threshold) are removed before partitioning.")
+             "If maxnet-removal is enabled, hyperedges larger than max(|V| * (this factor), p-smallest-maxnet-threshold)\n"
+             "are removed before partitioning.")
             ("maxnet-ignore",
              po::value<HyperedgeID>(&context.partition.ignore_hyperedge_size_threshold)->value_name(
                      "<uint64_t>")->default_value(1000),
@@ -164,14 +225,60 @@ namespace mt_kahypar {
             ("enable-progress-bar",
              po::value<bool>(&context.partition.enable_progress_bar)->value_name("<bool>")->default_value(false),
              "If true, shows a progress bar during coarsening and refinement phase.")
-            ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
-             "Time limit in seconds (currently not supported)")
+            ("time-limit", po::value<double>(&context.partition.time_limit)->value_name("<double>"),
+             "Wall-clock time limit in seconds for the whole partitioning call (0 = no limit). "
+             "When the time limit is exceeded, the remaining phases are cut short and the best balanced "
+             "partition found so far is returned. Coarsening and the projection of the partition "
+             "are always completed.")
+            ("memory-budget", po::value<size_t>(&context.partition.memory_budget)->value_name("<size_t>"),
+             "Memory budget in MB for the whole partitioning call (0 = no limit). If the estimated peak memory "
+             "exceeds the budget, the partitioner degrades step by step to cheaper configurations "
+             "(low-memory contraction, sparse connectivity information and gain cache, sequential recursion "
+             "in deep multilevel, no flow-based refinement).")
+            ("portfolio-runs", po::value<size_t>(&context.partition.portfolio_runs)->value_name("<size_t>")->default_value(1),
+             "Number of independent partitioning runs with different seeds. The runs share the preprocessing "
+             "(e.g., community detection), split the threads among them and the best partition is returned.")
+            ("portfolio-cutoff", po::value<double>(&context.partition.portfolio_cutoff)->value_name("<double>")->default_value(0.0),
+             "If > 0, a portfolio run is cancelled if its objective after initial partitioning is worse than "
+             "(1 + portfolio-cutoff) times the best objective after initial partitioning of all runs.")
+            ("evolutionary-time-limit", po::value<double>(&context.partition.evolutionary_time_limit)->value_name("<double>")->default_value(0.0),
+             "If > 0, the partitions of the portfolio runs form the population of a memetic algorithm that "
+             "recombines them in parallel for the given number of seconds (requires --portfolio-runs > 1).")
+            ("auto-tuning", po::value<bool>(&context.partition.auto_tuning)->value_name("<bool>")->default_value(false),
+             "If true, the contraction limit multiplier and the number of initial partitioning runs are tuned "
+             "per instance. A sample of the input is partitioned in parallel with all combinations of half, "
+             "the same and twice the preset values and the best setting is used for the input.")
+            ("auto-tuning-sample-fraction",
+             po::value<double>(&context.partition.auto_tuning_sample_fraction)->value_name("<double>")->default_value(0.1),
+             "Fraction of the nodes contained in the sample used for auto-tuning.")
+            ("auto-tuning-max-slowdown",
+             po::value<double>(&context.partition.auto_tuning_max_slowdown)->value_name("<double>")->default_value(2.0),
+             "Auto-tuning only selects settings whose running time on the sample is at most this factor "
+             "times the running time of the preset values (ignored in deterministic mode).")
+            ("auto-tuning-cache-dir",
+             po::value<std::string>(&context.partition.auto_tuning_cache_dir)->value_name("<string>")->default_value(""),
+             "If not empty, the tuned parameters are cached in this directory per instance fingerprint. "
+             "Tuned parameters are always cached in memory for the lifetime of the process.")
             ("sp-process,s",
              po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>")->default_value(false),
              "Summarize partitioning results in RESULT line compatible with sqlplottools "
              "(https://github.com/bingmann/sqlplottools)")
             ("csv", po::value<bool>(&context.partition.csv_output)->value_name("<bool>")->default_value(false),
              "Summarize results in CSV format")
+            ("json-output-file",
+             po::value<std::string>(&context.partition.json_output_file)->value_name("<std::string>"),
+             "Writes the partitioning result, the full timer hierarchy, all stats counters and the "
+             "memory consumption as a JSON object to the given file")
+            ("trace-output-file",
+             po::value<std::string>(&context.partition.trace_output_file)->value_name("<std::string>"),
+             "Records begin and end of the major parallel tasks (coarsening passes, initial partitioning runs, "
+             "localized FM searches, flow searches, deep multilevel bipartitions and all timer scopes) on each "
+             "thread and writes them in the Chrome trace event format to the given file (can be loaded in Perfetto)")
+            ("memory-sampling-interval",
+             po::value<size_t>(&context.partition.memory_sampling_interval)->value_name("<size_t>")->default_value(0),
+             "If > 0, samples the resident set size of the process in the given interval (in milliseconds) "
+             "and reports the peak RSS and the number of bytes faulted into the process for each timer scope "
+             "in the timing output and the JSON output (0 = disabled)")
             ("algorithm-name",
              po::value<std::string>(&context.algorithm_name)->value_name("<std::string>")->default_value("MT-KaHyPar"),
              "An algorithm name to print into the summarized output (csv or sqlplottools). ")
@@ -192,12 +299,37 @@ namespace mt_kahypar {
                      "<bool>")->default_value(false),
              "If true, the incident edges of a vertex are sorted after construction, so that the hypergraph "
              "data structure is independent of scheduling during construction.")
+            ("p-sanitize-during-construction",
+             po::value<bool>(&context.preprocessing.sanitize_during_construction)->value_name("<bool>")->default_value(false),
+             "If true, duplicated pins and single-pin nets are removed and identical nets are merged into\n"
+             "one net (with the sum of their weights) while the hypergraph is constructed.\n"
+             "This does not change the objective of any partition (only for static hypergraphs).")
+            ("p-reorder-nodes",
+             po::value<bool>(&context.preprocessing.reorder_nodes)->value_name("<bool>")->default_value(false),
+             "If true, nodes and nets are renumbered in a breadth-first search order before partitioning,\n"
+             "which places nodes that share nets close to each other in memory")
+            ("p-compress-twin-nodes",
+             po::value<bool>(&context.preprocessing.compress_twin_nodes)->value_name("<bool>")->default_value(false),
+             "If true, nodes with identical sets of incident nets are contracted into weighted super-nodes\n"
+             "before partitioning and expanded afterwards (only for static hypergraphs)")
             ("p-enable-community-detection",
              po::value<bool>(&context.preprocessing.use_community_detection)->value_name("<bool>")->default_value(true),
              "If true, community detection is used as preprocessing step to restrict contractions to densely coupled regions in coarsening phase")
+            ("p-community-detection-algorithm",
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&](const std::string& algo) {
+                       context.preprocessing.community_detection_algorithm = communityDetectionAlgorithmFromString(algo);
+                     })->default_value("louvain"),
+             "Community detection algorithm:\n"
+             "- louvain\n"
+             "- label_propagation (size-constrained label propagation on the hypergraph, faster but lower quality)")
             ("p-disable-community-detection-on-mesh-graphs",
              po::value<bool>(&context.preprocessing.disable_community_detection_for_mesh_graphs)->value_name("<bool>")->default_value(true),
              "If true, community detection is dynamically disabled for mesh graphs (as it is not effective for this type of graphs).")
+            ("p-community-cache-dir",
+             po::value<std::string>(&context.preprocessing.community_cache_dir)->value_name("<string>")->default_value(""),
+             "If set, the results of the community detection are stored in this directory and reused by\n"
+             "subsequent runs on the same instance with the same community detection parameters")
             ("p-louvain-edge-weight-function",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& type) {
@@ -216,7 +348,9 @@ namespace mt_kahypar {
             ("p-louvain-low-memory-contraction",
              po::value<bool>(&context.preprocessing.community_detection.low_memory_contraction)->value_name(
                      "<bool>")->default_value(false),
-             "Maximum number of iterations over all nodes of one louvain pass")
+             "If true, communities are contracted without additional buffers and the first level\n"
+             "of the louvain method runs on an implicit representation of the bipartite graph\n"
+             "of the hypergraph instead of a materialized copy (only for hypergraphs)")
             ("p-louvain-min-vertex-move-fraction",
              po::value<long double>(&context.preprocessing.community_detection.min_vertex_move_fraction)->value_name(
                      "<long double>")->default_value(0.01),
@@ -228,7 +362,23 @@ namespace mt_kahypar {
             ("p-num-sub-rounds",
              po::value<size_t>(&context.preprocessing.community_detection.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic community detection in preprocessing.");
+             "Number of sub-rounds used for deterministic community detection in preprocessing.")
+            ("p-louvain-volume-update-sub-rounds",
+             po::value<size_t>(&context.preprocessing.community_detection.volume_update_sub_rounds)->value_name(
+                     "<size_t>")->default_value(0),
+             "If greater than one, a non-deterministic louvain pass is split into that many sub-rounds.\n"
+             "Each thread collects the cluster volume changes of its moves locally and they are applied\n"
+             "to the shared cluster volumes at the end of each sub-round (instead of atomically per move).")
+            ("p-louvain-use-active-node-set",
+             po::value<bool>(&context.preprocessing.community_detection.use_active_node_set)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, then a louvain pass only visits neighbors of nodes that moved in the previous pass\n"
+             "(only for non-deterministic community detection)")
+            ("p-louvain-vertex-following",
+             po::value<bool>(&context.preprocessing.community_detection.vertex_following)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, then nodes with only one neighbor are assigned to the community of their neighbor\n"
+             "before the first louvain pass (only for non-deterministic community detection)");
     return options;
   }
 
@@ -269,6 +419,31 @@ namespace mt_kahypar {
             ("c-max-shrink-factor",
              po::value<double>(&context.coarsening.maximum_shrink_factor)->value_name("<double>")->default_value(2.5),
              "Maximum factor a hypergraph is allowed to shrink in a clustering pass")
+            ("c-use-two-hop-clustering",
+             po::value<bool>(&context.coarsening.use_two_hop_clustering)->value_name("<bool>")->default_value(false),
+             "If true, vertices that are not clustered in a multilevel pass are grouped with other unclustered\n"
+             "vertices that prefer the same neighbor (e.g., leaves attached to the same hub), if the pass\n"
+             "does not shrink the hypergraph at least by c-two-hop-shrink-factor")
+            ("c-two-hop-shrink-factor",
+             po::value<double>(&context.coarsening.two_hop_clustering_shrink_factor)->value_name("<double>")->default_value(2.0),
+             "Two-hop clustering is performed if a clustering pass shrinks the hypergraph by less than this factor")
+            ("c-precontract-fixed-vertices",
+             po::value<bool>(&context.coarsening.precontract_fixed_vertices)->value_name("<bool>")->default_value(false),
+             "If true, all vertices fixed to the same block are contracted into one vertex before the first\n"
+             "clustering pass. This makes the costs of coarsening independent of the number of fixed vertices.")
+            ("c-vcycle-reuse-hierarchy",
+             po::value<bool>(&context.coarsening.vcycle_reuse_hierarchy)->value_name("<bool>")->default_value(false),
+             "If true, each V-cycle reuses the multilevel hierarchy of the previous V-cycle and only\n"
+             "recontracts the levels where nodes moved to a different block (multilevel coarsening only)")
+            ("c-propose-resolve-clustering",
+             po::value<bool>(&context.coarsening.propose_resolve_clustering)->value_name("<bool>")->default_value(false),
+             "If true, the multilevel coarsener computes clusterings in sub-rounds: the unmatched vertices\n"
+             "of a sub-round first propose a cluster and the proposals are resolved afterwards, instead of\n"
+             "matching vertices concurrently with CAS operations and conflict resolution")
+            ("c-propose-resolve-sub-rounds",
+             po::value<size_t>(&context.coarsening.num_sub_rounds_propose_resolve)->value_name(
+                     "<size_t>")->default_value(16),
+             "Number of sub-rounds used for propose-resolve clustering.")
             ("c-rating-score",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& rating_score) {
@@ -303,6 +478,11 @@ namespace mt_kahypar {
              "- best\n"
              #endif
              "- best_prefer_unmatched")
+            ("c-rating-pin-sampling-threshold",
+             po::value<HypernodeID>(&context.coarsening.rating.pin_sampling_threshold)->value_name(
+                     "<int>")->default_value(std::numeric_limits<HypernodeID>::max()),
+             "If set, only this number of pins is visited when rating nets with more pins.\n"
+             "The scores of the sampled pins are scaled by the ratio of net size and number of samples.")
             ("c-vertex-degree-sampling-threshold",
              po::value<size_t>(&context.coarsening.vertex_degree_sampling_threshold)->value_name(
                      "<size_t>")->default_value(std::numeric_limits<size_t>::max()),
@@ -332,6 +512,24 @@ namespace mt_kahypar {
                               &context.initial_partitioning.refinement.relative_improvement_threshold))->value_name(
                      "<double>")->default_value(0.0),
              "If the relative improvement during a refinement pass is less than this threshold, than refinement is aborted.")
+            ((initial_partitioning ? "i-r-adaptive-refinement" : "r-adaptive-refinement"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.adaptive_refinement :
+                              &context.initial_partitioning.refinement.adaptive_refinement))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, refinement algorithms whose improvement per second is poor on the levels processed so far\n"
+             "are skipped on the subsequent levels of the multilevel hierarchy (multilevel partitioner only).")
+            ((initial_partitioning ? "i-r-adaptive-refinement-min-yield" : "r-adaptive-refinement-min-yield"),
+             po::value<double>((!initial_partitioning ? &context.refinement.adaptive_refinement_min_yield :
+                              &context.initial_partitioning.refinement.adaptive_refinement_min_yield))->value_name(
+                     "<double>")->default_value(0.1),
+             "A refinement algorithm is skipped if its improvement per second is less than this fraction\n"
+             "of the average improvement per second of all refinement algorithms (adaptive refinement only).")
+            ((initial_partitioning ? "i-r-lazy-gain-cache-initialization" : "r-lazy-gain-cache-initialization"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.lazy_gain_cache_initialization :
+                              &context.initial_partitioning.refinement.lazy_gain_cache_initialization))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, the km1 gain cache entries of nodes not incident to a cut hyperedge are only written\n"
+             "on their first access (multilevel partitioner only).")
             (( initial_partitioning ? "i-r-max-batch-size" : "r-max-batch-size"),
              po::value<size_t>((!initial_partitioning ? &context.refinement.max_batch_size :
                                 &context.initial_partitioning.refinement.max_batch_size))->value_name("<size_t>")->default_value(1000),
@@ -365,6 +563,19 @@ namespace mt_kahypar {
                                 &context.initial_partitioning.refinement.deterministic_refinement.num_sub_rounds_sync_lp))->value_name(
                      "<size_t>")->default_value(5),
              "Number of sub-rounds for deterministic synchronous label propagation")
+            ((initial_partitioning ? "i-r-sync-lp-adaptive-sub-rounds" : "r-sync-lp-adaptive-sub-rounds"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.deterministic_refinement.adaptive_sub_rounds_sync_lp :
+                                &context.initial_partitioning.refinement.deterministic_refinement.adaptive_sub_rounds_sync_lp))->value_name(
+                     "<bool>")->default_value(false),
+             "If true, the number of sub-rounds of deterministic synchronous label propagation is derived from the\n"
+             "number of moves in the previous round (at most r-sync-lp-sub-rounds). This saves synchronization\n"
+             "in the last rounds, where only few nodes move.")
+            ((initial_partitioning ? "i-r-det-fm-sub-rounds" : "r-det-fm-sub-rounds"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.deterministic_refinement.num_sub_rounds_fm :
+                                &context.initial_partitioning.refinement.deterministic_refinement.num_sub_rounds_fm))->value_name(
+                     "<size_t>")->default_value(4),
+             "Number of sub-rounds for deterministic FM. In each sub-round, the localized searches run\n"
+             "on disjoint regions and their moves are applied once all searches are finished.")
             ((initial_partitioning ? "i-r-sync-lp-active-nodeset" : "r-sync-lp-active-nodeset"),
              po::value<bool>((!initial_partitioning ? &context.refinement.deterministic_refinement.use_active_node_set :
                                 &context.initial_partitioning.refinement.deterministic_refinement.use_active_node_set))->value_name(
@@ -387,11 +598,22 @@ namespace mt_kahypar {
                       &context.initial_partitioning.refinement.label_propagation.hyperedge_size_activation_threshold))->value_name(
                      "<size_t>")->default_value(100),
              "LP refiner activates only neighbors of moved vertices that are part of hyperedges with a size less than this threshold")
+            ((initial_partitioning ? "i-r-lp-high-degree-threshold" : "r-lp-high-degree-threshold"),
+             po::value<size_t>((!initial_partitioning ? &context.refinement.label_propagation.high_degree_threshold :
+                                &context.initial_partitioning.refinement.label_propagation.high_degree_threshold))->value_name(
+                     "<size_t>")->default_value(100000),
+             "LP refiner computes the gains of vertices with a degree larger than this threshold in parallel")
             ((initial_partitioning ? "i-r-lp-relative-improvement-threshold" : "r-lp-relative-improvement-threshold"),
              po::value<double>((!initial_partitioning ? &context.refinement.label_propagation.relative_improvement_threshold :
                                 &context.initial_partitioning.refinement.label_propagation.relative_improvement_threshold))->value_name(
                      "<double>")->default_value(-1.0),
              "Relative improvement threshold for label propagation.")
+            ((initial_partitioning ? "i-r-lp-use-active-node-set" : "r-lp-use-active-node-set"),
+             po::value<bool>((!initial_partitioning ? &context.refinement.label_propagation.use_active_node_set :
+                              &context.initial_partitioning.refinement.label_propagation.use_active_node_set))->value_name(
+                     "<bool>")->default_value(true),
+             "If true, only neighbors of vertices moved in the previous round are visited in a label propagation round.\n"
+             "Otherwise, each round visits all border vertices.")
             ((initial_partitioning ? "i-r-jet-type" : "r-jet-type"),
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&, initial_partitioning](const std::string& type) {
@@ -429,6 +651,12 @@ namespace mt_kahypar {
                      (initial_partitioning ? &context.initial_partitioning.refinement.jet.final_negative_gain_factor :
                       &context.refinement.jet.final_negative_gain_factor))->value_name("<double>")->default_value(0.0),
              "Final negative gain factor for dynamic gain factor")
+             ((initial_partitioning ? "i-r-jet-batched-gain-cache-updates" : "r-jet-batched-gain-cache-updates"),
+             po::value<bool>(
+                     (initial_partitioning ? &context.initial_partitioning.refinement.jet.batched_gain_cache_updates :
+                      &context.refinement.jet.batched_gain_cache_updates))->value_name("<bool>")->default_value(false),
+             "If true, Jet applies all moves of a round without delta gain updates and recomputes\n"
+             "the gain cache entries of all affected nodes afterwards in parallel")
             ((initial_partitioning ? "i-r-fm-type" : "r-fm-type"),
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&, initial_partitioning](const std::string& type) {
@@ -450,6 +678,12 @@ namespace mt_kahypar {
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.num_seed_nodes :
                                 &context.refinement.fm.num_seed_nodes))->value_name("<size_t>")->default_value(25),
              "Number of nodes to start the 'highly localized FM' with.")
+            ((initial_partitioning ? "i-r-fm-gain-ordered-seeds" : "r-fm-gain-ordered-seeds"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.gain_ordered_seeds :
+                              &context.refinement.fm.gain_ordered_seeds))->value_name("<bool>")->default_value(false),
+             "If true, localized FM searches are started from the seed nodes with the highest gain first.\n"
+             "The seed nodes are then distributed via a relaxed concurrent priority queue (multi queue)\n"
+             "instead of the thread-local FIFO queues.")
             (( initial_partitioning ? "i-r-fm-rollback-parallel" : "r-fm-rollback-parallel"),
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.rollback_parallel :
                               &context.refinement.fm.rollback_parallel))
@@ -479,6 +713,11 @@ namespace mt_kahypar {
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.fm.release_nodes :
                               &context.refinement.fm.release_nodes))->value_name("<bool>")->default_value(true),
              "FM releases nodes that weren't moved, so they might be found by another search.")
+            ((initial_partitioning ? "i-r-fm-adaptive-stop-rule-factor" : "r-fm-adaptive-stop-rule-factor"),
+             po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.fm.adaptive_stop_rule_factor :
+                              &context.refinement.fm.adaptive_stop_rule_factor))->value_name("<double>")->default_value(0.0),
+             "If > 0, a localized FM search stops if it performed more than the given factor times the number\n"
+             "of moves that 95% of the improvements of previous rounds on the same level required (default disabled)")
             ((initial_partitioning ? "i-r-fm-threshold-border-node-inclusion" : "r-fm-threshold-border-node-inclusion"),
              po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.fm.treshold_border_node_inclusion :
                               &context.refinement.fm.treshold_border_node_inclusion))->value_name("<double>")->default_value(0.75),
@@ -651,10 +890,36 @@ namespace mt_kahypar {
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.skip_unpromising_blocks :
                       &context.refinement.flows.skip_unpromising_blocks))->value_name("<bool>"),
              "If true, than blocks for which we never found an improvement are skipped")
+            ((initial_partitioning ? "i-r-flow-prioritize-block-pairs" : "r-flow-prioritize-block-pairs"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.prioritize_block_pairs :
+                      &context.refinement.flows.prioritize_block_pairs))->value_name("<bool>"),
+             "If true, block pairs of an active block scheduling round are scheduled in decreasing order of\n"
+             "their cut weight multiplied with the fraction of previous searches that found an improvement")
             ((initial_partitioning ? "i-r-flow-pierce-in-bulk" : "r-flow-pierce-in-bulk"),
              po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.pierce_in_bulk :
                               &context.refinement.flows.pierce_in_bulk))->value_name("<bool>"),
              "If true, then FlowCutter is accelerated by piercing multiple nodes at a time")
+            ((initial_partitioning ? "i-r-flow-reuse-problem-construction" : "r-flow-reuse-problem-construction"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.reuse_problem_construction :
+                              &context.refinement.flows.reuse_problem_construction))->value_name("<bool>"),
+             "If true, the region grown around the cut of a block pair is cached and reused when the\n"
+             "block pair is scheduled again and no move touched one of its hyperedges in the meantime")
+            ((initial_partitioning ? "i-r-flow-skip-unchanged-problems" : "r-flow-skip-unchanged-problems"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.skip_unchanged_problems :
+                              &context.refinement.flows.skip_unchanged_problems))->value_name("<bool>"),
+             "If true, the flow computation on a reused problem (see r-flow-reuse-problem-construction) is\n"
+             "skipped if it already found no improvement and the weights of both blocks did not change")
+            ((initial_partitioning ? "i-r-flow-parallel-region-growing" : "r-flow-parallel-region-growing"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.parallel_region_growing :
+                              &context.refinement.flows.parallel_region_growing))->value_name("<bool>"),
+             "If true, the region around the cut of a block pair is grown with a parallel BFS if the\n"
+             "search is granted more than one thread (e.g., if only few block pairs are active)")
+            ((initial_partitioning ? "i-r-flow-matching-based-scheduling" : "r-flow-matching-based-scheduling"),
+             po::value<bool>((initial_partitioning ? &context.initial_partitioning.refinement.flows.matching_based_scheduling :
+                              &context.refinement.flows.matching_based_scheduling))->value_name("<bool>"),
+             "If true, concurrent searches are preferably scheduled on block pairs with disjoint blocks.\n"
+             "Block pairs are chosen greedily in decreasing order of their cut weight (maximal matching),\n"
+             "and a block pair sharing a block with a running search is only scheduled if no other is left")
             ((initial_partitioning ? "i-r-flow-scaling" : "r-flow-scaling"),
              po::value<double>((initial_partitioning ? &context.initial_partitioning.refinement.flows.alpha :
                       &context.refinement.flows.alpha))->value_name("<double>"),
@@ -729,16 +994,38 @@ namespace mt_kahypar {
              po::value<size_t>(&context.initial_partitioning.min_adaptive_ip_runs)->value_name("<size_t>")->default_value(5),
              "If adaptive IP runs is enabled, than each initial partitioner performs minimum min_adaptive_ip_runs runs before\n"
              "it decides if it should terminate.")
+            ("i-use-portfolio-scheduling",
+             po::value<bool>(&context.initial_partitioning.use_portfolio_scheduling)->value_name("<bool>")->default_value(false),
+             "If true, the runs of the initial partitioners are not fixed in advance. Instead, after min_adaptive_ip_runs\n"
+             "warm-up runs, more runs are assigned to the initial partitioners that produced the best partitions so far\n"
+             "(the total number of runs stays the same). Not used in deterministic mode.")
             ("i-population-size",
              po::value<size_t>(&context.initial_partitioning.population_size)->value_name("<size_t>")->default_value(16),
              "Size of population of flat bipartitions to perform secondary FM refinement on in deterministic mode."
              "Values < num threads are set to num threads. Does not affect behavior in non-deterministic mode.")
+            ("i-max-num-nodes-for-sequential-ip",
+             po::value<HypernodeID>(&context.initial_partitioning.max_num_nodes_for_sequential_ip)->value_name("<uint32_t>")->default_value(256),
+             "Hypergraphs with at most this number of nodes are bipartitioned on a single thread. This avoids that\n"
+             "each thread creates its own copy of the hypergraph for tiny bipartitioning tasks (e.g., in deep multilevel).")
+            ("i-min-num-nodes-for-parallel-bfs",
+             po::value<HypernodeID>(&context.initial_partitioning.min_num_nodes_for_parallel_bfs)->value_name("<uint32_t>")->default_value(100000),
+             "The BFS traversals that compute the start nodes of the BFS, greedy and label propagation initial\n"
+             "partitioners are performed level-synchronous in parallel on hypergraphs with more than this number of nodes.")
+            ("i-parallel-lp-min-k",
+             po::value<PartitionID>(&context.initial_partitioning.parallel_lp_min_k)->value_name("<int32_t>")->default_value(
+                     std::numeric_limits<PartitionID>::max()),
+             "For k >= this threshold, direct k-way initial partitioning grows the blocks via parallel label propagation\n"
+             "on the shared coarse hypergraph instead of running the flat initial partitioners on thread-local copies.")
             ("i-perform-refinement-on-best-partitions",
              po::value<bool>(&context.initial_partitioning.perform_refinement_on_best_partitions)->value_name("<bool>")->default_value(false),
              "If true, then we perform an additional refinement on the best thread local partitions after IP.")
             ("i-fm-refinement-rounds",
              po::value<size_t>(&context.initial_partitioning.fm_refinment_rounds)->value_name("<size_t>")->default_value(1),
              "Maximum number of 2-way FM local searches on each bipartition produced by an initial partitioner.")
+            ("i-abort-unpromising-refinements",
+             po::value<bool>(&context.initial_partitioning.abort_unpromising_refinements)->value_name("<bool>")->default_value(true),
+             "If true, the refinement of a best partition stops after an FM round if repeating the improvement\n"
+             "of that round would still not beat the best partition found so far.")
             ("i-remove-degree-zero-hns-before-ip",
              po::value<bool>(&context.initial_partitioning.remove_degree_zero_hns_before_ip)->value_name("<bool>")->default_value(true),
              "If true, degree-zero vertices are removed before initial partitioning.")
@@ -770,6 +1057,7 @@ namespace mt_kahypar {
              "Strategy for solving the one-to-one mapping problem after initial partitioning.\n"
              "Available strategies:\n"
              " - greedy_mapping\n"
+             " - parallel_greedy_mapping\n"
              " - identity")
             ("mapping-use-local-search",
              po::value<bool>(&context.mapping.use_local_search)->value_name("<bool>"),
@@ -781,6 +1069,13 @@ namespace mt_kahypar {
             ("max-steiner-tree-size",
              po::value<size_t>(&context.mapping.max_steiner_tree_size)->value_name("<size_t>"),
              "We precompute all optimal steiner trees up to this size in the target graph.")
+            ("steiner-tree-cache-size",
+             po::value<size_t>(&context.mapping.steiner_tree_cache_size)->value_name("<size_t>"),
+             "Memory budget in MB for caching the steiner trees of connectivity sets that exceed max-steiner-tree-size.")
+            ("write-steiner-tree-tables",
+             po::value<bool>(&context.mapping.write_steiner_tree_tables)->value_name("<bool>"),
+             "If true, the precomputed steiner trees are written to <target-graph-file>.steiner_trees_<size>.bin.\n"
+             "Subsequent runs with the same target graph memory-map this file instead of repeating the precomputation.")
             ("mapping-largest-he-fraction",
              po::value<double>(&context.mapping.largest_he_fraction)->value_name("<double>"),
              "If x% (x = process-mapping-largest-he-fraction) of the largest hyperedges covers more than y% of the pins\n"
@@ -817,11 +1112,52 @@ namespace mt_kahypar {
             ("s-shuffle-block-size",
              po::value<size_t>(&context.shared_memory.shuffle_block_size)->value_name("<size_t>"),
              "If we perform a localized random shuffle in parallel, we perform a parallel for over blocks of size"
-             "'shuffle_block_size' and shuffle them sequential.");
+             "'shuffle_block_size' and shuffle them sequential.")
+            ("s-numa-aware-placement",
+             po::value<bool>(&context.shared_memory.use_numa_aware_placement)->value_name("<bool>"),
+             "If true, memory is placed on the NUMA node of the thread that first touches it (instead of\n"
+             "interleaved allocations) and label propagation processes contiguous vertex ranges on the\n"
+             "threads that initialized them. Recommended on systems with several NUMA nodes.")
+            ("s-use-huge-pages",
+             po::value<bool>(&context.shared_memory.use_huge_pages)->value_name("<bool>"),
+             "If true, large arrays are backed by transparent huge pages (2MB) to reduce TLB misses.\n"
+             "Has no effect if transparent huge pages are disabled on the system.")
+            ("s-use-background-reclamation",
+             po::value<bool>(&context.shared_memory.use_background_reclamation)->value_name("<bool>"),
+             "If true, large data structures that are not required any more (e.g., the levels of the\n"
+             "coarsening hierarchy) are freed on a background thread concurrently with the next phase.")
+            ("s-hwloc-topology-file",
+             po::value<std::string>(&context.shared_memory.hwloc_topology_file)->value_name("<string>"),
+             "Loads the hardware topology from an hwloc XML file (e.g., created with 'lstopo topology.xml')\n"
+             "instead of discovering it, which reduces the startup time on large machines.")
+            ("s-num-threads-for-flows",
+             po::value<size_t>(&context.shared_memory.num_threads_for_flows)->value_name("<size_t>"),
+             "Number of threads used by flow-based refinement. The threads are pinned to physical performance\n"
+             "cores first, since the compute-bound flow computations do not benefit from hyperthreads\n"
+             "(default: 0 = number of used physical performance cores).");
 
     return shared_memory_options;
   }
 
+  po::options_description createServerOptionsDescription(bool& server_mode,
+                                                         size_t& max_cached_instances,
+                                                         const int num_columns) {
+    po::options_description server_options("Server Options", num_columns);
+    server_options.add_options()
+            ("server",
+             po::value<bool>(&server_mode)->value_name("<bool>")->default_value(false),
+             "If true, jobs are read line by line from stdin. Each line contains the command line options\n"
+             "of one partitioning call (e.g., -h <file> -k 8 -e 0.03 -o km1 -m direct --preset-type=default).\n"
+             "The thread pool, hardware topology, memory pool and recently read (hyper)graphs are kept\n"
+             "between jobs. After each job, a line 'DONE <result as JSON>' or 'ERROR <message>' is written\n"
+             "to stdout. The server terminates on 'quit' or at the end of the input. Only shared memory\n"
+             "options can be passed to the server itself, they override the ones of the jobs.")
+            ("server-max-cached-instances",
+             po::value<size_t>(&max_cached_instances)->value_name("<size_t>")->default_value(4),
+             "Maximum number of (hyper)graphs kept in memory between jobs in server mode");
+    return server_options;
+  }
+
 
   po::options_description getIniOptionsDescription(Context& context) {
     const int num_columns = 80;
@@ -902,6 +1238,11 @@ namespace mt_kahypar {
             createMappingOptionsDescription(context, num_columns);
     po::options_description shared_memory_options =
             createSharedMemoryOptionsDescription(context, num_columns);
+    // Server mode is handled by processServerCommandLineInput(...)
+    bool server_mode = false;
+    size_t max_cached_instances = 0;
+    po::options_description server_options =
+            createServerOptionsDescription(server_mode, max_cached_instances, num_columns);
 
     po::options_description cmd_line_options;
     cmd_line_options
@@ -914,7 +1255,8 @@ namespace mt_kahypar {
             .add(refinement_options)
             .add(flow_options)
             .add(mapping_options)
-            .add(shared_memory_options);
+            .add(shared_memory_options)
+            .add(server_options);
 
     po::variables_map cmd_vm;
     po::store(po::parse_command_line(argc, argv, cmd_line_options), cmd_vm);
@@ -986,6 +1328,72 @@ namespace mt_kahypar {
   }
 
 
+  void processServerJob(Context& context, const std::string& job) {
+    // Split job into command line arguments
+    std::vector<std::string> args = { "MtKaHyPar" };
+    std::istringstream tokens(job);
+    std::string token;
+    while ( tokens >> token ) {
+      if ( token == "--help" ) {
+        throw InvalidInputException("Option --help is not supported in server mode");
+      }
+      args.push_back(token);
+    }
+    if ( args.size() == 1 ) {
+      // processCommandLineInput(...) would print the help message and exit
+      throw InvalidInputException("Job does not contain any options");
+    }
+    std::vector<char*> argv;
+    for ( std::string& arg : args ) {
+      argv.push_back(arg.data());
+    }
+    argv.push_back(nullptr);
+    const int argc = static_cast<int>(args.size());
+
+    try {
+      processCommandLineInput(context, argc, argv.data(), nullptr);
+      if ( context.partition.preset_type == PresetType::automatic ) {
+        throw UnsupportedOperationException("The automatic preset selection is not supported in server mode");
+      }
+      if ( context.partition.preset_file == "" ) {
+        if ( context.partition.preset_type == PresetType::UNDEFINED ) {
+          throw InvalidInputException("No preset specified");
+        }
+        // Only a preset type specified => load according preset
+        auto preset_option_list = loadPreset(context.partition.preset_type);
+        processCommandLineInput(context, argc, argv.data(), &preset_option_list);
+      }
+    } catch ( const po::error& e ) {
+      throw InvalidInputException(e.what());
+    }
+  }
+
+  bool processServerCommandLineInput(Context& context, size_t& max_cached_instances, int argc, char *argv[]) {
+    const int num_columns = platform::getTerminalWidth();
+
+    bool server_mode = false;
+    po::options_description server_options =
+            createServerOptionsDescription(server_mode, max_cached_instances, num_columns);
+
+    // The options of a partitioning call are not required in server mode
+    po::variables_map server_vm;
+    po::store(po::command_line_parser(argc, argv).options(server_options).allow_unregistered().run(), server_vm);
+    po::notify(server_vm);
+    if ( !server_mode ) {
+      return false;
+    }
+
+    po::options_description cmd_line_options;
+    cmd_line_options
+            .add(server_options)
+            .add(createSharedMemoryOptionsDescription(context, num_columns));
+    po::variables_map cmd_vm;
+    po::store(po::parse_command_line(argc, argv, cmd_line_options), cmd_vm);
+    po::notify(cmd_vm);
+    return true;
+  }
+
+
   void parseIniToContext(Context& context, const std::string& ini_filename, bool disable_verbose_output) {
     std::ifstream file(ini_filename.c_str());
     if (!file) {
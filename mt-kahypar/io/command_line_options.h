@@ -38,6 +38,13 @@ namespace mt_kahypar {
 using option = boost::program_options::basic_option<char>;
 
 void processCommandLineInput(Context& context, int argc, char *argv[], const std::vector<option>* preset_option_list);
+// ! Returns true, if the server mode is enabled (--server=true). In that case,
+// ! only the server and shared memory options are parsed into the context.
+bool processServerCommandLineInput(Context& context, size_t& max_cached_instances, int argc, char *argv[]);
+// ! Parses a job of the server mode, i.e., a line with the command line options of one
+// ! partitioning call, and loads the preset if only a preset type is given. Throws an
+// ! InvalidInputException if the job is malformed.
+void processServerJob(Context& context, const std::string& job);
 void parseIniToContext(Context& context, const std::string& ini_filename, bool disable_verbose_output = false);
 void presetToContext(Context& context, std::vector<option>& option_list, bool disable_verbose_output = false);
 
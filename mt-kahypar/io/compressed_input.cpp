@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "compressed_input.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include <tbb/parallel_pipeline.h>
+
+#ifdef KAHYPAR_USE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef KAHYPAR_USE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar::io {
+
+namespace {
+
+static constexpr size_t COMPRESSED_BLOCK_SIZE = UL(1) << 22;
+static constexpr size_t MAX_NUM_BLOCKS_IN_FLIGHT = 4;
+
+using Block = vec<char>;
+
+// ! Growable output buffer for the decompressed file
+class OutputBuffer {
+ public:
+  explicit OutputBuffer(const size_t initial_capacity) :
+    _data(nullptr),
+    _size(0),
+    _capacity(0) {
+    reserve(std::max(initial_capacity, COMPRESSED_BLOCK_SIZE));
+  }
+
+  OutputBuffer(const OutputBuffer&) = delete;
+  OutputBuffer& operator= (const OutputBuffer&) = delete;
+
+  ~OutputBuffer() {
+    free(_data);
+  }
+
+  // ! Returns a pointer to at least min_free bytes of free space
+  char* freeSpace(const size_t min_free) {
+    if ( _capacity - _size < min_free ) {
+      reserve(std::max(2 * _capacity, _size + min_free));
+    }
+    return _data + _size;
+  }
+
+  size_t numFreeBytes() const {
+    return _capacity - _size;
+  }
+
+  void advance(const size_t num_bytes) {
+    ASSERT(_size + num_bytes <= _capacity);
+    _size += num_bytes;
+  }
+
+  // ! Releases the buffer and terminates it with '\0'
+  char* release(size_t& length) {
+    freeSpace(1)[0] = '\0';
+    char* data = _data;
+    length = _size;
+    _data = nullptr;
+    _size = 0;
+    _capacity = 0;
+    return data;
+  }
+
+ private:
+  void reserve(const size_t capacity) {
+    char* data = static_cast<char*>(realloc(_data, capacity));
+    if ( data == nullptr ) {
+      throw SystemException("Failed to allocate memory for decompressed input file");
+    }
+    _data = data;
+    _capacity = capacity;
+  }
+
+  char* _data;
+  size_t _size;
+  size_t _capacity;
+};
+
+struct FileCloser {
+  void operator() (FILE* file) const {
+    fclose(file);
+  }
+};
+using FilePtr = std::unique_ptr<FILE, FileCloser>;
+
+FilePtr openFile(const std::string& filename) {
+  FilePtr file(fopen(filename.c_str(), "rb"));
+  if ( !file ) {
+    throw InvalidInputException("Could not open: " + filename);
+  }
+  return file;
+}
+
+size_t fileSize(FILE* file) {
+  fseek(file, 0, SEEK_END);
+  const long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  return size < 0 ? 0 : static_cast<size_t>(size);
+}
+
+/*!
+ * Runs a pipeline that reads the file in blocks of COMPRESSED_BLOCK_SIZE bytes
+ * and passes each block to the decompressor in order. Reading the next blocks
+ * overlaps with the decompression of the current block.
+ */
+template<typename Decompress>
+void runDecompressionPipeline(FILE* file, const Decompress& decompress) {
+  tbb::parallel_pipeline(MAX_NUM_BLOCKS_IN_FLIGHT,
+    tbb::make_filter<void, std::shared_ptr<Block>>(tbb::filter_mode::serial_in_order,
+      [&](tbb::flow_control& fc) -> std::shared_ptr<Block> {
+        auto block = std::make_shared<Block>(COMPRESSED_BLOCK_SIZE);
+        const size_t num_bytes = fread(block->data(), 1, block->size(), file);
+        if ( num_bytes == 0 ) {
+          fc.stop();
+          return nullptr;
+        }
+        block->resize(num_bytes);
+        return block;
+      }) &
+    tbb::make_filter<std::shared_ptr<Block>, void>(tbb::filter_mode::serial_in_order,
+      [&](std::shared_ptr<Block> block) {
+        decompress(*block);
+      }));
+}
+
+#ifdef KAHYPAR_USE_ZLIB
+char* decompressGzip(const std::string& filename, size_t& length) {
+  FilePtr file = openFile(filename);
+  const size_t compressed_size = fileSize(file.get());
+
+  z_stream stream;
+  std::memset(&stream, 0, sizeof(z_stream));
+  // 15 + 32 enables automatic detection of the gzip and zlib header
+  if ( inflateInit2(&stream, 15 + 32) != Z_OK ) {
+    throw SystemException("Failed to initialize zlib");
+  }
+  // Compressed text files typically have a compression ratio of around 4
+  OutputBuffer output(4 * compressed_size);
+  bool finished_stream = false;
+  bool valid = true;
+  runDecompressionPipeline(file.get(), [&](Block& block) {
+    stream.next_in = reinterpret_cast<Bytef*>(block.data());
+    stream.avail_in = block.size();
+    while ( valid && stream.avail_in > 0 ) {
+      if ( finished_stream ) {
+        // concatenated gzip members
+        inflateReset(&stream);
+        finished_stream = false;
+      }
+      char* out = output.freeSpace(COMPRESSED_BLOCK_SIZE);
+      const size_t num_free_bytes = std::min(output.numFreeBytes(), UL(UINT32_MAX));
+      stream.next_out = reinterpret_cast<Bytef*>(out);
+      stream.avail_out = num_free_bytes;
+      const int ret = inflate(&stream, Z_NO_FLUSH);
+      output.advance(num_free_bytes - stream.avail_out);
+      if ( ret == Z_STREAM_END ) {
+        finished_stream = true;
+      } else if ( ret != Z_OK && ret != Z_BUF_ERROR ) {
+        valid = false;
+      }
+    }
+  });
+  inflateEnd(&stream);
+  if ( !valid || !finished_stream ) {
+    throw InvalidInputException("Corrupted or truncated gzip file: " + filename);
+  }
+  return output.release(length);
+}
+#endif
+
+#ifdef KAHYPAR_USE_ZSTD
+char* decompressZstd(const std::string& filename, size_t& length) {
+  FilePtr file = openFile(filename);
+  const size_t compressed_size = fileSize(file.get());
+
+  // The first frame might store the decompressed size
+  size_t initial_capacity = 4 * compressed_size;
+  {
+    char header[ZSTD_FRAMEHEADERSIZE_MAX];
+    const size_t header_size = fread(header, 1, sizeof(header), file.get());
+    const unsigned long long content_size = ZSTD_getFrameContentSize(header, header_size);
+    if ( content_size != ZSTD_CONTENTSIZE_UNKNOWN && content_size != ZSTD_CONTENTSIZE_ERROR ) {
+      initial_capacity = content_size + 1;
+    }
+    fseek(file.get(), 0, SEEK_SET);
+  }
+
+  ZSTD_DStream* stream = ZSTD_createDStream();
+  if ( stream == nullptr ) {
+    throw SystemException("Failed to initialize zstd");
+  }
+  OutputBuffer output(initial_capacity);
+  size_t last_ret = 0;
+  bool valid = true;
+  runDecompressionPipeline(file.get(), [&](Block& block) {
+    ZSTD_inBuffer in { block.data(), block.size(), 0 };
+    while ( valid && in.pos < in.size ) {
+      ZSTD_outBuffer out { output.freeSpace(ZSTD_DStreamOutSize()), output.numFreeBytes(), 0 };
+      last_ret = ZSTD_decompressStream(stream, &out, &in);
+      output.advance(out.pos);
+      if ( ZSTD_isError(last_ret) ) {
+        valid = false;
+      }
+    }
+  });
+  // Flush remaining data buffered by the decoder
+  while ( valid && last_ret != 0 ) {
+    ZSTD_inBuffer in { nullptr, 0, 0 };
+    ZSTD_outBuffer out { output.freeSpace(ZSTD_DStreamOutSize()), output.numFreeBytes(), 0 };
+    last_ret = ZSTD_decompressStream(stream, &out, &in);
+    output.advance(out.pos);
+    if ( ZSTD_isError(last_ret) || out.pos == 0 ) {
+      valid = false;
+    }
+  }
+  ZSTD_freeDStream(stream);
+  if ( !valid ) {
+    throw InvalidInputException("Corrupted or truncated zstd file: " + filename);
+  }
+  return output.release(length);
+}
+#endif
+
+} // namespace
+
+CompressionType detectCompression(const std::string& filename) {
+  FilePtr file = openFile(filename);
+  unsigned char magic[4] = { 0, 0, 0, 0 };
+  const size_t num_bytes = fread(magic, 1, sizeof(magic), file.get());
+  if ( num_bytes >= 2 && magic[0] == 0x1F && magic[1] == 0x8B ) {
+    return CompressionType::gzip;
+  } else if ( num_bytes == 4 && magic[0] == 0x28 && magic[1] == 0xB5 &&
+              magic[2] == 0x2F && magic[3] == 0xFD ) {
+    return CompressionType::zstd;
+  }
+  return CompressionType::none;
+}
+
+char* decompressFile(const std::string& filename,
+                     const CompressionType type,
+                     size_t& length) {
+  #if !defined(KAHYPAR_USE_ZLIB) && !defined(KAHYPAR_USE_ZSTD)
+  unused(length);
+  #endif
+  switch ( type ) {
+    case CompressionType::gzip:
+      #ifdef KAHYPAR_USE_ZLIB
+      return decompressGzip(filename, length);
+      #else
+      throw UnsupportedOperationException("Reading gzip compressed files requires zlib "
+        "(add -DKAHYPAR_ENABLE_COMPRESSED_INPUT=On to your cmake command): " + filename);
+      #endif
+    case CompressionType::zstd:
+      #ifdef KAHYPAR_USE_ZSTD
+      return decompressZstd(filename, length);
+      #else
+      throw UnsupportedOperationException("Reading zstd compressed files requires libzstd "
+        "(add -DKAHYPAR_ENABLE_COMPRESSED_INPUT=On to your cmake command): " + filename);
+      #endif
+    case CompressionType::none:
+      break;
+  }
+  throw InvalidParameterException("File is not compressed: " + filename);
+}
+
+} // namespace mt_kahypar::io
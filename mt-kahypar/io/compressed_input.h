@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <string>
+
+namespace mt_kahypar {
+namespace io {
+
+enum class CompressionType {
+  none,
+  gzip,
+  zstd
+};
+
+// ! Detects the compression of a file based on its magic number
+CompressionType detectCompression(const std::string& filename);
+
+// ! Decompresses the given file into a buffer allocated with malloc, which must be
+// ! released via free. The buffer is terminated by an additional '\0' character that
+// ! is not included in length. Reading the file and decompression is pipelined, i.e.,
+// ! the next compressed block is read while the current one is decompressed.
+char* decompressFile(const std::string& filename,
+                     const CompressionType type,
+                     size_t& length);
+
+}  // namespace io
+}  // namespace mt_kahypar
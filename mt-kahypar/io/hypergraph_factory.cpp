@@ -54,10 +54,31 @@ mt_kahypar_hypergraph_t constructHypergraph(const HypernodeID& num_hypernodes,
     reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
 }
 
+mt_kahypar_hypergraph_t constructSanitizedHypergraph(const HypernodeID& num_hypernodes,
+                                                     const HyperedgeID& num_hyperedges,
+                                                     const HyperedgeVector& hyperedges,
+                                                     const HyperedgeWeight* hyperedge_weight,
+                                                     const HypernodeWeight* hypernode_weight,
+                                                     const HypernodeID num_removed_single_pin_hes,
+                                                     const bool stable_construction) {
+  ds::InputSanitization sanitization;
+  ds::StaticHypergraph* hypergraph = new ds::StaticHypergraph();
+  *hypergraph = ds::StaticHypergraphFactory::construct_sanitized(num_hypernodes, num_hyperedges,
+    hyperedges, hyperedge_weight, hypernode_weight, stable_construction, sanitization);
+  hypergraph->setNumRemovedHyperedges(num_removed_single_pin_hes +
+    sanitization.num_removed_single_pin_hyperedges);
+  if ( sanitization.num_removed_identical_hyperedges > 0 ) {
+    WARNING("Merged" << sanitization.num_removed_identical_hyperedges << "identical hyperedges!");
+  }
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), STATIC_HYPERGRAPH };
+}
+
 mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
                                         const mt_kahypar_hypergraph_type_t& type,
                                         const bool stable_construction,
-                                        const bool remove_single_pin_hes) {
+                                        const bool remove_single_pin_hes,
+                                        const bool sanitize = false) {
   HyperedgeID num_hyperedges = 0;
   HypernodeID num_hypernodes = 0;
   HyperedgeID num_removed_single_pin_hyperedges = 0;
@@ -70,6 +91,12 @@ mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
 
   switch ( type ) {
     case STATIC_HYPERGRAPH:
+      if ( sanitize ) {
+        return constructSanitizedHypergraph(
+          num_hypernodes, num_hyperedges, hyperedges,
+          hyperedges_weight.data(), hypernodes_weight.data(),
+          num_removed_single_pin_hyperedges, stable_construction);
+      }
       return constructHypergraph<ds::StaticHypergraph>(
         num_hypernodes, num_hyperedges, hyperedges,
         hyperedges_weight.data(), hypernodes_weight.data(),
@@ -139,24 +166,137 @@ mt_kahypar_hypergraph_t readMetisFile(const std::string& filename,
   }
 }
 
+mt_kahypar_hypergraph_t readEdgeListFile(const std::string& filename,
+                                         const FileFormat& format,
+                                         const mt_kahypar_hypergraph_type_t& type,
+                                         const bool stable_construction) {
+  HyperedgeID num_edges = 0;
+  HypernodeID num_vertices = 0;
+  HyperedgeVector edges;
+  io::readEdgeListFile(filename, format, num_edges, num_vertices, edges);
+
+  switch ( type ) {
+    case STATIC_HYPERGRAPH:
+      return constructHypergraph<ds::StaticHypergraph>(
+        num_vertices, num_edges, edges, nullptr, nullptr, 0, stable_construction);
+    ENABLE_GRAPHS(case STATIC_GRAPH:
+      return constructHypergraph<ds::StaticGraph>(
+        num_vertices, num_edges, edges, nullptr, nullptr, 0, stable_construction);
+    )
+    ENABLE_HIGHEST_QUALITY(case DYNAMIC_HYPERGRAPH:
+      return constructHypergraph<ds::DynamicHypergraph>(
+        num_vertices, num_edges, edges, nullptr, nullptr, 0, stable_construction);
+    )
+    ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(case DYNAMIC_GRAPH:
+      return constructHypergraph<ds::DynamicGraph>(
+        num_vertices, num_edges, edges, nullptr, nullptr, 0, stable_construction);
+    )
+    case NULLPTR_HYPERGRAPH:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+    default:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+}
+
+// ! The reader fills the input representation from a binary snapshot (file or shared memory)
+template<typename Reader>
+mt_kahypar_hypergraph_t constructFromBinarySnapshot(const Reader& read,
+                                                    const mt_kahypar_hypergraph_type_t& type,
+                                                    const bool stable_construction) {
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  HyperedgeVector hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  read(num_hyperedges, num_hypernodes, num_removed_single_pin_hyperedges,
+       hyperedges, hyperedges_weight, hypernodes_weight);
+
+  switch ( type ) {
+    case STATIC_HYPERGRAPH:
+      return constructHypergraph<ds::StaticHypergraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hyperedges, stable_construction);
+    ENABLE_GRAPHS(case STATIC_GRAPH:
+      return constructHypergraph<ds::StaticGraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hyperedges, stable_construction);
+    )
+    ENABLE_HIGHEST_QUALITY(case DYNAMIC_HYPERGRAPH:
+      return constructHypergraph<ds::DynamicHypergraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hyperedges, stable_construction);
+    )
+    ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(case DYNAMIC_GRAPH:
+      return constructHypergraph<ds::DynamicGraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hyperedges, stable_construction);
+    )
+    case NULLPTR_HYPERGRAPH:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+    default:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+}
+
+mt_kahypar_hypergraph_t readBinarySnapshot(const std::string& filename,
+                                           const mt_kahypar_hypergraph_type_t& type,
+                                           const bool stable_construction) {
+  return constructFromBinarySnapshot([&](auto&... input) {
+    readBinaryFile(filename, input...);
+  }, type, stable_construction);
+}
+
 } // namespace
 
+InstanceType instanceTypeOfInputFile(const std::string& filename,
+                                     const FileFormat& format) {
+  switch ( format ) {
+    case FileFormat::hMetis: return InstanceType::hypergraph;
+    case FileFormat::Metis: return InstanceType::graph;
+    case FileFormat::binary: return isBinaryGraphFile(filename) ?
+      InstanceType::graph : InstanceType::hypergraph;
+    case FileFormat::SNAP: return InstanceType::graph;
+    case FileFormat::MatrixMarket: return InstanceType::graph;
+  }
+  return InstanceType::UNDEFINED;
+}
+
 mt_kahypar_hypergraph_t readInputFile(const std::string& filename,
                                       const PresetType& preset,
                                       const InstanceType& instance,
                                       const FileFormat& format,
                                       const bool stable_construction,
-                                      const bool remove_single_pin_hes) {
+                                      const bool remove_single_pin_hes,
+                                      const bool sanitize) {
   mt_kahypar_hypergraph_type_t type = to_hypergraph_c_type(preset, instance);
   switch ( format ) {
     case FileFormat::hMetis: return readHMetisFile(
-      filename, type, stable_construction, remove_single_pin_hes);
+      filename, type, stable_construction, remove_single_pin_hes, sanitize);
     case FileFormat::Metis: return readMetisFile(
       filename, type, stable_construction);
+    case FileFormat::binary: return readBinarySnapshot(
+      filename, type, stable_construction);
+    case FileFormat::SNAP:
+    case FileFormat::MatrixMarket: return readEdgeListFile(
+      filename, format, type, stable_construction);
   }
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
 
+mt_kahypar_hypergraph_t readSharedMemoryHypergraph(const SharedMemoryHypergraph& shared_hg,
+                                                   const PresetType& preset,
+                                                   const bool stable_construction) {
+  const InstanceType instance = shared_hg.isGraph() ? InstanceType::graph : InstanceType::hypergraph;
+  return constructFromBinarySnapshot([&](auto&... input) {
+    shared_hg.read(input...);
+  }, to_hypergraph_c_type(preset, instance), stable_construction);
+}
+
 template<typename Hypergraph>
 Hypergraph readInputFile(const std::string& filename,
                          const FileFormat& format,
@@ -169,6 +309,13 @@ Hypergraph readInputFile(const std::string& filename,
       break;
     case FileFormat::Metis: hypergraph = readMetisFile(
       filename, Hypergraph::TYPE, stable_construction);
+      break;
+    case FileFormat::binary: hypergraph = readBinarySnapshot(
+      filename, Hypergraph::TYPE, stable_construction);
+      break;
+    case FileFormat::SNAP:
+    case FileFormat::MatrixMarket: hypergraph = readEdgeListFile(
+      filename, format, Hypergraph::TYPE, stable_construction);
   }
   return std::move(utils::cast<Hypergraph>(hypergraph));
 }
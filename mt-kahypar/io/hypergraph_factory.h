@@ -31,18 +31,33 @@
 #include "include/mtkahypartypes.h"
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/io/shared_memory.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/cast.h"
 
 namespace mt_kahypar {
 namespace io {
 
+// ! Determines whether the input file contains a graph or a hypergraph. For text formats,
+// ! this is implied by the format, whereas binary snapshots store it in their header.
+InstanceType instanceTypeOfInputFile(const std::string& filename,
+                                     const FileFormat& format);
+
+// ! If sanitize is true, identical hyperedges are merged during the construction of
+// ! static hypergraphs (see StaticHypergraphFactory::construct_sanitized(...))
 mt_kahypar_hypergraph_t readInputFile(const std::string& filename,
                                       const PresetType& preset,
                                       const InstanceType& instance,
                                       const FileFormat& format,
                                       const bool stable_construction = false,
-                                      const bool remove_single_pin_hes = true);
+                                      const bool remove_single_pin_hes = true,
+                                      const bool sanitize = false);
+
+// ! Constructs a (hyper)graph from a shared memory segment. Whether it is a graph
+// ! or a hypergraph is stored in the segment.
+mt_kahypar_hypergraph_t readSharedMemoryHypergraph(const SharedMemoryHypergraph& shared_hg,
+                                                   const PresetType& preset,
+                                                   const bool stable_construction = false);
 
 template<typename Hypergraph>
 Hypergraph readInputFile(const std::string& filename,
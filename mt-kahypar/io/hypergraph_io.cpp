@@ -27,11 +27,16 @@
 
 #include "hypergraph_io.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <fstream>
 #include <iostream>
 #include <thread>
 #include <memory>
+#include <sstream>
 #include <vector>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -46,10 +51,17 @@
 #endif
 
 
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_sort.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/compressed_input.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/utils/bit_ops.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/exception.h"
 
@@ -61,6 +73,7 @@ namespace mt_kahypar::io {
     HANDLE hMem;
     char* mapped_file;
     size_t length;
+    bool in_memory = false;
 
     void closeHandle() {
       CloseHandle(hFile);
@@ -72,6 +85,7 @@ namespace mt_kahypar::io {
     int fd;
     char* mapped_file;
     size_t length;
+    bool in_memory = false;
 
     void closeHandle() {
       close(fd);
@@ -146,6 +160,10 @@ namespace mt_kahypar::io {
   }
 
   void munmap_file(FileHandle& handle) {
+    if ( handle.in_memory ) {
+      free(handle.mapped_file);
+      return;
+    }
     #ifdef _WIN32
     UnmapViewOfFile(handle.mapped_file);
     #else
@@ -154,6 +172,18 @@ namespace mt_kahypar::io {
     handle.closeHandle();
   }
 
+  // ! Maps an uncompressed input file to memory or decompresses it into an in-memory buffer
+  FileHandle open_input_file(const std::string& filename) {
+    const CompressionType compression = detectCompression(filename);
+    if ( compression == CompressionType::none ) {
+      return mmap_file(filename);
+    }
+    FileHandle handle;
+    handle.mapped_file = decompressFile(filename, compression, handle.length);
+    handle.in_memory = true;
+    return handle;
+  }
+
 
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   bool is_line_ending(char* mapped_file, size_t pos) {
@@ -182,21 +212,72 @@ namespace mt_kahypar::io {
     }
   }
 
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  bool is_digit(const char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  // ! Returns the number of leading digits (at most eight) of the eight bytes
+  // ! stored in chunk (the first byte of the input is the lowest byte).
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t num_leading_digits(const uint64_t chunk) {
+    // A byte is a digit iff its high nibble is 3 before and after adding 6
+    const uint64_t high_nibbles = chunk & 0xF0F0F0F0F0F0F0F0;
+    const uint64_t shifted_high_nibbles = (chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0;
+    const uint64_t non_digit = (high_nibbles ^ 0x3030303030303030) |
+                               (shifted_high_nibbles ^ 0x3030303030303030) |
+                               (chunk & 0x8080808080808080);
+    // Mark the highest bit of each byte that is not a digit
+    const uint64_t non_digit_mask = (((non_digit & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F) |
+                                     non_digit) & 0x8080808080808080;
+    return non_digit_mask == 0 ? 8 : utils::lowest_set_bit_64(non_digit_mask) / 8;
+  }
+
+  // ! Parses the first num_digits digits of the eight bytes stored in chunk
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  uint64_t parse_digits(uint64_t chunk, const size_t num_digits) {
+    ASSERT(num_digits > 0 && num_digits <= 8);
+    // Move the digits to the highest bytes, which implicitly adds leading zeros
+    chunk = (chunk - 0x3030303030303030) << (8 * (8 - num_digits));
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+             (((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+    return chunk;
+  }
+
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   int64_t read_number(char* mapped_file, size_t& pos, const size_t length) {
+    static constexpr uint64_t POW_10[9] =
+      { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
     int64_t number = 0;
-    while ( mapped_file[pos] == ' ' ) {
+    while ( pos < length && mapped_file[pos] == ' ' ) {
       ++pos;
     }
-    for ( ; pos < length; ++pos ) {
-      if ( mapped_file[pos] == ' ' || is_line_ending(mapped_file, pos) ) {
-        while ( mapped_file[pos] == ' ' ) {
-          ++pos;
-        }
+    const size_t start = pos;
+    // Parse eight bytes at once as long as they are within the mapped file
+    while ( pos + 8 <= length ) {
+      uint64_t chunk;
+      std::memcpy(&chunk, mapped_file + pos, sizeof(uint64_t));
+      const size_t num_digits = num_leading_digits(chunk);
+      if ( num_digits > 0 ) {
+        number = number * POW_10[num_digits] + parse_digits(chunk, num_digits);
+        pos += num_digits;
+      }
+      if ( num_digits < 8 ) {
         break;
       }
-      ASSERT(mapped_file[pos] >= '0' && mapped_file[pos] <= '9');
-      number = number * 10 + (mapped_file[pos] - '0');
+    }
+    if ( pos + 8 > length ) {
+      for ( ; pos < length && is_digit(mapped_file[pos]); ++pos ) {
+        number = number * 10 + (mapped_file[pos] - '0');
+      }
+    }
+    if ( pos == start && pos < length && !is_line_ending(mapped_file, pos) ) {
+      throw InvalidInputException(std::string("Unexpected character '") +
+        mapped_file[pos] + "' in input file at position " + STR(pos));
+    }
+    while ( pos < length && mapped_file[pos] == ' ' ) {
+      ++pos;
     }
     return number;
   }
@@ -220,30 +301,100 @@ namespace mt_kahypar::io {
     do_line_ending(mapped_file, pos);
   }
 
-  struct HyperedgeRange {
-    const size_t start;
-    const size_t end;
-    const HyperedgeID start_id;
-    const HyperedgeID num_hyperedges;
+  // ! Range of complete lines in the input file that is processed by a single task
+  struct LineRange {
+    size_t start;
+    size_t end;
+    // index of the first non-comment line in this range (w.r.t. to all ranges)
+    size_t first_line;
+    size_t num_lines;
   };
 
-  inline bool isSinglePinHyperedge(char* mapped_file,
-                                          size_t pos,
-                                          const size_t length,
-                                          const bool has_hyperedge_weights) {
-    size_t num_spaces = 0;
-    for ( ; pos < length; ++pos ) {
-      if (is_line_ending(mapped_file, pos)) {
-        break;
-      } else if ( mapped_file[pos] == ' ' ) {
-        ++num_spaces;
+  // ! Calls f(line_index, line_start, line_end) for each non-comment line of the range.
+  // ! The line end excludes the line ending characters.
+  template<typename F>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void for_each_line(char* mapped_file, const LineRange& range, const F& f) {
+    size_t line = range.first_line;
+    for ( size_t pos = range.start; pos < range.end; ) {
+      const char* newline = static_cast<const char*>(
+        std::memchr(mapped_file + pos, '\n', range.end - pos));
+      const size_t next_pos = newline ? static_cast<size_t>(newline - mapped_file) + 1 : range.end;
+      size_t line_end = newline ? next_pos - 1 : range.end;
+      if ( line_end > pos && mapped_file[line_end - 1] == '\r' ) {
+        --line_end;  // windows line ending
       }
+      if ( mapped_file[pos] != '%' ) {
+        f(line++, pos, line_end);
+      }
+      pos = next_pos;
+    }
+    ASSERT(line == range.first_line + range.num_lines);
+  }
 
-      if ( num_spaces == 2 ) {
-        break;
+  // ! Splits the input file starting at position start into ranges of complete lines
+  // ! and computes the index of the first non-comment line of each range in parallel.
+  vec<LineRange> computeLineRanges(char* mapped_file, const size_t start, const size_t length) {
+    static constexpr size_t MIN_BYTES_PER_RANGE = UL(1) << 16;
+    const size_t num_bytes = length - start;
+    const size_t num_ranges = std::max(UL(1), std::min(
+      UL(4 * std::thread::hardware_concurrency()), num_bytes / MIN_BYTES_PER_RANGE));
+
+    // Each range starts at the first line start after its (equally spaced) byte offset
+    vec<size_t> range_starts(num_ranges + 1, length);
+    range_starts[0] = start;
+    tbb::parallel_for(UL(1), num_ranges, [&](const size_t i) {
+      const size_t offset = start + (i * num_bytes) / num_ranges;
+      const char* newline = static_cast<const char*>(
+        std::memchr(mapped_file + offset - 1, '\n', length - offset + 1));
+      range_starts[i] = newline ? static_cast<size_t>(newline - mapped_file) + 1 : length;
+    });
+
+    vec<LineRange> ranges(num_ranges);
+    vec<size_t> num_lines(num_ranges, 0);
+    tbb::parallel_for(UL(0), num_ranges, [&](const size_t i) {
+      const size_t end = std::max(range_starts[i], range_starts[i + 1]);
+      size_t count = 0;
+      for ( size_t pos = range_starts[i]; pos < end; ) {
+        const char* newline = static_cast<const char*>(
+          std::memchr(mapped_file + pos, '\n', end - pos));
+        count += mapped_file[pos] != '%';
+        pos = newline ? static_cast<size_t>(newline - mapped_file) + 1 : end;
       }
+      ranges[i] = LineRange { range_starts[i], end, 0, count };
+      num_lines[i] = count;
+    });
+
+    // Exclusive prefix sum over the number of lines per range
+    vec<size_t> line_prefix_sum(num_ranges, 0);
+    parallel_prefix_sum(num_lines.begin(), num_lines.end(),
+      line_prefix_sum.begin(), std::plus<size_t>(), UL(0));
+    for ( size_t i = 0; i < num_ranges; ++i ) {
+      ranges[i].first_line = line_prefix_sum[i] - ranges[i].num_lines;
     }
-    return has_hyperedge_weights ? num_spaces == 1 : num_spaces == 0;
+    return ranges;
+  }
+
+  size_t numberOfLines(const vec<LineRange>& ranges) {
+    return ranges.empty() ? 0 : ranges.back().first_line + ranges.back().num_lines;
+  }
+
+  // ! Returns whether the range contains a line in [first_line, last_line)
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  bool overlaps(const LineRange& range, const size_t first_line, const size_t last_line) {
+    return range.num_lines > 0 && range.first_line < last_line &&
+           range.first_line + range.num_lines > first_line;
+  }
+
+  inline bool isSinglePinHyperedge(char* mapped_file,
+                                   size_t pos,
+                                   const size_t line_end,
+                                   const bool has_hyperedge_weights) {
+    if ( has_hyperedge_weights ) {
+      read_number(mapped_file, pos, line_end);
+    }
+    read_number(mapped_file, pos, line_end);
+    return pos == line_end;
   }
 
   struct HyperedgeReadResult {
@@ -258,8 +409,7 @@ namespace mt_kahypar::io {
   };
 
   HyperedgeReadResult readHyperedges(char* mapped_file,
-                                     size_t& pos,
-                                     const size_t length,
+                                     const vec<LineRange>& ranges,
                                      const HyperedgeID num_hyperedges,
                                      const mt_kahypar::Type type,
                                      HyperedgeVector& hyperedges,
@@ -270,126 +420,90 @@ namespace mt_kahypar::io {
                                        type == mt_kahypar::Type::EdgeAndNodeWeights ?
                                        true : false;
 
-    vec<HyperedgeRange> hyperedge_ranges;
-    tbb::parallel_invoke([&] {
-      // Sequential pass over all hyperedges to determine ranges in the
-      // input file that are read in parallel.
-      size_t current_range_start = pos;
-      HyperedgeID current_range_start_id = 0;
-      HyperedgeID current_range_num_hyperedges = 0;
-      HyperedgeID current_num_hyperedges = 0;
-      const HyperedgeID num_hyperedges_per_range = std::max(
-              (num_hyperedges / ( 2 * std::thread::hardware_concurrency())), ID(1));
-      while ( current_num_hyperedges < num_hyperedges ) {
-        // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
-          goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
-        }
-
-        // This check is fine even with windows line endings!
-        ASSERT(mapped_file[pos - 1] == '\n');
-        if ( !remove_single_pin_hes || !isSinglePinHyperedge(mapped_file, pos, length, has_hyperedge_weights) ) {
-          ++current_range_num_hyperedges;
-        } else {
-          ++res.num_removed_single_pin_hyperedges;
-        }
-        ++current_num_hyperedges;
-        goto_next_line(mapped_file, pos, length);
-
-        // If there are enough hyperedges in the current scanned range
-        // we store that range, which will be later processed in parallel
-        if ( current_range_num_hyperedges == num_hyperedges_per_range ) {
-          hyperedge_ranges.push_back(HyperedgeRange {
-                  current_range_start, pos, current_range_start_id, current_range_num_hyperedges});
-          current_range_start = pos;
-          current_range_start_id += current_range_num_hyperedges;
-          current_range_num_hyperedges = 0;
+    // The hyperedge of a line is its line index minus the number of
+    // single-pin hyperedges in front of it, which we compute via a prefix sum
+    vec<size_t> num_removed_before(ranges.size(), 0);
+    if ( remove_single_pin_hes ) {
+      vec<size_t> num_removed(ranges.size(), 0);
+      tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+        if ( overlaps(ranges[i], 0, num_hyperedges) ) {
+          for_each_line(mapped_file, ranges[i], [&](const size_t line, const size_t start, const size_t end) {
+            if ( line < num_hyperedges && isSinglePinHyperedge(mapped_file, start, end, has_hyperedge_weights) ) {
+              ++num_removed[i];
+            }
+          });
         }
+      });
+      parallel_prefix_sum(num_removed.begin(), num_removed.end(),
+        num_removed_before.begin(), std::plus<size_t>(), UL(0));
+      res.num_removed_single_pin_hyperedges = num_removed_before.back();
+      for ( size_t i = 0; i < ranges.size(); ++i ) {
+        num_removed_before[i] -= num_removed[i];
       }
-      if ( current_range_num_hyperedges > 0 ) {
-        hyperedge_ranges.push_back(HyperedgeRange {
-                current_range_start, pos, current_range_start_id, current_range_num_hyperedges});
-      }
-    }, [&] {
-      hyperedges.resize(num_hyperedges);
+    }
+
+    const HyperedgeID tmp_num_hyperedges = num_hyperedges - res.num_removed_single_pin_hyperedges;
+    tbb::parallel_invoke([&] {
+      hyperedges.resize(tmp_num_hyperedges);
     }, [&] {
       if ( has_hyperedge_weights ) {
-        hyperedges_weight.resize(num_hyperedges);
+        hyperedges_weight.resize(tmp_num_hyperedges);
       }
     });
 
-    const HyperedgeID tmp_num_hyperedges = num_hyperedges - res.num_removed_single_pin_hyperedges;
-    hyperedges.resize(tmp_num_hyperedges);
-    if ( has_hyperedge_weights ) {
-      hyperedges_weight.resize(tmp_num_hyperedges);
-    }
-
     // Process all ranges in parallel and build hyperedge vector
-    tbb::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
-      HyperedgeRange& range = hyperedge_ranges[i];
-      size_t current_pos = range.start;
-      const size_t current_end = range.end;
-      HyperedgeID current_id = range.start_id;
-      const HyperedgeID last_id = current_id + range.num_hyperedges;
-
-      while ( current_id < last_id ) {
-        // Skip Comments
-        ASSERT(current_pos < current_end);
-        while ( mapped_file[current_pos] == '%' ) {
-          goto_next_line(mapped_file, current_pos, current_end);
-          ASSERT(current_pos < current_end);
-        }
-
-        if ( !remove_single_pin_hes || !isSinglePinHyperedge(mapped_file, current_pos, current_end, has_hyperedge_weights) ) {
-          ASSERT(current_id < hyperedges.size());
-          if ( has_hyperedge_weights ) {
-            hyperedges_weight[current_id] = read_number(mapped_file, current_pos, current_end);
-          }
+    tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+      if ( !overlaps(ranges[i], 0, num_hyperedges) ) {
+        return;
+      }
+      size_t num_removed = num_removed_before[i];
+      for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+        if ( line >= num_hyperedges ) {
+          return;
+        }
+        if ( remove_single_pin_hes && isSinglePinHyperedge(mapped_file, pos, end, has_hyperedge_weights) ) {
+          ++num_removed;
+          return;
+        }
 
-          Hyperedge& hyperedge = hyperedges[current_id];
-          // Note, a hyperedge line must contain at least one pin
-          HypernodeID pin = read_number(mapped_file, current_pos, current_end);
+        const HyperedgeID current_id = line - num_removed;
+        ASSERT(current_id < hyperedges.size());
+        if ( has_hyperedge_weights ) {
+          hyperedges_weight[current_id] = read_number(mapped_file, pos, end);
+        }
+
+        Hyperedge& hyperedge = hyperedges[current_id];
+        // Note, a hyperedge line must contain at least one pin
+        while ( pos < end ) {
+          const HypernodeID pin = read_number(mapped_file, pos, end);
           ASSERT(pin > 0, V(current_id));
           hyperedge.push_back(pin - 1);
-          while ( !is_line_ending(mapped_file, current_pos) ) {
-            pin = read_number(mapped_file, current_pos, current_end);
-            ASSERT(pin > 0, V(current_id));
-            hyperedge.push_back(pin - 1);
-          }
-          do_line_ending(mapped_file, current_pos);
-
-          // Detect duplicated pins
-          std::sort(hyperedge.begin(), hyperedge.end());
-          size_t j = 1;
-          for ( size_t i = 1; i < hyperedge.size(); ++i ) {
-            if ( hyperedge[j - 1] != hyperedge[i] ) {
-              std::swap(hyperedge[i], hyperedge[j++]);
-            }
-          }
-          if ( j < hyperedge.size() ) {
-            // Remove duplicated pins
-            __atomic_fetch_add(&res.num_hes_with_duplicated_pins, 1, __ATOMIC_RELAXED);
-            __atomic_fetch_add(&res.num_duplicated_pins, hyperedge.size() - j, __ATOMIC_RELAXED);
-            for ( size_t i = j; i < hyperedge.size(); ++i ) {
-              hyperedge.pop_back();
-            }
-          }
+        }
 
-          ASSERT(hyperedge.size() >= 2);
-          ++current_id;
-        } else {
-          goto_next_line(mapped_file, current_pos, current_end);
+        // Detect duplicated pins
+        std::sort(hyperedge.begin(), hyperedge.end());
+        size_t j = 1;
+        for ( size_t k = 1; k < hyperedge.size(); ++k ) {
+          if ( hyperedge[j - 1] != hyperedge[k] ) {
+            std::swap(hyperedge[k], hyperedge[j++]);
+          }
         }
-      }
+        if ( j < hyperedge.size() ) {
+          // Remove duplicated pins
+          __atomic_fetch_add(&res.num_hes_with_duplicated_pins, 1, __ATOMIC_RELAXED);
+          __atomic_fetch_add(&res.num_duplicated_pins, hyperedge.size() - j, __ATOMIC_RELAXED);
+          hyperedge.resize(j);
+        }
+
+        ASSERT(!remove_single_pin_hes || hyperedge.size() >= 2);
+      });
     });
     return res;
   }
 
   void readHypernodeWeights(char* mapped_file,
-                            size_t& pos,
-                            const size_t length,
+                            const vec<LineRange>& ranges,
+                            const HyperedgeID num_hyperedges,
                             const HypernodeID num_hypernodes,
                             const mt_kahypar::Type type,
                             vec<HypernodeWeight>& hypernodes_weight) {
@@ -397,13 +511,19 @@ namespace mt_kahypar::io {
                                  type == mt_kahypar::Type::EdgeAndNodeWeights ?
                                  true : false;
     if ( has_hypernode_weights ) {
+      // The hypernode weights are stored in the lines after the hyperedges
+      const size_t first_line = num_hyperedges;
+      const size_t last_line = first_line + num_hypernodes;
       hypernodes_weight.resize(num_hypernodes);
-      for ( HypernodeID hn = 0; hn < num_hypernodes; ++hn ) {
-        ASSERT(pos > 0 && pos < length);
-        ASSERT(mapped_file[pos - 1] == '\n');
-        hypernodes_weight[hn] = read_number(mapped_file, pos, length);
-        do_line_ending(mapped_file, pos);
-      }
+      tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+        if ( overlaps(ranges[i], first_line, last_line) ) {
+          for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+            if ( line >= first_line && line < last_line ) {
+              hypernodes_weight[line - first_line] = read_number(mapped_file, pos, end);
+            }
+          });
+        }
+      });
     }
   }
 
@@ -417,17 +537,40 @@ namespace mt_kahypar::io {
                           vec<HypernodeWeight>& hypernodes_weight,
                           const bool remove_single_pin_hes) {
     ASSERT(!filename.empty(), "No filename for hypergraph file specified");
-    FileHandle handle = mmap_file(filename);
+    FileHandle handle = open_input_file(filename);
     size_t pos = 0;
 
     // Read Hypergraph Header
     mt_kahypar::Type type = mt_kahypar::Type::Unweighted;
     readHGRHeader(handle.mapped_file, pos, handle.length, num_hyperedges, num_hypernodes, type);
 
-    // Read Hyperedges
-    HyperedgeReadResult res =
-            readHyperedges(handle.mapped_file, pos, handle.length, num_hyperedges,
-              type, hyperedges, hyperedges_weight, remove_single_pin_hes);
+    // Split the remaining file into line ranges that are processed in parallel
+    const vec<LineRange> ranges = computeLineRanges(handle.mapped_file, pos, handle.length);
+    const bool has_hypernode_weights = type == mt_kahypar::Type::NodeWeights ||
+                                       type == mt_kahypar::Type::EdgeAndNodeWeights;
+    const size_t expected_num_lines = num_hyperedges + (has_hypernode_weights ? num_hypernodes : 0);
+    if ( numberOfLines(ranges) < expected_num_lines ) {
+      munmap_file(handle);
+      throw InvalidInputException("Hypergraph file " + filename + " contains less lines (" +
+        STR(numberOfLines(ranges)) + ") than specified in its header (" + STR(expected_num_lines) + ")");
+    }
+    ASSERT(numberOfLines(ranges) == expected_num_lines);
+
+    HyperedgeReadResult res;
+    try {
+      tbb::parallel_invoke([&] {
+        // Read Hyperedges
+        res = readHyperedges(handle.mapped_file, ranges, num_hyperedges,
+          type, hyperedges, hyperedges_weight, remove_single_pin_hes);
+      }, [&] {
+        // Read Hypernode Weights
+        readHypernodeWeights(handle.mapped_file, ranges, num_hyperedges,
+          num_hypernodes, type, hypernodes_weight);
+      });
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
     num_hyperedges -= res.num_removed_single_pin_hyperedges;
     num_removed_single_pin_hyperedges = res.num_removed_single_pin_hyperedges;
 
@@ -436,15 +579,6 @@ namespace mt_kahypar::io {
         << res.num_hes_with_duplicated_pins << "hyperedges!");
     }
 
-    // Read Hypernode Weights
-    readHypernodeWeights(handle.mapped_file, pos, handle.length, num_hypernodes, type, hypernodes_weight);
-
-    // Check the end of the file
-    while ( handle.mapped_file[pos] == '%' ) {
-      goto_next_line(handle.mapped_file, pos, handle.length);
-    }
-    ASSERT(pos == handle.length);
-
     munmap_file(handle);
   }
 
@@ -475,17 +609,8 @@ namespace mt_kahypar::io {
     do_line_ending(mapped_file, pos);
   }
 
-  struct VertexRange {
-    const size_t start;
-    const size_t end;
-    const HypernodeID vertex_start_id;
-    const HypernodeID num_vertices;
-    const HyperedgeID edge_start_id;
-  };
-
   void readVertices(char* mapped_file,
-                    size_t& pos,
-                    const size_t length,
+                    const vec<LineRange>& ranges,
                     const HyperedgeID num_edges,
                     const HypernodeID num_vertices,
                     const bool has_edge_weights,
@@ -493,70 +618,32 @@ namespace mt_kahypar::io {
                     HyperedgeVector& edges,
                     vec<HyperedgeWeight>& edges_weight,
                     vec<HypernodeWeight>& vertices_weight) {
-    vec<VertexRange> vertex_ranges;
+    // Count the forward edges of each range, ignore backward edges.
+    // This is necessary because we can only calculate unique edge ids
+    // efficiently if the edges are deduplicated.
+    vec<size_t> num_forward_edges(ranges.size(), 0);
     tbb::parallel_invoke([&] {
-      // Sequential pass over all vertices to determine ranges in the
-      // input file that are read in parallel.
-      // Additionally, we need to sum the vertex degrees to determine edge indices.
-      size_t current_range_start = pos;
-      HypernodeID current_range_vertex_id = 0;
-      HypernodeID current_range_num_vertices = 0;
-      HyperedgeID current_range_edge_id = 0;
-      HyperedgeID current_range_num_edges = 0;
-      const HypernodeID num_vertices_per_range = std::max(
-              (num_vertices / ( 2 * std::thread::hardware_concurrency())), ID(1));
-      while ( current_range_vertex_id + current_range_num_vertices < num_vertices ) {
-        // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
-          goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
-        }
-
-        ASSERT(mapped_file[pos - 1] == '\n');
-        ++current_range_num_vertices;
-
-        // Count the forward edges, ignore backward edges.
-        // This is necessary because we can only calculate unique edge ids
-        // efficiently if the edges are deduplicated.
-        if ( has_vertex_weights ) {
-          read_number(mapped_file, pos, length);
-        }
-        HyperedgeID vertex_degree = 0;
-        while (!is_line_ending(mapped_file, pos) && pos < length) {
-          const HypernodeID source = current_range_vertex_id + current_range_num_vertices;
-          const HypernodeID target = read_number(mapped_file, pos, length);
-          ASSERT(source != target);
-          if ( source < target ) {
-            ++vertex_degree;
+      tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+        if ( !overlaps(ranges[i], 0, num_vertices) ) {
+          return;
+        }
+        for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+          if ( line >= num_vertices ) {
+            return;
           }
-          if ( has_edge_weights ) {
-            read_number(mapped_file, pos, length);
+          if ( has_vertex_weights ) {
+            read_number(mapped_file, pos, end);
           }
-        }
-        do_line_ending(mapped_file, pos);
-        current_range_num_edges += vertex_degree;
-
-        // If there are enough vertices in the current scanned range
-        // we store that range, which will be processed in parallel later
-        if ( current_range_num_vertices == num_vertices_per_range ) {
-          vertex_ranges.push_back(VertexRange {
-                  current_range_start, pos, current_range_vertex_id, current_range_num_vertices, current_range_edge_id});
-          current_range_start = pos;
-          current_range_vertex_id += current_range_num_vertices;
-          current_range_num_vertices = 0;
-          current_range_edge_id += current_range_num_edges;
-          current_range_num_edges = 0;
-        }
-      }
-      if ( current_range_num_vertices > 0 ) {
-        vertex_ranges.push_back(VertexRange {
-                current_range_start, pos, current_range_vertex_id, current_range_num_vertices, current_range_edge_id});
-        current_range_vertex_id += current_range_num_vertices;
-        current_range_edge_id += current_range_num_edges;
-      }
-      ASSERT(current_range_vertex_id == num_vertices);
-      ASSERT(current_range_edge_id == num_edges);
+          while ( pos < end ) {
+            const HypernodeID target = read_number(mapped_file, pos, end);
+            ASSERT(line + 1 != target);
+            num_forward_edges[i] += line + 1 < target;
+            if ( has_edge_weights ) {
+              read_number(mapped_file, pos, end);
+            }
+          }
+        });
+      });
     }, [&] {
       edges.resize(num_edges);
     }, [&] {
@@ -569,42 +656,36 @@ namespace mt_kahypar::io {
       }
     });
 
-    ASSERT([&]() {
-        HyperedgeID last_end = 0;
-        for(const auto& range: vertex_ranges) {
-          if (last_end > range.start) {
-            return false;
-          }
-          last_end = range.end;
-        }
-        return true;
-      }()
-    );
+    // Exclusive prefix sum over the number of forward edges defines the edge ids
+    vec<size_t> edge_start_id(ranges.size(), 0);
+    parallel_prefix_sum(num_forward_edges.begin(), num_forward_edges.end(),
+      edge_start_id.begin(), std::plus<size_t>(), UL(0));
+    if ( edge_start_id.back() != num_edges ) {
+      throw InvalidInputException("Metis file contains " + STR(edge_start_id.back()) +
+        " edges, but its header specifies " + STR(num_edges) + " edges");
+    }
+    for ( size_t i = 0; i < ranges.size(); ++i ) {
+      edge_start_id[i] -= num_forward_edges[i];
+    }
 
     // Process all ranges in parallel, build edge vector and assign weights
-    tbb::parallel_for(UL(0), vertex_ranges.size(), [&](const size_t i) {
-      const VertexRange& range = vertex_ranges[i];
-      size_t current_pos = range.start;
-      const size_t current_end = range.end;
-      HypernodeID current_vertex_id = range.vertex_start_id;
-      const HypernodeID last_vertex_id = current_vertex_id + range.num_vertices;
-      HyperedgeID current_edge_id = range.edge_start_id;
-
-      while ( current_vertex_id < last_vertex_id ) {
-        // Skip Comments
-        ASSERT(current_pos < current_end);
-        while ( mapped_file[current_pos] == '%' ) {
-          goto_next_line(mapped_file, current_pos, current_end);
-          ASSERT(current_pos < current_end);
+    tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+      if ( !overlaps(ranges[i], 0, num_vertices) ) {
+        return;
+      }
+      HyperedgeID current_edge_id = edge_start_id[i];
+      for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+        if ( line >= num_vertices ) {
+          return;
         }
-
+        const HypernodeID current_vertex_id = line;
         if ( has_vertex_weights ) {
           ASSERT(current_vertex_id < vertices_weight.size());
-          vertices_weight[current_vertex_id] = read_number(mapped_file, current_pos, current_end);
+          vertices_weight[current_vertex_id] = read_number(mapped_file, pos, end);
         }
 
-        while ( !is_line_ending(mapped_file, current_pos) ) {
-          const HypernodeID target = read_number(mapped_file, current_pos, current_end);
+        while ( pos < end ) {
+          const HypernodeID target = read_number(mapped_file, pos, end);
           ASSERT(target > 0 && (target - 1) < num_vertices, V(target));
 
           // process forward edges, ignore backward edges
@@ -616,16 +697,15 @@ namespace mt_kahypar::io {
             edges[current_edge_id] = {current_vertex_id, target - 1};
 
             if ( has_edge_weights ) {
-              edges_weight[current_edge_id] = read_number(mapped_file, current_pos, current_end);
+              edges_weight[current_edge_id] = read_number(mapped_file, pos, end);
             }
             ++current_edge_id;
           } else if ( has_edge_weights ) {
-            read_number(mapped_file, current_pos, current_end);
+            read_number(mapped_file, pos, end);
           }
         }
-        do_line_ending(mapped_file, current_pos);
-        ++current_vertex_id;
-      }
+      });
+      ASSERT(current_edge_id == edge_start_id[i] + num_forward_edges[i]);
     });
   }
 
@@ -636,7 +716,7 @@ namespace mt_kahypar::io {
                      vec<HyperedgeWeight>& edges_weight,
                      vec<HypernodeWeight>& vertices_weight) {
     ASSERT(!filename.empty(), "No filename for metis file specified");
-    FileHandle handle = mmap_file(filename);
+    FileHandle handle = open_input_file(filename);
     size_t pos = 0;
 
     // Read Metis Header
@@ -645,40 +725,1065 @@ namespace mt_kahypar::io {
     readMetisHeader(handle.mapped_file, pos, handle.length, num_edges,
       num_vertices, has_edge_weights, has_vertex_weights);
 
+    // Split the remaining file into line ranges that are processed in parallel
+    const vec<LineRange> ranges = computeLineRanges(handle.mapped_file, pos, handle.length);
+    if ( numberOfLines(ranges) < num_vertices ) {
+      munmap_file(handle);
+      throw InvalidInputException("Metis file " + filename + " contains less lines (" +
+        STR(numberOfLines(ranges)) + ") than specified in its header (" + STR(num_vertices) + ")");
+    }
+
     // Read Vertices
-    readVertices(handle.mapped_file, pos, handle.length, num_edges, num_vertices,
-      has_edge_weights, has_vertex_weights, edges, edges_weight, vertices_weight);
+    try {
+      readVertices(handle.mapped_file, ranges, num_edges, num_vertices,
+        has_edge_weights, has_vertex_weights, edges, edges_weight, vertices_weight);
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
+
+    munmap_file(handle);
+  }
+
+  namespace edge_list {
+    // ! Edge (u, v) with u < v before the node IDs are compacted
+    using RawEdge = std::pair<uint64_t, uint64_t>;
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    void skip_whitespace(char* mapped_file, size_t& pos, const size_t end) {
+      while ( pos < end && (mapped_file[pos] == ' ' || mapped_file[pos] == '\t') ) {
+        ++pos;
+      }
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    uint64_t read_id(char* mapped_file, size_t& pos, const size_t end) {
+      skip_whitespace(mapped_file, pos, end);
+      const size_t start = pos;
+      const uint64_t id = read_number(mapped_file, pos, end);
+      if ( pos == start ) {
+        throw InvalidInputException("Missing node ID in edge list at position " + STR(pos));
+      }
+      return id;
+    }
+
+    // ! Parses the header line and the size line of a Matrix Market file.
+    // ! Only the coordinate format of square matrices is supported.
+    void readMatrixMarketHeader(char* mapped_file,
+                                size_t& pos,
+                                const size_t length,
+                                uint64_t& num_rows,
+                                size_t& num_entries) {
+      size_t line_end = pos;
+      goto_next_line(mapped_file, line_end, length);
+      std::istringstream header(std::string(mapped_file + pos, line_end - pos));
+      std::string banner, object, matrix_format;
+      header >> banner >> object >> matrix_format;
+      std::transform(object.begin(), object.end(), object.begin(), ::tolower);
+      std::transform(matrix_format.begin(), matrix_format.end(), matrix_format.begin(), ::tolower);
+      if ( banner != "%%MatrixMarket" || object != "matrix" ) {
+        throw InvalidInputException("Matrix Market file does not start with '%%MatrixMarket matrix'");
+      } else if ( matrix_format != "coordinate" ) {
+        throw InvalidInputException("Only the coordinate format of Matrix Market files is supported");
+      }
+      pos = line_end;
+
+      // Skip comments
+      while ( pos < length && mapped_file[pos] == '%' ) {
+        goto_next_line(mapped_file, pos, length);
+      }
+      num_rows = read_number(mapped_file, pos, length);
+      const uint64_t num_cols = read_number(mapped_file, pos, length);
+      num_entries = read_number(mapped_file, pos, length);
+      if ( num_rows != num_cols ) {
+        throw InvalidInputException("Matrix Market file stores a " + STR(num_rows) + " x " +
+          STR(num_cols) + " matrix, but only square matrices can be read as graphs");
+      }
+      do_line_ending(mapped_file, pos);
+    }
+
+    // ! Parses the edges of all line ranges in parallel and removes self-loops.
+    // ! For Matrix Market files, only the first num_entries lines are read.
+    vec<RawEdge> readEdges(char* mapped_file,
+                           const vec<LineRange>& ranges,
+                           const FileFormat format,
+                           const size_t num_entries,
+                           const uint64_t num_rows) {
+      const bool is_matrix_market = format == FileFormat::MatrixMarket;
+      vec<vec<RawEdge>> local_edges(ranges.size());
+      tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+        if ( is_matrix_market && !overlaps(ranges[i], 0, num_entries) ) {
+          return;
+        }
+        for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+          if ( is_matrix_market ) {
+            if ( line >= num_entries ) {
+              return;
+            }
+          } else {
+            skip_whitespace(mapped_file, pos, end);
+            if ( pos == end || mapped_file[pos] == '#' ) {
+              return;  // empty line or comment
+            }
+          }
+          // Matrix Market lines may contain a value after the coordinates, which we ignore
+          uint64_t u = read_id(mapped_file, pos, end);
+          uint64_t v = read_id(mapped_file, pos, end);
+          if ( is_matrix_market ) {
+            if ( u == 0 || v == 0 || u > num_rows || v > num_rows ) {
+              throw InvalidInputException("Entry (" + STR(u) + ", " + STR(v) +
+                ") of Matrix Market file is out of bounds");
+            }
+            --u;
+            --v;
+          }
+          if ( u != v ) {
+            local_edges[i].emplace_back(std::min(u, v), std::max(u, v));
+          }
+        });
+      });
 
-    // Check the end of the file
-    while ( handle.mapped_file[pos] == '%' ) {
-      goto_next_line(handle.mapped_file, pos, handle.length);
+      // Concatenate the edges of all ranges
+      vec<size_t> offsets(ranges.size() + 1, 0);
+      for ( size_t i = 0; i < ranges.size(); ++i ) {
+        offsets[i + 1] = offsets[i] + local_edges[i].size();
+      }
+      vec<RawEdge> edges(offsets.back());
+      tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+        std::copy(local_edges[i].begin(), local_edges[i].end(), edges.begin() + offsets[i]);
+        vec<RawEdge>().swap(local_edges[i]);
+      });
+      return edges;
     }
-    ASSERT(pos == handle.length);
 
+    // ! Returns the distinct elements of a sorted vector
+    template<typename T>
+    vec<T> removeDuplicates(const vec<T>& sorted) {
+      if ( sorted.empty() ) {
+        return vec<T>();
+      }
+      vec<size_t> is_first(sorted.size(), 0);
+      tbb::parallel_for(UL(0), sorted.size(), [&](const size_t i) {
+        is_first[i] = i == 0 || sorted[i - 1] != sorted[i];
+      });
+      vec<size_t> position(sorted.size(), 0);
+      parallel_prefix_sum(is_first.begin(), is_first.end(),
+        position.begin(), std::plus<size_t>(), UL(0));
+      vec<T> distinct(position.back());
+      tbb::parallel_for(UL(0), sorted.size(), [&](const size_t i) {
+        if ( is_first[i] ) {
+          distinct[position[i] - 1] = sorted[i];
+        }
+      });
+      return distinct;
+    }
+  } // namespace edge_list
+
+  void readEdgeListFile(const std::string& filename,
+                        const FileFormat format,
+                        HyperedgeID& num_edges,
+                        HypernodeID& num_vertices,
+                        HyperedgeVector& edges) {
+    ASSERT(!filename.empty(), "No filename for edge list file specified");
+    ASSERT(format == FileFormat::SNAP || format == FileFormat::MatrixMarket);
+    FileHandle handle = open_input_file(filename);
+    uint64_t num_rows = 0;
+    vec<edge_list::RawEdge> raw_edges;
+    try {
+      size_t pos = 0;
+      size_t num_entries = std::numeric_limits<size_t>::max();
+      if ( format == FileFormat::MatrixMarket ) {
+        edge_list::readMatrixMarketHeader(handle.mapped_file, pos, handle.length, num_rows, num_entries);
+      }
+
+      // Split the remaining file into line ranges that are processed in parallel
+      const vec<LineRange> ranges = computeLineRanges(handle.mapped_file, pos, handle.length);
+      if ( format == FileFormat::MatrixMarket && numberOfLines(ranges) < num_entries ) {
+        throw InvalidInputException("Matrix Market file " + filename + " contains less lines (" +
+          STR(numberOfLines(ranges)) + ") than specified in its header (" + STR(num_entries) + ")");
+      }
+      raw_edges = edge_list::readEdges(handle.mapped_file, ranges, format, num_entries, num_rows);
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
     munmap_file(handle);
+
+    // Remove duplicated edges (e.g., both directions of an undirected edge)
+    tbb::parallel_sort(raw_edges.begin(), raw_edges.end());
+    raw_edges = edge_list::removeDuplicates(raw_edges);
+
+    vec<uint64_t> node_ids;
+    if ( format == FileFormat::SNAP ) {
+      // The node IDs of SNAP files are not necessarily consecutive. Nodes are mapped
+      // to their rank among all IDs, which preserves the order of the (sorted) edges.
+      node_ids.resize(2 * raw_edges.size());
+      tbb::parallel_for(UL(0), raw_edges.size(), [&](const size_t i) {
+        node_ids[2 * i] = raw_edges[i].first;
+        node_ids[2 * i + 1] = raw_edges[i].second;
+      });
+      tbb::parallel_sort(node_ids.begin(), node_ids.end());
+      node_ids = edge_list::removeDuplicates(node_ids);
+      num_rows = node_ids.size();
+    }
+    if ( num_rows >= static_cast<uint64_t>(std::numeric_limits<HypernodeID>::max()) ) {
+      throw InvalidInputException("Number of nodes of " + filename + " exceeds the maximum supported number of nodes");
+    }
+
+    num_vertices = num_rows;
+    num_edges = raw_edges.size();
+    edges.resize(num_edges);
+    tbb::parallel_for(UL(0), raw_edges.size(), [&](const size_t i) {
+      HypernodeID u = raw_edges[i].first;
+      HypernodeID v = raw_edges[i].second;
+      if ( format == FileFormat::SNAP ) {
+        u = std::lower_bound(node_ids.begin(), node_ids.end(), raw_edges[i].first) - node_ids.begin();
+        v = std::lower_bound(node_ids.begin(), node_ids.end(), raw_edges[i].second) - node_ids.begin();
+      }
+      // In case of the graph partitioner, the right handed expression is considered a pair.
+      // In case of the hypergraph partitioner, the right handed expression is considered a vector.
+      edges[i] = {u, v};
+    });
   }
 
+  namespace binary {
+    // The binary snapshot consists of a fixed-size header followed by
+    // the CSR representation of the (hyper)graph. Each section starts
+    // at a position that is a multiple of 8 bytes.
+    static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'H', 'P', 'B', 'I', 'N' };
+    static constexpr uint32_t VERSION = 1;
+
+    static constexpr uint32_t IS_GRAPH = 1;
+    static constexpr uint32_t HAS_EDGE_WEIGHTS = 2;
+    static constexpr uint32_t HAS_NODE_WEIGHTS = 4;
+
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t flags;
+      uint32_t pin_width;
+      uint32_t weight_width;
+      uint64_t num_nodes;
+      uint64_t num_edges;
+      uint64_t num_pins;
+      uint64_t num_removed_single_pin_hyperedges;
+      uint64_t reserved;
+    };
+    static_assert(sizeof(Header) == 64);
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t align(const size_t pos) {
+      return (pos + 7) & ~static_cast<size_t>(7);
+    }
+
+    struct Layout {
+      size_t offsets_pos;
+      size_t pins_pos;
+      size_t edge_weights_pos;
+      size_t node_weights_pos;
+      size_t total_size;
+    };
+
+    Layout computeLayout(const Header& header) {
+      Layout layout;
+      layout.offsets_pos = sizeof(Header);
+      layout.pins_pos = layout.offsets_pos + (header.num_edges + 1) * sizeof(uint64_t);
+      layout.edge_weights_pos = align(layout.pins_pos + header.num_pins * header.pin_width);
+      layout.node_weights_pos = layout.edge_weights_pos;
+      if ( header.flags & HAS_EDGE_WEIGHTS ) {
+        layout.node_weights_pos = align(layout.node_weights_pos + header.num_edges * header.weight_width);
+      }
+      layout.total_size = layout.node_weights_pos;
+      if ( header.flags & HAS_NODE_WEIGHTS ) {
+        layout.total_size += header.num_nodes * header.weight_width;
+      }
+      return layout;
+    }
+
+    void verifyHeader(const Header& header, const size_t file_length, const std::string& filename) {
+      if ( file_length < sizeof(Header) || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ) {
+        throw InvalidInputException("Not a binary Mt-KaHyPar file: " + filename);
+      }
+      if ( header.version != VERSION ) {
+        throw InvalidInputException("Unsupported binary file format version " +
+          STR(header.version) + " (expected " + STR(VERSION) + "): " + filename);
+      }
+      if ( (header.pin_width != sizeof(uint32_t) && header.pin_width != sizeof(uint64_t)) ||
+           header.weight_width != sizeof(HyperedgeWeight) ) {
+        throw InvalidInputException("Unsupported ID or weight width in binary file: " + filename);
+      }
+      if ( header.num_nodes > std::numeric_limits<HypernodeID>::max() ||
+           header.num_edges > std::numeric_limits<HyperedgeID>::max() ) {
+        throw InvalidInputException("Binary file exceeds the ID range of this build "
+          "(use -DKAHYPAR_USE_64_BIT_IDS=On): " + filename);
+      }
+      if ( computeLayout(header).total_size != file_length ) {
+        throw InvalidInputException("Binary file is truncated or corrupted: " + filename);
+      }
+    }
+
+    template<typename PinType>
+    bool copyPins(const char* mapped_file,
+                  const Header& header,
+                  const Layout& layout,
+                  HyperedgeVector& hyperedges) {
+      const uint64_t* offsets = reinterpret_cast<const uint64_t*>(mapped_file + layout.offsets_pos);
+      const PinType* pins = reinterpret_cast<const PinType*>(mapped_file + layout.pins_pos);
+      if ( offsets[0] != 0 || offsets[header.num_edges] != header.num_pins ) {
+        return false;
+      }
+      bool valid = true;
+      tbb::parallel_for(UL(0), header.num_edges, [&](const size_t he) {
+        const uint64_t begin = offsets[he];
+        const uint64_t end = offsets[he + 1];
+        if ( begin > end || end > header.num_pins ) {
+          __atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+          return;
+        }
+        Hyperedge& hyperedge = hyperedges[he];
+        hyperedge.resize(end - begin);
+        for ( uint64_t i = begin; i < end; ++i ) {
+          if ( pins[i] >= header.num_nodes ) {
+            __atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+          }
+          hyperedge[i - begin] = pins[i];
+        }
+      });
+      return valid;
+    }
+
+    Header readHeader(const std::string& filename) {
+      Header header;
+      std::memset(&header, 0, sizeof(Header));
+      std::ifstream file(filename, std::ios::binary);
+      if ( !file ) {
+        throw InvalidInputException("Could not open: " + filename);
+      }
+      file.read(reinterpret_cast<char*>(&header), sizeof(Header));
+      verifyHeader(header, file ? file_size(filename) : 0, filename);
+      return header;
+    }
+  } // namespace binary
+
+  BinarySnapshotView viewBinarySnapshot(const char* data,
+                                        const size_t length,
+                                        const std::string& source) {
+    binary::Header header;
+    std::memset(&header, 0, sizeof(binary::Header));
+    std::memcpy(&header, data, std::min(length, sizeof(binary::Header)));
+    binary::verifyHeader(header, length, source);
+
+    const binary::Layout layout = binary::computeLayout(header);
+    BinarySnapshotView view;
+    view.is_graph = header.flags & binary::IS_GRAPH;
+    view.num_nodes = header.num_nodes;
+    view.num_edges = header.num_edges;
+    view.num_pins = header.num_pins;
+    view.num_removed_single_pin_hyperedges = header.num_removed_single_pin_hyperedges;
+    view.pin_width = header.pin_width;
+    view.offsets = reinterpret_cast<const uint64_t*>(data + layout.offsets_pos);
+    view.pins = data + layout.pins_pos;
+    view.edge_weights = header.flags & binary::HAS_EDGE_WEIGHTS ?
+      reinterpret_cast<const HyperedgeWeight*>(data + layout.edge_weights_pos) : nullptr;
+    view.node_weights = header.flags & binary::HAS_NODE_WEIGHTS ?
+      reinterpret_cast<const HypernodeWeight*>(data + layout.node_weights_pos) : nullptr;
+    return view;
+  }
+
+  void readBinarySnapshot(const char* data,
+                          const size_t length,
+                          const std::string& source,
+                          HyperedgeID& num_hyperedges,
+                          HypernodeID& num_hypernodes,
+                          HyperedgeID& num_removed_single_pin_hyperedges,
+                          HyperedgeVector& hyperedges,
+                          vec<HyperedgeWeight>& hyperedges_weight,
+                          vec<HypernodeWeight>& hypernodes_weight) {
+    binary::Header header;
+    std::memset(&header, 0, sizeof(binary::Header));
+    std::memcpy(&header, data, std::min(length, sizeof(binary::Header)));
+    binary::verifyHeader(header, length, source);
+
+    num_hyperedges = header.num_edges;
+    num_hypernodes = header.num_nodes;
+    num_removed_single_pin_hyperedges = header.num_removed_single_pin_hyperedges;
+    const binary::Layout layout = binary::computeLayout(header);
+
+    bool valid_pins = true;
+    tbb::parallel_invoke([&] {
+      hyperedges.resize(num_hyperedges);
+      valid_pins = header.pin_width == sizeof(uint32_t) ?
+        binary::copyPins<uint32_t>(data, header, layout, hyperedges) :
+        binary::copyPins<uint64_t>(data, header, layout, hyperedges);
+    }, [&] {
+      if ( header.flags & binary::HAS_EDGE_WEIGHTS ) {
+        const HyperedgeWeight* weights =
+          reinterpret_cast<const HyperedgeWeight*>(data + layout.edge_weights_pos);
+        hyperedges_weight.assign(weights, weights + num_hyperedges);
+      }
+    }, [&] {
+      if ( header.flags & binary::HAS_NODE_WEIGHTS ) {
+        const HypernodeWeight* weights =
+          reinterpret_cast<const HypernodeWeight*>(data + layout.node_weights_pos);
+        hypernodes_weight.assign(weights, weights + num_hypernodes);
+      }
+    });
+
+    if ( !valid_pins ) {
+      throw InvalidInputException("Binary file contains invalid offsets or pins: " + source);
+    }
+  }
+
+  void readBinaryFile(const std::string& filename,
+                      HyperedgeID& num_hyperedges,
+                      HypernodeID& num_hypernodes,
+                      HyperedgeID& num_removed_single_pin_hyperedges,
+                      HyperedgeVector& hyperedges,
+                      vec<HyperedgeWeight>& hyperedges_weight,
+                      vec<HypernodeWeight>& hypernodes_weight) {
+    ASSERT(!filename.empty(), "No filename for binary file specified");
+    FileHandle handle = mmap_file(filename);
+    try {
+      readBinarySnapshot(handle.mapped_file, handle.length, filename, num_hyperedges,
+        num_hypernodes, num_removed_single_pin_hyperedges, hyperedges,
+        hyperedges_weight, hypernodes_weight);
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
+    munmap_file(handle);
+  }
+
+  namespace {
+    // Union-find with path halving, the root of a cluster stores its weight
+    HypernodeID findCluster(vec<HypernodeID>& parent, HypernodeID u) {
+      while ( parent[u] != u ) {
+        parent[u] = parent[parent[u]];
+        u = parent[u];
+      }
+      return u;
+    }
+
+    template<typename PinType>
+    void coarsenBinaryPins(const std::string& filename,
+                           const char* mapped_file,
+                           const binary::Header& header,
+                           const binary::Layout& layout,
+                           const HypernodeID contraction_limit,
+                           const HypernodeWeight max_cluster_weight,
+                           const HypernodeID max_net_size,
+                           SemiExternalCoarsening& result) {
+      const uint64_t* offsets = reinterpret_cast<const uint64_t*>(mapped_file + layout.offsets_pos);
+      const PinType* pins = reinterpret_cast<const PinType*>(mapped_file + layout.pins_pos);
+      const HypernodeID num_nodes = header.num_nodes;
+      const HyperedgeID num_edges = header.num_edges;
+      if ( offsets[0] != 0 || offsets[num_edges] != header.num_pins ) {
+        throw InvalidInputException("Binary file contains invalid offsets: " + filename);
+      }
+      auto valid_range = [&](const HyperedgeID he) {
+        return offsets[he] <= offsets[he + 1] && offsets[he + 1] <= header.num_pins;
+      };
+
+      // First pass: clustering (sequential stream over the nets in file order)
+      vec<HypernodeID> parent(num_nodes, 0);
+      vec<HypernodeWeight> cluster_weight(num_nodes, 1);
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        parent[hn] = hn;
+      });
+      if ( header.flags & binary::HAS_NODE_WEIGHTS ) {
+        const HypernodeWeight* weights =
+          reinterpret_cast<const HypernodeWeight*>(mapped_file + layout.node_weights_pos);
+        cluster_weight.assign(weights, weights + num_nodes);
+      }
+      result.hypernodes_weight = cluster_weight;
+      HypernodeID num_clusters = num_nodes;
+      for ( HyperedgeID he = 0; he < num_edges && num_clusters > contraction_limit; ++he ) {
+        if ( !valid_range(he) ) {
+          throw InvalidInputException("Binary file contains invalid offsets: " + filename);
+        }
+        const uint64_t begin = offsets[he];
+        const uint64_t end = offsets[he + 1];
+        if ( end - begin < 2 || end - begin > max_net_size ) {
+          continue;
+        }
+        if ( pins[begin] >= num_nodes ) {
+          throw InvalidInputException("Binary file contains invalid pins: " + filename);
+        }
+        HypernodeID root = findCluster(parent, pins[begin]);
+        for ( uint64_t i = begin + 1; i < end && num_clusters > contraction_limit; ++i ) {
+          if ( pins[i] >= num_nodes ) {
+            throw InvalidInputException("Binary file contains invalid pins: " + filename);
+          }
+          const HypernodeID other = findCluster(parent, pins[i]);
+          if ( other != root && cluster_weight[root] + cluster_weight[other] <= max_cluster_weight ) {
+            // Attach the lighter cluster to the heavier one
+            const HypernodeID new_root = cluster_weight[root] >= cluster_weight[other] ? root : other;
+            const HypernodeID child = new_root == root ? other : root;
+            parent[child] = new_root;
+            cluster_weight[new_root] += cluster_weight[child];
+            root = new_root;
+            --num_clusters;
+          }
+        }
+      }
+
+      // Consecutive IDs for the clusters
+      result.num_fine_nodes = num_nodes;
+      result.fine_to_coarse.assign(num_nodes, kInvalidHypernode);
+      vec<HypernodeID>& fine_to_coarse = result.fine_to_coarse;
+      HypernodeID num_coarse_nodes = 0;
+      for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+        const HypernodeID root = findCluster(parent, hn);
+        if ( fine_to_coarse[root] == kInvalidHypernode ) {
+          fine_to_coarse[root] = num_coarse_nodes++;
+        }
+        fine_to_coarse[hn] = fine_to_coarse[root];
+      }
+      ASSERT(num_coarse_nodes == num_clusters);
+      result.num_coarse_nodes = num_coarse_nodes;
+      vec<HypernodeWeight> coarse_weights(num_coarse_nodes, 0);
+      for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+        coarse_weights[fine_to_coarse[hn]] += result.hypernodes_weight[hn];
+      }
+      result.hypernodes_weight = std::move(coarse_weights);
+      parallel::free(parent);
+      parallel::free(cluster_weight);
+
+      // Second pass: contraction. The first pass determines the size of the
+      // contracted nets, such that we only materialize nets with more than one pin.
+      auto contract = [&](const HyperedgeID he, Hyperedge& contracted) {
+        contracted.clear();
+        for ( uint64_t i = offsets[he]; i < offsets[he + 1]; ++i ) {
+          contracted.push_back(fine_to_coarse[pins[i]]);
+        }
+        std::sort(contracted.begin(), contracted.end());
+        contracted.erase(std::unique(contracted.begin(), contracted.end()), contracted.end());
+      };
+      bool valid = true;
+      vec<HyperedgeID> coarse_edge_id(num_edges + 1, 0);
+      tbb::enumerable_thread_specific<Hyperedge> local_hyperedge;
+      tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+        if ( !valid_range(he) ) {
+          __atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+          return;
+        }
+        for ( uint64_t i = offsets[he]; i < offsets[he + 1]; ++i ) {
+          if ( pins[i] >= num_nodes ) {
+            __atomic_store_n(&valid, false, __ATOMIC_RELAXED);
+            return;
+          }
+        }
+        Hyperedge& contracted = local_hyperedge.local();
+        contract(he, contracted);
+        coarse_edge_id[he + 1] = contracted.size() > 1;
+      });
+      if ( !valid ) {
+        throw InvalidInputException("Binary file contains invalid offsets or pins: " + filename);
+      }
+      for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+        coarse_edge_id[he + 1] += coarse_edge_id[he];
+      }
+
+      const HyperedgeID num_coarse_edges = coarse_edge_id[num_edges];
+      const HyperedgeWeight* edge_weights = header.flags & binary::HAS_EDGE_WEIGHTS ?
+        reinterpret_cast<const HyperedgeWeight*>(mapped_file + layout.edge_weights_pos) : nullptr;
+      result.hyperedges.resize(num_coarse_edges);
+      result.hyperedges_weight.assign(num_coarse_edges, 1);
+      tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+        if ( coarse_edge_id[he + 1] != coarse_edge_id[he] ) {
+          const HyperedgeID coarse_he = coarse_edge_id[he];
+          contract(he, result.hyperedges[coarse_he]);
+          if ( edge_weights ) {
+            result.hyperedges_weight[coarse_he] = edge_weights[he];
+          }
+        }
+      });
+    }
+  } // namespace
+
+  SemiExternalCoarsening coarsenBinaryFile(const std::string& filename,
+                                           const HypernodeID contraction_limit,
+                                           const HypernodeWeight max_cluster_weight,
+                                           const HypernodeID max_net_size) {
+    FileHandle handle = mmap_file(filename);
+    binary::Header header;
+    std::memset(&header, 0, sizeof(binary::Header));
+    std::memcpy(&header, handle.mapped_file, std::min(handle.length, sizeof(binary::Header)));
+    SemiExternalCoarsening result;
+    try {
+      binary::verifyHeader(header, handle.length, filename);
+      const binary::Layout layout = binary::computeLayout(header);
+      #ifndef _WIN32
+      if ( !handle.in_memory ) {
+        // The pins are streamed in file order
+        madvise(handle.mapped_file, handle.length, MADV_SEQUENTIAL);
+      }
+      #endif
+      if ( header.pin_width == sizeof(uint32_t) ) {
+        coarsenBinaryPins<uint32_t>(filename, handle.mapped_file, header, layout,
+          contraction_limit, max_cluster_weight, max_net_size, result);
+      } else {
+        coarsenBinaryPins<uint64_t>(filename, handle.mapped_file, header, layout,
+          contraction_limit, max_cluster_weight, max_net_size, result);
+      }
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
+    munmap_file(handle);
+    return result;
+  }
+
+  namespace {
+    binary::Header createBinaryHeader(const HypernodeID num_hypernodes,
+                                      const HyperedgeVector& hyperedges,
+                                      const vec<HyperedgeWeight>& hyperedges_weight,
+                                      const vec<HypernodeWeight>& hypernodes_weight,
+                                      const bool is_graph,
+                                      const HyperedgeID num_removed_single_pin_hyperedges) {
+      binary::Header header;
+      std::memset(&header, 0, sizeof(binary::Header));
+      std::memcpy(header.magic, binary::MAGIC, sizeof(binary::MAGIC));
+      header.version = binary::VERSION;
+      header.flags = (is_graph ? binary::IS_GRAPH : 0) |
+                     (hyperedges_weight.empty() ? 0 : binary::HAS_EDGE_WEIGHTS) |
+                     (hypernodes_weight.empty() ? 0 : binary::HAS_NODE_WEIGHTS);
+      header.pin_width = sizeof(HypernodeID);
+      header.weight_width = sizeof(HyperedgeWeight);
+      header.num_nodes = num_hypernodes;
+      header.num_edges = hyperedges.size();
+      header.num_removed_single_pin_hyperedges = num_removed_single_pin_hyperedges;
+      header.num_pins = 0;
+      for ( const Hyperedge& hyperedge : hyperedges ) {
+        header.num_pins += hyperedge.size();
+      }
+      ASSERT(hyperedges_weight.empty() || hyperedges_weight.size() == hyperedges.size());
+      ASSERT(hypernodes_weight.empty() || hypernodes_weight.size() == num_hypernodes);
+      return header;
+    }
+
+    // Writes the sections of the binary snapshot in order by calling write(data, size)
+    template<typename Write>
+    void serializeBinarySnapshot(const binary::Header& header,
+                                 const HyperedgeVector& hyperedges,
+                                 const vec<HyperedgeWeight>& hyperedges_weight,
+                                 const vec<HypernodeWeight>& hypernodes_weight,
+                                 const Write& write) {
+      const binary::Layout layout = binary::computeLayout(header);
+      size_t pos = 0;
+      auto write_and_advance = [&](const void* data, const size_t size) {
+        write(reinterpret_cast<const char*>(data), size);
+        pos += size;
+      };
+      auto pad_to = [&](const size_t target) {
+        const char zeros[8] = { 0 };
+        ASSERT(target >= pos && target - pos < 8);
+        write_and_advance(zeros, target - pos);
+      };
+
+      vec<uint64_t> offsets(hyperedges.size() + 1, 0);
+      for ( size_t he = 0; he < hyperedges.size(); ++he ) {
+        offsets[he + 1] = offsets[he] + hyperedges[he].size();
+      }
+      write_and_advance(&header, sizeof(binary::Header));
+      write_and_advance(offsets.data(), offsets.size() * sizeof(uint64_t));
+      for ( const Hyperedge& hyperedge : hyperedges ) {
+        write_and_advance(hyperedge.data(), hyperedge.size() * sizeof(HypernodeID));
+      }
+      pad_to(layout.edge_weights_pos);
+      if ( !hyperedges_weight.empty() ) {
+        write_and_advance(hyperedges_weight.data(), hyperedges_weight.size() * sizeof(HyperedgeWeight));
+        pad_to(layout.node_weights_pos);
+      }
+      if ( !hypernodes_weight.empty() ) {
+        write_and_advance(hypernodes_weight.data(), hypernodes_weight.size() * sizeof(HypernodeWeight));
+      }
+      ASSERT(pos == layout.total_size);
+    }
+  } // namespace
+
+  void writeBinaryFile(const std::string& filename,
+                       const HypernodeID num_hypernodes,
+                       const HyperedgeVector& hyperedges,
+                       const vec<HyperedgeWeight>& hyperedges_weight,
+                       const vec<HypernodeWeight>& hypernodes_weight,
+                       const bool is_graph,
+                       const HyperedgeID num_removed_single_pin_hyperedges) {
+    if ( filename.empty() ) {
+      throw InvalidInputException("No filename for binary output file specified");
+    }
+
+    const binary::Header header = createBinaryHeader(num_hypernodes, hyperedges,
+      hyperedges_weight, hypernodes_weight, is_graph, num_removed_single_pin_hyperedges);
+    std::ofstream out(filename, std::ios::binary);
+    if ( !out ) {
+      throw InvalidInputException("Could not open output file: " + filename);
+    }
+    serializeBinarySnapshot(header, hyperedges, hyperedges_weight, hypernodes_weight,
+      [&](const char* data, const size_t size) { out.write(data, size); });
+    out.close();
+    if ( !out ) {
+      throw SystemException("Error while writing binary file: " + filename);
+    }
+  }
+
+  size_t binarySnapshotSize(const HypernodeID num_hypernodes,
+                            const HyperedgeVector& hyperedges,
+                            const vec<HyperedgeWeight>& hyperedges_weight,
+                            const vec<HypernodeWeight>& hypernodes_weight) {
+    return binary::computeLayout(createBinaryHeader(num_hypernodes, hyperedges,
+      hyperedges_weight, hypernodes_weight, false, 0)).total_size;
+  }
+
+  void writeBinarySnapshot(char* buffer,
+                           const HypernodeID num_hypernodes,
+                           const HyperedgeVector& hyperedges,
+                           const vec<HyperedgeWeight>& hyperedges_weight,
+                           const vec<HypernodeWeight>& hypernodes_weight,
+                           const bool is_graph,
+                           const HyperedgeID num_removed_single_pin_hyperedges) {
+    const binary::Header header = createBinaryHeader(num_hypernodes, hyperedges,
+      hyperedges_weight, hypernodes_weight, is_graph, num_removed_single_pin_hyperedges);
+    serializeBinarySnapshot(header, hyperedges, hyperedges_weight, hypernodes_weight,
+      [&](const char* data, const size_t size) {
+        std::memcpy(buffer, data, size);
+        buffer += size;
+      });
+  }
+
+  bool isBinaryGraphFile(const std::string& filename) {
+    return binary::readHeader(filename).flags & binary::IS_GRAPH;
+  }
+
+  namespace {
+  void readHypergraphStatistics(char* mapped_file,
+                                const vec<LineRange>& ranges,
+                                const mt_kahypar::Type type,
+                                InputStatistics& stats) {
+    const bool has_hyperedge_weights = type == mt_kahypar::Type::EdgeWeights ||
+                                       type == mt_kahypar::Type::EdgeAndNodeWeights;
+    const bool has_hypernode_weights = type == mt_kahypar::Type::NodeWeights ||
+                                       type == mt_kahypar::Type::EdgeAndNodeWeights;
+    const size_t num_edges = stats.num_edges;
+    const size_t num_nodes = stats.num_nodes;
+    tbb::parallel_invoke([&] {
+      stats.edge_sizes.assign(num_edges, 0);
+    }, [&] {
+      stats.edge_weights.assign(num_edges, 1);
+    }, [&] {
+      stats.node_degrees.assign(num_nodes, 0);
+    }, [&] {
+      stats.node_weights.assign(num_nodes, 1);
+    });
+
+    tbb::enumerable_thread_specific<size_t> num_pins(0);
+    tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+      for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+        if ( line < num_edges ) {
+          if ( has_hyperedge_weights ) {
+            stats.edge_weights[line] = read_number(mapped_file, pos, end);
+          }
+          HypernodeID edge_size = 0;
+          while ( pos < end ) {
+            const HypernodeID pin = read_number(mapped_file, pos, end);
+            if ( pin == 0 || pin > num_nodes ) {
+              throw InvalidInputException("Hyperedge " + STR(line) + " contains invalid pin " + STR(pin));
+            }
+            __atomic_fetch_add(&stats.node_degrees[pin - 1], 1, __ATOMIC_RELAXED);
+            ++edge_size;
+          }
+          stats.edge_sizes[line] = edge_size;
+          num_pins.local() += edge_size;
+        } else if ( has_hypernode_weights && line < num_edges + num_nodes ) {
+          stats.node_weights[line - num_edges] = read_number(mapped_file, pos, end);
+        }
+      });
+    });
+    stats.num_pins = num_pins.combine(std::plus<size_t>());
+  }
+
+  void readGraphStatistics(char* mapped_file,
+                           const vec<LineRange>& ranges,
+                           const bool has_edge_weights,
+                           const bool has_vertex_weights,
+                           InputStatistics& stats) {
+    const size_t num_vertices = stats.num_nodes;
+    tbb::parallel_invoke([&] {
+      stats.node_degrees.assign(num_vertices, 0);
+    }, [&] {
+      stats.node_weights.assign(num_vertices, 1);
+    });
+
+    // The edge weights are only collected for forward edges, but in arbitrary order
+    tbb::enumerable_thread_specific<vec<HyperedgeWeight>> local_edge_weights;
+    tbb::enumerable_thread_specific<size_t> num_forward_edges(0);
+    tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+      if ( !overlaps(ranges[i], 0, num_vertices) ) {
+        return;
+      }
+      for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t end) {
+        if ( line >= num_vertices ) {
+          return;
+        }
+        if ( has_vertex_weights ) {
+          stats.node_weights[line] = read_number(mapped_file, pos, end);
+        }
+        HyperedgeID degree = 0;
+        while ( pos < end ) {
+          const HypernodeID target = read_number(mapped_file, pos, end);
+          const HyperedgeWeight weight = has_edge_weights ? read_number(mapped_file, pos, end) : 1;
+          if ( line + 1 < target ) {
+            local_edge_weights.local().push_back(weight);
+            ++num_forward_edges.local();
+          }
+          ++degree;
+        }
+        stats.node_degrees[line] = degree;
+      });
+    });
+
+    if ( num_forward_edges.combine(std::plus<size_t>()) != stats.num_edges ) {
+      throw InvalidInputException("Metis file contains " + STR(num_forward_edges.combine(std::plus<size_t>())) +
+        " edges, but its header specifies " + STR(stats.num_edges) + " edges");
+    }
+    stats.num_pins = 2 * stats.num_edges;
+    stats.edge_sizes.assign(stats.num_edges, 2);
+    stats.edge_weights.clear();
+    stats.edge_weights.reserve(stats.num_edges);
+    for ( const vec<HyperedgeWeight>& weights : local_edge_weights ) {
+      stats.edge_weights.insert(stats.edge_weights.end(), weights.begin(), weights.end());
+    }
+  }
+  } // namespace
+
+  InputStatistics readInputStatistics(const std::string& filename, const FileFormat format) {
+    if ( format != FileFormat::hMetis && format != FileFormat::Metis ) {
+      throw InvalidInputException("Statistics can only be computed for hMetis and Metis files: " + filename);
+    }
+    InputStatistics stats;
+    FileHandle handle = open_input_file(filename);
+    size_t pos = 0;
+    try {
+      if ( format == FileFormat::hMetis ) {
+        mt_kahypar::Type type = mt_kahypar::Type::Unweighted;
+        readHGRHeader(handle.mapped_file, pos, handle.length, stats.num_edges, stats.num_nodes, type);
+        const vec<LineRange> ranges = computeLineRanges(handle.mapped_file, pos, handle.length);
+        if ( numberOfLines(ranges) < stats.num_edges ) {
+          throw InvalidInputException("Hypergraph file " + filename + " contains less lines (" +
+            STR(numberOfLines(ranges)) + ") than specified in its header (" + STR(stats.num_edges) + ")");
+        }
+        readHypergraphStatistics(handle.mapped_file, ranges, type, stats);
+      } else {
+        bool has_edge_weights = false;
+        bool has_vertex_weights = false;
+        readMetisHeader(handle.mapped_file, pos, handle.length, stats.num_edges,
+          stats.num_nodes, has_edge_weights, has_vertex_weights);
+        const vec<LineRange> ranges = computeLineRanges(handle.mapped_file, pos, handle.length);
+        if ( numberOfLines(ranges) < stats.num_nodes ) {
+          throw InvalidInputException("Metis file " + filename + " contains less lines (" +
+            STR(numberOfLines(ranges)) + ") than specified in its header (" + STR(stats.num_nodes) + ")");
+        }
+        stats.is_graph = true;
+        readGraphStatistics(handle.mapped_file, ranges, has_edge_weights, has_vertex_weights, stats);
+      }
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
+    munmap_file(handle);
+    return stats;
+  }
+
+  namespace partition_file {
+    // The binary partition file consists of a header followed by
+    // the block ID of each node stored as 32-bit integer.
+    static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'H', 'P', 'P', 'R', 'T' };
+    static constexpr uint32_t VERSION = 1;
+
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t id_width;
+      uint64_t num_nodes;
+    };
+    static_assert(sizeof(Header) == 24);
+    static_assert(sizeof(PartitionID) == sizeof(int32_t));
+
+    // Number of nodes formatted by a single task
+    static constexpr size_t NODES_PER_CHUNK = UL(1) << 16;
+    // Maximum number of characters of a line ("-2147483648\n")
+    static constexpr size_t MAX_LINE_LENGTH = 12;
+
+    bool isBinary(const char* mapped_file, const size_t length) {
+      return length >= sizeof(Header) && std::memcmp(mapped_file, MAGIC, sizeof(MAGIC)) == 0;
+    }
+
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    int64_t read_block_id(char* mapped_file, size_t& pos, const size_t length) {
+      while ( pos < length && mapped_file[pos] == ' ' ) {
+        ++pos;
+      }
+      const bool negative = pos < length && mapped_file[pos] == '-';
+      if ( negative ) {
+        ++pos;
+      }
+      const int64_t number = read_number(mapped_file, pos, length);
+      return negative ? -number : number;
+    }
+
+    void readBinary(const char* mapped_file,
+                    const size_t length,
+                    const HypernodeID num_nodes,
+                    PartitionID* partition,
+                    const std::string& filename) {
+      Header header;
+      std::memcpy(&header, mapped_file, sizeof(Header));
+      if ( header.version != VERSION || header.id_width != sizeof(PartitionID) ) {
+        throw InvalidInputException("Unsupported binary partition file: " + filename);
+      }
+      if ( header.num_nodes != num_nodes ) {
+        throw InvalidInputException("Partition file contains " + STR(header.num_nodes) +
+          " entries, but the number of nodes is " + STR(num_nodes) + ": " + filename);
+      }
+      if ( length != sizeof(Header) + header.num_nodes * sizeof(PartitionID) ) {
+        throw InvalidInputException("Binary partition file is truncated or corrupted: " + filename);
+      }
+      const char* data = mapped_file + sizeof(Header);
+      tbb::parallel_for(tbb::blocked_range<size_t>(UL(0), num_nodes, NODES_PER_CHUNK),
+        [&](const tbb::blocked_range<size_t>& r) {
+        std::memcpy(partition + r.begin(), data + r.begin() * sizeof(PartitionID),
+          (r.end() - r.begin()) * sizeof(PartitionID));
+      });
+    }
+
+    void readText(char* mapped_file,
+                  const size_t length,
+                  const HypernodeID num_nodes,
+                  PartitionID* partition,
+                  const std::string& filename) {
+      const vec<LineRange> ranges = computeLineRanges(mapped_file, 0, length);
+      tbb::parallel_for(UL(0), ranges.size(), [&](const size_t i) {
+        for_each_line(mapped_file, ranges[i], [&](const size_t line, size_t pos, const size_t line_end) {
+          if ( line >= num_nodes ) {
+            // Trailing empty lines are allowed
+            while ( pos < line_end && mapped_file[pos] == ' ' ) {
+              ++pos;
+            }
+            if ( pos != line_end ) {
+              throw InvalidInputException("Input file has more entries than the number of nodes: " + filename);
+            }
+            return;
+          }
+          if ( pos == line_end ) {
+            throw InvalidInputException("Input file contains an empty line " +
+              STR(line) + ": " + filename);
+          }
+          partition[line] = read_block_id(mapped_file, pos, line_end);
+          if ( pos != line_end ) {
+            throw InvalidInputException("Input file contains more than one entry in line " +
+              STR(line) + ": " + filename);
+          }
+        });
+      });
+      if ( numberOfLines(ranges) < num_nodes ) {
+        throw InvalidInputException("Input file has less entries than the number of nodes: " + filename);
+      }
+    }
+
+    // ! Formats the block IDs in chunks of consecutive nodes in parallel
+    vec<vec<char>> formatText(const PartitionID* partition, const HypernodeID num_nodes) {
+      const size_t num_chunks = (num_nodes + NODES_PER_CHUNK - 1) / NODES_PER_CHUNK;
+      vec<vec<char>> chunks(num_chunks);
+      tbb::parallel_for(UL(0), num_chunks, [&](const size_t i) {
+        const size_t first = i * NODES_PER_CHUNK;
+        const size_t last = std::min(first + NODES_PER_CHUNK, static_cast<size_t>(num_nodes));
+        vec<char>& buffer = chunks[i];
+        buffer.resize((last - first) * MAX_LINE_LENGTH);
+        char* out = buffer.data();
+        for ( size_t hn = first; hn < last; ++hn ) {
+          out = std::to_chars(out, buffer.data() + buffer.size(), partition[hn]).ptr;
+          *out++ = '\n';
+        }
+        buffer.resize(out - buffer.data());
+      });
+      return chunks;
+    }
+
+    // ! Writes all buffers consecutively to the file. On POSIX systems,
+    // ! each buffer is written in parallel to its offset within the file.
+    void writeBuffers(const std::string& filename, const vec<std::pair<const char*, size_t>>& buffers) {
+      #ifdef _WIN32
+      std::ofstream out(filename, std::ios::binary);
+      if ( !out ) {
+        throw InvalidInputException("Could not open output file: " + filename);
+      }
+      for ( const auto& buffer : buffers ) {
+        out.write(buffer.first, buffer.second);
+      }
+      out.close();
+      if ( !out ) {
+        throw SystemException("Error while writing partition file: " + filename);
+      }
+      #else
+      vec<size_t> offsets(buffers.size() + 1, 0);
+      for ( size_t i = 0; i < buffers.size(); ++i ) {
+        offsets[i + 1] = offsets[i] + buffers[i].second;
+      }
+      const int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if ( fd < 0 ) {
+        throw InvalidInputException("Could not open output file: " + filename);
+      }
+      bool success = ftruncate(fd, offsets.back()) == 0;
+      tbb::parallel_for(UL(0), buffers.size(), [&](const size_t i) {
+        const char* data = buffers[i].first;
+        size_t remaining = buffers[i].second;
+        off_t offset = offsets[i];
+        while ( remaining > 0 ) {
+          const ssize_t written = pwrite(fd, data, remaining, offset);
+          if ( written <= 0 ) {
+            __atomic_store_n(&success, false, __ATOMIC_RELAXED);
+            return;
+          }
+          data += written;
+          offset += written;
+          remaining -= written;
+        }
+      });
+      success &= close(fd) == 0;
+      if ( !success ) {
+        throw SystemException("Error while writing partition file: " + filename);
+      }
+      #endif
+    }
+  } // namespace partition_file
+
   template<typename InitFunc>
   void readPartitionFileImpl(const std::string& filename, HypernodeID num_nodes, InitFunc init_func) {
     ASSERT(!filename.empty(), "No filename for partition file specified");
-    std::ifstream file(filename);
-    if (file) {
-      PartitionID* partition = init_func();
-      int part;
-      HypernodeID hn = 0;
-      while (file >> part) {
-        if (hn >= num_nodes) {
-          throw InvalidInputException(std::string("Input file has more entries than the number of nodes: ") + filename);
-        }
-        partition[hn++] = part;
-      }
-      file.close();
-      if (hn < num_nodes) {
+    struct stat stat_buf;
+    if ( stat(filename.c_str(), &stat_buf) < 0 ) {
+      throw InvalidInputException(std::string("File not found: ") + filename);
+    }
+    PartitionID* partition = init_func();
+    if ( stat_buf.st_size == 0 ) {
+      // an empty file can not be mapped to memory
+      if ( num_nodes > 0 ) {
         throw InvalidInputException(std::string("Input file has less entries than the number of nodes: ") + filename);
       }
-    } else {
-      throw InvalidInputException(std::string("File not found: ") + filename);
+      return;
     }
+
+    FileHandle handle = open_input_file(filename);
+    try {
+      if ( partition_file::isBinary(handle.mapped_file, handle.length) ) {
+        partition_file::readBinary(handle.mapped_file, handle.length, num_nodes, partition, filename);
+      } else {
+        partition_file::readText(handle.mapped_file, handle.length, num_nodes, partition, filename);
+      }
+    } catch ( ... ) {
+      munmap_file(handle);
+      throw;
+    }
+    munmap_file(handle);
   }
 
   void readPartitionFile(const std::string& filename, HypernodeID num_nodes, std::vector<PartitionID>& partition) {
@@ -693,26 +1798,49 @@ namespace mt_kahypar::io {
     readPartitionFileImpl(filename, num_nodes, [=]{ return partition; });
   }
 
-  template<typename PartitionedHypergraph>
-  void writePartitionFile(const PartitionedHypergraph& phg, const std::string& filename) {
+  void writePartitionFile(const PartitionID* partition,
+                          const HypernodeID num_nodes,
+                          const std::string& filename,
+                          const bool binary) {
     if (filename.empty()) {
       throw InvalidInputException("No filename for output partition file specified");
+    }
+
+    if ( binary ) {
+      partition_file::Header header;
+      std::memset(&header, 0, sizeof(partition_file::Header));
+      std::memcpy(header.magic, partition_file::MAGIC, sizeof(partition_file::MAGIC));
+      header.version = partition_file::VERSION;
+      header.id_width = sizeof(PartitionID);
+      header.num_nodes = num_nodes;
+      partition_file::writeBuffers(filename, {
+        { reinterpret_cast<const char*>(&header), sizeof(partition_file::Header) },
+        { reinterpret_cast<const char*>(partition), num_nodes * sizeof(PartitionID) } });
     } else {
-      std::ofstream out_stream(filename.c_str());
-      std::vector<PartitionID> partition(phg.initialNumNodes(), -1);
-      for (const HypernodeID& hn : phg.nodes()) {
-        ASSERT(hn < partition.size());
-        partition[hn] = phg.partID(hn);
-      }
-      for (const PartitionID& part : partition) {
-        out_stream << part << std::endl;
+      const vec<vec<char>> chunks = partition_file::formatText(partition, num_nodes);
+      vec<std::pair<const char*, size_t>> buffers(chunks.size());
+      for ( size_t i = 0; i < chunks.size(); ++i ) {
+        buffers[i] = { chunks[i].data(), chunks[i].size() };
       }
-      out_stream.close();
+      partition_file::writeBuffers(filename, buffers);
+    }
+  }
+
+  template<typename PartitionedHypergraph>
+  void writePartitionFile(const PartitionedHypergraph& phg, const std::string& filename, const bool binary) {
+    if (filename.empty()) {
+      throw InvalidInputException("No filename for output partition file specified");
     }
+    vec<PartitionID> partition(phg.initialNumNodes(), -1);
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      ASSERT(hn < partition.size());
+      partition[hn] = phg.partID(hn);
+    });
+    writePartitionFile(partition.data(), phg.initialNumNodes(), filename, binary);
   }
 
   namespace {
-  #define WRITE_PARTITION_FILE(X) void writePartitionFile(const X& phg, const std::string& filename)
+  #define WRITE_PARTITION_FILE(X) void writePartitionFile(const X& phg, const std::string& filename, const bool binary)
   }
 
   INSTANTIATE_FUNC_WITH_PARTITIONED_HG(WRITE_PARTITION_FILE)
@@ -31,6 +31,7 @@
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/partition/context_enum_classes.h"
 
 namespace mt_kahypar {
 namespace io {
@@ -53,11 +54,145 @@ namespace io {
                      vec<HyperedgeWeight>& hyperedges_weight,
                      vec<HypernodeWeight>& hypernodes_weight);
 
+  // ! Reads a graph stored as a SNAP edge list or as a Matrix Market file in coordinate format.
+  // ! The memory-mapped file is parsed in parallel. Self-loops, duplicated edges and edge
+  // ! directions are removed, and the (values of) weights are ignored. The node IDs of SNAP
+  // ! files are compacted to [0, n), where n is the number of nodes with at least one edge.
+  void readEdgeListFile(const std::string& filename,
+                        const FileFormat format,
+                        HyperedgeID& num_edges,
+                        HypernodeID& num_vertices,
+                        HyperedgeVector& edges);
+
+  // ! Reads a (hyper)graph stored in the binary snapshot format (see docs/FileFormats.md).
+  // ! The file is memory-mapped and the pins are copied in parallel without any parsing.
+  void readBinaryFile(const std::string& filename,
+                      HyperedgeID& num_hyperedges,
+                      HypernodeID& num_hypernodes,
+                      HyperedgeID& num_removed_single_pin_hyperedges,
+                      HyperedgeVector& hyperedges,
+                      vec<HyperedgeWeight>& hyperedges_weight,
+                      vec<HypernodeWeight>& hypernodes_weight);
+
+  // ! Reads a (hyper)graph stored in the binary snapshot format from a buffer in memory
+  // ! (e.g., a shared memory segment). The source is only used for error messages.
+  void readBinarySnapshot(const char* data,
+                          const size_t length,
+                          const std::string& source,
+                          HyperedgeID& num_hyperedges,
+                          HypernodeID& num_hypernodes,
+                          HyperedgeID& num_removed_single_pin_hyperedges,
+                          HyperedgeVector& hyperedges,
+                          vec<HyperedgeWeight>& hyperedges_weight,
+                          vec<HypernodeWeight>& hypernodes_weight);
+
+  // ! Sections of a binary snapshot stored in a buffer in memory
+  struct BinarySnapshotView {
+    bool is_graph = false;
+    HypernodeID num_nodes = 0;
+    HyperedgeID num_edges = 0;
+    size_t num_pins = 0;
+    HyperedgeID num_removed_single_pin_hyperedges = 0;
+    // ! Size of a pin in bytes (4 or 8)
+    uint32_t pin_width = 0;
+    // ! The pins of edge e are stored at the positions [offsets[e], offsets[e + 1])
+    const uint64_t* offsets = nullptr;
+    const char* pins = nullptr;
+    // ! nullptr, if the snapshot does not store edge weights
+    const HyperedgeWeight* edge_weights = nullptr;
+    // ! nullptr, if the snapshot does not store node weights
+    const HypernodeWeight* node_weights = nullptr;
+  };
+
+  // ! Verifies the header of the binary snapshot stored in the buffer and returns
+  // ! pointers to its sections (nothing is copied)
+  BinarySnapshotView viewBinarySnapshot(const char* data,
+                                        const size_t length,
+                                        const std::string& source);
+
+  // ! Coarse hypergraph computed by coarsenBinaryFile(...)
+  struct SemiExternalCoarsening {
+    HypernodeID num_fine_nodes = 0;
+    HypernodeID num_coarse_nodes = 0;
+    // ! Maps each node of the input to its coarse node
+    vec<HypernodeID> fine_to_coarse;
+    HyperedgeVector hyperedges;
+    vec<HyperedgeWeight> hyperedges_weight;
+    vec<HypernodeWeight> hypernodes_weight;
+  };
+
+  // ! Computes a clustering and contracts a hypergraph stored in the binary snapshot format
+  // ! without loading its pins into memory. The memory-mapped file is streamed twice: the first
+  // ! pass clusters the pins of nets with at most max_net_size pins (cluster weights are bounded
+  // ! by max_cluster_weight) until at most contraction_limit clusters remain, and the second pass
+  // ! writes the contracted nets. Single-pin nets are removed from the coarse hypergraph.
+  // ! The memory consumption is linear in the number of nodes and edges plus the size of the
+  // ! coarse hypergraph, which allows to partition inputs whose pins do not fit into memory.
+  SemiExternalCoarsening coarsenBinaryFile(const std::string& filename,
+                                           const HypernodeID contraction_limit,
+                                           const HypernodeWeight max_cluster_weight,
+                                           const HypernodeID max_net_size);
+
+  // ! Writes a (hyper)graph in the binary snapshot format. Graphs are expected to contain
+  // ! each undirected edge exactly once (as returned by readGraphFile(...)).
+  void writeBinaryFile(const std::string& filename,
+                       const HypernodeID num_hypernodes,
+                       const HyperedgeVector& hyperedges,
+                       const vec<HyperedgeWeight>& hyperedges_weight,
+                       const vec<HypernodeWeight>& hypernodes_weight,
+                       const bool is_graph,
+                       const HyperedgeID num_removed_single_pin_hyperedges = 0);
+
+  // ! Size in bytes of the binary snapshot of the given (hyper)graph
+  size_t binarySnapshotSize(const HypernodeID num_hypernodes,
+                            const HyperedgeVector& hyperedges,
+                            const vec<HyperedgeWeight>& hyperedges_weight,
+                            const vec<HypernodeWeight>& hypernodes_weight);
+
+  // ! Writes the binary snapshot of the given (hyper)graph into a buffer
+  // ! of size binarySnapshotSize(...)
+  void writeBinarySnapshot(char* buffer,
+                           const HypernodeID num_hypernodes,
+                           const HyperedgeVector& hyperedges,
+                           const vec<HyperedgeWeight>& hyperedges_weight,
+                           const vec<HypernodeWeight>& hypernodes_weight,
+                           const bool is_graph,
+                           const HyperedgeID num_removed_single_pin_hyperedges = 0);
+
+  // ! Returns whether the binary snapshot stores a graph (true) or a hypergraph (false)
+  bool isBinaryGraphFile(const std::string& filename);
+
+  // ! Sizes, degrees and weights of an input file (in no particular order for edges of graphs)
+  struct InputStatistics {
+    HypernodeID num_nodes = 0;
+    HyperedgeID num_edges = 0;
+    size_t num_pins = 0;
+    bool is_graph = false;
+    vec<HypernodeID> edge_sizes;
+    vec<HyperedgeWeight> edge_weights;
+    vec<HyperedgeID> node_degrees;
+    vec<HypernodeWeight> node_weights;
+  };
+
+  // ! Computes the statistics of an hMetis or Metis file in a single parallel pass over the
+  // ! memory-mapped file. In contrast to readHypergraphFile(...) and readGraphFile(...), the pins
+  // ! are not stored, which means that the memory consumption is linear in the number of nodes and edges.
+  InputStatistics readInputStatistics(const std::string& filename, const FileFormat format);
+
+  // ! Reads a partition file in text format (one block ID per line) or binary format.
+  // ! The format is detected automatically and both are parsed in parallel.
   void readPartitionFile(const std::string& filename, HypernodeID num_nodes, std::vector<PartitionID>& partition);
   void readPartitionFile(const std::string& filename, HypernodeID num_nodes, PartitionID* partition);
 
+  // ! Writes the block IDs in text format (one block ID per line) or binary format (see docs/FileFormats.md).
+  // ! The text is formatted into chunks in parallel, which are then written with positional writes.
+  void writePartitionFile(const PartitionID* partition,
+                          const HypernodeID num_nodes,
+                          const std::string& filename,
+                          const bool binary = false);
+
   template<typename PartitionedHypergraph>
-  void writePartitionFile(const PartitionedHypergraph& phg, const std::string& filename);
+  void writePartitionFile(const PartitionedHypergraph& phg, const std::string& filename, const bool binary = false);
 
 }  // namespace io
 }  // namespace mt_kahypar
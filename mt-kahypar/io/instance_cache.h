@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <sstream>
+#include <string>
+
+#include <sys/stat.h>
+
+#include "include/mtkahypartypes.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/conversion.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar::io {
+
+/*!
+ * Keeps the most recently used input (hyper)graphs of the server mode in memory.
+ * An instance is identified by its filename and the options that determine the
+ * data structure constructed from the file. The modification time and size of
+ * the file invalidate the entry if the file was changed.
+ */
+class InstanceCache {
+
+  struct CachedInstance {
+    std::string key;
+    mt_kahypar_hypergraph_t hypergraph;
+  };
+
+ public:
+  explicit InstanceCache(const size_t max_cached_instances) :
+    _max_cached_instances(std::max(max_cached_instances, UL(1))),
+    _cache() { }
+
+  InstanceCache(const InstanceCache&) = delete;
+  InstanceCache & operator= (const InstanceCache &) = delete;
+
+  InstanceCache(InstanceCache&&) = delete;
+  InstanceCache & operator= (InstanceCache &&) = delete;
+
+  ~InstanceCache() {
+    for ( CachedInstance& instance : _cache ) {
+      utils::delete_hypergraph(instance.hypergraph);
+    }
+  }
+
+  size_t size() const {
+    return _cache.size();
+  }
+
+  // ! Returns the input (hyper)graph of the job. If it is not contained in the cache,
+  // ! it is read with read_hypergraph(context) and the least recently used instance
+  // ! is evicted if the cache is full. The cache owns the returned (hyper)graph.
+  template<typename ReadFunc>
+  mt_kahypar_hypergraph_t get(const Context& context, const ReadFunc& read_hypergraph) {
+    const std::string key = instanceKey(context);
+    for ( auto it = _cache.begin(); it != _cache.end(); ++it ) {
+      if ( it->key == key ) {
+        // Move to front (least recently used instance is at the back)
+        _cache.splice(_cache.begin(), _cache, it);
+        return _cache.front().hypergraph;
+      }
+    }
+
+    mt_kahypar_hypergraph_t hypergraph = read_hypergraph(context);
+    _cache.push_front(CachedInstance { key, hypergraph });
+    while ( _cache.size() > _max_cached_instances ) {
+      utils::delete_hypergraph(_cache.back().hypergraph);
+      _cache.pop_back();
+    }
+    return hypergraph;
+  }
+
+ private:
+  static std::string instanceKey(const Context& context) {
+    const std::string& filename = context.partition.graph_filename;
+    struct stat file_info;
+    if ( stat(filename.c_str(), &file_info) != 0 ) {
+      throw InvalidInputException("File not found: " + filename);
+    }
+    std::stringstream key;
+    key << filename << "|" << file_info.st_mtime << "|" << file_info.st_size
+        << "|" << to_hypergraph_c_type(context.partition.preset_type, context.partition.instance_type)
+        << "|" << context.partition.file_format
+        << "|" << context.preprocessing.stable_construction_of_incident_edges
+        << "|" << context.preprocessing.sanitize_during_construction;
+    return key.str();
+  }
+
+  const size_t _max_cached_instances;
+  std::list<CachedInstance> _cache;
+};
+
+}  // namespace mt_kahypar::io
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "json_output.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/utils/memory_tree.h"
+#include "mt-kahypar/utils/stats.h"
+#include "mt-kahypar/utils/timer.h"
+
+namespace mt_kahypar::io::json {
+
+  std::string escape(const std::string& str) {
+    std::stringstream s;
+    for ( const char c : str ) {
+      switch ( c ) {
+        case '"': s << "\\\""; break;
+        case '\\': s << "\\\\"; break;
+        case '\b': s << "\\b"; break;
+        case '\f': s << "\\f"; break;
+        case '\n': s << "\\n"; break;
+        case '\r': s << "\\r"; break;
+        case '\t': s << "\\t"; break;
+        default:
+          if ( static_cast<unsigned char>(c) < 0x20 ) {
+            s << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+              << static_cast<int>(c) << std::dec << std::setfill(' ');
+          } else {
+            s << c;
+          }
+      }
+    }
+    return s.str();
+  }
+
+  namespace {
+  std::string quote(const std::string& str) {
+    return "\"" + escape(str) + "\"";
+  }
+
+  // JSON has no representation for inf and nan
+  std::string number(const double value) {
+    if ( !std::isfinite(value) ) {
+      return "null";
+    }
+    std::stringstream s;
+    s << std::setprecision(std::numeric_limits<double>::digits10) << value;
+    return s.str();
+  }
+
+  void serializeTimings(std::stringstream& s, const utils::Timer& timer) {
+    const std::vector<utils::Timer::Timing> timings = timer.timings();
+    std::function<void(const std::string&)> dfs = [&](const std::string& parent) {
+      s << "[";
+      bool first = true;
+      for ( const utils::Timer::Timing& timing : timings ) {
+        if ( timing.parent() == parent ) {
+          s << (first ? "" : ",")
+            << "{\"key\":" << quote(timing.key())
+            << ",\"description\":" << quote(timing.description())
+            << ",\"time\":" << number(timing.timing());
+          #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+          const utils::HardwareCounterValues& counters = timing.counters();
+          s << ",\"cycles\":" << counters.cycles()
+            << ",\"instructions\":" << counters.instructions()
+            << ",\"cache_misses\":" << counters.cacheMisses()
+            << ",\"branch_misses\":" << counters.branchMisses();
+          #endif
+          if ( timing.has_memory_samples() ) {
+            s << ",\"peak_rss\":" << timing.peak_rss()
+              << ",\"faulted_bytes\":" << timing.faulted_bytes();
+          }
+          s << ",\"children\":";
+          dfs(timing.key());
+          s << "}";
+          first = false;
+        }
+      }
+      s << "]";
+    };
+    dfs("");
+  }
+
+  void serializeStats(std::stringstream& s, const utils::Stats& stats) {
+    s << "{";
+    bool first = true;
+    for ( const auto& stat : stats.sortedStats() ) {
+      s << (first ? "" : ",") << quote(stat.first) << ":";
+      if ( stat.second.type() == utils::Stats::Type::FLOAT ||
+           stat.second.type() == utils::Stats::Type::DOUBLE ) {
+        std::stringstream value;
+        value << std::setprecision(std::numeric_limits<double>::digits10) << stat.second;
+        s << number(std::stod(value.str()));
+      } else {
+        s << std::boolalpha << stat.second << std::noboolalpha;
+      }
+      first = false;
+    }
+    s << "}";
+  }
+
+  void serializeMemoryTree(std::stringstream& s, const utils::MemoryTreeNode& node) {
+    s << "{\"name\":" << quote(node.name())
+      << ",\"bytes\":" << node.sizeInBytes()
+      << ",\"children\":[";
+    bool first = true;
+    for ( const auto& child : node.children() ) {
+      s << (first ? "" : ",");
+      serializeMemoryTree(s, *child.second);
+      first = false;
+    }
+    s << "]}";
+  }
+  } // namespace
+
+  template<typename PartitionedHypergraph>
+  std::string serialize(const PartitionedHypergraph& phg,
+                        const Context& context,
+                        const std::chrono::duration<double>& elapsed_seconds) {
+    std::stringstream s;
+    s << "{";
+    s << "\"algorithm\":" << quote(context.algorithm_name);
+    s << ",\"graph\":" << quote(context.partition.graph_filename.substr(
+      context.partition.graph_filename.find_last_of('/') + 1));
+    s << ",\"preset\":" << quote(context.partition.preset_file);
+    s << ",\"threads\":" << context.shared_memory.num_threads;
+    s << ",\"k\":" << context.partition.k;
+    s << ",\"seed\":" << context.partition.seed;
+    s << ",\"epsilon\":" << number(context.partition.epsilon);
+    std::stringstream objective;
+    objective << context.partition.objective;
+    s << ",\"objective\":" << quote(objective.str());
+
+    s << ",\"quality\":{";
+    s << "\"km1\":" << metrics::quality(phg, Objective::km1);
+    s << ",\"cut\":" << metrics::quality(phg, Objective::cut);
+    s << ",\"initial_km1\":" << context.initial_km1;
+    s << ",\"imbalance\":" << number(metrics::imbalance(phg, context));
+    s << "}";
+    s << ",\"total_time\":" << number(elapsed_seconds.count());
+
+    s << ",\"timings\":";
+    serializeTimings(s, utils::Utilities::instance().getTimer(context.utility_id));
+    s << ",\"stats\":";
+    serializeStats(s, utils::Utilities::instance().getStats(context.utility_id));
+
+    utils::MemoryTreeNode hypergraph_memory_consumption("Partitioned Hypergraph", utils::OutputType::BYTES);
+    phg.memoryConsumption(&hypergraph_memory_consumption);
+    hypergraph_memory_consumption.finalize();
+    utils::MemoryTreeNode memory_pool_consumption("Memory Pool", utils::OutputType::BYTES);
+    parallel::MemoryPool::instance().memory_consumption(&memory_pool_consumption);
+    memory_pool_consumption.finalize();
+    s << ",\"memory\":{\"partitioned_hypergraph\":";
+    serializeMemoryTree(s, hypergraph_memory_consumption);
+    s << ",\"memory_pool\":";
+    serializeMemoryTree(s, memory_pool_consumption);
+    s << "}";
+
+    s << "}";
+    return s.str();
+  }
+
+  std::string serializeChromeTrace(const utils::Timer& timer) {
+    const std::vector<utils::Timer::TraceSpan> spans = timer.traceSpans();
+    int num_threads = 0;
+    for ( const utils::Timer::TraceSpan& span : spans ) {
+      num_threads = std::max(num_threads, span.thread + 1);
+    }
+
+    std::stringstream s;
+    s << std::fixed << std::setprecision(3);
+    s << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    s << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+      << "\"args\":{\"name\":\"Mt-KaHyPar\"}}";
+    for ( int thread = 0; thread < num_threads; ++thread ) {
+      s << ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+        << ",\"args\":{\"name\":" << quote("Thread " + std::to_string(thread)) << "}}";
+    }
+    for ( const utils::Timer::TraceSpan& span : spans ) {
+      s << ",{\"name\":" << quote(span.name)
+        << ",\"cat\":" << quote(span.category)
+        << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << span.thread
+        << ",\"ts\":" << span.start
+        << ",\"dur\":" << span.duration;
+      if ( !span.args.empty() ) {
+        s << ",\"args\":{\"info\":" << quote(span.args) << "}";
+      }
+      s << "}";
+    }
+    s << "]}";
+    return s.str();
+  }
+
+  namespace {
+  #define SERIALIZE(X) std::string serialize(const X& phg,                                          \
+                                             const Context& context,                                \
+                                             const std::chrono::duration<double>& elapsed_seconds)
+  }
+
+  INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SERIALIZE)
+}
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/utils/timer.h"
+
+namespace mt_kahypar::io::json {
+  // ! Escapes a string such that it can be embedded into a JSON document
+  std::string escape(const std::string& str);
+
+  // ! Serializes the partitioning result, the timer hierarchy, all stats counters
+  // ! and the memory consumption of the partitioned hypergraph and the memory pool
+  // ! into a single JSON object.
+  template<typename PartitionedHypergraph>
+  std::string serialize(const PartitionedHypergraph& phg,
+                        const Context& context,
+                        const std::chrono::duration<double>& elapsed_seconds);
+
+  // ! Serializes the spans recorded by the timer in tracing mode in the
+  // ! Chrome trace event format (can be loaded in Perfetto or chrome://tracing).
+  // ! Each thread that executed a span is shown as a separate track.
+  std::string serializeChromeTrace(const utils::Timer& timer);
+}
@@ -418,23 +418,34 @@ namespace mt_kahypar::io {
   void printObjectives(const PartitionedHypergraph& hypergraph,
                        const Context& context,
                        const std::chrono::duration<double>& elapsed_seconds) {
+    // All objectives are computed in a single pass over the hyperedges
+    const PartitionMetrics all_metrics = metrics::allMetrics(hypergraph, context);
+    auto value_of = [&](const Objective objective) {
+      switch ( objective ) {
+        case Objective::cut: return all_metrics.cut;
+        case Objective::km1: return all_metrics.km1;
+        case Objective::soed: return all_metrics.soed;
+        case Objective::steiner_tree: return all_metrics.steiner_tree;
+        default: return metrics::quality(hypergraph, objective);
+      }
+    };
     LOG << "Objectives:";
-    printKeyValue(context.partition.objective, metrics::quality(hypergraph,
-      context), "(primary objective function)");
+    printKeyValue(context.partition.objective, value_of(context.partition.objective),
+      "(primary objective function)");
     if ( context.partition.objective == Objective::steiner_tree ) {
       printKeyValue("Approximation Factor",
         metrics::approximationFactorForProcessMapping(hypergraph, context));
     }
     if ( context.partition.objective != Objective::cut ) {
-      printKeyValue(Objective::cut, metrics::quality(hypergraph, Objective::cut));
+      printKeyValue(Objective::cut, all_metrics.cut);
     }
     if ( context.partition.objective != Objective::km1 && !PartitionedHypergraph::is_graph ) {
-      printKeyValue(Objective::km1, metrics::quality(hypergraph, Objective::km1));
+      printKeyValue(Objective::km1, all_metrics.km1);
     }
     if ( context.partition.objective != Objective::soed && !PartitionedHypergraph::is_graph ) {
-      printKeyValue(Objective::soed, metrics::quality(hypergraph, Objective::soed));
+      printKeyValue(Objective::soed, all_metrics.soed);
     }
-    printKeyValue("Imbalance", metrics::imbalance(hypergraph, context));
+    printKeyValue("Imbalance", all_metrics.imbalance);
     printKeyValue("Partitioning Time", std::to_string(elapsed_seconds.count()) + " s");
   }
 
@@ -447,8 +447,20 @@ std::vector<option> load_deterministic_preset() {
     create_option("r-jet-final-negative-gain", "0.0"),
     // main -> refinement -> fm
     create_option("r-fm-type", "do_nothing"),
+    create_option("r-det-fm-sub-rounds", "4"),
     // main -> refinement -> flows
     create_option("r-flow-algo", "do_nothing"),
+    create_option("r-flow-scaling", "16"),
+    create_option("r-flow-max-num-pins", "4294967295"),
+    create_option("r-flow-find-most-balanced-cut", "true"),
+    create_option("r-flow-determine-distance-from-cut", "true"),
+    create_option("r-flow-parallel-search-multiplier", "1.0"),
+    create_option("r-flow-max-bfs-distance", "2"),
+    create_option("r-flow-min-relative-improvement-per-round", "0.001"),
+    create_option("r-flow-skip-small-cuts", "true"),
+    create_option("r-flow-skip-unpromising-blocks", "true"),
+    create_option("r-flow-pierce-in-bulk", "true"),
+    create_option("r-flow-process-mapping-policy", "lower_bound"),
     // main -> mapping
     create_option("one-to-one-mapping-strategy", "greedy_mapping"),
     create_option("mapping-use-local-search", "true"),
@@ -469,6 +481,7 @@ std::vector<option> load_large_k_preset() {
     create_option("smallest-maxnet-threshold", "50000"),
     create_option("maxnet-ignore", "1000"),
     create_option("num-vcycles", "0"),
+    create_option("sparse-gain-cache", "true"),
     // main -> shared_memory
     create_option("s-use-localized-random-shuffle", "false"),
     create_option("s-static-balancing-work-packages", "128"),
@@ -551,6 +564,7 @@ std::vector<option> loadPreset(PresetType preset) {
       return load_quality_preset();
     case PresetType::highest_quality:
       return load_highest_quality_preset();
+    case PresetType::automatic:
     case PresetType::UNDEFINED:
       ERR("invalid preset");
   }
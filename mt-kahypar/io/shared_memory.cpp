@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "shared_memory.h"
+
+#include <cerrno>
+#include <cstring>
+#include <functional>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar::io {
+
+namespace {
+  // POSIX requires that the name of a shared memory segment starts with a slash
+  std::string segmentName(const std::string& name) {
+    if ( name.empty() || name == "/" ) {
+      throw InvalidInputException("No name for shared memory segment specified");
+    }
+    return name[0] == '/' ? name : "/" + name;
+  }
+
+  #ifdef _WIN32
+  [[noreturn]] void throwUnsupported() {
+    throw UnsupportedOperationException(
+      "Shared memory hypergraphs are only supported on POSIX systems");
+  }
+  #endif
+} // namespace
+
+void SharedMemoryHypergraph::create(const std::string& name,
+                                    const HypernodeID num_hypernodes,
+                                    const HyperedgeVector& hyperedges,
+                                    const vec<HyperedgeWeight>& hyperedges_weight,
+                                    const vec<HypernodeWeight>& hypernodes_weight,
+                                    const bool is_graph) {
+  #ifdef _WIN32
+  (void) name;
+  (void) num_hypernodes;
+  (void) hyperedges;
+  (void) hyperedges_weight;
+  (void) hypernodes_weight;
+  (void) is_graph;
+  throwUnsupported();
+  #else
+  const std::string segment = segmentName(name);
+  const size_t length = binarySnapshotSize(
+    num_hypernodes, hyperedges, hyperedges_weight, hypernodes_weight);
+  const int fd = shm_open(segment.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if ( fd < 0 ) {
+    throw SystemException("Could not create shared memory segment " + segment +
+      ": " + std::strerror(errno));
+  }
+  char* data = nullptr;
+  if ( ftruncate(fd, length) == 0 ) {
+    void* mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    data = mapped == MAP_FAILED ? nullptr : static_cast<char*>(mapped);
+  }
+  close(fd);
+  if ( !data ) {
+    const std::string error = std::strerror(errno);
+    shm_unlink(segment.c_str());
+    throw SystemException("Could not allocate shared memory segment " + segment + ": " + error);
+  }
+
+  writeBinarySnapshot(data, num_hypernodes, hyperedges, hyperedges_weight,
+    hypernodes_weight, is_graph);
+  munmap(data, length);
+  #endif
+}
+
+void SharedMemoryHypergraph::unlink(const std::string& name) {
+  #ifdef _WIN32
+  (void) name;
+  throwUnsupported();
+  #else
+  const std::string segment = segmentName(name);
+  if ( shm_unlink(segment.c_str()) != 0 ) {
+    throw InvalidInputException("Could not unlink shared memory segment " + segment +
+      ": " + std::strerror(errno));
+  }
+  #endif
+}
+
+SharedMemoryHypergraph::SharedMemoryHypergraph(const std::string& name) :
+  _name(segmentName(name)),
+  _data(nullptr),
+  _length(0),
+  _view(),
+  _total_weight(0) {
+  #ifdef _WIN32
+  throwUnsupported();
+  #else
+  const int fd = shm_open(_name.c_str(), O_RDONLY, 0);
+  if ( fd < 0 ) {
+    throw InvalidInputException("Could not open shared memory segment " + _name +
+      ": " + std::strerror(errno));
+  }
+  struct stat stat_buf;
+  if ( fstat(fd, &stat_buf) != 0 || stat_buf.st_size == 0 ) {
+    close(fd);
+    throw InvalidInputException("Shared memory segment " + _name + " is empty");
+  }
+  _length = static_cast<size_t>(stat_buf.st_size);
+  void* mapped = mmap(nullptr, _length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( mapped == MAP_FAILED ) {
+    throw SystemException("Could not map shared memory segment " + _name +
+      ": " + std::strerror(errno));
+  }
+  _data = static_cast<char*>(mapped);
+
+  try {
+    _view = viewBinarySnapshot(_data, _length, _name);
+    if ( _view.pin_width != sizeof(HypernodeID) ) {
+      throw InvalidInputException("Shared memory segment " + _name +
+        " was created with a different ID width than this build");
+    }
+  } catch ( ... ) {
+    munmap(_data, _length);
+    throw;
+  }
+
+  if ( _view.node_weights ) {
+    _total_weight = tbb::parallel_reduce(
+      tbb::blocked_range<HypernodeID>(ID(0), _view.num_nodes), 0,
+      [&](const tbb::blocked_range<HypernodeID>& range, HypernodeWeight init) {
+        for ( HypernodeID hn = range.begin(); hn < range.end(); ++hn ) {
+          init += _view.node_weights[hn];
+        }
+        return init;
+      }, std::plus<>());
+  } else {
+    _total_weight = _view.num_nodes;
+  }
+  #endif
+}
+
+SharedMemoryHypergraph::SharedMemoryHypergraph(SharedMemoryHypergraph&& other) :
+  _name(std::move(other._name)),
+  _data(other._data),
+  _length(other._length),
+  _view(other._view),
+  _total_weight(other._total_weight) {
+  other._data = nullptr;
+  other._length = 0;
+}
+
+SharedMemoryHypergraph::~SharedMemoryHypergraph() {
+  #ifndef _WIN32
+  if ( _data ) {
+    munmap(_data, _length);
+  }
+  #endif
+}
+
+void SharedMemoryHypergraph::read(HyperedgeID& num_hyperedges,
+                                  HypernodeID& num_hypernodes,
+                                  HyperedgeID& num_removed_single_pin_hyperedges,
+                                  HyperedgeVector& hyperedges,
+                                  vec<HyperedgeWeight>& hyperedges_weight,
+                                  vec<HypernodeWeight>& hypernodes_weight) const {
+  readBinarySnapshot(_data, _length, _name, num_hyperedges, num_hypernodes,
+    num_removed_single_pin_hyperedges, hyperedges, hyperedges_weight, hypernodes_weight);
+}
+
+} // namespace mt_kahypar::io
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/range.h"
+
+namespace mt_kahypar {
+namespace io {
+
+// ! Read-only (hyper)graph stored in the binary snapshot format in a named POSIX shared
+// ! memory segment. Attaching to a segment only maps it into the address space of the
+// ! process, which allows several processes to share a single copy of the (hyper)graph.
+// ! The segment remains alive until it is unlinked and all processes have detached.
+class SharedMemoryHypergraph {
+ public:
+  using PinIterator = const HypernodeID*;
+
+  // ! Creates a new segment that stores the given (hyper)graph (fails if the name is already taken).
+  // ! Graphs are expected to contain each undirected edge exactly once.
+  static void create(const std::string& name,
+                     const HypernodeID num_hypernodes,
+                     const HyperedgeVector& hyperedges,
+                     const vec<HyperedgeWeight>& hyperedges_weight,
+                     const vec<HypernodeWeight>& hypernodes_weight,
+                     const bool is_graph);
+
+  // ! Removes the name of the segment. Attached processes can still use the segment.
+  static void unlink(const std::string& name);
+
+  // ! Attaches to an existing segment
+  explicit SharedMemoryHypergraph(const std::string& name);
+
+  SharedMemoryHypergraph(const SharedMemoryHypergraph&) = delete;
+  SharedMemoryHypergraph & operator= (const SharedMemoryHypergraph &) = delete;
+
+  SharedMemoryHypergraph(SharedMemoryHypergraph&& other);
+  SharedMemoryHypergraph & operator= (SharedMemoryHypergraph&& other) = delete;
+
+  ~SharedMemoryHypergraph();
+
+  const std::string& name() const {
+    return _name;
+  }
+
+  bool isGraph() const {
+    return _view.is_graph;
+  }
+
+  HypernodeID numNodes() const {
+    return _view.num_nodes;
+  }
+
+  // ! Number of hyperedges (each undirected edge is stored once for graphs)
+  HyperedgeID numEdges() const {
+    return _view.num_edges;
+  }
+
+  size_t numPins() const {
+    return _view.num_pins;
+  }
+
+  HypernodeWeight totalWeight() const {
+    return _total_weight;
+  }
+
+  HypernodeID edgeSize(const HyperedgeID he) const {
+    ASSERT(he < numEdges());
+    return _view.offsets[he + 1] - _view.offsets[he];
+  }
+
+  IteratorRange<PinIterator> pins(const HyperedgeID he) const {
+    ASSERT(he < numEdges());
+    const HypernodeID* pins = reinterpret_cast<const HypernodeID*>(_view.pins);
+    return IteratorRange<PinIterator>(pins + _view.offsets[he], pins + _view.offsets[he + 1]);
+  }
+
+  HyperedgeWeight edgeWeight(const HyperedgeID he) const {
+    ASSERT(he < numEdges());
+    return _view.edge_weights ? _view.edge_weights[he] : 1;
+  }
+
+  HypernodeWeight nodeWeight(const HypernodeID hn) const {
+    ASSERT(hn < numNodes());
+    return _view.node_weights ? _view.node_weights[hn] : 1;
+  }
+
+  // ! Pointers to the sections of the mapped snapshot
+  const BinarySnapshotView& view() const {
+    return _view;
+  }
+
+  // ! Copies the (hyper)graph into the input representation of the hypergraph factories
+  void read(HyperedgeID& num_hyperedges,
+            HypernodeID& num_hypernodes,
+            HyperedgeID& num_removed_single_pin_hyperedges,
+            HyperedgeVector& hyperedges,
+            vec<HyperedgeWeight>& hyperedges_weight,
+            vec<HypernodeWeight>& hypernodes_weight) const;
+
+ private:
+  std::string _name;
+  char* _data;
+  size_t _length;
+  BinarySnapshotView _view;
+  HypernodeWeight _total_weight;
+};
+
+}  // namespace io
+}  // namespace mt_kahypar
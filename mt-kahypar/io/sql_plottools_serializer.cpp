@@ -62,9 +62,28 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " epsilon=" << context.partition.epsilon
         << " seed=" << context.partition.seed
         << " num_vcycles=" << context.partition.num_vcycles
+        << " vcycle_min_relative_improvement=" << context.partition.vcycle_min_relative_improvement
+        << " vcycle_truncated_contraction_limit_factor=" << context.partition.vcycle_truncated_contraction_limit_factor
         << " deterministic=" << context.partition.deterministic
-        << " perform_parallel_recursion_in_deep_multilevel=" << context.partition.perform_parallel_recursion_in_deep_multilevel;
-    oss << " large_hyperedge_size_threshold_factor=" << context.partition.large_hyperedge_size_threshold_factor
+        << " nested_partitions=" << context.partition.nested_partitions
+        << " write_block_ordering=" << context.partition.write_block_ordering
+        << " perform_parallel_recursion_in_deep_multilevel=" << context.partition.perform_parallel_recursion_in_deep_multilevel
+        << " deep_ml_copy_memory_limit=" << context.partition.deep_ml_copy_memory_limit
+        << " use_sparse_gain_cache=" << context.partition.use_sparse_gain_cache
+        << " sparse_connectivity_min_k=" << context.partition.sparse_connectivity_min_k
+        << " graph_gain_cache_on_the_fly_factor=" << context.partition.graph_gain_cache_on_the_fly_factor
+        << " memory_budget=" << context.partition.memory_budget
+        << " portfolio_runs=" << context.partition.portfolio_runs
+        << " portfolio_cutoff=" << context.partition.portfolio_cutoff
+        << " evolutionary_time_limit=" << context.partition.evolutionary_time_limit
+        << " auto_tuning=" << std::boolalpha << context.partition.auto_tuning
+        << " auto_tuning_sample_fraction=" << context.partition.auto_tuning_sample_fraction
+        << " auto_tuning_max_slowdown=" << context.partition.auto_tuning_max_slowdown
+        << " shared_input=" << std::boolalpha << context.partition.shared_input
+        << " partition_two_pin_hypergraphs_as_graphs=" << std::boolalpha
+        << context.partition.partition_two_pin_hypergraphs_as_graphs;
+    oss << " remove_large_hyperedges=" << std::boolalpha << context.partition.remove_large_hyperedges
+        << " large_hyperedge_size_threshold_factor=" << context.partition.large_hyperedge_size_threshold_factor
         << " smallest_large_he_size_threshold=" << context.partition.smallest_large_he_size_threshold
         << " large_hyperedge_size_threshold=" << context.partition.large_hyperedge_size_threshold
         << " ignore_hyperedge_size_threshold=" << context.partition.ignore_hyperedge_size_threshold
@@ -73,14 +92,21 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " perfect_balance_part_weight=" << context.partition.perfect_balance_part_weights[0]
         << " max_part_weight=" << context.partition.max_part_weights[0]
         << " total_graph_weight=" << hypergraph.totalWeight();
-    oss << " use_community_detection=" << std::boolalpha << context.preprocessing.use_community_detection
+    oss << " sanitize_during_construction=" << std::boolalpha << context.preprocessing.sanitize_during_construction
+        << " reorder_nodes=" << std::boolalpha << context.preprocessing.reorder_nodes
+        << " compress_twin_nodes=" << std::boolalpha << context.preprocessing.compress_twin_nodes
+        << " use_community_detection=" << std::boolalpha << context.preprocessing.use_community_detection
+        << " community_detection_algorithm=" << context.preprocessing.community_detection_algorithm
         << " disable_community_detection_for_mesh_graphs=" << std::boolalpha << context.preprocessing.disable_community_detection_for_mesh_graphs
         << " community_edge_weight_function=" << context.preprocessing.community_detection.edge_weight_function
         << " community_max_pass_iterations=" << context.preprocessing.community_detection.max_pass_iterations
         << " community_min_vertex_move_fraction=" << context.preprocessing.community_detection.min_vertex_move_fraction
         << " community_vertex_degree_sampling_threshold=" << context.preprocessing.community_detection.vertex_degree_sampling_threshold
         << " community_num_sub_rounds_deterministic=" << context.preprocessing.community_detection.num_sub_rounds_deterministic
-        << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction;
+        << " community_volume_update_sub_rounds=" << context.preprocessing.community_detection.volume_update_sub_rounds
+        << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction
+        << " community_use_active_node_set=" << std::boolalpha << context.preprocessing.community_detection.use_active_node_set
+        << " community_vertex_following=" << std::boolalpha << context.preprocessing.community_detection.vertex_following;
     oss << " coarsening_algorithm=" << context.coarsening.algorithm
         << " coarsening_contraction_limit_multiplier=" << context.coarsening.contraction_limit_multiplier
         << " coarsening_deep_ml_contraction_limit_multiplier=" << context.coarsening.deep_ml_contraction_limit_multiplier
@@ -90,24 +116,39 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " coarsening_maximum_shrink_factor=" << context.coarsening.maximum_shrink_factor
         << " coarsening_max_allowed_node_weight=" << context.coarsening.max_allowed_node_weight
         << " coarsening_vertex_degree_sampling_threshold=" << context.coarsening.vertex_degree_sampling_threshold
+        << " coarsening_use_two_hop_clustering=" << std::boolalpha << context.coarsening.use_two_hop_clustering
+        << " coarsening_two_hop_clustering_shrink_factor=" << context.coarsening.two_hop_clustering_shrink_factor
+        << " coarsening_precontract_fixed_vertices=" << std::boolalpha << context.coarsening.precontract_fixed_vertices
         << " coarsening_num_sub_rounds_deterministic=" << context.coarsening.num_sub_rounds_deterministic
         << " coarsening_det_resolve_swaps=" << std::boolalpha << context.coarsening.det_resolve_swaps
+        << " coarsening_vcycle_reuse_hierarchy=" << std::boolalpha << context.coarsening.vcycle_reuse_hierarchy
+        << " coarsening_propose_resolve_clustering=" << std::boolalpha << context.coarsening.propose_resolve_clustering
+        << " coarsening_num_sub_rounds_propose_resolve=" << context.coarsening.num_sub_rounds_propose_resolve
         << " coarsening_contraction_limit=" << context.coarsening.contraction_limit
         << " rating_function=" << context.coarsening.rating.rating_function
         << " rating_heavy_node_penalty_policy=" << context.coarsening.rating.heavy_node_penalty_policy
-        << " rating_acceptance_policy=" << context.coarsening.rating.acceptance_policy;
+        << " rating_acceptance_policy=" << context.coarsening.rating.acceptance_policy
+        << " rating_pin_sampling_threshold=" << context.coarsening.rating.pin_sampling_threshold;
     oss << " initial_partitioning_mode=" << context.initial_partitioning.mode
         << " initial_partitioning_runs=" << context.initial_partitioning.runs
         << " initial_partitioning_use_adaptive_ip_runs=" << std::boolalpha << context.initial_partitioning.use_adaptive_ip_runs
         << " initial_partitioning_min_adaptive_ip_runs=" << context.initial_partitioning.min_adaptive_ip_runs
+        << " initial_partitioning_use_portfolio_scheduling=" << std::boolalpha << context.initial_partitioning.use_portfolio_scheduling
         << " initial_partitioning_perform_refinement_on_best_partitions=" << std::boolalpha << context.initial_partitioning.perform_refinement_on_best_partitions
         << " initial_partitioning_fm_refinment_rounds=" << std::boolalpha << context.initial_partitioning.fm_refinment_rounds
+        << " initial_partitioning_abort_unpromising_refinements=" << std::boolalpha << context.initial_partitioning.abort_unpromising_refinements
         << " initial_partitioning_remove_degree_zero_hns_before_ip=" << std::boolalpha << context.initial_partitioning.remove_degree_zero_hns_before_ip
         << " initial_partitioning_lp_maximum_iterations=" << context.initial_partitioning.lp_maximum_iterations
         << " initial_partitioning_lp_initial_block_size=" << context.initial_partitioning.lp_initial_block_size
-        << " initial_partitioning_population_size=" << context.initial_partitioning.population_size;
+        << " initial_partitioning_population_size=" << context.initial_partitioning.population_size
+        << " initial_partitioning_max_num_nodes_for_sequential_ip=" << context.initial_partitioning.max_num_nodes_for_sequential_ip
+        << " initial_partitioning_min_num_nodes_for_parallel_bfs=" << context.initial_partitioning.min_num_nodes_for_parallel_bfs
+        << " initial_partitioning_parallel_lp_min_k=" << context.initial_partitioning.parallel_lp_min_k;
     oss << " refine_until_no_improvement=" << std::boolalpha << context.refinement.refine_until_no_improvement
         << " relative_improvement_threshold=" << context.refinement.relative_improvement_threshold
+        << " adaptive_refinement=" << std::boolalpha << context.refinement.adaptive_refinement
+        << " adaptive_refinement_min_yield=" << context.refinement.adaptive_refinement_min_yield
+        << " lazy_gain_cache_initialization=" << std::boolalpha << context.refinement.lazy_gain_cache_initialization
         << " max_batch_size=" << context.refinement.max_batch_size
         << " min_border_vertices_per_thread=" << context.refinement.min_border_vertices_per_thread
         << " rebalancing_algorithm=" << context.refinement.rebalancing.algorithm
@@ -120,8 +161,12 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " lp_unconstrained=" << std::boolalpha << context.refinement.label_propagation.unconstrained
         << " lp_relative_improvement_threshold=" << context.refinement.label_propagation.relative_improvement_threshold
         << " lp_hyperedge_size_activation_threshold=" << context.refinement.label_propagation.hyperedge_size_activation_threshold
+        << " lp_high_degree_threshold=" << context.refinement.label_propagation.high_degree_threshold
+        << " lp_use_active_node_set=" << std::boolalpha << context.refinement.label_propagation.use_active_node_set
         << " sync_lp_num_sub_rounds_sync_lp=" << context.refinement.deterministic_refinement.num_sub_rounds_sync_lp
+        << " sync_lp_adaptive_sub_rounds_sync_lp=" << std::boolalpha << context.refinement.deterministic_refinement.adaptive_sub_rounds_sync_lp
         << " sync_lp_use_active_node_set=" << context.refinement.deterministic_refinement.use_active_node_set
+        << " sync_lp_num_sub_rounds_fm=" << context.refinement.deterministic_refinement.num_sub_rounds_fm
         << " jet_algorithm=" << context.refinement.jet.algorithm
         << " jet_num_iterations_without_improvement=" << context.refinement.jet.num_iterations
         << " jet_relative_improvement_threshold=" << context.refinement.jet.relative_improvement_threshold
@@ -134,12 +179,14 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " fm_rollback_sensitive_to_num_moves=" << std::boolalpha << context.refinement.fm.iter_moves_on_recalc
         << " fm_rollback_balance_violation_factor=" << context.refinement.fm.rollback_balance_violation_factor
         << " fm_min_improvement=" << context.refinement.fm.min_improvement
+        << " fm_adaptive_stop_rule_factor=" << context.refinement.fm.adaptive_stop_rule_factor
         << " fm_release_nodes=" << context.refinement.fm.release_nodes
         << " fm_iter_moves_on_recalc=" << context.refinement.fm.iter_moves_on_recalc
         << " fm_num_seed_nodes=" << context.refinement.fm.num_seed_nodes
         << " fm_time_limit_factor=" << context.refinement.fm.time_limit_factor
         << " fm_obey_minimal_parallelism=" << std::boolalpha << context.refinement.fm.obey_minimal_parallelism
         << " fm_shuffle=" << std::boolalpha << context.refinement.fm.shuffle
+        << " fm_gain_ordered_seeds=" << std::boolalpha << context.refinement.fm.gain_ordered_seeds
         << " fm_unconstrained_rounds=" << context.refinement.fm.unconstrained_rounds
         << " fm_treshold_border_node_inclusion=" << context.refinement.fm.treshold_border_node_inclusion
         << " fm_unconstrained_min_improvement=" << context.refinement.fm.unconstrained_min_improvement
@@ -164,16 +211,26 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " flow_time_limit_factor=" << context.refinement.flows.time_limit_factor
         << " flow_skip_small_cuts=" << std::boolalpha << context.refinement.flows.skip_small_cuts
         << " flow_skip_unpromising_blocks=" << std::boolalpha << context.refinement.flows.skip_unpromising_blocks
+        << " flow_prioritize_block_pairs=" << std::boolalpha << context.refinement.flows.prioritize_block_pairs
         << " flow_pierce_in_bulk=" << std::boolalpha << context.refinement.flows.pierce_in_bulk
+        << " flow_reuse_problem_construction=" << std::boolalpha << context.refinement.flows.reuse_problem_construction
+        << " flow_skip_unchanged_problems=" << std::boolalpha << context.refinement.flows.skip_unchanged_problems
+        << " flow_parallel_region_growing=" << std::boolalpha << context.refinement.flows.parallel_region_growing
+        << " flow_matching_based_scheduling=" << std::boolalpha << context.refinement.flows.matching_based_scheduling
         << " flow_alpha=" << context.refinement.flows.alpha
         << " flow_max_num_pins=" << context.refinement.flows.max_num_pins
         << " flow_find_most_balanced_cut=" << std::boolalpha << context.refinement.flows.find_most_balanced_cut
         << " flow_determine_distance_from_cut=" << std::boolalpha << context.refinement.flows.determine_distance_from_cut
         << " flow_steiner_tree_policy=" << context.refinement.flows.steiner_tree_policy;
     oss << " num_threads=" << context.shared_memory.num_threads
+        << " thread_limit=" << context.shared_memory.thread_limit
         << " use_localized_random_shuffle=" << std::boolalpha << context.shared_memory.use_localized_random_shuffle
         << " shuffle_block_size=" << context.shared_memory.shuffle_block_size
-        << " static_balancing_work_packages=" << context.shared_memory.static_balancing_work_packages;
+        << " use_numa_aware_placement=" << std::boolalpha << context.shared_memory.use_numa_aware_placement
+        << " use_huge_pages=" << std::boolalpha << context.shared_memory.use_huge_pages
+        << " use_background_reclamation=" << std::boolalpha << context.shared_memory.use_background_reclamation
+        << " static_balancing_work_packages=" << context.shared_memory.static_balancing_work_packages
+        << " num_threads_for_flows=" << context.shared_memory.num_threads_for_flows;
 
     if ( context.partition.objective == Objective::steiner_tree ) {
       oss << " target_graph_file=" << context.mapping.target_graph_file.substr(
@@ -182,10 +239,12 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
           << " mapping_use_local_search=" << std::boolalpha << context.mapping.use_local_search
           << " mapping_use_two_phase_approach=" << std::boolalpha << context.mapping.use_two_phase_approach
           << " mapping_max_steiner_tree_size=" << context.mapping.max_steiner_tree_size
+          << " mapping_steiner_tree_cache_size=" << context.mapping.steiner_tree_cache_size
+          << " mapping_write_steiner_tree_tables=" << std::boolalpha << context.mapping.write_steiner_tree_tables
           << " mapping_largest_he_fraction=" << context.mapping.largest_he_fraction
           << " mapping_min_pin_coverage_of_largest_hes=" << context.mapping.min_pin_coverage_of_largest_hes
           << " mapping_large_he_threshold=" << context.mapping.large_he_threshold;
-      if ( TargetGraph::TRACK_STATS ) {
+      if ( hypergraph.hasTargetGraph() ) {
         hypergraph.targetGraph()->printStats(oss);
       }
     }
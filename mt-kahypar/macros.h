@@ -63,6 +63,17 @@
 #define MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
 #endif
 
+// Compiles a function for several x86 instruction set extensions and selects the
+// best version supported by the CPU at load time (requires ifunc support)
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define MT_KAHYPAR_ATTRIBUTE_TARGET_CLONES __attribute__ ((target_clones("avx512f", "avx2", "sse4.2", "default")))
+#endif
+#endif
+#ifndef MT_KAHYPAR_ATTRIBUTE_TARGET_CLONES
+#define MT_KAHYPAR_ATTRIBUTE_TARGET_CLONES
+#endif
+
 #ifdef KAHYPAR_ENABLE_HEAVY_PREPROCESSING_ASSERTIONS
 #define HEAVY_PREPROCESSING_ASSERT_1(cond) ASSERT(cond)
 #define HEAVY_PREPROCESSING_ASSERT_2(cond, msg) ASSERT(cond, msg)
@@ -34,6 +34,7 @@
 #include <type_traits>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/contention_stats.h"
 
 template<typename T>
 class CAtomic : public std::__atomic_base<T> {
@@ -77,11 +78,17 @@ public:
     return !spinner.test_and_set(std::memory_order_acquire);
   }
 
-  void lock() {
+  void lock(const mt_kahypar::parallel::ContentionSite site =
+              mt_kahypar::parallel::ContentionSite::other_spin_lock) {
+    size_t spins = 0;
     while (spinner.test_and_set(std::memory_order_acquire)) {
       // spin
       // stack overflow says adding 'cpu_relax' instruction may improve performance
+      if constexpr (mt_kahypar::parallel::ContentionStats::enabled) {
+        ++spins;
+      }
     }
+    mt_kahypar::parallel::ContentionStats::recordAcquisition(site, spins);
   }
 
   void unlock() {
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * Singleton that frees retired data structures on a background thread.
+ * Destroying large data structures (e.g., the hypergraphs of the coarsening
+ * hierarchy) at phase boundaries returns gigabytes of memory to the operating
+ * system, which stalls the critical path. If activated, retire(...) hands the
+ * data structure over to a background thread that destroys it concurrently with
+ * the next phase. Otherwise, it is destroyed immediately.
+ *
+ * Memory pool chunks released by retired data structures are returned to the pool
+ * on the background thread, which is why the memory pool waits for all retired
+ * data structures before it reassigns or frees its chunks (see waitUntilIdle()).
+ */
+class BackgroundReclamation {
+
+  struct RetiredObject {
+    virtual ~RetiredObject() = default;
+  };
+
+  template<typename T>
+  struct RetiredObjectT final : public RetiredObject {
+    explicit RetiredObjectT(T&& obj) :
+      object(std::move(obj)) { }
+
+    T object;
+  };
+
+  template<typename F>
+  struct DeferredCall final : public RetiredObject {
+    explicit DeferredCall(F f) :
+      func(std::move(f)) { }
+
+    ~DeferredCall() override {
+      func();
+    }
+
+    F func;
+  };
+
+ public:
+  BackgroundReclamation(const BackgroundReclamation&) = delete;
+  BackgroundReclamation & operator= (const BackgroundReclamation &) = delete;
+
+  BackgroundReclamation(BackgroundReclamation&&) = delete;
+  BackgroundReclamation & operator= (BackgroundReclamation &&) = delete;
+
+  // ! The instance is intentionally never destroyed such that the memory pool
+  // ! can wait for retired data structures during static destruction
+  static BackgroundReclamation& instance() {
+    static BackgroundReclamation* instance = new BackgroundReclamation();
+    return *instance;
+  }
+
+  bool isActive() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _is_active;
+  }
+
+  void activate() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if ( !_is_active ) {
+      _is_active = true;
+      _stop = false;
+      _thread = std::thread([&] { run(); });
+    }
+  }
+
+  // ! Destroys all retired data structures and stops the background thread
+  void deactivate() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if ( !_is_active ) {
+        return;
+      }
+      _is_active = false;
+      _stop = true;
+    }
+    _cv.notify_all();
+    _thread.join();
+  }
+
+  // ! Takes ownership of the object and destroys it on the background thread
+  // ! (or immediately, if background reclamation is not active)
+  template<typename T>
+  void retire(T&& obj) {
+    static_assert(!std::is_lvalue_reference_v<T>, "Retired objects must be passed as rvalue");
+    enqueue(std::make_unique<RetiredObjectT<T>>(std::move(obj)));
+  }
+
+  // ! Calls free_func on the background thread (or immediately, if background
+  // ! reclamation is not active). Used for objects that are referenced by handles.
+  template<typename F>
+  void defer(F&& free_func) {
+    enqueue(std::make_unique<DeferredCall<std::decay_t<F>>>(std::forward<F>(free_func)));
+  }
+
+  // ! Blocks until all retired data structures are destroyed
+  void waitUntilIdle() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [&] { return _retired.empty() && !_is_busy; });
+  }
+
+ private:
+  BackgroundReclamation() :
+    _mutex(),
+    _cv(),
+    _retired(),
+    _thread(),
+    _is_active(false),
+    _is_busy(false),
+    _stop(false) { }
+
+  void enqueue(std::unique_ptr<RetiredObject>&& retired) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if ( _is_active ) {
+        _retired.push_back(std::move(retired));
+      }
+    }
+    _cv.notify_all();
+    // If background reclamation is not active, the object is destroyed here
+    retired.reset();
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while ( true ) {
+      _cv.wait(lock, [&] { return _stop || !_retired.empty(); });
+      if ( _retired.empty() ) {
+        // _stop is set and all retired data structures are destroyed
+        break;
+      }
+      std::unique_ptr<RetiredObject> retired = std::move(_retired.front());
+      _retired.pop_front();
+      _is_busy = true;
+      lock.unlock();
+      retired.reset();
+      lock.lock();
+      _is_busy = false;
+      _cv.notify_all();
+    }
+  }
+
+  mutable std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<std::unique_ptr<RetiredObject>> _retired;
+  std::thread _thread;
+  bool _is_active;
+  bool _is_busy;
+  bool _stop;
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -29,6 +29,7 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <utility>
 
 namespace mt_kahypar::parallel::chunking {
   template <typename T1, typename T2>
@@ -39,4 +40,21 @@ namespace mt_kahypar::parallel::chunking {
   inline std::pair<size_t, size_t> bounds(size_t i, size_t n, size_t chunk_size) {
     return std::make_pair(std::min(n, i * chunk_size), std::min(n, (i+1) * chunk_size));
   }
+
+  // ! Bounds of the i-th of num_chunks chunks of [0, n), such that all chunks have roughly the same
+  // ! total weight. prefix_weights[j] is the total weight of the elements before j and must be
+  // ! strictly increasing (e.g., weight = degree + 1) with prefix_weights[n] being the total weight.
+  template<typename PrefixWeights>
+  inline std::pair<size_t, size_t> weighted_bounds(size_t i, size_t n, size_t num_chunks,
+                                                   const PrefixWeights& prefix_weights) {
+    const auto total_weight = prefix_weights[n];
+    auto first_element_with_weight = [&](const size_t chunk) -> size_t {
+      if ( chunk >= num_chunks ) {
+        return n;
+      }
+      const size_t weight = static_cast<size_t>(total_weight) * chunk / num_chunks;
+      return std::lower_bound(&prefix_weights[0], &prefix_weights[0] + n, weight) - &prefix_weights[0];
+    };
+    return std::make_pair(first_element_with_weight(i), first_element_with_weight(i + 1));
+  }
 }
\ No newline at end of file
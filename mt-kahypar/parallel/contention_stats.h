@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/utils/stats.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+// ! Locks for which contention is recorded separately
+enum class ContentionSite : uint8_t {
+  pin_count_update = 0,
+  rebalancer_pq = 1,
+  memory_pool = 2,
+  other_spin_lock = 3,
+  NUM_SITES = 4
+};
+
+/*!
+ * Opt-in statistics for lock contention and load imbalance in parallel loops.
+ * The statistics are only recorded if Mt-KaHyPar is built with
+ * KAHYPAR_ENABLE_CONTENTION_STATS. Otherwise, all record functions are empty and
+ * the call sites compile to the same code as without instrumentation.
+ *
+ * For each lock site, we count the acquisitions, the acquisitions that had to wait
+ * (spin iterations of a spin lock or failed try-locks), the spin iterations and the
+ * time the lock is held (where measured). Additionally, each thread accumulates the
+ * time it spends in the chunks of parallel loops. The differences between the busy
+ * times of the threads indicate load imbalance.
+ *
+ * The counters are stored thread-locally and are only aggregated in report().
+ */
+class ContentionStats {
+
+  using Clock = std::chrono::steady_clock;
+  static constexpr size_t NUM_SITES = static_cast<size_t>(ContentionSite::NUM_SITES);
+
+  struct LocalStats {
+    std::array<uint64_t, NUM_SITES> acquisitions { };
+    std::array<uint64_t, NUM_SITES> contended { };
+    std::array<uint64_t, NUM_SITES> spins { };
+    std::array<double, NUM_SITES> hold_time { };
+    double busy_time = 0.0;
+  };
+
+ public:
+  #ifdef KAHYPAR_ENABLE_CONTENTION_STATS
+  static constexpr bool enabled = true;
+  #else
+  static constexpr bool enabled = false;
+  #endif
+
+  using TimePoint = Clock::time_point;
+
+  static ContentionStats& instance() {
+    static ContentionStats instance;
+    return instance;
+  }
+
+  ContentionStats(const ContentionStats&) = delete;
+  ContentionStats & operator= (const ContentionStats &) = delete;
+
+  ContentionStats(ContentionStats&&) = delete;
+  ContentionStats & operator= (ContentionStats &&) = delete;
+
+  static TimePoint now() {
+    if constexpr ( enabled ) {
+      return Clock::now();
+    } else {
+      return TimePoint();
+    }
+  }
+
+  static void recordAcquisition(const ContentionSite site, const size_t spins) {
+    if constexpr ( enabled ) {
+      LocalStats& local = instance()._local_stats.local();
+      const size_t i = static_cast<size_t>(site);
+      ++local.acquisitions[i];
+      local.contended[i] += spins > 0;
+      local.spins[i] += spins;
+    }
+  }
+
+  static void recordFailedTryLock(const ContentionSite site) {
+    if constexpr ( enabled ) {
+      ++instance()._local_stats.local().contended[static_cast<size_t>(site)];
+    }
+  }
+
+  static void recordHoldTime(const ContentionSite site, const TimePoint& start) {
+    if constexpr ( enabled ) {
+      instance()._local_stats.local().hold_time[static_cast<size_t>(site)] +=
+        std::chrono::duration<double>(Clock::now() - start).count();
+    }
+  }
+
+  static void recordBusyTime(const TimePoint& start) {
+    if constexpr ( enabled ) {
+      instance()._local_stats.local().busy_time +=
+        std::chrono::duration<double>(Clock::now() - start).count();
+    }
+  }
+
+  void reset() {
+    _local_stats.clear();
+  }
+
+  // ! Adds the aggregated counters to the stats (prefix contention_)
+  void report(utils::Stats& stats) const {
+    if constexpr ( enabled ) {
+      static const std::array<std::string, NUM_SITES> site_names = {
+        "pin_count_update", "rebalancer_pq", "memory_pool", "other_spin_lock" };
+      LocalStats total;
+      double min_busy_time = std::numeric_limits<double>::max();
+      double max_busy_time = 0.0;
+      for ( const LocalStats& local : _local_stats ) {
+        for ( size_t i = 0; i < NUM_SITES; ++i ) {
+          total.acquisitions[i] += local.acquisitions[i];
+          total.contended[i] += local.contended[i];
+          total.spins[i] += local.spins[i];
+          total.hold_time[i] += local.hold_time[i];
+        }
+        total.busy_time += local.busy_time;
+        min_busy_time = std::min(min_busy_time, local.busy_time);
+        max_busy_time = std::max(max_busy_time, local.busy_time);
+      }
+
+      for ( size_t i = 0; i < NUM_SITES; ++i ) {
+        const std::string prefix = "contention_" + site_names[i];
+        stats.add_stat(prefix + "_acquisitions", static_cast<int64_t>(total.acquisitions[i]));
+        stats.add_stat(prefix + "_contended", static_cast<int64_t>(total.contended[i]));
+        stats.add_stat(prefix + "_spins", static_cast<int64_t>(total.spins[i]));
+        stats.add_stat(prefix + "_hold_time", total.hold_time[i]);
+      }
+      const size_t num_threads = _local_stats.size();
+      stats.add_stat("contention_num_threads", static_cast<int64_t>(num_threads));
+      stats.add_stat("contention_min_busy_time", num_threads > 0 ? min_busy_time : 0.0);
+      stats.add_stat("contention_max_busy_time", max_busy_time);
+      stats.add_stat("contention_avg_busy_time", num_threads > 0 ? total.busy_time / num_threads : 0.0);
+    } else {
+      unused(stats);
+    }
+  }
+
+ private:
+  ContentionStats() :
+    _local_stats() { }
+
+  tbb::enumerable_thread_specific<LocalStats> _local_stats;
+};
+
+/*!
+ * Lock guard for mutexes that records the acquisitions that had to wait
+ * and the time the mutex is held, if contention statistics are enabled.
+ */
+template<typename Mutex>
+class TrackedLockGuard {
+ public:
+  TrackedLockGuard(Mutex& mutex, const ContentionSite site) :
+    _mutex(mutex),
+    _site(site),
+    _start() {
+    if constexpr ( ContentionStats::enabled ) {
+      const bool is_contended = !_mutex.try_lock();
+      if ( is_contended ) {
+        _mutex.lock();
+      }
+      ContentionStats::recordAcquisition(_site, is_contended);
+      _start = ContentionStats::now();
+    } else {
+      _mutex.lock();
+    }
+  }
+
+  TrackedLockGuard(const TrackedLockGuard&) = delete;
+  TrackedLockGuard & operator= (const TrackedLockGuard &) = delete;
+
+  ~TrackedLockGuard() {
+    ContentionStats::recordHoldTime(_site, _start);
+    _mutex.unlock();
+  }
+
+ private:
+  Mutex& _mutex;
+  const ContentionSite _site;
+  ContentionStats::TimePoint _start;
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -30,6 +30,7 @@
 #include <hwloc.h>
 #include <mutex>
 #include <thread>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <random>
@@ -184,6 +185,12 @@ class HardwareTopology {
     return _numa_nodes[node].is_hyperthread(cpu_id);
   }
 
+  // ! True, if the CPU is not one of the most powerful cores of a hybrid architecture
+  bool is_efficiency_core(const int cpu_id) const {
+    ASSERT(cpu_id < (int)_is_efficiency_cpu.size());
+    return _is_efficiency_cpu[cpu_id];
+  }
+
   // ! Number of Cores on NUMA node
   int num_cores_on_numa_node(const int node) const {
     ASSERT(node < (int)_numa_nodes.size());
@@ -241,21 +248,39 @@ class HardwareTopology {
     return cpu_id;
   }
 
+  // ! Serializes the hardware topology in hwloc XML format, which can be
+  // ! passed to other processes to skip the discovery of the topology
+  std::string export_topology() const {
+    return HwTopology::export_xml(_topology);
+  }
+
   // ! Set membind policy to interleaved allocations on used NUMA nodes
   // ! covered by cpuset
   void activate_interleaved_membind_policy(hwloc_cpuset_t cpuset) const {
     hwloc_set_membind(_topology, cpuset, HWLOC_MEMBIND_INTERLEAVE, HWLOC_MEMBIND_MIGRATE);
   }
 
+  // ! Set membind policy to first-touch allocations, i.e., a page is placed
+  // ! on the NUMA node of the thread that first writes to it
+  void activate_first_touch_membind_policy(hwloc_cpuset_t cpuset) const {
+    hwloc_set_membind(_topology, cpuset, HWLOC_MEMBIND_FIRSTTOUCH, 0);
+  }
+
  private:
   HardwareTopology() :
     _num_cpus(0),
     _topology(),
     _numa_nodes(),
     _cpu_to_numa_node(std::thread::hardware_concurrency(),
-      std::numeric_limits<int>::max()) {
+      std::numeric_limits<int>::max()),
+    _is_efficiency_cpu(std::thread::hardware_concurrency(), false) {
     HwTopology::initialize(_topology);
     init_numa_nodes();
+    for ( const int cpu_id : HwTopology::get_efficiency_cpus(_topology) ) {
+      if ( cpu_id < (int)_is_efficiency_cpu.size() ) {
+        _is_efficiency_cpu[cpu_id] = true;
+      }
+    }
   }
 
   void init_numa_nodes() {
@@ -276,6 +301,7 @@ class HardwareTopology {
   Topology _topology;
   std::vector<NumaNode> _numa_nodes;
   std::vector<int> _cpu_to_numa_node;
+  std::vector<bool> _is_efficiency_cpu;
 };
 
 }  // namespace parallel
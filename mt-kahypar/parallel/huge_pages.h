@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#include <tbb/scalable_allocator.h>
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * Singleton that controls whether large allocations are backed by huge pages.
+ * Large arrays (e.g., the incidence array of the hypergraph, pin counts or the
+ * gain cache) are accessed randomly during refinement, which causes many TLB
+ * misses with 4KB pages. If activated, allocations of at least
+ * MIN_ALLOCATION_SIZE bytes are advised to be backed by transparent huge pages
+ * (madvise(MADV_HUGEPAGE)) and the TBB scalable allocator is allowed to use
+ * huge pages for its large object cache.
+ *
+ * Huge pages are a hint: if transparent huge pages are disabled on the system
+ * (or the platform does not support them), memory is backed by regular pages.
+ */
+class HugePages {
+
+ public:
+  // ! Size of a huge page on x86-64 and aarch64 (with 4KB base pages)
+  static constexpr size_t HUGE_PAGE_SIZE = static_cast<size_t>(2) * 1024 * 1024;
+  // ! Only allocations of at least this size are backed by huge pages
+  static constexpr size_t MIN_ALLOCATION_SIZE = 8 * HUGE_PAGE_SIZE;
+
+  HugePages(const HugePages&) = delete;
+  HugePages & operator= (const HugePages &) = delete;
+
+  HugePages(HugePages&&) = delete;
+  HugePages & operator= (HugePages &&) = delete;
+
+  static HugePages& instance() {
+    static HugePages instance;
+    return instance;
+  }
+
+  bool isActive() const {
+    return _is_active;
+  }
+
+  void activate() {
+    _is_active = true;
+    scalable_allocation_mode(TBBMALLOC_USE_HUGE_PAGES, 1);
+  }
+
+  void deactivate() {
+    _is_active = false;
+    scalable_allocation_mode(TBBMALLOC_USE_HUGE_PAGES, 0);
+  }
+
+  // ! Advises the operating system to back the memory region with huge pages.
+  // ! Must be called before the memory is touched for the first time. Only the
+  // ! huge page aligned part of the region is advised.
+  void advise(void* data, const size_t size_in_bytes) const {
+    #if defined(MADV_HUGEPAGE)
+    if ( _is_active && data && size_in_bytes >= MIN_ALLOCATION_SIZE ) {
+      const uintptr_t begin = reinterpret_cast<uintptr_t>(data);
+      const uintptr_t aligned_begin = (begin + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+      const uintptr_t aligned_end = (begin + size_in_bytes) & ~(HUGE_PAGE_SIZE - 1);
+      if ( aligned_begin < aligned_end ) {
+        // Failures are ignored (e.g., transparent huge pages are disabled)
+        madvise(reinterpret_cast<void*>(aligned_begin), aligned_end - aligned_begin, MADV_HUGEPAGE);
+      }
+    }
+    #else
+    (void) data;
+    (void) size_in_bytes;
+    #endif
+  }
+
+ private:
+  HugePages() :
+    _is_active(false) { }
+
+  bool _is_active;
+};
+
+}  // namespace parallel
+}  // namespace mt_kahypar
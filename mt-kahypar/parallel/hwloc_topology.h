@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include <hwloc.h>
@@ -44,7 +45,53 @@ class HwlocTopology {
  public:
   static void initialize(hwloc_topology_t& topology) {
     hwloc_topology_init(&topology);
+    const std::string& xml = xml_topology();
+    if ( !xml.empty() ) {
+      // Loading the topology from XML skips the (expensive) discovery of the
+      // topology. The flag allows to bind memory and threads with it.
+      hwloc_topology_set_xmlbuffer(topology, xml.c_str(), static_cast<int>(xml.size()) + 1);
+      hwloc_topology_set_flags(topology, HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM);
+    }
     hwloc_topology_load(topology);
+    is_initialized() = true;
+  }
+
+  // ! Uses the hardware topology in hwloc XML format (e.g., exported with
+  // ! export_xml(...) or 'lstopo topology.xml') instead of discovering the
+  // ! topology of the machine. Returns false, if the XML is invalid or if the
+  // ! topology was already initialized.
+  static bool set_xml(const std::string& xml) {
+    if ( is_initialized() ) {
+      return false;
+    }
+    hwloc_topology_t topology;
+    hwloc_topology_init(&topology);
+    const bool is_valid =
+      hwloc_topology_set_xmlbuffer(topology, xml.c_str(), static_cast<int>(xml.size()) + 1) == 0 &&
+      hwloc_topology_load(topology) == 0;
+    hwloc_topology_destroy(topology);
+    if ( is_valid ) {
+      xml_topology() = xml;
+    }
+    return is_valid;
+  }
+
+  // ! Serializes the topology in hwloc XML format
+  static std::string export_xml(hwloc_topology_t topology) {
+    char* buffer = nullptr;
+    int length = 0;
+    std::string xml;
+    #if HWLOC_API_VERSION >= 0x00020000
+    const int ret = hwloc_topology_export_xmlbuffer(topology, &buffer, &length, 0);
+    #else
+    const int ret = hwloc_topology_export_xmlbuffer(topology, &buffer, &length);
+    #endif
+    if ( ret == 0 && buffer ) {
+      // The length includes the terminating null character
+      xml.assign(buffer, length > 0 ? length - 1 : 0);
+      hwloc_free_xmlbuffer(topology, buffer);
+    }
+    return xml;
   }
 
   static hwloc_obj_t get_first_numa_node(hwloc_topology_t topology) {
@@ -118,11 +165,45 @@ class HwlocTopology {
     return cpus;
   }
 
+  // ! CPUs that do not belong to the most powerful CPU kind on hybrid
+  // ! architectures (e.g., E-cores). Requires hwloc 2.4 or newer.
+  static std::vector<int> get_efficiency_cpus(hwloc_topology_t topology) {
+    std::vector<int> cpus;
+    #if HWLOC_API_VERSION >= 0x00020400
+    const int num_kinds = hwloc_cpukinds_get_nr(topology, 0);
+    // CPU kinds are ordered by efficiency, i.e., the last kind is the most powerful one
+    hwloc_bitmap_t cpuset = hwloc_bitmap_alloc();
+    for ( int kind = 0; kind < num_kinds - 1; ++kind ) {
+      if ( hwloc_cpukinds_get_info(topology, kind, cpuset, nullptr, nullptr, nullptr, 0) == 0 ) {
+        int cpu_id;
+        hwloc_bitmap_foreach_begin(cpu_id, cpuset) {
+          cpus.push_back(cpu_id);
+        }
+        hwloc_bitmap_foreach_end();
+      }
+    }
+    hwloc_bitmap_free(cpuset);
+    #else
+    unused(topology);
+    #endif
+    return cpus;
+  }
+
   static void destroy_topology(hwloc_topology_t topology) {
     hwloc_topology_destroy(topology);
   }
 
  private:
+  static std::string& xml_topology() {
+    static std::string xml;
+    return xml;
+  }
+
+  static bool& is_initialized() {
+    static bool initialized = false;
+    return initialized;
+  }
+
   template <class F>
   static void enumerate_all_core_units(hwloc_obj_t node, F& func) {
     if (node->type == HWLOC_OBJ_CORE) {
@@ -27,8 +27,10 @@
 
 #pragma once
 
+#include <cstring>
 #include <mutex>
 #include <shared_mutex>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <atomic>
@@ -44,16 +46,45 @@
 #include <tbb/scalable_allocator.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/background_reclamation.h"
+#include "mt-kahypar/parallel/contention_stats.h"
+#include "mt-kahypar/parallel/huge_pages.h"
 #include "mt-kahypar/parallel/stl/scalable_unique_ptr.h"
+#include "mt-kahypar/parallel/stl/zero_allocator.h"
 #include "mt-kahypar/utils/memory_tree.h"
 
 namespace mt_kahypar {
 namespace parallel {
 
+/*!
+ * Handle of a registered memory chunk. A handle is resolved once from the
+ * (group, key) pair of the memory chunk and afterwards allows to request and
+ * release the memory chunk without string lookups and without locking the
+ * memory pool. Handles become invalid if the memory chunks are freed.
+ */
+struct MemoryChunkHandle {
+  static constexpr size_t kInvalidId = std::numeric_limits<size_t>::max();
+
+  bool exists() const {
+    return id != kInvalidId;
+  }
+
+  // ! Index of the memory chunk in the memory pool
+  size_t id = kInvalidId;
+  // ! Generation of the memory pool in which the handle was resolved
+  size_t generation = 0;
+};
+
 /*!
  * Singleton that handles huge memory allocations.
  * Memory chunks can be registered with a key and all memory
  * chunks can be collectively allocated in parallel.
+ *
+ * The memory pool only works if we partition one instance at a time.
+ * However, when using the library interface, it is possible that several
+ * instances are partitioned simultanously. Therefore, the memory pool is
+ * inactive by default in library mode and only serves requests while a
+ * partitioning session holds exclusive access to it.
  */
 class MemoryPoolT {
 
@@ -97,6 +128,7 @@ class MemoryPoolT {
       _used_size(size * num_elements),
       _total_size(size * num_elements),
       _data(nullptr),
+      _allocated_size(0),
       _next_memory_chunk_id(kInvalidMemoryChunk),
       _defer_allocation(false),
       _is_assigned(false) { }
@@ -109,9 +141,10 @@ class MemoryPoolT {
       _used_size(other._used_size),
       _total_size(other._total_size),
       _data(std::move(other._data)),
+      _allocated_size(other._allocated_size),
       _next_memory_chunk_id(other._next_memory_chunk_id),
       _defer_allocation(other._defer_allocation),
-      _is_assigned(other._is_assigned) {
+      _is_assigned(other._is_assigned.load()) {
       other._data = nullptr;
       other._next_memory_chunk_id = kInvalidMemoryChunk;
       other._defer_allocation = true;
@@ -122,9 +155,9 @@ class MemoryPoolT {
     // ! Note, successive calls to this method will return
     // ! nullptr until release_chunk() is called.
     char* request_chunk() {
-      std::lock_guard<std::mutex> lock(_chunk_mutex);
-      if ( _data && !_is_assigned ) {
-        _is_assigned = true;
+      bool expected = false;
+      if ( _data && _is_assigned.compare_exchange_strong(
+             expected, true, std::memory_order_acquire) ) {
         return _data;
       } else {
         return nullptr;
@@ -135,7 +168,7 @@ class MemoryPoolT {
       size_t aligned_used_size = align_with_page_size(_used_size, page_size);
       if ( _data && aligned_used_size < _total_size &&
             size <= _total_size - aligned_used_size ) {
-        std::lock_guard<std::mutex> lock(_chunk_mutex);
+        TrackedLockGuard<std::mutex> lock(_chunk_mutex, ContentionSite::memory_pool);
         // Double check
         aligned_used_size = align_with_page_size(_used_size, page_size);
         if ( _data && aligned_used_size < _total_size &&
@@ -150,15 +183,17 @@ class MemoryPoolT {
 
     // ! Releases the memory chunks
     void release_chunk() {
-      std::lock_guard<std::mutex> lock(_chunk_mutex);
-      _is_assigned = false;
+      _is_assigned.store(false, std::memory_order_release);
     }
 
     // ! Allocates the memory chunk
     // ! Note, the memory chunk is zero initialized.
     bool allocate() {
       if ( !_data && !_defer_allocation ) {
-        _data = (char*) scalable_calloc(_num_elements, _size);
+        // Large chunks are mapped from the operating system, which provides
+        // zeroed pages lazily (no fill pass and NUMA-local first touch)
+        _allocated_size = _num_elements * _size;
+        _data = static_cast<char*>(ZeroPages::allocate(_allocated_size));
         return true;
       } else {
         return false;
@@ -168,7 +203,7 @@ class MemoryPoolT {
     // ! Frees the memory chunk
     void free() {
       if ( _data ) {
-        scalable_free(_data);
+        ZeroPages::deallocate(_data, _allocated_size);
         _data = nullptr;
       }
     }
@@ -205,6 +240,8 @@ class MemoryPoolT {
     size_t _total_size;
     // ! Memory chunk
     char* _data;
+    // ! Size in bytes of the allocation _data points to
+    size_t _allocated_size;
     // ! Memory chunk id where this memory chunk is transfered
     // ! to if memory is not needed any more
     size_t _next_memory_chunk_id;
@@ -213,7 +250,7 @@ class MemoryPoolT {
     // ! to this memory chunk.
     bool _defer_allocation;
     // ! True, if already assigned to a vector
-    bool _is_assigned;
+    std::atomic<bool> _is_assigned;
   };
 
 
@@ -238,6 +275,24 @@ class MemoryPoolT {
     return _is_initialized;
   }
 
+  // ! Returns whether or not the memory pool serves memory requests
+  bool isActive() const {
+    return _is_active;
+  }
+
+  // ! Activates the memory pool. Note, the caller must guarantee that
+  // ! no other instance is partitioned while the memory pool is active.
+  void activate() {
+    _is_active = true;
+  }
+
+  // ! Deactivates the memory pool. Afterwards, all memory requests fail
+  // ! until the memory pool is activated again, but the registered memory
+  // ! chunks stay allocated.
+  void deactivate() {
+    _is_active = false;
+  }
+
   // ! Registers a memory group in the memory pool. A memory
   // ! group is associated with a stage. Assumption is that, if
   // ! a stage is completed, than memory is not needed any more
@@ -298,24 +353,45 @@ class MemoryPoolT {
                           const std::string& key,
                           const size_t num_elements,
                           const size_t size) {
-    const size_t size_in_bytes = num_elements * size;
-    DBG << "Requests memory chunk (" << group << "," << key << ")"
-        << "of" <<  size_in_megabyte(size_in_bytes) << "MB"
-        << "in memory pool";
-    if ( !_use_minimum_allocation_size || size_in_bytes > MINIMUM_ALLOCATION_SIZE ) {
-      std::shared_lock<std::shared_timed_mutex> lock(_memory_mutex);
-      MemoryChunk* chunk = find_memory_chunk(group, key);
+    return request_mem_chunk(memory_chunk_handle(group, key), num_elements, size);
+  }
 
+  // ! Returns the handle of the memory chunk registered under the
+  // ! corresponding group with the specified key. If the memory chunk
+  // ! does not exist, an invalid handle is returned.
+  MemoryChunkHandle memory_chunk_handle(const std::string& group,
+                                        const std::string& key) const {
+    std::shared_lock<std::shared_timed_mutex> lock(_memory_mutex);
+    MemoryChunkHandle handle;
+    auto it = _memory_groups.find(group);
+    if ( it != _memory_groups.end() && it->second.containsKey(key) ) {
+      handle.id = it->second.getKey(key);
+      handle.generation = _generation.load(std::memory_order_relaxed);
+    }
+    return handle;
+  }
+
+  // ! Same as request_mem_chunk(group, key, num_elements, size), but the memory
+  // ! chunk is acquired without locking the memory pool. Note, memory chunks must
+  // ! not be registered, allocated or freed concurrently to requests (which is
+  // ! guaranteed by the partitioning sessions of the library interface).
+  char* request_mem_chunk(const MemoryChunkHandle& handle,
+                          const size_t num_elements,
+                          const size_t size) {
+    const size_t size_in_bytes = num_elements * size;
+    DBG << "Requests memory chunk" << handle.id << "of"
+        << size_in_megabyte(size_in_bytes) << "MB in memory pool";
+    if ( _is_active && ( !_use_minimum_allocation_size || size_in_bytes > MINIMUM_ALLOCATION_SIZE ) ) {
+      MemoryChunk* chunk = find_memory_chunk(handle);
       if ( chunk && size_in_bytes <= chunk->size_in_bytes() ) {
         char* data = chunk->request_chunk();
         if ( data ) {
-          DBG << "Memory chunk request (" << group << "," << key << ")"
-              << "was successful";
+          DBG << "Memory chunk request" << handle.id << "was successful";
           return data;
         }
       }
     }
-    DBG << "Memory chunk request (" << group << "," << key << ") failed";
+    DBG << "Memory chunk request" << handle.id << "failed";
     return nullptr;
   }
 
@@ -325,7 +401,7 @@ class MemoryPoolT {
   char* request_unused_mem_chunk(const size_t num_elements,
                                  const size_t size,
                                  const bool align_with_page_size = true) {
-    if ( _is_initialized ) {
+    if ( _is_active && _is_initialized ) {
       DBG << "Request unused memory chunk of"
           << size_in_megabyte(num_elements * size) << "MB";
       const size_t size_in_bytes = num_elements * size;
@@ -364,8 +440,14 @@ class MemoryPoolT {
   // ! checks are performed, if chunk is already assigned.
   char* mem_chunk(const std::string& group,
                   const std::string& key) {
-    std::shared_lock<std::shared_timed_mutex> lock(_memory_mutex);
-    MemoryChunk* chunk = find_memory_chunk(group, key);
+    return mem_chunk(memory_chunk_handle(group, key));
+  }
+
+  char* mem_chunk(const MemoryChunkHandle& handle) {
+    if ( !_is_active ) {
+      return nullptr;
+    }
+    MemoryChunk* chunk = find_memory_chunk(handle);
     if ( chunk )   {
       return chunk->_data;
     } else {
@@ -378,10 +460,13 @@ class MemoryPoolT {
   // ! further requests.
   void release_mem_chunk(const std::string& group,
                          const std::string& key) {
-    std::shared_lock<std::shared_timed_mutex> lock(_memory_mutex);
-    MemoryChunk* chunk = find_memory_chunk(group, key);
+    release_mem_chunk(memory_chunk_handle(group, key));
+  }
+
+  void release_mem_chunk(const MemoryChunkHandle& handle) {
+    MemoryChunk* chunk = find_memory_chunk(handle);
     if ( chunk ) {
-      DBG << "Release memory chunk (" << group << "," << key << ")";
+      DBG << "Release memory chunk" << handle.id;
       chunk->release_chunk();
     }
   }
@@ -390,9 +475,11 @@ class MemoryPoolT {
   // ! required any more. If an optimized memory allocation strategy
   // ! was calculated before, the memory is passed to next group.
   void release_mem_group(const std::string& group) {
+    // Retired data structures might still hold memory chunks of the group
+    BackgroundReclamation::instance().waitUntilIdle();
     std::unique_lock<std::shared_timed_mutex> lock(_memory_mutex);
 
-    if ( _memory_groups.find(group) != _memory_groups.end() ) {
+    if ( _is_active && _memory_groups.find(group) != _memory_groups.end() ) {
       ASSERT([&] {
         for ( const auto& key : _memory_groups.at(group)._key_to_memory_id ) {
           const size_t memory_id = key.second;
@@ -414,6 +501,7 @@ class MemoryPoolT {
           ASSERT(lhs._next_memory_chunk_id < _memory_chunks.size());
           MemoryChunk& rhs = _memory_chunks[lhs._next_memory_chunk_id];
           rhs._data = lhs._data;
+          rhs._allocated_size = lhs._allocated_size;
           lhs._data = nullptr;
         } else {
           // Memory chunk is not required any more
@@ -428,7 +516,11 @@ class MemoryPoolT {
 
   // Resets the memory pool to the state after all memory chunks are allocated
   void reset() {
+    BackgroundReclamation::instance().waitUntilIdle();
     std::unique_lock<std::shared_timed_mutex> lock(_memory_mutex);
+    if ( !_is_active ) {
+      return;
+    }
 
     // Find all root memory chunks of an optimization path
     std::vector<size_t> in_degree(_memory_chunks.size(), 0);
@@ -449,6 +541,7 @@ class MemoryPoolT {
         ASSERT(_memory_chunks[current_mem_chunk]._data);
         ASSERT(i != current_mem_chunk);
         _memory_chunks[i]._data = _memory_chunks[current_mem_chunk]._data;
+        _memory_chunks[i]._allocated_size = _memory_chunks[current_mem_chunk]._allocated_size;
         _memory_chunks[current_mem_chunk]._data = nullptr;
       }
 
@@ -462,15 +555,20 @@ class MemoryPoolT {
 
   // ! Frees all memory chunks in parallel
   void free_memory_chunks() {
+    BackgroundReclamation::instance().waitUntilIdle();
     std::unique_lock<std::shared_timed_mutex> lock(_memory_mutex);
     const size_t num_memory_segments = _memory_chunks.size();
-    tbb::parallel_for(UL(0), num_memory_segments, [&](const size_t i) {
-      _memory_chunks[i].free();
-    });
+    if ( num_memory_segments > 0 ) {
+      tbb::parallel_for(UL(0), num_memory_segments, [&](const size_t i) {
+        _memory_chunks[i].free();
+      });
+    }
     _memory_chunks.clear();
     _memory_groups.clear();
     _active_memory_chunks.clear();
     _is_initialized = false;
+    // Invalidates all handles
+    ++_generation;
   }
 
   // ! Only for testing
@@ -478,7 +576,12 @@ class MemoryPoolT {
     _use_round_robin_assignment = false;
   }
 
-  // ! Only for testing
+  // ! Memory chunks smaller than the minimum allocation size are only
+  // ! served if they are reused across several partitioning calls
+  void activate_minimum_allocation_size() {
+    _use_minimum_allocation_size = true;
+  }
+
   void deactivate_minimum_allocation_size() {
     _use_minimum_allocation_size = false;
   }
@@ -499,8 +602,11 @@ class MemoryPoolT {
   // ! corresponding group with the specified key.
   size_t size_in_bytes(const std::string& group,
                        const std::string& key) {
-    std::shared_lock<std::shared_timed_mutex> lock(_memory_mutex);
-    MemoryChunk* chunk = find_memory_chunk(group, key);
+    return size_in_bytes(memory_chunk_handle(group, key));
+  }
+
+  size_t size_in_bytes(const MemoryChunkHandle& handle) {
+    MemoryChunk* chunk = find_memory_chunk(handle);
     if ( chunk )   {
       return chunk->size_in_bytes();
     } else {
@@ -584,9 +690,15 @@ class MemoryPoolT {
   explicit MemoryPoolT() :
     _memory_mutex(),
     _is_initialized(false),
+    #ifdef MT_KAHYPAR_LIBRARY_MODE
+    _is_active(false),
+    #else
+    _is_active(true),
+    #endif
     _page_size(0),
     _memory_groups(),
     _memory_chunks(),
+    _generation(0),
     _next_active_memory_chunk(0),
     _active_memory_chunks(),
     _use_round_robin_assignment(true),
@@ -601,16 +713,13 @@ class MemoryPoolT {
     #endif
   }
 
-  // ! Returns a pointer to memory chunk under the corresponding group with
-  // ! the specified key.
-  MemoryChunk* find_memory_chunk(const std::string& group,
-                                 const std::string& key) {
-
-    if ( _memory_groups.find(group) != _memory_groups.end() &&
-         _memory_groups.at(group).containsKey(key) ) {
-      const size_t memory_id = _memory_groups.at(group).getKey(key);
-      ASSERT(memory_id < _memory_chunks.size());
-      return &_memory_chunks[memory_id];
+  // ! Returns a pointer to the memory chunk referenced by the handle or
+  // ! nullptr, if the handle is invalid or outdated.
+  MemoryChunk* find_memory_chunk(const MemoryChunkHandle& handle) {
+    if ( handle.exists() &&
+         handle.generation == _generation.load(std::memory_order_relaxed) ) {
+      ASSERT(handle.id < _memory_chunks.size());
+      return &_memory_chunks[handle.id];
     }
     return nullptr;
   }
@@ -733,6 +842,8 @@ class MemoryPoolT {
   mutable std::shared_timed_mutex _memory_mutex;
   // ! Initialize Flag
   bool _is_initialized;
+  // ! If false, all memory requests fail
+  bool _is_active;
   // ! Page size of the system
   size_t _page_size;
   // ! Mapping from group-key to a memory chunk id
@@ -740,6 +851,8 @@ class MemoryPoolT {
   std::unordered_map<std::string, MemoryGroup> _memory_groups;
   // ! Memory chunks
   std::vector<MemoryChunk> _memory_chunks;
+  // ! Incremented whenever the memory chunks are freed to invalidate all handles
+  std::atomic<size_t> _generation;
   // ! Next active memory chunk for unused memory allocation (round-robin fashion)
   std::atomic<size_t> _next_active_memory_chunk;
   // ! Active memory chunks (with allocated memory)
@@ -750,99 +863,7 @@ class MemoryPoolT {
   bool _use_unused_memory_chunks;
 };
 
-/**
- * Currently, the memory pool only works if we partition one instance at a time.
- * However, when using the library interface, it is possible that several
- * instances are partitioned simultanously. Therefore, we disable the memory
- * pool in case we compile the library interface.
- */
-class DoNothingMemoryPool {
-
- public:
-  DoNothingMemoryPool(const DoNothingMemoryPool&) = delete;
-  DoNothingMemoryPool & operator= (const DoNothingMemoryPool &) = delete;
-
-  DoNothingMemoryPool(DoNothingMemoryPool&&) = delete;
-  DoNothingMemoryPool & operator= (DoNothingMemoryPool &&) = delete;
-
-  static DoNothingMemoryPool& instance() {
-    static DoNothingMemoryPool instance;
-    return instance;
-  }
-
-  bool isInitialized() const {
-    return true;
-  }
-
-  void register_memory_group(const std::string&,
-                             const size_t) { }
-
-  void register_memory_chunk(const std::string&,
-                             const std::string&,
-                             const size_t,
-                             const size_t) { }
-
-  void allocate_memory_chunks() { }
-  void allocate_memory_chunks(const bool) { }
-
-  char* request_mem_chunk(const std::string&,
-                          const std::string&,
-                          const size_t,
-                          const size_t) {
-    return nullptr;
-  }
-
-  char* request_unused_mem_chunk(const size_t,
-                                 const size_t) {
-    return nullptr;
-  }
-  char* request_unused_mem_chunk(const size_t,
-                                 const size_t,
-                                 const bool) {
-    return nullptr;
-  }
-
-  char* mem_chunk(const std::string&,
-                  const std::string&) {
-    return nullptr;
-  }
-  void release_mem_chunk(const std::string&,
-                         const std::string&) { }
-
-  void release_mem_group(const std::string&) { }
-
-  void reset() { }
-
-  void free_memory_chunks() {}
-
-  // ! Only for testing
-  void deactivate_round_robin_assignment() { }
-
-  // ! Only for testing
-  void deactivate_minimum_allocation_size() { }
-
-  void activate_unused_memory_allocations() { }
-
-  void deactivate_unused_memory_allocations() { }
-
-  size_t size_in_bytes(const std::string&,
-                       const std::string&) {
-    return 0;
-  }
-
-  void memory_consumption(utils::MemoryTreeNode*) const { }
-
-  void explain_optimizations() const { }
-
- private:
-  DoNothingMemoryPool() { }
-};
-
-#ifdef MT_KAHYPAR_LIBRARY_MODE
-using MemoryPool = DoNothingMemoryPool;
-#else
 using MemoryPool = MemoryPoolT;
-#endif
 
 }  // namespace parallel
 }  // namespace mt_kahypar
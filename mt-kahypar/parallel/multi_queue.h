@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <tbb/parallel_for_each.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/memory_tree.h"
+#include "mt-kahypar/utils/randomize.h"
+
+namespace mt_kahypar {
+
+/**
+ * Relaxed concurrent priority queue (MultiQueue) that returns elements
+ * with a high key first. It consists of several sequential binary heaps,
+ * each protected by its own spin lock. A pop operation samples two heaps
+ * at random and removes the top element of the one with the larger top key.
+ * Hence, the elements are not extracted in strict priority order, but
+ * threads rarely compete for the same lock.
+ *
+ * Usage follows the WorkContainer: elements are inserted with safe_push(...)
+ * while no thread pops, then build() establishes the heap property and
+ * afterwards try_pop(...) can be called concurrently.
+ */
+template<typename T, typename Key>
+class MultiQueue {
+
+  static constexpr Key EMPTY = std::numeric_limits<Key>::min();
+  static constexpr size_t NUM_POP_ATTEMPTS = 8;
+
+  struct Element {
+    Key key;
+    T value;
+
+    bool operator<(const Element& other) const {
+      return key < other.key;
+    }
+  };
+
+  struct alignas(64) Queue {
+    Queue() :
+      lock(),
+      elements(),
+      top_key(EMPTY) { }
+
+    Queue(const Queue& other) :
+      lock(),
+      elements(other.elements),
+      top_key(other.top_key.load(std::memory_order_relaxed)) { }
+
+    void updateTopKey() {
+      top_key.store(elements.empty() ? EMPTY : elements.front().key, std::memory_order_relaxed);
+    }
+
+    SpinLock lock;
+    vec<Element> elements;
+    CAtomic<Key> top_key;
+  };
+
+ public:
+  // ! Number of heaps per thread
+  static constexpr size_t QUEUES_PER_THREAD = 2;
+
+  explicit MultiQueue(const size_t num_threads = 0) :
+    _queues(QUEUES_PER_THREAD * num_threads) { }
+
+  void resize(const size_t num_threads) {
+    _queues.resize(QUEUES_PER_THREAD * num_threads);
+  }
+
+  size_t unsafe_size() const {
+    size_t sz = 0;
+    for ( const Queue& q : _queues ) {
+      sz += q.elements.size();
+    }
+    return sz;
+  }
+
+  // ! Assumes that no thread is currently calling try_pop and
+  // ! that build() is called before the first pop
+  void safe_push(const T el, const Key key, const size_t thread_id) {
+    ASSERT(QUEUES_PER_THREAD * thread_id < _queues.size());
+    ASSERT(key != EMPTY);
+    // Each thread only pushes into its own heaps, which are used alternately
+    Queue& q = _queues[QUEUES_PER_THREAD * thread_id + (q_size(thread_id) % QUEUES_PER_THREAD)];
+    q.elements.push_back(Element { key, el });
+  }
+
+  // ! Randomizes the order of elements with equal keys
+  void shuffle() {
+    tbb::parallel_for_each(_queues, [&](Queue& q) {
+      utils::Randomize::instance().shuffleVector(q.elements);
+    });
+  }
+
+  // ! Establishes the heap property, must be called after the last safe_push
+  void build() {
+    tbb::parallel_for_each(_queues, [&](Queue& q) {
+      std::make_heap(q.elements.begin(), q.elements.end());
+      q.updateTopKey();
+    });
+  }
+
+  bool try_pop(T& dest, const size_t thread_id) {
+    ASSERT(QUEUES_PER_THREAD * thread_id < _queues.size());
+    const int num_queues = static_cast<int>(_queues.size());
+    for ( size_t i = 0; i < NUM_POP_ATTEMPTS; ++i ) {
+      const int q1 = utils::Randomize::instance().getRandomInt(0, num_queues - 1, thread_id);
+      const int q2 = utils::Randomize::instance().getRandomInt(0, num_queues - 1, thread_id);
+      const Key k1 = _queues[q1].top_key.load(std::memory_order_relaxed);
+      const Key k2 = _queues[q2].top_key.load(std::memory_order_relaxed);
+      if ( k1 == EMPTY && k2 == EMPTY ) {
+        break;
+      }
+      if ( try_pop_from(_queues[k1 >= k2 ? q1 : q2], dest) ) {
+        return true;
+      }
+    }
+    // The sampled heaps are empty or contended => scan all heaps
+    for ( int i = 0; i < num_queues; ++i ) {
+      Queue& q = _queues[(thread_id + i) % num_queues];
+      if ( q.top_key.load(std::memory_order_relaxed) != EMPTY ) {
+        q.lock.lock();
+        const bool success = pop_locked(q, dest);
+        q.lock.unlock();
+        if ( success ) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  void clear() {
+    for ( Queue& q : _queues ) {
+      q.elements.clear();
+      q.updateTopKey();
+    }
+  }
+
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    ASSERT(parent);
+
+    utils::MemoryTreeNode* multi_queue_node = parent->addChild("Multi Queue");
+    for ( const Queue& q : _queues ) {
+      multi_queue_node->updateSize(q.elements.capacity() * sizeof(Element));
+    }
+  }
+
+ private:
+  size_t q_size(const size_t thread_id) const {
+    size_t sz = 0;
+    for ( size_t i = 0; i < QUEUES_PER_THREAD; ++i ) {
+      sz += _queues[QUEUES_PER_THREAD * thread_id + i].elements.size();
+    }
+    return sz;
+  }
+
+  bool try_pop_from(Queue& q, T& dest) {
+    if ( q.lock.tryLock() ) {
+      const bool success = pop_locked(q, dest);
+      q.lock.unlock();
+      return success;
+    }
+    return false;
+  }
+
+  bool pop_locked(Queue& q, T& dest) {
+    if ( q.elements.empty() ) {
+      return false;
+    }
+    std::pop_heap(q.elements.begin(), q.elements.end());
+    dest = q.elements.back().value;
+    q.elements.pop_back();
+    q.updateTopKey();
+    return true;
+  }
+
+  vec<Queue> _queues;
+};
+
+}  // namespace mt_kahypar
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
+namespace mt_kahypar {
+namespace parallel {
+
+/**
+ * Helpers for NUMA-aware memory placement.
+ *
+ * With the first-touch policy, the operating system places a page on the NUMA
+ * node of the thread that writes to it first. TBBInitializer pins thread slots
+ * in increasing order of NUMA nodes. Hence, if an array is initialized with a
+ * static assignment of contiguous index ranges to thread slots, consecutive
+ * index ranges reside on the NUMA node of the threads that initialized them.
+ * Loops that later use the same static assignment (e.g., label propagation
+ * with --s-numa-aware-placement=true) then mostly read node-local memory.
+ *
+ * Note that the static assignment is only reproducible across calls if the
+ * loop is invoked from the same thread slot (usually the main thread).
+ */
+
+// ! Calls f(start, end) for contiguous subranges of [begin, end) with a
+// ! static (deterministic) assignment of subranges to thread slots
+template<typename IndexType, typename F>
+void static_parallel_for_ranges(const IndexType begin, const IndexType end, const F& f) {
+  if ( begin < end ) {
+    tbb::parallel_for(tbb::blocked_range<IndexType>(begin, end),
+      [&](const tbb::blocked_range<IndexType>& range) {
+        f(range.begin(), range.end());
+      }, tbb::static_partitioner());
+  }
+}
+
+// ! Calls f(i) for each i in [begin, end) with a static (deterministic)
+// ! assignment of contiguous index ranges to thread slots
+template<typename IndexType, typename F>
+void static_parallel_for(const IndexType begin, const IndexType end, const F& f) {
+  static_parallel_for_ranges(begin, end, [&](const IndexType start, const IndexType stop) {
+    for ( IndexType i = start; i < stop; ++i ) {
+      f(i);
+    }
+  });
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
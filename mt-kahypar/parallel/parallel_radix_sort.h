@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/chunking.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar::parallel {
+
+/*!
+ * Parallel radix sort for elements with unsigned integer keys. The sorter keeps its
+ * buffers such that repeated calls (e.g., once per coarsening level) do not allocate
+ * new bucket and swap arrays.
+ *
+ * Keys with up to 32 bits are sorted with a stable LSD radix sort that only processes
+ * the digits up to the highest set bit of the keys. Keys with 64 bits (e.g., hashes) are
+ * distributed by their most significant digit and the resulting buckets are sorted
+ * independently in parallel, which saves the passes over the mostly random low-order bits.
+ *
+ * Note, a sorter must not be used concurrently.
+ */
+template<typename T>
+class ParallelRadixSorter {
+
+  static constexpr size_t RADIX_BITS = 8;
+  static constexpr size_t NUM_BUCKETS = UL(1) << RADIX_BITS;
+  // ! Ranges below this size are sorted sequentially with std::sort
+  static constexpr size_t SEQUENTIAL_SORT_THRESHOLD = UL(1) << 14;
+  // ! Minimum number of elements processed by a task of a radix pass
+  static constexpr size_t MIN_CHUNK_SIZE = UL(1) << 13;
+
+ public:
+  ParallelRadixSorter() :
+    _buffer(),
+    _bucket_offsets(),
+    _bucket_begin(NUM_BUCKETS + 1, 0) { }
+
+  ParallelRadixSorter(const ParallelRadixSorter&) = delete;
+  ParallelRadixSorter & operator= (const ParallelRadixSorter &) = delete;
+
+  ParallelRadixSorter(ParallelRadixSorter&&) = default;
+  ParallelRadixSorter & operator= (ParallelRadixSorter &&) = default;
+
+  // ! Sorts the range [begin, end) in increasing order of get_key(element)
+  template<typename KeyFunc>
+  void sort(T* begin, T* end, const KeyFunc& get_key) {
+    using Key = std::decay_t<decltype(get_key(*begin))>;
+    static_assert(std::is_unsigned_v<Key>, "Radix sort requires unsigned integer keys");
+    const auto cmp = [&](const T& lhs, const T& rhs) {
+      return get_key(lhs) < get_key(rhs);
+    };
+
+    const size_t n = end - begin;
+    if ( n < SEQUENTIAL_SORT_THRESHOLD ) {
+      std::sort(begin, end, cmp);
+      return;
+    }
+
+    const Key key_bits = tbb::parallel_reduce(tbb::blocked_range<size_t>(UL(0), n), Key(0),
+      [&](const tbb::blocked_range<size_t>& range, Key bits) {
+        for ( size_t i = range.begin(); i < range.end(); ++i ) {
+          bits |= get_key(begin[i]);
+        }
+        return bits;
+      }, [](const Key lhs, const Key rhs) {
+        return lhs | rhs;
+      });
+    size_t num_bits = 0;
+    while ( num_bits < sizeof(Key) * 8 && ( key_bits >> num_bits ) != 0 ) {
+      ++num_bits;
+    }
+    if ( num_bits == 0 ) {
+      // All keys are zero
+      return;
+    }
+
+    if ( _buffer.size() < n ) {
+      _buffer.resize(n);
+    }
+    T* buffer = _buffer.data();
+
+    if constexpr ( sizeof(Key) <= 4 ) {
+      // LSD radix sort
+      T* src = begin;
+      T* dst = buffer;
+      for ( size_t shift = 0; shift < num_bits; shift += RADIX_BITS ) {
+        distribute(src, dst, n, [&](const T& element) {
+          return static_cast<size_t>(get_key(element) >> shift) & ( NUM_BUCKETS - 1 );
+        });
+        std::swap(src, dst);
+      }
+      if ( src != begin ) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(UL(0), n),
+          [&](const tbb::blocked_range<size_t>& range) {
+          std::copy(buffer + range.begin(), buffer + range.end(), begin + range.begin());
+        });
+      }
+    } else {
+      // MSD radix sort: distribute by the most significant digit and sort each bucket
+      const size_t shift = num_bits > RADIX_BITS ? num_bits - RADIX_BITS : 0;
+      distribute(begin, buffer, n, [&](const T& element) {
+        return static_cast<size_t>(get_key(element) >> shift) & ( NUM_BUCKETS - 1 );
+      });
+      tbb::parallel_for(UL(0), NUM_BUCKETS, [&](const size_t bucket) {
+        T* bucket_begin = buffer + _bucket_begin[bucket];
+        T* bucket_end = buffer + _bucket_begin[bucket + 1];
+        std::sort(bucket_begin, bucket_end, cmp);
+        std::copy(bucket_begin, bucket_end, begin + _bucket_begin[bucket]);
+      });
+    }
+  }
+
+  void freeInternalData() {
+    parallel::parallel_free(_buffer, _bucket_offsets);
+  }
+
+ private:
+  // ! Stable distribution of the elements of src into dst by the digit returned by get_digit
+  template<typename DigitFunc>
+  void distribute(const T* src, T* dst, const size_t n, const DigitFunc& get_digit) {
+    const size_t num_tasks = std::max(UL(1), std::min(
+      static_cast<size_t>(tbb::this_task_arena::max_concurrency()),
+      chunking::idiv_ceil(n, MIN_CHUNK_SIZE)));
+    const size_t chunk_size = chunking::idiv_ceil(n, num_tasks);
+    _bucket_offsets.assign(num_tasks * NUM_BUCKETS, 0);
+
+    // Count the elements of each digit per task
+    tbb::parallel_for(UL(0), num_tasks, [&](const size_t task) {
+      size_t* counts = _bucket_offsets.data() + task * NUM_BUCKETS;
+      for ( auto [i, last] = chunking::bounds(task, n, chunk_size); i < last; ++i ) {
+        ++counts[get_digit(src[i])];
+      }
+    });
+
+    // Exclusive prefix sum in bucket-major order yields the first write position
+    // of each task in each bucket
+    size_t sum = 0;
+    for ( size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket ) {
+      _bucket_begin[bucket] = sum;
+      for ( size_t task = 0; task < num_tasks; ++task ) {
+        size_t& offset = _bucket_offsets[task * NUM_BUCKETS + bucket];
+        const size_t count = offset;
+        offset = sum;
+        sum += count;
+      }
+    }
+    _bucket_begin[NUM_BUCKETS] = sum;
+    ASSERT(sum == n);
+
+    // Scatter elements
+    tbb::parallel_for(UL(0), num_tasks, [&](const size_t task) {
+      size_t* offsets = _bucket_offsets.data() + task * NUM_BUCKETS;
+      for ( auto [i, last] = chunking::bounds(task, n, chunk_size); i < last; ++i ) {
+        dst[offsets[get_digit(src[i])]++] = src[i];
+      }
+    });
+  }
+
+  vec<T> _buffer;
+  vec<size_t> _bucket_offsets;
+  vec<size_t> _bucket_begin;
+};
+
+}  // namespace mt_kahypar::parallel
@@ -26,11 +26,95 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#include <tbb/scalable_allocator.h>
 #include <tbb/tbb_allocator.h>
 
+#include "mt-kahypar/parallel/huge_pages.h"
+
 namespace mt_kahypar {
 namespace parallel {
 
+/*!
+ * Zero-initialized memory for large arrays. Anonymous memory mappings are backed by
+ * the shared zero page until they are written for the first time. Thus, large
+ * zero-initialized arrays do not need an explicit fill pass and each page is placed on
+ * the NUMA node of the thread that writes to it first. Smaller allocations are served
+ * by the TBB scalable allocator.
+ */
+class ZeroPages {
+ public:
+  // ! Only allocations of at least this size are mapped from the operating system
+  static constexpr size_t MIN_ALLOCATION_SIZE = static_cast<size_t>(1) << 20;
+
+  static bool isMapped(const size_t size_in_bytes) {
+    #ifndef _WIN32
+    return size_in_bytes >= MIN_ALLOCATION_SIZE;
+    #else
+    (void) size_in_bytes;
+    return false;
+    #endif
+  }
+
+  // ! Returns zero-initialized memory or nullptr, if the allocation fails
+  static void* allocate(const size_t size_in_bytes) {
+    #ifndef _WIN32
+    if ( isMapped(size_in_bytes) ) {
+      void* data = mmap(nullptr, size_in_bytes, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if ( data == MAP_FAILED ) {
+        return nullptr;
+      }
+      HugePages::instance().advise(data, size_in_bytes);
+      return data;
+    }
+    #endif
+    return scalable_calloc(1, size_in_bytes);
+  }
+
+  // ! Releases memory obtained via allocate(size_in_bytes)
+  static void deallocate(void* data, const size_t size_in_bytes) {
+    if ( data ) {
+      #ifndef _WIN32
+      if ( isMapped(size_in_bytes) ) {
+        munmap(data, size_in_bytes);
+        return;
+      }
+      #endif
+      scalable_free(data);
+    }
+  }
+};
+
+template<typename T>
+struct zero_pages_deleter {
+  size_t size_in_bytes = 0;
+
+  void operator()(T* data) const {
+    ZeroPages::deallocate(data, size_in_bytes);
+  }
+};
+
+template<typename T>
+using zero_unique_ptr = std::unique_ptr<T[], zero_pages_deleter<T>>;
+
+// ! Allocates a zero-initialized array of the given size (see ZeroPages)
+template<typename T>
+zero_unique_ptr<T> make_zero_unique(const size_t size) {
+  void* data = ZeroPages::allocate(sizeof(T) * size);
+  if ( !data && size > 0 ) {
+    throw std::bad_alloc();
+  }
+  return zero_unique_ptr<T>(static_cast<T*>(data), zero_pages_deleter<T> { sizeof(T) * size });
+}
+
 template <typename T>
 class zero_allocator : public tbb::tbb_allocator<T> {
  public:
@@ -43,10 +127,16 @@ class zero_allocator : public tbb::tbb_allocator<T> {
   explicit zero_allocator(const U&) noexcept {}
 
   T* allocate(std::size_t n) {
-    T* ptr = tbb::tbb_allocator<T>::allocate(n);
-    std::memset(static_cast<void*>(ptr), 0, n * sizeof(value_type));
+    T* ptr = static_cast<T*>(ZeroPages::allocate(n * sizeof(value_type)));
+    if ( !ptr ) {
+      throw std::bad_alloc();
+    }
     return ptr;
   }
+
+  void deallocate(T* ptr, std::size_t n) {
+    ZeroPages::deallocate(ptr, n * sizeof(value_type));
+  }
 };
 
 }  // namespace parallel
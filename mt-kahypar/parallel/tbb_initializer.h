@@ -31,8 +31,10 @@
   #include <hwloc.h>
 #endif
 
+#include <algorithm>
 #include <mutex>
 #include <memory>
+#include <tuple>
 #include <shared_mutex>
 #include <functional>
 
@@ -69,8 +71,12 @@ class TBBInitializer {
   TBBInitializer(TBBInitializer&&) = delete;
   TBBInitializer & operator= (TBBInitializer &&) = delete;
 
-  static TBBInitializer& instance(const size_t num_threads = std::thread::hardware_concurrency()) {
-    static TBBInitializer instance(num_threads);
+  // ! If global_thread_control is false, the library runs inside the task arenas of the caller,
+  // ! i.e., neither the TBB parallelism of the process is limited nor threads are pinned to CPUs.
+  // ! Only the first call determines the configuration.
+  static TBBInitializer& instance(const size_t num_threads = std::thread::hardware_concurrency(),
+                                  const bool global_thread_control = true) {
+    static TBBInitializer instance(num_threads, global_thread_control);
     return instance;
   }
 
@@ -78,6 +84,10 @@ class TBBInitializer {
     return _num_threads;
   }
 
+  bool uses_global_thread_control() const {
+    return _gc != nullptr;
+  }
+
   int number_of_used_cpus_on_numa_node(const int node) const {
     ASSERT(static_cast<size_t>(node) < _numa_node_to_cpu_id.size());
     return _numa_node_to_cpu_id[node].size();
@@ -97,6 +107,30 @@ class TBBInitializer {
     return cpuset;
   }
 
+  // ! Number of used CPUs that are neither hyperthreads nor efficiency cores
+  int num_used_performance_cores() const {
+    HwTopology& topology = HwTopology::instance();
+    return std::count_if(_cpus.begin(), _cpus.end(), [&](const int cpu_id) {
+      return !topology.is_hyperthread(cpu_id) && !topology.is_efficiency_core(cpu_id);
+    });
+  }
+
+  // ! Executes f in a separate task arena with num_threads threads. If we control
+  // ! the threads of the process, they are pinned to the first num_threads used
+  // ! CPUs, i.e., physical performance cores are preferred over other CPUs.
+  template<typename F>
+  void execute_with_threads(const int num_threads, F&& f) {
+    ASSERT(num_threads > 0 && num_threads <= _num_threads);
+    tbb::task_arena arena(num_threads);
+    std::unique_ptr<ThreadPinningObserver> observer(nullptr);
+    if ( _global_observer ) {
+      std::vector<int> cpus(_cpus.begin(), _cpus.begin() + num_threads);
+      observer = std::make_unique<ThreadPinningObserver>(
+        arena, HwTopology::instance().numa_node_of_cpu(cpus[0]), cpus);
+    }
+    arena.execute(f);
+  }
+
   void terminate() {
     if ( _global_observer ) {
       _global_observer->observe(false);
@@ -104,9 +138,10 @@ class TBBInitializer {
   }
 
  private:
-  explicit TBBInitializer(const int num_threads) :
+  TBBInitializer(const int num_threads, const bool global_thread_control) :
     _num_threads(num_threads),
-    _gc(tbb::global_control::max_allowed_parallelism, num_threads),
+    _gc(global_thread_control ? std::make_unique<tbb::global_control>(
+      tbb::global_control::max_allowed_parallelism, num_threads) : nullptr),
     _global_observer(nullptr),
     _cpus(),
     _numa_node_to_cpu_id() {
@@ -116,24 +151,24 @@ class TBBInitializer {
     _cpus = topology.get_all_cpus();
     // Sort cpus in the following order
     // 1.) Non-hyperthread first
-    // 2.) Increasing order of numa node
-    // 3.) Increasing order of cpu id
+    // 2.) Performance cores before efficiency cores (hybrid architectures)
+    // 3.) Increasing order of numa node
+    // 4.) Increasing order of cpu id
     // ...
     std::sort(_cpus.begin(), _cpus.end(),
               [&](const int& lhs, const int& rhs) {
-          int node_lhs = topology.numa_node_of_cpu(lhs);
-          int node_rhs = topology.numa_node_of_cpu(rhs);
-          bool is_hyperthread_lhs = topology.is_hyperthread(lhs);
-          bool is_hyperthread_rhs = topology.is_hyperthread(rhs);
-          return is_hyperthread_lhs < is_hyperthread_rhs ||
-          (is_hyperthread_lhs == is_hyperthread_rhs && node_lhs < node_rhs) ||
-          (is_hyperthread_lhs == is_hyperthread_rhs && node_lhs == node_rhs && lhs < rhs);
+          return std::make_tuple(topology.is_hyperthread(lhs), topology.is_efficiency_core(lhs),
+                                 topology.numa_node_of_cpu(lhs), lhs) <
+                 std::make_tuple(topology.is_hyperthread(rhs), topology.is_efficiency_core(rhs),
+                                 topology.numa_node_of_cpu(rhs), rhs);
         });
     // ... this ensure that we first pop nodes in hyperthreading
     while (static_cast<int>(_cpus.size()) > _num_threads) {
       _cpus.pop_back();
     }
-    _global_observer = std::make_unique<ThreadPinningObserver>(_cpus);
+    if ( global_thread_control ) {
+      _global_observer = std::make_unique<ThreadPinningObserver>(_cpus);
+    }
 
     _numa_node_to_cpu_id.resize(num_numa_nodes);
     for ( const int cpu_id : _cpus ) {
@@ -147,7 +182,7 @@ class TBBInitializer {
   }
 
   int _num_threads;
-  tbb::global_control _gc;
+  std::unique_ptr<tbb::global_control> _gc;
   std::unique_ptr<ThreadPinningObserver> _global_observer;
   std::vector<int> _cpus;
   std::vector<std::vector<int>> _numa_node_to_cpu_id;
@@ -166,8 +201,9 @@ class SimpleTBBInitializer {
   SimpleTBBInitializer(SimpleTBBInitializer&&) = delete;
   SimpleTBBInitializer & operator= (SimpleTBBInitializer &&) = delete;
 
-  static SimpleTBBInitializer& instance(const size_t num_threads = std::thread::hardware_concurrency()) {
-    static SimpleTBBInitializer instance(num_threads);
+  static SimpleTBBInitializer& instance(const size_t num_threads = std::thread::hardware_concurrency(),
+                                        const bool global_thread_control = true) {
+    static SimpleTBBInitializer instance(num_threads, global_thread_control);
     return instance;
   }
 
@@ -179,15 +215,32 @@ class SimpleTBBInitializer {
     return _num_threads;
   }
 
+  bool uses_global_thread_control() const {
+    return _gc != nullptr;
+  }
+
+  int num_used_performance_cores() const {
+    return _num_threads;
+  }
+
+  // ! Executes f in a separate task arena with num_threads threads
+  template<typename F>
+  void execute_with_threads(const int num_threads, F&& f) {
+    ASSERT(num_threads > 0 && num_threads <= _num_threads);
+    tbb::task_arena arena(num_threads);
+    arena.execute(f);
+  }
+
   void terminate() { }
 
  private:
-  explicit SimpleTBBInitializer(const int num_threads) :
+  SimpleTBBInitializer(const int num_threads, const bool global_thread_control) :
     _num_threads(num_threads),
-    _gc(tbb::global_control::max_allowed_parallelism, num_threads) { }
+    _gc(global_thread_control ? std::make_unique<tbb::global_control>(
+      tbb::global_control::max_allowed_parallelism, num_threads) : nullptr) { }
 
   int _num_threads;
-  tbb::global_control _gc;
+  std::unique_ptr<tbb::global_control> _gc;
 };
 #endif
 
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/chunking.h"
+#include "mt-kahypar/parallel/contention_stats.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+/**
+ * Loops over node ranges, where the work per element is proportional to a weight
+ * (usually the degree of the node).
+ *
+ * TBB splits ranges by the number of elements. On hypergraphs with a skewed degree
+ * distribution, a few chunks then contain most of the pins and their threads become
+ * stragglers at the end of the loop. Here, the range is split into chunks of roughly
+ * equal total weight (weight + 1 per element) based on a prefix sum over the weights.
+ *
+ * If contention statistics are enabled, the time spent in the chunks is recorded as busy time.
+ */
+
+// ! Calls f(start, end) for contiguous subranges of [begin, end) with roughly equal total weight
+template<typename IndexType, typename WeightFunc, typename F>
+void weighted_parallel_for_ranges(const IndexType begin,
+                                  const IndexType end,
+                                  const WeightFunc& weight,
+                                  const F& f) {
+  // Ranges of this size are split by TBB and do not need weighted chunks
+  static constexpr size_t MIN_SIZE_FOR_WEIGHTED_CHUNKS = UL(1) << 12;
+  // Number of chunks per thread, which leaves some room for work stealing
+  static constexpr size_t NUM_CHUNKS_PER_THREAD = 8;
+
+  if ( begin >= end ) {
+    return;
+  }
+  const size_t n = end - begin;
+  const size_t num_chunks = std::min(n, NUM_CHUNKS_PER_THREAD *
+    static_cast<size_t>(tbb::this_task_arena::max_concurrency()));
+  if ( n < MIN_SIZE_FOR_WEIGHTED_CHUNKS || num_chunks <= 1 ) {
+    tbb::parallel_for(tbb::blocked_range<IndexType>(begin, end),
+      [&](const tbb::blocked_range<IndexType>& range) {
+        const auto start = ContentionStats::now();
+        f(range.begin(), range.end());
+        ContentionStats::recordBusyTime(start);
+      });
+    return;
+  }
+
+  vec<size_t> prefix_weights(n + 1, 0);
+  tbb::parallel_for(UL(0), n, [&](const size_t i) {
+    prefix_weights[i + 1] = static_cast<size_t>(weight(begin + i)) + 1;
+  });
+  parallel_prefix_sum(prefix_weights.begin() + 1, prefix_weights.end(),
+    prefix_weights.begin() + 1, std::plus<size_t>(), UL(0));
+
+  tbb::parallel_for(UL(0), num_chunks, [&](const size_t chunk) {
+    const auto [first, last] = chunking::weighted_bounds(chunk, n, num_chunks, prefix_weights);
+    if ( first < last ) {
+      const auto start = ContentionStats::now();
+      f(begin + static_cast<IndexType>(first), begin + static_cast<IndexType>(last));
+      ContentionStats::recordBusyTime(start);
+    }
+  }, tbb::simple_partitioner());
+}
+
+// ! Calls f(i) for each i in [begin, end), where the range is split into chunks of roughly equal total weight
+template<typename IndexType, typename WeightFunc, typename F>
+void weighted_parallel_for(const IndexType begin, const IndexType end, const WeightFunc& weight, const F& f) {
+  weighted_parallel_for_ranges(begin, end, weight, [&](const IndexType start, const IndexType stop) {
+    for ( IndexType i = start; i < stop; ++i ) {
+      f(i);
+    }
+  });
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -27,10 +27,14 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <tbb/parallel_for_each.h>
 
+#include "mt-kahypar/macros.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/hash.h"
 #include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -41,15 +45,33 @@ template<typename T>
 struct ThreadQueue {
   vec<T> elements;
   CAtomic<size_t> front;
+  // Elements stolen from other queues in a batch. Only accessed by the owning thread.
+  vec<T> stolen;
+  size_t stolen_front;
+  // Steal statistics of the owning thread
+  size_t num_steals;
+  size_t num_stolen_elements;
+  size_t num_failed_steals;
 
   ThreadQueue() {
     elements.reserve(1 << 13);
     front.store(0);
+    clear();
   }
 
   void clear() {
     elements.clear();
     front.store(0);
+    stolen.clear();
+    stolen_front = 0;
+    num_steals = 0;
+    num_stolen_elements = 0;
+    num_failed_steals = 0;
+  }
+
+  size_t unsafe_size() const {
+    const size_t f = front.load(std::memory_order_relaxed);
+    return (f < elements.size() ? elements.size() - f : 0) + (stolen.size() - stolen_front);
   }
 
   bool try_pop(T& dest) {
@@ -60,18 +82,56 @@ struct ThreadQueue {
     }
     return false;
   }
+
+  // ! Removes half of the remaining elements (but at most max_batch_size elements)
+  // ! with a single atomic operation and appends them to dest
+  size_t try_pop_batch(vec<T>& dest, const size_t max_batch_size) {
+    const size_t size = elements.size();
+    const size_t current_front = front.load(std::memory_order_relaxed);
+    if (current_front >= size) {
+      return 0;
+    }
+    const size_t batch_size = std::min(std::max((size - current_front) / 2, UL(1)), max_batch_size);
+    const size_t slot = front.fetch_add(batch_size, std::memory_order_acq_rel);
+    const size_t end = std::min(slot + batch_size, size);
+    for (size_t i = slot; i < end; ++i) {
+      dest.push_back(elements[i]);
+    }
+    return slot < end ? end - slot : 0;
+  }
+
+  // ! Must be called only by the owning thread
+  bool try_pop_stolen(T& dest) {
+    if (stolen_front < stolen.size()) {
+      dest = stolen[stolen_front++];
+      return true;
+    }
+    stolen.clear();
+    stolen_front = 0;
+    return false;
+  }
+};
+
+struct StealStats {
+  size_t num_steals = 0;
+  size_t num_stolen_elements = 0;
+  size_t num_failed_steals = 0;
 };
 
 template<typename T>
 struct WorkContainer {
 
+  // Upper bound for the number of elements stolen at once. Stolen elements can not
+  // be stolen again, so larger batches would increase the imbalance at the end.
+  static constexpr size_t MAX_STEAL_BATCH_SIZE = 16;
+
   WorkContainer(size_t maxNumThreads = 0) :
     tls_queues(maxNumThreads) { }
 
   size_t unsafe_size() const {
     size_t sz = 0;
     for (const ThreadQueue<T>& q : tls_queues) {
-      sz += q.elements.size() - q.front.load(std::memory_order_relaxed);
+      sz += q.unsafe_size();
     }
     return sz;
   }
@@ -85,18 +145,49 @@ struct WorkContainer {
 
   bool try_pop(T& dest, size_t thread_id) {
     ASSERT(thread_id < tls_queues.size());
-    return tls_queues[thread_id].try_pop(dest) || steal_work(dest);
+    ThreadQueue<T>& q = tls_queues[thread_id];
+    return q.try_pop(dest) || q.try_pop_stolen(dest) || steal_work(dest, thread_id);
   }
 
-  bool steal_work(T& dest) {
-    for (ThreadQueue<T>& q : tls_queues) {
-      if (q.try_pop(dest)) {
-        return true;
+  // ! Steals a batch of elements from another queue. The victims are visited
+  // ! round-robin starting at a random queue, such that idle threads do not all
+  // ! compete for the front of the same queue.
+  bool steal_work(T& dest, size_t thread_id) {
+    ASSERT(thread_id < tls_queues.size());
+    ThreadQueue<T>& thief = tls_queues[thread_id];
+    const size_t num_queues = tls_queues.size();
+    if (num_queues > 1) {
+      // The owner-local steal counters make the start queue differ between attempts
+      const size_t start = hashing::integer::hash64(
+        (thief.num_steals + thief.num_failed_steals) << 32 | thread_id) % num_queues;
+      for (size_t i = 0; i < num_queues; ++i) {
+        const size_t victim = (start + i) % num_queues;
+        if (victim != thread_id) {
+          const size_t num_stolen = tls_queues[victim].try_pop_batch(thief.stolen, MAX_STEAL_BATCH_SIZE);
+          if (num_stolen > 0) {
+            ++thief.num_steals;
+            thief.num_stolen_elements += num_stolen;
+            return thief.try_pop_stolen(dest);
+          }
+        }
       }
     }
+    ++thief.num_failed_steals;
     return false;
   }
 
+  // ! Accumulated steal statistics of all threads. Must not be called
+  // ! while other threads pop elements.
+  StealStats steal_stats() const {
+    StealStats stats;
+    for (const ThreadQueue<T>& q : tls_queues) {
+      stats.num_steals += q.num_steals;
+      stats.num_stolen_elements += q.num_stolen_elements;
+      stats.num_failed_steals += q.num_failed_steals;
+    }
+    return stats;
+  }
+
   void shuffle() {
     tbb::parallel_for_each(tls_queues, [&](ThreadQueue<T>& q) {
       utils::Randomize::instance().shuffleVector(q.elements);
@@ -128,7 +219,7 @@ struct WorkContainer {
     utils::MemoryTreeNode* work_container_node = parent->addChild("Work Container");
     utils::MemoryTreeNode* local_work_queue_node = work_container_node->addChild("Local Work Queue");
     for (const ThreadQueue<T>& q : tls_queues) {
-      local_work_queue_node->updateSize(q.elements.capacity() * sizeof(T));
+      local_work_queue_node->updateSize((q.elements.capacity() + q.stolen.capacity()) * sizeof(T));
     }
   }
 };
@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/auto_tuning.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/community_cache.h"
+#include "mt-kahypar/utils/hash.h"
+#include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar {
+
+namespace {
+
+  // The sample contains at least that many nodes (or the whole hypergraph)
+  static constexpr HypernodeID MIN_SAMPLE_SIZE = 1000;
+  // Nets with more pins are not traversed by the BFS that collects the sample,
+  // since they would add unrelated parts of the hypergraph to the sample
+  static constexpr HypernodeID MAX_TRAVERSED_EDGE_SIZE = 1000;
+  // Candidates are all combinations of the factors applied to the preset values
+  static constexpr size_t NUM_FACTORS = 3;
+  static constexpr double FACTORS[NUM_FACTORS] = { 0.5, 1.0, 2.0 };
+  // Index of the candidate that corresponds to the preset values
+  static constexpr size_t BASE_CANDIDATE = NUM_FACTORS + 1;
+
+  struct CandidateResult {
+    TunedParameters parameters;
+    HyperedgeWeight quality = std::numeric_limits<HyperedgeWeight>::max();
+    bool is_balanced = false;
+    double time = std::numeric_limits<double>::max();
+    bool finished = false;
+
+    bool isBetterThan(const CandidateResult& other) const {
+      return finished && ( !other.finished || ( is_balanced && !other.is_balanced ) ||
+        ( is_balanced == other.is_balanced && quality < other.quality ) );
+    }
+  };
+
+  std::mutex cache_mutex;
+  std::unordered_map<uint64_t, TunedParameters> cache;
+
+  uint64_t combine(const uint64_t left, const uint64_t right) {
+    return hashing::integer::combine64(left, hashing::integer::hash64(right));
+  }
+
+  uint64_t bits(const double value) {
+    uint64_t result = 0;
+    std::memcpy(&result, &value, sizeof(double));
+    return result;
+  }
+
+  // ! Hash of the fingerprint of the hypergraph and all parameters that influence the tuning
+  template<typename Hypergraph>
+  uint64_t cacheKey(const Hypergraph& hypergraph, const Context& context) {
+    uint64_t key = community_detection::fingerprint(hypergraph);
+    key = combine(key, static_cast<uint64_t>(context.partition.k));
+    key = combine(key, bits(context.partition.epsilon));
+    key = combine(key, static_cast<uint64_t>(context.partition.objective));
+    key = combine(key, static_cast<uint64_t>(context.partition.mode));
+    key = combine(key, static_cast<uint64_t>(context.partition.preset_type));
+    key = combine(key, static_cast<uint64_t>(context.partition.instance_type));
+    key = combine(key, context.shared_memory.num_threads);
+    key = combine(key, context.coarsening.contraction_limit_multiplier);
+    key = combine(key, context.initial_partitioning.runs);
+    key = combine(key, bits(context.partition.auto_tuning_sample_fraction));
+    key = combine(key, bits(context.partition.auto_tuning_max_slowdown));
+    return key;
+  }
+
+  std::string cacheFile(const std::string& directory, const uint64_t key) {
+    std::stringstream ss;
+    ss << directory << "/" << std::hex << key << ".tuning";
+    return ss.str();
+  }
+
+  bool loadCachedParameters(const uint64_t key, const Context& context, TunedParameters& parameters) {
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+      auto it = cache.find(key);
+      if ( it != cache.end() ) {
+        parameters = it->second;
+        return true;
+      }
+    }
+    if ( !context.partition.auto_tuning_cache_dir.empty() ) {
+      std::ifstream in(cacheFile(context.partition.auto_tuning_cache_dir, key));
+      TunedParameters cached;
+      if ( in >> cached.contraction_limit_multiplier >> cached.initial_partitioning_runs &&
+           cached.contraction_limit_multiplier > 0 && cached.initial_partitioning_runs > 0 ) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache[key] = cached;
+        parameters = cached;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void cacheParameters(const uint64_t key, const Context& context, const TunedParameters& parameters) {
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+      cache[key] = parameters;
+    }
+    if ( !context.partition.auto_tuning_cache_dir.empty() ) {
+      // Write to a temporary file first such that concurrent runs never read a partially written entry
+      const std::string filename = cacheFile(context.partition.auto_tuning_cache_dir, key);
+      const std::string tmp_filename = filename + ".tmp" + std::to_string(std::random_device()());
+      bool success = false;
+      {
+        std::ofstream out(tmp_filename);
+        out << parameters.contraction_limit_multiplier << " "
+            << parameters.initial_partitioning_runs << std::endl;
+        success = static_cast<bool>(out);
+      }
+      success = success && std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+      if ( !success ) {
+        std::remove(tmp_filename.c_str());
+        if ( context.partition.verbose_output ) {
+          WARNING("Could not write tuned parameters to cache file" << filename);
+        }
+      }
+    }
+  }
+
+  // ! Context of the i-th candidate that partitions the sample into sample_k blocks
+  Context createCandidateContext(const Context& context,
+                                 const TunedParameters& parameters,
+                                 const PartitionID sample_k,
+                                 const size_t i,
+                                 const size_t num_candidates) {
+    const size_t num_threads = context.shared_memory.num_threads;
+    const size_t candidate_threads = std::max(num_threads / num_candidates +
+      ( i < num_threads % num_candidates ), UL(1));
+    Context c_context(context);
+    c_context.partition.auto_tuning = false;
+    c_context.partition.k = sample_k;
+    c_context.partition.use_individual_part_weights = false;
+    c_context.partition.max_part_weights.clear();
+    c_context.partition.perfect_balance_part_weights.clear();
+    c_context.partition.portfolio_runs = 1;
+    c_context.partition.evolutionary_time_limit = 0.0;
+    c_context.partition.verbose_output = false;
+    c_context.partition.progress_callback = nullptr;
+    c_context.partition.report_callback = nullptr;
+    c_context.preprocessing.community_cache_dir.clear();
+    c_context.coarsening.contraction_limit_multiplier = parameters.contraction_limit_multiplier;
+    c_context.initial_partitioning.runs = parameters.initial_partitioning_runs;
+    c_context.shared_memory.num_threads = candidate_threads;
+    c_context.shared_memory.degree_of_parallelism *=
+      std::min(static_cast<double>(candidate_threads) / num_threads, 1.0);
+    c_context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+    return c_context;
+  }
+
+}  // namespace
+
+template<typename TypeTraits>
+typename TypeTraits::Hypergraph AutoTuning<TypeTraits>::sample(Hypergraph& hypergraph,
+                                                               const HypernodeID sample_size,
+                                                               const Context& context) {
+  const HypernodeID num_nodes = hypergraph.initialNumNodes();
+  vec<uint8_t> in_sample(num_nodes, false);
+  vec<HypernodeID> queue;
+  queue.reserve(sample_size);
+  std::mt19937 prng(context.partition.seed);
+  std::uniform_int_distribution<HypernodeID> dist(0, num_nodes - 1);
+
+  HypernodeID num_sampled = 0;
+  HypernodeID num_enabled = 0;
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    unused(hn);
+    ++num_enabled;
+  }
+  const HypernodeID target_size = std::min(sample_size, num_enabled);
+  while ( num_sampled < target_size ) {
+    // Start a new BFS from a random node that is not part of the sample
+    HypernodeID seed = dist(prng);
+    while ( !hypergraph.nodeIsEnabled(seed) || in_sample[seed] ) {
+      seed = ( seed + 1 ) % num_nodes;
+    }
+    in_sample[seed] = true;
+    ++num_sampled;
+    size_t head = queue.size();
+    queue.push_back(seed);
+    while ( head < queue.size() && num_sampled < target_size ) {
+      const HypernodeID hn = queue[head++];
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        if ( hypergraph.edgeSize(he) > MAX_TRAVERSED_EDGE_SIZE ) {
+          continue;
+        }
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          if ( !in_sample[pin] && num_sampled < target_size ) {
+            in_sample[pin] = true;
+            ++num_sampled;
+            queue.push_back(pin);
+          }
+        }
+      }
+    }
+  }
+
+  // The sample forms block 0 of a bipartition, which is then extracted
+  PartitionedHypergraph phg(2, hypergraph, parallel_tag_t());
+  phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    phg.setOnlyNodePart(hn, in_sample[hn] ? 0 : 1);
+  });
+  phg.initializePartition();
+  auto extracted_block = phg.extract(0, nullptr, true,
+    context.preprocessing.stable_construction_of_incident_edges);
+  return std::move(extracted_block.hg);
+}
+
+template<typename TypeTraits>
+void AutoTuning<TypeTraits>::tune(Hypergraph& hypergraph, Context& context, const TargetGraph* target_graph) {
+  if ( target_graph || hypergraph.hasFixedVertices() ) {
+    if ( context.partition.verbose_output ) {
+      WARNING("Auto-tuning is not supported for fixed vertices and mappings onto target graphs");
+    }
+    return;
+  }
+
+  utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+  timer.start_timer("auto_tuning", "Auto-Tuning");
+  const uint64_t key = cacheKey(hypergraph, context);
+  TunedParameters tuned;
+  if ( loadCachedParameters(key, context, tuned) ) {
+    if ( context.partition.verbose_output ) {
+      LOG << "Auto-tuning: loaded contraction limit multiplier =" << tuned.contraction_limit_multiplier
+          << "and IP runs =" << tuned.initial_partitioning_runs << "from cache";
+    }
+  } else {
+    // The number of blocks is scaled with the sample size such
+    // that the contraction limit is similar relative to the input
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HypernodeID sample_size = std::min(num_nodes, std::max(MIN_SAMPLE_SIZE,
+      static_cast<HypernodeID>(context.partition.auto_tuning_sample_fraction * num_nodes)));
+    const PartitionID sample_k = std::min(context.partition.k, std::max(2,
+      static_cast<PartitionID>(std::round(static_cast<double>(context.partition.k) * sample_size / num_nodes))));
+    timer.start_timer("auto_tuning_sampling", "Sampling");
+    Hypergraph sample_hg = sample(hypergraph, sample_size, context);
+    timer.stop_timer("auto_tuning_sampling");
+
+    const HypernodeID base_multiplier = context.coarsening.contraction_limit_multiplier;
+    const size_t base_runs = context.initial_partitioning.runs;
+    vec<CandidateResult> results(NUM_FACTORS * NUM_FACTORS);
+    for ( size_t i = 0; i < NUM_FACTORS; ++i ) {
+      for ( size_t j = 0; j < NUM_FACTORS; ++j ) {
+        results[i * NUM_FACTORS + j].parameters = TunedParameters {
+          std::max(static_cast<HypernodeID>(FACTORS[i] * base_multiplier), ID(1)),
+          std::max(static_cast<size_t>(FACTORS[j] * base_runs), UL(1)) };
+      }
+    }
+
+    std::mutex exception_mutex;
+    std::exception_ptr exception = nullptr;
+    tbb::task_group tg;
+    for ( size_t i = 0; i < results.size(); ++i ) {
+      tg.run([&, i] {
+        Context c_context = createCandidateContext(context,
+          results[i].parameters, sample_k, i, results.size());
+        tbb::task_arena arena(c_context.shared_memory.num_threads);
+        // All candidates use generators with the same seed, such that
+        // they only differ in the tuned parameters
+        utils::ArenaLocalRandomize randomize(arena, c_context.partition.seed);
+        arena.execute([&] {
+          try {
+            Hypergraph candidate_hg = sample_hg.copy(parallel_tag_t());
+            HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+            PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(candidate_hg, c_context);
+            HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+            results[i].time = std::chrono::duration<double>(end - start).count();
+            results[i].quality = metrics::quality(phg, c_context);
+            results[i].is_balanced = metrics::isBalanced(phg, c_context);
+            results[i].finished = true;
+          } catch ( const CancellationException& ) {
+            // The partitioning call was cancelled
+          } catch ( ... ) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if ( !exception ) {
+              exception = std::current_exception();
+            }
+          }
+        });
+      });
+    }
+    tg.wait();
+
+    if ( exception ) {
+      std::rethrow_exception(exception);
+    }
+    context.checkForCancellation();
+
+    // Select the best candidate whose running time is within the maximum slowdown of the preset values
+    const CandidateResult& base = results[BASE_CANDIDATE];
+    const double max_time = context.partition.auto_tuning_max_slowdown * base.time;
+    size_t best = BASE_CANDIDATE;
+    for ( size_t i = 0; i < results.size(); ++i ) {
+      const CandidateResult& result = results[i];
+      if ( context.partition.verbose_output ) {
+        LOG << "Auto-tuning candidate" << i << ": contraction limit multiplier ="
+            << result.parameters.contraction_limit_multiplier << ", IP runs ="
+            << result.parameters.initial_partitioning_runs << ":" << context.partition.objective
+            << "=" << result.quality << ", balanced =" << std::boolalpha << result.is_balanced
+            << ", time =" << result.time << "s";
+      }
+      const bool within_time = context.partition.deterministic || result.time <= max_time;
+      if ( within_time && ( result.isBetterThan(results[best]) ||
+           ( !context.partition.deterministic && result.finished &&
+             result.quality == results[best].quality &&
+             result.is_balanced == results[best].is_balanced &&
+             result.time < results[best].time ) ) ) {
+        best = i;
+      }
+    }
+    tuned = results[best].parameters;
+    // Only complete tunings are cached (candidates might have been cut short by the time limit)
+    if ( !context.isTimeLimitExceeded() ) {
+      cacheParameters(key, context, tuned);
+    }
+    if ( context.partition.verbose_output ) {
+      LOG << "Auto-tuning on a sample with" << sample_hg.initialNumNodes() << "nodes and k ="
+          << sample_k << "selected contraction limit multiplier =" << tuned.contraction_limit_multiplier
+          << "and IP runs =" << tuned.initial_partitioning_runs;
+    }
+  }
+
+  context.coarsening.contraction_limit_multiplier = tuned.contraction_limit_multiplier;
+  context.initial_partitioning.runs = tuned.initial_partitioning_runs;
+  timer.stop_timer("auto_tuning");
+}
+
+INSTANTIATE_CLASS_WITH_TYPE_TRAITS(AutoTuning)
+
+}  // namespace mt_kahypar
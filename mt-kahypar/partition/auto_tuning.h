@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/mapping/target_graph.h"
+
+namespace mt_kahypar {
+
+// ! Contraction limit multiplier and number of initial partitioning runs selected by the auto-tuning
+struct TunedParameters {
+  HypernodeID contraction_limit_multiplier = 0;
+  size_t initial_partitioning_runs = 0;
+};
+
+/**
+ * Per-instance tuning of the contraction limit multiplier and the number of initial
+ * partitioning runs. A connected sample of the hypergraph (grown via BFS from random seeds)
+ * is partitioned with all combinations of {c/2, c, 2c} and {r/2, r, 2r} in parallel, where c
+ * and r are the values of the preset. The number of blocks is scaled down with the sample
+ * size such that the coarsest hypergraph of the sample has a similar size relative to k.
+ * The candidate with the best objective on the sample is selected, unless its running time
+ * exceeds the running time of the preset setting by more than the maximum slowdown factor
+ * (the running time is ignored in deterministic mode).
+ *
+ * The result is cached per fingerprint of the hypergraph and the parameters that influence
+ * the tuning in memory and optionally in context.partition.auto_tuning_cache_dir.
+ */
+template<typename TypeTraits>
+class AutoTuning {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+ public:
+  // ! Sets the contraction limit multiplier and number of initial partitioning runs
+  // ! of the context to the tuned values. Must be called before the context is set up.
+  static void tune(Hypergraph& hypergraph, Context& context, const TargetGraph* target_graph);
+
+  // ! Returns a sub-hypergraph induced by the given number of nodes. The nodes are
+  // ! collected via BFS from random seed nodes and cut nets are restricted to the sample.
+  static Hypergraph sample(Hypergraph& hypergraph, const HypernodeID sample_size, const Context& context);
+};
+
+}  // namespace mt_kahypar
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/block_ordering.h"
+
+#include <fstream>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar {
+namespace block_ordering {
+
+namespace {
+
+template<typename T>
+void writeLine(std::ofstream& out, const vec<T>& values) {
+  for ( size_t i = 0; i < values.size(); ++i ) {
+    out << (i > 0 ? " " : "") << values[i];
+  }
+  out << "\n";
+}
+
+}  // namespace
+
+void writeBlockOrderingFile(const BlockOrdering& ordering, const std::string& filename) {
+  std::ofstream out(filename);
+  if ( !out ) {
+    throw InvalidInputException("Could not open block ordering file: " + filename);
+  }
+  ASSERT(!ordering.block_offsets.empty());
+  out << ordering.permutation.size() << " " << (ordering.block_offsets.size() - 1)
+      << " " << ordering.cut_nets.size() << "\n";
+  writeLine(out, ordering.block_offsets);
+  writeLine(out, ordering.halo_offsets);
+  writeLine(out, ordering.permutation);
+  writeLine(out, ordering.cut_nets);
+}
+
+}  // namespace block_ordering
+}  // namespace mt_kahypar
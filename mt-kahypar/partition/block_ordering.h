@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/parallel_counting_sort.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace block_ordering {
+
+// The block ordering renumbers the nodes such that each block is contiguous, which downstream
+// applications (e.g., sparse matrix-vector multiplication or distributed simulations) need
+// for storing each block on a different processing element. The nodes of block b are
+// permutation[block_offsets[b], block_offsets[b + 1]). Within each block, the interior nodes
+// come first, followed by the halo nodes (nodes incident to a cut net, whose values must be
+// exchanged with other blocks), starting at halo_offsets[b]. Both are sorted by node ID.
+struct BlockOrdering {
+  // ! permutation[i] is the node at position i of the block ordering
+  vec<HypernodeID> permutation;
+  // ! k + 1 entries
+  vec<HypernodeID> block_offsets;
+  // ! k entries
+  vec<HypernodeID> halo_offsets;
+  // ! Nets that span more than one block in increasing order
+  // ! (for graphs, the IDs of the undirected edges in the input)
+  vec<HyperedgeID> cut_nets;
+};
+
+template<typename PartitionedHypergraph>
+BlockOrdering computeBlockOrdering(const PartitionedHypergraph& phg) {
+  BlockOrdering ordering;
+  const PartitionID k = phg.k();
+  const HypernodeID num_nodes = phg.initialNumNodes();
+  const HyperedgeID num_edges = phg.initialNumEdges();
+  const size_t num_tasks = tbb::this_task_arena::max_concurrency();
+
+  auto is_cut = [&](const HyperedgeID he) {
+    return phg.edgeIsEnabled(he) && phg.connectivity(he) > 1;
+  };
+
+  // Nodes are sorted by (block, is halo node) with a stable counting sort
+  vec<HypernodeID> nodes(num_nodes);
+  tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+    nodes[hn] = hn;
+  });
+  auto bucket_of_node = [&](const HypernodeID hn) {
+    bool is_halo = false;
+    for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+      if ( is_cut(he) ) {
+        is_halo = true;
+        break;
+      }
+    }
+    return 2 * static_cast<size_t>(phg.partID(hn)) + is_halo;
+  };
+  ordering.permutation.resize(num_nodes);
+  const vec<uint32_t> node_buckets = parallel::counting_sort(
+    nodes, ordering.permutation, 2 * static_cast<size_t>(k), bucket_of_node, num_tasks);
+  ordering.block_offsets.resize(k + 1);
+  ordering.halo_offsets.resize(k);
+  for ( PartitionID block = 0; block < k; ++block ) {
+    ordering.block_offsets[block] = node_buckets[2 * block];
+    ordering.halo_offsets[block] = node_buckets[2 * block + 1];
+  }
+  ordering.block_offsets[k] = num_nodes;
+
+  // Cut nets are moved to the front with a stable counting sort. For graphs,
+  // each undirected edge is represented by the arc from its smaller endpoint.
+  vec<HyperedgeID> edges(num_edges);
+  tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+    edges[he] = he;
+  });
+  auto bucket_of_edge = [&](const HyperedgeID he) {
+    if constexpr ( PartitionedHypergraph::is_graph ) {
+      return is_cut(he) && phg.edgeSource(he) < phg.edgeTarget(he) ? 0 : 1;
+    } else {
+      return is_cut(he) ? 0 : 1;
+    }
+  };
+  vec<HyperedgeID> sorted_edges(num_edges);
+  const vec<uint32_t> edge_buckets = parallel::counting_sort(
+    edges, sorted_edges, 2, bucket_of_edge, num_tasks);
+  sorted_edges.resize(edge_buckets[1]);
+  if constexpr ( PartitionedHypergraph::is_graph ) {
+    tbb::parallel_for(UL(0), sorted_edges.size(), [&](const size_t i) {
+      sorted_edges[i] = phg.uniqueEdgeID(sorted_edges[i]);
+    });
+    tbb::parallel_sort(sorted_edges.begin(), sorted_edges.end());
+  }
+  ordering.cut_nets = std::move(sorted_edges);
+  return ordering;
+}
+
+// ! Writes the block ordering to a file with the following lines:
+// ! <num nodes> <k> <num cut nets>
+// ! <block offsets (k + 1 entries)>
+// ! <halo offsets (k entries)>
+// ! <permutation (num nodes entries)>
+// ! <cut nets (num cut nets entries)>
+void writeBlockOrderingFile(const BlockOrdering& ordering, const std::string& filename);
+
+}  // namespace block_ordering
+}  // namespace mt_kahypar
@@ -28,7 +28,10 @@
 
 #pragma once
 
+#include <utility>
+
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/background_reclamation.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/definitions.h"
 
@@ -62,6 +65,10 @@ public:
     return _communities[hn];
   }
 
+  const parallel::scalable_vector<HypernodeID>& communities() const {
+    return _communities;
+  }
+
   double coarseningTime() const {
     return _coarsening_time;
   }
@@ -74,6 +81,25 @@ public:
     });
   }
 
+  // ! Frees the memory of the contracted hypergraph and the mapping to it.
+  // ! The memory is returned to the allocator and can be reused by the
+  // ! subsequent allocations of the uncoarsening phase. If background
+  // ! reclamation is active, the memory is freed concurrently with the
+  // ! refinement of the next level.
+  void release() {
+    parallel::BackgroundReclamation& reclamation = parallel::BackgroundReclamation::instance();
+    if ( reclamation.isActive() ) {
+      reclamation.retire(std::exchange(_contracted_hypergraph, Hypergraph()));
+      reclamation.retire(std::exchange(_communities, parallel::scalable_vector<HypernodeID>()));
+      return;
+    }
+    tbb::parallel_invoke([&] {
+      _contracted_hypergraph = Hypergraph();
+    }, [&] {
+      parallel::free(_communities);
+    });
+  }
+
 private:
   // ! Contracted Hypergraph
   Hypergraph _contracted_hypergraph;
@@ -116,6 +142,11 @@ public:
     }
 
   ~UncoarseningData() noexcept {
+    parallel::BackgroundReclamation& reclamation = parallel::BackgroundReclamation::instance();
+    if ( reclamation.isActive() ) {
+      reclamation.retire(std::move(hierarchy));
+      return;
+    }
     tbb::parallel_for(UL(0), hierarchy.size(), [&](const size_t i) {
       (hierarchy)[i].freeInternalData();
     }, tbb::static_partitioner());
@@ -176,6 +207,78 @@ public:
     hierarchy.emplace_back(std::move(contracted_hg), std::move(communities), elapsed_time);
   }
 
+  // ! Rebuilds the multilevel hierarchy of a previous V-cycle on top of the input hypergraph.
+  // ! The community IDs of the input hypergraph must store the blocks of the current partition.
+  // ! A level of the previous hierarchy is reused as it is if all of its clusters are still
+  // ! contained in one block. Otherwise, vertices that moved to a different block are split
+  // ! off as singletons and the level (and all coarser levels) are recontracted.
+  // ! Returns the number of recontracted levels.
+  size_t restoreHierarchy(vec<Level<TypeTraits>>&& previous) {
+    ASSERT(!nlevel && hierarchy.empty() && !is_finalized);
+    size_t num_recontracted_levels = 0;
+    // Maps each vertex of the current hypergraph to its vertex in the previous hierarchy
+    // (identity as long as no level was recontracted)
+    parallel::scalable_vector<HypernodeID> previous_ids;
+    bool is_identical = true;
+    for ( Level<TypeTraits>& level : previous ) {
+      Hypergraph& current_hg = hierarchy.empty() ? _hg : hierarchy.back().contractedHypergraph();
+      const parallel::scalable_vector<HypernodeID>& previous_communities = level.communities();
+      auto previous_cluster = [&](const HypernodeID hn) {
+        return previous_communities[is_identical ? hn : previous_ids[hn]];
+      };
+
+      // Each cluster of the previous level elects a representative
+      vec<CAtomic<HypernodeID>> representative(
+        level.contractedHypergraph().initialNumNodes(), CAtomic<HypernodeID>(kInvalidHypernode));
+      current_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        HypernodeID expected = kInvalidHypernode;
+        representative[previous_cluster(hn)].compare_exchange_strong(expected, hn);
+      });
+
+      // Vertices that are not in the same block as their representative become singletons
+      parallel::scalable_vector<HypernodeID> clusters(current_hg.initialNumNodes());
+      CAtomic<HypernodeID> num_split_nodes(0);
+      tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID& hn) {
+        clusters[hn] = hn;
+      });
+      current_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        const HypernodeID rep = representative[previous_cluster(hn)].load(std::memory_order_relaxed);
+        if ( current_hg.communityID(hn) == current_hg.communityID(rep) ) {
+          clusters[hn] = rep;
+        } else {
+          num_split_nodes.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+
+      if ( is_identical && num_split_nodes.load(std::memory_order_relaxed) == 0 ) {
+        // The level still respects the partition => reuse it
+        Hypergraph& coarse_hg = level.contractedHypergraph();
+        current_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          if ( clusters[hn] == hn ) {
+            coarse_hg.setCommunityID(level.mapToContractedHypergraph(hn), current_hg.communityID(hn));
+          }
+        });
+        hierarchy.push_back(std::move(level));
+      } else {
+        parallel::scalable_vector<HypernodeID> communities = clusters;
+        Hypergraph contracted_hg = current_hg.contract(communities, false /* deterministic */);
+        parallel::scalable_vector<HypernodeID> next_previous_ids(contracted_hg.initialNumNodes(), kInvalidHypernode);
+        current_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          if ( clusters[hn] == hn ) {
+            next_previous_ids[communities[hn]] = previous_cluster(hn);
+          }
+        });
+        const double coarsening_time = level.coarseningTime();
+        level.freeInternalData();
+        previous_ids = std::move(next_previous_ids);
+        is_identical = false;
+        hierarchy.emplace_back(std::move(contracted_hg), std::move(communities), coarsening_time);
+        ++num_recontracted_levels;
+      }
+    }
+    return num_recontracted_levels;
+  }
+
   PartitionedHypergraph& coarsestPartitionedHypergraph() {
     if (nlevel) {
       return *compactified_phg;
@@ -186,6 +289,9 @@ public:
 
   // Multilevel Data
   vec<Level<TypeTraits>> hierarchy;
+  // ! If true, each level is released once the partition is projected past it.
+  // ! Must be false if the hierarchy is reused after uncoarsening.
+  bool release_processed_levels = true;
 
   // NLevel Data
   // ! Once coarsening terminates we generate a compactified hypergraph
@@ -0,0 +1,299 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar {
+
+/**
+ * The community structure and the multilevel hierarchy of a hypergraph. It is computed once
+ * and then used by several partitioning calls with different k and imbalance, which only
+ * perform initial partitioning and uncoarsening (see Partitioner<TypeTraits>::partition(...)).
+ * Each call copies the finest levels of the hierarchy up to its contraction limit.
+ *
+ * The hierarchy can be written to a file. The file only stores the community structure and
+ * the contracted clusterings of each level. The coarse hypergraphs are recontracted
+ * when the hierarchy is read, which is much cheaper than computing the clusterings.
+ */
+template<typename Hypergraph>
+class CoarseningHierarchy {
+
+  static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'H', 'I', 'E', 'R', 'C' };
+  static constexpr uint32_t VERSION = 1;
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t id_width;
+    uint64_t num_nodes;
+    uint64_t num_edges;
+    uint64_t contraction_limit;
+    uint64_t num_levels;
+  };
+
+ public:
+  CoarseningHierarchy() :
+    _num_nodes(0),
+    _num_edges(0),
+    _contraction_limit(0),
+    _communities(),
+    _hypergraphs(),
+    _clusterings(),
+    _coarsening_times() { }
+
+  // ! Takes over the levels of a multilevel hierarchy of the given (sanitized) hypergraph.
+  // ! The contraction limit is the one used to remove degree-zero nodes before coarsening.
+  template<typename TypeTraits>
+  CoarseningHierarchy(const Hypergraph& hypergraph,
+                      vec<Level<TypeTraits>>&& levels,
+                      const HypernodeID contraction_limit) :
+    CoarseningHierarchy() {
+    _num_nodes = hypergraph.initialNumNodes();
+    _num_edges = hypergraph.initialNumEdges();
+    _contraction_limit = contraction_limit;
+    _communities.assign(_num_nodes, kInvalidPartition);
+    tbb::parallel_for(ID(0), _num_nodes, [&](const HypernodeID& hn) {
+      _communities[hn] = hypergraph.communityID(hn);
+    });
+    for ( Level<TypeTraits>& level : levels ) {
+      _clusterings.push_back(level.communities());
+      _coarsening_times.push_back(level.coarseningTime());
+      _hypergraphs.emplace_back(std::move(level.contractedHypergraph()));
+    }
+  }
+
+  CoarseningHierarchy(const CoarseningHierarchy&) = delete;
+  CoarseningHierarchy & operator= (const CoarseningHierarchy &) = delete;
+
+  CoarseningHierarchy(CoarseningHierarchy&&) = default;
+  CoarseningHierarchy & operator= (CoarseningHierarchy &&) = default;
+
+  HypernodeID numNodes() const {
+    return _num_nodes;
+  }
+
+  size_t numLevels() const {
+    return _clusterings.size();
+  }
+
+  HypernodeID contractionLimit() const {
+    return _contraction_limit;
+  }
+
+  const ds::Clustering& communities() const {
+    return _communities;
+  }
+
+  // ! Throws an exception if the hierarchy was not computed for the given (sanitized)
+  // ! hypergraph, i.e., if the number of nodes or edges differ or if other nodes were
+  // ! removed before coarsening.
+  void verifyHypergraph(const Hypergraph& hypergraph) const {
+    bool matches = hypergraph.initialNumNodes() == _num_nodes &&
+                   hypergraph.initialNumEdges() == _num_edges;
+    if ( matches && !_clusterings.empty() ) {
+      const parallel::scalable_vector<HypernodeID>& clustering = _clusterings[0];
+      CAtomic<bool> valid(true);
+      tbb::parallel_for(ID(0), _num_nodes, [&](const HypernodeID& hn) {
+        if ( hypergraph.nodeIsEnabled(hn) != (clustering[hn] != kInvalidHypernode) ) {
+          valid.store(false, std::memory_order_relaxed);
+        }
+      });
+      matches = valid.load(std::memory_order_relaxed);
+    }
+    if ( !matches ) {
+      throw InvalidInputException(
+        "The coarsening hierarchy was not computed for the given hypergraph!");
+    }
+  }
+
+  // ! Copies the levels of the hierarchy until the first level with at most
+  // ! contraction_limit nodes (or all levels if no level is coarse enough)
+  template<typename TypeTraits>
+  vec<Level<TypeTraits>> copyLevels(const HypernodeID contraction_limit) const {
+    vec<Level<TypeTraits>> levels;
+    for ( size_t i = 0; i < _hypergraphs.size(); ++i ) {
+      levels.emplace_back(_hypergraphs[i].copy(parallel_tag_t()),
+        parallel::scalable_vector<HypernodeID>(_clusterings[i]), _coarsening_times[i]);
+      if ( _hypergraphs[i].initialNumNodes() <= contraction_limit ) {
+        break;
+      }
+    }
+    return levels;
+  }
+
+  // ! Recontracts the coarse hypergraphs of a hierarchy read from a file. The
+  // ! hypergraph must be sanitized in the same way as when the hierarchy was computed.
+  void contract(Hypergraph& hypergraph) {
+    verifyHypergraph(hypergraph);
+    hypergraph.setCommunityIDs(ds::Clustering(_communities));
+    _hypergraphs.clear();
+    for ( size_t i = 0; i < _clusterings.size(); ++i ) {
+      Hypergraph& current_hg = i == 0 ? hypergraph : _hypergraphs.back();
+      const parallel::scalable_vector<HypernodeID>& clustering = _clusterings[i];
+      const HypernodeID num_nodes = current_hg.initialNumNodes();
+      bool valid = clustering.size() == num_nodes;
+      for ( HypernodeID hn = 0; valid && hn < num_nodes; ++hn ) {
+        valid = !current_hg.nodeIsEnabled(hn) || clustering[hn] < num_nodes;
+      }
+      if ( !valid ) {
+        throw InvalidInputException("Level " + STR(i) + " of the coarsening hierarchy is invalid!");
+      }
+
+      parallel::scalable_vector<HypernodeID> communities = clustering;
+      _hypergraphs.emplace_back(current_hg.contract(communities, false /* deterministic */));
+      if ( communities != clustering ) {
+        // The clustering does not use consecutive cluster IDs
+        throw InvalidInputException("Level " + STR(i) + " of the coarsening hierarchy is invalid!");
+      }
+    }
+    if ( !_hypergraphs.empty() ) {
+      _hypergraphs.back().freeTmpContractionBuffer();
+    } else {
+      hypergraph.freeTmpContractionBuffer();
+    }
+  }
+
+  // ! Writes the community structure and the clusterings of each level to a binary file
+  void writeToFile(const std::string& filename) const {
+    std::ofstream out(filename, std::ios::binary);
+    if ( !out ) {
+      throw InvalidInputException("Could not open output file: " + filename);
+    }
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.id_width = sizeof(HypernodeID);
+    header.num_nodes = _num_nodes;
+    header.num_edges = _num_edges;
+    header.contraction_limit = _contraction_limit;
+    header.num_levels = _clusterings.size();
+    out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    out.write(reinterpret_cast<const char*>(_communities.data()), _communities.size() * sizeof(PartitionID));
+    for ( size_t i = 0; i < _clusterings.size(); ++i ) {
+      const uint64_t size = _clusterings[i].size();
+      out.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+      out.write(reinterpret_cast<const char*>(&_coarsening_times[i]), sizeof(double));
+      out.write(reinterpret_cast<const char*>(_clusterings[i].data()), size * sizeof(HypernodeID));
+    }
+    if ( !out ) {
+      throw SystemException("Failed to write coarsening hierarchy to file: " + filename);
+    }
+  }
+
+  // ! Reads a hierarchy written with writeToFile(...). The coarse hypergraphs
+  // ! are not constructed until contract(...) is called. The counts of the header
+  // ! and of each level are checked against the file size before allocating memory.
+  static CoarseningHierarchy readFromFile(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if ( !in ) {
+      throw InvalidInputException("File not found: " + filename);
+    }
+    const uint64_t file_size = static_cast<uint64_t>(in.tellg());
+    in.seekg(0, std::ios::beg);
+    auto remaining_bytes = [&] {
+      return file_size - static_cast<uint64_t>(in.tellg());
+    };
+    auto corrupted = [&] {
+      return InvalidInputException("Coarsening hierarchy file is corrupted: " + filename);
+    };
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    if ( !in || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ) {
+      throw InvalidInputException("File is not a coarsening hierarchy: " + filename);
+    }
+    if ( header.version != VERSION || header.id_width != sizeof(HypernodeID) ) {
+      throw InvalidInputException("Coarsening hierarchy was written by an incompatible build: " + filename);
+    }
+
+    const uint64_t level_header_size = sizeof(uint64_t) + sizeof(double);
+    if ( header.num_nodes > std::numeric_limits<HypernodeID>::max() ||
+         header.num_edges > std::numeric_limits<HyperedgeID>::max() ||
+         header.num_nodes > remaining_bytes() / sizeof(PartitionID) ||
+         header.num_levels > ( remaining_bytes() - header.num_nodes * sizeof(PartitionID) ) / level_header_size ) {
+      throw corrupted();
+    }
+
+    CoarseningHierarchy hierarchy;
+    hierarchy._num_nodes = header.num_nodes;
+    hierarchy._num_edges = header.num_edges;
+    hierarchy._contraction_limit = header.contraction_limit;
+    hierarchy._communities.resize(header.num_nodes);
+    in.read(reinterpret_cast<char*>(hierarchy._communities.data()), header.num_nodes * sizeof(PartitionID));
+    uint64_t expected_size = header.num_nodes;
+    for ( uint64_t i = 0; in && i < header.num_levels; ++i ) {
+      uint64_t size = 0;
+      double coarsening_time = 0.0;
+      in.read(reinterpret_cast<char*>(&size), sizeof(uint64_t));
+      in.read(reinterpret_cast<char*>(&coarsening_time), sizeof(double));
+      if ( !in || size != expected_size || size > remaining_bytes() / sizeof(HypernodeID) ) {
+        throw corrupted();
+      }
+      parallel::scalable_vector<HypernodeID> clustering(size);
+      in.read(reinterpret_cast<char*>(clustering.data()), size * sizeof(HypernodeID));
+      // The number of nodes of the next level is the number of clusters
+      expected_size = 0;
+      for ( const HypernodeID& cluster : clustering ) {
+        if ( cluster != kInvalidHypernode ) {
+          expected_size = std::max(expected_size, static_cast<uint64_t>(cluster) + 1);
+        }
+      }
+      hierarchy._clusterings.emplace_back(std::move(clustering));
+      hierarchy._coarsening_times.push_back(coarsening_time);
+    }
+    if ( !in || remaining_bytes() != 0 ) {
+      throw corrupted();
+    }
+    return hierarchy;
+  }
+
+ private:
+  HypernodeID _num_nodes;
+  HyperedgeID _num_edges;
+  // ! Contraction limit used to remove degree-zero nodes before coarsening
+  HypernodeID _contraction_limit;
+  // ! Community IDs of the input hypergraph
+  ds::Clustering _communities;
+  // ! Coarse hypergraph of each level
+  vec<Hypergraph> _hypergraphs;
+  // ! Maps the nodes of the finer hypergraph to the nodes of the coarse hypergraph of each level
+  vec<parallel::scalable_vector<HypernodeID>> _clusterings;
+  vec<double> _coarsening_times;
+};
+
+}  // namespace mt_kahypar
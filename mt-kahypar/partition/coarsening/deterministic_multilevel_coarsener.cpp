@@ -26,9 +26,10 @@
 
 #include "deterministic_multilevel_coarsener.h"
 
-#include <tbb/parallel_sort.h>
+#include <tbb/parallel_for.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_fixed_vertex_acceptance_policy.h"
 #include "mt-kahypar/utils/hash.h"
 
@@ -261,43 +262,68 @@ size_t DeterministicMultilevelCoarsener<TypeTraits>::approveNodes(vec<HypernodeI
   const Hypergraph& hg = Base::currentHypergraph();
   tbb::enumerable_thread_specific<size_t> num_contracted_nodes { 0 };
 
-  // group vertices by desired cluster, if their cluster is too heavy. approve the lower weight nodes first
-  auto comp = [&](HypernodeID lhs, HypernodeID rhs) {
-    HypernodeWeight wl = hg.nodeWeight(lhs), wr = hg.nodeWeight(rhs);
-    return std::tie(propositions[lhs], wl, lhs) < std::tie(propositions[rhs], wr, rhs);
-  };
-  tbb::parallel_sort(nodes_in_too_heavy_clusters.begin(), nodes_in_too_heavy_clusters.end(), comp);
+  // group vertices by desired cluster, if their cluster is too heavy. instead of sorting all vertices,
+  // we count the proposals per cluster and distribute the vertices into one bucket per cluster.
+  tbb::parallel_for(UL(0), nodes_in_too_heavy_clusters.size(), [&](size_t pos) {
+    const HypernodeID target = propositions[nodes_in_too_heavy_clusters[pos]];
+    if (__atomic_fetch_add(&num_proposals[target], 1, __ATOMIC_RELAXED) == 0) {
+      too_heavy_clusters.push_back_buffered(target);
+    }
+  });
+  too_heavy_clusters.finalize();
 
+  const size_t num_clusters = too_heavy_clusters.size();
+  bucket_bounds.resize(num_clusters + 1);
+  bucket_bounds[0] = 0;
+  tbb::parallel_for(UL(0), num_clusters, [&](size_t i) {
+    bucket_bounds[i + 1] = num_proposals[too_heavy_clusters[i]];
+  });
+  parallel_prefix_sum(bucket_bounds.begin() + 1, bucket_bounds.end(), bucket_bounds.begin() + 1, std::plus<>(), UL(0));
+  // num_proposals serves as write position of the bucket of each cluster
+  tbb::parallel_for(UL(0), num_clusters, [&](size_t i) {
+    num_proposals[too_heavy_clusters[i]] = bucket_bounds[i];
+  });
+  grouped_nodes.resize(nodes_in_too_heavy_clusters.size());
   tbb::parallel_for(UL(0), nodes_in_too_heavy_clusters.size(), [&](size_t pos) {
-    HypernodeID target = propositions[nodes_in_too_heavy_clusters[pos]];
-    // the first vertex for this cluster handles the approval
+    const HypernodeID v = nodes_in_too_heavy_clusters[pos];
+    grouped_nodes[__atomic_fetch_add(&num_proposals[propositions[v]], 1, __ATOMIC_RELAXED)] = v;
+  });
+
+  tbb::parallel_for(UL(0), num_clusters, [&](size_t i) {
+    const HypernodeID target = too_heavy_clusters[i];
+    const auto first = grouped_nodes.begin() + bucket_bounds[i];
+    const auto last = grouped_nodes.begin() + bucket_bounds[i + 1];
+    // approve the lower weight nodes first. the order within a bucket is the same as
+    // if we sorted all vertices by (cluster, weight, ID), so the results are unaffected
+    std::sort(first, last, [&](HypernodeID lhs, HypernodeID rhs) {
+      HypernodeWeight wl = hg.nodeWeight(lhs), wr = hg.nodeWeight(rhs);
+      return std::tie(wl, lhs) < std::tie(wr, rhs);
+    });
+
+    HypernodeWeight target_weight = cluster_weight[target];
     size_t num_contracted_local = 0;
-    if (pos == 0 || propositions[nodes_in_too_heavy_clusters[pos - 1]] != target) {
-      HypernodeWeight target_weight = cluster_weight[target];
-      size_t first_rejected = pos;
-      // could be parallelized without extra memory but factor 2 work overhead and log(n) depth via binary search
-      for (; ; ++first_rejected) {
-        // we know that this cluster is too heavy, so the loop will terminate before
-        ASSERT(first_rejected < nodes_in_too_heavy_clusters.size());
-        ASSERT(propositions[nodes_in_too_heavy_clusters[first_rejected]] == target);
-        HypernodeID v = nodes_in_too_heavy_clusters[first_rejected];
-        if (target_weight + hg.nodeWeight(v) > _context.coarsening.max_allowed_node_weight) {
-          break;
-        }
-        if (has_fixed_vertices && !fixed_vertices.contract(target, v)) {
-          continue;
-        }
-        clusters[v] = target;
-        target_weight += hg.nodeWeight(v);
-        if (opportunistic_cluster_weight[v] == hg.nodeWeight(v)) {
-          num_contracted_local += 1;
-        }
+    // could be parallelized without extra memory but factor 2 work overhead and log(n) depth via binary search
+    for (auto it = first; it != last; ++it) {
+      ASSERT(propositions[*it] == target);
+      HypernodeID v = *it;
+      if (target_weight + hg.nodeWeight(v) > _context.coarsening.max_allowed_node_weight) {
+        break;
+      }
+      if (has_fixed_vertices && !fixed_vertices.contract(target, v)) {
+        continue;
+      }
+      clusters[v] = target;
+      target_weight += hg.nodeWeight(v);
+      if (opportunistic_cluster_weight[v] == hg.nodeWeight(v)) {
+        num_contracted_local += 1;
       }
-      cluster_weight[target] = target_weight;
-      opportunistic_cluster_weight[target] = target_weight;
-      num_contracted_nodes.local() += num_contracted_local;
     }
+    cluster_weight[target] = target_weight;
+    opportunistic_cluster_weight[target] = target_weight;
+    num_contracted_nodes.local() += num_contracted_local;
+    num_proposals[target] = 0;
   });
+  too_heavy_clusters.clear();
 
   return num_contracted_nodes.combine(std::plus<>());
 }
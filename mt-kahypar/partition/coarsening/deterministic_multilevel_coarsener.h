@@ -80,6 +80,10 @@ public:
     cluster_weight(utils::cast<Hypergraph>(hypergraph).initialNumNodes(), 0),
     opportunistic_cluster_weight(utils::cast<Hypergraph>(hypergraph).initialNumNodes(), 0),
     nodes_in_too_heavy_clusters(utils::cast<Hypergraph>(hypergraph).initialNumNodes()),
+    num_proposals(utils::cast<Hypergraph>(hypergraph).initialNumNodes(), 0),
+    too_heavy_clusters(utils::cast<Hypergraph>(hypergraph).initialNumNodes()),
+    bucket_bounds(),
+    grouped_nodes(),
     default_rating_maps(utils::cast<Hypergraph>(hypergraph).initialNumNodes()),
     cache_efficient_rating_maps(0.0),
     pass(0),
@@ -176,6 +180,11 @@ private:
   vec<HypernodeID> propositions;
   vec<HypernodeWeight> cluster_weight, opportunistic_cluster_weight;
   ds::BufferedVector<HypernodeID> nodes_in_too_heavy_clusters;
+  // ! Buffers to group the nodes in too heavy clusters by their desired cluster (reused across sub-rounds)
+  vec<HypernodeID> num_proposals;
+  ds::BufferedVector<HypernodeID> too_heavy_clusters;
+  vec<size_t> bucket_bounds;
+  vec<HypernodeID> grouped_nodes;
   tbb::enumerable_thread_specific<LargeRatingMap> default_rating_maps;
   tbb::enumerable_thread_specific<CacheEfficientRatingMap> cache_efficient_rating_maps;
   tbb::enumerable_thread_specific<vec<HypernodeID>> ties;
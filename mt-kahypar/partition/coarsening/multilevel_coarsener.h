@@ -45,6 +45,8 @@
 #include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/chunking.h"
+#include "mt-kahypar/parallel/weighted_parallel_for.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/progress_bar.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -97,6 +99,7 @@ class MultilevelCoarsener : public ICoarsener,
     _matching_state(),
     _cluster_weight(),
     _matching_partner(),
+    _preferred_target(),
     _pass_nr(0),
     _progress_bar(utils::cast<Hypergraph>(hypergraph).initialNumNodes(), 0, false),
     _enable_randomization(true) {
@@ -111,6 +114,10 @@ class MultilevelCoarsener : public ICoarsener,
       _cluster_weight.resize(_hg.initialNumNodes());
     }, [&] {
       _matching_partner.resize(_hg.initialNumNodes());
+    }, [&] {
+      if ( _context.coarsening.use_two_hop_clustering ) {
+        _preferred_target.resize(_hg.initialNumNodes());
+      }
     });
   }
 
@@ -122,7 +129,7 @@ class MultilevelCoarsener : public ICoarsener,
   ~MultilevelCoarsener() {
     parallel::parallel_free(
       _current_vertices, _matching_state,
-      _cluster_weight, _matching_partner);
+      _cluster_weight, _matching_partner, _preferred_target);
   }
 
   void disableRandomization() {
@@ -143,6 +150,9 @@ class MultilevelCoarsener : public ICoarsener,
   bool coarseningPassImpl() override {
     HighResClockTimepoint round_start = std::chrono::high_resolution_clock::now();
     Hypergraph& current_hg = Base::currentHypergraph();
+    utils::Timer::ScopedTraceSpan span(_timer, "Coarsening Pass", "coarsening");
+    span.addArg("pass", _pass_nr);
+    span.addArg("nodes", current_hg.initialNumNodes());
     DBG << V(_pass_nr)
         << V(current_hg.initialNumNodes())
         << V(current_hg.initialNumEdges())
@@ -158,6 +168,9 @@ class MultilevelCoarsener : public ICoarsener,
       _matching_state[hn].store(STATE(MatchingState::UNMATCHED), std::memory_order_relaxed);
       _matching_partner[hn].store(hn, std::memory_order_relaxed);
       cluster_ids[hn] = hn;
+      if ( _context.coarsening.use_two_hop_clustering ) {
+        _preferred_target[hn] = kInvalidHypernode;
+      }
       if ( current_hg.nodeIsEnabled(hn) ) {
         _cluster_weight[hn] = current_hg.nodeWeight(hn);
       }
@@ -242,52 +255,90 @@ class MultilevelCoarsener : public ICoarsener,
     tbb::enumerable_thread_specific<HypernodeID> num_nodes_update_threshold(0);
     ds::FixedVertexSupport<Hypergraph> fixed_vertices = current_hg.copyOfFixedVertexSupport();
     fixed_vertices.setMaxBlockWeight(_context.partition.max_part_weights);
-    tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID id) {
-      ASSERT(id < _current_vertices.size());
+    if constexpr ( has_fixed_vertices ) {
+      if ( _context.coarsening.precontract_fixed_vertices ) {
+        precontractFixedVertices(current_hg, cluster_ids, contracted_nodes, fixed_vertices);
+        current_num_nodes = num_hns_before_pass - contracted_nodes.combine(std::plus<>());
+      }
+    }
+    // The rating of a vertex scans its incident nets, so high degree vertices are spread over
+    // chunks of roughly equal total degree to avoid stragglers on skewed degree distributions
+    auto rating_work = [&](const HypernodeID id) {
       const HypernodeID hn = _current_vertices[id];
-      if (current_hg.nodeIsEnabled(hn)) {
-        // We perform rating if ...
-        //  1.) The contraction limit of the current level is not reached
-        //  2.) Vertex hn is not matched before
-        const HypernodeID u = hn;
-        if (_matching_state[u] == STATE(MatchingState::UNMATCHED)) {
-          if (current_num_nodes > hierarchy_contraction_limit) {
-            ASSERT(current_hg.nodeIsEnabled(hn));
-            const Rating rating = _rater.template rate<has_fixed_vertices>(current_hg, hn,
-              cluster_ids, _cluster_weight, fixed_vertices, _context.coarsening.max_allowed_node_weight);
-            if (rating.target != kInvalidHypernode) {
-              const HypernodeID v = rating.target;
-              HypernodeID& local_contracted_nodes = contracted_nodes.local();
-              matchVertices<has_fixed_vertices>(current_hg, u, v,
-                cluster_ids, local_contracted_nodes, fixed_vertices);
-
-              // To maintain the current number of nodes of the hypergraph each PE sums up
-              // its number of contracted nodes locally. To compute the current number of
-              // nodes, we have to sum up the number of contracted nodes of each PE. This
-              // operation becomes more expensive the more PEs are participating in coarsening.
-              // In order to prevent expensive updates of the current number of nodes, we
-              // define a threshold which the local number of contracted nodes have to exceed
-              // before the current PE updates the current number of nodes. This threshold is defined
-              // by the distance to the current contraction limit divided by the number of PEs.
-              // Once one PE exceeds this bound the first time it is not possible that the
-              // contraction limit is reached, because otherwise an other PE would update
-              // the global current number of nodes before. After update the threshold is
-              // increased by the new difference (in number of nodes) to the contraction limit
-              // divided by the number of PEs.
-              if (local_contracted_nodes >= num_nodes_update_threshold.local()) {
-                current_num_nodes = num_hns_before_pass -
-                                    contracted_nodes.combine(std::plus<HypernodeID>());
-                const HypernodeID dist_to_contraction_limit =
-                  current_num_nodes > hierarchy_contraction_limit ?
-                  current_num_nodes - hierarchy_contraction_limit : 0;
-                num_nodes_update_threshold.local() +=
-                  dist_to_contraction_limit / _context.shared_memory.original_num_threads;
+      return current_hg.nodeIsEnabled(hn) ? std::min(static_cast<size_t>(current_hg.nodeDegree(hn)),
+        _context.coarsening.vertex_degree_sampling_threshold) : 0;
+    };
+    if ( _context.coarsening.propose_resolve_clustering ) {
+      performProposeResolveClustering<has_fixed_vertices>(current_hg, cluster_ids,
+        num_hns_before_pass, hierarchy_contraction_limit, rating_work, contracted_nodes, fixed_vertices);
+    } else {
+      parallel::weighted_parallel_for(ID(0), current_hg.initialNumNodes(), rating_work, [&](const HypernodeID id) {
+        ASSERT(id < _current_vertices.size());
+        const HypernodeID hn = _current_vertices[id];
+        if (current_hg.nodeIsEnabled(hn)) {
+          // We perform rating if ...
+          //  1.) The contraction limit of the current level is not reached
+          //  2.) Vertex hn is not matched before
+          const HypernodeID u = hn;
+          if (_matching_state[u] == STATE(MatchingState::UNMATCHED)) {
+            if (current_num_nodes > hierarchy_contraction_limit) {
+              ASSERT(current_hg.nodeIsEnabled(hn));
+              const Rating rating = _rater.template rate<has_fixed_vertices>(current_hg, hn,
+                cluster_ids, _cluster_weight, fixed_vertices, _context.coarsening.max_allowed_node_weight);
+              if ( _context.coarsening.use_two_hop_clustering ) {
+                // Cache the preferred target for two-hop clustering. A vertex
+                // without any preferred target points to itself.
+                _preferred_target[u] = rating.preferred_target != kInvalidHypernode ?
+                  rating.preferred_target : u;
+              }
+              if (rating.target != kInvalidHypernode) {
+                const HypernodeID v = rating.target;
+                HypernodeID& local_contracted_nodes = contracted_nodes.local();
+                matchVertices<has_fixed_vertices>(current_hg, u, v,
+                  cluster_ids, local_contracted_nodes, fixed_vertices);
+
+                // To maintain the current number of nodes of the hypergraph each PE sums up
+                // its number of contracted nodes locally. To compute the current number of
+                // nodes, we have to sum up the number of contracted nodes of each PE. This
+                // operation becomes more expensive the more PEs are participating in coarsening.
+                // In order to prevent expensive updates of the current number of nodes, we
+                // define a threshold which the local number of contracted nodes have to exceed
+                // before the current PE updates the current number of nodes. This threshold is defined
+                // by the distance to the current contraction limit divided by the number of PEs.
+                // Once one PE exceeds this bound the first time it is not possible that the
+                // contraction limit is reached, because otherwise an other PE would update
+                // the global current number of nodes before. After update the threshold is
+                // increased by the new difference (in number of nodes) to the contraction limit
+                // divided by the number of PEs.
+                if (local_contracted_nodes >= num_nodes_update_threshold.local()) {
+                  current_num_nodes = num_hns_before_pass -
+                                      contracted_nodes.combine(std::plus<HypernodeID>());
+                  const HypernodeID dist_to_contraction_limit =
+                    current_num_nodes > hierarchy_contraction_limit ?
+                    current_num_nodes - hierarchy_contraction_limit : 0;
+                  num_nodes_update_threshold.local() +=
+                    dist_to_contraction_limit / _context.shared_memory.original_num_threads;
+                }
               }
             }
           }
         }
+      });
+    }
+
+    if ( _context.coarsening.use_two_hop_clustering ) {
+      current_num_nodes = num_hns_before_pass - contracted_nodes.combine(std::plus<>());
+      const double reduction_vertices_percentage =
+        static_cast<double>(num_hns_before_pass) / static_cast<double>(current_num_nodes);
+      if ( reduction_vertices_percentage < _context.coarsening.two_hop_clustering_shrink_factor &&
+           current_num_nodes > hierarchy_contraction_limit ) {
+        DBG << "Clustering shrinks hypergraph only by factor" << reduction_vertices_percentage
+            << "-> perform two-hop clustering";
+        performTwoHopClustering<has_fixed_vertices>(current_hg, cluster_ids,
+          current_num_nodes - hierarchy_contraction_limit, contracted_nodes, fixed_vertices);
       }
-    });
+    }
+
     if ( _context.partition.show_detailed_clustering_timings ) {
       _timer.stop_timer("clustering_level_" + std::to_string(_pass_nr));
     }
@@ -334,6 +385,219 @@ class MultilevelCoarsener : public ICoarsener,
     return num_hns_before_pass - contracted_nodes.combine(std::plus<>());
   }
 
+  /*!
+   * Contracts all vertices fixed to the same block onto the fixed vertex of that
+   * block with the smallest ID. The fixed vertices are marked as matched afterwards,
+   * such that the rating loop skips them. Since all of them are fixed to the same block,
+   * the fixed vertex block weights do not change and we can bypass the locking in
+   * the fixed vertex support. Note that the resulting clusters may exceed the
+   * maximum allowed node weight, which prevents free vertices from joining them.
+   */
+  void precontractFixedVertices(const Hypergraph& current_hg,
+                                vec<HypernodeID>& cluster_ids,
+                                tbb::enumerable_thread_specific<HypernodeID>& contracted_nodes,
+                                const ds::FixedVertexSupport<Hypergraph>& fixed_vertices) {
+    const PartitionID k = fixed_vertices.numBlocks();
+    vec<CAtomic<HypernodeID>> representative(k, CAtomic<HypernodeID>(kInvalidHypernode));
+    tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID hn) {
+      if ( current_hg.nodeIsEnabled(hn) && fixed_vertices.isFixed(hn) ) {
+        CAtomic<HypernodeID>& rep = representative[fixed_vertices.fixedVertexBlock(hn)];
+        HypernodeID current_rep = rep.load(std::memory_order_relaxed);
+        while ( hn < current_rep && !rep.compare_exchange_weak(
+                  current_rep, hn, std::memory_order_relaxed) ) { }
+      }
+    });
+
+    // The weights are aggregated thread-locally, since all fixed vertices contribute to only k clusters
+    tbb::enumerable_thread_specific<vec<HypernodeWeight>> local_cluster_weights(vec<HypernodeWeight>(k, 0));
+    tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID hn) {
+      if ( current_hg.nodeIsEnabled(hn) && fixed_vertices.isFixed(hn) ) {
+        const PartitionID block = fixed_vertices.fixedVertexBlock(hn);
+        const HypernodeID rep = representative[block].load(std::memory_order_relaxed);
+        if ( hn != rep ) {
+          cluster_ids[hn] = rep;
+          local_cluster_weights.local()[block] += current_hg.nodeWeight(hn);
+          ++contracted_nodes.local();
+        }
+        _rater.markAsMatched(hn);
+        _matching_state[hn].store(STATE(MatchingState::MATCHED), std::memory_order_relaxed);
+      }
+    });
+    for ( const vec<HypernodeWeight>& cluster_weights : local_cluster_weights ) {
+      for ( PartitionID block = 0; block < k; ++block ) {
+        if ( cluster_weights[block] > 0 ) {
+          _cluster_weight[representative[block].load(std::memory_order_relaxed)].fetch_add(
+            cluster_weights[block], std::memory_order_relaxed);
+        }
+      }
+    }
+  }
+
+  /*!
+   * On hypergraphs with a skewed degree distribution, many vertices (e.g., leaves
+   * attached to a hub) remain unclustered after a clustering pass, since their
+   * preferred cluster already reached the maximum allowed node weight. Two-hop
+   * clustering groups unclustered vertices that prefer the same cluster with each
+   * other. The preferred cluster of a vertex is computed by the rating function
+   * while ignoring the weight constraint. It is cached when the vertex is rated
+   * in the clustering pass, such that the rating is only recomputed for vertices
+   * that were not rated before (e.g., the matching partner of a vertex failed
+   * to join its cluster). The first unclustered vertex that
+   * prefers a cluster becomes the leader of the group and all succeeding vertices
+   * join the cluster of the leader. If joining is not possible due to the weight
+   * constraint, the vertex becomes the new leader.
+   */
+  template<bool has_fixed_vertices>
+  void performTwoHopClustering(const Hypergraph& current_hg,
+                               vec<HypernodeID>& cluster_ids,
+                               const HypernodeID max_contracted_nodes,
+                               tbb::enumerable_thread_specific<HypernodeID>& contracted_nodes,
+                               ds::FixedVertexSupport<Hypergraph>& fixed_vertices) {
+    // After clustering, _matching_partner[v] = v holds for all vertices. We use
+    // it to store the leader of the group of vertices that prefer cluster v.
+    ASSERT([&] {
+      for ( const HypernodeID& hn : current_hg.nodes() ) {
+        if ( _matching_partner[hn] != hn ) return false;
+      }
+      return true;
+    }());
+
+    const HypernodeWeight unconstrained_weight = current_hg.totalWeight();
+    CAtomic<HypernodeID> num_contracted_nodes(0);
+    tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID id) {
+      const HypernodeID u = _current_vertices[id];
+      if ( !current_hg.nodeIsEnabled(u) || cluster_ids[u] != u ||
+           _cluster_weight[u].load(std::memory_order_relaxed) != current_hg.nodeWeight(u) ||
+           num_contracted_nodes.load(std::memory_order_relaxed) >= max_contracted_nodes ) {
+        // Vertex is already part of a cluster or we reached the contraction limit
+        return;
+      }
+
+      HypernodeID preferred_target = _preferred_target[u];
+      if ( preferred_target == kInvalidHypernode ) {
+        const Rating rating = _rater.template rate<has_fixed_vertices>(current_hg, u,
+          cluster_ids, _cluster_weight, fixed_vertices, unconstrained_weight);
+        preferred_target = rating.target != kInvalidHypernode ? rating.target : u;
+      }
+      if ( preferred_target == u ) {
+        return;
+      }
+
+      const HypernodeID preferred = cluster_ids[preferred_target];
+      HypernodeID leader = _matching_partner[preferred].load(std::memory_order_relaxed);
+      while ( true ) {
+        if ( leader == preferred ) {
+          // First vertex that prefers this cluster => u becomes the leader
+          if ( _matching_partner[preferred].compare_exchange_strong(leader, u, std::memory_order_acq_rel) ) {
+            break;
+          }
+        } else {
+          HypernodeID local_contracted_nodes = 0;
+          if ( joinCluster<has_fixed_vertices>(current_hg, u, leader,
+                 cluster_ids, local_contracted_nodes, fixed_vertices) ) {
+            contracted_nodes.local() += local_contracted_nodes;
+            num_contracted_nodes.fetch_add(local_contracted_nodes, std::memory_order_relaxed);
+            break;
+          }
+          // Cluster of the leader is too heavy => u becomes the new leader
+          if ( _matching_partner[preferred].compare_exchange_strong(leader, u, std::memory_order_acq_rel) ) {
+            break;
+          }
+        }
+      }
+    });
+
+    // Restore invariant that _matching_partner[v] = v
+    tbb::parallel_for(ID(0), current_hg.initialNumNodes(), [&](const HypernodeID hn) {
+      _matching_partner[hn].store(hn, std::memory_order_relaxed);
+    });
+    DBG << "Two-hop clustering contracted" << num_contracted_nodes.load() << "vertices";
+  }
+
+  /*!
+   * Alternative to the CAS-based matching of performClustering(...) that never retries.
+   * The (shuffled) vertices are processed in sub-rounds. In each sub-round, all unmatched
+   * vertices of the sub-round first propose the cluster they want to join (stored in
+   * _matching_partner). Afterwards, the proposals are resolved without waiting on other vertices:
+   *   1.) If u and v propose each other, the vertex with the larger ID joins the other one
+   *   2.) If u proposes v and v itself leaves for cluster w, u joins w instead (if w does
+   *       not leave as well, otherwise u remains unmatched)
+   *   3.) The weight of the target cluster is reserved atomically before a vertex joins it,
+   *       such that concurrent joins never exceed the maximum allowed node weight
+   * Ratings of a sub-round observe the clusters formed in all previous sub-rounds.
+   */
+  template<bool has_fixed_vertices, typename WorkFunc>
+  void performProposeResolveClustering(const Hypergraph& current_hg,
+                                       vec<HypernodeID>& cluster_ids,
+                                       const HypernodeID num_hns_before_pass,
+                                       const HypernodeID hierarchy_contraction_limit,
+                                       const WorkFunc& rating_work,
+                                       tbb::enumerable_thread_specific<HypernodeID>& contracted_nodes,
+                                       ds::FixedVertexSupport<Hypergraph>& fixed_vertices) {
+    const HypernodeID num_nodes = current_hg.initialNumNodes();
+    const HypernodeID num_sub_rounds = std::max(ID(1),
+      static_cast<HypernodeID>(_context.coarsening.num_sub_rounds_propose_resolve));
+    const HypernodeID sub_round_size = parallel::chunking::idiv_ceil(num_nodes, num_sub_rounds);
+    // Vertex u leaves its cluster, if it proposed an other cluster and does not become
+    // the representative of a mutual proposal
+    auto leaves_cluster = [&](const HypernodeID u) {
+      const HypernodeID v = _matching_partner[u].load(std::memory_order_relaxed);
+      return v != u && ( _matching_partner[v].load(std::memory_order_relaxed) != u || u > v );
+    };
+
+    HypernodeID current_num_nodes = num_hns_before_pass - contracted_nodes.combine(std::plus<>());
+    for ( HypernodeID sub_round = 0; sub_round < num_sub_rounds &&
+            current_num_nodes > hierarchy_contraction_limit; ++sub_round ) {
+      const HypernodeID first = std::min(num_nodes, sub_round * sub_round_size);
+      const HypernodeID last = std::min(num_nodes, first + sub_round_size);
+
+      // Propose
+      parallel::weighted_parallel_for(first, last, rating_work, [&](const HypernodeID id) {
+        const HypernodeID u = _current_vertices[id];
+        if ( current_hg.nodeIsEnabled(u) && _matching_state[u] == STATE(MatchingState::UNMATCHED) ) {
+          const Rating rating = _rater.template rate<has_fixed_vertices>(current_hg, u,
+            cluster_ids, _cluster_weight, fixed_vertices, _context.coarsening.max_allowed_node_weight);
+          if ( _context.coarsening.use_two_hop_clustering ) {
+            _preferred_target[u] = rating.preferred_target != kInvalidHypernode ?
+              rating.preferred_target : u;
+          }
+          if ( rating.target != kInvalidHypernode ) {
+            _matching_partner[u].store(rating.target, std::memory_order_relaxed);
+          }
+        }
+      });
+
+      // Resolve
+      tbb::parallel_for(first, last, [&](const HypernodeID id) {
+        const HypernodeID u = _current_vertices[id];
+        if ( leaves_cluster(u) ) {
+          HypernodeID target = _matching_partner[u].load(std::memory_order_relaxed);
+          if ( leaves_cluster(target) ) {
+            target = _matching_partner[target].load(std::memory_order_relaxed);
+            ASSERT(target != u);
+            if ( leaves_cluster(target) ) {
+              return;
+            }
+          }
+          if ( reserveWeightAndJoinCluster<has_fixed_vertices>(current_hg, u, target,
+                 cluster_ids, contracted_nodes.local(), fixed_vertices) ) {
+            _rater.markAsMatched(u);
+            _rater.markAsMatched(target);
+            _matching_state[u].store(STATE(MatchingState::MATCHED), std::memory_order_relaxed);
+            _matching_state[target].store(STATE(MatchingState::MATCHED), std::memory_order_relaxed);
+          }
+        }
+      });
+
+      // Restore invariant that _matching_partner[v] = v
+      tbb::parallel_for(first, last, [&](const HypernodeID id) {
+        const HypernodeID u = _current_vertices[id];
+        _matching_partner[u].store(u, std::memory_order_relaxed);
+      });
+      current_num_nodes = num_hns_before_pass - contracted_nodes.combine(std::plus<>());
+    }
+  }
+
   void terminateImpl() override {
     _progress_bar += (_initial_num_nodes - _progress_bar.count());
     _progress_bar.disable();
@@ -486,6 +750,35 @@ class MultilevelCoarsener : public ICoarsener,
     return success;
   }
 
+  // ! Same as joinCluster(...), but reserves the weight of u in the target cluster before
+  // ! checking the weight constraint. Thus, concurrent joins never exceed the maximum allowed
+  // ! node weight (at the cost of spuriously rejecting joins that would fit after a rollback).
+  template<bool has_fixed_vertices>
+  bool reserveWeightAndJoinCluster(const Hypergraph& hypergraph,
+                                   const HypernodeID u,
+                                   const HypernodeID rep,
+                                   vec<HypernodeID>& cluster_ids,
+                                   HypernodeID& contracted_nodes,
+                                   ds::FixedVertexSupport<Hypergraph>& fixed_vertices) {
+    ASSERT(rep == cluster_ids[rep]);
+    const HypernodeWeight weight_of_u = hypergraph.nodeWeight(u);
+    const HypernodeWeight weight_of_rep = _cluster_weight[rep].fetch_add(weight_of_u, std::memory_order_relaxed);
+    bool cluster_join_operation_allowed =
+      weight_of_u + weight_of_rep <= _context.coarsening.max_allowed_node_weight;
+    if constexpr ( has_fixed_vertices ) {
+      if ( cluster_join_operation_allowed ) {
+        cluster_join_operation_allowed = fixed_vertices.contract(rep, u);
+      }
+    }
+    if ( cluster_join_operation_allowed ) {
+      cluster_ids[u] = rep;
+      ++contracted_nodes;
+    } else {
+      _cluster_weight[rep].fetch_sub(weight_of_u, std::memory_order_relaxed);
+    }
+    return cluster_join_operation_allowed;
+  }
+
   HypernodeID currentNumberOfNodesImpl() const override {
     return Base::currentNumNodes();
   }
@@ -518,6 +811,7 @@ class MultilevelCoarsener : public ICoarsener,
   parallel::scalable_vector<AtomicMatchingState> _matching_state;
   parallel::scalable_vector<AtomicWeight> _cluster_weight;
   parallel::scalable_vector<AtomicID> _matching_partner;
+  parallel::scalable_vector<HypernodeID> _preferred_target;
   int _pass_nr;
   utils::ProgressBar _progress_bar;
   bool _enable_randomization;
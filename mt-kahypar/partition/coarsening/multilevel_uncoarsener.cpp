@@ -91,14 +91,19 @@ namespace mt_kahypar {
       partitioned_hg.resetData();
       GainCachePtr::resetGainCache(_gain_cache);
 
-      // Assign nodes of current level to their corresponding representative of the previous level
-      partitioned_hg.doParallelForAllNodes([&](const HypernodeID hn) {
-        const HypernodeID coarse_hn = (_uncoarseningData.hierarchy)[_current_level].mapToContractedHypergraph(hn);
-        const PartitionID block = _block_ids[coarse_hn];
+      // Assign nodes of current level to their corresponding representative of the previous level.
+      // Block weights and pin counts are initialized in the same sweeps over the nodes and pins.
+      const auto& level = (_uncoarseningData.hierarchy)[_current_level];
+      partitioned_hg.initializePartition([&](const HypernodeID hn) {
+        const PartitionID block = _block_ids[level.mapToContractedHypergraph(hn)];
         ASSERT(block != kInvalidPartition && block < partitioned_hg.k());
-        partitioned_hg.setOnlyNodePart(hn, block);
+        return block;
       });
-      partitioned_hg.initializePartition();
+      if ( _uncoarseningData.release_processed_levels ) {
+        // The coarser level is not required any more, which reduces
+        // the peak memory consumption of the uncoarsening phase
+        (_uncoarseningData.hierarchy)[_current_level].release();
+      }
       _timer.stop_timer("projecting_partition");
 
       // Improve partition
@@ -193,6 +198,12 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void MultilevelUncoarsener<TypeTraits>::refineImpl() {
+    if ( _context.isTimeLimitExceeded() ) {
+      // Only project the partition to the next level. Balance is
+      // restored by the rebalancer on the top-level hypergraph.
+      return;
+    }
+
     PartitionedHypergraph& partitioned_hypergraph = *_uncoarseningData.partitioned_hg;
     double time_limit = std::numeric_limits<double>::max();
     if (_current_level >= 0 && _current_level != _num_levels) {
@@ -207,6 +218,7 @@ namespace mt_kahypar {
       << ", imbalance = " << _current_metrics.imbalance;
     }
 
+    _refinement_scheduler.nextLevel();
     parallel::scalable_vector<HypernodeID> dummy;
     bool improvement_found = true;
     mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
@@ -219,43 +231,55 @@ namespace mt_kahypar {
       }
 
       if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_lp_refiner", "Initialize LP Refiner");
-        _label_propagation->initialize(phg);
-        _timer.stop_timer("initialize_lp_refiner");
-
-        _timer.start_timer("label_propagation", "Label Propagation");
-        improvement_found |= _label_propagation->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("label_propagation");
+        improvement_found |= _refinement_scheduler.run(RefinerType::label_propagation, _current_metrics, [&] {
+          _timer.start_timer("initialize_lp_refiner", "Initialize LP Refiner");
+          _label_propagation->initialize(phg);
+          _timer.stop_timer("initialize_lp_refiner");
+
+          _timer.start_timer("label_propagation", "Label Propagation");
+          const bool improved = _label_propagation->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("label_propagation");
+          return improved;
+        });
       }
 
       if ( _jet && _context.refinement.jet.algorithm != JetAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_jet_refiner", "Initialize Jet Refiner");
-        _jet->initialize(phg);
-        _timer.stop_timer("initialize_jet_refiner");
-
-        _timer.start_timer("jet", "Jet");
-        improvement_found |= _jet->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("jet");
+        improvement_found |= _refinement_scheduler.run(RefinerType::jet, _current_metrics, [&] {
+          _timer.start_timer("initialize_jet_refiner", "Initialize Jet Refiner");
+          _jet->initialize(phg);
+          _timer.stop_timer("initialize_jet_refiner");
+
+          _timer.start_timer("jet", "Jet");
+          const bool improved = _jet->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("jet");
+          return improved;
+        });
       }
 
       if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_fm_refiner", "Initialize FM Refiner");
-        _fm->initialize(phg);
-        _timer.stop_timer("initialize_fm_refiner");
-
-        _timer.start_timer("fm", "FM");
-        improvement_found |= _fm->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("fm");
+        improvement_found |= _refinement_scheduler.run(RefinerType::fm, _current_metrics, [&] {
+          _timer.start_timer("initialize_fm_refiner", "Initialize FM Refiner");
+          _fm->initialize(phg);
+          _timer.stop_timer("initialize_fm_refiner");
+
+          _timer.start_timer("fm", "FM");
+          const bool improved = _fm->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("fm");
+          return improved;
+        });
       }
 
       if ( _flows && _context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
-        _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
-        _flows->initialize(phg);
-        _timer.stop_timer("initialize_flow_scheduler");
-
-        _timer.start_timer("flow_refinement_scheduler", "Flow Refinement Scheduler");
-        improvement_found |= _flows->refine(phg, dummy, _current_metrics, time_limit);
-        _timer.stop_timer("flow_refinement_scheduler");
+        improvement_found |= _refinement_scheduler.run(RefinerType::flows, _current_metrics, [&] {
+          _timer.start_timer("initialize_flow_scheduler", "Initialize Flow Scheduler");
+          _flows->initialize(phg);
+          _timer.stop_timer("initialize_flow_scheduler");
+
+          _timer.start_timer("flow_refinement_scheduler", "Flow Refinement Scheduler");
+          const bool improved = _flows->refine(phg, dummy, _current_metrics, time_limit);
+          _timer.stop_timer("flow_refinement_scheduler");
+          return improved;
+        });
       }
 
       if ( _context.type == ContextType::main ) {
@@ -268,7 +292,8 @@ namespace mt_kahypar {
       const double relative_improvement = 1.0 -
         static_cast<double>(metric_after) / metric_before;
       if ( !_context.refinement.refine_until_no_improvement ||
-           relative_improvement <= _context.refinement.relative_improvement_threshold ) {
+           relative_improvement <= _context.refinement.relative_improvement_threshold ||
+           _context.isTimeLimitExceeded() ) {
         break;
       }
     }
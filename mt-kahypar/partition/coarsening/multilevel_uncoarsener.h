@@ -32,6 +32,7 @@
 #include "mt-kahypar/partition/coarsening/coarsening_commons.h"
 #include "mt-kahypar/partition/coarsening/i_uncoarsener.h"
 #include "mt-kahypar/partition/coarsening/uncoarsener_base.h"
+#include "mt-kahypar/partition/refinement/adaptive_refinement_scheduler.h"
 #include "mt-kahypar/utils/progress_bar.h"
 
 namespace mt_kahypar {
@@ -61,6 +62,7 @@ class MultilevelUncoarsener : public IUncoarsener<TypeTraits>,
       _num_levels(0),
       _block_ids(hypergraph.initialNumNodes(), kInvalidPartition),
       _current_metrics(),
+      _refinement_scheduler(context.refinement),
       _progress(hypergraph.initialNumNodes(), 0, false) { }
 
   MultilevelUncoarsener(const MultilevelUncoarsener&) = delete;
@@ -109,6 +111,7 @@ class MultilevelUncoarsener : public IUncoarsener<TypeTraits>,
   int _num_levels;
   ds::Array<PartitionID> _block_ids;
   Metrics _current_metrics;
+  AdaptiveRefinementScheduler _refinement_scheduler;
   utils::ProgressBar _progress;
 };
 
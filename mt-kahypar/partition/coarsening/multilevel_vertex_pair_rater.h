@@ -40,6 +40,8 @@
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_fixed_vertex_acceptance_policy.h"
+#include "mt-kahypar/utils/hash.h"
+#include "mt-kahypar/utils/prefetch.h"
 
 
 namespace mt_kahypar {
@@ -61,11 +63,13 @@ class MultilevelVertexPairRater {
    public:
     VertexPairRating(HypernodeID trgt, RatingType val, bool is_valid) :
       target(trgt),
+      preferred_target(trgt),
       value(val),
       valid(is_valid) { }
 
     VertexPairRating() :
       target(std::numeric_limits<HypernodeID>::max()),
+      preferred_target(std::numeric_limits<HypernodeID>::max()),
       value(std::numeric_limits<RatingType>::min()),
       valid(false) { }
 
@@ -76,6 +80,9 @@ class MultilevelVertexPairRater {
     VertexPairRating & operator= (VertexPairRating &&) = delete;
 
     HypernodeID target;
+    // ! Best rated target without considering the maximum allowed node weight
+    // ! (only computed if two-hop clustering is enabled)
+    HypernodeID preferred_target;
     RatingType value;
     bool valid;
   };
@@ -96,7 +103,9 @@ class MultilevelVertexPairRater {
                             const Context& context) :
     _context(context),
     _current_num_nodes(num_hypernodes),
+    _track_preferred_target(context.coarsening.use_two_hop_clustering),
     _vertex_degree_sampling_threshold(context.coarsening.vertex_degree_sampling_threshold),
+    _pin_sampling_threshold(context.coarsening.rating.pin_sampling_threshold),
     _local_cache_efficient_rating_map(0.0),
     _local_vertex_degree_bounded_rating_map(3UL * _vertex_degree_sampling_threshold, 0.0),
     _local_large_rating_map([&] {
@@ -106,6 +115,7 @@ class MultilevelVertexPairRater {
     _bloom_filter_mask(align_to_next_power_of_two(
       std::min(ID(10) * max_edge_size, _current_num_nodes)) - 1),
     _local_bloom_filter(_bloom_filter_mask + 1),
+    _local_representatives(),
     _already_matched(num_hypernodes) { }
 
   MultilevelVertexPairRater(const MultilevelVertexPairRater&) = delete;
@@ -176,12 +186,15 @@ class MultilevelVertexPairRater {
     RatingType max_rating = std::numeric_limits<RatingType>::min();
     HypernodeID target = std::numeric_limits<HypernodeID>::max();
     HypernodeID target_id = std::numeric_limits<HypernodeID>::max();
+    RatingType max_preferred_rating = std::numeric_limits<RatingType>::min();
+    HypernodeID preferred_target = std::numeric_limits<HypernodeID>::max();
     for (auto it = tmp_ratings.end() - 1; it >= tmp_ratings.begin(); --it) {
       const HypernodeID tmp_target_id = it->key;
       const HypernodeID tmp_target = tmp_target_id;
       const HypernodeWeight target_weight = cluster_weight[tmp_target_id];
+      const bool satisfies_weight_constraint = weight_u + target_weight <= max_allowed_node_weight;
 
-      if ( tmp_target != u && weight_u + target_weight <= max_allowed_node_weight ) {
+      if ( tmp_target != u && ( satisfies_weight_constraint || _track_preferred_target ) ) {
         HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u, target_weight);
         penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
         const RatingType tmp_rating = it->value / static_cast<double>(penalty);
@@ -195,17 +208,24 @@ class MultilevelVertexPairRater {
 
         DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
         if ( accept_fixed_vertex_contraction &&
-             community_u_id == hypergraph.communityID(tmp_target) &&
-             AcceptancePolicy::acceptRating( tmp_rating, max_rating,
-               target_id, tmp_target_id, cpu_id, _already_matched) ) {
-          max_rating = tmp_rating;
-          target_id = tmp_target_id;
-          target = tmp_target;
+             community_u_id == hypergraph.communityID(tmp_target) ) {
+          if ( satisfies_weight_constraint &&
+               AcceptancePolicy::acceptRating( tmp_rating, max_rating,
+                 target_id, tmp_target_id, cpu_id, _already_matched) ) {
+            max_rating = tmp_rating;
+            target_id = tmp_target_id;
+            target = tmp_target;
+          }
+          if ( _track_preferred_target && tmp_rating > max_preferred_rating ) {
+            max_preferred_rating = tmp_rating;
+            preferred_target = tmp_target;
+          }
         }
       }
     }
 
     VertexPairRating ret;
+    ret.preferred_target = preferred_target;
     if (max_rating != std::numeric_limits<RatingType>::min()) {
       ASSERT(target != std::numeric_limits<HypernodeID>::max(), "invalid contraction target");
       ret.value = max_rating;
@@ -222,32 +242,47 @@ class MultilevelVertexPairRater {
                      RatingMap& tmp_ratings,
                      const parallel::scalable_vector<HypernodeID>& cluster_ids) {
     if constexpr (Hypergraph::is_graph) {
-      for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+      utils::forEachWithLookahead(hypergraph.incidentEdges(u), [&](const HyperedgeID& he) {
+        utils::prefetch(cluster_ids.data() + hypergraph.edgeTarget(he));
+      }, [&](const HyperedgeID& he) {
         const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he), hypergraph.edgeSize(he));
         const HypernodeID representative = cluster_ids[hypergraph.edgeTarget(he)];
         ASSERT(representative < hypergraph.initialNumNodes());
         tmp_ratings[representative] += score;
-      }
+      });
     } else {
       kahypar::ds::FastResetFlagArray<>& bloom_filter = _local_bloom_filter.local();
+      vec<HypernodeID>& representatives = _local_representatives.local();
       for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
         HypernodeID edge_size = hypergraph.edgeSize(he);
         ASSERT(edge_size > 1, V(he));
         if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
-          edge_size = _context.coarsening.use_adaptive_edge_size ?
-            std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
-          const RatingType score = ScorePolicy::score(
-            hypergraph.edgeWeight(he), edge_size);
-          for ( const HypernodeID& v : hypergraph.pins(he) ) {
-            const HypernodeID representative = cluster_ids[v];
-            ASSERT(representative < hypergraph.initialNumNodes());
-            const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
-            if ( !bloom_filter[bloom_filter_rep] ) {
+          if ( edge_size > _pin_sampling_threshold ) {
+            fillRatingMapWithSampledPins(hypergraph, u, he, bloom_filter, tmp_ratings, cluster_ids, representatives);
+          } else if ( _context.coarsening.use_adaptive_edge_size ) {
+            collectDistinctRepresentatives(hypergraph, he, bloom_filter, cluster_ids, representatives);
+            const RatingType score = ScorePolicy::score(hypergraph.edgeWeight(he),
+              std::max(static_cast<HypernodeID>(representatives.size()), ID(2)));
+            for ( const HypernodeID& representative : representatives ) {
               tmp_ratings[representative] += score;
-              bloom_filter.set(bloom_filter_rep, true);
             }
+            representatives.clear();
+          } else {
+            const RatingType score = ScorePolicy::score(
+              hypergraph.edgeWeight(he), edge_size);
+            utils::forEachWithLookahead(hypergraph.pins(he), [&](const HypernodeID& v) {
+              utils::prefetch(cluster_ids.data() + v);
+            }, [&](const HypernodeID& v) {
+              const HypernodeID representative = cluster_ids[v];
+              ASSERT(representative < hypergraph.initialNumNodes());
+              const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
+              if ( !bloom_filter[bloom_filter_rep] ) {
+                tmp_ratings[representative] += score;
+                bloom_filter.set(bloom_filter_rep, true);
+              }
+            });
+            bloom_filter.reset();
           }
-          bloom_filter.reset();
         }
       }
     }
@@ -274,51 +309,126 @@ class MultilevelVertexPairRater {
       }
     } else {
       kahypar::ds::FastResetFlagArray<>& bloom_filter = _local_bloom_filter.local();
+      vec<HypernodeID>& representatives = _local_representatives.local();
       for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
         HypernodeID edge_size = hypergraph.edgeSize(he);
         if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
-          edge_size = _context.coarsening.use_adaptive_edge_size ?
-            std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
+          if ( edge_size > _pin_sampling_threshold ) {
+            // Break if number of accesses to the tmp rating map would exceed
+            // vertex degree sampling threshold
+            if ( num_tmp_rating_map_accesses + _pin_sampling_threshold > _vertex_degree_sampling_threshold ) {
+              break;
+            }
+            num_tmp_rating_map_accesses += fillRatingMapWithSampledPins(
+              hypergraph, u, he, bloom_filter, tmp_ratings, cluster_ids, representatives);
+            continue;
+          }
+          const bool use_adaptive_edge_size = _context.coarsening.use_adaptive_edge_size;
+          if ( use_adaptive_edge_size ) {
+            collectDistinctRepresentatives(hypergraph, he, bloom_filter, cluster_ids, representatives);
+            edge_size = std::max(static_cast<HypernodeID>(representatives.size()), ID(2));
+          }
           // Break if number of accesses to the tmp rating map would exceed
           // vertex degree sampling threshold
           if ( num_tmp_rating_map_accesses + edge_size > _vertex_degree_sampling_threshold  ) {
+            representatives.clear();
             break;
           }
           const RatingType score = ScorePolicy::score(
             hypergraph.edgeWeight(he), edge_size);
-          for ( const HypernodeID& v : hypergraph.pins(he) ) {
-            const HypernodeID representative = cluster_ids[v];
-            ASSERT(representative < hypergraph.initialNumNodes());
-            const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
-            if ( !bloom_filter[bloom_filter_rep] ) {
+          if ( use_adaptive_edge_size ) {
+            for ( const HypernodeID& representative : representatives ) {
               tmp_ratings[representative] += score;
-              bloom_filter.set(bloom_filter_rep, true);
-              ++num_tmp_rating_map_accesses;
             }
+            num_tmp_rating_map_accesses += representatives.size();
+            representatives.clear();
+          } else {
+            for ( const HypernodeID& v : hypergraph.pins(he) ) {
+              const HypernodeID representative = cluster_ids[v];
+              ASSERT(representative < hypergraph.initialNumNodes());
+              const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
+              if ( !bloom_filter[bloom_filter_rep] ) {
+                tmp_ratings[representative] += score;
+                bloom_filter.set(bloom_filter_rep, true);
+                ++num_tmp_rating_map_accesses;
+              }
+            }
+            bloom_filter.reset();
           }
-          bloom_filter.reset();
         }
       }
     }
   }
 
-  template<typename Hypergraph>
-  inline HypernodeID adaptiveEdgeSize(const Hypergraph& hypergraph,
+  /*!
+   * Rates the clusters of a net with more pins than the pin sampling threshold by visiting only
+   * pin_sampling_threshold of its pins. The pins are chosen with a fixed stride starting at a
+   * pseudo-random offset (derived from u and he, so the rating remains deterministic). The score
+   * of each sampled cluster is scaled by edge_size / #sampled pins, which is an unbiased estimate
+   * for clusters that contain one pin of the net. Returns the number of rated clusters.
+   */
+  template<typename Hypergraph, typename RatingMap>
+  size_t fillRatingMapWithSampledPins(const Hypergraph& hypergraph,
+                                      const HypernodeID u,
                                       const HyperedgeID he,
                                       kahypar::ds::FastResetFlagArray<>& bloom_filter,
-                                      const parallel::scalable_vector<HypernodeID>& cluster_ids) {
-    HypernodeID edge_size = 0;
+                                      RatingMap& tmp_ratings,
+                                      const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                      vec<HypernodeID>& representatives) {
+    ASSERT(representatives.empty());
+    const HypernodeID edge_size = hypergraph.edgeSize(he);
+    const HypernodeID num_samples = std::max(_pin_sampling_threshold, ID(1));
+    ASSERT(num_samples < edge_size);
+    const HypernodeID stride = edge_size / num_samples;
+    const HypernodeID offset = hashing::integer::hash64(
+      (static_cast<uint64_t>(u) << 32) | static_cast<uint64_t>(he)) % edge_size;
+    auto pins = hypergraph.pins(he);
+    for ( HypernodeID i = 0; i < num_samples; ++i ) {
+      const HypernodeID v = *(pins.begin() + ((offset + i * stride) % edge_size));
+      const HypernodeID representative = cluster_ids[v];
+      ASSERT(representative < hypergraph.initialNumNodes());
+      const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
+      if ( !bloom_filter[bloom_filter_rep] ) {
+        representatives.push_back(representative);
+        bloom_filter.set(bloom_filter_rep, true);
+      }
+    }
+    bloom_filter.reset();
+
+    const double scaling_factor = static_cast<double>(edge_size) / num_samples;
+    const HypernodeID estimated_edge_size = _context.coarsening.use_adaptive_edge_size ?
+      std::max(static_cast<HypernodeID>(std::min(static_cast<double>(edge_size),
+        representatives.size() * scaling_factor)), ID(2)) : edge_size;
+    const RatingType score = scaling_factor *
+      ScorePolicy::score(hypergraph.edgeWeight(he), estimated_edge_size);
+    for ( const HypernodeID& representative : representatives ) {
+      tmp_ratings[representative] += score;
+    }
+    const size_t num_rated_clusters = representatives.size();
+    representatives.clear();
+    return num_rated_clusters;
+  }
+
+  // ! Collects the distinct cluster representatives of the pins of a hyperedge. Their
+  // ! number is the adaptive edge size. This way, computing the adaptive edge size and
+  // ! accumulating the ratings only requires a single pass over the pins.
+  template<typename Hypergraph>
+  inline void collectDistinctRepresentatives(const Hypergraph& hypergraph,
+                                             const HyperedgeID he,
+                                             kahypar::ds::FastResetFlagArray<>& bloom_filter,
+                                             const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                             vec<HypernodeID>& representatives) {
+    ASSERT(representatives.empty());
     for ( const HypernodeID& v : hypergraph.pins(he) ) {
       const HypernodeID representative = cluster_ids[v];
       ASSERT(representative < hypergraph.initialNumNodes());
       const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
       if ( !bloom_filter[bloom_filter_rep] ) {
-        ++edge_size;
+        representatives.push_back(representative);
         bloom_filter.set(bloom_filter_rep, true);
       }
     }
     bloom_filter.reset();
-    return edge_size;
   }
 
   template<typename Hypergraph>
@@ -352,8 +462,9 @@ class MultilevelVertexPairRater {
       HypernodeID ub_neighbors_u = 0;
       for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
         const HypernodeID edge_size = hypergraph.edgeSize(he);
-        // Ignore large hyperedges
-        ub_neighbors_u += edge_size < _context.partition.ignore_hyperedge_size_threshold ? edge_size : 0;
+        // Ignore large hyperedges (and only count the sampled pins of nets above the pin sampling threshold)
+        ub_neighbors_u += edge_size < _context.partition.ignore_hyperedge_size_threshold ?
+          std::min(edge_size, _pin_sampling_threshold) : 0;
         // If the number of estimated neighbors is greater than the size of the cache efficient rating map / 3, we
         // use the large sparse map. The division by 3 also ensures that the fill grade
         // of the cache efficient sparse map would be small enough such that linear probing
@@ -382,8 +493,12 @@ class MultilevelVertexPairRater {
   const Context& _context;
   // ! Number of nodes of the current hypergraph
   HypernodeID _current_num_nodes;
+  // ! If true, the best target without considering the weight constraint is also computed
+  const bool _track_preferred_target;
   // ! Maximum number of neighbors that are considered for rating
   size_t _vertex_degree_sampling_threshold;
+  // ! Nets with more pins are rated by visiting only this number of pins
+  const HypernodeID _pin_sampling_threshold;
 
   // ! Cache efficient rating map (with linear probing) that is used if the
   // ! estimated number of neighbors smaller than 10922 (= 32768 / 3)
@@ -401,6 +516,8 @@ class MultilevelVertexPairRater {
   // ! we use this bloom filter.
   size_t _bloom_filter_mask;
   ThreadLocalFastResetFlagArray _local_bloom_filter;
+  // ! Thread-local buffer for the distinct cluster representatives of a hyperedge
+  tbb::enumerable_thread_specific<vec<HypernodeID>> _local_representatives;
 
   // ! Marks all matched vertices
   kahypar::ds::FastResetFlagArray<> _already_matched;
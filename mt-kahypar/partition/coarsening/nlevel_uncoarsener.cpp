@@ -310,10 +310,13 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void NLevelUncoarsener<TypeTraits>::localizedRefine(PartitionedHypergraph& partitioned_hypergraph) {
-    // Copy all border nodes into one vector
-    vec<HypernodeID> refinement_nodes = _tmp_refinement_nodes.copy_parallel();
-    _tmp_refinement_nodes.clear_parallel();
+    // Copy all border nodes into one vector (the buffers are reused for all batches)
+    _tmp_refinement_nodes.copy_parallel(_refinement_nodes);
+    _tmp_refinement_nodes.clear_sequential();
     _border_vertices_of_batch.reset();
+    if ( _context.isTimeLimitExceeded() ) {
+      return;
+    }
 
     if ( debug && _context.type == ContextType::main ) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
@@ -331,14 +334,14 @@ namespace mt_kahypar {
       if ( _label_propagation && _context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
         _timer.start_timer("local_label_propagation", "Label Propagation", false, _force_measure_timings);
         improvement_found |= _label_propagation->refine(phg,
-          refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
+          _refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
         _timer.stop_timer("local_label_propagation", _force_measure_timings);
       }
 
       if ( _fm && _context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
         _timer.start_timer("local_fm", "FM", false, _force_measure_timings);
         improvement_found |= _fm->refine(phg,
-          refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
+          _refinement_nodes, _current_metrics, std::numeric_limits<double>::max());
         _timer.stop_timer("local_fm", _force_measure_timings);
       }
 
@@ -362,7 +365,7 @@ namespace mt_kahypar {
   template<typename TypeTraits>
   void NLevelUncoarsener<TypeTraits>::globalRefine(PartitionedHypergraph& partitioned_hypergraph,
                                        const double time_limit) {
-    if ( _context.refinement.global.use_global_refinement ) {
+    if ( _context.refinement.global.use_global_refinement && !_context.isTimeLimitExceeded() ) {
       if ( debug && _context.type == ContextType::main ) {
         io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
           _context, "Refinement Hypergraph", false);
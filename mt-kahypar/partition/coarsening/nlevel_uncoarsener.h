@@ -96,6 +96,7 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
     _global_label_propagation(nullptr),
     _global_fm(nullptr),
     _tmp_refinement_nodes(),
+    _refinement_nodes(),
     _border_vertices_of_batch(hypergraph.initialNumNodes()),
     _stats(context),
     _current_metrics(),
@@ -167,6 +168,8 @@ class NLevelUncoarsener : public IUncoarsener<TypeTraits>,
   std::unique_ptr<IRefiner> _global_fm;
 
   ds::StreamingVector<HypernodeID> _tmp_refinement_nodes;
+  // ! Border vertices of the current batch, reused for all batches
+  vec<HypernodeID> _refinement_nodes;
   kahypar::ds::FastResetFlagArray<> _border_vertices_of_batch;
 
   NLevelStats _stats;
@@ -52,43 +52,38 @@ class FixedVertexAcceptancePolicy final : public kahypar::meta::PolicyBase {
     // 3.) u = Fixed Vertex <- Fixed Vertex = v, but u and v must be assigned to the same fixed vertex block
     // Note that we do not allow contractions that contract fixed vertex onto a free vertex.
     // This policy is the same as used in KaHyPar.
-    const bool accept_contraction = fixed_vertices.isFixed(u) || !fixed_vertices.isFixed(v);
-    // If both are fixed, both vertices must be in the same block
-    const bool accept_fixed_vertex_contraction =
-      !( fixed_vertices.isFixed(u) && fixed_vertices.isFixed(v) ) ||
-      ( fixed_vertices.fixedVertexBlock(u) == fixed_vertices.fixedVertexBlock(v) );
-    return accept_contraction && accept_fixed_vertex_contraction &&
-      acceptImbalance(hypergraph, fixed_vertices, context, u, v);
+    // The fixed vertex blocks of u and v are loaded only once, such that the cases reduce to comparisons
+    // of the two block IDs (free vertices have block kInvalidPartition).
+    const PartitionID block_of_u = fixed_vertices.fixedVertexBlock(u);
+    const PartitionID block_of_v = fixed_vertices.fixedVertexBlock(v);
+    if ( block_of_v != kInvalidPartition ) {
+      // Case 3.), or a fixed vertex onto a free vertex if u is free
+      return block_of_u == block_of_v;
+    } else if ( block_of_u == kInvalidPartition ) {
+      // Case 2.) does not change the fixed vertex block weights
+      return true;
+    }
+    // Case 1.)
+    return acceptImbalance(hypergraph, fixed_vertices, context, block_of_u, v);
   }
 
  private:
   // During coarsening, we try to keep the partition induced by the fixed vertices balanced.
   // This gives our optimization algorithm that we run after initial partitioning more leeway to
-  // improve the solution.
+  // improve the solution. The function is called if the free vertex v is contracted onto a vertex
+  // fixed to fixed_block.
   template<typename Hypergraph>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE static bool acceptImbalance(const Hypergraph& hypergraph,
                                                                  const ds::FixedVertexSupport<Hypergraph>& fixed_vertices,
                                                                  const Context& context,
-                                                                 const HypernodeID u,
+                                                                 const PartitionID fixed_block,
                                                                  const HypernodeID v) {
-    const bool is_fixed_u = fixed_vertices.isFixed(u);
-    const bool is_fixed_v = fixed_vertices.isFixed(v);
-    if ( ( is_fixed_u && is_fixed_v ) || (!is_fixed_u && !is_fixed_v) ) {
-      // Contracting a fixed onto a fixed vertex, or an free onto a free vertex does
-      // not increase the fixed vertex block weight.
-      return true;
-    }
-
+    ASSERT(fixed_block != kInvalidPartition);
     const HypernodeWeight max_allowed_fixed_vertex_block_weight =
       (1.0 + context.partition.epsilon) * std::ceil(
         static_cast<double>(fixed_vertices.totalFixedVertexWeight()) / context.partition.k );
-    const PartitionID block_of_u = fixed_vertices.fixedVertexBlock(u);
-    const PartitionID block_of_v = fixed_vertices.fixedVertexBlock(v);
-    const PartitionID fixed_block = block_of_u == kInvalidPartition ? block_of_v : block_of_u;
-    ASSERT(fixed_block != kInvalidPartition);
     const HypernodeWeight fixed_vertex_block_weight_after =
-      ( block_of_u == kInvalidPartition ? hypergraph.nodeWeight(u) : fixed_vertices.fixedVertexBlockWeight(fixed_block) ) +
-      ( block_of_u == kInvalidPartition ? fixed_vertices.fixedVertexBlockWeight(fixed_block) : hypergraph.nodeWeight(v) );
+      fixed_vertices.fixedVertexBlockWeight(fixed_block) + hypergraph.nodeWeight(v);
     return fixed_vertex_block_weight_after <=
       std::min(max_allowed_fixed_vertex_block_weight,
         context.partition.max_part_weights[fixed_block]);
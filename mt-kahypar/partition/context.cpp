@@ -31,6 +31,7 @@
 
 #include "mt-kahypar/utils/exception.h"
 #include "mt-kahypar/partition/conversion.h"
+#include "mt-kahypar/utils/cpu_features.h"
 
 namespace mt_kahypar {
 
@@ -42,6 +43,13 @@ namespace mt_kahypar {
     }
     if ( params.write_partition_file ) {
       str << "  Partition File:                     " << params.graph_partition_filename << std::endl;
+      str << "  Binary Partition File:              " << std::boolalpha << params.binary_partition_file << std::endl;
+      if ( params.write_block_ordering ) {
+        str << "  Block Ordering File:                " << params.graph_partition_filename << ".ordering" << std::endl;
+      }
+    }
+    if ( params.nested_partitions ) {
+      str << "  Nested Partitions:                  " << std::boolalpha << params.nested_partitions << std::endl;
     }
     str << "  Mode:                               " << params.mode << std::endl;
     str << "  Objective:                          " << params.objective << std::endl;
@@ -58,8 +66,37 @@ namespace mt_kahypar {
     str << "  epsilon:                            " << params.epsilon << std::endl;
     str << "  seed:                               " << params.seed << std::endl;
     str << "  Number of V-Cycles:                 " << params.num_vcycles << std::endl;
+    if ( params.num_vcycles > 0 && params.vcycle_min_relative_improvement > 0 ) {
+      str << "  V-Cycle Min. Relative Improvement:  " << params.vcycle_min_relative_improvement << std::endl;
+    }
+    if ( params.num_vcycles > 0 && params.vcycle_truncated_contraction_limit_factor > 1 ) {
+      str << "  Truncated V-Cycle CL Factor:        " << params.vcycle_truncated_contraction_limit_factor << std::endl;
+    }
+    if ( params.time_limit > 0 ) {
+      str << "  Time Limit:                         " << params.time_limit << "s" << std::endl;
+    }
+    if ( params.memory_budget > 0 ) {
+      str << "  Memory Budget:                      " << params.memory_budget << "MB" << std::endl;
+    }
+    if ( params.portfolio_runs > 1 ) {
+      str << "  Portfolio Runs:                     " << params.portfolio_runs << std::endl;
+      str << "  Portfolio Cutoff:                   " << params.portfolio_cutoff << std::endl;
+      if ( params.evolutionary_time_limit > 0 ) {
+        str << "  Evolutionary Time Limit:            " << params.evolutionary_time_limit << "s" << std::endl;
+      }
+    }
+    if ( params.auto_tuning ) {
+      str << "  Auto-Tuning Sample Fraction:        " << params.auto_tuning_sample_fraction << std::endl;
+      str << "  Auto-Tuning Max. Slowdown:          " << params.auto_tuning_max_slowdown << std::endl;
+      if ( !params.auto_tuning_cache_dir.empty() ) {
+        str << "  Auto-Tuning Cache Directory:        " << params.auto_tuning_cache_dir << std::endl;
+      }
+    }
     str << "  Ignore HE Size Threshold:           " << params.ignore_hyperedge_size_threshold << std::endl;
-    str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
+    str << "  Remove Large Hyperedges:            " << std::boolalpha << params.remove_large_hyperedges << std::endl;
+    if ( params.remove_large_hyperedges ) {
+      str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
+    }
     if ( params.use_individual_part_weights ) {
       str << "  Individual Part Weights:            ";
       for ( const HypernodeWeight& w : params.max_part_weights ) {
@@ -70,6 +107,18 @@ namespace mt_kahypar {
     if ( params.mode == Mode::deep_multilevel ) {
       str << "  Perform Parallel Recursion:         " << std::boolalpha
           << params.perform_parallel_recursion_in_deep_multilevel << std::endl;
+      if ( params.deep_ml_copy_memory_limit > 0 ) {
+        str << "  Copy Memory Limit:                  " << params.deep_ml_copy_memory_limit << " MB" << std::endl;
+      }
+    }
+    if ( params.preset_type == PresetType::large_k ) {
+      str << "  Use Sparse Gain Cache:              " << std::boolalpha
+          << params.use_sparse_gain_cache << std::endl;
+    } else {
+      str << "  Sparse Connectivity Min. k:         " << params.sparse_connectivity_min_k << std::endl;
+    }
+    if ( params.instance_type == InstanceType::graph ) {
+      str << "  Graph Gain Cache On-The-Fly Factor: " << params.graph_gain_cache_on_the_fly_factor << std::endl;
     }
     return str;
   }
@@ -81,13 +130,23 @@ namespace mt_kahypar {
     str << "    Minimum Vertex Move Fraction:        " << params.min_vertex_move_fraction << std::endl;
     str << "    Vertex Degree Sampling Threshold:    " << params.vertex_degree_sampling_threshold << std::endl;
     str << "    Number of subrounds (deterministic): " << params.num_sub_rounds_deterministic << std::endl;
+    str << "    Volume Update Subrounds:             " << params.volume_update_sub_rounds << std::endl;
+    str << "    Use Active Node Set:                 " << std::boolalpha << params.use_active_node_set << std::endl;
+    str << "    Vertex Following:                    " << std::boolalpha << params.vertex_following << std::endl;
     return str;
   }
 
   std::ostream & operator<< (std::ostream& str, const PreprocessingParameters& params) {
     str << "Preprocessing Parameters:" << std::endl;
+    str << "  Sanitize During Construction:       " << std::boolalpha << params.sanitize_during_construction << std::endl;
+    str << "  Reorder Nodes:                      " << std::boolalpha << params.reorder_nodes << std::endl;
+    str << "  Compress Twin Nodes:                " << std::boolalpha << params.compress_twin_nodes << std::endl;
     str << "  Use Community Detection:            " << std::boolalpha << params.use_community_detection << std::endl;
+    str << "  Community Detection Algorithm:      " << params.community_detection_algorithm << std::endl;
     str << "  Disable C. D. for Mesh Graphs:      " << std::boolalpha << params.disable_community_detection_for_mesh_graphs << std::endl;
+    if (!params.community_cache_dir.empty()) {
+      str << "  Community Cache Directory:          " << params.community_cache_dir << std::endl;
+    }
     if (params.use_community_detection) {
       str << std::endl << params.community_detection;
     }
@@ -99,6 +158,7 @@ namespace mt_kahypar {
     str << "    Rating Function:                  " << params.rating_function << std::endl;
     str << "    Heavy Node Penalty:               " << params.heavy_node_penalty_policy << std::endl;
     str << "    Acceptance Policy:                " << params.acceptance_policy << std::endl;
+    str << "    Pin Sampling Threshold:           " << params.pin_sampling_threshold << std::endl;
     return str;
   }
 
@@ -114,6 +174,18 @@ namespace mt_kahypar {
     str << "  Minimum Shrink Factor:              " << params.minimum_shrink_factor << std::endl;
     str << "  Maximum Shrink Factor:              " << params.maximum_shrink_factor << std::endl;
     str << "  Vertex Degree Sampling Threshold:   " << params.vertex_degree_sampling_threshold << std::endl;
+    str << "  Use Two-Hop Clustering:             " << std::boolalpha << params.use_two_hop_clustering << std::endl;
+    if ( params.use_two_hop_clustering ) {
+      str << "  Two-Hop Clustering Shrink Factor:   " << params.two_hop_clustering_shrink_factor << std::endl;
+    }
+    str << "  Precontract Fixed Vertices:         " << std::boolalpha << params.precontract_fixed_vertices << std::endl;
+    str << "  V-Cycle Reuse Hierarchy:            " << std::boolalpha << params.vcycle_reuse_hierarchy << std::endl;
+    if ( params.algorithm == CoarseningAlgorithm::multilevel_coarsener ) {
+      str << "  Propose-Resolve Clustering:         " << std::boolalpha << params.propose_resolve_clustering << std::endl;
+      if ( params.propose_resolve_clustering ) {
+        str << "  Propose-Resolve Subrounds:          " << params.num_sub_rounds_propose_resolve << std::endl;
+      }
+    }
     if ( params.algorithm == CoarseningAlgorithm::deterministic_multilevel_coarsener ) {
       str << "  Number of Subrounds:                " << params.num_sub_rounds_deterministic << std::endl;
       str << "  Resolve Node Swaps:                 " << std::boolalpha << params.det_resolve_swaps << std::endl;
@@ -132,7 +204,9 @@ namespace mt_kahypar {
       str << "    Unconstrained:                    " << std::boolalpha << params.unconstrained << std::endl;
       str << "    Rebalancing:                      " << std::boolalpha << params.rebalancing << std::endl;
       str << "    HE Size Activation Threshold:     " << std::boolalpha << params.hyperedge_size_activation_threshold << std::endl;
+      str << "    High Degree Threshold:            " << params.high_degree_threshold << std::endl;
       str << "    Relative Improvement Threshold:   " << params.relative_improvement_threshold << std::endl;
+      str << "    Use Active Node Set:              " << std::boolalpha << params.use_active_node_set << std::endl;
     }
     return str;
   }
@@ -146,6 +220,7 @@ namespace mt_kahypar {
       str << "    Dynamic Rounds:                   " << params.dynamic_rounds << std::endl;
       str << "    Initial Negative Gain Factor:     " << params.initial_negative_gain_factor << std::endl;
       str << "    Final Negative Gain Factor:       " << params.final_negative_gain_factor << std::endl;
+      str << "    Batched Gain Cache Updates:       " << std::boolalpha << params.batched_gain_cache_updates << std::endl;
     }
     return str;
   }
@@ -159,10 +234,12 @@ namespace mt_kahypar {
       out << "    Rollback Bal. Violation Factor:   " << params.rollback_balance_violation_factor << std::endl;
       out << "    Num Seed Nodes:                   " << params.num_seed_nodes << std::endl;
       out << "    Enable Random Shuffle:            " << std::boolalpha << params.shuffle << std::endl;
+      out << "    Gain-Ordered Seed Nodes:          " << std::boolalpha << params.gain_ordered_seeds << std::endl;
       out << "    Obey Minimal Parallelism:         " << std::boolalpha << params.obey_minimal_parallelism << std::endl;
       out << "    Minimum Improvement Factor:       " << params.min_improvement << std::endl;
       out << "    Release Nodes:                    " << std::boolalpha << params.release_nodes << std::endl;
       out << "    Time Limit Factor:                " << params.time_limit_factor << std::endl;
+      out << "    Adaptive Stop Rule Factor:        " << params.adaptive_stop_rule_factor << std::endl;
     }
     if ( params.algorithm == FMAlgorithm::unconstrained_fm ) {
       out << "    Unconstrained Rounds:             " << params.unconstrained_rounds << std::endl;
@@ -209,7 +286,12 @@ namespace mt_kahypar {
       out << "    Time Limit Factor:                " << params.time_limit_factor << std::endl;
       out << "    Skip Small Cuts:                  " << std::boolalpha << params.skip_small_cuts << std::endl;
       out << "    Skip Unpromising Blocks:          " << std::boolalpha << params.skip_unpromising_blocks << std::endl;
+      out << "    Prioritize Block Pairs:           " << std::boolalpha << params.prioritize_block_pairs << std::endl;
       out << "    Pierce in Bulk:                   " << std::boolalpha << params.pierce_in_bulk << std::endl;
+      out << "    Reuse Problem Construction:       " << std::boolalpha << params.reuse_problem_construction << std::endl;
+      out << "    Skip Unchanged Problems:          " << std::boolalpha << params.skip_unchanged_problems << std::endl;
+      out << "    Parallel Region Growing:          " << std::boolalpha << params.parallel_region_growing << std::endl;
+      out << "    Matching-Based Scheduling:        " << std::boolalpha << params.matching_based_scheduling << std::endl;
       out << "    Steiner Tree Policy:              " << params.steiner_tree_policy << std::endl;
       out << std::flush;
     }
@@ -218,6 +300,8 @@ namespace mt_kahypar {
 
   std::ostream& operator<<(std::ostream& out, const DeterministicRefinementParameters& params) {
     out << "    Number of sub-rounds for Sync LP:  " << params.num_sub_rounds_sync_lp << std::endl;
+    out << "    Adaptive sub-rounds for Sync LP:   " << std::boolalpha << params.adaptive_sub_rounds_sync_lp << std::endl;
+    out << "    Number of sub-rounds for FM:       " << params.num_sub_rounds_fm << std::endl;
     out << "    Use active node set:               " << std::boolalpha << params.use_active_node_set << std::endl;
     return out;
   }
@@ -237,6 +321,11 @@ namespace mt_kahypar {
     str << "Refinement Parameters:" << std::endl;
     str << "  Refine Until No Improvement:        " << std::boolalpha << params.refine_until_no_improvement << std::endl;
     str << "  Relative Improvement Threshold:     " << params.relative_improvement_threshold << std::endl;
+    str << "  Adaptive Refinement:                " << std::boolalpha << params.adaptive_refinement << std::endl;
+    if ( params.adaptive_refinement ) {
+      str << "  Adaptive Refinement Min. Yield:     " << params.adaptive_refinement_min_yield << std::endl;
+    }
+    str << "  Lazy Gain Cache Initialization:     " << std::boolalpha << params.lazy_gain_cache_initialization << std::endl;
     str << "  Maximum Batch Size:                 " << params.max_batch_size << std::endl;
     str << "  Min Border Vertices Per Thread:     " << params.min_border_vertices_per_thread << std::endl;
     str << "\n" << params.label_propagation;
@@ -258,11 +347,20 @@ namespace mt_kahypar {
     if ( params.use_adaptive_ip_runs ) {
       str << "  Min Adaptive IP Runs:               " << params.min_adaptive_ip_runs << std::endl;
     }
+    str << "  Use Portfolio Scheduling:           " << std::boolalpha << params.use_portfolio_scheduling << std::endl;
     str << "  Perform Refinement On Best:         " << std::boolalpha << params.perform_refinement_on_best_partitions << std::endl;
     str << "  Fm Refinement Rounds:               " << params.fm_refinment_rounds << std::endl;
+    if ( params.perform_refinement_on_best_partitions ) {
+      str << "  Abort Unpromising Refinements:      " << std::boolalpha << params.abort_unpromising_refinements << std::endl;
+    }
     str << "  Remove Degree-Zero HNs Before IP:   " << std::boolalpha << params.remove_degree_zero_hns_before_ip << std::endl;
     str << "  Maximum Iterations of LP IP:        " << params.lp_maximum_iterations << std::endl;
     str << "  Initial Block Size of LP IP:        " << params.lp_initial_block_size << std::endl;
+    str << "  Max. Num. Nodes for Sequential IP:  " << params.max_num_nodes_for_sequential_ip << std::endl;
+    str << "  Min. Num. Nodes for Parallel BFS:   " << params.min_num_nodes_for_parallel_bfs << std::endl;
+    if ( params.parallel_lp_min_k != std::numeric_limits<PartitionID>::max() ) {
+      str << "  Min. k for Parallel LP IP:          " << params.parallel_lp_min_k << std::endl;
+    }
     str << "\nInitial Partitioning ";
     str << params.refinement << std::endl;
     return str;
@@ -275,6 +373,8 @@ namespace mt_kahypar {
     str << "  Use Local Search:                   " << std::boolalpha << params.use_local_search << std::endl;
     str << "  Use Two-Phase Approach:             " << std::boolalpha << params.use_two_phase_approach << std::endl;
     str << "  Max Precomputed Steiner Tree Size:  " << params.max_steiner_tree_size << std::endl;
+    str << "  Steiner Tree Cache Size:            " << params.steiner_tree_cache_size << " MB" << std::endl;
+    str << "  Write Steiner Tree Tables:          " << std::boolalpha << params.write_steiner_tree_tables << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_he_threshold << std::endl;
     return str;
   }
@@ -285,8 +385,18 @@ namespace mt_kahypar {
     if constexpr (TBBInitializer::provides_numa_information) {
       str << "  Number of used NUMA nodes:          " << TBBInitializer::instance().num_used_numa_nodes() << std::endl;
     }
+    str << "  CPU Features:                       " << utils::cpuFeaturesToString(utils::cpuFeatures()) << std::endl;
     str << "  Use Localized Random Shuffle:       " << std::boolalpha << params.use_localized_random_shuffle << std::endl;
     str << "  Random Shuffle Block Size:          " << params.shuffle_block_size << std::endl;
+    str << "  Use NUMA-Aware Placement:           " << std::boolalpha << params.use_numa_aware_placement << std::endl;
+    str << "  Use Huge Pages:                     " << std::boolalpha << params.use_huge_pages << std::endl;
+    str << "  Use Background Reclamation:         " << std::boolalpha << params.use_background_reclamation << std::endl;
+    if ( params.num_threads_for_flows > 0 ) {
+      str << "  Number of Threads for Flows:        " << params.num_threads_for_flows << std::endl;
+    }
+    if ( params.hwloc_topology_file != "" ) {
+      str << "  Hwloc Topology File:                " << params.hwloc_topology_file << std::endl;
+    }
     return str;
   }
 
@@ -436,6 +546,17 @@ namespace mt_kahypar {
     }
 
 
+    if ( partition.nested_partitions ) {
+      if ( partition.objective == Objective::steiner_tree ) {
+        throw UnsupportedOperationException("Nested partitions are not supported for steiner tree metric.");
+      }
+      if ( partition.mode == Mode::direct ) {
+        // Direct k-way partitioning does not maintain the block ranges of the recursive bisection
+        partition.mode = Mode::deep_multilevel;
+        INFO("Nested partitions require recursive bisection of the blocks. Switching to deep multilevel mode.");
+      }
+    }
+
     shared_memory.static_balancing_work_packages = std::clamp(shared_memory.static_balancing_work_packages, UL(4), UL(256));
 
     if ( partition.deterministic ) {
@@ -445,16 +566,27 @@ namespace mt_kahypar {
         WARNING("Disabling adaptive initial partitioning runs since deterministic mode is active");
       }
 
-      // disable FM since there is no deterministic version
-      if ( refinement.fm.algorithm != FMAlgorithm::do_nothing || initial_partitioning.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
-        refinement.fm.algorithm = FMAlgorithm::do_nothing;
-        initial_partitioning.refinement.fm.algorithm = FMAlgorithm::do_nothing;
-        WARNING("Disabling FM refinement since deterministic mode is active");
+      // disable portfolio scheduling of IP runs
+      if ( initial_partitioning.use_portfolio_scheduling ) {
+        initial_partitioning.use_portfolio_scheduling = false;
+        WARNING("Disabling portfolio scheduling of initial partitioning runs since deterministic mode is active");
+      }
+
+      // disable adaptive refinement, since it schedules refiners based on their running time
+      if ( refinement.adaptive_refinement || initial_partitioning.refinement.adaptive_refinement ) {
+        refinement.adaptive_refinement = false;
+        initial_partitioning.refinement.adaptive_refinement = false;
+        WARNING("Disabling adaptive refinement since deterministic mode is active");
       }
 
       // switch to deterministic algorithms
       bool switched = false;
 
+      if ( preprocessing.community_detection_algorithm == CommunityDetectionAlgorithm::label_propagation ) {
+        preprocessing.community_detection_algorithm = CommunityDetectionAlgorithm::louvain;
+        switched = true;
+      }
+
       auto coarsening_algo = coarsening.algorithm;
       if ( coarsening_algo != CoarseningAlgorithm::do_nothing_coarsener && coarsening_algo != CoarseningAlgorithm::deterministic_multilevel_coarsener ) {
         coarsening.algorithm = CoarseningAlgorithm::deterministic_multilevel_coarsener;
@@ -477,6 +609,12 @@ namespace mt_kahypar {
         refinement.rebalancing.algorithm = RebalancingAlgorithm::deterministic;
         switched = true;
       }
+      // unconstrained FM is not supported in deterministic mode
+      auto fm_algo = refinement.fm.algorithm;
+      if ( fm_algo != FMAlgorithm::do_nothing && fm_algo != FMAlgorithm::kway_fm ) {
+        refinement.fm.algorithm = FMAlgorithm::kway_fm;
+        switched = true;
+      }
 
       // refinement during initial partitioning
       lp_algo = initial_partitioning.refinement.label_propagation.algorithm;
@@ -494,6 +632,11 @@ namespace mt_kahypar {
         initial_partitioning.refinement.rebalancing.algorithm = RebalancingAlgorithm::deterministic;
         switched = true;
       }
+      fm_algo = initial_partitioning.refinement.fm.algorithm;
+      if ( fm_algo != FMAlgorithm::do_nothing && fm_algo != FMAlgorithm::kway_fm ) {
+        initial_partitioning.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+        switched = true;
+      }
 
       if (switched) {
         WARNING("Switching to deterministic algorithm variants since deterministic mode is active");
@@ -518,8 +661,11 @@ namespace mt_kahypar {
       // = min(t, min(tau * k, k * (k - 1) / 2))
       // t = number of threads
       // k * (k - 1) / 2 = maximum number of edges in the quotient graph
+      // In deterministic mode, the number of searches must not depend on t
+      const size_t max_num_searches = partition.deterministic ?
+        std::numeric_limits<size_t>::max() : shared_memory.num_threads;
       refinement.flows.num_parallel_searches = partition.k == 2 ? 1 :
-        std::min(shared_memory.num_threads, std::min(std::max(UL(1), static_cast<size_t>(
+        std::min(max_num_searches, std::min(std::max(UL(1), static_cast<size_t>(
           refinement.flows.parallel_searches_multiplier * partition.k)),
             static_cast<size_t>((partition.k * (partition.k - 1)) / 2) ));
     }
@@ -544,7 +690,15 @@ namespace mt_kahypar {
 
     if ( partition.instance_type == InstanceType::hypergraph ) {
       switch ( partition.objective ) {
-        case Objective::km1: partition.gain_policy = GainPolicy::km1; break;
+        case Objective::km1:
+          partition.gain_policy = GainPolicy::km1;
+          #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+          if ( partition.use_sparse_gain_cache && partition.preset_type == PresetType::large_k ) {
+            // Only store the benefit terms of adjacent blocks
+            partition.gain_policy = GainPolicy::km1_sparse;
+          }
+          #endif
+          break;
         case Objective::cut: partition.gain_policy = GainPolicy::cut; break;
         case Objective::soed: partition.gain_policy = GainPolicy::soed; break;
         case Objective::steiner_tree: partition.gain_policy = GainPolicy::steiner_tree; break;
@@ -563,6 +717,43 @@ namespace mt_kahypar {
     }
   }
 
+  void Context::setupDeadline() {
+    partition.start_time = std::chrono::high_resolution_clock::now();
+    if ( partition.time_limit > 0 &&
+         partition.deadline == std::chrono::high_resolution_clock::time_point::max() ) {
+      partition.deadline = std::chrono::high_resolution_clock::now() +
+        std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+          std::chrono::duration<double>(partition.time_limit));
+    }
+  }
+
+  bool Context::isTimeLimitExceeded() const {
+    return isCancelled() || ( partition.deadline != std::chrono::high_resolution_clock::time_point::max() &&
+      std::chrono::high_resolution_clock::now() >= partition.deadline );
+  }
+
+  bool Context::isCancelled() const {
+    return partition.cancel_callback && partition.cancel_callback(partition.cancel_callback_data);
+  }
+
+  void Context::checkForCancellation() const {
+    if ( isCancelled() ) {
+      throw CancellationException("Partitioning call was cancelled");
+    }
+  }
+
+  void Context::reportProgress(const mt_kahypar_progress_phase_t phase,
+                               const size_t level,
+                               const HypernodeID num_nodes,
+                               const HyperedgeWeight objective) const {
+    if ( hasProgressCallback() ) {
+      const std::chrono::duration<double> elapsed_seconds =
+        std::chrono::high_resolution_clock::now() - partition.start_time;
+      const mt_kahypar_progress_t progress { phase, level, num_nodes, objective, elapsed_seconds.count() };
+      partition.progress_callback(&progress, partition.progress_callback_data);
+    }
+  }
+
   std::ostream & operator<< (std::ostream& str, const Context& context) {
     str << "*******************************************************************************\n"
         << "*                            Partitioning Context                             *\n"
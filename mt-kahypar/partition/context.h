@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -48,12 +50,60 @@ struct PartitioningParameters {
   PartitionID k = std::numeric_limits<PartitionID>::max();
   int seed = 0;
   size_t num_vcycles = 0;
+  // V-cycles terminate early if a cycle improves the objective relatively by less
+  // than this threshold (0 = always run num_vcycles cycles)
+  double vcycle_min_relative_improvement = 0.0;
+  // If > 1, V-cycles first only coarsen down to this factor times the contraction limit
+  // (truncated cycles). If a truncated cycle does not improve the objective by at least
+  // vcycle_min_relative_improvement, the remaining cycles use the full hierarchy.
+  double vcycle_truncated_contraction_limit_factor = 1.0;
   bool perform_parallel_recursion_in_deep_multilevel = true;
-
-  int time_limit = 0;
+  // Memory limit in MB for the hypergraph copies that are partitioned concurrently in the
+  // parallel recursion of deep multilevel partitioning (0 = no limit)
+  size_t deep_ml_copy_memory_limit = 0;
+  bool use_sparse_gain_cache = false;
+  // For k >= this threshold, the multilevel presets use the sparse connectivity
+  // information if the hypergraph mostly contains small nets
+  PartitionID sparse_connectivity_min_k = 64;
+  // For graphs, the cut gain cache computes the incident weights of a node on demand
+  // if k >= this factor times the average degree (0 disables on-demand computation)
+  double graph_gain_cache_on_the_fly_factor = 0.0;
+
+  // Wall-clock time limit in seconds for the whole partitioning call (0 = no limit)
+  double time_limit = 0.0;
+  std::chrono::high_resolution_clock::time_point deadline = std::chrono::high_resolution_clock::time_point::max();
+  // Memory budget in MB for the whole partitioning call (0 = no limit). If the estimated
+  // peak memory exceeds it, the partitioner switches to cheaper algorithm configurations.
+  size_t memory_budget = 0;
+  // Number of independent runs with different seeds that share the preprocessing and
+  // split the threads among them. The best partition is returned (1 = disabled).
+  size_t portfolio_runs = 1;
+  // If > 0, a run is cancelled if its objective after initial partitioning is worse than
+  // (1 + portfolio_cutoff) times the best objective after initial partitioning of all runs
+  double portfolio_cutoff = 0.0;
+  // If > 0, the partitions of the portfolio runs are improved by parallel recombinations
+  // for the given number of seconds (memetic algorithm, requires portfolio_runs > 1)
+  double evolutionary_time_limit = 0.0;
+  // If true, the contraction limit multiplier and the number of initial partitioning runs
+  // are tuned by partitioning a sample of the input with several candidate settings
+  bool auto_tuning = false;
+  // Fraction of the nodes that are contained in the sample used for auto-tuning
+  double auto_tuning_sample_fraction = 0.1;
+  // A candidate is only selected if its running time on the sample is at most
+  // auto_tuning_max_slowdown times the running time of the preset setting
+  double auto_tuning_max_slowdown = 2.0;
+  // If not empty, the tuned parameters are cached in this directory
+  std::string auto_tuning_cache_dir { };
+  // If true, the input hypergraph is only read by the library interface such that
+  // several concurrent partitioning calls can share it (only for static hypergraphs)
+  bool shared_input = false;
+  // If true, the library interface partitions static hypergraphs that only contain
+  // two-pin nets with the graph data structures
+  bool partition_two_pin_hypergraphs_as_graphs = true;
   bool use_individual_part_weights = false;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
   std::vector<HypernodeWeight> max_part_weights;
+  bool remove_large_hyperedges = false;
   double large_hyperedge_size_threshold_factor = std::numeric_limits<double>::max();
   HypernodeID large_hyperedge_size_threshold = std::numeric_limits<HypernodeID>::max();
   HypernodeID smallest_large_he_size_threshold = std::numeric_limits<HypernodeID>::max();
@@ -65,11 +115,16 @@ struct PartitioningParameters {
   bool measure_detailed_uncontraction_timings = false;
   size_t timings_output_depth = std::numeric_limits<size_t>::max();
   bool show_memory_consumption = false;
+  // ! Interval in milliseconds in which the memory sampler records the RSS (0 = disabled)
+  size_t memory_sampling_interval = 0;
   bool show_advanced_cut_analysis = false;
   bool enable_progress_bar = false;
   bool sp_process_output = false;
   bool csv_output = false;
   bool write_partition_file = false;
+  bool binary_partition_file = false;
+  bool nested_partitions = false;
+  bool write_block_ordering = false;
   bool deterministic = false;
 
   std::string graph_filename { };
@@ -77,6 +132,15 @@ struct PartitioningParameters {
   std::string graph_partition_output_folder {};
   std::string graph_partition_filename { };
   std::string graph_community_filename { };
+  std::string json_output_file { };
+  std::string trace_output_file { };
+  mt_kahypar_report_callback_t report_callback = nullptr;
+  void* report_callback_data = nullptr;
+  mt_kahypar_progress_callback_t progress_callback = nullptr;
+  void* progress_callback_data = nullptr;
+  mt_kahypar_cancel_callback_t cancel_callback = nullptr;
+  void* cancel_callback_data = nullptr;
+  std::chrono::high_resolution_clock::time_point start_time = std::chrono::high_resolution_clock::now();
   std::string preset_file { };
 };
 
@@ -89,15 +153,28 @@ struct CommunityDetectionParameters {
   long double min_vertex_move_fraction = std::numeric_limits<long double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
+  size_t volume_update_sub_rounds = 0;
+  bool use_active_node_set = false;
+  bool vertex_following = false;
 };
 
 std::ostream & operator<< (std::ostream& str, const CommunityDetectionParameters& params);
 
 struct PreprocessingParameters {
   bool stable_construction_of_incident_edges = false;
+  // ! Removes duplicated pins and single-pin nets and merges identical nets while
+  // ! constructing the hypergraph (see StaticHypergraphFactory::construct_sanitized(...))
+  bool sanitize_during_construction = false;
+  // ! Renumbers the nodes in a locality order before partitioning
+  bool reorder_nodes = false;
+  // ! Contracts nodes with identical incident nets into weighted super-nodes before partitioning
+  bool compress_twin_nodes = false;
   bool use_community_detection = false;
+  CommunityDetectionAlgorithm community_detection_algorithm = CommunityDetectionAlgorithm::louvain;
   bool disable_community_detection_for_mesh_graphs = true;
   CommunityDetectionParameters community_detection = { };
+  // ! Directory in which the results of the community detection are cached (empty = disabled)
+  std::string community_cache_dir { };
 };
 
 std::ostream & operator<< (std::ostream& str, const PreprocessingParameters& params);
@@ -106,6 +183,8 @@ struct RatingParameters {
   RatingFunction rating_function = RatingFunction::UNDEFINED;
   HeavyNodePenaltyPolicy heavy_node_penalty_policy = HeavyNodePenaltyPolicy::UNDEFINED;
   AcceptancePolicy acceptance_policy = AcceptancePolicy::UNDEFINED;
+  // ! Nets with more pins are rated by visiting only this number of pins
+  HypernodeID pin_sampling_threshold = std::numeric_limits<HypernodeID>::max();
 };
 
 std::ostream & operator<< (std::ostream& str, const RatingParameters& params);
@@ -120,6 +199,15 @@ struct CoarseningParameters {
   double minimum_shrink_factor = std::numeric_limits<double>::max();
   double maximum_shrink_factor = std::numeric_limits<double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
+  bool use_two_hop_clustering = false;
+  double two_hop_clustering_shrink_factor = std::numeric_limits<double>::max();
+  // ! Contract all vertices fixed to the same block into one vertex before the first clustering pass
+  bool precontract_fixed_vertices = false;
+  // ! Reuse the multilevel hierarchy of the previous V-cycle where it still respects the partition
+  bool vcycle_reuse_hierarchy = false;
+  // ! Resolve clustering proposals in sub-rounds instead of matching vertices with CAS operations
+  bool propose_resolve_clustering = false;
+  size_t num_sub_rounds_propose_resolve = 16;
 
   // parameters for deterministic coarsening
   size_t num_sub_rounds_deterministic = 16;
@@ -140,7 +228,10 @@ struct LabelPropagationParameters {
   bool rebalancing = true;
   bool execute_sequential = false;
   size_t hyperedge_size_activation_threshold = std::numeric_limits<size_t>::max();
+  // ! The gains of nodes with a larger degree are computed in parallel
+  size_t high_degree_threshold = 100000;
   double relative_improvement_threshold = -1.0;
+  bool use_active_node_set = true;
 };
 
 std::ostream & operator<< (std::ostream& str, const LabelPropagationParameters& params);
@@ -152,6 +243,7 @@ struct JetParameters {
   size_t dynamic_rounds = 3;
   double initial_negative_gain_factor = 0.75;
   double final_negative_gain_factor = 0.0;
+  bool batched_gain_cache_updates = false;
 };
 
 std::ostream & operator<< (std::ostream& str, const JetParameters& params);
@@ -169,8 +261,10 @@ struct FMParameters {
   bool rollback_parallel = true;
   bool iter_moves_on_recalc = false;
   bool shuffle = true;
+  bool gain_ordered_seeds = false;
   mutable bool obey_minimal_parallelism = false;
   bool release_nodes = true;
+  double adaptive_stop_rule_factor = 0.0;
 
   // unconstrained
   size_t unconstrained_rounds = 1;
@@ -214,7 +308,17 @@ struct FlowParameters {
   double time_limit_factor = 0.0;
   bool skip_small_cuts = false;
   bool skip_unpromising_blocks = false;
+  bool prioritize_block_pairs = false;
   bool pierce_in_bulk = false;
+  bool reuse_problem_construction = false;
+  // Skip the flow computation on a reused problem if it found no improvement before
+  bool skip_unchanged_problems = false;
+  // If a search is granted more than one thread, the region around the cut is grown
+  // with a level-synchronous parallel BFS
+  bool parallel_region_growing = true;
+  // Concurrent searches prefer block pairs whose blocks are not part of another
+  // search (greedy maximal matching of the quotient graph weighted by the cut weight)
+  bool matching_based_scheduling = false;
   SteinerTreeFlowValuePolicy steiner_tree_policy = SteinerTreeFlowValuePolicy::UNDEFINED;
 };
 
@@ -222,6 +326,10 @@ std::ostream& operator<<(std::ostream& out, const FlowParameters& params);
 
 struct DeterministicRefinementParameters {
   size_t num_sub_rounds_sync_lp = 5;
+  // ! Chooses the number of sub-rounds of each round based on the number of moves of the
+  // ! previous round (num_sub_rounds_sync_lp is then an upper bound)
+  bool adaptive_sub_rounds_sync_lp = false;
+  size_t num_sub_rounds_fm = 4;
   bool use_active_node_set = false;
 };
 
@@ -246,6 +354,9 @@ struct RefinementParameters {
   RebalancingParameters rebalancing;
   bool refine_until_no_improvement = false;
   double relative_improvement_threshold = 0.0;
+  bool adaptive_refinement = false;
+  double adaptive_refinement_min_yield = 0.1;
+  bool lazy_gain_cache_initialization = false;
   size_t max_batch_size = std::numeric_limits<size_t>::max();
   size_t min_border_vertices_per_thread = 0;
 };
@@ -263,12 +374,24 @@ struct InitialPartitioningParameters {
   size_t runs = 1;
   bool use_adaptive_ip_runs = false;
   size_t min_adaptive_ip_runs = std::numeric_limits<size_t>::max();
+  bool use_portfolio_scheduling = false;
   bool perform_refinement_on_best_partitions = false;
   size_t fm_refinment_rounds = 1;
+  // ! Stops the FM rounds on a best partition if repeating the improvement of the
+  // ! last round would still not beat the best partition found so far
+  bool abort_unpromising_refinements = true;
   bool remove_degree_zero_hns_before_ip = false;
   size_t lp_maximum_iterations = 1;
   size_t lp_initial_block_size = 1;
   size_t population_size = 16;
+  // ! Hypergraphs with at most this number of nodes are bipartitioned on a single thread
+  HypernodeID max_num_nodes_for_sequential_ip = 256;
+  // ! The BFS traversals of the pseudo-peripheral start node search are parallelized
+  // ! on hypergraphs with more than this number of nodes
+  HypernodeID min_num_nodes_for_parallel_bfs = 100000;
+  // ! Direct k-way initial partitioning uses the parallel label propagation initial
+  // ! partitioner on the shared hypergraph instead of the pool for k >= this threshold
+  PartitionID parallel_lp_min_k = std::numeric_limits<PartitionID>::max();
 };
 
 std::ostream & operator<< (std::ostream& str, const InitialPartitioningParameters& params);
@@ -279,6 +402,10 @@ struct MappingParameters {
   bool use_local_search = false;
   bool use_two_phase_approach = false;
   size_t max_steiner_tree_size = 0;
+  // ! Memory budget in MB for caching steiner trees of non-precomputed connectivity sets
+  size_t steiner_tree_cache_size = 16;
+  // ! Writes the precomputed steiner trees next to the target graph file
+  bool write_steiner_tree_tables = false;
   double largest_he_fraction = 0.0;
   double min_pin_coverage_of_largest_hes = 1.0;
   HypernodeID large_he_threshold = std::numeric_limits<HypernodeID>::max();
@@ -289,9 +416,20 @@ std::ostream & operator<< (std::ostream& str, const MappingParameters& params);
 struct SharedMemoryParameters {
   size_t original_num_threads = 1;
   size_t num_threads = 1;
+  // Maximum number of threads used by a single library call (0 = all threads of the calling task arena)
+  size_t thread_limit = 0;
   size_t static_balancing_work_packages = 128;
   bool use_localized_random_shuffle = false;
   size_t shuffle_block_size = 2;
+  bool use_numa_aware_placement = false;
+  bool use_huge_pages = false;
+  bool use_background_reclamation = false;
+  std::string hwloc_topology_file = "";
+  // ! Number of threads used by flow-based refinement (0 = number of used physical
+  // ! performance cores, i.e., flows neither use hyperthreads nor efficiency cores)
+  size_t num_threads_for_flows = 0;
+  // ! Estimated fraction of the threads available to the current (sub-)call. Recursive
+  // ! calls share the task arena of the caller, so this is not a hard thread limit.
   double degree_of_parallelism = 1.0;
 };
 
@@ -332,6 +470,32 @@ class Context {
 
   void setupGainPolicy();
 
+  // ! Sets the deadline of the partitioning call if a time limit is given and
+  // ! no deadline was set before (e.g., by the context of an enclosing call)
+  void setupDeadline();
+
+  // ! Returns true, if the wall-clock time limit of the partitioning call is exceeded
+  // ! or the call is cancelled. In that case, all phases stop as early as possible and
+  // ! only compute a balanced partition.
+  bool isTimeLimitExceeded() const;
+
+  // ! Returns true, if the cancel callback requests to cancel the partitioning call
+  bool isCancelled() const;
+
+  // ! Throws a CancellationException, if the partitioning call is cancelled.
+  // ! Must only be called at points where no partial results need to be cleaned up.
+  void checkForCancellation() const;
+
+  // ! Reports the progress of the main partitioning call to the progress callback
+  void reportProgress(const mt_kahypar_progress_phase_t phase,
+                      const size_t level,
+                      const HypernodeID num_nodes,
+                      const HyperedgeWeight objective) const;
+
+  bool hasProgressCallback() const {
+    return partition.progress_callback != nullptr && type == ContextType::main;
+  }
+
   void sanityCheck(const TargetGraph* target_graph);
 };
 
@@ -48,6 +48,9 @@ namespace mt_kahypar {
     switch (format) {
       case FileFormat::hMetis: return os << "hMetis";
       case FileFormat::Metis: return os << "Metis";
+      case FileFormat::binary: return os << "binary";
+      case FileFormat::SNAP: return os << "SNAP";
+      case FileFormat::MatrixMarket: return os << "MatrixMarket";
         // omit default case to trigger compiler warning for missing cases
     }
     return os << static_cast<uint8_t>(format);
@@ -70,6 +73,7 @@ namespace mt_kahypar {
       case PresetType::default_preset: return os << "default";
       case PresetType::quality: return os << "quality";
       case PresetType::highest_quality: return os << "highest_quality";
+      case PresetType::automatic: return os << "auto";
       case PresetType::UNDEFINED: return os << "UNDEFINED";
         // omit default case to trigger compiler warning for missing cases
     }
@@ -129,12 +133,23 @@ namespace mt_kahypar {
       case GainPolicy::steiner_tree: return os << "steiner_tree";
       case GainPolicy::cut_for_graphs: return os << "cut_for_graphs";
       case GainPolicy::steiner_tree_for_graphs: return os << "steiner_tree_for_graphs";
+      case GainPolicy::km1_sparse: return os << "km1_sparse";
       case GainPolicy::none: return os << "none";
         // omit default case to trigger compiler warning for missing cases
     }
     return os << static_cast<uint8_t>(type);
   }
 
+  std::ostream & operator<< (std::ostream& os, const CommunityDetectionAlgorithm& algo) {
+    switch (algo) {
+      case CommunityDetectionAlgorithm::louvain: return os << "louvain";
+      case CommunityDetectionAlgorithm::label_propagation: return os << "label_propagation";
+      case CommunityDetectionAlgorithm::UNDEFINED: return os << "UNDEFINED";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(algo);
+  }
+
   std::ostream & operator<< (std::ostream& os, const LouvainEdgeWeight& type) {
     switch (type) {
       case LouvainEdgeWeight::hybrid: return os << "hybrid";
@@ -271,6 +286,7 @@ namespace mt_kahypar {
   std::ostream & operator<< (std::ostream& os, const OneToOneMappingStrategy& algo) {
       switch (algo) {
         case OneToOneMappingStrategy::greedy_mapping: return os << "greedy_mapping";
+        case OneToOneMappingStrategy::parallel_greedy_mapping: return os << "parallel_greedy_mapping";
         case OneToOneMappingStrategy::identity: return os << "identity";
           // omit default case to trigger compiler warning for missing cases
       }
@@ -320,6 +336,8 @@ namespace mt_kahypar {
       return PresetType::quality;
     } else if (type == "highest_quality") {
       return PresetType::highest_quality;
+    } else if (type == "auto") {
+      return PresetType::automatic;
     }
     throw InvalidParameterException("Illegal option: " + type);
     return PresetType::UNDEFINED;
@@ -340,6 +358,16 @@ namespace mt_kahypar {
     return Objective::UNDEFINED;
   }
 
+  CommunityDetectionAlgorithm communityDetectionAlgorithmFromString(const std::string& algo) {
+    if (algo == "louvain") {
+      return CommunityDetectionAlgorithm::louvain;
+    } else if (algo == "label_propagation") {
+      return CommunityDetectionAlgorithm::label_propagation;
+    }
+    throw InvalidParameterException("No valid community detection algorithm.");
+    return CommunityDetectionAlgorithm::UNDEFINED;
+  }
+
   LouvainEdgeWeight louvainEdgeWeightFromString(const std::string& type) {
     if (type == "hybrid") {
       return LouvainEdgeWeight::hybrid;
@@ -506,6 +534,8 @@ namespace mt_kahypar {
   OneToOneMappingStrategy oneToOneMappingStrategyFromString(const std::string& type) {
     if (type == "greedy_mapping") {
       return OneToOneMappingStrategy::greedy_mapping;
+    } else if (type == "parallel_greedy_mapping") {
+      return OneToOneMappingStrategy::parallel_greedy_mapping;
     } else if (type == "identity") {
       return OneToOneMappingStrategy::identity;
     }
@@ -46,6 +46,9 @@ enum class Type : int8_t {
 enum class FileFormat : int8_t {
   hMetis = 0,
   Metis = 1,
+  binary = 2,
+  SNAP = 3,
+  MatrixMarket = 4,
 };
 
 enum class InstanceType : int8_t {
@@ -60,6 +63,7 @@ enum class PresetType : int8_t {
   default_preset,
   quality,
   highest_quality,
+  automatic, // resolved to one of the presets above based on the input (see preset_selection.h)
   UNDEFINED
 };
 
@@ -90,9 +94,16 @@ enum class GainPolicy : uint8_t {
   steiner_tree,
   cut_for_graphs,
   steiner_tree_for_graphs,
+  km1_sparse,
   none
 };
 
+enum class CommunityDetectionAlgorithm : uint8_t {
+  louvain,
+  label_propagation,
+  UNDEFINED
+};
+
 enum class LouvainEdgeWeight : uint8_t {
   hybrid,
   uniform,
@@ -180,6 +191,7 @@ enum class RebalancingAlgorithm : uint8_t {
 
 enum class OneToOneMappingStrategy : uint8_t {
   greedy_mapping,
+  parallel_greedy_mapping,
   identity
 };
 
@@ -207,6 +219,8 @@ std::ostream & operator<< (std::ostream& os, const Objective& objective);
 
 std::ostream & operator<< (std::ostream& os, const GainPolicy& type);
 
+std::ostream & operator<< (std::ostream& os, const CommunityDetectionAlgorithm& algo);
+
 std::ostream & operator<< (std::ostream& os, const LouvainEdgeWeight& type);
 
 std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy);
@@ -243,6 +257,8 @@ PresetType presetTypeFromString(const std::string& type);
 
 Objective objectiveFromString(const std::string& obj);
 
+CommunityDetectionAlgorithm communityDetectionAlgorithmFromString(const std::string& algo);
+
 LouvainEdgeWeight louvainEdgeWeightFromString(const std::string& type);
 
 SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type);
@@ -41,6 +41,7 @@ mt_kahypar_hypergraph_type_t to_hypergraph_c_type(const PresetType preset,
       case PresetType::default_preset:
       case PresetType::quality: return STATIC_HYPERGRAPH;
       case PresetType::highest_quality: return DYNAMIC_HYPERGRAPH;
+      case PresetType::automatic:
       case PresetType::UNDEFINED: throw InvalidParameterException("Unknown preset type!");
     }
   }
@@ -51,6 +52,7 @@ mt_kahypar_hypergraph_type_t to_hypergraph_c_type(const PresetType preset,
       case PresetType::default_preset:
       case PresetType::quality: return STATIC_GRAPH;
       case PresetType::highest_quality: return DYNAMIC_GRAPH;
+      case PresetType::automatic:
       case PresetType::UNDEFINED: throw InvalidParameterException("Unknown preset type!");
     }
   }
@@ -106,7 +108,8 @@ PresetType to_preset_type(const Mode mode,
 }
 
 InstanceType to_instance_type(const FileFormat format) {
-  if ( format == FileFormat::Metis ) {
+  if ( format == FileFormat::Metis || format == FileFormat::SNAP ||
+       format == FileFormat::MatrixMarket ) {
     return InstanceType::graph;
   } else if ( format == FileFormat::hMetis ) {
     return InstanceType::hypergraph;
@@ -36,6 +36,7 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/partition/multilevel.h"
 #include "mt-kahypar/partition/coarsening/coarsening_commons.h"
 #include "mt-kahypar/partition/coarsening/multilevel_uncoarsener.h"
@@ -467,6 +468,10 @@ DeepPartitioningResult<TypeTraits> bipartition_block(typename TypeTraits::Hyperg
   bipartition.valid = true;
 
   if ( bipartition.hypergraph.initialNumNodes() > 0 ) {
+    utils::Timer::ScopedTraceSpan span(utils::Utilities::instance().getTimer(context.utility_id),
+      "Deep Multilevel Bipartition", "deep_multilevel");
+    span.addArg("blocks", "[" + std::to_string(start_k) + "," + std::to_string(end_k) + ")");
+    span.addArg("nodes", bipartition.hypergraph.initialNumNodes());
     // Bipartition block
     Context b_context = setupBipartitioningContext(
       context, info, start_k, end_k, bipartition.hypergraph.totalWeight(), PartitionedHypergraph::is_graph);
@@ -479,17 +484,47 @@ DeepPartitioningResult<TypeTraits> bipartition_block(typename TypeTraits::Hyperg
   return bipartition;
 }
 
-template<typename TypeTraits, typename GainCache>
-void apply_bipartitions_to_hypergraph(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
-                                      GainCache& gain_cache,
-                                      const vec<HypernodeID>& mapping,
-                                      const vec<DeepPartitioningResult<TypeTraits>>& bipartitions,
-                                      const vec<PartitionID>& block_ranges) {
+// Groups the nodes of the current partition by their block such that the
+// nodes of a block are stored consecutively in nodes[offsets[b]..offsets[b + 1]).
+template<typename PartitionedHypergraph>
+void group_nodes_by_block(const PartitionedHypergraph& partitioned_hg,
+                          const PartitionID current_k,
+                          vec<HypernodeID>& nodes,
+                          vec<HypernodeID>& offsets) {
+  vec<CAtomic<HypernodeID>> position(current_k + 1, CAtomic<HypernodeID>(0));
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    ASSERT(partitioned_hg.partID(hn) < current_k);
+    position[partitioned_hg.partID(hn) + 1].fetch_add(1, std::memory_order_relaxed);
+  });
+  offsets.assign(current_k + 1, 0);
+  for ( PartitionID block = 0; block < current_k; ++block ) {
+    offsets[block + 1] = offsets[block] + position[block + 1].load(std::memory_order_relaxed);
+    position[block].store(offsets[block], std::memory_order_relaxed);
+  }
+  nodes.resize(offsets.back());
   partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
-    const PartitionID from = partitioned_hg.partID(hn);
-    ASSERT(static_cast<size_t>(from) < bipartitions.size());
+    const PartitionID block = partitioned_hg.partID(hn);
+    nodes[position[block].fetch_add(1, std::memory_order_relaxed)] = hn;
+  });
+}
+
+// Moves the nodes of a block to their blocks in the next level of the recursive
+// bipartitioning tree. Each node belongs to exactly one block of the current
+// partition, which allows us to apply the bipartitions of different blocks
+// concurrently as soon as they are computed.
+template<typename TypeTraits, typename GainCache>
+void apply_bipartition_to_block(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                                GainCache& gain_cache,
+                                const vec<HypernodeID>& nodes,
+                                const vec<HypernodeID>& offsets,
+                                const vec<HypernodeID>& mapping,
+                                const DeepPartitioningResult<TypeTraits>& bipartition,
+                                const PartitionID from,
+                                const vec<PartitionID>& block_ranges) {
+  tbb::parallel_for(offsets[from], offsets[from + 1], [&](const HypernodeID pos) {
+    const HypernodeID hn = nodes[pos];
+    ASSERT(partitioned_hg.partID(hn) == from);
     PartitionID to = kInvalidPartition;
-    const DeepPartitioningResult<TypeTraits>& bipartition = bipartitions[from];
     if ( bipartition.valid ) {
       ASSERT(static_cast<size_t>(hn) < mapping.size());
       const HypernodeID mapped_hn = mapping[hn];
@@ -508,6 +543,29 @@ void apply_bipartitions_to_hypergraph(typename TypeTraits::PartitionedHypergraph
       }
     }
   });
+}
+
+template<typename TypeTraits>
+void apply_bipartition_to_block(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                                gain_cache_t gain_cache,
+                                const vec<HypernodeID>& nodes,
+                                const vec<HypernodeID>& offsets,
+                                const vec<HypernodeID>& mapping,
+                                const DeepPartitioningResult<TypeTraits>& bipartition,
+                                const PartitionID from,
+                                const vec<PartitionID>& block_ranges) {
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+  GainCachePtr::applyWithConcreteGainCacheForHG<PartitionedHypergraph>([&](auto& gain_cache) {
+    apply_bipartition_to_block<TypeTraits>(partitioned_hg, gain_cache,
+      nodes, offsets, mapping, bipartition, from, block_ranges);
+  }, gain_cache);
+}
+
+// Must be called after the bipartitions of all blocks are applied
+template<typename PartitionedHypergraph, typename GainCache>
+void finalize_bipartitions(PartitionedHypergraph& partitioned_hg,
+                           GainCache& gain_cache) {
   partitioned_hg.resetEdgeSynchronization();
 
   if ( GainCache::invalidates_entries && gain_cache.isInitialized() ) {
@@ -519,16 +577,11 @@ void apply_bipartitions_to_hypergraph(typename TypeTraits::PartitionedHypergraph
   HEAVY_REFINEMENT_ASSERT(partitioned_hg.checkTrackedPartitionInformation(gain_cache));
 }
 
-template<typename TypeTraits>
-void apply_bipartitions_to_hypergraph(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
-                                      gain_cache_t gain_cache,
-                                      const vec<HypernodeID>& mapping,
-                                      const vec<DeepPartitioningResult<TypeTraits>>& bipartitions,
-                                      const vec<PartitionID>& block_ranges) {
-  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
-
+template<typename PartitionedHypergraph>
+void finalize_bipartitions(PartitionedHypergraph& partitioned_hg,
+                           gain_cache_t gain_cache) {
   GainCachePtr::applyWithConcreteGainCacheForHG<PartitionedHypergraph>([&](auto& gain_cache) {
-    apply_bipartitions_to_hypergraph<TypeTraits>(partitioned_hg,gain_cache, mapping, bipartitions, block_ranges);
+    finalize_bipartitions(partitioned_hg, gain_cache);
   }, gain_cache);
 }
 
@@ -563,20 +616,33 @@ void bipartition_each_block(typename TypeTraits::PartitionedHypergraph& partitio
   const vec<HypernodeID>& mapping = extracted_blocks.second;
   timer.stop_timer("extract_blocks");
 
+  // The nodes of each block are grouped such that the bipartition of a block
+  // can be applied to the hypergraph as soon as it is computed, while the
+  // remaining blocks are still bipartitioned.
+  vec<HypernodeID> nodes;
+  vec<HypernodeID> offsets;
+  group_nodes_by_block(partitioned_hg, current_k, nodes, offsets);
+
+  // The recursive bipartitioning tree stores for each block of the current partition
+  // the number of blocks in which we have to further bipartition the corresponding block
+  // recursively. This is important for computing the adjusted imbalance factor to ensure
+  // that the final k-way partition is balanced.
+  vec<PartitionID> block_ranges(1, 0);
+  for ( PartitionID block = 0; block < current_k; ++block ) {
+    const PartitionID desired_blocks = rb_tree.desiredNumberOfBlocks(current_k, block);
+    block_ranges.push_back(block_ranges.back() + (desired_blocks > 1 ? 2 : 1));
+  }
+
   timer.start_timer("bipartition_blocks", "Bipartition Blocks");
   const bool was_enabled_before = disableTimerAndStats(context); // n-level disables timer
   utils::ProgressBar progress(current_k, current_objective, progress_bar_enabled);
   vec<DeepPartitioningResult<TypeTraits>> bipartitions(current_k);
-  vec<PartitionID> block_ranges(1, 0);
   tbb::task_group tg;
   for ( PartitionID block = 0; block < current_k; ++block ) {
-    // The recursive bipartitioning tree stores for each block of the current partition
-    // the number of blocks in which we have to further bipartition the corresponding block
-    // recursively. This is important for computing the adjusted imbalance factor to ensure
-    // that the final k-way partition is balanced.
     const PartitionID desired_blocks = rb_tree.desiredNumberOfBlocks(current_k, block);
     if ( desired_blocks > 1 ) {
-      // Spawn a task that bipartitions the corresponding block
+      // Spawn a task that bipartitions the corresponding block and
+      // afterwards moves its nodes to the resulting blocks
       tg.run([&, block] {
         const auto target_blocks = rb_tree.targetBlocksInFinalPartition(current_k, block);
         adaptWeightsOfNonCutEdges(hypergraphs[block],
@@ -584,15 +650,21 @@ void bipartition_each_block(typename TypeTraits::PartitionedHypergraph& partitio
         bipartitions[block] = bipartition_block<TypeTraits>(std::move(hypergraphs[block]), context,
           info, target_blocks.first, target_blocks.second);
         bipartitions[block].partitioned_hg.setHypergraph(bipartitions[block].hypergraph);
+        apply_bipartition_to_block(partitioned_hg, gain_cache, nodes,
+          offsets, mapping, bipartitions[block], block, block_ranges);
         progress.addToObjective(progress_bar_enabled ?
           metrics::quality(bipartitions[block].partitioned_hg, Objective::cut) : 0 );
         progress += 1;
       });
-      block_ranges.push_back(block_ranges.back() + 2);
     } else {
       // No further bipartitions required for the corresponding block
       bipartitions[block].valid = false;
-      block_ranges.push_back(block_ranges.back() + 1);
+      if ( block_ranges[block] != block ) {
+        tg.run([&, block] {
+          apply_bipartition_to_block(partitioned_hg, gain_cache, nodes,
+            offsets, mapping, bipartitions[block], block, block_ranges);
+        });
+      }
       progress += 1;
     }
   }
@@ -601,7 +673,7 @@ void bipartition_each_block(typename TypeTraits::PartitionedHypergraph& partitio
   timer.stop_timer("bipartition_blocks");
 
   timer.start_timer("apply_bipartitions", "Apply Bipartition");
-  apply_bipartitions_to_hypergraph(partitioned_hg, gain_cache, mapping, bipartitions, block_ranges);
+  finalize_bipartitions(partitioned_hg, gain_cache);
   timer.stop_timer("apply_bipartitions");
 
   ASSERT([&] {
@@ -707,8 +779,10 @@ PartitionID deep_multilevel_partitioning(typename TypeTraits::PartitionedHypergr
         break;
       }
 
+      context.checkForCancellation();
       should_continue = coarsener->coarseningPass();
       adapt_max_allowed_node_weight(coarsener->currentNumberOfNodes(), should_continue);
+      context.reportProgress(PROGRESS_COARSENING, pass_nr, coarsener->currentNumberOfNodes(), 0);
       ++pass_nr;
     }
     coarsener->terminate();
@@ -762,8 +836,15 @@ PartitionID deep_multilevel_partitioning(typename TypeTraits::PartitionedHypergr
     const HypernodeID current_num_nodes = coarsest_hg.initialNumNodes();
     size_t num_threads_per_recursion = std::max(current_num_nodes,
       contraction_limit_for_bipartitioning ) / contraction_limit_for_bipartitioning;
-    const size_t num_parallel_calls = context.shared_memory.num_threads / num_threads_per_recursion +
+    size_t num_parallel_calls = context.shared_memory.num_threads / num_threads_per_recursion +
       (context.shared_memory.num_threads % num_threads_per_recursion != 0);
+    if ( context.partition.deep_ml_copy_memory_limit > 0 ) {
+      // Each recursive call partitions its own copy of the coarsest hypergraph. If the copies
+      // do not fit into the memory limit, we perform fewer calls with more threads per call.
+      num_parallel_calls = std::min(num_parallel_calls, memory_budget::maxNumberOfCopies(
+        memory_budget::instanceSize(coarsest_hg), rb_tree.get_maximum_number_of_blocks(current_num_nodes),
+        context.partition.deep_ml_copy_memory_limit));
+    }
     num_threads_per_recursion = context.shared_memory.num_threads / num_parallel_calls +
       (context.shared_memory.num_threads % num_parallel_calls != 0);
 
@@ -858,7 +939,9 @@ PartitionID deep_multilevel_partitioning(typename TypeTraits::PartitionedHypergr
   // Start uncoarsening
   vec<uint8_t> already_cut(usesAdaptiveWeightOfNonCutEdges(context) ?
     partitioned_hg.initialNumEdges() : 0, 0);
+  size_t level = 0;
   while ( !uncoarsener->isTopLevel() ) {
+    context.checkForCancellation();
     // In the uncoarsening phase, we recursively bipartition each block when
     // the number of nodes gets larger than k' * C.
     while ( uncoarsener->currentNumberOfNodes() >= contraction_limit_for_rb ) {
@@ -893,6 +976,7 @@ PartitionID deep_multilevel_partitioning(typename TypeTraits::PartitionedHypergr
     const HyperedgeWeight obj_before = uncoarsener->getObjective();
     uncoarsener->projectToNextLevelAndRefine();
     const HyperedgeWeight obj_after = uncoarsener->getObjective();
+    context.reportProgress(PROGRESS_REFINEMENT, ++level, uncoarsener->currentNumberOfNodes(), obj_after);
     if ( context.partition.verbose_output && context.type == ContextType::main ) {
       LOG << "Refinement after projecting partition to next level improved"
           << context.partition.objective << "from" << obj_before << "to" << obj_after
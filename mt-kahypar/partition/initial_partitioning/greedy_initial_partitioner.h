@@ -57,78 +57,87 @@ class GreedyInitialPartitionerBase {
   template<typename PQSelectionPolicy>
   void partitionWithSelectionPolicy() {
     if ( _ip_data.should_initial_partitioner_run(_algorithm) ) {
-      HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-      PartitionedHypergraph& hg = _ip_data.local_partitioned_hypergraph();
-      KWayPriorityQueue& kway_pq = _ip_data.local_kway_priority_queue();
-      kahypar::ds::FastResetFlagArray<>& hyperedges_in_queue =
-        _ip_data.local_hyperedge_fast_reset_flag_array();
-
-      initializeVertices();
-
-      PartitionID to = kInvalidPartition;
-      bool use_perfect_balanced_as_upper_bound = true;
-      bool allow_overfitting = false;
-      while (true) {
-        // If our default block has a weight less than the perfect balanced block weight
-        // we terminate greedy initial partitioner in order to prevent that the default block
-        // becomes underloaded.
-        if ( _default_block != kInvalidPartition &&
-            hg.partWeight(_default_block) <
-            _context.partition.perfect_balance_part_weights[_default_block] ) {
-          break;
-        }
+      // Bucket priority queues are faster, but require that the gains are bounded
+      if ( _ip_data.use_bucket_priority_queue() ) {
+        partitionWithPQ<PQSelectionPolicy>(_ip_data.local_kway_bucket_priority_queue());
+      } else {
+        partitionWithPQ<PQSelectionPolicy>(_ip_data.local_kway_priority_queue());
+      }
+    }
+  }
 
-        HypernodeID hn = kInvalidHypernode;
-        Gain gain = kInvalidGain;
-
-        // The greedy initial partitioner has 3 different stages. In the first, we use the perfect
-        // balanced part weight as upper bound for the block weights. Once we reach the block weight
-        // limit, we release the upper bound and use the maximum allowed block weight as new upper bound.
-        // Once we are not able to assign any vertex to a block, we allow overfitting, which effectively
-        // allows to violate the balance constraint.
-        if ( !PQSelectionPolicy::pop(hg, kway_pq, hn, to, gain, use_perfect_balanced_as_upper_bound) ) {
-          if ( use_perfect_balanced_as_upper_bound ) {
-            enableAllPQs(_context.partition.k, kway_pq);
-            use_perfect_balanced_as_upper_bound = false;
-            continue;
-          } else if ( !allow_overfitting ) {
-            enableAllPQs(_context.partition.k, kway_pq);
-            allow_overfitting = true;
-            continue;
-          } else {
-            break;
-          }
+ private:
+  template<typename PQSelectionPolicy, typename PQ>
+  void partitionWithPQ(PQ& kway_pq) {
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    PartitionedHypergraph& hg = _ip_data.local_partitioned_hypergraph();
+    kahypar::ds::FastResetFlagArray<>& hyperedges_in_queue =
+      _ip_data.local_hyperedge_fast_reset_flag_array();
+
+    initializeVertices(kway_pq);
+
+    PartitionID to = kInvalidPartition;
+    bool use_perfect_balanced_as_upper_bound = true;
+    bool allow_overfitting = false;
+    while (true) {
+      // If our default block has a weight less than the perfect balanced block weight
+      // we terminate greedy initial partitioner in order to prevent that the default block
+      // becomes underloaded.
+      if ( _default_block != kInvalidPartition &&
+          hg.partWeight(_default_block) <
+          _context.partition.perfect_balance_part_weights[_default_block] ) {
+        break;
+      }
+
+      HypernodeID hn = kInvalidHypernode;
+      Gain gain = kInvalidGain;
+
+      // The greedy initial partitioner has 3 different stages. In the first, we use the perfect
+      // balanced part weight as upper bound for the block weights. Once we reach the block weight
+      // limit, we release the upper bound and use the maximum allowed block weight as new upper bound.
+      // Once we are not able to assign any vertex to a block, we allow overfitting, which effectively
+      // allows to violate the balance constraint.
+      if ( !PQSelectionPolicy::pop(hg, kway_pq, hn, to, gain, use_perfect_balanced_as_upper_bound) ) {
+        if ( use_perfect_balanced_as_upper_bound ) {
+          enableAllPQs(_context.partition.k, kway_pq);
+          use_perfect_balanced_as_upper_bound = false;
+          continue;
+        } else if ( !allow_overfitting ) {
+          enableAllPQs(_context.partition.k, kway_pq);
+          allow_overfitting = true;
+          continue;
+        } else {
+          break;
         }
+      }
 
-        ASSERT(hn != kInvalidHypernode);
-        ASSERT(to != kInvalidPartition);
-        ASSERT(to != _default_block);
-        ASSERT(hg.partID(hn) == _default_block);
+      ASSERT(hn != kInvalidHypernode);
+      ASSERT(to != kInvalidPartition);
+      ASSERT(to != _default_block);
+      ASSERT(hg.partID(hn) == _default_block);
 
-        if ( allow_overfitting || fitsIntoBlock(hg, hn, to, use_perfect_balanced_as_upper_bound) ) {
-          if ( _default_block != kInvalidPartition ) {
-            hg.changeNodePartNoSync(hn, _default_block, to);
-          } else {
-            hg.setNodePart(hn, to);
-          }
-          insertAndUpdateVerticesAfterMove(hg, kway_pq, hyperedges_in_queue, hn, _default_block, to);
+      if ( allow_overfitting || fitsIntoBlock(hg, hn, to, use_perfect_balanced_as_upper_bound) ) {
+        if ( _default_block != kInvalidPartition ) {
+          hg.changeNodePartNoSync(hn, _default_block, to);
         } else {
-          kway_pq.insert(hn, to, gain);
-          kway_pq.disablePart(to);
+          hg.setNodePart(hn, to);
         }
+        insertAndUpdateVerticesAfterMove(hg, kway_pq, hyperedges_in_queue, hn, _default_block, to);
+      } else {
+        kway_pq.insert(hn, to, gain);
+        kway_pq.disablePart(to);
       }
-      hg.resetEdgeSynchronization();
-
-      HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
-      double time = std::chrono::duration<double>(end - start).count();
-      _ip_data.commit(_algorithm, _rng, _tag, time);
     }
+    hg.resetEdgeSynchronization();
+
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    double time = std::chrono::duration<double>(end - start).count();
+    _ip_data.commit(_algorithm, _rng, _tag, time);
   }
 
- private:
-  void initializeVertices() {
+  template<typename PQ>
+  void initializeVertices(PQ& kway_pq) {
     PartitionedHypergraph& hg = _ip_data.local_partitioned_hypergraph();
-    KWayPriorityQueue& kway_pq = _ip_data.local_kway_priority_queue();
 
     // Experiments have shown that some pq selection policies work better
     // if we preassign all vertices to a block and than execute the greedy
@@ -174,8 +183,9 @@ class GreedyInitialPartitionerBase {
       upper_bound;
   }
 
+  template<typename PQ>
   void insertVertexIntoPQ(const PartitionedHypergraph& hypergraph,
-                          KWayPriorityQueue& pq,
+                          PQ& pq,
                           const HypernodeID hn,
                           const PartitionID to) {
     ASSERT(to != kInvalidPartition && to < _context.partition.k);
@@ -192,8 +202,9 @@ class GreedyInitialPartitionerBase {
     ASSERT(pq.isEnabled(to));
   }
 
+  template<typename PQ>
   void insertUnassignedVertexIntoPQ(const PartitionedHypergraph& hypergraph,
-                                    KWayPriorityQueue& pq,
+                                    PQ& pq,
                                     const PartitionID to) {
     ASSERT(to != _default_block);
     const HypernodeID unassigned_hn = _ip_data.get_unassigned_hypernode(_default_block);
@@ -202,8 +213,9 @@ class GreedyInitialPartitionerBase {
     }
   }
 
+  template<typename PQ>
   void insertAndUpdateVerticesAfterMove(const PartitionedHypergraph& hypergraph,
-                                        KWayPriorityQueue& pq,
+                                        PQ& pq,
                                         kahypar::ds::FastResetFlagArray<>& hyperedges_in_queue,
                                         const HypernodeID hn,
                                         const PartitionID from,
@@ -246,7 +258,8 @@ class GreedyInitialPartitionerBase {
     }
   }
 
-  void enableAllPQs(const PartitionID k, KWayPriorityQueue& pq) {
+  template<typename PQ>
+  void enableAllPQs(const PartitionID k, PQ& pq) {
     for ( PartitionID block = 0; block < k; ++block ) {
       if ( block != _default_block ) {
         pq.enablePart(block);
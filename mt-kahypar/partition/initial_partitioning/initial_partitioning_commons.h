@@ -36,12 +36,19 @@
 #include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/kway_bucket_priority_queue.h"
 
 namespace mt_kahypar {
 
 using KWayPriorityQueue = kahypar::ds::KWayPriorityQueue<HypernodeID, Gain, std::numeric_limits<Gain>, false>;
 using ThreadLocalKWayPriorityQueue = tbb::enumerable_thread_specific<KWayPriorityQueue>;
 
+// ! The greedy initial partitioners use bucket priority queues if the absolute value
+// ! of all gains is bounded by this value (gains are bounded by the weighted node degrees)
+static constexpr Gain MAX_GAIN_FOR_BUCKET_PQ = 1024;
+using KWayBucketPriorityQueue = ds::KWayBucketPriorityQueue;
+using ThreadLocalKWayBucketPriorityQueue = tbb::enumerable_thread_specific<KWayBucketPriorityQueue>;
+
 using ThreadLocalFastResetFlagArray = tbb::enumerable_thread_specific<kahypar::ds::FastResetFlagArray<> >;
 
 }
\ No newline at end of file
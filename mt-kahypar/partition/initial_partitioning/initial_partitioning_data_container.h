@@ -26,12 +26,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <sstream>
 #include <mutex>
 
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_arena.h>
 
 #include "mt-kahypar/partition/initial_partitioning/initial_partitioning_commons.h"
+#include "mt-kahypar/partition/initial_partitioning/portfolio_scheduler.h"
 
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/metrics.h"
@@ -183,6 +186,19 @@ class InitialPartitioningDataContainer {
              _stats[algo_idx].average_quality - 2.0 * _stats[algo_idx].stddev() <= _best_quality;
     }
 
+    // ! Returns the stats of all initial partitioning algorithms and
+    // ! the quality of the best feasible partition found so far
+    HyperedgeWeight algorithm_stats(vec<IPAlgorithmStats>& stats) {
+      std::lock_guard<std::mutex> _lock(_stat_mutex);
+      stats.resize(_stats.size());
+      for ( size_t i = 0; i < _stats.size(); ++i ) {
+        stats[i].num_runs = _stats[i].n;
+        stats[i].average_quality = _stats[i].average_quality;
+        stats[i].stddev = _stats[i].stddev();
+      }
+      return _best_quality;
+    }
+
     std::mutex _stat_mutex;
     const Context& _context;
     parallel::scalable_vector<InitialPartitioningRunStats> _stats;
@@ -261,7 +277,8 @@ class InitialPartitioningDataContainer {
     }
 
     PartitioningResult performRefinementOnPartition(vec<PartitionID>& partition,
-                                                    PartitioningResult& input, std::mt19937& prng) {
+                                                    PartitioningResult& input, std::mt19937& prng,
+                                                    const std::atomic<HyperedgeWeight>* abort_bound = nullptr) {
       Metrics current_metric = { input._objective, input._imbalance };
 
       _partitioned_hypergraph.resetPartition();
@@ -276,7 +293,7 @@ class InitialPartitioningDataContainer {
       HEAVY_INITIAL_PARTITIONING_ASSERT(
         current_metric.quality == metrics::quality(_partitioned_hypergraph, _context, false));
 
-      refineCurrentPartition(current_metric, prng);
+      refineCurrentPartition(current_metric, prng, abort_bound);
 
       PartitioningResult result(_result._algorithm,
         current_metric.quality, current_metric.quality,
@@ -285,9 +302,10 @@ class InitialPartitioningDataContainer {
       return result;
     }
 
-    void performRefinementOnBestPartition(int seed) {
+    void performRefinementOnBestPartition(int seed,
+                                          const std::atomic<HyperedgeWeight>* abort_bound = nullptr) {
       std::mt19937 prng(seed);
-      auto refined = performRefinementOnPartition(_partition, _result, prng);
+      auto refined = performRefinementOnPartition(_partition, _result, prng, abort_bound);
 
       // Compare current best partition with refined partition
       if ( _result.is_other_better(refined, _context.partition.epsilon) ) {
@@ -308,11 +326,19 @@ class InitialPartitioningDataContainer {
       }
     }
 
-    void refineCurrentPartition(Metrics& current_metric, std::mt19937& prng) {
+    // ! If abort_bound is given, the FM rounds stop as soon as repeating the improvement
+    // ! of the last round would still not result in a quality better than the bound
+    void refineCurrentPartition(Metrics& current_metric, std::mt19937& prng,
+                                const std::atomic<HyperedgeWeight>* abort_bound = nullptr) {
       if ( _context.partition.k == 2 && _twoway_fm ) {
         bool improvement = true;
         for ( size_t i = 0; i < _context.initial_partitioning.fm_refinment_rounds && improvement; ++i ) {
+          const HyperedgeWeight quality_before = current_metric.quality;
           improvement = _twoway_fm->refine(current_metric, prng);
+          const HyperedgeWeight round_improvement = quality_before - current_metric.quality;
+          if ( abort_bound && current_metric.quality - round_improvement > abort_bound->load(std::memory_order_relaxed) ) {
+            break;
+          }
         }
       } else if ( _label_propagation ) {
         mt_kahypar_partitioned_hypergraph_t phg =
@@ -370,6 +396,9 @@ class InitialPartitioningDataContainer {
     }),
     _local_kway_pq(_context.partition.k),
     _is_local_pq_initialized(false),
+    _max_weighted_degree(maxWeightedDegree(hypergraph)),
+    _local_kway_bucket_pq(_context.partition.k),
+    _is_local_bucket_pq_initialized(false),
     _local_hn_visited(_context.partition.k * hypergraph.initialNumNodes()),
     _local_he_visited(_context.partition.k * hypergraph.initialNumEdges()),
     _local_unassigned_hypernodes(),
@@ -430,6 +459,23 @@ class InitialPartitioningDataContainer {
     return local_kway_pq;
   }
 
+  // ! All gains of the greedy initial partitioners are bounded by the maximum
+  // ! weighted degree. If it is small, we can use bucket priority queues.
+  bool use_bucket_priority_queue() const {
+    return _max_weighted_degree <= MAX_GAIN_FOR_BUCKET_PQ;
+  }
+
+  KWayBucketPriorityQueue& local_kway_bucket_priority_queue() {
+    ASSERT(use_bucket_priority_queue());
+    bool& is_local_pq_initialized = _is_local_bucket_pq_initialized.local();
+    KWayBucketPriorityQueue& local_kway_pq = _local_kway_bucket_pq.local();
+    if ( !is_local_pq_initialized ) {
+      local_kway_pq.initialize(local_partitioned_hypergraph().initialNumNodes(), _max_weighted_degree);
+      is_local_pq_initialized = true;
+    }
+    return local_kway_pq;
+  }
+
   kahypar::ds::FastResetFlagArray<>& local_hypernode_fast_reset_flag_array() {
     return _local_hn_visited.local();
   }
@@ -485,6 +531,10 @@ class InitialPartitioningDataContainer {
     return _global_stats.should_initial_partitioner_run(algorithm);
   }
 
+  HyperedgeWeight algorithm_stats(vec<IPAlgorithmStats>& stats) {
+    return _global_stats.algorithm_stats(stats);
+  }
+
   /*!
    * Commits the current partition computed on the local hypergraph. Partition replaces
    * the best local partition, if it has a better quality (or better imbalance).
@@ -558,22 +608,32 @@ class InitialPartitioningDataContainer {
       });
 
       if ( _context.initial_partitioning.perform_refinement_on_best_partitions ) {
+        // The bound is not updated during refinement to keep the abort decisions deterministic
+        std::atomic<HyperedgeWeight> abort_bound(bestFeasibleObjective(
+          _best_partitions.begin(), _best_partitions.end(), [](const auto& p) -> const PartitioningResult& {
+            return p.first;
+          }));
         auto refinement_task = [&](size_t i) {
-          auto& my_data = _local_hg.local();
-          auto& my_phg = my_data._partitioned_hypergraph;
-          vec<PartitionID>& my_partition = _best_partitions[i].second;
-          PartitioningResult& my_objectives = _best_partitions[i].first;
-          std::mt19937 prng(_context.partition.seed + 420 + my_phg.initialNumPins() + i);
-          auto refined = my_data.performRefinementOnPartition(my_partition, my_objectives, prng);
-          refined._deterministic_tag = my_objectives._deterministic_tag;
-          refined._random_tag = my_objectives._random_tag;
-
-          if (my_objectives.is_other_better(refined, _context.partition.epsilon)) {
-            for (HypernodeID node : my_phg.nodes()) {
-              my_partition[node] = my_phg.partID(node);
+          // The refinement uses the thread-local hypergraph, which must not be
+          // used by other refinement tasks stolen while waiting in nested parallel loops
+          tbb::this_task_arena::isolate([&] {
+            auto& my_data = _local_hg.local();
+            auto& my_phg = my_data._partitioned_hypergraph;
+            vec<PartitionID>& my_partition = _best_partitions[i].second;
+            PartitioningResult& my_objectives = _best_partitions[i].first;
+            std::mt19937 prng(_context.partition.seed + 420 + my_phg.initialNumPins() + i);
+            auto refined = my_data.performRefinementOnPartition(my_partition, my_objectives, prng,
+              _context.initial_partitioning.abort_unpromising_refinements ? &abort_bound : nullptr);
+            refined._deterministic_tag = my_objectives._deterministic_tag;
+            refined._random_tag = my_objectives._random_tag;
+
+            if (my_objectives.is_other_better(refined, _context.partition.epsilon)) {
+              for (HypernodeID node : my_phg.nodes()) {
+                my_partition[node] = my_phg.partID(node);
+              }
+              my_objectives = refined;
             }
-            my_objectives = refined;
-          }
+          });
         };
 
         tbb::task_group fm_refinement_group;
@@ -603,10 +663,22 @@ class InitialPartitioningDataContainer {
       // Perform FM refinement on the best partition of each thread
       int thread_counter = 0;
       if ( _context.initial_partitioning.perform_refinement_on_best_partitions ) {
+        // Refined partitions that are balanced lower the bound for all other refinements
+        std::atomic<HyperedgeWeight> abort_bound(bestFeasibleObjective(
+          _local_hg.begin(), _local_hg.end(), [](const auto& p) -> const PartitioningResult& {
+            return p._result;
+          }));
+        const std::atomic<HyperedgeWeight>* bound =
+          _context.initial_partitioning.abort_unpromising_refinements ? &abort_bound : nullptr;
         tbb::task_group fm_refinement_group;
         for ( LocalInitialPartitioningHypergraph& partition : _local_hg ) {
           fm_refinement_group.run([&, thread_counter] {
-            partition.performRefinementOnBestPartition(_partitioned_hg.initialNumPins() + thread_counter);
+            partition.performRefinementOnBestPartition(_partitioned_hg.initialNumPins() + thread_counter, bound);
+            if ( partition._result._imbalance <= _context.partition.epsilon ) {
+              HyperedgeWeight current_bound = abort_bound.load(std::memory_order_relaxed);
+              while ( partition._result._objective < current_bound &&
+                      !abort_bound.compare_exchange_weak(current_bound, partition._result._objective) ) { }
+            }
           });
           thread_counter++;
         }
@@ -688,11 +760,39 @@ class InitialPartitioningDataContainer {
   }
 
  private:
+  // ! Returns the best objective of all balanced partitions (or the maximum weight if there is none)
+  template<typename Iterator, typename GetResult>
+  HyperedgeWeight bestFeasibleObjective(Iterator begin, Iterator end, GetResult get_result) const {
+    HyperedgeWeight best_objective = std::numeric_limits<HyperedgeWeight>::max();
+    for ( Iterator it = begin; it != end; ++it ) {
+      const PartitioningResult& result = get_result(*it);
+      if ( result._imbalance <= _context.partition.epsilon ) {
+        best_objective = std::min(best_objective, result._objective);
+      }
+    }
+    return best_objective;
+  }
+
   LocalInitialPartitioningHypergraph construct_local_partitioned_hypergraph() {
     return LocalInitialPartitioningHypergraph(
       _partitioned_hg.hypergraph(), _context, _global_stats, _disable_fm);
   }
 
+  static Gain maxWeightedDegree(const PartitionedHypergraph& hypergraph) {
+    Gain max_weighted_degree = 0;
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      Gain weighted_degree = 0;
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        weighted_degree += hypergraph.edgeWeight(he);
+        if ( weighted_degree > MAX_GAIN_FOR_BUCKET_PQ ) {
+          return weighted_degree;
+        }
+      }
+      max_weighted_degree = std::max(max_weighted_degree, weighted_degree);
+    }
+    return max_weighted_degree;
+  }
+
   PartitionedHypergraph& _partitioned_hg;
   Context _context;
   const bool _disable_fm;
@@ -703,6 +803,9 @@ class InitialPartitioningDataContainer {
   ThreadLocalHypergraph _local_hg;
   ThreadLocalKWayPriorityQueue _local_kway_pq;
   tbb::enumerable_thread_specific<bool> _is_local_pq_initialized;
+  const Gain _max_weighted_degree;
+  ThreadLocalKWayBucketPriorityQueue _local_kway_bucket_pq;
+  tbb::enumerable_thread_specific<bool> _is_local_bucket_pq_initialized;
   ThreadLocalFastResetFlagArray _local_hn_visited;
   ThreadLocalFastResetFlagArray _local_he_visited;
   ThreadLocalUnassignedHypernodes _local_unassigned_hypernodes;
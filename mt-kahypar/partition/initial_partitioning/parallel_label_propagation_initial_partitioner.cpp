@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/initial_partitioning/parallel_label_propagation_initial_partitioner.h"
+
+#include <algorithm>
+#include <queue>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/hash.h"
+
+namespace mt_kahypar {
+
+namespace {
+  // Scores of the blocks adjacent to the current node. The last hyperedge that
+  // contributed to a block ensures that each hyperedge is counted once per block.
+  struct BlockScores {
+    explicit BlockScores(const PartitionID k) :
+      score(k, 0),
+      last_edge(k, kInvalidHyperedge),
+      touched() { }
+
+    vec<HyperedgeWeight> score;
+    vec<HyperedgeID> last_edge;
+    vec<PartitionID> touched;
+  };
+}
+
+template<typename TypeTraits>
+void ParallelLabelPropagationInitialPartitioner<TypeTraits>::partition(PartitionedHypergraph& hypergraph,
+                                                                       const Context& context) {
+  const PartitionID k = context.partition.k;
+  const HypernodeID num_nodes = hypergraph.initialNumNodes();
+  vec<CAtomic<PartitionID>> part_ids(num_nodes, CAtomic<PartitionID>(kInvalidPartition));
+  vec<CAtomic<HypernodeWeight>> part_weights(k, CAtomic<HypernodeWeight>(0));
+
+  // Atomically reserves the weight of the node in the given block,
+  // if this does not violate its maximum allowed block weight
+  auto try_assign = [&](const HypernodeID hn, const PartitionID block) {
+    const HypernodeWeight weight = hypergraph.nodeWeight(hn);
+    if ( part_weights[block].add_fetch(weight, std::memory_order_relaxed) <=
+         context.partition.max_part_weights[block] ) {
+      part_ids[hn].store(block, std::memory_order_relaxed);
+      return true;
+    }
+    part_weights[block].sub_fetch(weight, std::memory_order_relaxed);
+    return false;
+  };
+
+  // Fixed vertices are assigned to their blocks upfront
+  hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+    if ( hypergraph.isFixed(hn) ) {
+      const PartitionID block = hypergraph.fixedVertexBlock(hn);
+      part_weights[block].add_fetch(hypergraph.nodeWeight(hn), std::memory_order_relaxed);
+      part_ids[hn].store(block, std::memory_order_relaxed);
+    }
+  });
+
+  // Choose k pseudo-random seed nodes (one per block)
+  vec<std::pair<uint64_t, HypernodeID>> candidates(num_nodes);
+  tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+    const bool is_candidate = hypergraph.nodeIsEnabled(hn) &&
+      !hypergraph.isFixed(hn) && hypergraph.nodeDegree(hn) > 0;
+    candidates[hn] = std::make_pair(is_candidate ? hashing::integer::hash64(
+      static_cast<uint64_t>(context.partition.seed) << 32 | hn) : std::numeric_limits<uint64_t>::max(), hn);
+  });
+  const size_t num_seeds = std::min(static_cast<size_t>(k), candidates.size());
+  tbb::parallel_sort(candidates.begin(), candidates.end());
+  for ( size_t i = 0; i < num_seeds; ++i ) {
+    if ( candidates[i].first != std::numeric_limits<uint64_t>::max() ) {
+      try_assign(candidates[i].second, static_cast<PartitionID>(i));
+    }
+  }
+
+  // Each round assigns all unassigned nodes that are adjacent to a block to the block
+  // with the most incident hyperedge weight that has still capacity. The rounds are
+  // asynchronous, i.e., a node observes the assignments of the current round.
+  const size_t max_edge_size = context.refinement.label_propagation.hyperedge_size_activation_threshold;
+  tbb::enumerable_thread_specific<BlockScores> local_scores([&] { return BlockScores(k); });
+  bool converged = false;
+  for ( size_t round = 0; round < context.initial_partitioning.lp_maximum_iterations && !converged; ++round ) {
+    CAtomic<bool> assigned_node(false);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+      if ( part_ids[hn].load(std::memory_order_relaxed) != kInvalidPartition ) {
+        return;
+      }
+      BlockScores& scores = local_scores.local();
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        if ( hypergraph.edgeSize(he) > max_edge_size ) {
+          continue;
+        }
+        const HyperedgeWeight edge_weight = hypergraph.edgeWeight(he);
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          const PartitionID block = part_ids[pin].load(std::memory_order_relaxed);
+          if ( block != kInvalidPartition && scores.last_edge[block] != he ) {
+            if ( scores.score[block] == 0 ) {
+              scores.touched.push_back(block);
+            }
+            scores.last_edge[block] = he;
+            scores.score[block] += edge_weight;
+          }
+        }
+      }
+
+      // Try the adjacent blocks in decreasing order of their scores
+      std::sort(scores.touched.begin(), scores.touched.end(),
+        [&](const PartitionID lhs, const PartitionID rhs) {
+          return scores.score[lhs] > scores.score[rhs] ||
+            ( scores.score[lhs] == scores.score[rhs] && lhs < rhs );
+        });
+      for ( const PartitionID block : scores.touched ) {
+        if ( try_assign(hn, block) ) {
+          assigned_node.store(true, std::memory_order_relaxed);
+          break;
+        }
+      }
+      for ( const PartitionID block : scores.touched ) {
+        scores.score[block] = 0;
+        scores.last_edge[block] = kInvalidHyperedge;
+      }
+      scores.touched.clear();
+    });
+    converged = !assigned_node.load(std::memory_order_relaxed);
+  }
+
+  // Nodes that are not reachable from a seed node (or did not fit into an adjacent block)
+  // are assigned to the block with minimum weight, heaviest nodes first
+  vec<HypernodeID> unassigned_nodes;
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    if ( part_ids[hn].load(std::memory_order_relaxed) == kInvalidPartition ) {
+      unassigned_nodes.push_back(hn);
+    }
+  }
+  if ( !unassigned_nodes.empty() ) {
+    std::sort(unassigned_nodes.begin(), unassigned_nodes.end(),
+      [&](const HypernodeID lhs, const HypernodeID rhs) {
+        return hypergraph.nodeWeight(lhs) > hypergraph.nodeWeight(rhs) ||
+          ( hypergraph.nodeWeight(lhs) == hypergraph.nodeWeight(rhs) && lhs < rhs );
+      });
+    using WeightedBlock = std::pair<HypernodeWeight, PartitionID>;
+    std::priority_queue<WeightedBlock, vec<WeightedBlock>, std::greater<WeightedBlock>> lightest_blocks;
+    for ( PartitionID block = 0; block < k; ++block ) {
+      lightest_blocks.emplace(part_weights[block].load(std::memory_order_relaxed), block);
+    }
+    for ( const HypernodeID& hn : unassigned_nodes ) {
+      WeightedBlock lightest = lightest_blocks.top();
+      lightest_blocks.pop();
+      part_ids[hn].store(lightest.second, std::memory_order_relaxed);
+      lightest.first += hypergraph.nodeWeight(hn);
+      lightest_blocks.push(lightest);
+    }
+  }
+
+  hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+    hypergraph.setOnlyNodePart(hn, part_ids[hn].load(std::memory_order_relaxed));
+  });
+  hypergraph.initializePartition();
+}
+
+INSTANTIATE_CLASS_WITH_TYPE_TRAITS(ParallelLabelPropagationInitialPartitioner)
+
+} // namespace mt_kahypar
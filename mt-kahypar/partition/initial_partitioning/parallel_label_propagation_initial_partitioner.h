@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "include/mtkahypartypes.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Direct k-way initial partitioner that grows the blocks from k seed nodes via
+ * parallel label propagation. In contrast to the pool initial partitioner, it
+ * operates on the shared hypergraph with all threads instead of partitioning
+ * thread-local copies, which makes it suitable for large k and coarse hypergraphs
+ * that are too large for the sequential flat initial partitioning algorithms.
+ */
+template<typename TypeTraits>
+class ParallelLabelPropagationInitialPartitioner {
+ using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+ public:
+  static void partition(PartitionedHypergraph& hypergraph, const Context& context);
+};
+
+} // namespace mt_kahypar
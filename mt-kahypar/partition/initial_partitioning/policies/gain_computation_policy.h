@@ -98,8 +98,9 @@ class CutGainPolicy {
     return gain;
   }
 
+  template<typename PQ>
   static inline void deltaGainUpdate(const PartitionedHypergraph& hypergraph,
-                                     KWayPriorityQueue& pq,
+                                     PQ& pq,
                                      const HypernodeID hn,
                                      const PartitionID from,
                                      const PartitionID to) {
@@ -135,8 +136,9 @@ class CutGainPolicy {
       } (), "Delta Gain Update failed!");
   }
 
+  template<typename PQ>
   static inline void deltaGainUpdateForInvalidBlock(const PartitionedHypergraph& hypergraph,
-                                                    KWayPriorityQueue& pq,
+                                                    PQ& pq,
                                                     const HypernodeID hn,
                                                     const PartitionID,
                                                     const PartitionID to) {
@@ -174,8 +176,9 @@ class CutGainPolicy {
     }
   }
 
+  template<typename PQ>
   static inline void deltaGainUpdateForValidBlock(const PartitionedHypergraph& hypergraph,
-                                                  KWayPriorityQueue& pq,
+                                                  PQ& pq,
                                                   const HypernodeID hn,
                                                   const PartitionID from,
                                                   const PartitionID to) {
@@ -244,8 +247,9 @@ class MaxNetGainPolicy {
     return gain;
   }
 
+  template<typename PQ>
   static inline void deltaGainUpdate(const PartitionedHypergraph& hypergraph,
-                                     KWayPriorityQueue& pq,
+                                     PQ& pq,
                                      const HypernodeID hn,
                                      const PartitionID,
                                      const PartitionID to) {
@@ -39,8 +39,9 @@ class RoundRobinPQSelectionPolicy {
   using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
 
  public:
+  template<typename PQ>
   static inline bool pop(const PartitionedHypergraph& hypergraph,
-                         KWayPriorityQueue& pq,
+                         PQ& pq,
                          HypernodeID& hn,
                          PartitionID& to,
                          Gain& gain,
@@ -83,8 +84,9 @@ class GlobalPQSelectionPolicy {
   using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
 
  public:
+  template<typename PQ>
   static inline bool pop(const PartitionedHypergraph&,
-                         KWayPriorityQueue& pq,
+                         PQ& pq,
                          HypernodeID& hn,
                          PartitionID& to,
                          Gain& gain,
@@ -119,8 +121,9 @@ class SequentialPQSelectionPolicy {
   using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
 
  public:
+  template<typename PQ>
   static inline bool pop(const PartitionedHypergraph& hypergraph,
-                         KWayPriorityQueue& pq,
+                         PQ& pq,
                          HypernodeID& hn,
                          PartitionID& to,
                          Gain& gain,
@@ -26,8 +26,12 @@
 
 #pragma once
 
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
 #include <tbb/task.h>
+#include <tbb/task_arena.h>
 
+#include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/stl/scalable_queue.h"
 #include "mt-kahypar/partition/initial_partitioning/initial_partitioning_data_container.h"
@@ -42,6 +46,7 @@ class PseudoPeripheralStartNodes {
 
   using StartNodes = vec<vec<HypernodeID>>;
   using Queue = parallel::scalable_queue<HypernodeID>;
+  using ThreadSafeFlagArray = ds::ThreadSafeFastResetFlagArray<>;
   using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
 
  public:
@@ -118,7 +123,21 @@ class PseudoPeripheralStartNodes {
         hypergraph.initialNumNodes() - hypergraph.numRemovedHypernodes() -
         ip_data.numFixedVertices();
       parallel::scalable_vector<HypernodeID> non_touched_hypernodes;
+      const bool use_parallel_bfs =
+        current_num_nodes > context.initial_partitioning.min_num_nodes_for_parallel_bfs;
+      ThreadSafeFlagArray visited_hypernodes;
+      ThreadSafeFlagArray visited_hyperedges;
+      if ( use_parallel_bfs ) {
+        visited_hypernodes.setSize(hypergraph.initialNumNodes());
+        visited_hyperedges.setSize(hypergraph.initialNumEdges());
+      }
       for ( const PartitionID block : empty_blocks ) {
+        if ( use_parallel_bfs ) {
+          start_nodes[block].push_back(lastHypernodeOfParallelBFS(hypergraph, context, start_nodes,
+            ip_data, visited_hypernodes, visited_hyperedges, current_num_nodes, rng));
+          continue;
+        }
+
         Queue queue;
         hypernodes_in_queue.reset();
         hyperedges_in_queue.reset();
@@ -173,6 +192,81 @@ class PseudoPeripheralStartNodes {
   }
 
  private:
+  /*!
+   * Level-synchronous parallel variant of the BFS above. All nodes of the current
+   * level (frontier) are expanded in parallel and the visited flags of nodes and
+   * edges are set via CAS operations. Returns the node with the smallest ID of the
+   * last level such that the result does not depend on the thread schedule.
+   */
+  static inline HypernodeID lastHypernodeOfParallelBFS(const PartitionedHypergraph& hypergraph,
+                                                       const Context& context,
+                                                       const StartNodes& start_nodes,
+                                                       InitialPartitioningDataContainer<TypeTraits>& ip_data,
+                                                       ThreadSafeFlagArray& visited_hypernodes,
+                                                       ThreadSafeFlagArray& visited_hyperedges,
+                                                       const HypernodeID current_num_nodes,
+                                                       std::mt19937& rng) {
+    visited_hypernodes.reset();
+    visited_hyperedges.reset();
+    for ( const HypernodeID& hn : ip_data.fixedVertices() ) {
+      visited_hypernodes.set(hn, true);
+    }
+    vec<HypernodeID> frontier;
+    for ( const vec<HypernodeID>& nodes_of_block : start_nodes ) {
+      for ( const HypernodeID& hn : nodes_of_block ) {
+        if ( visited_hypernodes.compare_and_set_to_true(hn) ) {
+          frontier.push_back(hn);
+        }
+      }
+    }
+    ASSERT(!frontier.empty());
+
+    HypernodeID last_hypernode_touched = kInvalidHypernode;
+    HypernodeID num_touched_hypernodes = 0;
+    tbb::enumerable_thread_specific<vec<HypernodeID>> local_next_frontier;
+    while ( !frontier.empty() ) {
+      last_hypernode_touched = *std::min_element(frontier.begin(), frontier.end());
+      num_touched_hypernodes += frontier.size();
+      // The initial partitioners run concurrently and use thread-local data. Isolation
+      // prevents that a waiting thread starts another initial partitioning run.
+      tbb::this_task_arena::isolate([&] {
+        tbb::parallel_for(UL(0), frontier.size(), [&](const size_t i) {
+          vec<HypernodeID>& next_frontier = local_next_frontier.local();
+          for ( const HyperedgeID& he : hypergraph.incidentEdges(frontier[i]) ) {
+            if ( visited_hyperedges.compare_and_set_to_true(he) &&
+                 hypergraph.edgeSize(he) <= context.partition.ignore_hyperedge_size_threshold ) {
+              for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+                if ( visited_hypernodes.compare_and_set_to_true(pin) ) {
+                  next_frontier.push_back(pin);
+                }
+              }
+            }
+          }
+        });
+      });
+
+      frontier.clear();
+      for ( vec<HypernodeID>& next_frontier : local_next_frontier ) {
+        frontier.insert(frontier.end(), next_frontier.begin(), next_frontier.end());
+        next_frontier.clear();
+      }
+    }
+
+    if ( num_touched_hypernodes < current_num_nodes ) {
+      // The hypergraph is not connected => choose one unvisited vertex at random
+      vec<HypernodeID> non_touched_hypernodes;
+      for ( const HypernodeID& hn : hypergraph.nodes() ) {
+        if ( !visited_hypernodes[hn] ) {
+          non_touched_hypernodes.push_back(hn);
+        }
+      }
+      ASSERT(!non_touched_hypernodes.empty());
+      const int rand_idx = std::uniform_int_distribution<>(0, non_touched_hypernodes.size() - 1)(rng);
+      last_hypernode_touched = non_touched_hypernodes[rand_idx];
+    }
+    return last_hypernode_touched;
+  }
+
   static inline void initializeQueue(Queue& queue,
                                      StartNodes& start_nodes,
                                      InitialPartitioningDataContainer<TypeTraits>& ip_data,
@@ -26,20 +26,39 @@
 
 #include "pool_initial_partitioner.h"
 
+#include <atomic>
+
 #include <tbb/task_group.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/factories.h"
 #include "mt-kahypar/partition/initial_partitioning/i_initial_partitioner.h"
 #include "mt-kahypar/partition/initial_partitioning/initial_partitioning_data_container.h"
+#include "mt-kahypar/partition/initial_partitioning/portfolio_scheduler.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/utilities.h"
 
 namespace mt_kahypar {
 
 namespace {
 // IP algorithm and random seed
 using IPTask = std::tuple<InitialPartitioningAlgorithm, int, int>;
+
+// ! Performs one run of an initial partitioning algorithm
+void runInitialPartitioner(const InitialPartitioningAlgorithm algorithm,
+                           ip_data_container_t* ip_data_ptr,
+                           const Context& context,
+                           const int seed,
+                           const int tag) {
+  utils::Timer::ScopedTraceSpan span(utils::Utilities::instance().getTimer(context.utility_id),
+    "Initial Partitioning Run", "initial_partitioning");
+  span.addArg("algorithm", algorithm);
+  std::unique_ptr<IInitialPartitioner> initial_partitioner =
+    InitialPartitionerFactory::getInstance().createObject(
+      algorithm, algorithm, ip_data_ptr, context, seed, tag);
+  initial_partitioner->partition();
+}
 }
 
 template<typename TypeTraits>
@@ -53,6 +72,17 @@ void Pool<TypeTraits>::bipartition(PartitionedHypergraph& hypergraph,
       "Size of enabled IP algorithms vector is smaller than number of IP algorithms!");
   }
 
+  // On tiny hypergraphs, the setup of the thread-local data (a copy of the hypergraph,
+  // gain cache and refiners for each thread) dominates the running time of the runs.
+  // Thus, we perform all runs on the calling thread and use only one thread-local copy.
+  const bool parallel = run_parallel &&
+    hypergraph.initialNumNodes() > context.initial_partitioning.max_num_nodes_for_sequential_ip;
+
+  if ( context.initial_partitioning.use_portfolio_scheduling && !context.partition.deterministic ) {
+    bipartitionWithPortfolioScheduling(hypergraph, context, parallel);
+    return;
+  }
+
   int tag = 0;
   std::mt19937 rng(context.partition.seed);
   vec<IPTask> _ip_task_lists;
@@ -74,28 +104,74 @@ void Pool<TypeTraits>::bipartition(PartitionedHypergraph& hypergraph,
   tbb::task_group tg;
   InitialPartitioningDataContainer<TypeTraits> ip_data(hypergraph, context);
   ip_data_container_t* ip_data_ptr = ip::to_pointer(ip_data);
+  std::atomic<size_t> num_finished_runs(0);
+  // If the time limit is exceeded, we skip all remaining runs once at least one
+  // run has finished, which ensures that there is a partition to apply.
+  auto skip_run = [&] {
+    return num_finished_runs.load(std::memory_order_relaxed) > 0 && context.isTimeLimitExceeded();
+  };
   for ( const auto& ip_task : _ip_task_lists ) {
     const InitialPartitioningAlgorithm algorithm = std::get<0>(ip_task);
     const int seed = std::get<1>(ip_task);
     const int tag = std::get<2>(ip_task);
-    if ( run_parallel ) {
+    if ( parallel ) {
       tg.run([&, algorithm, seed, tag] {
-        std::unique_ptr<IInitialPartitioner> initial_partitioner =
-          InitialPartitionerFactory::getInstance().createObject(
-            algorithm, algorithm, ip_data_ptr, context, seed, tag);
-        initial_partitioner->partition();
+        if ( skip_run() ) {
+          return;
+        }
+        runInitialPartitioner(algorithm, ip_data_ptr, context, seed, tag);
+        ++num_finished_runs;
       });
     } else {
-      std::unique_ptr<IInitialPartitioner> initial_partitioner =
-        InitialPartitionerFactory::getInstance().createObject(
-          algorithm, algorithm, ip_data_ptr, context, seed, tag);
-      initial_partitioner->partition();
+      if ( skip_run() ) {
+        break;
+      }
+      runInitialPartitioner(algorithm, ip_data_ptr, context, seed, tag);
+      ++num_finished_runs;
     }
   }
   tg.wait();
   ip_data.apply();
 }
 
+template<typename TypeTraits>
+void Pool<TypeTraits>::bipartitionWithPortfolioScheduling(PartitionedHypergraph& hypergraph,
+                                                          const Context& context,
+                                                          const bool run_parallel) {
+  InitialPartitioningDataContainer<TypeTraits> ip_data(hypergraph, context);
+  ip_data_container_t* ip_data_ptr = ip::to_pointer(ip_data);
+  IPPortfolioScheduler scheduler(context);
+  std::atomic<size_t> num_finished_runs(0);
+  // Each worker repeatedly asks the scheduler for the next algorithm based
+  // on the stats of all runs that are finished so far
+  auto run_portfolio = [&] {
+    vec<IPAlgorithmStats> stats;
+    InitialPartitioningAlgorithm algorithm = InitialPartitioningAlgorithm::UNDEFINED;
+    int seed = 0;
+    int tag = 0;
+    while ( !( num_finished_runs.load(std::memory_order_relaxed) > 0 && context.isTimeLimitExceeded() ) ) {
+      const HyperedgeWeight best_quality = ip_data.algorithm_stats(stats);
+      if ( !scheduler.next(stats, best_quality, algorithm, seed, tag) ) {
+        break;
+      }
+      runInitialPartitioner(algorithm, ip_data_ptr, context, seed, tag);
+      ++num_finished_runs;
+    }
+  };
+
+  if ( run_parallel ) {
+    tbb::task_group tg;
+    const size_t num_workers = std::min(context.shared_memory.num_threads, scheduler.remainingRuns());
+    for ( size_t i = 0; i < num_workers; ++i ) {
+      tg.run(run_portfolio);
+    }
+    tg.wait();
+  } else {
+    run_portfolio();
+  }
+  ip_data.apply();
+}
+
 INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Pool)
 
 } // namespace mt_kahypar
\ No newline at end of file
@@ -41,6 +41,13 @@ class Pool {
   static void bipartition(PartitionedHypergraph& hypergraph,
                           const Context& context,
                           const bool run_parallel = true);
+
+ private:
+  // ! Distributes the runs dynamically to the initial partitioning
+  // ! algorithms that performed best so far (see IPPortfolioScheduler)
+  static void bipartitionWithPortfolioScheduling(PartitionedHypergraph& hypergraph,
+                                                 const Context& context,
+                                                 const bool run_parallel);
 };
 
 } // namespace mt_kahypar
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <random>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+// ! Quality of all runs of an initial partitioning algorithm committed so far
+struct IPAlgorithmStats {
+  size_t num_runs = 0;
+  double average_quality = 0.0;
+  double stddev = 0.0;
+};
+
+/**
+ * Schedules the runs of the initial partitioning algorithms of the pool
+ * based on the quality of the partitions that they produced so far on the
+ * current hypergraph (multi-armed bandit). The total number of runs is the
+ * same as with static scheduling (runs times number of enabled algorithms).
+ *
+ * Each algorithm first performs a few warm-up runs. Afterwards, the next
+ * algorithm is chosen via UCB1, where the reward of an algorithm is the ratio
+ * between the best average quality and its average quality. An algorithm is
+ * pruned if it is unlikely that it finds a new best partition with the same
+ * rule as used for adaptive IP runs (avg_quality - 2 * stddev > best quality).
+ */
+class IPPortfolioScheduler {
+
+  static constexpr bool debug = false;
+  static constexpr size_t NUM_ALGORITHMS = static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED);
+
+ public:
+  explicit IPPortfolioScheduler(const Context& context) :
+    _mutex(),
+    _rng(context.partition.seed),
+    _is_enabled(NUM_ALGORITHMS, false),
+    _num_scheduled_runs(NUM_ALGORITHMS, 0),
+    _num_warmup_runs(std::max(UL(1), std::min(context.initial_partitioning.runs,
+      context.initial_partitioning.min_adaptive_ip_runs))),
+    _remaining_runs(0),
+    _next_tag(0) {
+    for ( size_t i = 0; i < NUM_ALGORITHMS; ++i ) {
+      if ( i < context.initial_partitioning.enabled_ip_algos.size() &&
+           context.initial_partitioning.enabled_ip_algos[i] ) {
+        _is_enabled[i] = true;
+        _remaining_runs += context.initial_partitioning.runs;
+      }
+    }
+  }
+
+  IPPortfolioScheduler(const IPPortfolioScheduler&) = delete;
+  IPPortfolioScheduler & operator= (const IPPortfolioScheduler &) = delete;
+
+  size_t remainingRuns() const {
+    return _remaining_runs;
+  }
+
+  // ! Selects the algorithm of the next run based on the stats of all runs committed
+  // ! so far (see InitialPartitioningDataContainer::algorithm_stats(...)). Returns false,
+  // ! if all runs are scheduled or all algorithms are pruned. Thread-safe.
+  bool next(const vec<IPAlgorithmStats>& stats,
+            const HyperedgeWeight best_quality,
+            InitialPartitioningAlgorithm& algorithm,
+            int& seed,
+            int& tag) {
+    ASSERT(stats.size() == NUM_ALGORITHMS);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if ( _remaining_runs == 0 ) {
+      return false;
+    }
+
+    size_t selected = NUM_ALGORITHMS;
+    // Warm-up: Each algorithm performs a minimum number of runs
+    for ( size_t i = 0; i < NUM_ALGORITHMS; ++i ) {
+      if ( _is_enabled[i] && _num_scheduled_runs[i] < _num_warmup_runs &&
+           ( selected == NUM_ALGORITHMS || _num_scheduled_runs[i] < _num_scheduled_runs[selected] ) ) {
+        selected = i;
+      }
+    }
+
+    if ( selected == NUM_ALGORITHMS ) {
+      selected = selectWithUpperConfidenceBound(stats, best_quality);
+      if ( selected == NUM_ALGORITHMS ) {
+        // All algorithms are pruned
+        _remaining_runs = 0;
+        return false;
+      }
+    }
+
+    DBG << "Schedule run of" << static_cast<InitialPartitioningAlgorithm>(selected)
+        << "( runs =" << _num_scheduled_runs[selected] << ")";
+    ++_num_scheduled_runs[selected];
+    --_remaining_runs;
+    algorithm = static_cast<InitialPartitioningAlgorithm>(selected);
+    seed = _rng();
+    tag = _next_tag++;
+    return true;
+  }
+
+ private:
+  bool isPruned(const IPAlgorithmStats& stats,
+                const HyperedgeWeight best_quality) const {
+    return best_quality != std::numeric_limits<HyperedgeWeight>::max() &&
+      stats.num_runs >= _num_warmup_runs &&
+      stats.average_quality - 2.0 * stats.stddev > best_quality;
+  }
+
+  size_t selectWithUpperConfidenceBound(const vec<IPAlgorithmStats>& stats,
+                                        const HyperedgeWeight best_quality) const {
+    double best_average = std::numeric_limits<double>::max();
+    size_t total_runs = 0;
+    for ( size_t i = 0; i < NUM_ALGORITHMS; ++i ) {
+      if ( _is_enabled[i] ) {
+        total_runs += _num_scheduled_runs[i];
+        if ( stats[i].num_runs > 0 ) {
+          best_average = std::min(best_average, stats[i].average_quality);
+        }
+      }
+    }
+
+    size_t selected = NUM_ALGORITHMS;
+    double best_score = std::numeric_limits<double>::lowest();
+    for ( size_t i = 0; i < NUM_ALGORITHMS; ++i ) {
+      if ( _is_enabled[i] && !isPruned(stats[i], best_quality) ) {
+        // Runs that are not committed yet are treated optimistically
+        const double reward = stats[i].num_runs == 0 ? 1.0 :
+          ( best_average + 1.0 ) / ( stats[i].average_quality + 1.0 );
+        const double exploration = std::sqrt(2.0 * std::log(static_cast<double>(total_runs)) /
+          static_cast<double>(_num_scheduled_runs[i]));
+        if ( reward + exploration > best_score ) {
+          best_score = reward + exploration;
+          selected = i;
+        }
+      }
+    }
+    return selected;
+  }
+
+  std::mutex _mutex;
+  std::mt19937 _rng;
+  vec<bool> _is_enabled;
+  vec<size_t> _num_scheduled_runs;
+  const size_t _num_warmup_runs;
+  size_t _remaining_runs;
+  int _next_tag;
+};
+
+}  // namespace mt_kahypar
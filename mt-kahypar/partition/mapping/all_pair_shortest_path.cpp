@@ -26,14 +26,46 @@
 
 #include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+
 namespace mt_kahypar {
 
 namespace {
+// ! Number of nodes per block of the blocked Floyd-Warshall algorithm.
+// ! Three blocks of 64 x 64 distances fit into the L2 cache.
+static constexpr HypernodeID BLOCK_SIZE = 64;
+
 MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t index(
   const HypernodeID u, const HypernodeID v, const HypernodeID n) {
   ASSERT(u < n && v < n);
   return u + v * n;
 }
+
+struct Block {
+  HypernodeID begin;
+  HypernodeID end;
+};
+
+// ! Relaxes all distances d(u,v) with u in rows and v in cols over the
+// ! intermediate nodes k in ks. Distances d(., v) are stored contiguously,
+// ! which allows the compiler to vectorize the inner min-plus loop.
+void relaxBlock(HyperedgeWeight* distances,
+                const HypernodeID n,
+                const Block& ks,
+                const Block& rows,
+                const Block& cols) {
+  for ( HypernodeID k = ks.begin; k < ks.end; ++k ) {
+    const HyperedgeWeight* dist_to_k = distances + index(0, k, n);
+    for ( HypernodeID v = cols.begin; v < cols.end; ++v ) {
+      HyperedgeWeight* dist_to_v = distances + index(0, v, n);
+      const HyperedgeWeight dist_k_v = dist_to_v[k];
+      for ( HypernodeID u = rows.begin; u < rows.end; ++u ) {
+        dist_to_v[u] = std::min(dist_to_v[u], dist_to_k[u] + dist_k_v);
+      }
+    }
+  }
+}
 } // namespace
 
 void AllPairShortestPath::compute(const ds::StaticGraph& graph,
@@ -51,14 +83,36 @@ void AllPairShortestPath::compute(const ds::StaticGraph& graph,
     distances[index(u, v, n)] = graph.edgeWeight(e);
   }
 
-  // Floyd Algorithm to compute all shortest paths (O(n^3))
-  for ( HypernodeID k = 0;  k < n; ++k) {
-    for ( HypernodeID u = 0; u < n; ++u ) {
-      for ( HypernodeID v = 0; v < n; ++v ) {
-        distances[index(u, v, n)] = std::min(distances[index(u, v, n)],
-          distances[index(u, k, n)] + distances[index(k, v, n)]);
+  // Blocked Floyd Algorithm to compute all shortest paths (O(n^3)). For each diagonal
+  // block K, we first relax K itself, then all blocks in the same row or column as K,
+  // and finally all remaining blocks. The blocks of the last two phases only depend on
+  // blocks of the previous phases and are relaxed in parallel.
+  const HypernodeID num_blocks = ( n + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+  auto block = [&](const HypernodeID b) {
+    return Block { b * BLOCK_SIZE, std::min(( b + 1 ) * BLOCK_SIZE, n) };
+  };
+  HyperedgeWeight* dist = distances.data();
+  for ( HypernodeID kb = 0; kb < num_blocks; ++kb ) {
+    const Block ks = block(kb);
+    relaxBlock(dist, n, ks, ks, ks);
+
+    tbb::parallel_for(ID(0), num_blocks, [&](const HypernodeID b) {
+      if ( b != kb ) {
+        tbb::parallel_invoke([&] {
+          relaxBlock(dist, n, ks, ks, block(b));
+        }, [&] {
+          relaxBlock(dist, n, ks, block(b), ks);
+        });
       }
-    }
+    });
+
+    tbb::parallel_for(ID(0), num_blocks * num_blocks, [&](const HypernodeID i) {
+      const HypernodeID row_block = i % num_blocks;
+      const HypernodeID col_block = i / num_blocks;
+      if ( row_block != kb && col_block != kb ) {
+        relaxBlock(dist, n, ks, block(row_block), block(col_block));
+      }
+    });
   }
 }
 
@@ -29,6 +29,10 @@
 #include <numeric>
 #include <queue>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/mapping/kerninghan_lin.h"
@@ -44,6 +48,9 @@ namespace {
 
 static constexpr bool debug = false;
 
+// Minimum number of processes rated by a task in the parallel greedy mapping
+static constexpr size_t PROCESSES_PER_TASK = 64;
+
 struct PQElement {
   HyperedgeWeight rating;
   HypernodeID u;
@@ -86,7 +93,8 @@ template<typename CommunicationHypergraph>
 void compute_greedy_mapping(CommunicationHypergraph& communication_hg,
                             const TargetGraph& target_graph,
                             const Context& context,
-                            const HypernodeID seed_node) {
+                            const HypernodeID seed_node,
+                            const bool parallel) {
   // For each node u, the ratings store weight of all incident hyperedges
   // that connect u to partial assignment
   vec<HyperedgeWeight> rating(communication_hg.initialNumNodes(), 0);
@@ -158,6 +166,7 @@ void compute_greedy_mapping(CommunicationHypergraph& communication_hg,
 
   HyperedgeWeight actual_objective = 0;
   vec<PartitionID> tie_breaking;
+  vec<PartitionID> processes;
   vec<HyperedgeWeight> tmp_ratings(communication_hg.initialNumNodes(), 0);
   while ( !pq.empty() ) {
     const PQElement best = pq.top();
@@ -172,16 +181,32 @@ void compute_greedy_mapping(CommunicationHypergraph& communication_hg,
     ASSERT(communication_hg.partID(u) == kInvalidPartition);
     // Assign node with the strongest connection to the partial assignment
     // to the process that minimizes the steiner tree metric.
-    for ( const HyperedgeID& he : communication_hg.incidentEdges(u) ) {
-      ds::Bitset& connectivity_set = communication_hg.deepCopyOfConnectivitySet(he);
-      const HyperedgeWeight edge_weight = communication_hg.edgeWeight(he);
-      const HyperedgeWeight distance_before = communication_hg.connectivity(he) > 0 ?
-        target_graph.distance(connectivity_set) : 0;
-      for ( const PartitionID process : unassigned_processors_view ) {
-        const HyperedgeWeight distance_after =
-          target_graph.distanceWithBlock(connectivity_set, process);
-        tmp_ratings[process] += (distance_after - distance_before) * edge_weight;
+    auto rate_processes = [&](const PartitionID* begin, const PartitionID* end) {
+      for ( const HyperedgeID& he : communication_hg.incidentEdges(u) ) {
+        // Note that the deep copy of the connectivity set is thread-local
+        ds::Bitset& connectivity_set = communication_hg.deepCopyOfConnectivitySet(he);
+        const HyperedgeWeight edge_weight = communication_hg.edgeWeight(he);
+        const HyperedgeWeight distance_before = communication_hg.connectivity(he) > 0 ?
+          target_graph.distance(connectivity_set) : 0;
+        for ( const PartitionID* process = begin; process != end; ++process ) {
+          const HyperedgeWeight distance_after =
+            target_graph.distanceWithBlock(connectivity_set, *process);
+          tmp_ratings[*process] += (distance_after - distance_before) * edge_weight;
+        }
       }
+    };
+    processes.clear();
+    for ( const PartitionID process : unassigned_processors_view ) {
+      processes.push_back(process);
+    }
+    if ( parallel && processes.size() > PROCESSES_PER_TASK ) {
+      // Each task rates a disjoint range of the unassigned processes
+      tbb::parallel_for(tbb::blocked_range<size_t>(UL(0), processes.size(), PROCESSES_PER_TASK),
+        [&](const tbb::blocked_range<size_t>& range) {
+        rate_processes(processes.data() + range.begin(), processes.data() + range.end());
+      });
+    } else {
+      rate_processes(processes.data(), processes.data() + processes.size());
     }
 
     // Determine processor that would result in the least increase of the
@@ -228,20 +253,21 @@ void GreedyMapping<CommunicationHypergraph>::mapToTargetGraph(CommunicationHyper
   ASSERT(communication_hg.initialNumNodes() == target_graph.graph().initialNumNodes());
 
   utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+  const bool parallel = context.mapping.strategy == OneToOneMappingStrategy::parallel_greedy_mapping;
   SpinLock best_lock;
   HyperedgeWeight best_objective = metrics::quality(communication_hg, Objective::steiner_tree);
   HypernodeID best_hn_id = kInvalidHypernode;
   vec<PartitionID> best_mapping(communication_hg.initialNumNodes(), 0);
   std::iota(best_mapping.begin(), best_mapping.end(), 0);
   timer.start_timer("initial_mapping", "Initial Mapping");
-  communication_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+  auto compute_mapping = [&](const HypernodeID hn) {
     // Compute greedy mapping with the current node as seed node
     CommunicationHypergraph tmp_communication_phg(
       target_graph.numBlocks(), communication_hg.hypergraph());
     tmp_communication_phg.setTargetGraph(&target_graph);
-    compute_greedy_mapping(tmp_communication_phg, target_graph, context, hn);
+    compute_greedy_mapping(tmp_communication_phg, target_graph, context, hn, parallel);
 
-    if ( context.mapping.use_local_search ) {
+    if ( context.mapping.use_local_search && !parallel ) {
       KerninghanLin<CommunicationHypergraph>::improve(tmp_communication_phg, target_graph);
     }
 
@@ -257,7 +283,21 @@ void GreedyMapping<CommunicationHypergraph>::mapToTargetGraph(CommunicationHyper
       }
     }
     best_lock.unlock();
-  });
+  };
+
+  if ( parallel ) {
+    // Instead of using each node as seed node, we only compute one greedy mapping
+    // per thread. Each greedy mapping rates the unassigned processes in parallel.
+    const HypernodeID num_nodes = communication_hg.initialNumNodes();
+    const HypernodeID num_seeds = std::min(num_nodes,
+      static_cast<HypernodeID>(std::max(tbb::this_task_arena::max_concurrency(), 1)));
+    tbb::parallel_for(ID(0), num_seeds, [&](const HypernodeID i) {
+      // Seed nodes are evenly spread over the node IDs
+      compute_mapping(static_cast<HypernodeID>((UL(i) * num_nodes) / num_seeds));
+    });
+  } else {
+    communication_hg.doParallelForAllNodes(compute_mapping);
+  }
   timer.stop_timer("initial_mapping");
 
   // Apply best mapping
@@ -266,6 +306,13 @@ void GreedyMapping<CommunicationHypergraph>::mapToTargetGraph(CommunicationHyper
     communication_hg.setOnlyNodePart(hn, best_mapping[hn]);
   }
   communication_hg.initializePartition();
+
+  if ( context.mapping.use_local_search && parallel ) {
+    // Local search is only applied to the best greedy mapping
+    timer.start_timer("kerninghan_lin", "Kerninghan-Lin");
+    KerninghanLin<CommunicationHypergraph>::improve(communication_hg, target_graph, true);
+    timer.stop_timer("kerninghan_lin");
+  }
 }
 
 INSTANTIATE_CLASS_WITH_PARTITIONED_HG(GreedyMapping)
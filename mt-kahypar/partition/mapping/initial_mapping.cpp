@@ -27,6 +27,8 @@
 #include "mt-kahypar/partition/mapping/initial_mapping.h"
 
 #include <tbb/parallel_invoke.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -42,6 +44,9 @@ namespace {
 
 using HyperedgeVector = vec<vec<HypernodeID>>;
 
+// We prefill at most a quarter of the steiner tree cache (an entry has 16 bytes)
+constexpr size_t PREFILL_BYTES_PER_SET = 64;
+
 template<typename PartitionedHypergraph>
 std::pair<ds::StaticHypergraph, StaticPartitionedHypergraph> convert_to_static_hypergraph(const PartitionedHypergraph& phg) {
   using Hypergraph = ds::StaticHypergraph;
@@ -163,6 +168,53 @@ Hypergraph repairEmptyBlocks(const Hypergraph& contracted_hg,
     edge_vector, hyperedge_weight.data(), hypernode_weight.data(), deterministic);
 }
 
+// Request frequencies of connectivity sets are very skewed. Therefore, we warm up
+// the steiner tree cache with the most frequent connectivity sets of the mapped
+// partition that are not precomputed, such that the first refinement passes
+// do not compete for computing the same MSTs.
+template<typename PartitionedHypergraph>
+void prefill_steiner_tree_cache(const PartitionedHypergraph& phg,
+                                const TargetGraph& target_graph,
+                                const size_t max_num_sets) {
+  const PartitionID max_precomputed_connectivity = target_graph.maxPrecomputedConnectivity();
+  if ( PartitionedHypergraph::is_graph || max_num_sets == 0 ||
+       max_precomputed_connectivity >= phg.k() ) {
+    // Steiner trees of all edges of a graph are precomputed
+    return;
+  }
+
+  tbb::enumerable_thread_specific<vec<std::pair<uint64_t, HyperedgeID>>> local_sets;
+  phg.doParallelForAllEdges([&](const HyperedgeID& he) {
+    if ( phg.connectivity(he) > max_precomputed_connectivity ) {
+      local_sets.local().emplace_back(
+        target_graph.fingerprint(phg.shallowCopyOfConnectivitySet(he)), he);
+    }
+  });
+  vec<std::pair<uint64_t, HyperedgeID>> sets;
+  for ( const auto& local : local_sets ) {
+    sets.insert(sets.end(), local.begin(), local.end());
+  }
+  if ( sets.empty() ) {
+    return;
+  }
+  tbb::parallel_sort(sets.begin(), sets.end());
+
+  // Count occurrences of each connectivity set and keep a representative hyperedge
+  vec<std::pair<size_t, HyperedgeID>> frequencies;
+  for ( size_t i = 0; i < sets.size(); ) {
+    size_t j = i;
+    while ( j < sets.size() && sets[j].first == sets[i].first ) ++j;
+    frequencies.emplace_back(j - i, sets[i].second);
+    i = j;
+  }
+  const size_t num_sets = std::min(max_num_sets, frequencies.size());
+  std::partial_sort(frequencies.begin(), frequencies.begin() + num_sets, frequencies.end(),
+    [&](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+  tbb::parallel_for(UL(0), num_sets, [&](const size_t i) {
+    target_graph.prefillCache(phg.shallowCopyOfConnectivitySet(frequencies[i].second));
+  });
+}
+
 template<typename PartitionedHypergraph>
 void map_to_target_graph(PartitionedHypergraph& communication_hg,
                          const TargetGraph& target_graph,
@@ -205,7 +257,8 @@ void map_to_target_graph(PartitionedHypergraph& communication_hg,
   ASSERT(metrics::quality(communication_hg, Objective::steiner_tree) == objective_before);
 
   // Solve one-to-one mapping problem
-  if ( context.mapping.strategy == OneToOneMappingStrategy::greedy_mapping ) {
+  if ( context.mapping.strategy == OneToOneMappingStrategy::greedy_mapping ||
+       context.mapping.strategy == OneToOneMappingStrategy::parallel_greedy_mapping ) {
     GreedyMapping<PartitionedHypergraph>::mapToTargetGraph(contracted_phg, target_graph, context);
   }
 
@@ -234,6 +287,11 @@ void map_to_target_graph(PartitionedHypergraph& communication_hg,
       << "Use mapping from initial partitiong!"<< END;
   }
 
+  timer.start_timer("prefill_steiner_tree_cache", "Prefill Steiner Tree Cache");
+  prefill_steiner_tree_cache(communication_hg, target_graph,
+    context.mapping.steiner_tree_cache_size * 1024 * 1024 / PREFILL_BYTES_PER_SET);
+  timer.stop_timer("prefill_steiner_tree_cache");
+
   if ( was_unused_memory_allocations_enabled ) {
     parallel::MemoryPoolT::instance().activate_unused_memory_allocations();
   }
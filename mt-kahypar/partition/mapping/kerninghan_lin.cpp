@@ -26,6 +26,10 @@
 
 #include "mt-kahypar/partition/mapping/kerninghan_lin.h"
 
+#include <queue>
+
+#include <tbb/enumerable_thread_specific.h>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -123,13 +127,53 @@ bool operator>(const PQElement& lhs, const PQElement& rhs) {
   return lhs.gain > rhs.gain || (lhs.gain == rhs.gain && lhs.swap > rhs.swap);
 }
 
-using PQ = std::priority_queue<PQElement>;
+using PQ = std::priority_queue<PQElement, vec<PQElement>>;
+
+template<typename CommunicationHypergraph>
+PQ initialize_pq(CommunicationHypergraph& communication_hg,
+                 const TargetGraph& target_graph,
+                 vec<bool>& marked_hes,
+                 const bool parallel) {
+  if ( parallel ) {
+    // Gain computations only read the communication hypergraph and can be done concurrently.
+    // Note that the order of the PQ does not depend on the insertion order.
+    tbb::enumerable_thread_specific<vec<bool>> local_marked_hes(communication_hg.initialNumEdges(), false);
+    tbb::enumerable_thread_specific<vec<PQElement>> local_swaps;
+    communication_hg.doParallelForAllNodes([&](const HypernodeID& u) {
+      vec<bool>& marked = local_marked_hes.local();
+      vec<PQElement>& swaps = local_swaps.local();
+      for ( const HypernodeID& v : communication_hg.nodes() ) {
+        if ( u < v ) {
+          const HyperedgeWeight gain = swap_gain(communication_hg, target_graph, u, v, marked);
+          swaps.push_back(PQElement { gain, std::make_pair(u, v) });
+        }
+      }
+    });
+    vec<PQElement> swaps;
+    for ( const vec<PQElement>& local : local_swaps ) {
+      swaps.insert(swaps.end(), local.begin(), local.end());
+    }
+    return PQ(std::less<PQElement>(), std::move(swaps));
+  } else {
+    PQ pq;
+    for ( const HypernodeID& u : communication_hg.nodes() ) {
+      for ( const HypernodeID& v : communication_hg.nodes() ) {
+        if ( u < v ) {
+          const HyperedgeWeight gain = swap_gain(communication_hg, target_graph, u, v, marked_hes);
+          pq.push(PQElement { gain, std::make_pair(u, v) });
+        }
+      }
+    }
+    return pq;
+  }
+}
 
 }
 
 template<typename CommunicationHypergraph>
 void KerninghanLin<CommunicationHypergraph>::improve(CommunicationHypergraph& communication_hg,
-                                                     const TargetGraph& target_graph) {
+                                                     const TargetGraph& target_graph,
+                                                     const bool parallel) {
   ASSERT(communication_hg.initialNumNodes() == target_graph.graph().initialNumNodes());
 
   HyperedgeWeight current_objective = metrics::quality(communication_hg, Objective::steiner_tree, false);
@@ -143,15 +187,7 @@ void KerninghanLin<CommunicationHypergraph>::improve(CommunicationHypergraph& co
     HyperedgeWeight objective_before = current_objective;
 
     // Initialize priority queue
-    PQ pq;
-    for ( const HypernodeID& u : communication_hg.nodes() ) {
-      for ( const HypernodeID& v : communication_hg.nodes() ) {
-        if ( u < v ) {
-          const HyperedgeWeight gain = swap_gain(communication_hg, target_graph, u, v, marked_hes);
-          pq.push(PQElement { gain, std::make_pair(u, v) });
-        }
-      }
-    }
+    PQ pq = initialize_pq(communication_hg, target_graph, marked_hes, parallel);
 
     // Perform swap operations
     int best_idx = 0;
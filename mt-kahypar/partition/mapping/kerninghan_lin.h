@@ -50,9 +50,11 @@ class KerninghanLin {
   // ! in largest reduction of the objective function. After each node
   // ! node is swapped at most once, the algorithm rolls back to the
   // ! best seen solution. This is repeated several times until no
-  // ! further improvements are possible.
+  // ! further improvements are possible. If parallel is true, the
+  // ! gains of all swap operations are initially computed in parallel.
   static void improve(CommunicationHypergraph& communication_hg,
-                      const TargetGraph& target_graph);
+                      const TargetGraph& target_graph,
+                      const bool parallel = false);
 
  private:
   KerninghanLin() { }
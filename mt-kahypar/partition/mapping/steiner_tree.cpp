@@ -26,6 +26,8 @@
 
 #include <cstdint>
 
+#include <tbb/parallel_for.h>
+
 #include "mt-kahypar/datastructures/static_bitset.h"
 #include "mt-kahypar/partition/mapping/steiner_tree.h"
 #include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
@@ -52,6 +54,16 @@ MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE size_t index(
   ASSERT(u < n && v < n);
   return u + v * n;
 }
+
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void atomicMin(HyperedgeWeight& distance,
+                                                  const HyperedgeWeight new_distance) {
+  HyperedgeWeight current = __atomic_load_n(&distance, __ATOMIC_RELAXED);
+  while ( new_distance < current && !__atomic_compare_exchange_n(&distance,
+            &current, new_distance, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) ) { }
+}
+
+// ! Number of subsets of the same size that are processed in parallel
+static constexpr size_t SUBSET_BATCH_SIZE = 1024;
 } // namespace
 
 /**
@@ -114,42 +126,56 @@ void SteinerTree::compute(const ds::StaticGraph& graph,
    *         S[ D u { v } ] = min( S[ D u { v } ], S[ {u, v} ] + min_dist )
    */
   for ( size_t m = 2; m < max_set_size; ++m ) { // k - 2 steps -> k := max_set_size
+    // Steiner trees of sets of size at most m are already optimal and only trees of sets
+    // of size m + 1 are improved in this step. Thus, all subsets of size m can be processed
+    // in parallel. The subsets are enumerated sequentially and processed in batches.
     SetEnumerator subsets_of_size_m(n, m);
-    // We compute for each subset D c V of size m the optimal steiner tree here
-    for ( const ds::StaticBitset& d_tmp : subsets_of_size_m ) { // O(binom(n,k)) = O(n! / (k!*(n - k)!)) steps
-      ds::Bitset d_set = d_tmp.copy();
-      ds::StaticBitset d(d_set.numBlocks(), d_set.data());
-      ASSERT(static_cast<size_t>(d.popcount()) == m);
-      for ( const HypernodeID& u : graph.nodes() ) { // O(n) steps
-        HyperedgeWeight min_dist = std::numeric_limits<HyperedgeWeight>::max();
-        SubsetEnumerator proper_subsets_of_d(n, d);
-        for ( const ds::StaticBitset& e_tmp : proper_subsets_of_d ) { // O(2^k) steps
-          // Here, we iterate over all subsets E c D and compute the optimal steiner tree
-          // for D with the assumption that u is the junction node of the steiner tree.
-          ds::Bitset e_set = e_tmp.copy();
-          ds::StaticBitset e(e_set.numBlocks(), e_set.data());
-          ds::Bitset f_set = d ^ e; // F = D \ E -> compliment
-          ds::StaticBitset f(f_set.numBlocks(), f_set.data());
-          e_set.set(u); // Add u to E -> E u { u }
-          f_set.set(u); // Add u to F -> F u { u }
-          min_dist = std::min(min_dist, distances[index(e, n)] + distances[index(f, n)]);
-        }
-        for ( const HypernodeID& v : graph.nodes() ) { // O(n) steps
-          // Compute optimal steiner tree for D u { v } with the assumption that
-          // u is the junction node of the optimal steiner tree. Since the outer
-          // loop iterates over all u \in V, this will compute the optimal steiner
-          // tree for D u { v } at the end.
-          const bool was_set = d_set.isSet(v);
-          d_set.set(v); // Add v to set D -> D u { v }
-          const size_t idx_d = index(d, n);
-          distances[idx_d] = std::min(distances[idx_d],
-            distances[index(u, v, n)] + min_dist);
-          if ( !was_set ) {
-            d_set.unset(v);
+    vec<ds::Bitset> batch;
+    auto process_batch = [&] {
+      tbb::parallel_for(UL(0), batch.size(), [&](const size_t i) {
+        ds::Bitset& d_set = batch[i];
+        ds::StaticBitset d(d_set.numBlocks(), d_set.data());
+        ASSERT(static_cast<size_t>(d.popcount()) == m);
+        for ( const HypernodeID& u : graph.nodes() ) { // O(n) steps
+          HyperedgeWeight min_dist = std::numeric_limits<HyperedgeWeight>::max();
+          SubsetEnumerator proper_subsets_of_d(n, d);
+          for ( const ds::StaticBitset& e_tmp : proper_subsets_of_d ) { // O(2^k) steps
+            // Here, we iterate over all subsets E c D and compute the optimal steiner tree
+            // for D with the assumption that u is the junction node of the steiner tree.
+            ds::Bitset e_set = e_tmp.copy();
+            ds::StaticBitset e(e_set.numBlocks(), e_set.data());
+            ds::Bitset f_set = d ^ e; // F = D \ E -> compliment
+            ds::StaticBitset f(f_set.numBlocks(), f_set.data());
+            e_set.set(u); // Add u to E -> E u { u }
+            f_set.set(u); // Add u to F -> F u { u }
+            min_dist = std::min(min_dist, distances[index(e, n)] + distances[index(f, n)]);
+          }
+          for ( const HypernodeID& v : graph.nodes() ) { // O(n) steps
+            // Compute optimal steiner tree for D u { v } with the assumption that
+            // u is the junction node of the optimal steiner tree. Since the outer
+            // loop iterates over all u \in V, this will compute the optimal steiner
+            // tree for D u { v } at the end. Other subsets of size m processed in parallel
+            // can update the same set D u { v }.
+            const bool was_set = d_set.isSet(v);
+            d_set.set(v); // Add v to set D -> D u { v }
+            atomicMin(distances[index(d, n)], distances[index(u, v, n)] + min_dist);
+            if ( !was_set ) {
+              d_set.unset(v);
+            }
           }
         }
+      });
+      batch.clear();
+    };
+
+    // We compute for each subset D c V of size m the optimal steiner tree here
+    for ( const ds::StaticBitset& d_tmp : subsets_of_size_m ) { // O(binom(n,k)) = O(n! / (k!*(n - k)!)) steps
+      batch.emplace_back(d_tmp.copy());
+      if ( batch.size() == SUBSET_BATCH_SIZE ) {
+        process_batch();
       }
     }
+    process_batch();
   }
 
 }
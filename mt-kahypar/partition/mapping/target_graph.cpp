@@ -26,8 +26,23 @@
 
 #include "mt-kahypar/partition/mapping/target_graph.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <limits>
+#include <mutex>
+#include <random>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #include "mt-kahypar/datastructures/static_graph.h"
 #include "mt-kahypar/partition/mapping/steiner_tree.h"
@@ -36,65 +51,166 @@
 namespace mt_kahypar {
 
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
-void TargetGraph::precomputeDistances(const size_t max_connectivity) {
+namespace {
+  static constexpr char TABLES_MAGIC[8] = { 'M', 'T', 'K', 'S', 'T', 'R', 'E', 'E' };
+  static constexpr uint32_t TABLES_VERSION = 1;
+
+  // The header is followed by the weights of the precomputed steiner trees
+  struct TablesHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t weight_width;
+    uint64_t fingerprint;
+    uint64_t num_blocks;
+    uint64_t max_connectivity;
+    uint64_t num_entries;
+  };
+}
+
+TargetGraph::MappedTables::~MappedTables() {
+  #ifndef _WIN32
+  if ( data ) {
+    munmap(data, length);
+  }
+  #endif
+}
+
+void TargetGraph::precomputeDistances(const size_t max_connectivity,
+                                      const size_t cache_size_in_bytes) {
   ALWAYS_ASSERT(max_connectivity >= 2);
   if (!inputGraphIsConnected()) {
     throw InvalidInputException("Target graph must be connected, but it is not.");
   }
 
+  if ( detectHierarchy() ) {
+    // Steiner trees of all connectivity sets can be computed in closed form
+    // => no precomputation and cache required
+    _max_precomputed_connectitivty = _k;
+    _is_initialized.store(true, std::memory_order_release);
+    return;
+  }
+
   const size_t num_entries = std::pow(_k, max_connectivity);
   if ( num_entries > MEMORY_LIMIT ) {
     throw SystemException(
       "Too much memory requested for precomputing steiner trees "
       "of connectivity sets in the target graph.");
   }
-  _distances.assign(num_entries, kInvalidDistance);
-  SteinerTree::compute(_graph, max_connectivity, _distances);
+  if ( !loadPrecomputedTables(max_connectivity, num_entries) ) {
+    _distances.assign(num_entries, kInvalidDistance);
+    SteinerTree::compute(_graph, max_connectivity, _distances);
+    _distance_data = _distances.data();
+    _num_distances = _distances.size();
+    if ( _write_tables && !_tables_file_prefix.empty() ) {
+      writePrecomputedTables(max_connectivity);
+    }
+  }
+
+  // Use several shards per thread to reduce contention on the spin locks
+  const size_t num_shards = 4 * tbb::this_task_arena::max_concurrency();
+  _cache.initialize(cache_size_in_bytes, num_shards);
 
   _max_precomputed_connectitivty = max_connectivity;
-  _is_initialized = true;
+  _is_initialized.store(true, std::memory_order_release);
+}
+
+void TargetGraph::initialize(const size_t max_connectivity,
+                             const size_t cache_size_in_bytes) {
+  if ( !isInitialized() ) {
+    // Serializes the precomputation of target graphs shared by several threads
+    static std::mutex initialization_mutex;
+    std::lock_guard<std::mutex> lock(initialization_mutex);
+    if ( !isInitialized() ) {
+      precomputeDistances(max_connectivity, cache_size_in_bytes);
+    }
+  }
 }
 
 HyperedgeWeight TargetGraph::distance(const ds::StaticBitset& connectivity_set) const {
   const PartitionID connectivity = connectivity_set.popcount();
   if ( likely(connectivity <= _max_precomputed_connectitivty) ) {
-    const size_t idx = index(connectivity_set);
-    ASSERT(idx < _distances.size());
     if constexpr ( TRACK_STATS ) ++_stats.precomputed;
-    ASSERT(_distances[idx] < kInvalidDistance);
-    return _distances[idx];
+    if ( _is_hierarchical ) {
+      return steinerTreeInHierarchy(connectivity_set);
+    }
+    const size_t idx = index(connectivity_set);
+    ASSERT(idx < _num_distances);
+    ASSERT(_distance_data[idx] < kInvalidDistance);
+    return _distance_data[idx];
   } else {
-    const uint64_t hash_key = computeHash(connectivity_set);
     // We have not precomputed the optimal steiner tree for the connectivity set.
-    #ifdef KAHYPAR_USE_GROWT
-    HashTableHandle& handle = _handles.local();
-    auto res = handle.find(hash_key);
-    if ( likely( res != handle.end() ) ) {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_hits;
-      return (*res).second;
+    const uint64_t key = fingerprint(connectivity_set);
+    HyperedgeWeight mst_weight = 0;
+    if ( likely( _cache.find(key, mst_weight) ) ) {
+      return mst_weight;
     } else {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_misses;
       // Entry is not cached => Compute 2-approximation of optimal steiner tree
-      const HyperedgeWeight mst_weight =
-        computeWeightOfMSTOnMetricCompletion(connectivity_set);
-      handle.insert(hash_key, mst_weight);
+      mst_weight = computeWeightOfMSTOnMetricCompletion(connectivity_set);
+      _cache.insert(key, mst_weight);
       return mst_weight;
     }
-    #else
-    auto res = _cache.find(hash_key);
-    if ( likely ( res != _cache.end() ) ) {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_hits;
-      return res->second;
+  }
+}
+
+void TargetGraph::prefillCache(const ds::StaticBitset& connectivity_set) const {
+  ASSERT(connectivity_set.popcount() > _max_precomputed_connectitivty);
+  _cache.insert(fingerprint(connectivity_set),
+    computeWeightOfMSTOnMetricCompletion(connectivity_set));
+}
+
+BlockPairDistances TargetGraph::distancesForBlockPair(ds::Bitset& connectivity_set,
+                                                      const PartitionID block_0,
+                                                      const PartitionID block_1) const {
+  ASSERT(block_0 != block_1 && block_0 < _k && block_1 < _k);
+  const bool was_block_0_set = connectivity_set.isSet(block_0);
+  const bool was_block_1_set = connectivity_set.isSet(block_1);
+  connectivity_set.unset(block_0);
+  connectivity_set.unset(block_1);
+
+  BlockPairDistances distances;
+  ds::StaticBitset view(connectivity_set.numBlocks(), connectivity_set.data());
+  if ( likely(view.popcount() + 2 <= _max_precomputed_connectitivty) ) {
+    distances = computeDistancesForBlockPair(connectivity_set, block_0, block_1);
+  } else {
+    // The remaining connectivity set is usually shared by many hyperedges of the
+    // flow problem of the block pair. Caching the three distances per thread
+    // saves two of three lookups in the (contended) global cache.
+    BlockPairCache& cache = _local_block_pair_cache.local();
+    if ( cache.block_0 != block_0 || cache.block_1 != block_1 ||
+         cache.distances.size() >= MAX_BLOCK_PAIR_CACHE_SIZE ) {
+      cache.block_0 = block_0;
+      cache.block_1 = block_1;
+      cache.distances.clear();
+    }
+    const uint64_t hash_key = fingerprint(view);
+    const BlockPairDistances* cached = cache.distances.get_if_contained(hash_key);
+    if ( cached ) {
+      distances = *cached;
     } else {
-      if constexpr ( TRACK_STATS ) ++_stats.cache_misses;
-      // Entry is not cached => Compute 2-approximation of optimal steiner tree
-      const HyperedgeWeight mst_weight =
-        computeWeightOfMSTOnMetricCompletion(connectivity_set);
-      _cache.insert(std::make_pair(hash_key, mst_weight));
-      return mst_weight;
+      distances = computeDistancesForBlockPair(connectivity_set, block_0, block_1);
+      cache.distances[hash_key] = distances;
     }
-    #endif
   }
+
+  if ( was_block_0_set ) connectivity_set.set(block_0);
+  if ( was_block_1_set ) connectivity_set.set(block_1);
+  return distances;
+}
+
+BlockPairDistances TargetGraph::computeDistancesForBlockPair(ds::Bitset& connectivity_set,
+                                                             const PartitionID block_0,
+                                                             const PartitionID block_1) const {
+  ASSERT(!connectivity_set.isSet(block_0) && !connectivity_set.isSet(block_1));
+  BlockPairDistances distances;
+  ds::StaticBitset view(connectivity_set.numBlocks(), connectivity_set.data());
+  connectivity_set.set(block_0);
+  distances.with_block_0 = distance(view);
+  connectivity_set.set(block_1);
+  distances.with_both_blocks = distance(view);
+  connectivity_set.unset(block_0);
+  distances.with_block_1 = distance(view);
+  connectivity_set.unset(block_1);
+  return distances;
 }
 
 /**
@@ -118,7 +234,7 @@ HyperedgeWeight TargetGraph::computeWeightOfMSTOnMetricCompletion(const ds::Stat
   auto push = [&](const PartitionID u) {
     for ( const PartitionID& v : cur_blocks ) {
       ASSERT(u != v);
-      const HyperedgeWeight dist = _distances[index(u,v)];
+      const HyperedgeWeight dist = _distance_data[index(u,v)];
       // If there is a lighter edge connecting v to the MST,
       // we push v with the new weight into the PQ.
       if ( dist < lightest_edge[v] ) {
@@ -158,6 +274,157 @@ HyperedgeWeight TargetGraph::computeWeightOfMSTOnMetricCompletion(const ds::Stat
   return res;
 }
 
+bool TargetGraph::detectHierarchy() {
+  _is_hierarchical = false;
+  _group_sizes.clear();
+  _level_weights.clear();
+  if ( _k < 2 ) {
+    return false;
+  }
+
+  // A hierarchical target graph is a complete graph
+  for ( const HypernodeID& u : _graph.nodes() ) {
+    if ( _graph.nodeDegree(u) != UL(_k - 1) ) {
+      return false;
+    }
+  }
+
+  // The distinct edge weights incident to block 0 define the levels of the
+  // hierarchy. The group size of a level is the number of blocks reachable
+  // from block 0 with an edge of at most the weight of the level.
+  vec<HyperedgeWeight> weights;
+  for ( const HyperedgeID& e : _graph.incidentEdges(0) ) {
+    weights.push_back(_graph.edgeWeight(e));
+  }
+  std::sort(weights.begin(), weights.end());
+  for ( size_t i = 0; i < weights.size(); ) {
+    size_t j = i;
+    while ( j < weights.size() && weights[j] == weights[i] ) ++j;
+    const size_t group_size = j + 1;
+    const size_t lower_group_size = _group_sizes.empty() ? 1 : _group_sizes.back();
+    if ( group_size % lower_group_size != 0 ) {
+      _group_sizes.clear();
+      _level_weights.clear();
+      return false;
+    }
+    _group_sizes.push_back(group_size);
+    _level_weights.push_back(weights[i]);
+    i = j;
+  }
+  ASSERT(_group_sizes.back() == UL(_k));
+
+  // Each edge weight must match the weight of the lowest common level of its endpoints
+  CAtomic<bool> is_hierarchical(true);
+  tbb::parallel_for(ID(0), static_cast<HypernodeID>(_k), [&](const HypernodeID u) {
+    for ( const HyperedgeID& e : _graph.incidentEdges(u) ) {
+      const HypernodeID v = _graph.edgeTarget(e);
+      if ( _graph.edgeWeight(e) != distanceInHierarchy(u, v) ) {
+        is_hierarchical.store(false, std::memory_order_relaxed);
+        break;
+      }
+    }
+  });
+
+  if ( !is_hierarchical ) {
+    _group_sizes.clear();
+    _level_weights.clear();
+    return false;
+  }
+  _is_hierarchical = true;
+  return true;
+}
+
+uint64_t TargetGraph::graphFingerprint() const {
+  uint64_t hash = hashing::integer::hash64(_k);
+  for ( const HypernodeID& u : _graph.nodes() ) {
+    for ( const HyperedgeID& e : _graph.incidentEdges(u) ) {
+      hash = hashing::integer::combine64(hash, hashing::integer::hash64(u));
+      hash = hashing::integer::combine64(hash, hashing::integer::hash64(_graph.edgeTarget(e)));
+      hash = hashing::integer::combine64(hash, hashing::integer::hash64(_graph.edgeWeight(e)));
+    }
+  }
+  return hash;
+}
+
+bool TargetGraph::loadPrecomputedTables(const size_t max_connectivity, const size_t num_entries) {
+  if ( _tables_file_prefix.empty() ) {
+    return false;
+  }
+
+  const std::string filename = precomputedTablesFile(_tables_file_prefix, max_connectivity);
+  std::ifstream in(filename, std::ios::binary | std::ios::ate);
+  if ( !in ) {
+    return false;
+  }
+  const size_t length = static_cast<size_t>(in.tellg());
+  TablesHeader header;
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(&header), sizeof(TablesHeader));
+  if ( !in || std::memcmp(header.magic, TABLES_MAGIC, sizeof(TABLES_MAGIC)) != 0 ||
+       header.version != TABLES_VERSION || header.weight_width != sizeof(HyperedgeWeight) ||
+       header.num_blocks != UL(_k) || header.max_connectivity != max_connectivity ||
+       header.num_entries != num_entries ||
+       length != sizeof(TablesHeader) + num_entries * sizeof(HyperedgeWeight) ||
+       header.fingerprint != graphFingerprint() ) {
+    return false;
+  }
+
+  #ifdef _WIN32
+  _distances.resize(num_entries);
+  in.read(reinterpret_cast<char*>(_distances.data()), num_entries * sizeof(HyperedgeWeight));
+  if ( !in ) {
+    _distances.clear();
+    return false;
+  }
+  _distance_data = _distances.data();
+  #else
+  in.close();
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if ( fd < 0 ) {
+    return false;
+  }
+  void* data = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( data == MAP_FAILED ) {
+    return false;
+  }
+  _mapped_tables = std::make_unique<MappedTables>();
+  _mapped_tables->data = static_cast<char*>(data);
+  _mapped_tables->length = length;
+  _distance_data = reinterpret_cast<const HyperedgeWeight*>(_mapped_tables->data + sizeof(TablesHeader));
+  #endif
+  _num_distances = num_entries;
+  return true;
+}
+
+void TargetGraph::writePrecomputedTables(const size_t max_connectivity) const {
+  TablesHeader header;
+  std::memset(&header, 0, sizeof(TablesHeader));
+  std::memcpy(header.magic, TABLES_MAGIC, sizeof(TABLES_MAGIC));
+  header.version = TABLES_VERSION;
+  header.weight_width = sizeof(HyperedgeWeight);
+  header.fingerprint = graphFingerprint();
+  header.num_blocks = _k;
+  header.max_connectivity = max_connectivity;
+  header.num_entries = _distances.size();
+
+  // Write to a temporary file first such that concurrent processes never map a partially written file
+  const std::string filename = precomputedTablesFile(_tables_file_prefix, max_connectivity);
+  const std::string tmp_filename = filename + ".tmp" + std::to_string(std::random_device()());
+  bool success = false;
+  {
+    std::ofstream out(tmp_filename, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(TablesHeader));
+    out.write(reinterpret_cast<const char*>(_distances.data()), _distances.size() * sizeof(HyperedgeWeight));
+    success = static_cast<bool>(out);
+  }
+  success = success && std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+  if ( !success ) {
+    std::remove(tmp_filename.c_str());
+    WARNING("Could not write precomputed steiner trees to" << filename);
+  }
+}
+
 bool TargetGraph::inputGraphIsConnected() const {
   // stack-based DFS
   std::vector<uint8_t> visited;
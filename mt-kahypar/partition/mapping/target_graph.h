@@ -27,59 +27,44 @@
 #pragma once
 
 #include <queue>
+#include <memory>
 #include <numeric>
 #include <iostream>
+#include <string>
 
 #include <tbb/enumerable_thread_specific.h>
 
-#ifdef KAHYPAR_USE_GROWT
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wunused-parameter"
-#endif
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wpedantic"
-#endif
-#include "growt/allocator/alignedallocator.hpp"
-#include "growt/data-structures/hash_table_mods.hpp"
-#include "growt/data-structures/table_config.hpp"
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif
-#ifdef __clang__
-#pragma clang diagnostic pop
-#endif
-#else
-#include <tbb/concurrent_unordered_map.h>
-#endif
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/sharded_lru_cache.h"
+#include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/datastructures/static_graph.h"
 #include "mt-kahypar/datastructures/static_bitset.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/hash.h"
 
 namespace mt_kahypar {
 
+// ! Weight of the optimal steiner tree of a connectivity set that does not
+// ! contain block_0 and block_1, if we add block_0, block_1 or both blocks.
+struct BlockPairDistances {
+  HyperedgeWeight with_block_0;
+  HyperedgeWeight with_block_1;
+  HyperedgeWeight with_both_blocks;
+};
+
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
 class TargetGraph {
 
   static constexpr HyperedgeWeight kInvalidDistance = std::numeric_limits<HyperedgeWeight>::max() / 3;
-  static constexpr size_t INITIAL_HASH_TABLE_CAPACITY = 100000;
   static constexpr size_t MEMORY_LIMIT = 100000000;
+  static constexpr size_t DEFAULT_CACHE_SIZE_IN_BYTES = 16 * 1024 * 1024;
+  static constexpr size_t MAX_BLOCK_PAIR_CACHE_SIZE = 65536;
 
   using PQElement = std::pair<HyperedgeWeight, PartitionID>;
   using PQ = std::priority_queue<PQElement, vec<PQElement>, std::greater<PQElement>>;
 
-  #ifdef KAHYPAR_USE_GROWT
-  using hasher_type    = utils_tm::hash_tm::murmur2_hash;
-  using allocator_type = growt::AlignedAllocator<>;
-  using ConcurrentHashTable = typename growt::table_config<
-    uint64_t, uint64_t, hasher_type, allocator_type, hmod::growable, hmod::sync>::table_type;
-  using HashTableHandle = typename ConcurrentHashTable::handle_type;
-  #else
-  using ConcurrentHashTable = tbb::concurrent_unordered_map<uint64_t, uint64_t>;
-  #endif
+  using DistanceCache = ds::ShardedLRUCache<HyperedgeWeight>;
 
   struct MSTData {
     MSTData(const size_t n) :
@@ -92,15 +77,40 @@ class TargetGraph {
     PQ pq;
   };
 
+  // ! Caches the distances of non-precomputed connectivity sets for the block
+  // ! pair that is currently refined by a thread (see distancesForBlockPair(...))
+  struct BlockPairCache {
+    BlockPairCache() :
+      block_0(kInvalidPartition),
+      block_1(kInvalidPartition),
+      distances() { }
+
+    PartitionID block_0;
+    PartitionID block_1;
+    ds::DynamicFlatMap<uint64_t, BlockPairDistances> distances;
+  };
+
+  // ! Read-only memory mapping of a file with precomputed steiner trees
+  struct MappedTables {
+    MappedTables() :
+      data(nullptr),
+      length(0) { }
+
+    MappedTables(const MappedTables&) = delete;
+    MappedTables & operator= (const MappedTables &) = delete;
+
+    ~MappedTables();
+
+    char* data;
+    size_t length;
+  };
+
+  // ! Cache hits and misses are always tracked by the cache itself
   struct Stats {
     Stats() :
-      precomputed(0),
-      cache_misses(0),
-      cache_hits(0) { }
+      precomputed(0) { }
 
     CAtomic<size_t> precomputed;
-    CAtomic<size_t> cache_misses;
-    CAtomic<size_t> cache_hits;
   };
 
  public:
@@ -111,12 +121,18 @@ class TargetGraph {
     _k(graph.initialNumNodes()),
     _graph(std::move(graph)),
     _max_precomputed_connectitivty(0),
+    _is_hierarchical(false),
+    _group_sizes(),
+    _level_weights(),
     _distances(),
+    _distance_data(nullptr),
+    _num_distances(0),
+    _tables_file_prefix(),
+    _write_tables(false),
+    _mapped_tables(),
     _local_mst_data(graph.initialNumNodes()),
-    _cache(INITIAL_HASH_TABLE_CAPACITY),
-     #ifdef KAHYPAR_USE_GROWT
-    _handles([&]() { return getHandle(); }),
-     #endif
+    _local_block_pair_cache(),
+    _cache(),
     _stats() { }
 
   TargetGraph(const TargetGraph&) = delete;
@@ -130,7 +146,13 @@ class TargetGraph {
   }
 
   bool isInitialized() const {
-    return _is_initialized;
+    return _is_initialized.load(std::memory_order_acquire);
+  }
+
+  // ! Returns true, if the target graph models a strict hierarchy (see detectHierarchy()).
+  // ! In this case, we compute optimal steiner trees in closed form.
+  bool isHierarchical() const {
+    return _is_hierarchical;
   }
 
   const ds::StaticGraph& graph() const {
@@ -138,8 +160,66 @@ class TargetGraph {
   }
 
   // ! This function computes the weight of all steiner trees for all
-  // ! connectivity sets with connectivity at most m (:= max_connectivity),
-  void precomputeDistances(const size_t max_conectivity);
+  // ! connectivity sets with connectivity at most m (:= max_connectivity).
+  // ! The weights of larger connectivity sets are cached in a cache that
+  // ! consumes at most cache_size_in_bytes.
+  void precomputeDistances(const size_t max_conectivity,
+                           const size_t cache_size_in_bytes = DEFAULT_CACHE_SIZE_IN_BYTES);
+
+  // ! Thread-safe variant of precomputeDistances(...) that only precomputes
+  // ! the steiner trees if the target graph is not initialized yet. Afterwards,
+  // ! the target graph is immutable and can be shared by concurrent partitioning calls.
+  void initialize(const size_t max_conectivity,
+                  const size_t cache_size_in_bytes = DEFAULT_CACHE_SIZE_IN_BYTES);
+
+  PartitionID maxPrecomputedConnectivity() const {
+    return _max_precomputed_connectitivty;
+  }
+
+  // ! The steiner trees precomputed by precomputeDistances(...) are stored in a binary
+  // ! file next to the target graph (see precomputedTablesFile(...)). If the file exists
+  // ! and matches the target graph, it is memory-mapped instead of repeating the
+  // ! precomputation. Otherwise, the tables are written to it if write_tables is true.
+  void setPrecomputedTablesFile(const std::string& target_graph_file, const bool write_tables) {
+    _tables_file_prefix = target_graph_file;
+    _write_tables = write_tables;
+  }
+
+  // ! Returns true, if the precomputed steiner trees are memory-mapped from a file
+  bool usesMappedTables() const {
+    return _mapped_tables != nullptr;
+  }
+
+  static std::string precomputedTablesFile(const std::string& target_graph_file,
+                                           const size_t max_connectivity) {
+    return target_graph_file + ".steiner_trees_" + std::to_string(max_connectivity) + ".bin";
+  }
+
+  // ! Inserts the weight of the steiner tree of a non-precomputed connectivity
+  // ! set into the cache (used to warm up the cache before refinement)
+  void prefillCache(const ds::StaticBitset& connectivity_set) const;
+
+  // ! Fingerprint of a connectivity set used as key of the cache
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE uint64_t fingerprint(const ds::StaticBitset& connectivity_set) const {
+    if ( _k <= 64 ) {
+      // The fingerprint is the bit mask of the connectivity set
+      uint64_t index = 0;
+      for ( const PartitionID block : connectivity_set ) {
+        ASSERT(block != kInvalidPartition && block < _k && block < 64);
+        index |= (static_cast<uint64_t>(1) << block);
+      }
+      return index;
+    } else {
+      // We combine the hashes of all words of the bitset. Collisions are
+      // then possible, but extremely unlikely.
+      uint64_t hash = 0;
+      for ( size_t i = 0; i < connectivity_set.numBlocks(); ++i ) {
+        hash = hashing::integer::combine64(hash,
+          hashing::integer::hash64(connectivity_set.data()[i]));
+      }
+      return hash;
+    }
+  }
 
   // ! Returns the weight of the optimal steiner tree between all blocks
   // ! in the connectivity set if precomputed. Otherwise, we compute
@@ -194,31 +274,48 @@ class TargetGraph {
     return dist;
   }
 
+  // ! Computes the optimal steiner tree between the blocks in the connectivity
+  // ! set without block_0 and block_1 if we add block_0, block_1 or both blocks.
+  // ! This covers all distances required to evaluate moves between the two blocks.
+  // ! The results for non-precomputed connectivity sets are cached per thread
+  // ! as long as the thread works on the same block pair.
+  BlockPairDistances distancesForBlockPair(ds::Bitset& connectivity_set,
+                                           const PartitionID block_0,
+                                           const PartitionID block_1) const;
+
   // ! Returns the shortest path between two blocks in the target graph
   HyperedgeWeight distance(const PartitionID i, const PartitionID j) const {
     ASSERT(_is_initialized);
-    return _distances[index(i, j)];
+    return _is_hierarchical ? distanceInHierarchy(i, j) : _distance_data[index(i, j)];
   }
 
   // ! Print statistics
   void printStats() const {
-    const size_t total_requests = _stats.precomputed + _stats.cache_hits + _stats.cache_misses;
+    const size_t cache_hits = _cache.hits();
+    const size_t cache_misses = _cache.misses();
+    const size_t total_requests = _stats.precomputed + cache_hits + cache_misses;
     LOG << "\nTarget Graph Distance Computation Stats:";
     std::cout << "Accessed Precomputed Distance = " << std::setprecision(2)
               << (static_cast<double>(_stats.precomputed) / total_requests) * 100 << "% ("
               << _stats.precomputed << ")" << std::endl;
     std::cout << "                 Computed MST = " << std::setprecision(2)
-              << (static_cast<double>(_stats.cache_misses) / total_requests) * 100 << "% ("
-              << _stats.cache_misses << ")" << std::endl;
+              << (static_cast<double>(cache_misses) / total_requests) * 100 << "% ("
+              << cache_misses << ")" << std::endl;
     std::cout << "              Used Cached MST = " << std::setprecision(2)
-              << (static_cast<double>(_stats.cache_hits) / total_requests) * 100 << "% ("
-              << _stats.cache_hits << ")" << std::endl;
+              << (static_cast<double>(cache_hits) / total_requests) * 100 << "% ("
+              << cache_hits << ")" << std::endl;
+    std::cout << "      Cached Connectivity Sets = " << _cache.size()
+              << " (Capacity = " << _cache.capacity() << ")" << std::endl;
   }
 
   void printStats(std::stringstream& oss) const {
-    oss << " used_precomputed_distance=" << _stats.precomputed
-        << " used_mst=" << _stats.cache_misses
-        << " used_cached_mst=" << _stats.cache_hits;
+    if constexpr ( TRACK_STATS ) {
+      oss << " used_precomputed_distance=" << _stats.precomputed;
+    }
+    oss << " used_mst=" << _cache.misses()
+        << " used_cached_mst=" << _cache.hits()
+        << " steiner_tree_cache_size=" << _cache.size()
+        << " steiner_tree_cache_capacity=" << _cache.capacity();
   }
 
  private:
@@ -242,14 +339,9 @@ class TargetGraph {
       (multiplier == UL(_k) ? last_block * _k : 0) : 0;
   }
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE uint64_t computeHash(const ds::StaticBitset& connectivity_set) const {
-    uint64_t index = 0;
-    for ( const PartitionID block : connectivity_set ) {
-      ASSERT(block != kInvalidPartition && block < _k && block < 64);
-      index |= (static_cast<uint64_t>(1) << block);
-    }
-    return index;
-  }
+  BlockPairDistances computeDistancesForBlockPair(ds::Bitset& connectivity_set,
+                                                  const PartitionID block_0,
+                                                  const PartitionID block_1) const;
 
   // ! This function computes an MST on the metric completion of the target graph
   // ! restricted to the blocks in the connectivity set. The metric completion is
@@ -259,13 +351,50 @@ class TargetGraph {
 
   bool inputGraphIsConnected() const;
 
-  #ifdef KAHYPAR_USE_GROWT
-  HashTableHandle getHandle() const {
-    return _cache.get_handle();
+  // ! Hash of the target graph stored in the header of the precomputed tables
+  uint64_t graphFingerprint() const;
+
+  // ! Memory-maps the precomputed steiner trees if the file matches the target graph
+  bool loadPrecomputedTables(const size_t max_connectivity, const size_t num_entries);
+
+  void writePrecomputedTables(const size_t max_connectivity) const;
+
+  // ! Detects whether or not the target graph is a strict hierarchy as generated by
+  // ! tools/hierarchical_target_graph_generator.cc: Blocks are recursively grouped into
+  // ! consecutive ranges of equal size and two blocks are connected by an edge whose
+  // ! weight only depends on the lowest level on which they are in the same group.
+  // ! Deeper levels must have lighter edges.
+  bool detectHierarchy();
+
+  // ! The shortest path is the direct edge between the two blocks
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeWeight distanceInHierarchy(const PartitionID i,
+                                                                         const PartitionID j) const {
+    ASSERT(i < _k && j < _k);
+    if ( i == j ) return 0;
+    size_t level = 0;
+    while ( UL(i) / _group_sizes[level] != UL(j) / _group_sizes[level] ) {
+      ++level;
+      ASSERT(level < _group_sizes.size());
+    }
+    return _level_weights[level];
   }
-  #endif
 
-  bool _is_initialized;
+  // ! In a hierarchy, the MST on the metric completion is an optimal steiner tree.
+  // ! Its weight equals the sum of the distances between consecutive blocks
+  // ! of the connectivity set in increasing order.
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE HyperedgeWeight steinerTreeInHierarchy(const ds::StaticBitset& connectivity_set) const {
+    HyperedgeWeight weight = 0;
+    PartitionID last_block = kInvalidPartition;
+    for ( const PartitionID block : connectivity_set ) {
+      if ( last_block != kInvalidPartition ) {
+        weight += distanceInHierarchy(last_block, block);
+      }
+      last_block = block;
+    }
+    return weight;
+  }
+
+  CAtomic<bool> _is_initialized;
 
   // ! Number of blocks
   PartitionID _k;
@@ -277,19 +406,35 @@ class TargetGraph {
   // ! precomputed optimal steiner trees
   PartitionID _max_precomputed_connectitivty;
 
+  // ! True, if the target graph is a strict hierarchy
+  bool _is_hierarchical;
+
+  // ! Number of blocks in a group on each level of the hierarchy (lowest level first)
+  vec<size_t> _group_sizes;
+
+  // ! Weight of the edges between blocks whose lowest common group is on the corresponding level
+  vec<HyperedgeWeight> _level_weights;
+
   // ! Stores the weight of all precomputed steiner trees
   vec<HyperedgeWeight> _distances;
 
+  // ! Points either to _distances or to the memory-mapped tables
+  const HyperedgeWeight* _distance_data;
+  size_t _num_distances;
+
+  // ! Path of the target graph file next to which the precomputed tables are stored
+  std::string _tables_file_prefix;
+  bool _write_tables;
+  std::unique_ptr<MappedTables> _mapped_tables;
+
   // ! Data structures to compute MST for non-precomputed connectivity sets
   mutable tbb::enumerable_thread_specific<MSTData> _local_mst_data;
 
-  // ! Cache stores the weight of MST computations
-  mutable ConcurrentHashTable _cache;
+  // ! Distances of non-precomputed connectivity sets for the current block pair
+  mutable tbb::enumerable_thread_specific<BlockPairCache> _local_block_pair_cache;
 
-  #ifdef KAHYPAR_USE_GROWT
-  // ! Handle to access concurrent hash table
-  mutable tbb::enumerable_thread_specific<HashTableHandle> _handles;
-  #endif
+  // ! Cache stores the weight of MST computations
+  mutable DistanceCache _cache;
 
   // ! Stats
   mutable Stats _stats;
@@ -316,7 +461,29 @@ class TargetGraph {
     return false;
   }
 
-  void precomputeDistances(const size_t) { }
+  bool isHierarchical() const {
+    return false;
+  }
+
+  void precomputeDistances(const size_t, const size_t = 0) { }
+
+  void initialize(const size_t, const size_t = 0) { }
+
+  PartitionID maxPrecomputedConnectivity() const {
+    return 0;
+  }
+
+  void setPrecomputedTablesFile(const std::string&, const bool) { }
+
+  bool usesMappedTables() const {
+    return false;
+  }
+
+  void prefillCache(const ds::StaticBitset&) const { }
+
+  uint64_t fingerprint(const ds::StaticBitset&) const {
+    return 0;
+  }
 
   HyperedgeWeight distance(const ds::StaticBitset&) const {
     return 0;
@@ -343,6 +510,10 @@ class TargetGraph {
     return 0;
   }
 
+  BlockPairDistances distancesForBlockPair(ds::Bitset&, const PartitionID, const PartitionID) const {
+    return BlockPairDistances { 0, 0, 0 };
+  }
+
 
   const ds::StaticGraph& graph() const {
     return _dummy_graph;
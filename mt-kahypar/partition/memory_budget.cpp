@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/memory_budget.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/datastructures/sparse_pin_counts.h"
+
+namespace mt_kahypar::memory_budget {
+
+namespace {
+
+  static constexpr size_t BYTES_PER_MB = 1024 * 1024;
+
+  // Bytes per node, hyperedge and pin of the static hypergraph and graph data structures
+  static constexpr size_t BYTES_PER_NODE = 32;
+  static constexpr size_t BYTES_PER_EDGE = 24;
+  static constexpr size_t BYTES_PER_PIN = 2 * sizeof(HypernodeID);
+  // Arcs of the clustering graph used for community detection (target + weight)
+  static constexpr size_t BYTES_PER_ARC = sizeof(HypernodeID) + sizeof(double);
+  // Contraction tree and version history of the n-level hypergraph per node
+  static constexpr size_t BYTES_PER_N_LEVEL_CONTRACTION = 32;
+
+  bool isNLevel(const Context& context) {
+    return context.partition.partition_type == N_LEVEL_HYPERGRAPH_PARTITIONING ||
+           context.partition.partition_type == N_LEVEL_GRAPH_PARTITIONING;
+  }
+
+  size_t budgetInBytes(const Context& context) {
+    return context.partition.memory_budget * BYTES_PER_MB;
+  }
+
+  size_t hypergraphSize(const InstanceSize& instance) {
+    return instance.num_nodes * BYTES_PER_NODE + instance.num_edges * BYTES_PER_EDGE +
+      instance.num_pins * BYTES_PER_PIN;
+  }
+
+  size_t partitionSize(const InstanceSize& instance, const size_t k, const bool sparse_connectivity) {
+    const size_t m = instance.num_edges;
+    size_t partition = instance.num_nodes * sizeof(PartitionID);
+    if ( instance.is_graph ) {
+      // Synchronization of concurrent moves per edge
+      partition += m * sizeof(HyperedgeID);
+    } else if ( sparse_connectivity ) {
+      partition += ds::SparsePinCounts::num_elements(m, k, instance.max_edge_size) *
+        sizeof(ds::SparsePinCounts::Value);
+    } else {
+      partition +=
+        ds::PinCountInPart::num_elements(m, k, instance.max_edge_size) * sizeof(ds::PinCountInPart::Value) +
+        ds::ConnectivitySets::num_elements(m, k) * sizeof(ds::ConnectivitySets::UnsafeBlock);
+    }
+    return partition;
+  }
+
+}  // namespace
+
+MemoryEstimate estimate(const InstanceSize& instance,
+                        const Context& context,
+                        const bool sparse_connectivity) {
+  const size_t n = instance.num_nodes;
+  const size_t m = instance.num_edges;
+  const size_t p = instance.num_pins;
+  const size_t k = std::max(context.partition.k, 2);
+
+  MemoryEstimate estimate;
+  estimate.hypergraph = hypergraphSize(instance);
+
+  if ( context.preprocessing.use_community_detection ) {
+    // Bipartite clustering graph (or a copy of the graph). Contracting it requires a temporary
+    // copy of the arcs, which the low-memory contraction avoids by reusing the original arrays.
+    const size_t num_arcs = instance.is_graph ? p : 2 * p;
+    const size_t clustering_graph = (instance.is_graph ? n : n + m) * BYTES_PER_NODE + num_arcs * BYTES_PER_ARC;
+    estimate.preprocessing = clustering_graph +
+      ( context.preprocessing.community_detection.low_memory_contraction ? 0 : num_arcs * BYTES_PER_ARC );
+  }
+
+  // For a reasonable shrink factor, all coarse levels together are not larger than the input.
+  // The parallel recursion of deep multilevel partitioning works on additional copies.
+  estimate.coarsening = estimate.hypergraph;
+  if ( context.partition.mode == Mode::deep_multilevel &&
+       context.partition.perform_parallel_recursion_in_deep_multilevel ) {
+    const size_t copy_memory_limit = context.partition.deep_ml_copy_memory_limit * BYTES_PER_MB;
+    estimate.coarsening += copy_memory_limit > 0 ?
+      std::min(estimate.hypergraph, copy_memory_limit) : estimate.hypergraph;
+  }
+
+  estimate.partition = partitionSize(instance, k, sparse_connectivity);
+
+  if ( context.partition.gain_policy == GainPolicy::km1_sparse ) {
+    // Only the benefit terms of adjacent blocks are stored
+    const size_t max_adjacent_blocks = std::min(k, n > 0 ? p / n + 1 : 1);
+    estimate.gain_cache = n * max_adjacent_blocks * (sizeof(PartitionID) + sizeof(HyperedgeWeight));
+  } else {
+    estimate.gain_cache = n * (k + 1) * sizeof(HyperedgeWeight);
+  }
+
+  if ( context.refinement.flows.algorithm == FlowAlgorithm::flow_cutter ) {
+    // Each search region contains roughly two blocks and is represented as a flow network
+    const size_t num_searches = std::max(context.refinement.flows.num_parallel_searches,
+      std::min(context.shared_memory.num_threads, k * (k - 1) / 2));
+    const size_t region = std::min(2 * estimate.hypergraph, 4 * estimate.hypergraph / k);
+    estimate.flows = num_searches * region;
+  }
+
+  if ( isNLevel(context) ) {
+    estimate.n_level_history = n * BYTES_PER_N_LEVEL_CONTRACTION + p * sizeof(HyperedgeID);
+  }
+  return estimate;
+}
+
+size_t maxNumberOfCopies(const InstanceSize& instance, const PartitionID k, const size_t limit) {
+  const size_t copy_size = hypergraphSize(instance) + partitionSize(instance, std::max(k, 2), false);
+  return std::max(limit * BYTES_PER_MB / std::max(copy_size, UL(1)), UL(1));
+}
+
+bool exceedsBudget(const InstanceSize& instance,
+                   const Context& context,
+                   const bool sparse_connectivity) {
+  return context.partition.memory_budget > 0 &&
+    estimate(instance, context, sparse_connectivity).peak() > budgetInBytes(context);
+}
+
+void applyBudget(const InstanceSize& instance, Context& context) {
+  if ( context.partition.memory_budget == 0 ) {
+    return;
+  }
+
+  const bool sparse_connectivity = context.partition.partition_type == LARGE_K_PARTITIONING;
+  auto over_budget = [&] {
+    return exceedsBudget(instance, context, sparse_connectivity);
+  };
+
+  // Degrade the configuration in order of increasing impact on the solution quality
+  if ( over_budget() && context.preprocessing.use_community_detection &&
+       !context.preprocessing.community_detection.low_memory_contraction ) {
+    context.preprocessing.community_detection.low_memory_contraction = true;
+    if ( context.partition.verbose_output ) {
+      INFO("Memory budget: Using low-memory contraction for community detection");
+    }
+  }
+  #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+  if ( over_budget() && sparse_connectivity && context.partition.gain_policy == GainPolicy::km1 ) {
+    context.partition.use_sparse_gain_cache = true;
+    context.setupGainPolicy();
+    if ( context.partition.gain_policy == GainPolicy::km1_sparse && context.partition.verbose_output ) {
+      INFO("Memory budget: Using the sparse gain cache");
+    }
+  }
+  #endif
+  if ( over_budget() && context.partition.mode == Mode::deep_multilevel &&
+       context.partition.perform_parallel_recursion_in_deep_multilevel ) {
+    context.partition.perform_parallel_recursion_in_deep_multilevel = false;
+    if ( context.partition.verbose_output ) {
+      INFO("Memory budget: Disabling parallel recursion in deep multilevel partitioning");
+    }
+  }
+  if ( over_budget() && context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+    context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+    context.refinement.flows.num_parallel_searches = 0;
+    if ( context.partition.verbose_output ) {
+      INFO("Memory budget: Disabling flow-based refinement");
+    }
+  }
+
+  if ( over_budget() && context.partition.verbose_output ) {
+    const size_t peak = estimate(instance, context, sparse_connectivity).peak();
+    WARNING("Estimated peak memory of" << (peak / BYTES_PER_MB) << "MB exceeds the memory budget of"
+      << context.partition.memory_budget << "MB. Consider a preset with a smaller memory footprint"
+      << "(e.g., large_k or default instead of an n-level preset).");
+  }
+}
+
+}  // namespace mt_kahypar::memory_budget
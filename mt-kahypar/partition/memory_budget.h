@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+// ! Size of the input that determines the memory consumption of the partitioner
+struct InstanceSize {
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_edges = 0;
+  HypernodeID num_pins = 0;
+  HypernodeID max_edge_size = 0;
+  bool is_graph = false;
+};
+
+// ! Rough estimate of the memory (in bytes) required by the different phases
+// ! of the partitioner. The peak is reached during refinement on the finest level,
+// ! where the input, its partition, the gain cache and the flow networks coexist.
+struct MemoryEstimate {
+  size_t hypergraph = 0;
+  size_t preprocessing = 0;
+  size_t coarsening = 0;
+  size_t partition = 0;
+  size_t gain_cache = 0;
+  size_t flows = 0;
+  size_t n_level_history = 0;
+
+  size_t peak() const {
+    return hypergraph + n_level_history + std::max(preprocessing,
+      coarsening + partition + gain_cache + flows);
+  }
+};
+
+namespace memory_budget {
+
+template<typename Hypergraph>
+InstanceSize instanceSize(const Hypergraph& hypergraph) {
+  return InstanceSize { hypergraph.initialNumNodes(), hypergraph.initialNumEdges(),
+    hypergraph.initialNumPins(), hypergraph.maxEdgeSize(), Hypergraph::is_graph };
+}
+
+// ! Estimates the peak memory of the partitioner for the given context.
+// ! If sparse_connectivity is true, the pin counts and connectivity sets are stored sparsely.
+MemoryEstimate estimate(const InstanceSize& instance,
+                        const Context& context,
+                        const bool sparse_connectivity);
+
+// ! Returns the number of copies of the hypergraph with a k-way partition that fit
+// ! into the given memory limit in MB (at least one)
+size_t maxNumberOfCopies(const InstanceSize& instance, const PartitionID k, const size_t limit);
+
+// ! Returns true, if a memory budget is set and the estimated peak memory exceeds it
+bool exceedsBudget(const InstanceSize& instance,
+                   const Context& context,
+                   const bool sparse_connectivity);
+
+// ! Degrades the configuration of the partitioner step by step to cheaper
+// ! algorithms until the estimated peak memory fits into the memory budget
+void applyBudget(const InstanceSize& instance, Context& context);
+
+}  // namespace memory_budget
+}  // namespace mt_kahypar
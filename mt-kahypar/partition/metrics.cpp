@@ -30,8 +30,17 @@
 #include <cmath>
 #include <algorithm>
 
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_invoke.h>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/partition/refinement/gains/cut/cut_attributed_gains.h"
+#include "mt-kahypar/partition/refinement/gains/cut_for_graphs/cut_attributed_gains_for_graphs.h"
+#include "mt-kahypar/partition/refinement/gains/km1/km1_attributed_gains.h"
+#include "mt-kahypar/partition/refinement/gains/soed/soed_attributed_gains.h"
+#include "mt-kahypar/partition/refinement/gains/steiner_tree/steiner_tree_attributed_gains.h"
+#include "mt-kahypar/partition/refinement/gains/steiner_tree_for_graphs/steiner_tree_attributed_gains_for_graphs.h"
 #include "mt-kahypar/utils/exception.h"
 
 namespace mt_kahypar::metrics {
@@ -99,6 +108,34 @@ HyperedgeWeight contribution(const PartitionedHypergraph& phg, const HyperedgeID
   return func(phg, he);
 }
 
+struct ObjectiveValues {
+  HyperedgeWeight cut = 0;
+  HyperedgeWeight km1 = 0;
+  HyperedgeWeight soed = 0;
+  HyperedgeWeight steiner_tree = 0;
+};
+
+template<typename PartitionedHypergraph>
+ObjectiveValues attributedGains(const SynchronizedEdgeUpdate& sync_update) {
+  ObjectiveValues delta;
+  if constexpr ( PartitionedHypergraph::is_graph ) {
+    delta.cut = GraphCutAttributedGains::gain(sync_update);
+    delta.km1 = delta.cut;
+    delta.soed = 2 * delta.cut;
+    if ( sync_update.target_graph ) {
+      delta.steiner_tree = GraphSteinerTreeAttributedGains::gain(sync_update);
+    }
+  } else {
+    delta.cut = CutAttributedGains::gain(sync_update);
+    delta.km1 = Km1AttributedGains::gain(sync_update);
+    delta.soed = SoedAttributedGains::gain(sync_update);
+    if ( sync_update.target_graph ) {
+      delta.steiner_tree = SteinerTreeAttributedGains::gain(sync_update);
+    }
+  }
+  return delta;
+}
+
 }
 
 template<typename PartitionedHypergraph>
@@ -144,6 +181,110 @@ HyperedgeWeight contribution(const PartitionedHypergraph& hg,
   return 0;
 }
 
+template<typename PartitionedHypergraph>
+PartitionMetrics allMetrics(const PartitionedHypergraph& phg, const Context& context) {
+  PartitionMetrics metrics;
+  const PartitionID k = phg.k();
+  tbb::parallel_invoke([&] {
+    tbb::enumerable_thread_specific<ObjectiveValues> local_values;
+    const TargetGraph* target_graph = phg.hasTargetGraph() ? phg.targetGraph() : nullptr;
+    phg.doParallelForAllEdges([&](const HyperedgeID& he) {
+      ObjectiveValues& values = local_values.local();
+      const PartitionID connectivity = phg.connectivity(he);
+      const HyperedgeWeight edge_weight = phg.edgeWeight(he);
+      if ( connectivity > 1 ) {
+        values.cut += edge_weight;
+        values.km1 += (connectivity - 1) * edge_weight;
+        values.soed += connectivity * edge_weight;
+      }
+      if ( target_graph ) {
+        values.steiner_tree += target_graph->distance(phg.shallowCopyOfConnectivitySet(he)) * edge_weight;
+      }
+    });
+    const HyperedgeWeight factor = PartitionedHypergraph::is_graph ? 2 : 1;
+    local_values.combine_each([&](const ObjectiveValues& values) {
+      metrics.cut += values.cut;
+      metrics.km1 += values.km1;
+      metrics.soed += values.soed;
+      metrics.steiner_tree += values.steiner_tree;
+    });
+    metrics.cut /= factor;
+    metrics.km1 /= factor;
+    metrics.soed /= factor;
+    metrics.steiner_tree /= factor;
+  }, [&] {
+    tbb::enumerable_thread_specific<vec<HypernodeID>> local_block_sizes(k, 0);
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      ++local_block_sizes.local()[phg.partID(hn)];
+    });
+    metrics.block_sizes.assign(k, 0);
+    local_block_sizes.combine_each([&](const vec<HypernodeID>& block_sizes) {
+      for ( PartitionID block = 0; block < k; ++block ) {
+        metrics.block_sizes[block] += block_sizes[block];
+      }
+    });
+  }, [&] {
+    metrics.block_weights.resize(k);
+    for ( PartitionID block = 0; block < k; ++block ) {
+      metrics.block_weights[block] = phg.partWeight(block);
+    }
+    metrics.imbalance = imbalance(phg, context);
+  });
+  return metrics;
+}
+
+template<typename PartitionedHypergraph>
+void applyMoves(PartitionedHypergraph& phg,
+                const Context& context,
+                const vec<Move>& moves,
+                PartitionMetrics& metrics) {
+  ASSERT(metrics.block_sizes.empty() || metrics.block_sizes.size() == static_cast<size_t>(phg.k()));
+  tbb::enumerable_thread_specific<ObjectiveValues> local_deltas;
+  tbb::enumerable_thread_specific<vec<int64_t>> local_block_size_deltas(phg.k(), 0);
+  tbb::parallel_for(UL(0), moves.size(), [&](const size_t i) {
+    const Move& move = moves[i];
+    const PartitionID from = phg.partID(move.node);
+    ASSERT(move.to != kInvalidPartition && move.to < phg.k());
+    if ( from == move.to ) {
+      return;
+    }
+    ObjectiveValues& delta = local_deltas.local();
+    const bool success = phg.changeNodePart(move.node, from, move.to,
+      [&](const SynchronizedEdgeUpdate& sync_update) {
+        const ObjectiveValues attributed_delta = attributedGains<PartitionedHypergraph>(sync_update);
+        delta.cut += attributed_delta.cut;
+        delta.km1 += attributed_delta.km1;
+        delta.soed += attributed_delta.soed;
+        delta.steiner_tree += attributed_delta.steiner_tree;
+      });
+    if ( success ) {
+      vec<int64_t>& block_size_deltas = local_block_size_deltas.local();
+      --block_size_deltas[from];
+      ++block_size_deltas[move.to];
+    }
+  });
+
+  local_deltas.combine_each([&](const ObjectiveValues& delta) {
+    metrics.cut += delta.cut;
+    metrics.km1 += delta.km1;
+    metrics.soed += delta.soed;
+    metrics.steiner_tree += delta.steiner_tree;
+  });
+  if ( !metrics.block_sizes.empty() ) {
+    local_block_size_deltas.combine_each([&](const vec<int64_t>& block_size_deltas) {
+      for ( PartitionID block = 0; block < phg.k(); ++block ) {
+        metrics.block_sizes[block] += block_size_deltas[block];
+      }
+    });
+  }
+  metrics.block_weights.resize(phg.k());
+  for ( PartitionID block = 0; block < phg.k(); ++block ) {
+    metrics.block_weights[block] = phg.partWeight(block);
+  }
+  metrics.imbalance = imbalance(phg, context);
+  HEAVY_REFINEMENT_ASSERT(metrics.km1 == quality(phg, Objective::km1));
+}
+
 template<typename PartitionedHypergraph>
 bool isBalanced(const PartitionedHypergraph& phg, const Context& context) {
   size_t num_empty_parts = 0;
@@ -178,7 +319,10 @@ double imbalance(const PartitionedHypergraph& hypergraph, const Context& context
 
 template<typename PartitionedHypergraph>
 double approximationFactorForProcessMapping(const PartitionedHypergraph& hypergraph, const Context& context) {
-  if ( !PartitionedHypergraph::is_graph ) {
+  if ( hypergraph.hasTargetGraph() && hypergraph.targetGraph()->isHierarchical() ) {
+    // Steiner trees are computed optimally for hierarchical target graphs
+    return 1.0;
+  } else if ( !PartitionedHypergraph::is_graph ) {
     tbb::enumerable_thread_specific<HyperedgeWeight> approx_factor(0);
     hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
       const size_t connectivity = hypergraph.connectivity(he);
@@ -194,6 +338,8 @@ namespace {
 #define OBJECTIVE_1(X) HyperedgeWeight quality(const X& hg, const Context& context, const bool parallel)
 #define OBJECTIVE_2(X) HyperedgeWeight quality(const X& hg, const Objective objective, const bool parallel)
 #define CONTRIBUTION(X) HyperedgeWeight contribution(const X& hg, const HyperedgeID he, const Objective objective)
+#define ALL_METRICS(X) PartitionMetrics allMetrics(const X& phg, const Context& context)
+#define APPLY_MOVES(X) void applyMoves(X& phg, const Context& context, const vec<Move>& moves, PartitionMetrics& metrics)
 #define IS_BALANCED(X) bool isBalanced(const X& phg, const Context& context)
 #define IMBALANCE(X) double imbalance(const X& hypergraph, const Context& context)
 #define APPROX_FACTOR(X) double approximationFactorForProcessMapping(const X& hypergraph, const Context& context)
@@ -202,6 +348,8 @@ namespace {
 INSTANTIATE_FUNC_WITH_PARTITIONED_HG(OBJECTIVE_1)
 INSTANTIATE_FUNC_WITH_PARTITIONED_HG(OBJECTIVE_2)
 INSTANTIATE_FUNC_WITH_PARTITIONED_HG(CONTRIBUTION)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(ALL_METRICS)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(APPLY_MOVES)
 INSTANTIATE_FUNC_WITH_PARTITIONED_HG(IS_BALANCED)
 INSTANTIATE_FUNC_WITH_PARTITIONED_HG(IMBALANCE)
 INSTANTIATE_FUNC_WITH_PARTITIONED_HG(APPROX_FACTOR)
@@ -36,6 +36,18 @@ struct Metrics {
   double imbalance;
 };
 
+// ! All objective values and block statistics of a partition
+struct PartitionMetrics {
+  HyperedgeWeight cut = 0;
+  HyperedgeWeight km1 = 0;
+  HyperedgeWeight soed = 0;
+  // ! Only computed if the partitioned hypergraph has a target graph
+  HyperedgeWeight steiner_tree = 0;
+  double imbalance = 0.0;
+  vec<HypernodeWeight> block_weights;
+  vec<HypernodeID> block_sizes;
+};
+
 namespace metrics {
 
 // ! Computes for the given partitioned hypergraph the corresponding objective function
@@ -54,6 +66,19 @@ HyperedgeWeight contribution(const PartitionedHypergraph& hg,
                              const HyperedgeID he,
                              const Objective objective);
 
+// ! Computes all objective functions, the imbalance and the block statistics in one parallel pass
+template<typename PartitionedHypergraph>
+PartitionMetrics allMetrics(const PartitionedHypergraph& phg, const Context& context);
+
+// ! Applies the moves in parallel and updates the metrics with the attributed gains of the moves
+// ! instead of recomputing them. Each node must occur at most once in the batch.
+// ! The block sizes are only updated if they are present in the metrics.
+template<typename PartitionedHypergraph>
+void applyMoves(PartitionedHypergraph& phg,
+                const Context& context,
+                const vec<Move>& moves,
+                PartitionMetrics& metrics);
+
 template<typename PartitionedHypergraph>
 bool isBalanced(const PartitionedHypergraph& phg, const Context& context);
 
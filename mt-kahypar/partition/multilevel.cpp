@@ -38,8 +38,10 @@
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
 #include "mt-kahypar/partition/initial_partitioning/pool_initial_partitioner.h"
+#include "mt-kahypar/partition/initial_partitioning/parallel_label_propagation_initial_partitioner.h"
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
+#include "mt-kahypar/partition/metrics.h"
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
 #include "mt-kahypar/partition/mapping/initial_mapping.h"
 #endif
@@ -73,28 +75,39 @@ namespace {
   }
 
   template<typename TypeTraits>
-  typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
-    typename TypeTraits::Hypergraph& hypergraph,
-    const Context& context,
-    const TargetGraph* target_graph,
-    const bool is_vcycle) {
+  void coarsen(typename TypeTraits::Hypergraph& hypergraph,
+               const Context& context,
+               UncoarseningData<TypeTraits>& uncoarseningData,
+               vec<Level<TypeTraits>>* initial_hierarchy) {
     using Hypergraph = typename TypeTraits::Hypergraph;
-    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
-    PartitionedHypergraph partitioned_hg;
-
-    // ################## COARSENING ##################
-    mt_kahypar::io::printCoarseningBanner(context);
-
-    const bool nlevel = context.isNLevelPartitioning();
-    UncoarseningData<TypeTraits> uncoarseningData(nlevel, hypergraph, context);
-
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("coarsening", "Coarsening");
+    if ( initial_hierarchy && !initial_hierarchy->empty() ) {
+      // Warm start: reuse the hierarchy of the previous V-cycle or a precomputed hierarchy
+      timer.start_timer("restore_hierarchy", "Restore Hierarchy");
+      const size_t num_levels = initial_hierarchy->size();
+      const size_t num_recontracted_levels =
+        uncoarseningData.restoreHierarchy(std::move(*initial_hierarchy));
+      initial_hierarchy->clear();
+      timer.stop_timer("restore_hierarchy");
+      if ( context.partition.verbose_output ) {
+        LOG << "Restored" << num_levels << "levels of a previous hierarchy ("
+            << num_recontracted_levels << "recontracted)";
+      }
+    }
     {
       std::unique_ptr<ICoarsener> coarsener = CoarsenerFactory::getInstance().createObject(
         context.coarsening.algorithm, utils::hypergraph_cast(hypergraph),
         context, uncoarsening::to_pointer(uncoarseningData));
-      coarsener->coarsen();
+      coarsener->initialize();
+      size_t level = 0;
+      bool should_continue = true;
+      while ( coarsener->shouldNotTerminate() && should_continue ) {
+        context.checkForCancellation();
+        should_continue = coarsener->coarseningPass();
+        context.reportProgress(PROGRESS_COARSENING, ++level, coarsener->currentNumberOfNodes(), 0);
+      }
+      coarsener->terminate();
 
       if (context.partition.verbose_output) {
         mt_kahypar_hypergraph_t coarsestHypergraph = coarsener->coarsestHypergraph();
@@ -104,7 +117,29 @@ namespace {
       }
     }
     timer.stop_timer("coarsening");
+  }
 
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
+    typename TypeTraits::Hypergraph& hypergraph,
+    const Context& context,
+    const TargetGraph* target_graph,
+    const bool is_vcycle,
+    vec<Level<TypeTraits>>* hierarchy = nullptr) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    PartitionedHypergraph partitioned_hg;
+
+    // ################## COARSENING ##################
+    mt_kahypar::io::printCoarseningBanner(context);
+
+    const bool nlevel = context.isNLevelPartitioning();
+    UncoarseningData<TypeTraits> uncoarseningData(nlevel, hypergraph, context);
+    // The hierarchy is kept if it is reused afterwards (e.g., in the next V-cycle)
+    uncoarseningData.release_processed_levels = hierarchy == nullptr;
+    coarsen<TypeTraits>(hypergraph, context, uncoarseningData, hierarchy);
+
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     // ################## INITIAL PARTITIONING ##################
     io::printInitialPartitioningBanner(context);
     timer.start_timer("initial_partitioning", "Initial Partitioning");
@@ -125,7 +160,11 @@ namespace {
         // techniques. This case runs as a base case (k = 2) within recursive bipartitioning
         // or the deep multilevel scheme.
         ip_context.partition.verbose_output = false;
-        Pool<TypeTraits>::bipartition(phg, ip_context);
+        if ( ip_context.partition.k >= context.initial_partitioning.parallel_lp_min_k ) {
+          ParallelLabelPropagationInitialPartitioner<TypeTraits>::partition(phg, ip_context);
+        } else {
+          Pool<TypeTraits>::bipartition(phg, ip_context);
+        }
       } else if ( context.initial_partitioning.mode == Mode::recursive_bipartitioning ) {
         RecursiveBipartitioning<TypeTraits>::partition(phg, ip_context, target_graph);
       } else if ( context.initial_partitioning.mode == Mode::deep_multilevel ) {
@@ -139,10 +178,11 @@ namespace {
       degree_zero_hn_remover.restoreDegreeZeroHypernodes(phg);
     } else {
       // When performing a V-cycle, we store the block IDs
-      // of the input hypergraph as community IDs
+      // of the input hypergraph as community IDs (a recombination additionally
+      // stores the block IDs of the second parent as multiples of k)
       const Hypergraph& hypergraph = phg.hypergraph();
       phg.doParallelForAllNodes([&](const HypernodeID hn) {
-        const PartitionID part_id = hypergraph.communityID(hn);
+        const PartitionID part_id = hypergraph.communityID(hn) % context.partition.k;
         ASSERT(part_id != kInvalidPartition && part_id < context.partition.k);
         ASSERT(phg.partID(hn) == kInvalidPartition);
         phg.setOnlyNodePart(hn, part_id);
@@ -196,7 +236,23 @@ namespace {
       uncoarsener = std::make_unique<MultilevelUncoarsener<TypeTraits>>(
         hypergraph, context, uncoarseningData, target_graph);
     }
-    partitioned_hg = uncoarsener->uncoarsen();
+    context.checkForCancellation();
+    uncoarsener->initialize();
+    context.reportProgress(PROGRESS_INITIAL_PARTITIONING, 0,
+      uncoarsener->currentNumberOfNodes(), uncoarsener->getObjective());
+    size_t level = 0;
+    while ( !uncoarsener->isTopLevel() ) {
+      context.checkForCancellation();
+      uncoarsener->projectToNextLevelAndRefine();
+      context.reportProgress(PROGRESS_REFINEMENT, ++level,
+        uncoarsener->currentNumberOfNodes(), uncoarsener->getObjective());
+    }
+    uncoarsener->rebalancing();
+    partitioned_hg = uncoarsener->movePartitionedHypergraph();
+    if ( hierarchy ) {
+      *hierarchy = std::move(uncoarseningData.hierarchy);
+      uncoarseningData.hierarchy.clear();
+    }
 
     io::printPartitioningResults(partitioned_hg, context, "Local Search Results:");
     timer.stop_timer("refinement");
@@ -219,6 +275,31 @@ typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::p
   return partitioned_hg;
 }
 
+template<typename TypeTraits>
+typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::partition(
+  Hypergraph& hypergraph, const Context& context, vec<Level<TypeTraits>>&& hierarchy) {
+  PartitionedHypergraph partitioned_hg =
+    multilevel_partitioning<TypeTraits>(hypergraph, context, nullptr, false, &hierarchy);
+
+  // ################## V-CYCLES ##################
+  if ( context.partition.num_vcycles > 0 && context.type == ContextType::main ) {
+    partitionVCycle(hypergraph, partitioned_hg, context);
+  }
+
+  return partitioned_hg;
+}
+
+template<typename TypeTraits>
+vec<Level<TypeTraits>> Multilevel<TypeTraits>::coarsen(Hypergraph& hypergraph, const Context& context) {
+  ASSERT(!context.isNLevelPartitioning());
+  mt_kahypar::io::printCoarseningBanner(context);
+  UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
+  mt_kahypar::coarsen<TypeTraits>(hypergraph, context, uncoarseningData, nullptr);
+  vec<Level<TypeTraits>> hierarchy = std::move(uncoarseningData.hierarchy);
+  uncoarseningData.hierarchy.clear();
+  return hierarchy;
+}
+
 template<typename TypeTraits>
 void Multilevel<TypeTraits>::partition(PartitionedHypergraph& partitioned_hg,
                                        const Context& context,
@@ -238,7 +319,36 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
                                              const TargetGraph* target_graph) {
   ASSERT(context.partition.num_vcycles > 0);
 
+  // The multilevel hierarchy of a V-cycle is kept for the next one
+  // and only recontracted where it no longer respects the partition
+  const bool reuse_hierarchy = context.coarsening.vcycle_reuse_hierarchy &&
+    context.coarsening.algorithm == CoarseningAlgorithm::multilevel_coarsener &&
+    !context.isNLevelPartitioning() && !hypergraph.hasFixedVertices();
+  vec<Level<TypeTraits>> hierarchy;
+
+  // Truncated V-cycles only coarsen down to a multiple of the contraction limit. They are
+  // performed first and we switch to full cycles once they stop improving the partition.
+  bool truncated_cycle = context.partition.vcycle_truncated_contraction_limit_factor > 1.0;
+  Context truncated_context(context);
+  if ( truncated_cycle ) {
+    truncated_context.coarsening.contraction_limit = static_cast<HypernodeID>(std::min(
+      static_cast<double>(hypergraph.initialNumNodes()),
+      context.partition.vcycle_truncated_contraction_limit_factor * context.coarsening.contraction_limit));
+  }
+
+  utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+  HyperedgeWeight objective = metrics::quality(partitioned_hg, context);
   for ( size_t i = 0; i < context.partition.num_vcycles; ++i ) {
+    context.checkForCancellation();
+    if ( context.isTimeLimitExceeded() ) {
+      // The partition of the previous cycle is returned
+      break;
+    }
+    if ( context.hasProgressCallback() ) {
+      context.reportProgress(PROGRESS_VCYCLE, i + 1, partitioned_hg.initialNumNodes(), objective);
+    }
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+
     // Reset memory pool
     hypergraph.reset();
     parallel::MemoryPool::instance().reset();
@@ -261,8 +371,81 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
     // Perform V-cycle
     io::printVCycleBanner(context, i + 1);
     partitioned_hg = multilevel_partitioning<TypeTraits>(
-      hypergraph, context, target_graph, true /* V-cycle flag */ );
+      hypergraph, truncated_cycle ? truncated_context : context, target_graph,
+      true /* V-cycle flag */, reuse_hierarchy ? &hierarchy : nullptr);
+
+    const HyperedgeWeight vcycle_objective = metrics::quality(partitioned_hg, context);
+    const double relative_improvement = objective > 0 ?
+      static_cast<double>(objective - vcycle_objective) / objective : 0.0;
+    const double time = std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - start).count();
+    const std::string key = "vcycle_" + std::to_string(i + 1);
+    stats.add_stat(key + "_time", time);
+    stats.add_stat(key + "_objective", static_cast<int64_t>(vcycle_objective));
+    stats.add_stat(key + "_truncated", truncated_cycle);
+    if ( context.partition.verbose_output ) {
+      LOG << (truncated_cycle ? "Truncated V-cycle" : "V-cycle") << (i + 1) << ":"
+          << context.partition.objective << "=" << vcycle_objective
+          << "( improvement =" << (100.0 * relative_improvement) << "%, time ="
+          << time << "s )";
+    }
+    objective = vcycle_objective;
+
+    if ( truncated_cycle ) {
+      if ( relative_improvement <= context.partition.vcycle_min_relative_improvement ) {
+        // The truncated cycles converged, continue with full cycles
+        truncated_cycle = false;
+      }
+    } else if ( relative_improvement < context.partition.vcycle_min_relative_improvement ) {
+      break;
+    }
+  }
+}
+
+template<typename TypeTraits>
+typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::recombine(
+  Hypergraph& hypergraph,
+  const vec<PartitionID>& parent_1,
+  const vec<PartitionID>& parent_2,
+  const Context& context,
+  const TargetGraph* target_graph) {
+  const PartitionID k = context.partition.k;
+  ASSERT(parent_1.size() == hypergraph.initialNumNodes());
+  ASSERT(parent_2.size() == hypergraph.initialNumNodes());
+  if ( static_cast<int64_t>(k) * k > std::numeric_limits<PartitionID>::max() ) {
+    throw UnsupportedOperationException("Recombination is not supported for k = " + std::to_string(k));
+  }
+
+  // Nodes are only contracted if they are in the same block in both parents
+  hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+    hypergraph.setCommunityID(hn, parent_1[hn] + k * parent_2[hn]);
+  });
+  PartitionedHypergraph offspring = multilevel_partitioning<TypeTraits>(
+    hypergraph, context, target_graph, true /* V-cycle flag */);
+
+  // Refinement does not guarantee that the offspring is at least as good as the
+  // first parent (e.g., due to rebalancing) => fall back to the first parent
+  const auto apply_partition = [&](const vec<PartitionID>& partition) {
+    offspring.resetPartition();
+    offspring.doParallelForAllNodes([&](const HypernodeID& hn) {
+      offspring.setOnlyNodePart(hn, partition[hn]);
+    });
+    offspring.initializePartition();
+  };
+  const HyperedgeWeight offspring_quality = metrics::quality(offspring, context);
+  const bool offspring_is_balanced = metrics::isBalanced(offspring, context);
+  vec<PartitionID> offspring_partition(offspring.initialNumNodes(), kInvalidPartition);
+  offspring.doParallelForAllNodes([&](const HypernodeID& hn) {
+    offspring_partition[hn] = offspring.partID(hn);
+  });
+  apply_partition(parent_1);
+  const HyperedgeWeight parent_quality = metrics::quality(offspring, context);
+  const bool parent_is_balanced = metrics::isBalanced(offspring, context);
+  if ( ( offspring_is_balanced && !parent_is_balanced ) ||
+       ( offspring_is_balanced == parent_is_balanced && offspring_quality <= parent_quality ) ) {
+    apply_partition(offspring_partition);
   }
+  return offspring;
 }
 
 INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Multilevel)
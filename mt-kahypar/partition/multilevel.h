@@ -28,6 +28,7 @@
 #pragma once
 
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
 
 namespace mt_kahypar {
 
@@ -51,12 +52,31 @@ class Multilevel {
                         const Context& context,
                         const TargetGraph* target_graph = nullptr);
 
+  // ! Partitions a hypergraph using the multilevel paradigm. Coarsening starts from the given
+  // ! (precomputed) hierarchy and only continues if it is not coarse enough.
+  static PartitionedHypergraph partition(Hypergraph& hypergraph,
+                                         const Context& context,
+                                         vec<Level<TypeTraits>>&& hierarchy);
+
+  // ! Only computes the multilevel hierarchy of the hypergraph.
+  static vec<Level<TypeTraits>> coarsen(Hypergraph& hypergraph, const Context& context);
+
   // ! Improves an existing partition using the iterated multilevel cycle technique
   // ! (also called V-cycle).
   static void partitionVCycle(Hypergraph& hypergraph,
                               PartitionedHypergraph& partitioned_hg,
                               const Context& context,
                               const TargetGraph* target_graph = nullptr);
+
+  // ! Recombines two partitions of the hypergraph (as in KaHyPar-E). Coarsening only contracts
+  // ! nodes that are assigned to the same block in both parents and the first parent is used
+  // ! as initial partition of the coarsest hypergraph. If refinement does not find a partition
+  // ! that is at least as good as the first parent, the first parent is returned.
+  static PartitionedHypergraph recombine(Hypergraph& hypergraph,
+                                         const vec<PartitionID>& parent_1,
+                                         const vec<PartitionID>& parent_2,
+                                         const Context& context,
+                                         const TargetGraph* target_graph = nullptr);
 };
 
 }  // namespace mt_kahypar
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/nested_partitions.h"
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace nested {
+
+vec<PartitionID> numBlocksOfNestedPartitions(const PartitionID k) {
+  vec<PartitionID> num_blocks;
+  for ( PartitionID nested_k = 2; nested_k < k; nested_k *= 2 ) {
+    num_blocks.push_back(nested_k);
+  }
+  if ( k >= 2 ) {
+    num_blocks.push_back(k);
+  }
+  return num_blocks;
+}
+
+bool isNestedPartition(const PartitionID k, const PartitionID nested_k) {
+  const bool is_power_of_two = nested_k > 0 && ( nested_k & ( nested_k - 1 ) ) == 0;
+  return nested_k == k || ( nested_k >= 2 && nested_k < k && is_power_of_two );
+}
+
+PartitionID nestedBlock(const PartitionID block, const PartitionID k, const PartitionID nested_k) {
+  ASSERT(isNestedPartition(k, nested_k));
+  ASSERT(block >= 0 && block < k);
+  if ( nested_k == k ) {
+    return block;
+  }
+
+  // Since nested_k is a power of two smaller than k, each range on the
+  // first log2(nested_k) levels of the bisection consists of at least two blocks
+  PartitionID range_start = 0;
+  PartitionID range_size = k;
+  PartitionID nested_block = 0;
+  for ( PartitionID current_k = 1; current_k < nested_k; current_k *= 2 ) {
+    const PartitionID k0 = range_size / 2 + (range_size % 2);
+    if ( block < range_start + k0 ) {
+      nested_block = 2 * nested_block;
+      range_size = k0;
+    } else {
+      nested_block = 2 * nested_block + 1;
+      range_start += k0;
+      range_size -= k0;
+    }
+  }
+  return nested_block;
+}
+
+}  // namespace nested
+}  // namespace mt_kahypar
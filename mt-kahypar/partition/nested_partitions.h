@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+namespace nested {
+
+// Recursive bipartitioning and deep multilevel partitioning bisect the range of block IDs
+// [0, k) recursively into [0, ceil(k / 2)) and [ceil(k / 2), k). Merging the blocks of each
+// range therefore yields nested partitions with 2, 4, ..., 2^i < k blocks, which were already
+// refined when the partitioner extended the number of blocks.
+
+// ! Returns the number of blocks of all nested partitions of a k-way partition
+// ! in increasing order, i.e., all powers of two smaller than k and k itself.
+vec<PartitionID> numBlocksOfNestedPartitions(const PartitionID k);
+
+// ! Returns true, if the k-way partition has a nested partition with nested_k blocks
+bool isNestedPartition(const PartitionID k, const PartitionID nested_k);
+
+// ! Returns the block of the nested partition with nested_k blocks that
+// ! contains the given block of the k-way partition
+PartitionID nestedBlock(const PartitionID block, const PartitionID k, const PartitionID nested_k);
+
+// ! Writes the block of each node in the nested partition with nested_k blocks to the provided array
+template<typename PartitionedHypergraph>
+void getNestedPartition(const PartitionedHypergraph& phg,
+                        const PartitionID nested_k,
+                        PartitionID* partition) {
+  const PartitionID k = phg.k();
+  ASSERT(isNestedPartition(k, nested_k));
+  vec<PartitionID> nested_block(k, kInvalidPartition);
+  for ( PartitionID block = 0; block < k; ++block ) {
+    nested_block[block] = nestedBlock(block, k, nested_k);
+  }
+  phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    partition[hn] = nested_block[phg.partID(hn)];
+  });
+}
+
+}  // namespace nested
+}  // namespace mt_kahypar
@@ -27,22 +27,46 @@
 
 #include "partitioner.h"
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_sort.h>
 #include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/partitioning_output.h"
+#include "mt-kahypar/partition/auto_tuning.h"
 #include "mt-kahypar/partition/multilevel.h"
+#include "mt-kahypar/partition/coarsening/coarsening_hierarchy.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
+#include "mt-kahypar/partition/preprocessing/sparsification/twin_node_compression.h"
+#include "mt-kahypar/partition/preprocessing/reordering/node_reordering.h"
 #include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/label_propagation_clustering.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/community_cache.h"
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/refinement/i_refiner.h"
+#include "mt-kahypar/partition/refinement/i_rebalancer.h"
+#include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
 #include "mt-kahypar/partition/mapping/initial_mapping.h"
 #endif
+#include "mt-kahypar/parallel/contention_stats.h"
+#include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/hypergraph_statistics.h"
+#include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/exception.h"
@@ -189,49 +213,358 @@ namespace mt_kahypar {
   }
 
   template<typename Hypergraph>
-  bool isGraph(const Hypergraph& hypergraph) {
-    if (Hypergraph::is_graph) {
-      return true;
-    }
-    return tbb::parallel_reduce(tbb::blocked_range<HyperedgeID>(
-            ID(0), hypergraph.initialNumEdges()), true, [&](const tbb::blocked_range<HyperedgeID>& range, bool isGraph) {
-      if ( isGraph ) {
-        bool tmp_is_graph = isGraph;
-        for (HyperedgeID he = range.begin(); he < range.end(); ++he) {
-          if ( hypergraph.edgeIsEnabled(he) ) {
-            tmp_is_graph &= (hypergraph.edgeSize(he) == 2);
-          }
-        }
-        return tmp_is_graph;
+  void checkCoarseningHierarchySupport(const Hypergraph& hypergraph, const Context& context) {
+    if ( context.partition.mode != Mode::direct || context.isNLevelPartitioning() ) {
+      throw UnsupportedOperationException(
+        "Coarsening hierarchies are only supported for direct multilevel partitioning!");
+    }
+    if ( context.partition.objective == Objective::steiner_tree ) {
+      throw UnsupportedOperationException(
+        "Coarsening hierarchies are not supported for the Steiner tree objective!");
+    }
+    if ( hypergraph.hasFixedVertices() ) {
+      throw UnsupportedOperationException(
+        "Coarsening hierarchies are not supported for hypergraphs with fixed vertices!");
+    }
+  }
+
+  // ! Removes the same degree-zero nodes and large hyperedges as before computing a coarsening
+  // ! hierarchy. The number of removed degree-zero nodes depends on the contraction limit.
+  template<typename TypeTraits>
+  void sanitizeForCoarseningHierarchy(typename TypeTraits::Hypergraph& hypergraph,
+                                      Context& context,
+                                      const HypernodeID hierarchy_contraction_limit,
+                                      DegreeZeroHypernodeRemover<TypeTraits>& degree_zero_hn_remover,
+                                      LargeHyperedgeRemover<TypeTraits>& large_he_remover) {
+    const HypernodeID contraction_limit = context.coarsening.contraction_limit;
+    context.coarsening.contraction_limit = hierarchy_contraction_limit;
+    sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
+    context.coarsening.contraction_limit = contraction_limit;
+  }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph partitionWithMode(typename TypeTraits::Hypergraph& hypergraph,
+                                                               Context& context,
+                                                               TargetGraph* target_graph) {
+    if (context.partition.mode == Mode::direct) {
+      return Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
+    } else if (context.partition.mode == Mode::recursive_bipartitioning) {
+      return RecursiveBipartitioning<TypeTraits>::partition(hypergraph, context, target_graph);
+    } else if (context.partition.mode == Mode::deep_multilevel) {
+      ASSERT(context.partition.objective != Objective::steiner_tree);
+      return DeepMultilevel<TypeTraits>::partition(hypergraph, context);
+    } else {
+      throw InvalidParameterException("Invalid partitioning mode!");
+    }
+  }
+
+  struct PortfolioState;
+
+  struct PortfolioRun {
+    PortfolioState* state = nullptr;
+    std::atomic<bool> cancelled { false };
+    bool finished_initial_partitioning = false;
+    HyperedgeWeight initial_objective = 0;
+  };
+
+  struct PortfolioState {
+    PortfolioState(const Context& context, const size_t num_runs) :
+      context(context),
+      mutex(),
+      best_initial_objective(std::numeric_limits<HyperedgeWeight>::max()),
+      runs(num_runs) {
+      for ( PortfolioRun& run : runs ) {
+        run.state = this;
       }
-      return false;
-    }, [&](const bool lhs, const bool rhs) {
-      return lhs && rhs;
-    });
+    }
+
+    const Context& context;
+    std::mutex mutex;
+    HyperedgeWeight best_initial_objective;
+    std::vector<PortfolioRun> runs;
+  };
+
+  // ! Cancel callback of a portfolio run
+  bool isPortfolioRunCancelled(void* data) {
+    const PortfolioRun& run = *static_cast<const PortfolioRun*>(data);
+    return run.cancelled.load(std::memory_order_relaxed) || run.state->context.isCancelled();
+  }
+
+  // ! Progress callback of a portfolio run. The progress is forwarded to the callback of the
+  // ! partitioning call. After initial partitioning, all runs that are worse than the best
+  // ! run by more than the cutoff factor are cancelled.
+  void reportPortfolioRunProgress(const mt_kahypar_progress_t* progress, void* data) {
+    PortfolioRun& run = *static_cast<PortfolioRun*>(data);
+    PortfolioState& state = *run.state;
+    const Context& context = state.context;
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if ( context.hasProgressCallback() ) {
+      context.partition.progress_callback(progress, context.partition.progress_callback_data);
+    }
+    if ( context.partition.portfolio_cutoff <= 0 ||
+         progress->phase != PROGRESS_INITIAL_PARTITIONING || run.finished_initial_partitioning ) {
+      return;
+    }
+    run.finished_initial_partitioning = true;
+    run.initial_objective = progress->objective;
+    state.best_initial_objective = std::min(state.best_initial_objective, run.initial_objective);
+    const double threshold = ( 1.0 + context.partition.portfolio_cutoff ) * state.best_initial_objective;
+    for ( PortfolioRun& other : state.runs ) {
+      if ( other.finished_initial_partitioning && other.initial_objective > threshold ) {
+        other.cancelled.store(true, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // ! Context of a portfolio run or recombination that uses the i-th share of the threads
+  Context createRunContext(const Context& context, const size_t i, const size_t num_runs, const size_t seed) {
+    const size_t num_threads = context.shared_memory.num_threads;
+    const size_t run_threads = num_threads / num_runs + ( i < num_threads % num_runs );
+    Context r_context(context);
+    r_context.partition.portfolio_runs = 1;
+    r_context.partition.evolutionary_time_limit = 0.0;
+    r_context.partition.seed = seed;
+    r_context.partition.verbose_output = false;
+    r_context.partition.progress_callback = nullptr;
+    r_context.shared_memory.num_threads = run_threads;
+    r_context.shared_memory.degree_of_parallelism *= static_cast<double>(run_threads) / num_threads;
+    r_context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+    return r_context;
   }
 
   template<typename Hypergraph>
-  bool isMeshGraph(const Hypergraph& graph) {
-    const HypernodeID num_nodes = graph.initialNumNodes();
-    const double avg_hn_degree = utils::avgHypernodeDegree(graph);
-    std::vector<HyperedgeID> hn_degrees;
-    hn_degrees.resize(graph.initialNumNodes());
-    graph.doParallelForAllNodes([&](const HypernodeID& hn) {
-      hn_degrees[hn] = graph.nodeDegree(hn);
+  Hypergraph copyOfInput(const Hypergraph& hypergraph) {
+    if constexpr ( std::is_same_v<Hypergraph, ds::StaticHypergraph> ) {
+      return hypergraph.shallowCopy(parallel_tag_t());
+    } else {
+      return hypergraph.copy(parallel_tag_t());
+    }
+  }
+
+  struct Individual {
+    vec<PartitionID> partition;
+    HyperedgeWeight quality;
+    bool is_balanced;
+
+    bool isBetterThan(const Individual& other) const {
+      return ( is_balanced && !other.is_balanced ) ||
+        ( is_balanced == other.is_balanced && quality < other.quality );
+    }
+  };
+
+  template<typename PartitionedHypergraph>
+  std::shared_ptr<const Individual> createIndividual(const PartitionedHypergraph& partitioned_hg,
+                                                     const Context& context) {
+    auto individual = std::make_shared<Individual>();
+    individual->partition.resize(partitioned_hg.initialNumNodes(), kInvalidPartition);
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      individual->partition[hn] = partitioned_hg.partID(hn);
     });
-    const double stdev_hn_degree = utils::parallel_stdev(hn_degrees, avg_hn_degree, num_nodes);
-    if (stdev_hn_degree > avg_hn_degree / 2) {
-      return false;
+    individual->quality = metrics::quality(partitioned_hg, context);
+    individual->is_balanced = metrics::isBalanced(partitioned_hg, context);
+    return individual;
+  }
+
+  // ! Memetic algorithm (as in KaHyPar-E): Until the time limit is exceeded, each share of the
+  // ! threads repeatedly recombines two parents selected via tournament selection. An offspring
+  // ! replaces the worst individual of the population if it is better and not a duplicate.
+  template<typename TypeTraits>
+  void evolvePopulation(const typename TypeTraits::Hypergraph& hypergraph,
+                        const Context& context,
+                        const TargetGraph* target_graph,
+                        vec<std::shared_ptr<const Individual>>& population) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    ASSERT(population.size() > 1);
+    const auto deadline = std::chrono::high_resolution_clock::now() +
+      std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+        std::chrono::duration<double>(context.partition.evolutionary_time_limit));
+    const size_t num_workers = std::min(population.size(), context.shared_memory.num_threads);
+    std::mutex population_mutex;
+    std::atomic<size_t> num_recombinations(0);
+    std::atomic<size_t> num_replacements(0);
+    std::mutex exception_mutex;
+    std::exception_ptr exception = nullptr;
+
+    tbb::task_group tg;
+    for ( size_t i = 0; i < num_workers; ++i ) {
+      tg.run([&, i] {
+        std::mt19937 prng(context.partition.seed + i);
+        auto tournament = [&] {
+          std::uniform_int_distribution<size_t> dist(0, population.size() - 1);
+          const size_t lhs = dist(prng);
+          const size_t rhs = dist(prng);
+          return population[lhs]->isBetterThan(*population[rhs]) ? lhs : rhs;
+        };
+
+        size_t generation = 0;
+        while ( std::chrono::high_resolution_clock::now() < deadline &&
+                !context.isTimeLimitExceeded() && !context.isCancelled() ) {
+          std::shared_ptr<const Individual> parent_1;
+          std::shared_ptr<const Individual> parent_2;
+          {
+            std::lock_guard<std::mutex> lock(population_mutex);
+            const size_t p1 = tournament();
+            size_t p2 = tournament();
+            for ( size_t j = 0; j < population.size() && p1 == p2; ++j ) {
+              p2 = tournament();
+            }
+            if ( p1 == p2 ) {
+              p2 = ( p1 + 1 ) % population.size();
+            }
+            parent_1 = population[p1];
+            parent_2 = population[p2];
+            if ( parent_2->isBetterThan(*parent_1) ) {
+              std::swap(parent_1, parent_2);
+            }
+          }
+
+          Context r_context = createRunContext(context, i, num_workers,
+            context.partition.seed + ( ++generation ) * num_workers + i);
+          tbb::task_arena arena(r_context.shared_memory.num_threads);
+          utils::ArenaLocalRandomize randomize(arena, r_context.partition.seed);
+          arena.execute([&] {
+            try {
+              Hypergraph offspring_hg = copyOfInput(hypergraph);
+              auto offspring = createIndividual(Multilevel<TypeTraits>::recombine(
+                offspring_hg, parent_1->partition, parent_2->partition, r_context, target_graph), context);
+              ++num_recombinations;
+
+              std::lock_guard<std::mutex> lock(population_mutex);
+              size_t worst = 0;
+              bool is_duplicate = false;
+              for ( size_t j = 0; j < population.size(); ++j ) {
+                is_duplicate |= population[j]->quality == offspring->quality &&
+                  population[j]->is_balanced == offspring->is_balanced &&
+                  population[j]->partition == offspring->partition;
+                if ( population[worst]->isBetterThan(*population[j]) ) {
+                  worst = j;
+                }
+              }
+              if ( !is_duplicate && offspring->isBetterThan(*population[worst]) ) {
+                population[worst] = std::move(offspring);
+                ++num_replacements;
+              }
+            } catch ( const CancellationException& ) {
+              // The partitioning call was cancelled
+            } catch ( ... ) {
+              std::lock_guard<std::mutex> lock(exception_mutex);
+              if ( !exception ) {
+                exception = std::current_exception();
+              }
+            }
+          });
+          if ( exception ) {
+            break;
+          }
+        }
+      });
+    }
+    tg.wait();
+
+    if ( exception ) {
+      std::rethrow_exception(exception);
+    }
+    if ( context.partition.verbose_output ) {
+      LOG << "Evolutionary algorithm:" << num_recombinations.load() << "recombinations,"
+          << num_replacements.load() << "offsprings replaced an individual of the population";
+    }
+  }
+
+  // ! Performs several independent runs with different seeds on copies of the
+  // ! preprocessed hypergraph. The threads are split among the runs and
+  // ! the best partition is applied to the input hypergraph. If an evolutionary
+  // ! time limit is given, the partitions of the runs are further recombined.
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph partitionPortfolio(typename TypeTraits::Hypergraph& hypergraph,
+                                                                Context& context,
+                                                                TargetGraph* target_graph) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("portfolio", "Portfolio");
+
+    const size_t num_runs = std::min(context.partition.portfolio_runs, context.shared_memory.num_threads);
+    PortfolioState state(context, num_runs);
+    vec<std::shared_ptr<const Individual>> results(num_runs);
+    std::mutex exception_mutex;
+    std::exception_ptr exception = nullptr;
+
+    tbb::task_group tg;
+    for ( size_t i = 0; i < num_runs; ++i ) {
+      tg.run([&, i] {
+        Context r_context = createRunContext(context, i, num_runs, context.partition.seed + i);
+        r_context.partition.cancel_callback = isPortfolioRunCancelled;
+        r_context.partition.cancel_callback_data = &state.runs[i];
+        r_context.partition.progress_callback =
+          context.partition.portfolio_cutoff > 0 || context.hasProgressCallback() ?
+            reportPortfolioRunProgress : nullptr;
+        r_context.partition.progress_callback_data = &state.runs[i];
+
+        tbb::task_arena arena(r_context.shared_memory.num_threads);
+        utils::ArenaLocalRandomize randomize(arena, r_context.partition.seed);
+        arena.execute([&] {
+          try {
+            Hypergraph run_hg = copyOfInput(hypergraph);
+            results[i] = createIndividual(
+              partitionWithMode<TypeTraits>(run_hg, r_context, target_graph), context);
+          } catch ( const CancellationException& ) {
+            // The run fell behind the other runs or the partitioning call was cancelled
+          } catch ( ... ) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if ( !exception ) {
+              exception = std::current_exception();
+            }
+          }
+        });
+      });
+    }
+    tg.wait();
+
+    if ( exception ) {
+      std::rethrow_exception(exception);
     }
+    context.checkForCancellation();
 
-    // test whether 99.9th percentile hypernode degree is at most 4 times the average degree
-    tbb::enumerable_thread_specific<size_t> num_high_degree_nodes(0);
-    graph.doParallelForAllNodes([&](const HypernodeID& node) {
-      if (graph.nodeDegree(node) > 4 * avg_hn_degree) {
-        num_high_degree_nodes.local() += 1;
+    vec<std::shared_ptr<const Individual>> population;
+    for ( size_t i = 0; i < num_runs; ++i ) {
+      if ( results[i] ) {
+        if ( context.partition.verbose_output ) {
+          LOG << "Portfolio run" << i << ":" << context.partition.objective << "=" << results[i]->quality
+              << ", balanced =" << std::boolalpha << results[i]->is_balanced;
+        }
+        population.push_back(std::move(results[i]));
+      } else if ( context.partition.verbose_output ) {
+        LOG << "Portfolio run" << i << ": cancelled after initial partitioning";
       }
+    }
+    // The run with the best objective after initial partitioning is never cancelled
+    ASSERT(!population.empty());
+
+    if ( context.partition.evolutionary_time_limit > 0 && population.size() > 1 ) {
+      timer.start_timer("evolutionary", "Evolutionary Algorithm");
+      evolvePopulation<TypeTraits>(hypergraph, context, target_graph, population);
+      timer.stop_timer("evolutionary");
+      context.checkForCancellation();
+    }
+
+    // Select the best balanced partition
+    size_t best = 0;
+    for ( size_t i = 1; i < population.size(); ++i ) {
+      if ( population[i]->isBetterThan(*population[best]) ) {
+        best = i;
+      }
+    }
+
+    PartitionedHypergraph partitioned_hg(context.partition.k, hypergraph, parallel_tag_t());
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      partitioned_hg.setOnlyNodePart(hn, population[best]->partition[hn]);
     });
-    return num_high_degree_nodes.combine(std::plus<>()) <= num_nodes / 1000;
+    partitioned_hg.initializePartition();
+    if ( target_graph ) {
+      partitioned_hg.setTargetGraph(target_graph);
+    }
+    timer.stop_timer("portfolio");
+    return partitioned_hg;
   }
 
   template<typename Hypergraph>
@@ -242,11 +575,20 @@ namespace mt_kahypar {
       const size_t max_steiner_tree_size = std::min(
         std::min(context.mapping.max_steiner_tree_size, UL(context.partition.k)),
         static_cast<size_t>(hypergraph.maxEdgeSize()));
-      target_graph->precomputeDistances(max_steiner_tree_size);
+      // The target graph may be shared by concurrent partitioning calls
+      target_graph->initialize(max_steiner_tree_size,
+        context.mapping.steiner_tree_cache_size * 1024 * 1024);
       timer.stop_timer("precompute_steiner_trees");
     }
   }
 
+  template<typename Hypergraph>
+  bool useBipartiteGraphView(const Context& context, const bool is_graph) {
+    // The implicit bipartite graph is only available for static hypergraphs
+    return std::is_same_v<Hypergraph, ds::StaticHypergraph> && !is_graph &&
+      context.preprocessing.community_detection.low_memory_contraction;
+  }
+
   template<typename Hypergraph>
   void preprocess(Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
     bool use_community_detection = context.preprocessing.use_community_detection;
@@ -255,9 +597,9 @@ namespace mt_kahypar {
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     if ( context.preprocessing.use_community_detection ) {
       timer.start_timer("detect_graph_structure", "Detect Graph Structure");
-      is_graph = isGraph(hypergraph);
+      is_graph = utils::isGraph(hypergraph);
       if ( is_graph && context.preprocessing.disable_community_detection_for_mesh_graphs ) {
-        use_community_detection = !isMeshGraph(hypergraph);
+        use_community_detection = !utils::isMeshGraph(hypergraph);
       }
       timer.stop_timer("detect_graph_structure");
     }
@@ -266,18 +608,58 @@ namespace mt_kahypar {
       io::printTopLevelPreprocessingBanner(context);
 
       timer.start_timer("community_detection", "Community Detection");
-      timer.start_timer("construct_graph", "Construct Graph");
-      Graph<Hypergraph> graph(hypergraph,
-        context.preprocessing.community_detection.edge_weight_function, is_graph);
-      if ( !context.preprocessing.community_detection.low_memory_contraction ) {
-        graph.allocateContractionBuffers();
+      const bool use_community_cache = !context.preprocessing.community_cache_dir.empty();
+      bool is_cached = false;
+      if ( use_community_cache ) {
+        timer.start_timer("load_cached_communities", "Load Cached Communities");
+        is_cached = community_detection::loadCachedCommunities(hypergraph, context);
+        timer.stop_timer("load_cached_communities");
+        if ( is_cached && context.partition.verbose_output ) {
+          LOG << "Loaded communities from cache directory" << context.preprocessing.community_cache_dir;
+        }
+      }
+
+      if ( !is_cached ) {
+        if ( context.preprocessing.community_detection_algorithm == CommunityDetectionAlgorithm::label_propagation ) {
+          timer.start_timer("perform_community_detection", "Perform Community Detection");
+          ds::Clustering communities = community_detection::run_label_propagation_clustering(hypergraph, context);
+          hypergraph.setCommunityIDs(std::move(communities));
+          timer.stop_timer("perform_community_detection");
+        } else if ( useBipartiteGraphView<Hypergraph>(context, is_graph) ) {
+          if constexpr ( std::is_same_v<Hypergraph, ds::StaticHypergraph> ) {
+            // Run the first level of the Louvain method on an implicit representation
+            // of the bipartite graph to avoid a copy of the hypergraph
+            timer.start_timer("construct_graph", "Construct Graph");
+            BipartiteGraphView<Hypergraph> graph(hypergraph,
+              context.preprocessing.community_detection.edge_weight_function);
+            timer.stop_timer("construct_graph");
+            timer.start_timer("perform_community_detection", "Perform Community Detection");
+            ds::Clustering communities = community_detection::run_parallel_louvain(graph, context);
+            graph.restrictClusteringToHypernodes(hypergraph, communities);
+            hypergraph.setCommunityIDs(std::move(communities));
+            timer.stop_timer("perform_community_detection");
+          }
+        } else {
+          timer.start_timer("construct_graph", "Construct Graph");
+          Graph<Hypergraph> graph(hypergraph,
+            context.preprocessing.community_detection.edge_weight_function, is_graph);
+          if ( !context.preprocessing.community_detection.low_memory_contraction ) {
+            graph.allocateContractionBuffers();
+          }
+          timer.stop_timer("construct_graph");
+          timer.start_timer("perform_community_detection", "Perform Community Detection");
+          ds::Clustering communities = community_detection::run_parallel_louvain(graph, context);
+          graph.restrictClusteringToHypernodes(hypergraph, communities);
+          hypergraph.setCommunityIDs(std::move(communities));
+          timer.stop_timer("perform_community_detection");
+        }
+
+        if ( use_community_cache ) {
+          timer.start_timer("cache_communities", "Cache Communities");
+          community_detection::cacheCommunities(hypergraph, context);
+          timer.stop_timer("cache_communities");
+        }
       }
-      timer.stop_timer("construct_graph");
-      timer.start_timer("perform_community_detection", "Perform Community Detection");
-      ds::Clustering communities = community_detection::run_parallel_louvain(graph, context);
-      graph.restrictClusteringToHypernodes(hypergraph, communities);
-      hypergraph.setCommunityIDs(std::move(communities));
-      timer.stop_timer("perform_community_detection");
       timer.stop_timer("community_detection");
 
       if (context.partition.verbose_output) {
@@ -317,11 +699,148 @@ namespace mt_kahypar {
     }
   }
 
+  template<typename Hypergraph>
+  void assignUnassignedNodes(const Hypergraph& hypergraph,
+                             const Context& context,
+                             vec<PartitionID>& partition,
+                             vec<HypernodeID>& touched_nodes) {
+    const PartitionID k = context.partition.k;
+    tbb::enumerable_thread_specific<vec<HypernodeWeight>> local_block_weights(k, 0);
+    tbb::enumerable_thread_specific<vec<HypernodeID>> local_unassigned_nodes;
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      PartitionID& block = partition[hn];
+      if ( block != kInvalidPartition && ( block < 0 || block >= k ) ) {
+        throw InvalidInputException(
+          "Node " + STR(hn) + " is assigned to block " + STR(block) +
+          ", but the number of blocks is " + STR(k));
+      }
+      if ( hypergraph.isFixed(hn) && block != hypergraph.fixedVertexBlock(hn) ) {
+        block = kInvalidPartition;
+      }
+
+      if ( block == kInvalidPartition ) {
+        local_unassigned_nodes.local().push_back(hn);
+      } else {
+        local_block_weights.local()[block] += hypergraph.nodeWeight(hn);
+      }
+    });
+
+    vec<HypernodeWeight> block_weights(k, 0);
+    for ( const vec<HypernodeWeight>& local_weights : local_block_weights ) {
+      for ( PartitionID block = 0; block < k; ++block ) {
+        block_weights[block] += local_weights[block];
+      }
+    }
+    vec<HypernodeID> unassigned_nodes;
+    for ( const vec<HypernodeID>& local_nodes : local_unassigned_nodes ) {
+      unassigned_nodes.insert(unassigned_nodes.end(), local_nodes.begin(), local_nodes.end());
+    }
+    std::sort(unassigned_nodes.begin(), unassigned_nodes.end());
+
+    // Greedily assign each unassigned node to the block to which it is most strongly
+    // connected and that can accommodate its weight. Since we expect only a small
+    // fraction of the nodes to be unassigned, we do this sequentially.
+    vec<HyperedgeWeight> connectivity(k, 0);
+    vec<HyperedgeID> last_seen_edge(k, kInvalidHyperedge);
+    for ( const HypernodeID& hn : unassigned_nodes ) {
+      const HypernodeWeight weight = hypergraph.nodeWeight(hn);
+      PartitionID to = kInvalidPartition;
+      if ( hypergraph.isFixed(hn) ) {
+        to = hypergraph.fixedVertexBlock(hn);
+      } else {
+        std::fill(connectivity.begin(), connectivity.end(), 0);
+        std::fill(last_seen_edge.begin(), last_seen_edge.end(), kInvalidHyperedge);
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+          for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+            const PartitionID block = partition[pin];
+            if ( block != kInvalidPartition && last_seen_edge[block] != he ) {
+              connectivity[block] += hypergraph.edgeWeight(he);
+              last_seen_edge[block] = he;
+            }
+          }
+        }
+
+        PartitionID lightest_block = 0;
+        for ( PartitionID block = 0; block < k; ++block ) {
+          if ( block_weights[block] < block_weights[lightest_block] ) {
+            lightest_block = block;
+          }
+          if ( block_weights[block] + weight <= context.partition.max_part_weights[block] &&
+               ( to == kInvalidPartition || connectivity[block] > connectivity[to] ||
+                 ( connectivity[block] == connectivity[to] && block_weights[block] < block_weights[to] ) ) ) {
+            to = block;
+          }
+        }
+        if ( to == kInvalidPartition ) {
+          to = lightest_block;
+        }
+      }
+
+      partition[hn] = to;
+      block_weights[to] += weight;
+      touched_nodes.push_back(hn);
+    }
+  }
+
+  template<typename TypeTraits>
+  void refineLocally(typename TypeTraits::PartitionedHypergraph& partitioned_hg,
+                     const Context& context,
+                     const vec<HypernodeID>& refinement_nodes) {
+    auto& hypergraph = partitioned_hg.hypergraph();
+    gain_cache_t gain_cache = GainCachePtr::constructGainCache(context);
+    std::unique_ptr<IRebalancer> rebalancer = RebalancerFactory::getInstance().createObject(
+      context.refinement.rebalancing.algorithm, hypergraph.initialNumNodes(), context, gain_cache);
+    std::unique_ptr<IRefiner> label_propagation = LabelPropagationFactory::getInstance().createObject(
+      context.refinement.label_propagation.algorithm,
+      hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+    std::unique_ptr<IRefiner> fm = FMFactory::getInstance().createObject(
+      context.refinement.fm.algorithm,
+      hypergraph.initialNumNodes(), hypergraph.initialNumEdges(), context, gain_cache, *rebalancer);
+
+    mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hg);
+    Metrics current_metrics = { metrics::quality(partitioned_hg, context),
+                                metrics::imbalance(partitioned_hg, context) };
+    rebalancer->initialize(phg);
+    if ( !metrics::isBalanced(partitioned_hg, context) ) {
+      rebalancer->refine(phg, {}, current_metrics, 0.0);
+    }
+
+    bool improvement_found = true;
+    while ( improvement_found ) {
+      improvement_found = false;
+      if ( context.refinement.label_propagation.algorithm != LabelPropagationAlgorithm::do_nothing ) {
+        label_propagation->initialize(phg);
+        improvement_found |= label_propagation->refine(phg,
+          refinement_nodes, current_metrics, std::numeric_limits<double>::max());
+      }
+
+      if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        fm->initialize(phg);
+        improvement_found |= fm->refine(phg,
+          refinement_nodes, current_metrics, std::numeric_limits<double>::max());
+      }
+
+      if ( !context.refinement.refine_until_no_improvement ) {
+        break;
+      }
+    }
+
+    fm.reset();
+    label_propagation.reset();
+    rebalancer.reset();
+    GainCachePtr::deleteGainCache(gain_cache);
+  }
+
   template<typename TypeTraits>
   typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::partition(
     Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
+    context.setupDeadline();
+    if ( context.partition.auto_tuning ) {
+      AutoTuning<TypeTraits>::tune(hypergraph, context, target_graph);
+    }
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
+    memory_budget::applyBudget(memory_budget::instanceSize(hypergraph), context);
 
     io::printContext(context);
     io::printMemoryPoolConsumption(context);
@@ -337,26 +856,49 @@ namespace mt_kahypar {
     }
     #endif
 
+    if constexpr ( parallel::ContentionStats::enabled ) {
+      parallel::ContentionStats::instance().reset();
+    }
+
     // ################## PREPROCESSING ##################
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("preprocessing", "Preprocessing");
+    // All subsequent phases work on the reordered hypergraph, if node reordering is enabled
+    NodeReordering<TypeTraits> node_reordering(context);
+    Hypergraph reordered_hypergraph;
+    const bool reorder_nodes = context.preprocessing.reorder_nodes && !hypergraph.hasFixedVertices();
+    if ( reorder_nodes ) {
+      timer.start_timer("node_reordering", "Node Reordering");
+      reordered_hypergraph = node_reordering.reorder(hypergraph);
+      timer.stop_timer("node_reordering");
+    }
+    Hypergraph& reordered_hg = reorder_nodes ? reordered_hypergraph : hypergraph;
+    // Twins are contracted into weighted super-nodes and expanded after postprocessing
+    TwinNodeCompression<TypeTraits> twin_compression(context);
+    Hypergraph compressed_hypergraph;
+    const bool compress_twins = TwinNodeCompression<TypeTraits>::is_supported &&
+      context.preprocessing.compress_twin_nodes && !hypergraph.hasFixedVertices();
+    if ( compress_twins ) {
+      timer.start_timer("twin_node_compression", "Twin Node Compression");
+      compressed_hypergraph = twin_compression.compress(reordered_hg);
+      timer.stop_timer("twin_node_compression");
+      if ( context.partition.verbose_output ) {
+        LOG << "Twin node compression removed" << twin_compression.numRemovedNodes() << "nodes";
+      }
+    }
+    Hypergraph& hg = compress_twins ? compressed_hypergraph : reordered_hg;
     DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
     LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
-    preprocess(hypergraph, context, target_graph);
-    sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
+    preprocess(hg, context, target_graph);
+    sanitize(hg, context, degree_zero_hn_remover, large_he_remover);
     timer.stop_timer("preprocessing");
 
     // ################## MULTILEVEL & VCYCLE ##################
     PartitionedHypergraph partitioned_hypergraph;
-    if (context.partition.mode == Mode::direct) {
-      partitioned_hypergraph = Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
-    } else if (context.partition.mode == Mode::recursive_bipartitioning) {
-      partitioned_hypergraph = RecursiveBipartitioning<TypeTraits>::partition(hypergraph, context, target_graph);
-    } else if (context.partition.mode == Mode::deep_multilevel) {
-      ASSERT(context.partition.objective != Objective::steiner_tree);
-      partitioned_hypergraph = DeepMultilevel<TypeTraits>::partition(hypergraph, context);
+    if ( context.partition.portfolio_runs > 1 && context.shared_memory.num_threads > 1 ) {
+      partitioned_hypergraph = partitionPortfolio<TypeTraits>(hg, context, target_graph);
     } else {
-      throw InvalidParameterException("Invalid partitioning mode!");
+      partitioned_hypergraph = partitionWithMode<TypeTraits>(hg, context, target_graph);
     }
 
     ASSERT([&] {
@@ -379,6 +921,12 @@ namespace mt_kahypar {
     large_he_remover.restoreLargeHyperedges(partitioned_hypergraph);
     degree_zero_hn_remover.restoreDegreeZeroHypernodes(partitioned_hypergraph);
     forceFixedVertexAssignment(partitioned_hypergraph, context);
+    if ( compress_twins ) {
+      PartitionedHypergraph expanded_partitioned_hypergraph(
+        context.partition.k, reordered_hg, parallel_tag_t());
+      twin_compression.projectPartition(partitioned_hypergraph, expanded_partitioned_hypergraph);
+      partitioned_hypergraph = std::move(expanded_partitioned_hypergraph);
+    }
     timer.stop_timer("postprocessing");
 
     #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
@@ -392,6 +940,20 @@ namespace mt_kahypar {
     }
     #endif
 
+    if ( reorder_nodes ) {
+      timer.start_timer("postprocessing", "Postprocessing");
+      PartitionedHypergraph input_partitioned_hypergraph(
+        context.partition.k, hypergraph, parallel_tag_t());
+      node_reordering.projectPartition(partitioned_hypergraph, input_partitioned_hypergraph);
+      partitioned_hypergraph = std::move(input_partitioned_hypergraph);
+      timer.stop_timer("postprocessing");
+    }
+
+    if constexpr ( parallel::ContentionStats::enabled ) {
+      parallel::ContentionStats::instance().report(
+        utils::Utilities::instance().getStats(context.utility_id));
+    }
+
     if (context.partition.verbose_output) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(), context,
         "Uncoarsened Hypergraph", context.partition.show_memory_consumption);
@@ -402,13 +964,122 @@ namespace mt_kahypar {
   }
 
 
+  template<typename TypeTraits>
+  CoarseningHierarchy<typename TypeTraits::Hypergraph> Partitioner<TypeTraits>::coarsen(
+    const Hypergraph& input_hypergraph, Context& context) {
+    checkCoarseningHierarchySupport(input_hypergraph, context);
+    Hypergraph hypergraph = input_hypergraph.copy(parallel_tag_t());
+    context.setupDeadline();
+    configurePreprocessing(hypergraph, context);
+    setupContext(hypergraph, context, nullptr);
+    memory_budget::applyBudget(memory_budget::instanceSize(hypergraph), context);
+
+    io::printContext(context);
+    io::printInputInformation(context, hypergraph);
+
+    // ################## PREPROCESSING ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("preprocessing", "Preprocessing");
+    DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
+    LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
+    preprocess(hypergraph, context, nullptr);
+    sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
+    timer.stop_timer("preprocessing");
+
+    // ################## COARSENING ##################
+    vec<Level<TypeTraits>> levels = Multilevel<TypeTraits>::coarsen(hypergraph, context);
+    return CoarseningHierarchy<Hypergraph>(
+      hypergraph, std::move(levels), context.coarsening.contraction_limit);
+  }
+
+  template<typename TypeTraits>
+  CoarseningHierarchy<typename TypeTraits::Hypergraph> Partitioner<TypeTraits>::readHierarchy(
+    const Hypergraph& input_hypergraph, Context& context, const std::string& filename) {
+    checkCoarseningHierarchySupport(input_hypergraph, context);
+    CoarseningHierarchy<Hypergraph> hierarchy = CoarseningHierarchy<Hypergraph>::readFromFile(filename);
+    Hypergraph hypergraph = input_hypergraph.copy(parallel_tag_t());
+    setupContext(hypergraph, context, nullptr);
+
+    DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
+    LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
+    sanitizeForCoarseningHierarchy(hypergraph, context,
+      hierarchy.contractionLimit(), degree_zero_hn_remover, large_he_remover);
+    hierarchy.contract(hypergraph);
+    return hierarchy;
+  }
+
+  template<typename TypeTraits>
+  typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::partition(
+    Hypergraph& hypergraph, Context& context, const CoarseningHierarchy<Hypergraph>& hierarchy) {
+    checkCoarseningHierarchySupport(hypergraph, context);
+    if ( hypergraph.initialNumNodes() != hierarchy.numNodes() ) {
+      throw InvalidInputException(
+        "The coarsening hierarchy was not computed for the given hypergraph!");
+    }
+    context.setupDeadline();
+    setupContext(hypergraph, context, nullptr);
+    memory_budget::applyBudget(memory_budget::instanceSize(hypergraph), context);
+
+    io::printContext(context);
+    io::printMemoryPoolConsumption(context);
+    io::printInputInformation(context, hypergraph);
+
+    // ################## PREPROCESSING ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("preprocessing", "Preprocessing");
+    DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
+    LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
+    sanitizeForCoarseningHierarchy(hypergraph, context,
+      hierarchy.contractionLimit(), degree_zero_hn_remover, large_he_remover);
+    try {
+      hierarchy.verifyHypergraph(hypergraph);
+    } catch ( ... ) {
+      // Restore the removed nodes and hyperedges of the input hypergraph
+      PartitionedHypergraph partitioned_hypergraph(context.partition.k, hypergraph, parallel_tag_t());
+      partitioned_hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+        partitioned_hypergraph.setOnlyNodePart(hn, 0);
+      });
+      partitioned_hypergraph.initializePartition();
+      large_he_remover.restoreLargeHyperedges(partitioned_hypergraph);
+      degree_zero_hn_remover.restoreDegreeZeroHypernodes(partitioned_hypergraph);
+      timer.stop_timer("preprocessing");
+      throw;
+    }
+    hypergraph.setCommunityIDs(ds::Clustering(hierarchy.communities()));
+    timer.stop_timer("preprocessing");
+
+    // ################## MULTILEVEL & VCYCLE ##################
+    timer.start_timer("copy_hierarchy", "Copy Hierarchy");
+    vec<Level<TypeTraits>> levels =
+      hierarchy.template copyLevels<TypeTraits>(context.coarsening.contraction_limit);
+    timer.stop_timer("copy_hierarchy");
+    PartitionedHypergraph partitioned_hypergraph =
+      Multilevel<TypeTraits>::partition(hypergraph, context, std::move(levels));
+
+    // ################## POSTPROCESSING ##################
+    timer.start_timer("postprocessing", "Postprocessing");
+    large_he_remover.restoreLargeHyperedges(partitioned_hypergraph);
+    degree_zero_hn_remover.restoreDegreeZeroHypernodes(partitioned_hypergraph);
+    timer.stop_timer("postprocessing");
+
+    if (context.partition.verbose_output) {
+      io::printHypergraphInfo(partitioned_hypergraph.hypergraph(), context,
+        "Uncoarsened Hypergraph", context.partition.show_memory_consumption);
+      io::printStripe();
+    }
+
+    return partitioned_hypergraph;
+  }
+
   template<typename TypeTraits>
   void Partitioner<TypeTraits>::partitionVCycle(PartitionedHypergraph& partitioned_hg,
                                                 Context& context,
                                                 TargetGraph* target_graph) {
     Hypergraph& hypergraph = partitioned_hg.hypergraph();
+    context.setupDeadline();
     configurePreprocessing(hypergraph, context);
     setupContext(hypergraph, context, target_graph);
+    memory_budget::applyBudget(memory_budget::instanceSize(hypergraph), context);
 
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("preprocessing", "Preprocessing");
@@ -465,5 +1136,132 @@ namespace mt_kahypar {
     }(), "Some fixed vertices are not assigned to their corresponding block");
   }
 
+  template<typename TypeTraits>
+  typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::repartition(
+    Hypergraph& hypergraph,
+    Context& context,
+    const vec<PartitionID>& previous_partition,
+    const vec<HypernodeID>& touched_nodes) {
+    if ( previous_partition.size() != hypergraph.initialNumNodes() ) {
+      throw InvalidInputException(
+        "The size of the previous partition does not match the number of nodes of the hypergraph!");
+    }
+    if ( context.partition.objective == Objective::steiner_tree ) {
+      throw UnsupportedOperationException(
+        "Repartitioning is not supported for the Steiner tree objective!");
+    }
+    context.setupDeadline();
+    setupContext(hypergraph, context, nullptr);
+
+    io::printContext(context);
+    io::printInputInformation(context, hypergraph);
+
+    // ################## PROJECT PARTITION ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("project_partition", "Project Partition");
+    vec<PartitionID> partition(previous_partition);
+    vec<HypernodeID> refinement_nodes(touched_nodes);
+    for ( const HypernodeID& hn : refinement_nodes ) {
+      if ( hn >= hypergraph.initialNumNodes() ) {
+        throw InvalidInputException("Touched node " + STR(hn) + " does not exist!");
+      }
+    }
+    assignUnassignedNodes(hypergraph, context, partition, refinement_nodes);
+    std::sort(refinement_nodes.begin(), refinement_nodes.end());
+    refinement_nodes.erase(std::unique(refinement_nodes.begin(), refinement_nodes.end()), refinement_nodes.end());
+
+    PartitionedHypergraph partitioned_hg(context.partition.k, hypergraph, parallel_tag_t { });
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      partitioned_hg.setOnlyNodePart(hn, partition[hn]);
+    });
+    partitioned_hg.initializePartition();
+    timer.stop_timer("project_partition");
+
+    // ################## LOCALIZED REFINEMENT ##################
+    timer.start_timer("refinement", "Refinement");
+    refineLocally<TypeTraits>(partitioned_hg, context, refinement_nodes);
+    timer.stop_timer("refinement");
+
+    if (context.partition.verbose_output) {
+      io::printHypergraphInfo(partitioned_hg.hypergraph(), context,
+        "Repartitioned Hypergraph", context.partition.show_memory_consumption);
+      io::printStripe();
+    }
+
+    return partitioned_hg;
+  }
+
+  template<typename TypeTraits>
+  void Partitioner<TypeTraits>::improveRegion(PartitionedHypergraph& partitioned_hg,
+                                              Context& context,
+                                              const vec<HypernodeID>& region_nodes,
+                                              const HypernodeID radius) {
+    if ( context.partition.objective == Objective::steiner_tree ) {
+      throw UnsupportedOperationException(
+        "Region-restricted refinement is not supported for the Steiner tree objective!");
+    }
+    Hypergraph& hypergraph = partitioned_hg.hypergraph();
+    context.setupDeadline();
+    setupContext(hypergraph, context, nullptr);
+
+    io::printContext(context);
+    io::printInputInformation(context, hypergraph);
+    io::printPartitioningResults(partitioned_hg, context, "\nInput Partition:");
+
+    // ################## EXPAND REGION ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("expand_region", "Expand Region");
+    ds::Bitset region(hypergraph.initialNumNodes());
+    vec<HypernodeID> refinement_nodes;
+    for ( const HypernodeID& hn : region_nodes ) {
+      if ( hn >= hypergraph.initialNumNodes() || !hypergraph.nodeIsEnabled(hn) ) {
+        throw InvalidInputException("Region node " + STR(hn) + " does not exist!");
+      }
+      if ( !region.isSet(hn) ) {
+        region.set(hn);
+        refinement_nodes.push_back(hn);
+      }
+    }
+    // Breadth-first search that adds all nodes within the given number of hops
+    size_t begin = 0;
+    for ( HypernodeID hop = 0; hop < radius && begin < refinement_nodes.size(); ++hop ) {
+      const size_t end = refinement_nodes.size();
+      for ( size_t i = begin; i < end; ++i ) {
+        const HypernodeID hn = refinement_nodes[i];
+        for ( const HyperedgeID& he : partitioned_hg.incidentEdges(hn) ) {
+          if ( partitioned_hg.edgeSize(he) >= context.partition.ignore_hyperedge_size_threshold ) {
+            continue;
+          }
+          for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+            if ( !region.isSet(pin) ) {
+              region.set(pin);
+              refinement_nodes.push_back(pin);
+            }
+          }
+        }
+      }
+      begin = end;
+    }
+    timer.stop_timer("expand_region");
+
+    // ################## LOCALIZED REFINEMENT ##################
+    timer.start_timer("refinement", "Refinement");
+    partitioned_hg.setMovableRegion(&region);
+    try {
+      refineLocally<TypeTraits>(partitioned_hg, context, refinement_nodes);
+    } catch ( ... ) {
+      partitioned_hg.setMovableRegion(nullptr);
+      throw;
+    }
+    partitioned_hg.setMovableRegion(nullptr);
+    timer.stop_timer("refinement");
+
+    if (context.partition.verbose_output) {
+      io::printHypergraphInfo(partitioned_hg.hypergraph(), context,
+        "Refined Hypergraph", context.partition.show_memory_consumption);
+      io::printStripe();
+    }
+  }
+
   INSTANTIATE_CLASS_WITH_TYPE_TRAITS(Partitioner)
 }
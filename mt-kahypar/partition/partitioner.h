@@ -27,12 +27,16 @@
 
 #pragma once
 
+#include <string>
+
 #include "mt-kahypar/partition/context.h"
 
 namespace mt_kahypar {
 
 // Forward Declaration
 class TargetGraph;
+template<typename Hypergraph>
+class CoarseningHierarchy;
 
 template<typename TypeTraits>
 class Partitioner {
@@ -48,6 +52,42 @@ class Partitioner {
   static void partitionVCycle(PartitionedHypergraph& partitioned_hg,
                               Context& context,
                               TargetGraph* target_graph = nullptr);
+
+  // ! Performs community detection and coarsening on a copy of the hypergraph. The resulting
+  // ! hierarchy can be used to partition the hypergraph several times with different k and
+  // ! imbalance (all other parameters should be the same).
+  static CoarseningHierarchy<Hypergraph> coarsen(const Hypergraph& hypergraph,
+                                                 Context& context);
+
+  // ! Reads a coarsening hierarchy of the hypergraph from a file
+  // ! (see CoarseningHierarchy<Hypergraph>::writeToFile(...)).
+  static CoarseningHierarchy<Hypergraph> readHierarchy(const Hypergraph& hypergraph,
+                                                       Context& context,
+                                                       const std::string& filename);
+
+  // ! Partitions a hypergraph starting from a precomputed coarsening hierarchy.
+  // ! Only initial partitioning and uncoarsening are performed, unless the
+  // ! hierarchy is not coarse enough for the contraction limit of k.
+  static PartitionedHypergraph partition(Hypergraph& hypergraph,
+                                         Context& context,
+                                         const CoarseningHierarchy<Hypergraph>& hierarchy);
+
+  // ! Projects the partition of a previous version of the hypergraph onto the
+  // ! current hypergraph (nodes without a block have the value kInvalidPartition)
+  // ! and improves it with localized refinement seeded only from the touched nodes.
+  static PartitionedHypergraph repartition(Hypergraph& hypergraph,
+                                           Context& context,
+                                           const vec<PartitionID>& previous_partition,
+                                           const vec<HypernodeID>& touched_nodes);
+
+  // ! Improves the partition with localized refinement restricted to the given nodes
+  // ! and all nodes within the given number of hops. All other nodes are implicitly
+  // ! fixed to their current block, such that the running time mainly depends on the
+  // ! size of the region.
+  static void improveRegion(PartitionedHypergraph& partitioned_hg,
+                            Context& context,
+                            const vec<HypernodeID>& region_nodes,
+                            const HypernodeID radius);
 };
 
 }  // namespace mt_kahypar
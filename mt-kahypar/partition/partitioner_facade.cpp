@@ -27,11 +27,21 @@
 
 #include "mt-kahypar/partition/partitioner_facade.h"
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/datastructures/sparse_pin_counts.h"
 #include "mt-kahypar/partition/partitioner.h"
+#include "mt-kahypar/partition/coarsening/coarsening_hierarchy.h"
+#include "mt-kahypar/partition/memory_budget.h"
+#include "mt-kahypar/partition/nested_partitions.h"
+#include "mt-kahypar/partition/block_ordering.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/io/csv_output.h"
+#include "mt-kahypar/io/json_output.h"
 #include "mt-kahypar/io/sql_plottools_serializer.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -59,6 +69,55 @@ namespace internal {
         new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE };
   }
 
+  template<typename Hypergraph>
+  CoarseningHierarchy<Hypergraph>& cast_hierarchy(const mt_kahypar_hierarchy_t hierarchy) {
+    if ( hierarchy.type != Hypergraph::TYPE || !hierarchy.hierarchy ) {
+      throw InvalidInputException(
+        "The coarsening hierarchy was not computed for this type of hypergraph!");
+    }
+    return *reinterpret_cast<CoarseningHierarchy<Hypergraph>*>(hierarchy.hierarchy);
+  }
+
+  template<typename TypeTraits>
+  mt_kahypar_hierarchy_t coarsen(mt_kahypar_hypergraph_t hypergraph,
+                                 Context& context) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    const Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+    CoarseningHierarchy<Hypergraph> hierarchy = Partitioner<TypeTraits>::coarsen(hg, context);
+    return mt_kahypar_hierarchy_t {
+      reinterpret_cast<mt_kahypar_hierarchy_s*>(
+        new CoarseningHierarchy<Hypergraph>(std::move(hierarchy))), Hypergraph::TYPE };
+  }
+
+  template<typename TypeTraits>
+  mt_kahypar_hierarchy_t readHierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                       Context& context,
+                                       const std::string& filename) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    const Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+    CoarseningHierarchy<Hypergraph> hierarchy =
+      Partitioner<TypeTraits>::readHierarchy(hg, context, filename);
+    return mt_kahypar_hierarchy_t {
+      reinterpret_cast<mt_kahypar_hierarchy_s*>(
+        new CoarseningHierarchy<Hypergraph>(std::move(hierarchy))), Hypergraph::TYPE };
+  }
+
+  template<typename TypeTraits>
+  mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hypergraph,
+                                                Context& context,
+                                                const mt_kahypar_hierarchy_t hierarchy) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+
+    PartitionedHypergraph partitioned_hg =
+      Partitioner<TypeTraits>::partition(hg, context, cast_hierarchy<Hypergraph>(hierarchy));
+
+    return mt_kahypar_partitioned_hypergraph_t {
+      reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
+        new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE };
+  }
+
   template<typename TypeTraits>
   void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                Context& context,
@@ -70,6 +129,69 @@ namespace internal {
     Partitioner<TypeTraits>::partitionVCycle(phg, context, target_graph);
   }
 
+  template<typename TypeTraits>
+  mt_kahypar_partitioned_hypergraph_t repartition(mt_kahypar_hypergraph_t hypergraph,
+                                                  Context& context,
+                                                  const vec<PartitionID>& previous_partition,
+                                                  const vec<HypernodeID>& touched_nodes) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+
+    PartitionedHypergraph partitioned_hg =
+      Partitioner<TypeTraits>::repartition(hg, context, previous_partition, touched_nodes);
+
+    return mt_kahypar_partitioned_hypergraph_t {
+      reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
+        new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE };
+  }
+
+  template<typename TypeTraits>
+  void improveRegion(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                     Context& context,
+                     const vec<HypernodeID>& region_nodes,
+                     const HypernodeID radius) {
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(partitioned_hg);
+    Partitioner<TypeTraits>::improveRegion(phg, context, region_nodes, radius);
+  }
+
+  #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+  // Fraction of nets whose pin counts may not fit into the sparse representation
+  static constexpr double MAX_LARGE_NET_FRACTION = 0.01;
+
+  bool use_sparse_connectivity_info(const ds::StaticHypergraph& hypergraph, const Context& context) {
+    const PartitionID k = context.partition.k;
+    const HyperedgeID num_hyperedges = hypergraph.initialNumEdges();
+    // Under a tight memory budget, the sparse representation is also considered for small k
+    const bool exceeds_memory_budget = memory_budget::exceedsBudget(
+      memory_budget::instanceSize(hypergraph), context, false);
+    if ( ( k < context.partition.sparse_connectivity_min_k && !exceeds_memory_budget ) || num_hyperedges == 0 ) {
+      return false;
+    }
+
+    // The sparse representation must need less memory than the dense pin counts and
+    // connectivity sets, and only few nets are allowed to overflow to the external pin count list
+    const HypernodeID max_edge_size = hypergraph.maxEdgeSize();
+    const size_t dense_bytes =
+      ds::PinCountInPart::num_elements(num_hyperedges, k, max_edge_size) * sizeof(ds::PinCountInPart::Value) +
+      ds::ConnectivitySets::num_elements(num_hyperedges, k) * sizeof(ds::ConnectivitySets::UnsafeBlock);
+    const size_t sparse_bytes =
+      ds::SparsePinCounts::num_elements(num_hyperedges, k, max_edge_size) * sizeof(ds::SparsePinCounts::Value);
+    if ( sparse_bytes >= dense_bytes ) {
+      return false;
+    }
+
+    tbb::enumerable_thread_specific<HyperedgeID> num_large_nets(0);
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+      if ( hypergraph.edgeSize(he) > ds::SparsePinCounts::maxEntriesPerHyperedge() ) {
+        ++num_large_nets.local();
+      }
+    });
+    return num_large_nets.combine(std::plus<>()) <= MAX_LARGE_NET_FRACTION * num_hyperedges;
+  }
+  #endif
+
   void check_if_feature_is_enabled(const mt_kahypar_partition_type_t type) {
     unused(type);
     #ifndef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -95,13 +217,49 @@ namespace internal {
     #endif
   }
 
+  template<typename PartitionedHypergraph>
+  void writeNestedPartitionFiles(const PartitionedHypergraph& phg,
+                                 const std::string& filename,
+                                 const bool binary) {
+    vec<PartitionID> partition(phg.initialNumNodes(), kInvalidPartition);
+    for ( const PartitionID nested_k : nested::numBlocksOfNestedPartitions(phg.k()) ) {
+      if ( nested_k < phg.k() ) {
+        nested::getNestedPartition(phg, nested_k, partition.data());
+        io::writePartitionFile(partition.data(), phg.initialNumNodes(),
+          filename + ".nested" + std::to_string(nested_k), binary);
+      }
+    }
+  }
+
+  template<typename PartitionedHypergraph>
+  void writeBlockOrderingFile(const PartitionedHypergraph& phg,
+                              const std::string& filename) {
+    block_ordering::writeBlockOrderingFile(
+      block_ordering::computeBlockOrdering(phg), filename + ".ordering");
+  }
+
 } // namespace internal
 
+  mt_kahypar_partition_type_t PartitionerFacade::partitionType(mt_kahypar_hypergraph_t hypergraph,
+                                                               const Context& context) {
+    const mt_kahypar_partition_type_t type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type);
+    #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+    if ( type == MULTILEVEL_HYPERGRAPH_PARTITIONING && hypergraph.type == STATIC_HYPERGRAPH &&
+         internal::use_sparse_connectivity_info(utils::cast<ds::StaticHypergraph>(hypergraph), context) ) {
+      return LARGE_K_PARTITIONING;
+    }
+    #else
+    unused(hypergraph);
+    #endif
+    return type;
+  }
+
   mt_kahypar_partitioned_hypergraph_t PartitionerFacade::partition(mt_kahypar_hypergraph_t hypergraph,
                                                                    Context& context,
                                                                    TargetGraph* target_graph) {
-    const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+    const mt_kahypar_partition_type_t type = partitionType(hypergraph, context);
+    context.partition.partition_type = type;
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -129,11 +287,98 @@ namespace internal {
   }
 
 
+  mt_kahypar_hierarchy_t PartitionerFacade::coarsen(mt_kahypar_hypergraph_t hypergraph,
+                                                     Context& context) {
+    const mt_kahypar_partition_type_t type = partitionType(hypergraph, context);
+    context.partition.partition_type = type;
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::coarsen<StaticGraphTypeTraits>(hypergraph, context);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::coarsen<StaticHypergraphTypeTraits>(hypergraph, context);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::coarsen<LargeKHypergraphTypeTraits>(hypergraph, context);
+      #endif
+      default:
+        throw UnsupportedOperationException(
+          "Coarsening hierarchies are only supported for multilevel partitioning!");
+    }
+    return mt_kahypar_hierarchy_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
+  mt_kahypar_hierarchy_t PartitionerFacade::readHierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                                           Context& context,
+                                                           const std::string& filename) {
+    const mt_kahypar_partition_type_t type = partitionType(hypergraph, context);
+    context.partition.partition_type = type;
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::readHierarchy<StaticGraphTypeTraits>(hypergraph, context, filename);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::readHierarchy<StaticHypergraphTypeTraits>(hypergraph, context, filename);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::readHierarchy<LargeKHypergraphTypeTraits>(hypergraph, context, filename);
+      #endif
+      default:
+        throw UnsupportedOperationException(
+          "Coarsening hierarchies are only supported for multilevel partitioning!");
+    }
+    return mt_kahypar_hierarchy_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
+  void PartitionerFacade::writeHierarchy(const mt_kahypar_hierarchy_t hierarchy,
+                                         const std::string& filename) {
+    switch ( hierarchy.type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case STATIC_GRAPH:
+        internal::cast_hierarchy<ds::StaticGraph>(hierarchy).writeToFile(filename); break;
+      #endif
+      case STATIC_HYPERGRAPH:
+        internal::cast_hierarchy<ds::StaticHypergraph>(hierarchy).writeToFile(filename); break;
+      default:
+        throw InvalidInputException("Invalid coarsening hierarchy!");
+    }
+  }
+
+  mt_kahypar_partitioned_hypergraph_t PartitionerFacade::partition(mt_kahypar_hypergraph_t hypergraph,
+                                                                   Context& context,
+                                                                   const mt_kahypar_hierarchy_t hierarchy) {
+    const mt_kahypar_partition_type_t type = partitionType(hypergraph, context);
+    context.partition.partition_type = type;
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::partition<StaticGraphTypeTraits>(hypergraph, context, hierarchy);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::partition<StaticHypergraphTypeTraits>(hypergraph, context, hierarchy);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::partition<LargeKHypergraphTypeTraits>(hypergraph, context, hierarchy);
+      #endif
+      default:
+        throw UnsupportedOperationException(
+          "Coarsening hierarchies are only supported for multilevel partitioning!");
+    }
+    return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  }
+
   void PartitionerFacade::improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                   Context& context,
                                   TargetGraph* target_graph) {
-    const mt_kahypar_partition_type_t type = to_partition_c_type(
-      context.partition.preset_type, context.partition.instance_type);
+    // The data structure of the partition determines the type traits, since
+    // the multilevel presets may use the sparse connectivity information
+    const mt_kahypar_partition_type_t type = partitioned_hg.type;
+    context.partition.partition_type = type;
     internal::check_if_feature_is_enabled(type);
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
@@ -158,6 +403,68 @@ namespace internal {
     }
   }
 
+  void PartitionerFacade::improveRegion(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                        Context& context,
+                                        const vec<HypernodeID>& region_nodes,
+                                        const HypernodeID radius) {
+    const mt_kahypar_partition_type_t type = partitioned_hg.type;
+    context.partition.partition_type = type;
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        internal::improveRegion<StaticGraphTypeTraits>(partitioned_hg, context, region_nodes, radius); break;
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        internal::improveRegion<StaticHypergraphTypeTraits>(partitioned_hg, context, region_nodes, radius); break;
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        internal::improveRegion<LargeKHypergraphTypeTraits>(partitioned_hg, context, region_nodes, radius); break;
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        internal::improveRegion<DynamicGraphTypeTraits>(partitioned_hg, context, region_nodes, radius); break;
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        internal::improveRegion<DynamicHypergraphTypeTraits>(partitioned_hg, context, region_nodes, radius); break;
+      #endif
+      default: break;
+    }
+  }
+
+  mt_kahypar_partitioned_hypergraph_t PartitionerFacade::repartition(mt_kahypar_hypergraph_t hypergraph,
+                                                                     Context& context,
+                                                                     const vec<PartitionID>& previous_partition,
+                                                                     const vec<HypernodeID>& touched_nodes) {
+    const mt_kahypar_partition_type_t type = partitionType(hypergraph, context);
+    context.partition.partition_type = type;
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::repartition<StaticGraphTypeTraits>(hypergraph, context, previous_partition, touched_nodes);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::repartition<StaticHypergraphTypeTraits>(hypergraph, context, previous_partition, touched_nodes);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::repartition<LargeKHypergraphTypeTraits>(hypergraph, context, previous_partition, touched_nodes);
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        return internal::repartition<DynamicGraphTypeTraits>(hypergraph, context, previous_partition, touched_nodes);
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::repartition<DynamicHypergraphTypeTraits>(hypergraph, context, previous_partition, touched_nodes);
+      #endif
+      default:
+        return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+    }
+    return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  }
+
   void PartitionerFacade::printPartitioningResults(const mt_kahypar_partitioned_hypergraph_t phg,
                                                    const Context& context,
                                                    const std::chrono::duration<double>& elapsed_seconds) {
@@ -219,6 +526,35 @@ namespace internal {
     return "";
   }
 
+  std::string PartitionerFacade::serializeJSON(const mt_kahypar_partitioned_hypergraph_t phg,
+                                               const Context& context,
+                                               const std::chrono::duration<double>& elapsed_seconds) {
+    const mt_kahypar_partition_type_t type = phg.type;
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<StaticPartitionedGraph>(phg), context, elapsed_seconds);
+        break;
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<StaticPartitionedHypergraph>(phg), context, elapsed_seconds);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return io::json::serialize(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), context, elapsed_seconds);
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<DynamicPartitionedGraph>(phg), context, elapsed_seconds);
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<DynamicPartitionedHypergraph>(phg), context, elapsed_seconds);
+      #endif
+      default: return "";
+    }
+    return "";
+  }
+
   std::string PartitionerFacade::serializeResultLine(const mt_kahypar_partitioned_hypergraph_t phg,
                                                      const Context& context,
                                                      const std::chrono::duration<double>& elapsed_seconds) {
@@ -248,30 +584,94 @@ namespace internal {
   }
 
   void PartitionerFacade::writePartitionFile(const mt_kahypar_partitioned_hypergraph_t phg,
-                                             const std::string& filename) {
+                                             const std::string& filename,
+                                             const bool binary) {
+    const mt_kahypar_partition_type_t type = phg.type;
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        io::writePartitionFile(utils::cast_const<StaticPartitionedGraph>(phg), filename, binary);
+        break;
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        io::writePartitionFile(utils::cast_const<StaticPartitionedHypergraph>(phg), filename, binary);
+        break;
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        io::writePartitionFile(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), filename, binary);
+        break;
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        io::writePartitionFile(utils::cast_const<DynamicPartitionedGraph>(phg), filename, binary);
+        break;
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        io::writePartitionFile(utils::cast_const<DynamicPartitionedHypergraph>(phg), filename, binary);
+        break;
+      #endif
+      default: break;
+    }
+  }
+
+  void PartitionerFacade::writeNestedPartitionFiles(const mt_kahypar_partitioned_hypergraph_t phg,
+                                                    const std::string& filename,
+                                                    const bool binary) {
+    const mt_kahypar_partition_type_t type = phg.type;
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        internal::writeNestedPartitionFiles(utils::cast_const<StaticPartitionedGraph>(phg), filename, binary);
+        break;
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        internal::writeNestedPartitionFiles(utils::cast_const<StaticPartitionedHypergraph>(phg), filename, binary);
+        break;
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        internal::writeNestedPartitionFiles(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), filename, binary);
+        break;
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        internal::writeNestedPartitionFiles(utils::cast_const<DynamicPartitionedGraph>(phg), filename, binary);
+        break;
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        internal::writeNestedPartitionFiles(utils::cast_const<DynamicPartitionedHypergraph>(phg), filename, binary);
+        break;
+      #endif
+      default: break;
+    }
+  }
+
+  void PartitionerFacade::writeBlockOrderingFile(const mt_kahypar_partitioned_hypergraph_t phg,
+                                                 const std::string& filename) {
     const mt_kahypar_partition_type_t type = phg.type;
     switch ( type ) {
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
       case MULTILEVEL_GRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<StaticPartitionedGraph>(phg), filename);
+        internal::writeBlockOrderingFile(utils::cast_const<StaticPartitionedGraph>(phg), filename);
         break;
       #endif
       case MULTILEVEL_HYPERGRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<StaticPartitionedHypergraph>(phg), filename);
+        internal::writeBlockOrderingFile(utils::cast_const<StaticPartitionedHypergraph>(phg), filename);
         break;
       #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
       case LARGE_K_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), filename);
+        internal::writeBlockOrderingFile(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), filename);
         break;
       #endif
       #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
       #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
       case N_LEVEL_GRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<DynamicPartitionedGraph>(phg), filename);
+        internal::writeBlockOrderingFile(utils::cast_const<DynamicPartitionedGraph>(phg), filename);
         break;
       #endif
       case N_LEVEL_HYPERGRAPH_PARTITIONING:
-        io::writePartitionFile(utils::cast_const<DynamicPartitionedHypergraph>(phg), filename);
+        internal::writeBlockOrderingFile(utils::cast_const<DynamicPartitionedHypergraph>(phg), filename);
         break;
       #endif
       default: break;
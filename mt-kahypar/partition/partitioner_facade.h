@@ -38,16 +38,56 @@ class TargetGraph;
 
 class PartitionerFacade {
  public:
+  // ! Returns the partition type (data structures) used to partition the hypergraph.
+  // ! Besides the preset and instance type, this depends on k and the net sizes, since
+  // ! the multilevel presets switch to the sparse connectivity information for hypergraphs
+  // ! with mostly small nets if k is large enough.
+  static mt_kahypar_partition_type_t partitionType(mt_kahypar_hypergraph_t hypergraph,
+                                                   const Context& context);
+
   // ! Partition the hypergraph into a predefined number of blocks
   static mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hypergraph,
                                                        Context& context,
                                                        TargetGraph* target_graph = nullptr);
 
+  // ! Computes the community structure and the multilevel hierarchy of the hypergraph once,
+  // ! such that it can be partitioned several times with different k and imbalance
+  static mt_kahypar_hierarchy_t coarsen(mt_kahypar_hypergraph_t hypergraph,
+                                        Context& context);
+
+  // ! Reads a coarsening hierarchy of the hypergraph from a file
+  static mt_kahypar_hierarchy_t readHierarchy(mt_kahypar_hypergraph_t hypergraph,
+                                              Context& context,
+                                              const std::string& filename);
+
+  // ! Writes the coarsening hierarchy to a file
+  static void writeHierarchy(const mt_kahypar_hierarchy_t hierarchy,
+                             const std::string& filename);
+
+  // ! Partition the hypergraph starting from a precomputed coarsening hierarchy
+  static mt_kahypar_partitioned_hypergraph_t partition(mt_kahypar_hypergraph_t hypergraph,
+                                                       Context& context,
+                                                       const mt_kahypar_hierarchy_t hierarchy);
+
   // ! Improves a given partition
   static void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                       Context& context,
                       TargetGraph* target_graph = nullptr);
 
+  // ! Projects the partition of a previous version of the hypergraph onto the given
+  // ! hypergraph and improves it locally around the touched nodes
+  static mt_kahypar_partitioned_hypergraph_t repartition(mt_kahypar_hypergraph_t hypergraph,
+                                                         Context& context,
+                                                         const vec<PartitionID>& previous_partition,
+                                                         const vec<HypernodeID>& touched_nodes);
+
+  // ! Improves the partition locally within the region around the given nodes
+  // ! (all other nodes are implicitly fixed)
+  static void improveRegion(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                            Context& context,
+                            const vec<HypernodeID>& region_nodes,
+                            const HypernodeID radius);
+
   // ! Prints timings and metrics to output
   static void printPartitioningResults(const mt_kahypar_partitioned_hypergraph_t phg,
                                        const Context& context,
@@ -58,6 +98,12 @@ class PartitionerFacade {
                                   const Context& context,
                                   const std::chrono::duration<double>& elapsed_seconds);
 
+  // ! Serializes the full timer hierarchy, all stats counters and the
+  // ! memory consumption of the partition as a JSON object
+  static std::string serializeJSON(const mt_kahypar_partitioned_hypergraph_t phg,
+                                   const Context& context,
+                                   const std::chrono::duration<double>& elapsed_seconds);
+
   // ! Prints timings and metrics as a RESULT line parsable by SQL Plot Tools
   // ! https://github.com/bingmann/sqlplot-tools
   static std::string serializeResultLine(const mt_kahypar_partitioned_hypergraph_t phg,
@@ -66,7 +112,20 @@ class PartitionerFacade {
 
   // ! Writes the partition to the corresponding file
   static void writePartitionFile(const mt_kahypar_partitioned_hypergraph_t phg,
-                                 const std::string& filename);
+                                 const std::string& filename,
+                                 const bool binary = false);
+
+  // ! Writes each nested partition with 2, 4, ..., 2^i < k blocks
+  // ! to the file <filename>.nested<2^i> (see nested_partitions.h)
+  static void writeNestedPartitionFiles(const mt_kahypar_partitioned_hypergraph_t phg,
+                                        const std::string& filename,
+                                        const bool binary = false);
+
+  // ! Writes the block ordering of the partition, i.e., a numbering of the nodes in
+  // ! which each block is contiguous, its halo nodes and the cut nets, to the file
+  // ! <filename>.ordering (see block_ordering.h)
+  static void writeBlockOrderingFile(const mt_kahypar_partitioned_hypergraph_t phg,
+                                     const std::string& filename);
 };
 
 }  // namespace mt_kahypar
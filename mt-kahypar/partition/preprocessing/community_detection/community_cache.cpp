@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/preprocessing/community_detection/community_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/hash.h"
+
+namespace mt_kahypar::community_detection {
+
+  namespace {
+    static constexpr char MAGIC[8] = { 'M', 'T', 'K', 'C', 'O', 'M', 'M', 'C' };
+    static constexpr uint32_t VERSION = 1;
+
+    struct Header {
+      char magic[8];
+      uint32_t version;
+      uint32_t id_width;
+      uint64_t fingerprint;
+      uint64_t parameter_hash;
+      uint64_t num_nodes;
+    };
+
+    uint64_t combine(const uint64_t left, const uint64_t right) {
+      return hashing::integer::combine64(left, hashing::integer::hash64(right));
+    }
+
+    uint64_t bits(const double value) {
+      uint64_t result = 0;
+      std::memcpy(&result, &value, sizeof(double));
+      return result;
+    }
+
+    std::string cacheFile(const std::string& directory, const uint64_t fp, const uint64_t parameter_hash) {
+      std::stringstream ss;
+      ss << directory << "/" << std::hex << fp << "_" << parameter_hash << ".community";
+      return ss.str();
+    }
+  }
+
+  template<typename Hypergraph>
+  uint64_t fingerprint(const Hypergraph& hypergraph) {
+    // The contributions of the nodes and edges are summed up, which makes
+    // the fingerprint independent of the order in which they are visited
+    tbb::enumerable_thread_specific<uint64_t> local_hash(0);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      local_hash.local() += combine(hashing::integer::hash64(hn), hypergraph.nodeWeight(hn));
+    });
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+      uint64_t hash = combine(hashing::integer::hash64(he), hypergraph.edgeWeight(he));
+      for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+        hash = combine(hash, pin);
+      }
+      local_hash.local() += hash;
+    });
+    uint64_t hash = local_hash.combine(std::plus<>());
+    hash = combine(hash, hypergraph.initialNumNodes());
+    hash = combine(hash, hypergraph.initialNumEdges());
+    hash = combine(hash, hypergraph.initialNumPins());
+    return hash;
+  }
+
+  uint64_t parameterHash(const Context& context) {
+    const CommunityDetectionParameters& params = context.preprocessing.community_detection;
+    uint64_t hash = VERSION;
+    hash = combine(hash, static_cast<uint64_t>(context.preprocessing.community_detection_algorithm));
+    hash = combine(hash, static_cast<uint64_t>(params.edge_weight_function));
+    hash = combine(hash, params.max_pass_iterations);
+    hash = combine(hash, bits(static_cast<double>(params.min_vertex_move_fraction)));
+    hash = combine(hash, params.vertex_degree_sampling_threshold);
+    hash = combine(hash, params.num_sub_rounds_deterministic);
+    hash = combine(hash, params.volume_update_sub_rounds);
+    hash = combine(hash, params.use_active_node_set);
+    hash = combine(hash, params.vertex_following);
+    hash = combine(hash, context.partition.deterministic);
+    hash = combine(hash, static_cast<uint64_t>(context.partition.seed));
+    hash = combine(hash, context.partition.ignore_hyperedge_size_threshold);
+    if ( context.preprocessing.community_detection_algorithm == CommunityDetectionAlgorithm::label_propagation ) {
+      // The cluster weights are bounded by the smallest maximum block weight
+      for ( const HypernodeWeight& weight : context.partition.max_part_weights ) {
+        hash = combine(hash, weight);
+      }
+    }
+    return hash;
+  }
+
+  template<typename Hypergraph>
+  bool loadCachedCommunities(Hypergraph& hypergraph, const Context& context) {
+    const uint64_t fp = fingerprint(hypergraph);
+    const uint64_t parameter_hash = parameterHash(context);
+    std::ifstream in(cacheFile(context.preprocessing.community_cache_dir, fp, parameter_hash), std::ios::binary);
+    if ( !in ) {
+      return false;
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    in.read(reinterpret_cast<char*>(&header), sizeof(Header));
+    if ( !in || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+         header.version != VERSION || header.id_width != sizeof(PartitionID) ||
+         header.fingerprint != fp || header.parameter_hash != parameter_hash ||
+         header.num_nodes != hypergraph.initialNumNodes() ) {
+      return false;
+    }
+    ds::Clustering communities(hypergraph.initialNumNodes());
+    in.read(reinterpret_cast<char*>(communities.data()), communities.size() * sizeof(PartitionID));
+    if ( !in ) {
+      return false;
+    }
+    hypergraph.setCommunityIDs(std::move(communities));
+    return true;
+  }
+
+  template<typename Hypergraph>
+  void cacheCommunities(const Hypergraph& hypergraph, const Context& context) {
+    const uint64_t fp = fingerprint(hypergraph);
+    const uint64_t parameter_hash = parameterHash(context);
+    ds::Clustering communities(hypergraph.initialNumNodes(), kInvalidPartition);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      communities[hn] = hypergraph.communityID(hn);
+    });
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.id_width = sizeof(PartitionID);
+    header.fingerprint = fp;
+    header.parameter_hash = parameter_hash;
+    header.num_nodes = hypergraph.initialNumNodes();
+
+    // Write to a temporary file first such that concurrent runs never read a partially written entry
+    const std::string filename = cacheFile(context.preprocessing.community_cache_dir, fp, parameter_hash);
+    const std::string tmp_filename = filename + ".tmp" + std::to_string(std::random_device()());
+    bool success = false;
+    {
+      std::ofstream out(tmp_filename, std::ios::binary);
+      out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+      out.write(reinterpret_cast<const char*>(communities.data()), communities.size() * sizeof(PartitionID));
+      success = static_cast<bool>(out);
+    }
+    success = success && std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+    if ( !success ) {
+      std::remove(tmp_filename.c_str());
+      if ( context.partition.verbose_output ) {
+        WARNING("Could not write communities to cache file" << filename);
+      }
+    }
+  }
+
+  namespace {
+  #define FINGERPRINT(X) uint64_t fingerprint(const X&)
+  #define LOAD_CACHED_COMMUNITIES(X) bool loadCachedCommunities(X&, const Context&)
+  #define CACHE_COMMUNITIES(X) void cacheCommunities(const X&, const Context&)
+  }
+
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(FINGERPRINT)
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(LOAD_CACHED_COMMUNITIES)
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(CACHE_COMMUNITIES)
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar::community_detection {
+  /**
+   * On-disk cache for the result of the community detection. The communities are stored in
+   * the directory specified by context.preprocessing.community_cache_dir under the fingerprint
+   * of the hypergraph and a hash of all parameters that influence the community detection.
+   * Repeated runs on the same instance load the communities instead of recomputing them.
+   */
+
+  // ! Content hash of a hypergraph (node weights, edge weights and pins of each edge)
+  template<typename Hypergraph>
+  uint64_t fingerprint(const Hypergraph& hypergraph);
+
+  // ! Hash of all parameters that influence the result of the community detection
+  uint64_t parameterHash(const Context& context);
+
+  // ! Sets the community IDs of the hypergraph if a valid cache entry exists.
+  // ! Returns false, if the entry does not exist or does not match the hypergraph.
+  template<typename Hypergraph>
+  bool loadCachedCommunities(Hypergraph& hypergraph, const Context& context);
+
+  // ! Writes the community IDs of the hypergraph to the cache
+  template<typename Hypergraph>
+  void cacheCommunities(const Hypergraph& hypergraph, const Context& context);
+}
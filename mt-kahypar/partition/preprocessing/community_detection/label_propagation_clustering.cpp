@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/preprocessing/community_detection/label_propagation_clustering.h"
+
+#include <algorithm>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/utils/randomize.h"
+
+namespace mt_kahypar::community_detection {
+
+  template<typename Hypergraph>
+  ds::Clustering run_label_propagation_clustering(const Hypergraph& hypergraph,
+                                                  const Context& context,
+                                                  bool disable_randomization) {
+    using RatingMap = ds::DynamicSparseMap<PartitionID, double>;
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HypernodeWeight max_cluster_weight = context.partition.max_part_weights.empty() ?
+      hypergraph.totalWeight() : *std::min_element(context.partition.max_part_weights.begin(),
+                                                   context.partition.max_part_weights.end());
+
+    ds::Clustering communities(num_nodes);
+    vec<CAtomic<HypernodeWeight>> cluster_weights(num_nodes);
+    vec<HypernodeID> nodes;
+    nodes.reserve(num_nodes);
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      nodes.push_back(hn);
+    }
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      communities[hn] = hn;
+      cluster_weights[hn].store(hypergraph.nodeIsEnabled(hn) ?
+        hypergraph.nodeWeight(hn) : 0, std::memory_order_relaxed);
+    });
+
+    tbb::enumerable_thread_specific<RatingMap> local_ratings;
+    for ( size_t round = 0; round < context.preprocessing.community_detection.max_pass_iterations; ++round ) {
+      if ( !disable_randomization ) {
+        utils::Randomize::instance().parallelShuffleVector(nodes, UL(0), nodes.size());
+      }
+
+      tbb::enumerable_thread_specific<size_t> local_number_of_nodes_moved(0);
+      auto moveNode = [&](const HypernodeID hn) {
+        RatingMap& ratings = local_ratings.local();
+        ratings.clear();
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+          const HypernodeID edge_size = hypergraph.edgeSize(he);
+          if ( edge_size > 1 && edge_size < context.partition.ignore_hyperedge_size_threshold ) {
+            const double score = static_cast<double>(hypergraph.edgeWeight(he)) / (edge_size - 1);
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              if ( pin != hn ) {
+                ratings[communities[pin]] += score;
+              }
+            }
+          }
+        }
+
+        // Select the most strongly connected cluster that does not become overweight
+        const PartitionID from = communities[hn];
+        const HypernodeWeight weight = hypergraph.nodeWeight(hn);
+        const double* from_rating = ratings.get_if_contained(from);
+        PartitionID to = from;
+        double best_rating = from_rating ? *from_rating : 0.0;
+        for ( const auto& entry : ratings ) {
+          if ( entry.key != from && entry.value > best_rating &&
+               cluster_weights[entry.key].load(std::memory_order_relaxed) + weight <= max_cluster_weight ) {
+            to = entry.key;
+            best_rating = entry.value;
+          }
+        }
+
+        if ( to != from ) {
+          if ( cluster_weights[to].add_fetch(weight, std::memory_order_relaxed) <= max_cluster_weight ) {
+            cluster_weights[from].sub_fetch(weight, std::memory_order_relaxed);
+            communities[hn] = to;
+            ++local_number_of_nodes_moved.local();
+          } else {
+            // An other thread moved a node into the target cluster concurrently
+            cluster_weights[to].sub_fetch(weight, std::memory_order_relaxed);
+          }
+        }
+      };
+
+      tbb::parallel_for(UL(0), nodes.size(), [&](const size_t i) { moveNode(nodes[i]); });
+
+      const size_t number_of_nodes_moved = local_number_of_nodes_moved.combine(std::plus<>());
+      if ( number_of_nodes_moved < context.preprocessing.community_detection.min_vertex_move_fraction * num_nodes ) {
+        break;
+      }
+    }
+
+    return communities;
+  }
+
+  namespace {
+  #define LABEL_PROPAGATION_CLUSTERING(X) ds::Clustering run_label_propagation_clustering(const X&, const Context&, bool)
+  }
+
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(LABEL_PROPAGATION_CLUSTERING)
+}
@@ -32,12 +32,13 @@
 #include "mt-kahypar/utils/floating_point_comparisons.h"
 #include "mt-kahypar/parallel/stl/thread_locals.h"
 
+#include <tbb/parallel_for_each.h>
 #include <tbb/parallel_reduce.h>
 #include <tbb/parallel_sort.h>
 
 namespace mt_kahypar::metrics {
-template<typename Hypergraph>
-double modularity(const Graph<Hypergraph>& graph, const ds::Clustering& communities) {
+template<typename GraphT>
+double modularity(const GraphT& graph, const ds::Clustering& communities) {
   ASSERT(graph.canBeUsed());
   ASSERT(graph.numNodes() == communities.size());
   vec<NodeID> nodes(graph.numNodes());
@@ -83,13 +84,15 @@ namespace {
 }
 
 INSTANTIATE_FUNC_WITH_HYPERGRAPHS(MODULARITY)
+template double modularity(const BipartiteGraphView<ds::StaticHypergraph>&, const ds::Clustering&);
 
 }
 
 namespace mt_kahypar::community_detection {
 
 template<class Hypergraph>
-bool ParallelLocalMovingModularity<Hypergraph>::localMoving(Graph<Hypergraph>& graph, ds::Clustering& communities) {
+template<typename GraphT>
+bool ParallelLocalMovingModularity<Hypergraph>::localMoving(GraphT& graph, ds::Clustering& communities) {
   ASSERT(graph.canBeUsed());
   _max_degree = graph.max_degree();
   _reciprocal_total_volume = 1.0 / graph.totalVolume();
@@ -116,6 +119,10 @@ bool ParallelLocalMovingModularity<Hypergraph>::localMoving(Graph<Hypergraph>& g
   // local moving
   bool clustering_changed = false;
   if ( graph.numArcs() > 0 ) {
+    if ( _context.preprocessing.community_detection.vertex_following && !_context.partition.deterministic ) {
+      clustering_changed |= vertexFollowing(graph, communities) > 0;
+    }
+
     size_t number_of_nodes_moved = graph.numNodes();
     for (size_t round = 0;
         number_of_nodes_moved >= _context.preprocessing.community_detection.min_vertex_move_fraction * graph.numNodes()
@@ -133,7 +140,8 @@ bool ParallelLocalMovingModularity<Hypergraph>::localMoving(Graph<Hypergraph>& g
 }
 
 template<class Hypergraph>
-size_t ParallelLocalMovingModularity<Hypergraph>::synchronousParallelRound(const Graph<Hypergraph>& graph, ds::Clustering& communities) {
+template<typename GraphT>
+size_t ParallelLocalMovingModularity<Hypergraph>::synchronousParallelRound(const GraphT& graph, ds::Clustering& communities) {
   if (graph.numNodes() < 200) {
     return sequentialRound(graph, communities);
   }
@@ -216,7 +224,8 @@ size_t ParallelLocalMovingModularity<Hypergraph>::synchronousParallelRound(const
 }
 
 template<class Hypergraph>
-size_t ParallelLocalMovingModularity<Hypergraph>::sequentialRound(const Graph<Hypergraph>& graph, ds::Clustering& communities) {
+template<typename GraphT>
+size_t ParallelLocalMovingModularity<Hypergraph>::sequentialRound(const GraphT& graph, ds::Clustering& communities) {
   size_t seed = prng();
   permutation.sequential_fallback(graph.numNodes(), seed);
   size_t num_moved = 0;
@@ -234,36 +243,119 @@ size_t ParallelLocalMovingModularity<Hypergraph>::sequentialRound(const Graph<Hy
 }
 
 template<class Hypergraph>
-size_t ParallelLocalMovingModularity<Hypergraph>::parallelNonDeterministicRound(const Graph<Hypergraph>& graph, ds::Clustering& communities) {
+template<typename GraphT>
+size_t ParallelLocalMovingModularity<Hypergraph>::vertexFollowing(const GraphT& graph, ds::Clustering& communities) {
+  // Nodes with only one neighbor are assigned to the community of their neighbor.
+  // If both endpoints of an arc have degree one, the node with the larger ID follows.
+  // Thus, the neighbor of a following node always remains in its own community.
+  tbb::enumerable_thread_specific<size_t> local_number_of_followers(0);
+  tbb::parallel_for(ID(0), static_cast<NodeID>(graph.numNodes()), [&](const NodeID u) {
+    if ( graph.degree(u) == 1 ) {
+      const NodeID v = graph.arcsOf(u).begin()->head;
+      if ( graph.degree(v) > 1 || v < u ) {
+        ASSERT(communities[v] == static_cast<PartitionID>(v));
+        const ArcWeight volU = graph.nodeVolume(u);
+        _cluster_volumes[v] += volU;
+        _cluster_volumes[u] -= volU;
+        communities[u] = v;
+        ++local_number_of_followers.local();
+      }
+    }
+  });
+  const size_t number_of_followers = local_number_of_followers.combine(std::plus<>());
+  DBG << "Vertex following assigned" << number_of_followers << "nodes to the community of their neighbor";
+  return number_of_followers;
+}
+
+template<class Hypergraph>
+template<typename GraphT>
+size_t ParallelLocalMovingModularity<Hypergraph>::parallelNonDeterministicRound(const GraphT& graph, ds::Clustering& communities) {
   auto& nodes = permutation.permutation;
   if ( !_disable_randomization ) {
     utils::Randomize::instance().parallelShuffleVector(nodes, UL(0), nodes.size());
   }
 
+#ifdef KAHYPAR_ENABLE_HEAVY_PREPROCESSING_ASSERTIONS
+  // the gain verification requires up-to-date cluster volumes
+  const bool buffer_volume_updates = false;
+#else
+  const bool buffer_volume_updates = _volume_update_sub_rounds > 1;
+#endif
+
   tbb::enumerable_thread_specific<size_t> local_number_of_nodes_moved(0);
   auto moveNode = [&](const NodeID u) {
     const ArcWeight volU = graph.nodeVolume(u);
     const PartitionID from = communities[u];
-    PartitionID best_cluster = computeMaxGainCluster(graph, communities, u);
+    ClearList& local = non_sampling_incident_cluster_weights.local();
+    if ( buffer_volume_updates && local.volume_deltas.size() < graph.numNodes() ) {
+      local.volume_deltas.resize(graph.numNodes(), 0.0);
+    }
+    PartitionID best_cluster = computeMaxGainCluster(graph, communities, u, local);
     if (best_cluster != from) {
-      _cluster_volumes[best_cluster] += volU;
-      _cluster_volumes[from] -= volU;
+      if ( buffer_volume_updates ) {
+        local.addVolumeDelta(best_cluster, volU);
+        local.addVolumeDelta(from, -volU);
+      } else {
+        _cluster_volumes[best_cluster] += volU;
+        _cluster_volumes[from] -= volU;
+      }
       communities[u] = best_cluster;
       ++local_number_of_nodes_moved.local();
+      if ( _use_active_node_set ) {
+        for ( const Arc& arc : graph.arcsOf(u) ) {
+          if ( _next_active.compare_and_set_to_true(arc.head) ) {
+            _next_active_nodes.push_back_buffered(arc.head);
+          }
+        }
+      }
     }
   };
 
 #ifdef KAHYPAR_ENABLE_HEAVY_PREPROCESSING_ASSERTIONS
   std::for_each(nodes.begin(), nodes.end(), moveNode);
 #else
-  tbb::parallel_for(UL(0), nodes.size(), [&](size_t i) { moveNode(nodes[i]); });
+  if ( buffer_volume_updates ) {
+    // Volume changes of large clusters are contention hotspots. Thus, each thread
+    // collects its volume changes and they are applied once per sub-round.
+    const size_t sub_round_size = parallel::chunking::idiv_ceil(nodes.size(), _volume_update_sub_rounds);
+    for ( size_t first = 0; first < nodes.size(); first += sub_round_size ) {
+      const size_t last = std::min(first + sub_round_size, nodes.size());
+      tbb::parallel_for(first, last, [&](size_t i) { moveNode(nodes[i]); });
+      applyLocalVolumeDeltas();
+    }
+  } else {
+    tbb::parallel_for(UL(0), nodes.size(), [&](size_t i) { moveNode(nodes[i]); });
+  }
 #endif
   size_t number_of_nodes_moved = local_number_of_nodes_moved.combine(std::plus<>());
+
+  if ( _use_active_node_set ) {
+    // The next round only visits the neighbors of the moved nodes
+    _next_active_nodes.finalize();
+    nodes.assign(_next_active_nodes.begin(), _next_active_nodes.end());
+    _next_active_nodes.clear();
+    _next_active.reset();
+  }
   return number_of_nodes_moved;
 }
 
 template<class Hypergraph>
-bool ParallelLocalMovingModularity<Hypergraph>::verifyGain(const Graph<Hypergraph>& graph, const ds::Clustering& communities, const NodeID u,
+void ParallelLocalMovingModularity<Hypergraph>::applyLocalVolumeDeltas() {
+  tbb::parallel_for_each(non_sampling_incident_cluster_weights.begin(),
+    non_sampling_incident_cluster_weights.end(), [&](ClearList& local) {
+    for ( const PartitionID c : local.changed_volumes ) {
+      if ( local.volume_deltas[c] != 0.0 ) {
+        _cluster_volumes[c] += local.volume_deltas[c];
+        local.volume_deltas[c] = 0.0;
+      }
+    }
+    local.changed_volumes.clear();
+  });
+}
+
+template<class Hypergraph>
+template<typename GraphT>
+bool ParallelLocalMovingModularity<Hypergraph>::verifyGain(const GraphT& graph, const ds::Clustering& communities, const NodeID u,
                                                            const PartitionID to, double gain, double weight_from, double weight_to) {
   if (_context.partition.deterministic) {
     // the check is omitted, since changing the cluster volumes breaks determinism
@@ -316,8 +408,9 @@ bool ParallelLocalMovingModularity<Hypergraph>::verifyGain(const Graph<Hypergrap
 }
 
 template<class Hypergraph>
+template<typename GraphT>
 std::pair<ArcWeight, ArcWeight> ParallelLocalMovingModularity<Hypergraph>::intraClusterWeightsAndSumOfSquaredClusterVolumes(
-        const Graph<Hypergraph>& graph, const ds::Clustering& communities) {
+        const GraphT& graph, const ds::Clustering& communities) {
   ArcWeight intraClusterWeights = 0;
   ArcWeight sumOfSquaredClusterVolumes = 0;
   vec<ArcWeight> cluster_volumes(graph.numNodes(), 0);
@@ -343,7 +436,8 @@ std::pair<ArcWeight, ArcWeight> ParallelLocalMovingModularity<Hypergraph>::intra
 }
 
 template<class Hypergraph>
-void ParallelLocalMovingModularity<Hypergraph>::initializeClusterVolumes(const Graph<Hypergraph>& graph, ds::Clustering& communities) {
+template<typename GraphT>
+void ParallelLocalMovingModularity<Hypergraph>::initializeClusterVolumes(const GraphT& graph, ds::Clustering& communities) {
   _reciprocal_total_volume = 1.0 / graph.totalVolume();
   _vol_multiplier_div_by_node_vol =  _reciprocal_total_volume;
   tbb::parallel_for(ID(0), static_cast<NodeID>(graph.numNodes()), [&](const NodeID u) {
@@ -371,6 +465,15 @@ ParallelLocalMovingModularity<Hypergraph>::~ParallelLocalMovingModularity() {
 */
 }
 
+namespace {
+#define LOCAL_MOVING_MODULARITY(X) bool ParallelLocalMovingModularity<X>::localMoving(Graph<X>&, ds::Clustering&)
+#define INITIALIZE_CLUSTER_VOLUMES(X) void ParallelLocalMovingModularity<X>::initializeClusterVolumes(const Graph<X>&, ds::Clustering&)
+}
+
 INSTANTIATE_CLASS_WITH_HYPERGRAPHS(ParallelLocalMovingModularity)
+INSTANTIATE_FUNC_WITH_HYPERGRAPHS(LOCAL_MOVING_MODULARITY)
+INSTANTIATE_FUNC_WITH_HYPERGRAPHS(INITIALIZE_CLUSTER_VOLUMES)
+template bool ParallelLocalMovingModularity<ds::StaticHypergraph>::localMoving(
+  BipartiteGraphView<ds::StaticHypergraph>&, ds::Clustering&);
 
 }
\ No newline at end of file
@@ -31,17 +31,19 @@
 
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/datastructures/buffered_vector.h"
+#include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/graph.h"
+#include "mt-kahypar/datastructures/bipartite_graph_view.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/reproducible_random.h"
 
 namespace mt_kahypar::metrics {
-  template<typename Hypergraph>
-  double modularity(const Graph<Hypergraph>& graph, const ds::Clustering& communities);
+  template<typename GraphT>
+  double modularity(const GraphT& graph, const ds::Clustering& communities);
 }
 
 namespace mt_kahypar::community_detection {
@@ -66,26 +68,49 @@ class ParallelLocalMovingModularity {
     non_sampling_incident_cluster_weights(numNodes),
     _disable_randomization(disable_randomization),
     prng(context.partition.seed),
+    _volume_update_sub_rounds(context.preprocessing.community_detection.volume_update_sub_rounds),
     volume_updates_to(0),
-    volume_updates_from(0) { }
+    volume_updates_from(0),
+    _use_active_node_set(context.preprocessing.community_detection.use_active_node_set),
+    _next_active(_use_active_node_set ? numNodes : 0),
+    _next_active_nodes(_use_active_node_set ? numNodes : 0) { }
 
   ~ParallelLocalMovingModularity();
 
-  bool localMoving(Graph<Hypergraph>& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  bool localMoving(GraphT& graph, ds::Clustering& communities);
 
  private:
-  size_t parallelNonDeterministicRound(const Graph<Hypergraph>& graph, ds::Clustering& communities);
-  size_t synchronousParallelRound(const Graph<Hypergraph>& graph, ds::Clustering& communities);
-  size_t sequentialRound(const Graph<Hypergraph>& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t parallelNonDeterministicRound(const GraphT& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t synchronousParallelRound(const GraphT& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t sequentialRound(const GraphT& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  size_t vertexFollowing(const GraphT& graph, ds::Clustering& communities);
+  void applyLocalVolumeDeltas();
 public:
   struct ClearList {
     vec<double> weights;
     vec<PartitionID> used;
+    // ! Gains of the clusters in used (contiguous for the argmax)
+    vec<double> gains;
+    // ! Volume changes of the moves of this thread that are not yet applied to
+    // ! the shared cluster volumes (only allocated if volume updates are buffered)
+    vec<ArcWeight> volume_deltas;
+    vec<PartitionID> changed_volumes;
     ClearList(size_t n) : weights(n) { }
+
+    void addVolumeDelta(const PartitionID c, const ArcWeight delta) {
+      if ( volume_deltas[c] == 0.0 ) changed_volumes.push_back(c);
+      volume_deltas[c] += delta;
+    }
   };
 
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool ratingsFitIntoSmallSparseMap(const Graph<Hypergraph>& graph,
+  template<typename GraphT>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool ratingsFitIntoSmallSparseMap(const GraphT& graph,
                                                                        const HypernodeID u)  {
     static constexpr size_t cache_efficient_map_size = CacheEfficientIncidentClusterWeights::MAP_SIZE / 3UL;
     return std::min(_vertex_degree_sampling_threshold, _max_degree) > cache_efficient_map_size &&
@@ -99,15 +124,18 @@ public:
 public:
 
   // ! Only for testing
-  void initializeClusterVolumes(const Graph<Hypergraph>& graph, ds::Clustering& communities);
+  template<typename GraphT>
+  void initializeClusterVolumes(const GraphT& graph, ds::Clustering& communities);
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const Graph<Hypergraph>& graph,
+  template<typename GraphT>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const GraphT& graph,
                                                                        const ds::Clustering& communities,
                                                                        const NodeID u) {
     return computeMaxGainCluster(graph, communities, u, non_sampling_incident_cluster_weights.local());
   }
 
-  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const Graph<Hypergraph>& graph,
+  template<typename GraphT>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID computeMaxGainCluster(const GraphT& graph,
                                                                        const ds::Clustering& communities,
                                                                        const NodeID u,
                                                                        ClearList& incident_cluster_weights) {
@@ -123,24 +151,39 @@ public:
       weights[cv] += arc.weight;
     }
 
-    const ArcWeight volume_from = _cluster_volumes[from].load(std::memory_order_relaxed);
+    const ArcWeight volume_from = clusterVolume(from, incident_cluster_weights);
     const ArcWeight volU = graph.nodeVolume(u);
     const ArcWeight weight_from = weights[from];
 
     const double volMultiplier = _vol_multiplier_div_by_node_vol * volU;
     double bestGain = weight_from - volMultiplier * (volume_from - volU);
     double best_weight_to = weight_from;
-    for (const auto to : used) {
+
+    // Gather the gains of all candidate clusters into a contiguous array and reset the
+    // weights. The argmax is then computed in a separate branch-free pass over that array.
+    auto& gains = incident_cluster_weights.gains;
+    const size_t num_candidates = used.size();
+    gains.resize(num_candidates);
+    for (size_t i = 0; i < num_candidates; ++i) {
+      const PartitionID to = used[i];
       // if from == to, we would have to remove volU from volume_to as well.
       // just skip it. it has (adjusted) gain zero.
-      if (from != to) {
-        double gain = modularityGain(weights[to], _cluster_volumes[to].load(std::memory_order_relaxed), volMultiplier);
-        if (gain > bestGain) {
-          bestCluster = to;
-          bestGain = gain;
-          best_weight_to = weights[to];
-        }
-      }
+      gains[i] = from != to ? modularityGain(weights[to], clusterVolume(to, incident_cluster_weights), volMultiplier) :
+                              std::numeric_limits<double>::lowest();
+    }
+    double maxGain = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < num_candidates; ++i) {
+      maxGain = std::max(maxGain, gains[i]);
+    }
+    if (maxGain > bestGain) {
+      // first candidate with maximum gain (same tie breaking as a single scan)
+      size_t i = 0;
+      while (gains[i] != maxGain) ++i;
+      bestCluster = used[i];
+      bestGain = maxGain;
+      best_weight_to = weights[bestCluster];
+    }
+    for (const auto to : used) {
       weights[to] = 0.0;
     }
     used.clear();
@@ -155,6 +198,13 @@ public:
 
 private: 
 
+  // ! Volume of cluster c including the pending volume changes of the calling thread
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE ArcWeight clusterVolume(const PartitionID c,
+                                                             const ClearList& local) const {
+    const ArcWeight volume = _cluster_volumes[c].load(std::memory_order_relaxed);
+    return local.volume_deltas.empty() ? volume : volume + local.volume_deltas[c];
+  }
+
   inline double modularityGain(const ArcWeight weight_to,
                                const ArcWeight volume_to,
                                const double multiplier) {
@@ -172,10 +222,12 @@ private:
   }
 
 
-  bool verifyGain(const Graph<Hypergraph>& graph, const ds::Clustering& communities, NodeID u, PartitionID to, double gain,
+  template<typename GraphT>
+  bool verifyGain(const GraphT& graph, const ds::Clustering& communities, NodeID u, PartitionID to, double gain,
                   double weight_from, double weight_to);
 
-  static std::pair<ArcWeight, ArcWeight> intraClusterWeightsAndSumOfSquaredClusterVolumes(const Graph<Hypergraph>& graph, const ds::Clustering& communities);
+  template<typename GraphT>
+  static std::pair<ArcWeight, ArcWeight> intraClusterWeightsAndSumOfSquaredClusterVolumes(const GraphT& graph, const ds::Clustering& communities);
 
   const Context& _context;
   size_t _max_degree;
@@ -189,6 +241,10 @@ private:
   utils::ParallelPermutation<HypernodeID> permutation;
   std::mt19937 prng;
 
+  // ! If greater than one, the volume changes of a non-deterministic round are
+  // ! collected thread-locally and applied after each of that many sub-rounds
+  const size_t _volume_update_sub_rounds;
+
   struct ClusterMove {
     PartitionID cluster;
     NodeID node;
@@ -197,5 +253,11 @@ private:
     }
   };
   ds::BufferedVector<ClusterMove> volume_updates_to, volume_updates_from;
+
+  // ! If true, a non-deterministic round only visits neighbors of nodes
+  // ! that moved in the previous round
+  const bool _use_active_node_set;
+  ds::ThreadSafeFastResetFlagArray<> _next_active;
+  ds::BufferedVector<NodeID> _next_active_nodes;
 };
 }
@@ -36,7 +36,9 @@ namespace mt_kahypar::community_detection {
   template<typename Hypergraph>
   ds::Clustering local_moving_contract_recurse(Graph<Hypergraph>& fine_graph,
                                                ParallelLocalMovingModularity<Hypergraph>& mlv,
-                                               const Context& context) {
+                                               const Context& context,
+                                               Graph<Hypergraph>* recycled_graph,
+                                               const bool is_coarse_graph) {
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("local_moving", "Local Moving");
     ds::Clustering communities(fine_graph.numNodes());
@@ -46,16 +48,22 @@ namespace mt_kahypar::community_detection {
     if (communities_changed) {
       timer.start_timer("contraction_cd", "Contraction");
       // Contract Communities
-      Graph<Hypergraph> coarse_graph = fine_graph.contract(communities, context.preprocessing.community_detection.low_memory_contraction);
+      const bool low_memory = context.preprocessing.community_detection.low_memory_contraction;
+      Graph<Hypergraph> coarse_graph = low_memory && recycled_graph ?
+        fine_graph.contract_low_memory(communities, *recycled_graph) :
+        fine_graph.contract(communities, low_memory);
       ASSERT(coarse_graph.totalVolume() == fine_graph.totalVolume());
       timer.stop_timer("contraction_cd");
 
-      // Recurse on contracted graph
-      ds::Clustering coarse_communities = local_moving_contract_recurse(coarse_graph, mlv, context);
+      // Recurse on contracted graph. If the fine graph is a coarse graph, it is
+      // no longer needed and the low memory contraction of the next level reuses
+      // its memory. The input graph belongs to the caller and is never recycled.
+      ds::Clustering coarse_communities = local_moving_contract_recurse(
+        coarse_graph, mlv, context, low_memory && is_coarse_graph ? &fine_graph : nullptr, true);
 
       timer.start_timer("project", "Project");
       // Prolong Clustering
-      tbb::parallel_for(UL(0), fine_graph.numNodes(), [&](const NodeID u) {
+      tbb::parallel_for(UL(0), communities.size(), [&](const NodeID u) {
         ASSERT(communities[u] < static_cast<PartitionID>(coarse_communities.size()));
         communities[u] = coarse_communities[communities[u]];
       });
@@ -74,11 +82,43 @@ namespace mt_kahypar::community_detection {
     return communities;
   }
 
+  template<typename Hypergraph>
+  ds::Clustering run_parallel_louvain(BipartiteGraphView<Hypergraph>& graph,
+                                      const Context& context,
+                                      bool disable_randomization) {
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    ParallelLocalMovingModularity<Hypergraph> mlv(context, graph.numNodes(), disable_randomization);
+    timer.start_timer("local_moving", "Local Moving");
+    ds::Clustering communities(graph.numNodes());
+    bool communities_changed = mlv.localMoving(graph, communities);
+    timer.stop_timer("local_moving");
+
+    if (communities_changed) {
+      timer.start_timer("contraction_cd", "Contraction");
+      // The view does not store any arcs => materialize the contracted graph
+      Graph<Hypergraph> coarse_graph = Graph<Hypergraph>::contract_low_memory(graph, communities);
+      timer.stop_timer("contraction_cd");
+
+      ds::Clustering coarse_communities = local_moving_contract_recurse<Hypergraph>(
+        coarse_graph, mlv, context, nullptr, true);
+
+      timer.start_timer("project", "Project");
+      tbb::parallel_for(UL(0), graph.numNodes(), [&](const NodeID u) {
+        ASSERT(communities[u] < static_cast<PartitionID>(coarse_communities.size()));
+        communities[u] = coarse_communities[communities[u]];
+      });
+      timer.stop_timer("project");
+    }
+
+    return communities;
+  }
+
   namespace {
-  #define LOCAL_MOVING(X) ds::Clustering local_moving_contract_recurse(Graph<X>&, ParallelLocalMovingModularity<X>&, const Context&)
+  #define LOCAL_MOVING(X) ds::Clustering local_moving_contract_recurse(Graph<X>&, ParallelLocalMovingModularity<X>&, const Context&, Graph<X>*, const bool)
   #define PARALLEL_LOUVAIN(X) ds::Clustering run_parallel_louvain(Graph<X>&, const Context&, bool)
   }
 
   INSTANTIATE_FUNC_WITH_HYPERGRAPHS(LOCAL_MOVING)
   INSTANTIATE_FUNC_WITH_HYPERGRAPHS(PARALLEL_LOUVAIN)
+  template ds::Clustering run_parallel_louvain(BipartiteGraphView<ds::StaticHypergraph>&, const Context&, bool);
 }
\ No newline at end of file
@@ -31,12 +31,25 @@
 #include "mt-kahypar/partition/preprocessing/community_detection/local_moving_modularity.h"
 
 namespace mt_kahypar::community_detection {
+  // ! With low memory contraction, the memory of recycled_graph (the graph one level
+  // ! above fine_graph, which is no longer needed) is reused for the contracted graph.
+  // ! Only graphs contracted by the louvain method itself (is_coarse_graph) are recycled,
+  // ! such that the input graph remains usable.
   template<typename Hypergraph>
   ds::Clustering local_moving_contract_recurse(Graph<Hypergraph>& fine_graph,
                                                ParallelLocalMovingModularity<Hypergraph>& mlv,
-                                               const Context& context);
+                                               const Context& context,
+                                               Graph<Hypergraph>* recycled_graph = nullptr,
+                                               const bool is_coarse_graph = false);
   template<typename Hypergraph>
   ds::Clustering run_parallel_louvain(Graph<Hypergraph>& graph,
                                       const Context& context,
                                       bool disable_randomization = false);
+
+  // ! Runs the Louvain method on the implicit bipartite graph representation of
+  // ! a hypergraph. The first level is contracted into an explicit graph.
+  template<typename Hypergraph>
+  ds::Clustering run_parallel_louvain(BipartiteGraphView<Hypergraph>& graph,
+                                      const Context& context,
+                                      bool disable_randomization = false);
 }
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Renumbers the nodes and nets of the input hypergraph such that nodes that share
+ * nets obtain close IDs. The order is computed with a Cuthill-McKee style breadth-first
+ * search that starts at nodes of small degree. Nets larger than the ignore hyperedge size
+ * threshold are not expanded, since they do not contribute to locality. Nets are numbered
+ * in the order in which the search visits them.
+ *
+ * All subsequent phases operate on the reordered hypergraph. The partition is projected
+ * back to the input hypergraph afterwards.
+ */
+template<typename TypeTraits>
+class NodeReordering {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using HyperedgeVector = vec<vec<HypernodeID>>;
+
+ public:
+  NodeReordering(const Context& context) :
+    _context(context),
+    _new_node_id() { }
+
+  NodeReordering(const NodeReordering&) = delete;
+  NodeReordering & operator= (const NodeReordering &) = delete;
+
+  NodeReordering(NodeReordering&&) = delete;
+  NodeReordering & operator= (NodeReordering &&) = delete;
+
+  // ! Computes a locality order and returns the hypergraph with nodes and nets renumbered
+  Hypergraph reorder(const Hypergraph& hypergraph) {
+    ASSERT(!hypergraph.hasFixedVertices());
+    vec<HyperedgeID> net_order;
+    _new_node_id = computeOrder(hypergraph,
+      _context.partition.ignore_hyperedge_size_threshold, &net_order);
+
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    HyperedgeVector edge_vector;
+    vec<HyperedgeWeight> edge_weights;
+    vec<HypernodeWeight> node_weights(num_nodes, 0);
+    tbb::parallel_invoke([&] {
+      for ( const HyperedgeID& he : net_order ) {
+        if constexpr ( Hypergraph::is_graph ) {
+          // Each undirected edge is represented by two directed edges
+          if ( hypergraph.edgeSource(he) > hypergraph.edgeTarget(he) ) {
+            continue;
+          }
+        }
+        edge_vector.emplace_back();
+        edge_vector.back().reserve(hypergraph.edgeSize(he));
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          edge_vector.back().push_back(_new_node_id[pin]);
+        }
+        edge_weights.push_back(hypergraph.edgeWeight(he));
+      }
+    }, [&] {
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID& hn) {
+        node_weights[_new_node_id[hn]] = hypergraph.nodeWeight(hn);
+      });
+    });
+
+    return Hypergraph::Factory::construct(num_nodes, edge_vector.size(), edge_vector,
+      edge_weights.data(), node_weights.data(),
+      _context.preprocessing.stable_construction_of_incident_edges);
+  }
+
+  // ! Projects the partition of the reordered hypergraph to the input hypergraph
+  void projectPartition(const PartitionedHypergraph& reordered_phg,
+                        PartitionedHypergraph& phg) const {
+    ASSERT(_new_node_id.size() == phg.initialNumNodes());
+    phg.initializePartition([&](const HypernodeID& hn) {
+      return reordered_phg.partID(_new_node_id[hn]);
+    });
+  }
+
+  /*!
+   * Returns the new ID of each node. If net_order is given, it stores the nets
+   * in the order in which they are visited (unvisited nets are appended).
+   */
+  static vec<HypernodeID> computeOrder(const Hypergraph& hypergraph,
+                                       const HypernodeID max_net_size,
+                                       vec<HyperedgeID>* net_order = nullptr) {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HyperedgeID num_edges = hypergraph.initialNumEdges();
+    vec<HypernodeID> start_nodes(num_nodes, 0);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID& hn) {
+      start_nodes[hn] = hn;
+    });
+    tbb::parallel_sort(start_nodes.begin(), start_nodes.end(),
+      [&](const HypernodeID& lhs, const HypernodeID& rhs) {
+        const HyperedgeID lhs_degree = hypergraph.nodeDegree(lhs);
+        const HyperedgeID rhs_degree = hypergraph.nodeDegree(rhs);
+        return lhs_degree < rhs_degree || ( lhs_degree == rhs_degree && lhs < rhs );
+      });
+
+    vec<HypernodeID> new_node_id(num_nodes, kInvalidHypernode);
+    vec<HypernodeID> order(num_nodes, kInvalidHypernode);
+    vec<bool> visited_net(num_edges, false);
+    if ( net_order ) {
+      net_order->clear();
+      net_order->reserve(num_edges);
+    }
+    HypernodeID next_id = 0;
+    HypernodeID head = 0;
+    for ( const HypernodeID& start : start_nodes ) {
+      if ( new_node_id[start] != kInvalidHypernode ) {
+        continue;
+      }
+      new_node_id[start] = next_id;
+      order[next_id++] = start;
+      // Breadth-first search
+      while ( head < next_id ) {
+        const HypernodeID u = order[head++];
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+          if ( visited_net[he] ) {
+            continue;
+          }
+          visited_net[he] = true;
+          if ( net_order ) {
+            net_order->push_back(he);
+          }
+          if ( hypergraph.edgeSize(he) > max_net_size ) {
+            continue;
+          }
+          for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+            if ( new_node_id[pin] == kInvalidHypernode ) {
+              new_node_id[pin] = next_id;
+              order[next_id++] = pin;
+            }
+          }
+        }
+      }
+    }
+    ASSERT(next_id == num_nodes);
+
+    if ( net_order ) {
+      for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+        if ( !visited_net[he] ) {
+          net_order->push_back(he);
+        }
+      }
+    }
+    return new_node_id;
+  }
+
+ private:
+  const Context& _context;
+  vec<HypernodeID> _new_node_id;
+};
+
+}  // namespace mt_kahypar
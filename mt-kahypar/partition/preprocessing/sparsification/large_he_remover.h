@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/datastructures/streaming_vector.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -49,19 +52,30 @@ class LargeHyperedgeRemover {
   LargeHyperedgeRemover(LargeHyperedgeRemover&&) = delete;
   LargeHyperedgeRemover & operator= (LargeHyperedgeRemover &&) = delete;
 
-  // ! Removes large hyperedges from the hypergraph
+  // ! Removes large hyperedges from the hypergraph, if enabled.
   // ! Returns the number of removed large hyperedges.
   HypernodeID removeLargeHyperedges(Hypergraph& hypergraph) {
     HypernodeID num_removed_large_hyperedges = 0;
     if constexpr ( !Hypergraph::is_graph ) {
-      for ( const HyperedgeID& he : hypergraph.edges() ) {
-        if ( hypergraph.edgeSize(he) > largeHyperedgeThreshold() ) {
+      if ( _context.partition.remove_large_hyperedges ) {
+        const HypernodeID threshold = largeHyperedgeThreshold();
+        ds::StreamingVector<HyperedgeID> large_hyperedges;
+        hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+          if ( hypergraph.edgeSize(he) > threshold ) {
+            large_hyperedges.stream(he);
+          }
+        });
+        large_hyperedges.copy_parallel(_removed_hes);
+
+        // Removing a hyperedge modifies the incident nets of its pins. Therefore, we remove
+        // them one after another (each in parallel) and restore them in reverse order.
+        tbb::parallel_sort(_removed_hes.begin(), _removed_hes.end());
+        for ( const HyperedgeID& he : _removed_hes ) {
           hypergraph.removeLargeEdge(he);
-          _removed_hes.push_back(he);
-          ++num_removed_large_hyperedges;
         }
+        std::reverse(_removed_hes.begin(), _removed_hes.end());
+        num_removed_large_hyperedges = _removed_hes.size();
       }
-      std::reverse(_removed_hes.begin(), _removed_hes.end());
     }
     return num_removed_large_hyperedges;
   }
@@ -104,7 +118,7 @@ class LargeHyperedgeRemover {
 
  private:
   const Context& _context;
-  parallel::scalable_vector<HypernodeID> _removed_hes;
+  parallel::scalable_vector<HyperedgeID> _removed_hes;
 };
 
 }  // namespace mt_kahypar
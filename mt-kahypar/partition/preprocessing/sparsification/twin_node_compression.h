@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/hash.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Contracts twins (nodes with exactly the same set of incident nets) into
+ * weighted super-nodes before the multilevel partitioner runs. Twins are
+ * detected in parallel by sorting the nodes by a commutative fingerprint of
+ * their incident nets and comparing the net sets of nodes with equal fingerprints.
+ * Placing twins in the same block never increases the objective, so each
+ * partition of the compressed hypergraph is expanded to a partition of the
+ * input hypergraph with the same objective. The weight of a super-node is
+ * bounded by the maximum allowed node weight of the coarsening phase.
+ *
+ * Twin compression is only supported for static hypergraphs.
+ */
+template<typename TypeTraits>
+class TwinNodeCompression {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+  struct Fingerprint {
+    HyperedgeID degree;
+    uint64_t hash;
+    HypernodeID hn;
+
+    bool sameKey(const Fingerprint& other) const {
+      return degree == other.degree && hash == other.hash;
+    }
+
+    bool operator< (const Fingerprint& other) const {
+      return degree < other.degree || ( degree == other.degree &&
+        ( hash < other.hash || ( hash == other.hash && hn < other.hn ) ) );
+    }
+  };
+
+ public:
+  static constexpr bool is_supported = Hypergraph::is_static_hypergraph && !Hypergraph::is_graph;
+
+  TwinNodeCompression(const Context& context) :
+    _context(context),
+    _mapping(),
+    _num_removed_nodes(0) { }
+
+  TwinNodeCompression(const TwinNodeCompression&) = delete;
+  TwinNodeCompression & operator= (const TwinNodeCompression &) = delete;
+
+  TwinNodeCompression(TwinNodeCompression&&) = delete;
+  TwinNodeCompression & operator= (TwinNodeCompression &&) = delete;
+
+  // ! Returns the hypergraph in which each group of twins is contracted into a single node
+  Hypergraph compress(Hypergraph& hypergraph) {
+    ASSERT(!hypergraph.hasFixedVertices());
+    if constexpr ( is_supported ) {
+      _mapping = computeTwinMapping(hypergraph,
+        _context.coarsening.max_allowed_node_weight);
+      Hypergraph compressed_hypergraph =
+        hypergraph.contract(_mapping, _context.partition.deterministic);
+      _num_removed_nodes = hypergraph.initialNumNodes() - compressed_hypergraph.initialNumNodes();
+      return compressed_hypergraph;
+    } else {
+      throw UnsupportedOperationException(
+        "Twin node compression is only supported for static hypergraphs");
+    }
+  }
+
+  // ! Expands the partition of the compressed hypergraph to the input hypergraph
+  void projectPartition(const PartitionedHypergraph& compressed_phg,
+                        PartitionedHypergraph& phg) const {
+    ASSERT(_mapping.size() == phg.initialNumNodes());
+    phg.initializePartition([&](const HypernodeID& hn) {
+      return compressed_phg.partID(_mapping[hn]);
+    });
+  }
+
+  HypernodeID numRemovedNodes() const {
+    return _num_removed_nodes;
+  }
+
+  /*!
+   * Returns for each node the ID of its representative. All twins with the same
+   * representative have exactly the same incident nets and their accumulated weight
+   * is at most max_node_weight. Degree-zero nodes are not compressed (they are
+   * handled by the DegreeZeroHypernodeRemover).
+   */
+  static parallel::scalable_vector<HypernodeID> computeTwinMapping(const Hypergraph& hypergraph,
+                                                                   const HypernodeWeight max_node_weight) {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    parallel::scalable_vector<HypernodeID> mapping(num_nodes, kInvalidHypernode);
+    vec<Fingerprint> fingerprints(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID& hn) {
+      mapping[hn] = hn;
+      // The sum of the hashes is independent of the order of the incident nets
+      uint64_t hash = 0;
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        hash += hashing::integer::hash64(he);
+      }
+      fingerprints[hn] = Fingerprint { hypergraph.nodeDegree(hn), hash, hn };
+    });
+    tbb::parallel_sort(fingerprints.begin(), fingerprints.end());
+
+    // Each group of nodes with the same fingerprint is processed by one task
+    tbb::parallel_for(UL(0), fingerprints.size(), [&](const size_t start) {
+      if ( fingerprints[start].degree == 0 ||
+           ( start > 0 && fingerprints[start - 1].sameKey(fingerprints[start]) ) ) {
+        return;
+      }
+      size_t end = start + 1;
+      while ( end < fingerprints.size() && fingerprints[end].sameKey(fingerprints[start]) ) {
+        ++end;
+      }
+      if ( end - start == 1 ) {
+        return;
+      }
+
+      // Nodes with equal fingerprints are compared with the representatives
+      // of the group found so far (collisions are rare, so this list is short)
+      vec<vec<HyperedgeID>> incident_nets(end - start);
+      vec<size_t> representatives;
+      vec<HypernodeWeight> representative_weights;
+      for ( size_t i = start; i < end; ++i ) {
+        const HypernodeID hn = fingerprints[i].hn;
+        vec<HyperedgeID>& nets = incident_nets[i - start];
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+          nets.push_back(he);
+        }
+        std::sort(nets.begin(), nets.end());
+
+        bool is_twin = false;
+        for ( size_t j = 0; j < representatives.size(); ++j ) {
+          const size_t rep = representatives[j];
+          if ( representative_weights[j] + hypergraph.nodeWeight(hn) <= max_node_weight &&
+               incident_nets[rep - start] == nets ) {
+            mapping[hn] = fingerprints[rep].hn;
+            representative_weights[j] += hypergraph.nodeWeight(hn);
+            is_twin = true;
+            break;
+          }
+        }
+        if ( !is_twin ) {
+          representatives.push_back(i);
+          representative_weights.push_back(hypergraph.nodeWeight(hn));
+        }
+      }
+    });
+    return mapping;
+  }
+
+ private:
+  const Context& _context;
+  parallel::scalable_vector<HypernodeID> _mapping;
+  HypernodeID _num_removed_nodes;
+};
+
+}  // namespace mt_kahypar
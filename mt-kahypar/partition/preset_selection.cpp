@@ -0,0 +1,185 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/preset_selection.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar::preset_selection {
+
+namespace {
+
+  // Presets that partition into at least that many blocks use the large k configuration
+  static constexpr PartitionID LARGE_K = 1024;
+  // Coarsening stops at contraction_limit_multiplier * k nodes (160 in all presets).
+  // If the input is not much larger, direct k-way coarsening has little to do.
+  static constexpr HypernodeID NODES_PER_BLOCK_FOR_DIRECT_MODE = 2 * 160;
+  // Without a time limit, the quality preset is used for inputs up to this size
+  // (and for mesh graphs up to MAX_PINS_FOR_N_LEVEL pins)
+  static constexpr size_t MAX_PINS_FOR_QUALITY = 10000000;
+  // The n-level hierarchy and the flow networks need too much memory for larger inputs
+  static constexpr size_t MAX_PINS_FOR_N_LEVEL = 100000000;
+  // Fraction of hyperedges with more than LARGE_EDGE_SIZE pins for which n-level
+  // coarsening and flow-based refinement become too expensive
+  static constexpr double MAX_LARGE_EDGE_FRACTION_FOR_N_LEVEL = 0.01;
+  // The time limit should leave some slack for the inaccuracy of the estimation
+  static constexpr double TIME_LIMIT_SLACK = 0.5;
+
+  // Running time of the default preset per pin and recursion level on a single thread
+  static constexpr double SECONDS_PER_PIN_AND_LEVEL = 4e-7;
+  // Parallel efficiency that is assumed for the estimation
+  static constexpr double PARALLEL_EFFICIENCY = 0.6;
+
+  double relativeRunningTime(const PresetType preset) {
+    switch ( preset ) {
+      case PresetType::large_k: return 0.5;
+      case PresetType::deterministic: return 1.0;
+      case PresetType::default_preset: return 1.0;
+      case PresetType::quality: return 1.5;
+      case PresetType::highest_quality: return 3.0;
+      case PresetType::automatic:
+      case PresetType::UNDEFINED: return 1.0;
+    }
+    return 1.0;
+  }
+
+  bool isNLevelAvailable(const InstanceType instance_type) {
+    if ( instance_type == InstanceType::graph ) {
+      ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(return true;)
+      return false;
+    }
+    ENABLE_HIGHEST_QUALITY(return true;)
+    return false;
+  }
+
+  template<typename T>
+  std::string str(const T& value) {
+    std::stringstream ss;
+    ss << value;
+    return ss.str();
+  }
+
+}  // namespace
+
+double estimatedRunningTime(const InstanceStatistics& stats,
+                            const PresetType preset,
+                            const PartitionID k,
+                            const size_t num_threads) {
+  const double levels = std::max(1.0, std::log2(static_cast<double>(std::max(k, 2))));
+  const double threads = std::max(1.0, PARALLEL_EFFICIENCY * num_threads);
+  return relativeRunningTime(preset) * SECONDS_PER_PIN_AND_LEVEL *
+    (static_cast<double>(stats.num_pins) + stats.num_nodes) * levels / threads;
+}
+
+PresetSelection select(const InstanceStatistics& stats,
+                       const Context& context,
+                       const bool allow_instance_type_change) {
+  PresetSelection selection;
+  const PartitionID k = context.partition.k;
+  const double time_limit = context.partition.time_limit;
+  const size_t num_threads = context.shared_memory.num_threads;
+
+  // Instance type
+  selection.instance_type = context.partition.instance_type;
+  if ( stats.is_graph && selection.instance_type == InstanceType::hypergraph &&
+       allow_instance_type_change ) {
+    ENABLE_GRAPHS(
+      selection.instance_type = InstanceType::graph;
+      selection.reasons.push_back("all nets have two pins => graph data structures");
+    )
+  }
+  if ( stats.is_mesh_graph ) {
+    selection.reasons.push_back("mesh-like graph (uniform node degrees)");
+  }
+
+  // Mode
+  const bool few_nodes_per_block = stats.num_nodes < NODES_PER_BLOCK_FOR_DIRECT_MODE * static_cast<HypernodeID>(k);
+  if ( context.partition.mode != Mode::UNDEFINED ) {
+    selection.mode = context.partition.mode;
+  } else if ( k >= LARGE_K || few_nodes_per_block ) {
+    selection.mode = Mode::deep_multilevel;
+    selection.reasons.push_back(( k >= LARGE_K ? "k = " + str(k) + " >= " + str(LARGE_K) :
+      "n = " + str(stats.num_nodes) + " < " + str(NODES_PER_BLOCK_FOR_DIRECT_MODE) + " * k" ) +
+      " => deep multilevel mode");
+  } else {
+    selection.mode = Mode::direct;
+  }
+
+  // Preset
+  #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+  if ( k >= LARGE_K ) {
+    selection.preset = PresetType::large_k;
+    selection.reasons.push_back("k = " + str(k) + " >= " + str(LARGE_K) + " => large_k");
+    return selection;
+  }
+  #endif
+
+  auto fits_time_limit = [&](const PresetType preset) {
+    return time_limit > 0 && estimatedRunningTime(stats, preset, k, num_threads) <=
+      TIME_LIMIT_SLACK * time_limit;
+  };
+  const double large_edge_fraction = stats.num_edges > 0 ?
+    static_cast<double>(stats.num_large_edges) / stats.num_edges : 0.0;
+  const bool highest_quality_is_candidate = time_limit > 0 &&
+    isNLevelAvailable(selection.instance_type) && selection.mode == Mode::direct &&
+    stats.num_pins <= MAX_PINS_FOR_N_LEVEL && fits_time_limit(PresetType::highest_quality);
+  const bool has_too_many_large_edges = large_edge_fraction > MAX_LARGE_EDGE_FRACTION_FOR_N_LEVEL;
+  if ( highest_quality_is_candidate && !has_too_many_large_edges ) {
+    selection.preset = PresetType::highest_quality;
+    selection.reasons.push_back("estimated running time of highest_quality fits into the time limit of " +
+      str(time_limit) + "s");
+  } else if ( ( time_limit > 0 && fits_time_limit(PresetType::quality) ) ||
+              ( time_limit == 0 && ( stats.num_pins <= MAX_PINS_FOR_QUALITY ||
+                ( stats.is_mesh_graph && stats.num_pins <= MAX_PINS_FOR_N_LEVEL ) ) ) ) {
+    selection.preset = PresetType::quality;
+    if ( time_limit > 0 ) {
+      selection.reasons.push_back("estimated running time of quality fits into the time limit of " +
+        str(time_limit) + "s");
+    } else {
+      selection.reasons.push_back("pins = " + str(stats.num_pins) + " => quality is affordable "
+        "(highest_quality is only selected with a time limit)");
+    }
+  } else {
+    selection.preset = PresetType::default_preset;
+    if ( time_limit > 0 ) {
+      selection.reasons.push_back("estimated running time of quality exceeds the time limit of " +
+        str(time_limit) + "s => default");
+    } else {
+      selection.reasons.push_back("pins = " + str(stats.num_pins) + " > " +
+        str(MAX_PINS_FOR_QUALITY) + " => default");
+    }
+  }
+  if ( highest_quality_is_candidate && has_too_many_large_edges ) {
+    selection.reasons.push_back(str(stats.num_large_edges) + " nets with more than " +
+      str(LARGE_EDGE_SIZE) + " pins => no n-level coarsening");
+  }
+  return selection;
+}
+
+}  // namespace mt_kahypar::preset_selection
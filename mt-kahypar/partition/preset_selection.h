@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/utils/hypergraph_statistics.h"
+
+namespace mt_kahypar {
+
+// ! Cheap statistics of the input that are used to select a preset
+struct InstanceStatistics {
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_edges = 0;
+  size_t num_pins = 0;
+  HypernodeID max_edge_size = 0;
+  double avg_edge_size = 0.0;
+  // ! Number of hyperedges with more than LARGE_EDGE_SIZE pins
+  HyperedgeID num_large_edges = 0;
+  bool is_graph = false;
+  bool is_mesh_graph = false;
+};
+
+// ! Preset, mode and instance type selected for an input and the reasons for the decision
+struct PresetSelection {
+  PresetType preset = PresetType::UNDEFINED;
+  Mode mode = Mode::UNDEFINED;
+  InstanceType instance_type = InstanceType::UNDEFINED;
+  std::vector<std::string> reasons;
+};
+
+namespace preset_selection {
+
+static constexpr HypernodeID LARGE_EDGE_SIZE = 1000;
+
+template<typename Hypergraph>
+InstanceStatistics computeStatistics(const Hypergraph& hypergraph) {
+  InstanceStatistics stats;
+  stats.num_nodes = hypergraph.initialNumNodes();
+  stats.num_edges = hypergraph.initialNumEdges();
+  stats.num_pins = hypergraph.initialNumPins();
+  stats.max_edge_size = hypergraph.maxEdgeSize();
+  stats.avg_edge_size = stats.num_edges > 0 ? utils::avgHyperedgeDegree(hypergraph) : 0.0;
+  if ( !Hypergraph::is_graph && stats.max_edge_size > LARGE_EDGE_SIZE ) {
+    stats.num_large_edges = tbb::parallel_reduce(tbb::blocked_range<HyperedgeID>(
+      ID(0), hypergraph.initialNumEdges()), ID(0),
+      [&](const tbb::blocked_range<HyperedgeID>& range, HyperedgeID num_large_edges) {
+        for ( HyperedgeID he = range.begin(); he < range.end(); ++he ) {
+          if ( hypergraph.edgeIsEnabled(he) && hypergraph.edgeSize(he) > LARGE_EDGE_SIZE ) {
+            ++num_large_edges;
+          }
+        }
+        return num_large_edges;
+      }, std::plus<>());
+  }
+  stats.is_graph = stats.num_edges > 0 && utils::isGraph(hypergraph);
+  stats.is_mesh_graph = stats.is_graph && stats.num_nodes > 1 && utils::isMeshGraph(hypergraph);
+  return stats;
+}
+
+// ! Rough estimate of the running time (in seconds) of a preset
+double estimatedRunningTime(const InstanceStatistics& stats,
+                            const PresetType preset,
+                            const PartitionID k,
+                            const size_t num_threads);
+
+// ! Selects the preset, mode and instance type for an input based on its statistics,
+// ! k and the time limit of the context. A mode set in the context is kept. The instance
+// ! type is changed to graph for hypergraphs with only two-pin nets, if allowed.
+PresetSelection select(const InstanceStatistics& stats,
+                       const Context& context,
+                       const bool allow_instance_type_change);
+
+}  // namespace preset_selection
+}  // namespace mt_kahypar
@@ -180,6 +180,16 @@ namespace rb {
     return rb_context;
   }
 
+  // Estimates the fraction of the available threads required by the recursion on the
+  // first block, based on its share of the total weight of both blocks
+  double subproblemShare(const HypernodeWeight weight_0, const HypernodeWeight weight_1,
+                         const PartitionID k0, const PartitionID k1) {
+    const double total_weight = static_cast<double>(weight_0) + weight_1;
+    const double share = total_weight > 0 ?
+      weight_0 / total_weight : static_cast<double>(k0) / (k0 + k1);
+    return std::min(std::max(share, 0.05), 0.95);
+  }
+
   template<typename Hypergraph>
   void setupFixedVerticesForBipartitioning(Hypergraph& hg,
                                            const PartitionID k) {
@@ -312,10 +322,26 @@ namespace rb {
         DBG << "Current k = " << context.partition.k << "\n"
             << "Block" << block_0 << "is further partitioned into k =" << rb_k0 << "blocks\n"
             << "Block" << block_1 << "is further partitioned into k =" << rb_k1 << "blocks\n";
+        // Both recursive calls share the task arena of the caller. Threads that finish
+        // the smaller subproblem steal work from the larger one, so the split below only
+        // estimates the share of the threads each recursion is expected to occupy.
+        const double share_0 = subproblemShare(phg.partWeight(block_0), phg.partWeight(block_1), rb_k0, rb_k1);
+        auto recurse_0 = [&] {
+          recursively_bipartition_block<TypeTraits>(phg, context, block_0, 0, rb_k0, info, already_cut, share_0);
+        };
+        auto recurse_1 = [&] {
+          recursively_bipartition_block<TypeTraits>(phg, context, block_1, rb_k0, rb_k0 + rb_k1, info, already_cut, 1.0 - share_0);
+        };
+        // The smaller subproblem is spawned as a stealable task, while the calling thread
+        // continues with the larger one and afterwards helps with the remaining work.
         tbb::task_group tg;
-        tg.run([&] { recursively_bipartition_block<TypeTraits>(phg, context, block_0, 0, rb_k0, info, already_cut, 0.5); });
-        tg.run([&] { recursively_bipartition_block<TypeTraits>(phg, context, block_1, rb_k0, rb_k0 + rb_k1, info, already_cut, 0.5); });
-        tg.wait();
+        if ( share_0 >= 0.5 ) {
+          tg.run(recurse_1);
+          tg.run_and_wait(recurse_0);
+        } else {
+          tg.run(recurse_0);
+          tg.run_and_wait(recurse_1);
+        }
       } else if ( rb_k0 >= 2 ) {
         ASSERT(rb_k1 < 2);
         // Only the first block needs to be further partitioned into at least two blocks.
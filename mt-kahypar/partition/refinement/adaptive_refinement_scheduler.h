@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+
+namespace mt_kahypar {
+
+enum class RefinerType : uint8_t {
+  label_propagation,
+  jet,
+  fm,
+  flows,
+  NUM_REFINER_TYPES
+};
+
+/**
+ * Decides on each level of the multilevel hierarchy which refinement algorithms
+ * are executed. For each refiner, we measure the improvement of the objective
+ * function per second on the levels processed so far. A refiner is skipped on
+ * the current level if its yield is below a fraction of the average yield of all
+ * refiners. Skipped refiners are executed again after a few levels to adapt
+ * to changes of their yield. If adaptive refinement is disabled, all refiners
+ * are executed on each level.
+ */
+class AdaptiveRefinementScheduler {
+
+  static constexpr bool debug = false;
+
+  // ! Number of levels on which a refiner is executed before it can be skipped
+  static constexpr size_t MIN_MEASUREMENTS = 2;
+  // ! A skipped refiner is executed again after this number of skipped levels
+  static constexpr size_t PROBING_INTERVAL = 4;
+
+  static constexpr size_t NUM_REFINERS = static_cast<size_t>(RefinerType::NUM_REFINER_TYPES);
+
+  struct RefinerStatistics {
+    HyperedgeWeight improvement = 0;
+    double time = 0.0;
+    size_t num_measurements = 0;
+    size_t num_skipped_levels = 0;
+    bool run_on_current_level = true;
+  };
+
+ public:
+  explicit AdaptiveRefinementScheduler(const RefinementParameters& params) :
+    _enabled(params.adaptive_refinement),
+    _min_yield(params.adaptive_refinement_min_yield),
+    _stats() { }
+
+  // ! Decides which refiners are executed on the next level
+  void nextLevel() {
+    if ( !_enabled ) return;
+    const double average_yield = yield(totalImprovement(), totalTime());
+    for ( size_t i = 0; i < NUM_REFINERS; ++i ) {
+      RefinerStatistics& stats = _stats[i];
+      const bool poor_yield = stats.num_measurements >= MIN_MEASUREMENTS &&
+        yield(stats.improvement, stats.time) < _min_yield * average_yield;
+      if ( poor_yield && stats.num_skipped_levels < PROBING_INTERVAL ) {
+        stats.run_on_current_level = false;
+        ++stats.num_skipped_levels;
+      } else {
+        stats.run_on_current_level = true;
+        stats.num_skipped_levels = 0;
+      }
+      DBG << "Refiner" << i << ": yield =" << yield(stats.improvement, stats.time)
+          << "(average =" << average_yield << ") run =" << stats.run_on_current_level;
+    }
+  }
+
+  bool shouldRun(const RefinerType type) const {
+    return _stats[index(type)].run_on_current_level;
+  }
+
+  // ! Executes the refiner if it is scheduled on the current level and measures
+  // ! its improvement of the objective function as well as its running time.
+  template<typename F>
+  bool run(const RefinerType type, const Metrics& metrics, const F& refine) {
+    if ( !shouldRun(type) ) {
+      return false;
+    }
+    const HyperedgeWeight quality_before = metrics.quality;
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    const bool improved = refine();
+    const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    RefinerStatistics& stats = _stats[index(type)];
+    stats.improvement += quality_before - metrics.quality;
+    stats.time += std::chrono::duration<double>(end - start).count();
+    ++stats.num_measurements;
+    return improved;
+  }
+
+ private:
+  static size_t index(const RefinerType type) {
+    return static_cast<size_t>(type);
+  }
+
+  static double yield(const HyperedgeWeight improvement, const double time) {
+    return time > 0.0 ? static_cast<double>(improvement) / time : 0.0;
+  }
+
+  HyperedgeWeight totalImprovement() const {
+    HyperedgeWeight improvement = 0;
+    for ( const RefinerStatistics& stats : _stats ) {
+      improvement += stats.improvement;
+    }
+    return improvement;
+  }
+
+  double totalTime() const {
+    double time = 0.0;
+    for ( const RefinerStatistics& stats : _stats ) {
+      time += stats.time;
+    }
+    return time;
+  }
+
+  const bool _enabled;
+  const double _min_yield;
+  std::array<RefinerStatistics, NUM_REFINERS> _stats;
+};
+
+}  // namespace mt_kahypar
@@ -57,6 +57,8 @@ bool DeterministicJetRefiner<GraphAndGainTypes>::refineImpl(mt_kahypar_partition
     _was_already_balanced = metrics::isBalanced(phg, _context);
     const auto& jet_context = _context.refinement.jet;
     resizeDataStructuresForCurrentK();
+    _batched_gain_cache_updates = GainCache::supports_batched_updates &&
+      _gain_cache.isInitialized() && jet_context.batched_gain_cache_updates;
 
     _current_partition_is_best = true;
     for (size_t dynamic_round = 0; dynamic_round < jet_context.dynamic_rounds; ++dynamic_round) {
@@ -93,7 +95,8 @@ void DeterministicJetRefiner<GraphAndGainTypes>::runJetRounds(PartitionedHypergr
     _locks.reset();
 
     size_t rounds_without_improvement = 0;
-    for (size_t i = 0; rounds_without_improvement < _context.refinement.jet.num_iterations; ++i) {
+    for (size_t i = 0; rounds_without_improvement < _context.refinement.jet.num_iterations
+                       && !_context.isTimeLimitExceeded(); ++i) {
         if (_current_partition_is_best) {
             phg.doParallelForAllNodes([&](const HypernodeID hn) {
                 _best_partition[hn] = phg.partID(hn);
@@ -136,7 +139,9 @@ void DeterministicJetRefiner<GraphAndGainTypes>::runJetRounds(PartitionedHypergr
         current_metrics.quality -= gain;
         current_metrics.imbalance = metrics::imbalance(phg, _context);
 
-        if (GainCache::invalidates_entries && _gain_cache.isInitialized()) {
+        if (_batched_gain_cache_updates) {
+            recomputeGainCacheEntriesOfMovedNodes(phg);
+        } else if (GainCache::invalidates_entries && _gain_cache.isInitialized()) {
             tbb::parallel_for(UL(0), _active_nodes.size(), [&](size_t j) {
                 const HypernodeID hn = _active_nodes[j];
                 if (_part_before_round[hn] != phg.partID(hn)) {
@@ -197,15 +202,20 @@ void DeterministicJetRefiner<GraphAndGainTypes>::computeActiveNodesFromGraph(con
         if (!phg.isBorderNode(hn) || is_locked || phg.isFixed(hn)) {
             _gains_and_target[hn] = { 0, phg.partID(hn) };
         } else {
-            RatingMap& tmp_scores = _gain_computation.localScores();
             Gain isolated_block_gain = 0;
-            _gain_computation.precomputeGains(phg, hn, tmp_scores, isolated_block_gain, true);
-            // Note: rebalance=true is important here to allow negative gain moves
-            Move best_move = _gain_computation.computeMaxGainMoveForScores(phg, tmp_scores, isolated_block_gain, hn,
-                /*rebalance=*/true,
-                /*consider_non_adjacent_blocks=*/false,
-                /*allow_imbalance=*/true);
-            tmp_scores.clear();
+            Move best_move;
+            if constexpr (is_graph_cut) {
+                best_move = computeGraphCutMove(phg, hn, isolated_block_gain);
+            } else {
+                RatingMap& tmp_scores = _gain_computation.localScores();
+                _gain_computation.precomputeGains(phg, hn, tmp_scores, isolated_block_gain, true);
+                // Note: rebalance=true is important here to allow negative gain moves
+                best_move = _gain_computation.computeMaxGainMoveForScores(phg, tmp_scores, isolated_block_gain, hn,
+                    /*rebalance=*/true,
+                    /*consider_non_adjacent_blocks=*/false,
+                    /*allow_imbalance=*/true);
+                tmp_scores.clear();
+            }
             bool accept_node = (best_move.gain <= 0 || best_move.gain < std::floor(_negative_gain_factor * isolated_block_gain))
                 && best_move.to != phg.partID(hn);
             if (accept_node) {
@@ -219,6 +229,60 @@ void DeterministicJetRefiner<GraphAndGainTypes>::computeActiveNodesFromGraph(con
     _active_nodes = _tmp_active_nodes.copy_parallel();
 }
 
+template<typename GraphAndGainTypes>
+Move DeterministicJetRefiner<GraphAndGainTypes>::computeGraphCutMove(const PartitionedHypergraph& phg,
+                                                                     const HypernodeID hn,
+                                                                     Gain& isolated_block_gain) {
+    // The gain of moving hn to block to is w(hn, from) - w(hn, to), where w(hn, V') is the weight
+    // of all edges connecting hn to block V'. Only adjacent blocks are considered and ties are
+    // broken in favor of the smaller block id, such that both variants below select the same move.
+    const PartitionID from = phg.partID(hn);
+    Move best_move { from, from, hn, std::numeric_limits<Gain>::max() };
+    if constexpr (is_graph_cut) {
+        // Note that the deterministic rebalancer moves nodes without updating the gain cache
+        if (_gain_cache.isInitialized() && !_gain_cache.computesOnTheFly() &&
+            _context.refinement.rebalancing.algorithm != RebalancingAlgorithm::deterministic &&
+            static_cast<HyperedgeID>(_current_k) <= phg.nodeDegree(hn)) {
+            // The gain cache stores the incident weights of hn to all blocks consecutively,
+            // which is cheaper to scan than the neighborhood of a high-degree node
+            isolated_block_gain = _gain_cache.penaltyTerm(hn, from);
+            for (PartitionID to = 0; to < _current_k; ++to) {
+                const HyperedgeWeight benefit = _gain_cache.benefitTerm(hn, to);
+                const Gain gain = isolated_block_gain - benefit;
+                if (to != from && benefit > 0 && gain < best_move.gain) {
+                    best_move.to = to;
+                    best_move.gain = gain;
+                }
+            }
+        } else {
+            RatingMap& tmp_scores = _gain_computation.localScores();
+            for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+                if (!phg.isSinglePin(he)) {
+                    const PartitionID to = phg.partID(phg.edgeTarget(he));
+                    if (to == from) {
+                        isolated_block_gain += phg.edgeWeight(he);
+                    } else {
+                        tmp_scores[to] += phg.edgeWeight(he);
+                    }
+                }
+            }
+            for (const auto& entry : tmp_scores) {
+                const Gain gain = isolated_block_gain - entry.value;
+                if (entry.value > 0 && (gain < best_move.gain ||
+                    (gain == best_move.gain && entry.key < best_move.to))) {
+                    best_move.to = entry.key;
+                    best_move.gain = gain;
+                }
+            }
+            tmp_scores.clear();
+        }
+    } else {
+        unused(hn);
+        unused(isolated_block_gain);
+    }
+    return best_move;
+}
+
 template <typename GraphAndGainTypes>
 void DeterministicJetRefiner<GraphAndGainTypes>::initializeImpl(mt_kahypar_partitioned_hypergraph_t& phg) {
     _rebalancer.initialize(phg);
@@ -246,7 +310,8 @@ void DeterministicJetRefiner<GraphAndGainTypes>::rollbackToBestPartition(Partiti
     auto objective_delta = [&](const SynchronizedEdgeUpdate& sync_update) {
         _gain_computation.computeDeltaForHyperedge(sync_update);
     };
-    const bool update_gain_cache = GainCache::invalidates_entries && _gain_cache.isInitialized();
+    const bool update_gain_cache = _batched_gain_cache_updates ||
+      (GainCache::invalidates_entries && _gain_cache.isInitialized());
 
     phg.doParallelForAllNodes([&](const HypernodeID hn) {
         const PartitionID part_id = phg.partID(hn);
@@ -259,7 +324,9 @@ void DeterministicJetRefiner<GraphAndGainTypes>::rollbackToBestPartition(Partiti
             changeNodePart(phg, hn, part_id, _best_partition[hn], objective_delta);
         }
     });
-    if (update_gain_cache) {
+    if (_batched_gain_cache_updates) {
+        recomputeGainCacheEntriesOfMovedNodes(phg);
+    } else if (update_gain_cache) {
          phg.doParallelForAllNodes([&](const HypernodeID hn) {
             if (_part_before_round[hn] != phg.partID(hn)) {
                 _gain_cache.recomputeInvalidTerms(phg, hn);
@@ -269,6 +336,18 @@ void DeterministicJetRefiner<GraphAndGainTypes>::rollbackToBestPartition(Partiti
     _current_partition_is_best = true;
 }
 
+template <typename GraphAndGainTypes>
+void DeterministicJetRefiner<GraphAndGainTypes>::recomputeGainCacheEntriesOfMovedNodes(const PartitionedHypergraph& phg) {
+    if constexpr (GainCache::supports_batched_updates) {
+        // Note that the afterburner resets its hyperedge flags, so we can reuse them here
+        recomputeGainCacheEntriesAfterBatch(phg, _gain_cache, [&](const HypernodeID hn) {
+            return _part_before_round[hn] != phg.partID(hn);
+        }, _afterburner_visited_hes);
+    } else {
+        unused(phg);
+    }
+}
+
 template <typename GraphAndGainTypes>
 void DeterministicJetRefiner<GraphAndGainTypes>::graphAfterburner(PartitionedHypergraph& phg) {
     tbb::parallel_for(UL(0), _active_nodes.size(), [&](size_t j) {
@@ -277,27 +356,40 @@ void DeterministicJetRefiner<GraphAndGainTypes>::graphAfterburner(PartitionedHyp
         const auto [gain, to] = _gains_and_target[hn];
         ASSERT(from != to && to != kInvalidPartition);
 
+        // Jet uses an order based on the precomputed gain values:
+        // If the precomputed gain of another node is better than for the current node
+        // (or the gain is equal and the id is smaller), we assume the node is already
+        // moved to its target part.
         Gain total_gain = 0;
-        for (const HyperedgeID& he : phg.incidentEdges(hn)) {
-            SynchronizedEdgeUpdate sync_update = phg.createEdgeUpdate(he);
-            sync_update.from = from;
-            sync_update.to = to;
-            sync_update.pin_count_in_from_part_after = 0;
-            sync_update.pin_count_in_to_part_after = 1;
-
-            // Jet uses an order based on the precomputed gain values:
-            // If the precomputed gain of another node is better than for the current node
-            // (or the gain is equal and the id is smaller), we assume the node is already
-            // moved to its target part.
-            const HypernodeID other_node = phg.edgeTarget(he);
-            auto [gain_p, to_p] = _gains_and_target[other_node];
-            sync_update.block_of_other_node = (gain_p < gain || (gain_p == gain && other_node < hn)) ? to_p : phg.partID(other_node);
-            if (sync_update.block_of_other_node == from) {
-                sync_update.pin_count_in_from_part_after++;
-            } else if (sync_update.block_of_other_node == to) {
-                sync_update.pin_count_in_to_part_after++;
+        if constexpr (is_graph_cut) {
+            // The cut delta of an edge is accumulated without branches and
+            // without constructing a synchronized edge update
+            for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+                const HypernodeID other_node = phg.edgeTarget(he);
+                const auto [gain_p, to_p] = _gains_and_target[other_node];
+                const PartitionID block_of_other_node =
+                    (gain_p < gain || (gain_p == gain && other_node < hn)) ? to_p : phg.partID(other_node);
+                total_gain += phg.edgeWeight(he) * (static_cast<Gain>(block_of_other_node == from) -
+                                                    static_cast<Gain>(block_of_other_node == to));
+            }
+        } else {
+            for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+                SynchronizedEdgeUpdate sync_update = phg.createEdgeUpdate(he);
+                sync_update.from = from;
+                sync_update.to = to;
+                sync_update.pin_count_in_from_part_after = 0;
+                sync_update.pin_count_in_to_part_after = 1;
+
+                const HypernodeID other_node = phg.edgeTarget(he);
+                auto [gain_p, to_p] = _gains_and_target[other_node];
+                sync_update.block_of_other_node = (gain_p < gain || (gain_p == gain && other_node < hn)) ? to_p : phg.partID(other_node);
+                if (sync_update.block_of_other_node == from) {
+                    sync_update.pin_count_in_from_part_after++;
+                } else if (sync_update.block_of_other_node == to) {
+                    sync_update.pin_count_in_to_part_after++;
+                }
+                total_gain += AttributedGains::gain(sync_update);
             }
-            total_gain += AttributedGains::gain(sync_update);
         }
 
         if (total_gain <= 0) {
@@ -309,8 +401,10 @@ void DeterministicJetRefiner<GraphAndGainTypes>::graphAfterburner(PartitionedHyp
 
 template <typename GraphAndGainTypes>
 void DeterministicJetRefiner<GraphAndGainTypes>::hypergraphAfterburner(PartitionedHypergraph& phg) {
-    tbb::parallel_for(UL(0), _afterburner_gain.size(), [&](const size_t i) {
-        _afterburner_gain[i].store(0);
+    // Only active nodes have a target block different from their current block.
+    // Hence, these are the only nodes whose afterburner gain is modified and read.
+    tbb::parallel_for(UL(0), _active_nodes.size(), [&](const size_t i) {
+        _afterburner_gain[_active_nodes[i]].store(0, std::memory_order_relaxed);
     });
 
     auto afterburn_two_pins = [&](const HyperedgeID& he) {
@@ -335,17 +429,17 @@ void DeterministicJetRefiner<GraphAndGainTypes>::hypergraphAfterburner(Partition
         // moving a
         if (from_a != to_a) {
             if (from_a == from_b) {
-                _afterburner_gain[a] += weight;
+                _afterburner_gain[a].fetch_add(weight, std::memory_order_relaxed);
             } else if (to_a == from_b) {
-                _afterburner_gain[a] -= weight;
+                _afterburner_gain[a].fetch_sub(weight, std::memory_order_relaxed);
             }
         }
         // moving b after a
         if (from_b != to_b) {
             if (from_b == to_a) {
-                _afterburner_gain[b] += weight;
+                _afterburner_gain[b].fetch_add(weight, std::memory_order_relaxed);
             } else if (to_b == to_a) {
-                _afterburner_gain[b] -= weight;
+                _afterburner_gain[b].fetch_sub(weight, std::memory_order_relaxed);
             }
         }
     };
@@ -434,21 +528,28 @@ HyperedgeWeight DeterministicJetRefiner<GraphAndGainTypes>::calculateGainDelta(P
         const PartitionID to = phg.partID(hn);
 
         if (from != to) {
+            HyperedgeWeight& local_gain_delta = gain_delta.local();
             for (const HyperedgeID& he : phg.incidentEdges(hn)) {
-                SynchronizedEdgeUpdate sync_update = phg.createEdgeUpdate(he);
-                sync_update.from = from;
-                sync_update.to = to;
-                sync_update.pin_count_in_from_part_after = 0;
-                sync_update.pin_count_in_to_part_after = 1;
-
                 const HypernodeID other_node = phg.edgeTarget(he);
-                sync_update.block_of_other_node = other_node < hn ? phg.partID(other_node) : _part_before_round[other_node];
-                if (sync_update.block_of_other_node == from) {
-                    sync_update.pin_count_in_from_part_after++;
-                } else if (sync_update.block_of_other_node == to) {
-                    sync_update.pin_count_in_to_part_after++;
+                const PartitionID block_of_other_node =
+                    other_node < hn ? phg.partID(other_node) : _part_before_round[other_node];
+                if constexpr (is_graph_cut) {
+                    local_gain_delta += phg.edgeWeight(he) * (static_cast<Gain>(block_of_other_node == from) -
+                                                              static_cast<Gain>(block_of_other_node == to));
+                } else {
+                    SynchronizedEdgeUpdate sync_update = phg.createEdgeUpdate(he);
+                    sync_update.from = from;
+                    sync_update.to = to;
+                    sync_update.pin_count_in_from_part_after = 0;
+                    sync_update.pin_count_in_to_part_after = 1;
+                    sync_update.block_of_other_node = block_of_other_node;
+                    if (sync_update.block_of_other_node == from) {
+                        sync_update.pin_count_in_from_part_after++;
+                    } else if (sync_update.block_of_other_node == to) {
+                        sync_update.pin_count_in_to_part_after++;
+                    }
+                    local_gain_delta += AttributedGains::gain(sync_update);
                 }
-                gain_delta.local() += AttributedGains::gain(sync_update);
             }
         }
     });
@@ -464,10 +565,15 @@ void DeterministicJetRefiner<GraphAndGainTypes>::changeNodePart(PartitionedHyper
                                                                 const F& objective_delta) {
     constexpr HypernodeWeight inf_weight = std::numeric_limits<HypernodeWeight>::max();
     bool success;
-    if (_gain_cache.isInitialized()) {
+    if (_gain_cache.isInitialized() && !_batched_gain_cache_updates) {
         success = phg.changeNodePart(_gain_cache, hn, from, to, inf_weight, [] {}, objective_delta);
     } else if constexpr (PartitionedHypergraph::is_graph) {
-        success = phg.changeNodePartNoSync(hn, from, to, inf_weight);
+        if (_batched_gain_cache_updates) {
+            // the attributed gains are still required to track the quality
+            success = phg.changeNodePart(hn, from, to, inf_weight, [] {}, objective_delta);
+        } else {
+            success = phg.changeNodePartNoSync(hn, from, to, inf_weight);
+        }
     } else {
         success = phg.changeNodePart(hn, from, to, inf_weight, [] {}, objective_delta);
     }
@@ -49,6 +49,11 @@ class DeterministicJetRefiner final : public IRefiner {
   using ActiveNodes = typename parallel::scalable_vector<HypernodeID>;
   using RatingMap = typename GainComputation::RatingMap;
 
+  // ! For the cut metric on graphs, the gains are computed with direct edge access
+  // ! instead of the generic gain computation and attributed gains for hypergraphs
+  static constexpr bool is_graph_cut = PartitionedHypergraph::is_graph &&
+    GainCache::TYPE == GainPolicy::cut_for_graphs;
+
 public:
   explicit DeterministicJetRefiner(const HypernodeID num_hypernodes,
                                    const HyperedgeID num_hyperedges,
@@ -69,6 +74,7 @@ public:
     _current_partition_is_best(true),
     _was_already_balanced(false),
     _negative_gain_factor(0.0),
+    _batched_gain_cache_updates(false),
     _active_nodes(),
     _tmp_active_nodes(),
     _moves(),
@@ -97,10 +103,16 @@ private:
 
   void computeActiveNodesFromGraph(const PartitionedHypergraph& hypergraph);
 
+  Move computeGraphCutMove(const PartitionedHypergraph& phg,
+                           const HypernodeID hn,
+                           Gain& isolated_block_gain);
+
   Gain performMoveWithAttributedGain(PartitionedHypergraph& phg, const HypernodeID hn);
 
   void rollbackToBestPartition(PartitionedHypergraph& hypergraph);
 
+  void recomputeGainCacheEntriesOfMovedNodes(const PartitionedHypergraph& phg);
+
   template<typename F>
   void changeNodePart(PartitionedHypergraph& phg,
                       const HypernodeID hn,
@@ -128,6 +140,9 @@ private:
   bool _current_partition_is_best;
   bool _was_already_balanced;
   double _negative_gain_factor;
+  // ! If true, moves are applied without delta gain updates and the gain cache
+  // ! entries of the affected nodes are recomputed after all moves of a round
+  bool _batched_gain_cache_updates;
   ActiveNodes _active_nodes;
   ds::StreamingVector<HypernodeID> _tmp_active_nodes;
   parallel::scalable_vector<HypernodeID> _moves;
@@ -32,6 +32,8 @@
 #include "mt-kahypar/parallel/parallel_counting_sort.h"
 #include "mt-kahypar/utils/cast.h"
 
+#include <algorithm>
+
 #include <tbb/parallel_sort.h>
 #include <tbb/parallel_reduce.h>
 
@@ -52,9 +54,13 @@ namespace mt_kahypar {
     }
 
     constexpr size_t num_buckets = utils::ParallelPermutation<HypernodeID>::num_buckets;
-    size_t num_sub_rounds = context.refinement.deterministic_refinement.num_sub_rounds_sync_lp;
+    const bool adaptive_sub_rounds = context.refinement.deterministic_refinement.adaptive_sub_rounds_sync_lp;
+    size_t max_sub_rounds = context.refinement.deterministic_refinement.num_sub_rounds_sync_lp;
+    size_t min_sub_rounds = 1;
+    size_t num_moves_in_last_round = 0;
 
-    for (size_t iter = 0; iter < context.refinement.label_propagation.maximum_iterations; ++iter) {
+    for (size_t iter = 0; iter < context.refinement.label_propagation.maximum_iterations
+                          && !context.isTimeLimitExceeded(); ++iter) {
       if (context.refinement.deterministic_refinement.use_active_node_set && ++round == 0) {
         std::fill(last_moved_in_round.begin(), last_moved_in_round.end(), CAtomic<uint32_t>(0));
       }
@@ -69,6 +75,16 @@ namespace mt_kahypar {
       }
       active_nodes.clear();
 
+      // Sub-rounds reduce the number of conflicting moves, but each one requires a synchronization.
+      // The number of moves of the previous round and the number of candidates are the same in
+      // each run, so the adaptive policy is deterministic.
+      size_t num_sub_rounds = max_sub_rounds;
+      if (adaptive_sub_rounds && iter > 0) {
+        const size_t num_candidates = permutation.bucket_bounds[num_buckets];
+        const size_t expected_moves = std::min(num_moves_in_last_round, num_candidates);
+        num_sub_rounds = std::clamp(parallel::chunking::idiv_ceil(expected_moves, min_moves_per_sub_round),
+                                    min_sub_rounds, max_sub_rounds);
+      }
       const size_t num_buckets_per_sub_round = parallel::chunking::idiv_ceil(num_buckets, num_sub_rounds);
       size_t num_moves = 0;
       Gain round_improvement = 0;
@@ -111,8 +127,10 @@ namespace mt_kahypar {
       active_nodes.finalize();
 
       if (increase_sub_rounds) {
-        num_sub_rounds = std::min(num_buckets, num_sub_rounds * 2);
+        min_sub_rounds = std::min(num_buckets, num_sub_rounds * 2);
+        max_sub_rounds = adaptive_sub_rounds ? std::max(max_sub_rounds, min_sub_rounds) : min_sub_rounds;
       }
+      num_moves_in_last_round = num_moves;
       if (num_moves == 0) {
         break; // no vertices with positive gain --> stop
       }
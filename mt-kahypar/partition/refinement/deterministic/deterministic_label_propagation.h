@@ -73,6 +73,8 @@ public:
 private:
   static constexpr bool debug = false;
   static constexpr size_t invalid_pos = std::numeric_limits<size_t>::max() / 2;
+  // ! With adaptive sub-rounds, each sub-round is expected to contain at least this many moves
+  static constexpr size_t min_moves_per_sub_round = 1024;
 
   bool refineImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph,
                   const vec<HypernodeID>& refinement_nodes,
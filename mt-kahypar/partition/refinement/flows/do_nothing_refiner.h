@@ -57,5 +57,7 @@ class DoNothingFlowRefiner final : public IFlowRefiner {
   }
 
   void setNumThreadsForSearchImpl(const size_t) override {}
+
+  void memoryConsumptionImpl(utils::MemoryTreeNode*) const override { }
 };
 }  // namespace kahypar
@@ -260,6 +260,20 @@ namespace mt_kahypar {
       nodes.resize(num_nodes + 1);
     }
 
+    // ! Memory of all buffers, which are only growing across searches
+    size_t size_in_bytes() const {
+      size_t size = nodes.capacity() * sizeof(NodeData) +
+        hyperedges.capacity() * sizeof(HyperedgeData) +
+        pins.capacity() * sizeof(Pin) +
+        incident_hyperedges.capacity() * sizeof(InHe) +
+        _inc_he_pos.capacity() * sizeof(uint32_t);
+      for ( const TmpCSRBucket& bucket : _tmp_csr_buckets ) {
+        size += bucket._hes.capacity() * sizeof(HyperedgeData) +
+          bucket._pins.capacity() * sizeof(Pin);
+      }
+      return size;
+    }
+
     void shrink_to_fit() {
       nodes.shrink_to_fit();
       hyperedges.shrink_to_fit();
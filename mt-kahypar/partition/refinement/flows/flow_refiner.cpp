@@ -42,6 +42,10 @@ MoveSequence FlowRefiner<GraphAndGainTypes>::refineImpl(mt_kahypar_partitioned_h
   const PartitionedHypergraph& phg = utils::cast_const<PartitionedHypergraph>(hypergraph);
   MoveSequence sequence { { }, 0 };
   utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+  // The scheduler distributes idle threads among the active searches (e.g., if
+  // there are only few block pairs). If a search is granted more than one thread,
+  // we use the parallel construction and push-relabel algorithm.
+  _use_parallel_push_relabel = _num_available_threads > 1;
   // Construct flow network that contains all vertices given in refinement nodes
   timer.start_timer("construct_flow_network", "Construct Flow Network", true);
   FlowProblem flow_problem = constructFlowHypergraph(phg, sub_hg);
@@ -59,7 +63,7 @@ MoveSequence FlowRefiner<GraphAndGainTypes>::refineImpl(mt_kahypar_partitioned_h
 
       HyperedgeWeight new_cut = flow_problem.non_removable_cut;
       HypernodeWeight max_part_weight;
-      const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+      const bool sequential = !_use_parallel_push_relabel;
       if (sequential) {
         new_cut += _sequential_hfc.cs.flow_algo.flow_value;
         max_part_weight = std::max(_sequential_hfc.cs.source_weight, _sequential_hfc.cs.target_weight);
@@ -123,7 +127,7 @@ bool FlowRefiner<GraphAndGainTypes>::runFlowCutter(const FlowProblem& flow_probl
   };
 
 
-  const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+  const bool sequential = !_use_parallel_push_relabel;
   if (sequential) {
     _sequential_hfc.cs.setMaxBlockWeight(0, std::max(
             flow_problem.weight_of_block_0, _context.partition.max_part_weights[_block_0]));
@@ -146,6 +150,17 @@ bool FlowRefiner<GraphAndGainTypes>::runFlowCutter(const FlowProblem& flow_probl
   return result;
 }
 
+template<typename GraphAndGainTypes>
+void FlowRefiner<GraphAndGainTypes>::memoryConsumptionImpl(utils::MemoryTreeNode* parent) const {
+  ASSERT(parent);
+
+  utils::MemoryTreeNode* refiner_node = parent->addChild("Flow Refiner");
+  refiner_node->addChild("Flow Hypergraph")->updateSize(_flow_hg.size_in_bytes());
+  refiner_node->addChild("Node Mapping")->updateSize(_whfc_to_node.capacity() * sizeof(HypernodeID));
+  _sequential_construction.memoryConsumption(refiner_node);
+  _parallel_construction.memoryConsumption(refiner_node);
+}
+
 template<typename GraphAndGainTypes>
 FlowProblem FlowRefiner<GraphAndGainTypes>::constructFlowHypergraph(const PartitionedHypergraph& phg,
                                                                  const Subhypergraph& sub_hg) {
@@ -155,7 +170,7 @@ FlowProblem FlowRefiner<GraphAndGainTypes>::constructFlowHypergraph(const Partit
   FlowProblem flow_problem;
 
 
-  const bool sequential = _context.shared_memory.num_threads == _context.refinement.flows.num_parallel_searches;
+  const bool sequential = !_use_parallel_push_relabel;
   if ( sequential ) {
     flow_problem = _sequential_construction.constructFlowHypergraph(
       phg, sub_hg, _block_0, _block_1, _whfc_to_node);
@@ -58,6 +58,7 @@ class FlowRefiner final : public IFlowRefiner {
     _phg(nullptr),
     _context(context),
     _num_available_threads(0),
+    _use_parallel_push_relabel(false),
     _block_0(kInvalidPartition),
     _block_1(kInvalidPartition),
     _flow_hg(),
@@ -74,7 +75,7 @@ class FlowRefiner final : public IFlowRefiner {
       _parallel_hfc.find_most_balanced = _context.refinement.flows.find_most_balanced_cut;
       _parallel_hfc.timer.active = false;
       _parallel_hfc.forceSequential(false);
-      _sequential_hfc.setBulkPiercing(context.refinement.flows.pierce_in_bulk);
+      _parallel_hfc.setBulkPiercing(context.refinement.flows.pierce_in_bulk);
   }
 
   FlowRefiner(const FlowRefiner&) = delete;
@@ -116,10 +117,15 @@ class FlowRefiner final : public IFlowRefiner {
     _num_available_threads = num_threads;
   }
 
+  void memoryConsumptionImpl(utils::MemoryTreeNode* parent) const override;
+
   const PartitionedHypergraph* _phg;
   const Context& _context;
   using IFlowRefiner::_time_limit;
   size_t _num_available_threads;
+  // ! True, if the current search uses the parallel flow hypergraph
+  // ! construction and push-relabel algorithm
+  bool _use_parallel_push_relabel;
 
   mutable PartitionID _block_0;
   mutable PartitionID _block_1;
@@ -34,6 +34,7 @@
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/partition/refinement/flows/flow_common.h"
+#include "mt-kahypar/utils/memory_tree.h"
 
 namespace mt_kahypar {
 
@@ -73,6 +74,11 @@ class IFlowRefiner {
     _time_limit = time_limit;
   }
 
+  // ! Reports the memory of all buffers that are kept alive across searches
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    memoryConsumptionImpl(parent);
+  }
+
 
  protected:
   IFlowRefiner() = default;
@@ -89,6 +95,8 @@ class IFlowRefiner {
   virtual PartitionID maxNumberOfBlocksPerSearchImpl() const = 0;
 
   virtual void setNumThreadsForSearchImpl(const size_t num_threads) = 0;
+
+  virtual void memoryConsumptionImpl(utils::MemoryTreeNode* parent) const = 0;
 };
 
 }  // namespace mt_kahypar
@@ -31,7 +31,6 @@
 #include <tbb/concurrent_queue.h>
 
 #include "mt-kahypar/definitions.h"
-#include "mt-kahypar/parallel/stl/scalable_queue.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 
 namespace mt_kahypar {
@@ -524,47 +523,6 @@ FlowProblem ParallelConstruction<GraphAndGainTypes>::constructOptimizedForLargeH
   return flow_problem;
 }
 
-namespace {
-template<typename T>
-class BFSQueue {
-
- public:
-  explicit BFSQueue(const size_t num_threads) :
-    _q(num_threads) { }
-
-  bool empty() {
-    bool is_empty = true;
-    for ( size_t i = 0; i < _q.size(); ++i ) {
-      is_empty &= _q[i].empty();
-    }
-    return is_empty;
-  }
-
-  bool empty(const size_t i) {
-    ASSERT(i < _q.size());
-    return _q[i].empty();
-  }
-
-  void push(const T elem, const size_t i) {
-    ASSERT(i < _q.size());
-    return _q[i].push(elem);
-  }
-
-  T front(const size_t i) {
-    ASSERT(i < _q.size());
-    return _q[i].front();
-  }
-
-  void pop(const size_t i) {
-    ASSERT(i < _q.size());
-    return _q[i].pop();
-  }
-
- private:
-  vec<parallel::scalable_queue<T>> _q;
-};
-}
-
 template<typename GraphAndGainTypes>
 void ParallelConstruction<GraphAndGainTypes>::determineDistanceFromCut(const PartitionedHypergraph& phg,
                                                                     const whfc::Node source,
@@ -583,13 +541,14 @@ void ParallelConstruction<GraphAndGainTypes>::determineDistanceFromCut(const Par
   size_t q_idx = 0;
 
   const size_t num_threads = std::thread::hardware_concurrency();
-  vec<BFSQueue<whfc::Node>> q(2, BFSQueue<whfc::Node>(num_threads));
+  _bfs_queues[0].initialize(num_threads);
+  _bfs_queues[1].initialize(num_threads);
   tbb::parallel_for(UL(0), _cut_hes.size(), [&](const size_t i) {
     const int thread_idx = tbb::this_task_arena::current_thread_index();
     const whfc::Hyperedge he = _flow_hg.originalHyperedgeID(_cut_hes[i].bucket, _cut_hes[i].e);
     for ( const whfc::FlowHypergraph::Pin& pin : _flow_hg.pinsOf(he) ) {
       if ( _visited_hns.compare_and_set_to_true(pin.pin) ) {
-        q[q_idx].push(pin.pin, thread_idx);
+        _bfs_queues[q_idx].push(pin.pin, thread_idx);
       }
     }
     _visited_hns.set(_flow_hg.numNodes() + he, true);
@@ -599,13 +558,12 @@ void ParallelConstruction<GraphAndGainTypes>::determineDistanceFromCut(const Par
   whfc::HopDistance dist(1);
   whfc::HopDistance max_dist_source(0);
   whfc::HopDistance max_dist_sink(0);
-  while ( !q[q_idx].empty() ) {
+  while ( !_bfs_queues[q_idx].empty() ) {
     bool reached_source_side = false;
     bool reached_sink_side = false;
     tbb::parallel_for(UL(0), num_threads, [&](const size_t idx) {
-      while ( !q[q_idx].empty(idx) ) {
-        whfc::Node u = q[q_idx].front(idx);
-        q[q_idx].pop(idx);
+      vec<whfc::Node>& q = _bfs_queues[q_idx].queue(idx);
+      for ( const whfc::Node& u : q ) {
         const PartitionID block_of_u = phg.partID(whfc_to_node[u]);
         if ( block_of_u == block_0 ) {
           distances[u] = -dist;
@@ -620,18 +578,19 @@ void ParallelConstruction<GraphAndGainTypes>::determineDistanceFromCut(const Par
           if ( _visited_hns.compare_and_set_to_true(_flow_hg.numNodes() + he) ) {
             for ( const whfc::FlowHypergraph::Pin& pin : _flow_hg.pinsOf(he) ) {
               if ( _visited_hns.compare_and_set_to_true(pin.pin) ) {
-                q[1 - q_idx].push(pin.pin, idx);
+                _bfs_queues[1 - q_idx].push(pin.pin, idx);
               }
             }
           }
         }
       }
+      q.clear();
     });
 
     if ( reached_source_side ) max_dist_source = dist;
     if ( reached_sink_side ) max_dist_sink = dist;
 
-    ASSERT(q[q_idx].empty());
+    ASSERT(_bfs_queues[q_idx].empty());
     q_idx = 1 - q_idx;
     ++dist;
   }
@@ -639,6 +598,24 @@ void ParallelConstruction<GraphAndGainTypes>::determineDistanceFromCut(const Par
   distances[sink] = max_dist_sink + 1;
 }
 
+template<typename GraphAndGainTypes>
+void ParallelConstruction<GraphAndGainTypes>::memoryConsumption(utils::MemoryTreeNode* parent) const {
+  ASSERT(parent);
+
+  utils::MemoryTreeNode* construction_node = parent->addChild("Parallel Construction");
+  construction_node->addChild("Node Mapping")->updateSize(
+    _node_to_whfc.size_in_bytes() + _he_to_whfc.size_in_bytes());
+  construction_node->addChild("Visited Nodes")->updateSize(_visited_hns.size_in_bytes());
+  size_t tmp_pins_size = _pins.size_in_bytes() + _cut_hes.capacity() * sizeof(TmpHyperedge);
+  for ( const vec<whfc::Node>& tmp_pins : _tmp_pins ) {
+    tmp_pins_size += tmp_pins.capacity() * sizeof(whfc::Node);
+  }
+  construction_node->addChild("Temporary Pins")->updateSize(tmp_pins_size);
+  construction_node->addChild("BFS Queues")->updateSize(
+    _bfs_queues[0].size_in_bytes() + _bfs_queues[1].size_in_bytes());
+  construction_node->addChild("Identical Net Detection")->updateSize(_identical_nets.size_in_bytes());
+}
+
 namespace {
 #define PARALLEL_CONSTRUCTION(X) ParallelConstruction<X>
 }
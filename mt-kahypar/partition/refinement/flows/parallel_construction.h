@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <array>
+
 #include <tbb/concurrent_vector.h>
 #include <tbb/enumerable_thread_specific.h>
 
@@ -106,12 +108,65 @@ class ParallelConstruction {
       _threshold += 2;
     }
 
+    size_t size_in_bytes() const {
+      size_t size = _hash_buckets.capacity() * sizeof(HashBucket);
+      for ( const HashBucket& bucket : _hash_buckets ) {
+        size += bucket.identical_nets.capacity() * sizeof(ThresholdHyperedge);
+      }
+      return size;
+    }
+
    private:
     FlowHypergraphBuilder& _flow_hg;
     vec<HashBucket> _hash_buckets;
     uint32_t _threshold;
   };
 
+  // ! Level-synchronous BFS queue that consists of one queue per thread.
+  // ! The queues are kept alive across searches to avoid reallocations.
+  class BFSQueue {
+
+   public:
+    BFSQueue() :
+      _q() { }
+
+    void initialize(const size_t num_threads) {
+      _q.resize(num_threads);
+      for ( vec<whfc::Node>& q : _q ) {
+        q.clear();
+      }
+    }
+
+    bool empty() const {
+      bool is_empty = true;
+      for ( const vec<whfc::Node>& q : _q ) {
+        is_empty &= q.empty();
+      }
+      return is_empty;
+    }
+
+    void push(const whfc::Node u, const size_t i) {
+      ASSERT(i < _q.size());
+      _q[i].push_back(u);
+    }
+
+    vec<whfc::Node>& queue(const size_t i) {
+      ASSERT(i < _q.size());
+      return _q[i];
+    }
+
+    size_t size_in_bytes() const {
+      size_t size = 0;
+      for ( const vec<whfc::Node>& q : _q ) {
+        size += q.capacity() * sizeof(whfc::Node);
+      }
+      return size;
+    }
+
+   private:
+    vec<vec<whfc::Node>> _q;
+  };
+
  public:
   explicit ParallelConstruction(const HyperedgeID num_hyperedges,
                                 FlowHypergraphBuilder& flow_hg,
@@ -126,6 +181,7 @@ class ParallelConstruction {
     _cut_hes(),
     _pins(),
     _he_to_whfc(),
+    _bfs_queues(),
     _identical_nets(num_hyperedges, flow_hg, context) { }
 
   ParallelConstruction(const ParallelConstruction&) = delete;
@@ -150,6 +206,8 @@ class ParallelConstruction {
                                       vec<HypernodeID>& whfc_to_node,
                                       const bool default_construction);
 
+  void memoryConsumption(utils::MemoryTreeNode* parent) const;
+
  private:
   FlowProblem constructDefault(const PartitionedHypergraph& phg,
                                const Subhypergraph& sub_hg,
@@ -183,6 +241,8 @@ class ParallelConstruction {
   ds::ConcurrentBucketMap<TmpPin> _pins;
   ds::ConcurrentFlatMap<HyperedgeID, HyperedgeID> _he_to_whfc;
 
+  std::array<BFSQueue, 2> _bfs_queues;
+
   DynamicIdenticalNetDetection _identical_nets;
 };
 }  // namespace mt_kahypar
@@ -30,6 +30,7 @@
 #include <unordered_map>
 
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -95,6 +96,26 @@ void ProblemConstruction<TypeTraits>::BFSData::add_pins_of_hyperedge_to_queue(
   }
 }
 
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::ParallelBFSData::reset(const HypernodeID num_nodes,
+                                                             const HyperedgeID num_edges) {
+  queue.clear();
+  if ( visited_hn.size() < num_nodes ) {
+    visited_hn.resize(num_nodes);
+    visited_he.resize(num_edges);
+    contained_hes.resize(num_edges);
+  }
+  visited_hn.reset();
+  visited_he.reset();
+  contained_hes.reset();
+  for ( LocalRegion& region : local_regions ) {
+    region.next_queue.clear();
+    region.nodes_of_block_0.clear();
+    region.nodes_of_block_1.clear();
+    region.hes.clear();
+  }
+}
+
 namespace {
   using assert_map = std::unordered_map<HyperedgeID, bool>;
 }
@@ -102,13 +123,33 @@ namespace {
 template<typename TypeTraits>
 Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_id,
                                                          QuotientGraph<TypeTraits>& quotient_graph,
-                                                         const PartitionedHypergraph& phg) {
+                                                         const PartitionedHypergraph& phg,
+                                                         const size_t num_threads) {
+  const BlockPair blocks = quotient_graph.getBlockPair(search_id);
+  // Move sequences applied after reading the version invalidate the constructed problem
+  const uint32_t version = _current_version.load(std::memory_order_relaxed);
+  const size_t num_cut_hes = quotient_graph.numCutHyperedges(blocks);
+  if ( _reuse_problems ) {
+    ASSERT(indexOf(blocks) < _cached_problems.size());
+    CachedProblem& problem = _cached_problems[indexOf(blocks)];
+    if ( problem.is_valid && isCachedProblemValid(problem, num_cut_hes, phg) ) {
+      DBG << "Search ID:" << search_id << "- Reuse" << problem.sub_hg;
+      const HypernodeWeight weight_of_block_0 = phg.partWeight(blocks.i);
+      const HypernodeWeight weight_of_block_1 = phg.partWeight(blocks.j);
+      _cached_problems_lock.lock();
+      problem.search_id = search_id;
+      problem.is_unimprovable &= problem.weight_of_block_0 == weight_of_block_0 &&
+        problem.weight_of_block_1 == weight_of_block_1;
+      problem.weight_of_block_0 = weight_of_block_0;
+      problem.weight_of_block_1 = weight_of_block_1;
+      _cached_problems_lock.unlock();
+      return problem.sub_hg;
+    }
+  }
+
   Subhypergraph sub_hg;
-  BFSData& bfs = _local_bfs.local();
-  bfs.reset();
-  bfs.blocks = quotient_graph.getBlockPair(search_id);
-  sub_hg.block_0 = bfs.blocks.i;
-  sub_hg.block_1 = bfs.blocks.j;
+  sub_hg.block_0 = blocks.i;
+  sub_hg.block_1 = blocks.j;
   sub_hg.weight_of_block_0 = 0;
   sub_hg.weight_of_block_1 = 0;
   sub_hg.num_pins = 0;
@@ -116,8 +157,88 @@ Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_i
     _scaling * _context.partition.perfect_balance_part_weights[sub_hg.block_1] - phg.partWeight(sub_hg.block_1);
   const HypernodeWeight max_weight_block_1 =
     _scaling * _context.partition.perfect_balance_part_weights[sub_hg.block_0] - phg.partWeight(sub_hg.block_0);
-  const size_t max_bfs_distance = _context.refinement.flows.max_bfs_distance;
+  if ( num_threads > 1 ) {
+    growRegionInParallel(search_id, quotient_graph, phg,
+      max_weight_block_0, max_weight_block_1, sub_hg);
+  } else {
+    growRegionSequentially(search_id, quotient_graph, phg,
+      max_weight_block_0, max_weight_block_1, sub_hg);
+  }
+  DBG << "Search ID:" << search_id << "-" << sub_hg;
+
+  // Check if all touched hyperedges are contained in subhypergraph
+  ASSERT([&]() {
+    assert_map expected_hes;
+    for ( const HyperedgeID& he : sub_hg.hes ) {
+      const HyperedgeID id = phg.uniqueEdgeID(he);
+      if ( expected_hes.count(id) > 0 ) {
+        LOG << "Hyperedge" << he << "is contained multiple times in subhypergraph!";
+        return false;
+      }
+      expected_hes[id] = true;
+    }
+
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        const HyperedgeID id = phg.uniqueEdgeID(he);
+        if ( expected_hes.count(id) == 0 ) {
+          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
+          return false;
+        }
+        expected_hes[id] = false;
+      }
+    }
+
+    for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
+      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+        const HyperedgeID id = phg.uniqueEdgeID(he);
+        if ( expected_hes.count(id) == 0 ) {
+          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
+          return false;
+        }
+        expected_hes[id] = false;
+      }
+    }
+
+    for ( const auto& entry : expected_hes ) {
+      const HyperedgeID he = entry.first;
+      const bool visited = !entry.second;
+      if ( !visited ) {
+        LOG << "HyperedgeID" << he << "should be not part of subhypergraph!";
+        return false;
+      }
+    }
+    return true;
+  }(), "Subhypergraph construction failed!");
 
+  if ( _reuse_problems ) {
+    CachedProblem& problem = _cached_problems[indexOf(blocks)];
+    problem.sub_hg = sub_hg;
+    problem.version = version;
+    problem.num_cut_hes = num_cut_hes;
+    problem.is_valid = true;
+    _cached_problems_lock.lock();
+    problem.search_id = search_id;
+    problem.weight_of_block_0 = phg.partWeight(blocks.i);
+    problem.weight_of_block_1 = phg.partWeight(blocks.j);
+    problem.is_unimprovable = false;
+    _cached_problems_lock.unlock();
+  }
+
+  return sub_hg;
+}
+
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::growRegionSequentially(const SearchID search_id,
+                                                             QuotientGraph<TypeTraits>& quotient_graph,
+                                                             const PartitionedHypergraph& phg,
+                                                             const HypernodeWeight max_weight_block_0,
+                                                             const HypernodeWeight max_weight_block_1,
+                                                             Subhypergraph& sub_hg) {
+  BFSData& bfs = _local_bfs.local();
+  bfs.reset();
+  bfs.blocks = quotient_graph.getBlockPair(search_id);
+  const size_t max_bfs_distance = _context.refinement.flows.max_bfs_distance;
 
   // We initialize the BFS with all cut hyperedges running
   // between the involved block associated with the search
@@ -166,54 +287,152 @@ Subhypergraph ProblemConstruction<TypeTraits>::construct(const SearchID search_i
       bfs.swap_with_next_queue();
     }
   }
-  DBG << "Search ID:" << search_id << "-" << sub_hg;
+}
 
-  // Check if all touched hyperedges are contained in subhypergraph
-  ASSERT([&]() {
-    assert_map expected_hes;
-    for ( const HyperedgeID& he : sub_hg.hes ) {
-      const HyperedgeID id = phg.uniqueEdgeID(he);
-      if ( expected_hes.count(id) > 0 ) {
-        LOG << "Hyperedge" << he << "is contained multiple times in subhypergraph!";
-        return false;
-      }
-      expected_hes[id] = true;
-    }
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::growRegionInParallel(const SearchID search_id,
+                                                           QuotientGraph<TypeTraits>& quotient_graph,
+                                                           const PartitionedHypergraph& phg,
+                                                           const HypernodeWeight max_weight_block_0,
+                                                           const HypernodeWeight max_weight_block_1,
+                                                           Subhypergraph& sub_hg) {
+  ParallelBFSData& bfs = _local_parallel_bfs.local();
+  bfs.reset(_num_hypernodes, _num_hyperedges);
+  const PartitionID block_0 = sub_hg.block_0;
+  const PartitionID block_1 = sub_hg.block_1;
+  const size_t max_bfs_distance = _context.refinement.flows.max_bfs_distance;
+  const size_t max_num_pins = _context.refinement.flows.max_num_pins;
 
-    for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
-      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
-        const HyperedgeID id = phg.uniqueEdgeID(he);
-        if ( expected_hes.count(id) == 0 ) {
-          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
-          return false;
+  // The region guarantees are the same as for the sequential BFS: A node is only added
+  // if the weight of its block and the number of pins are below their limits before
+  // adding it. Both are reserved with compare-and-swap operations.
+  CAtomic<HypernodeWeight> weight_of_block_0(0);
+  CAtomic<HypernodeWeight> weight_of_block_1(0);
+  CAtomic<size_t> num_pins(0);
+  CAtomic<HypernodeWeight> queue_weight_block_0(0);
+  CAtomic<HypernodeWeight> queue_weight_block_1(0);
+  CAtomic<bool> locked_block_0(false);
+  CAtomic<bool> locked_block_1(false);
+  CAtomic<bool> lock_queue(false);
+  size_t current_distance = 0;
+
+  auto is_locked = [&](const PartitionID block) {
+    return block == block_0 ? locked_block_0.load(std::memory_order_relaxed) :
+      locked_block_1.load(std::memory_order_relaxed);
+  };
+
+  auto add_pins_of_hyperedge_to_queue = [&](const HyperedgeID he, vec<HypernodeID>& next_queue) {
+    if ( current_distance <= max_bfs_distance && !lock_queue.load(std::memory_order_relaxed) &&
+         bfs.visited_he.compare_and_set_to_true(he) ) {
+      for ( const HypernodeID& pin : phg.pins(he) ) {
+        if ( bfs.visited_hn.compare_and_set_to_true(pin) ) {
+          const PartitionID block = phg.partID(pin);
+          if ( (block == block_0 || block == block_1) && !is_locked(block) ) {
+            next_queue.push_back(pin);
+            CAtomic<HypernodeWeight>& queue_weight =
+              block == block_0 ? queue_weight_block_0 : queue_weight_block_1;
+            queue_weight.fetch_add(phg.nodeWeight(pin), std::memory_order_relaxed);
+          }
         }
-        expected_hes[id] = false;
       }
     }
 
-    for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
-      for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
-        const HyperedgeID id = phg.uniqueEdgeID(he);
-        if ( expected_hes.count(id) == 0 ) {
-          LOG << "Hyperedge" << he << "not contained in subhypergraph!";
-          return false;
-        }
-        expected_hes[id] = false;
-      }
+    if ( queue_weight_block_0.load(std::memory_order_relaxed) >= max_weight_block_0 &&
+         queue_weight_block_1.load(std::memory_order_relaxed) >= max_weight_block_1 ) {
+      lock_queue.store(true, std::memory_order_relaxed);
     }
+  };
 
-    for ( const auto& entry : expected_hes ) {
-      const HyperedgeID he = entry.first;
-      const bool visited = !entry.second;
-      if ( !visited ) {
-        LOG << "HyperedgeID" << he << "should be not part of subhypergraph!";
+  auto try_add_node = [&](const HypernodeID hn, const PartitionID block) {
+    const size_t degree = phg.nodeDegree(hn);
+    size_t current_num_pins = num_pins.load(std::memory_order_relaxed);
+    do {
+      if ( current_num_pins >= max_num_pins ) {
+        locked_block_0.store(true, std::memory_order_relaxed);
+        locked_block_1.store(true, std::memory_order_relaxed);
         return false;
       }
-    }
+    } while ( !num_pins.compare_exchange_weak(current_num_pins,
+                current_num_pins + degree, std::memory_order_relaxed) );
+
+    const bool is_block_0 = block == block_0;
+    CAtomic<HypernodeWeight>& block_weight = is_block_0 ? weight_of_block_0 : weight_of_block_1;
+    const HypernodeWeight max_weight = is_block_0 ? max_weight_block_0 : max_weight_block_1;
+    HypernodeWeight current_weight = block_weight.load(std::memory_order_relaxed);
+    do {
+      if ( current_weight >= max_weight ) {
+        ( is_block_0 ? locked_block_0 : locked_block_1 ).store(true, std::memory_order_relaxed);
+        num_pins.fetch_sub(degree, std::memory_order_relaxed);
+        return false;
+      }
+    } while ( !block_weight.compare_exchange_weak(current_weight,
+                current_weight + phg.nodeWeight(hn), std::memory_order_relaxed) );
     return true;
-  }(), "Subhypergraph construction failed!");
+  };
 
-  return sub_hg;
+  // The first level of the BFS consists of the pins of all cut hyperedges
+  // running between the involved blocks associated with the search
+  vec<HyperedgeID> cut_hes;
+  quotient_graph.doForAllCutHyperedgesOfSearch(search_id, [&](const HyperedgeID& he) {
+    cut_hes.push_back(he);
+  });
+
+  auto swap_with_next_queue = [&] {
+    bfs.queue.clear();
+    for ( typename ParallelBFSData::LocalRegion& region : bfs.local_regions ) {
+      bfs.queue.insert(bfs.queue.end(), region.next_queue.begin(), region.next_queue.end());
+      region.next_queue.clear();
+    }
+    ++current_distance;
+  };
+
+  // Threads waiting for the BFS must not steal other searches, which would
+  // then use the same thread-local data
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(UL(0), cut_hes.size(), [&](const size_t i) {
+      add_pins_of_hyperedge_to_queue(cut_hes[i], bfs.local_regions.local().next_queue);
+    });
+    swap_with_next_queue();
+
+    while ( !bfs.queue.empty() && !(is_locked(block_0) && is_locked(block_1)) ) {
+      tbb::parallel_for(UL(0), bfs.queue.size(), [&](const size_t i) {
+        const HypernodeID hn = bfs.queue[i];
+        const PartitionID block = phg.partID(hn);
+        const bool is_block_contained = block == block_0 || block == block_1;
+        if ( is_block_contained && !is_locked(block) ) {
+          typename ParallelBFSData::LocalRegion& region = bfs.local_regions.local();
+          const bool is_fixed = phg.isFixed(hn);
+          // We do not add fixed vertices to the flow problem, but still
+          // expand the BFS to its neighbors
+          if ( !is_fixed ) {
+            if ( !try_add_node(hn, block) ) {
+              return;
+            }
+            ( block == block_0 ? region.nodes_of_block_0 : region.nodes_of_block_1 ).push_back(hn);
+          }
+
+          for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+            add_pins_of_hyperedge_to_queue(he, region.next_queue);
+            if ( !is_fixed && bfs.contained_hes.compare_and_set_to_true(phg.uniqueEdgeID(he)) ) {
+              region.hes.push_back(he);
+            }
+          }
+        }
+      });
+      swap_with_next_queue();
+    }
+  });
+
+  for ( const typename ParallelBFSData::LocalRegion& region : bfs.local_regions ) {
+    sub_hg.nodes_of_block_0.insert(sub_hg.nodes_of_block_0.end(),
+      region.nodes_of_block_0.begin(), region.nodes_of_block_0.end());
+    sub_hg.nodes_of_block_1.insert(sub_hg.nodes_of_block_1.end(),
+      region.nodes_of_block_1.begin(), region.nodes_of_block_1.end());
+    sub_hg.hes.insert(sub_hg.hes.end(), region.hes.begin(), region.hes.end());
+  }
+  sub_hg.weight_of_block_0 = weight_of_block_0.load(std::memory_order_relaxed);
+  sub_hg.weight_of_block_1 = weight_of_block_1.load(std::memory_order_relaxed);
+  sub_hg.num_pins = num_pins.load(std::memory_order_relaxed);
 }
 
 template<typename TypeTraits>
@@ -226,6 +445,68 @@ void ProblemConstruction<TypeTraits>::changeNumberOfBlocks(const PartitionID new
   }
 }
 
+template<typename TypeTraits>
+bool ProblemConstruction<TypeTraits>::isUnimprovable(const SearchID search_id,
+                                                     const BlockPair& blocks) {
+  bool is_unimprovable = false;
+  if ( _skip_unchanged_problems ) {
+    ASSERT(indexOf(blocks) < _cached_problems.size());
+    const CachedProblem& problem = _cached_problems[indexOf(blocks)];
+    _cached_problems_lock.lock();
+    is_unimprovable = problem.search_id == search_id && problem.is_unimprovable;
+    _cached_problems_lock.unlock();
+  }
+  return is_unimprovable;
+}
+
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::markAsUnimprovable(const SearchID search_id,
+                                                         const BlockPair& blocks) {
+  if ( _skip_unchanged_problems ) {
+    ASSERT(indexOf(blocks) < _cached_problems.size());
+    CachedProblem& problem = _cached_problems[indexOf(blocks)];
+    _cached_problems_lock.lock();
+    if ( problem.search_id == search_id ) {
+      problem.is_unimprovable = true;
+    }
+    _cached_problems_lock.unlock();
+  }
+}
+
+template<typename TypeTraits>
+void ProblemConstruction<TypeTraits>::resetCachedProblems() {
+  if ( _reuse_problems ) {
+    const size_t num_block_pairs = static_cast<size_t>(_context.partition.k) * _context.partition.k;
+    if ( _cached_problems.size() < num_block_pairs ) {
+      _cached_problems.resize(num_block_pairs);
+    }
+    for ( CachedProblem& problem : _cached_problems ) {
+      problem.is_valid = false;
+      problem.search_id = QuotientGraph<TypeTraits>::INVALID_SEARCH_ID;
+      problem.is_unimprovable = false;
+    }
+  }
+}
+
+template<typename TypeTraits>
+bool ProblemConstruction<TypeTraits>::isCachedProblemValid(const CachedProblem& problem,
+                                                           const size_t num_cut_hes,
+                                                           const PartitionedHypergraph& phg) const {
+  if ( problem.num_cut_hes != num_cut_hes ) {
+    // New cut hyperedges can change the start of the BFS
+    return false;
+  }
+  // Each move changes the pin counts of all incident hyperedges of the moved node.
+  // Since the problem contains all incident hyperedges of its nodes, it is still
+  // valid if none of its hyperedges changed after its construction.
+  for ( const HyperedgeID& he : problem.sub_hg.hes ) {
+    if ( _he_versions[phg.uniqueEdgeID(he)].load(std::memory_order_relaxed) >= problem.version ) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template<typename TypeTraits>
 MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool ProblemConstruction<TypeTraits>::isMaximumProblemSizeReached(
   const Subhypergraph& sub_hg,
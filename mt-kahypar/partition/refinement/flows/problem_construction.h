@@ -30,6 +30,7 @@
 
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
 #include "mt-kahypar/partition/refinement/flows/refiner_adapter.h"
 #include "mt-kahypar/partition/refinement/flows/quotient_graph.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
@@ -104,6 +105,57 @@ class ProblemConstruction {
     bool lock_queue;
   };
 
+  /**
+   * Contains data required to grow the region around the cut with a
+   * level-synchronous parallel BFS, which is used if more than one thread
+   * is assigned to a search. The flag arrays can be reset in constant time.
+   */
+  struct ParallelBFSData {
+    struct LocalRegion {
+      vec<HypernodeID> next_queue;
+      vec<HypernodeID> nodes_of_block_0;
+      vec<HypernodeID> nodes_of_block_1;
+      vec<HyperedgeID> hes;
+    };
+
+    ParallelBFSData() :
+      queue(),
+      visited_hn(),
+      visited_he(),
+      contained_hes(),
+      local_regions() { }
+
+    void reset(const HypernodeID num_nodes, const HyperedgeID num_edges);
+
+    vec<HypernodeID> queue;
+    ds::ThreadSafeFastResetFlagArray<> visited_hn;
+    ds::ThreadSafeFastResetFlagArray<> visited_he;
+    ds::ThreadSafeFastResetFlagArray<> contained_hes;
+    tbb::enumerable_thread_specific<LocalRegion> local_regions;
+  };
+
+  /**
+   * Region of a block pair constructed in a previous search. It can be reused
+   * if no move sequence touched one of its hyperedges and no new cut hyperedge
+   * was added to the block pair since its construction.
+   * If a flow computation on an unchanged problem found no improvement, it would
+   * compute the same maximum flow again as long as the weights of both blocks
+   * (which determine the weights of source and sink) are unchanged.
+   */
+  struct CachedProblem {
+    Subhypergraph sub_hg;
+    uint32_t version = 0;
+    size_t num_cut_hes = 0;
+    bool is_valid = false;
+    // ! Search that constructed or reused the problem last and the
+    // ! weights of both blocks at that time
+    SearchID search_id = QuotientGraph<TypeTraits>::INVALID_SEARCH_ID;
+    HypernodeWeight weight_of_block_0 = 0;
+    HypernodeWeight weight_of_block_1 = 0;
+    // ! True, if a flow computation on the problem found no improvement
+    bool is_unimprovable = false;
+  };
+
  public:
   explicit ProblemConstruction(const HypernodeID num_hypernodes,
                                const HyperedgeID num_hyperedges,
@@ -119,7 +171,14 @@ class ProblemConstruction {
         // blocks from the context
         return constructBFSData();
       }
-    ) { }
+    ),
+    _local_parallel_bfs(),
+    _reuse_problems(context.refinement.flows.reuse_problem_construction),
+    _skip_unchanged_problems(_reuse_problems && context.refinement.flows.skip_unchanged_problems),
+    _current_version(1),
+    _he_versions(_reuse_problems ? num_hyperedges : 0),
+    _cached_problems(),
+    _cached_problems_lock() { }
 
   ProblemConstruction(const ProblemConstruction&) = delete;
   ProblemConstruction(ProblemConstruction&&) = delete;
@@ -127,23 +186,80 @@ class ProblemConstruction {
   ProblemConstruction & operator= (const ProblemConstruction &) = delete;
   ProblemConstruction & operator= (ProblemConstruction &&) = delete;
 
+  // ! Grows a region around the cut of the block pair of the search. If more than
+  // ! one thread is assigned to the search, the region is grown in parallel.
   Subhypergraph construct(const SearchID search_id,
                           QuotientGraph<TypeTraits>& quotient_graph,
-                          const PartitionedHypergraph& phg);
+                          const PartitionedHypergraph& phg,
+                          const size_t num_threads = 1);
 
   void changeNumberOfBlocks(const PartitionID new_k);
 
+  // ! Returns true, if the problem constructed for the search is a reused problem on which
+  // ! a previous flow computation found no improvement and the weights of both blocks did
+  // ! not change since then. The flow computation can be skipped in this case.
+  bool isUnimprovable(const SearchID search_id, const BlockPair& blocks);
+
+  // ! Signals that the flow computation on the problem of the search found no improvement.
+  // ! Has no effect if the problem of the block pair was reconstructed in the meantime.
+  void markAsUnimprovable(const SearchID search_id, const BlockPair& blocks);
+
+  // ! Invalidates all cached problems. Must be called if the
+  // ! partition was modified outside of the flow refinement.
+  void resetCachedProblems();
+
+  // ! Signals that a new move sequence is applied to the partition.
+  // ! Move sequences must be applied one after another.
+  void startMoveSequence() {
+    if ( _reuse_problems ) {
+      ++_current_version;
+    }
+  }
+
+  // ! Signals that the current move sequence changed the pin
+  // ! count of hyperedge he, which invalidates all cached problems
+  // ! that contain he
+  void notifyChangedHyperedge(const HyperedgeID unique_he) {
+    if ( _reuse_problems ) {
+      ASSERT(unique_he < _he_versions.size());
+      _he_versions[unique_he].store(
+        _current_version.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+  }
+
  private:
   BFSData constructBFSData() const {
     return BFSData(_num_hypernodes, _num_hyperedges, _context.partition.k);
   }
 
+  void growRegionSequentially(const SearchID search_id,
+                              QuotientGraph<TypeTraits>& quotient_graph,
+                              const PartitionedHypergraph& phg,
+                              const HypernodeWeight max_weight_block_0,
+                              const HypernodeWeight max_weight_block_1,
+                              Subhypergraph& sub_hg);
+
+  void growRegionInParallel(const SearchID search_id,
+                            QuotientGraph<TypeTraits>& quotient_graph,
+                            const PartitionedHypergraph& phg,
+                            const HypernodeWeight max_weight_block_0,
+                            const HypernodeWeight max_weight_block_1,
+                            Subhypergraph& sub_hg);
+
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE bool isMaximumProblemSizeReached(
     const Subhypergraph& sub_hg,
     const HypernodeWeight max_weight_block_0,
     const HypernodeWeight max_weight_block_1,
     vec<bool>& locked_blocks) const;
 
+  bool isCachedProblemValid(const CachedProblem& problem,
+                            const size_t num_cut_hes,
+                            const PartitionedHypergraph& phg) const;
+
+  size_t indexOf(const BlockPair& blocks) const {
+    return static_cast<size_t>(blocks.i) * _context.partition.k + blocks.j;
+  }
+
   const Context& _context;
   double _scaling;
   HypernodeID _num_hypernodes;
@@ -151,6 +267,22 @@ class ProblemConstruction {
 
   // ! Contains data required for BFS construction algorithm
   tbb::enumerable_thread_specific<BFSData> _local_bfs;
+  // ! Contains data required for the parallel BFS construction algorithm
+  // ! (allocated on first use)
+  tbb::enumerable_thread_specific<ParallelBFSData> _local_parallel_bfs;
+
+  bool _reuse_problems;
+  bool _skip_unchanged_problems;
+  // ! Number of move sequences applied so far
+  CAtomic<uint32_t> _current_version;
+  // ! For each hyperedge, the last move sequence that changed it
+  vec<CAtomic<uint32_t>> _he_versions;
+  // ! Last constructed problem of each block pair. Note that only one search
+  // ! at a time constructs a problem on a block pair, so no locking is required.
+  vec<CachedProblem> _cached_problems;
+  // ! A search can mark a problem as unimprovable while a search on the
+  // ! same block pair constructs a new one
+  SpinLock _cached_problems_lock;
 };
 
 }  // namespace kahypar
@@ -28,6 +28,7 @@
 #include "mt-kahypar/partition/refinement/flows/quotient_graph.h"
 
 #include <queue>
+#include <tuple>
 
 #include <tbb/parallel_sort.h>
 
@@ -58,8 +59,34 @@ template<typename TypeTraits>
 bool QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::popBlockPairFromQueue(BlockPair& blocks) {
   blocks.i = kInvalidPartition;
   blocks.j = kInvalidPartition;
-  if ( _unscheduled_blocks.try_pop(blocks) ) {
-    _quotient_graph[blocks.i][blocks.j].markAsNotInQueue();
+  ScheduledBlockPair scheduled_blocks;
+  if ( _unscheduled_blocks.try_pop(scheduled_blocks) ) {
+    blocks = scheduled_blocks.blocks;
+    _quotient_graph.edge(blocks.i, blocks.j).markAsNotInQueue();
+  }
+  return blocks.i != kInvalidPartition && blocks.j != kInvalidPartition;
+}
+
+template<typename TypeTraits>
+bool QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::popNonConflictingBlockPairFromQueue(
+  BlockPair& blocks, const vec<uint32_t>& num_searches_of_block) {
+  blocks.i = kInvalidPartition;
+  blocks.j = kInvalidPartition;
+  // Block pairs that share a block with a running search are put back afterwards
+  // such that they keep their position in the queue
+  vec<ScheduledBlockPair> conflicting_blocks;
+  ScheduledBlockPair scheduled_blocks;
+  while ( _unscheduled_blocks.try_pop(scheduled_blocks) ) {
+    if ( num_searches_of_block[scheduled_blocks.blocks.i] == 0 &&
+         num_searches_of_block[scheduled_blocks.blocks.j] == 0 ) {
+      blocks = scheduled_blocks.blocks;
+      _quotient_graph.edge(blocks.i, blocks.j).markAsNotInQueue();
+      break;
+    }
+    conflicting_blocks.push_back(scheduled_blocks);
+  }
+  for ( const ScheduledBlockPair& conflicting : conflicting_blocks ) {
+    _unscheduled_blocks.push(conflicting);
   }
   return blocks.i != kInvalidPartition && blocks.j != kInvalidPartition;
 }
@@ -83,9 +110,9 @@ void QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::finalizeSearch(const
 
 template<typename TypeTraits>
 bool QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::pushBlockPairIntoQueue(const BlockPair& blocks) {
-  QuotientGraphEdge& qg_edge = _quotient_graph[blocks.i][blocks.j];
+  QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
   if ( qg_edge.markAsInQueue() ) {
-    _unscheduled_blocks.push(blocks);
+    _unscheduled_blocks.push(ScheduledBlockPair { blocks, priority(qg_edge), _num_pushed_blocks++ });
     ++_remaining_blocks;
     return true;
   } else {
@@ -93,46 +120,54 @@ bool QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::pushBlockPairIntoQue
   }
 }
 
+template<typename TypeTraits>
+double QuotientGraph<TypeTraits>::ActiveBlockSchedulingRound::priority(const QuotientGraphEdge& qg_edge) const {
+  if ( _context.refinement.flows.prioritize_block_pairs ) {
+    return qg_edge.expectedImprovement();
+  } else if ( _context.refinement.flows.matching_based_scheduling ) {
+    // Heavier block pairs are matched first
+    return qg_edge.cut_he_weight.load(std::memory_order_relaxed);
+  }
+  return 0.0;
+}
+
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::ActiveBlockScheduler::initialize(const vec<uint8_t>& active_blocks,
                                                                  const bool is_input_hypergraph) {
   reset();
   _is_input_hypergraph = is_input_hypergraph;
-
-  HyperedgeWeight best_total_improvement = 1;
-  for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-    for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-      best_total_improvement = std::max(best_total_improvement,
-        _quotient_graph[i][j].total_improvement.load(std::memory_order_relaxed));
-    }
+  if ( _context.refinement.flows.matching_based_scheduling ) {
+    _num_searches_of_block.assign(_context.partition.k, 0);
   }
 
-  vec<BlockPair> active_block_pairs;
-  for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-    for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-      if ( isActiveBlockPair(i, j) && ( active_blocks[i] || active_blocks[j] ) ) {
-        active_block_pairs.push_back( BlockPair { i, j } );
-      }
+  // Only block pairs that are adjacent in the quotient graph can become active
+  vec<const QuotientGraphEdge*> active_block_pairs;
+  _quotient_graph.doForAllEdges([&](const QuotientGraphEdge& qg_edge) {
+    if ( isActiveBlockPair(qg_edge) &&
+         ( active_blocks[qg_edge.blocks.i] || active_blocks[qg_edge.blocks.j] ) ) {
+      active_block_pairs.push_back(&qg_edge);
     }
-  }
+  });
 
   if ( active_block_pairs.size() > 0 ) {
+    // Edges are stored in the order in which they were created, which depends on the
+    // thread schedule => ties are broken by the block IDs
     std::sort(active_block_pairs.begin(), active_block_pairs.end(),
-      [&](const BlockPair& lhs, const BlockPair& rhs) {
-        return _quotient_graph[lhs.i][lhs.j].total_improvement >
-          _quotient_graph[rhs.i][rhs.j].total_improvement ||
-          ( _quotient_graph[lhs.i][lhs.j].total_improvement ==
-            _quotient_graph[rhs.i][rhs.j].total_improvement &&
-            _quotient_graph[lhs.i][lhs.j].cut_he_weight >
-            _quotient_graph[rhs.i][rhs.j].cut_he_weight );
+      [&](const QuotientGraphEdge* lhs, const QuotientGraphEdge* rhs) {
+        const HyperedgeWeight lhs_improvement = lhs->total_improvement.load(std::memory_order_relaxed);
+        const HyperedgeWeight rhs_improvement = rhs->total_improvement.load(std::memory_order_relaxed);
+        const HyperedgeWeight lhs_cut_weight = lhs->cut_he_weight.load(std::memory_order_relaxed);
+        const HyperedgeWeight rhs_cut_weight = rhs->cut_he_weight.load(std::memory_order_relaxed);
+        return std::tie(rhs_improvement, rhs_cut_weight, lhs->blocks.i, lhs->blocks.j) <
+          std::tie(lhs_improvement, lhs_cut_weight, rhs->blocks.i, rhs->blocks.j);
       });
     _rounds.emplace_back(_context, _quotient_graph);
     ++_num_rounds;
-    for ( const BlockPair& blocks : active_block_pairs ) {
-      DBG << "Schedule blocks (" << blocks.i << "," << blocks.j << ") in round 1 ("
-          << "Total Improvement =" << _quotient_graph[blocks.i][blocks.j].total_improvement << ","
-          << "Cut Weight =" << _quotient_graph[blocks.i][blocks.j].cut_he_weight << ")";
-      _rounds.back().pushBlockPairIntoQueue(blocks);
+    for ( const QuotientGraphEdge* qg_edge : active_block_pairs ) {
+      DBG << "Schedule blocks (" << qg_edge->blocks.i << "," << qg_edge->blocks.j << ") in round 1 ("
+          << "Total Improvement =" << qg_edge->total_improvement << ","
+          << "Cut Weight =" << qg_edge->cut_he_weight << ")";
+      _rounds.back().pushBlockPairIntoQueue(qg_edge->blocks);
     }
   }
 }
@@ -140,13 +175,19 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::initialize(const vec<uint8
 template<typename TypeTraits>
 bool QuotientGraph<TypeTraits>::ActiveBlockScheduler::popBlockPairFromQueue(BlockPair& blocks, size_t& round) {
   bool success = false;
-  round = _first_active_round;
-  while ( !_terminate && round < _num_rounds ) {
-    success = _rounds[round].popBlockPairFromQueue(blocks);
+  if ( _context.refinement.flows.matching_based_scheduling ) {
+    _matching_lock.lock();
+    // A block pair that conflicts with a running search is only scheduled
+    // if there is no other block pair left. Otherwise, the thread would idle.
+    success = popNonConflictingBlockPairFromQueueOfRounds(blocks, round) ||
+      popBlockPairFromQueueOfRounds(blocks, round);
     if ( success ) {
-      break;
+      ++_num_searches_of_block[blocks.i];
+      ++_num_searches_of_block[blocks.j];
     }
-    ++round;
+    _matching_lock.unlock();
+  } else {
+    success = popBlockPairFromQueueOfRounds(blocks, round);
   }
 
   if ( success && round == _num_rounds - 1 ) {
@@ -168,6 +209,13 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
                                                          const size_t round,
                                                          const HyperedgeWeight improvement) {
   ASSERT(round < _rounds.size());
+  if ( _context.refinement.flows.matching_based_scheduling ) {
+    _matching_lock.lock();
+    ASSERT(_num_searches_of_block[blocks.i] > 0 && _num_searches_of_block[blocks.j] > 0);
+    --_num_searches_of_block[blocks.i];
+    --_num_searches_of_block[blocks.j];
+    _matching_lock.unlock();
+  }
   bool block_0_becomes_active = false;
   bool block_1_becomes_active = false;
   _rounds[round].finalizeSearch(blocks, improvement,
@@ -175,40 +223,17 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
 
   if ( block_0_becomes_active ) {
     // If blocks.i becomes active, we push all adjacent blocks into the queue of the next round
-    ASSERT(round + 1 < _rounds.size());
-    for ( PartitionID other = 0; other < _context.partition.k; ++other ) {
-      if ( blocks.i != other ) {
-        const PartitionID block_0 = std::min(blocks.i, other);
-        const PartitionID block_1 = std::max(blocks.i, other);
-        if ( isActiveBlockPair(block_0, block_1) ) {
-          DBG << "Schedule blocks (" << block_0 << "," << block_1 << ") in round" << (round + 2) << " ("
-              << "Total Improvement =" << _quotient_graph[block_0][block_1].total_improvement << ","
-              << "Cut Weight =" << _quotient_graph[block_0][block_1].cut_he_weight << ")";
-          _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { block_0, block_1 });
-        }
-      }
-    }
+    scheduleIncidentBlockPairs(blocks.i, round + 1);
   }
 
   if ( block_1_becomes_active ) {
     // If blocks.j becomes active, we push all adjacent blocks into the queue of the next round
-    ASSERT(round + 1 < _rounds.size());
-    for ( PartitionID other = 0; other < _context.partition.k; ++other ) {
-      if ( blocks.j != other ) {
-        const PartitionID block_0 = std::min(blocks.j, other);
-        const PartitionID block_1 = std::max(blocks.j, other);
-        if ( isActiveBlockPair(block_0, block_1) ) {
-          DBG << "Schedule blocks (" << block_0 << "," << block_1 << ") in round" << (round + 2) << " ("
-              << "Total Improvement =" << _quotient_graph[block_0][block_1].total_improvement << ","
-              << "Cut Weight =" << _quotient_graph[block_0][block_1].cut_he_weight << ")";
-          _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { block_0, block_1 });
-        }
-      }
-    }
+    scheduleIncidentBlockPairs(blocks.j, round + 1);
   }
 
   // Special case
-  if ( improvement > 0 && !_quotient_graph[blocks.i][blocks.j].isInQueue() && isActiveBlockPair(blocks.i, blocks.j) &&
+  const QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
+  if ( improvement > 0 && !qg_edge.isInQueue() && isActiveBlockPair(qg_edge) &&
        ( _rounds[round].isActive(blocks.i) || _rounds[round].isActive(blocks.j) ) ) {
         // The active block scheduling strategy works in multiple rounds and each contain a separate queue
         // to store active block pairs. A block pair is only allowed to be contained in one queue.
@@ -217,8 +242,8 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
         // a previous round, which are then not scheduled in the next round. If this edge is scheduled and
         // leads to an improvement, we schedule it in the next round here.
         DBG << "Schedule blocks (" << blocks.i << "," << blocks.j << ") in round" << (round + 2) << " ("
-            << "Total Improvement =" << _quotient_graph[blocks.i][blocks.j].total_improvement << ","
-            << "Cut Weight =" << _quotient_graph[blocks.i][blocks.j].cut_he_weight << ")";
+            << "Total Improvement =" << qg_edge.total_improvement << ","
+            << "Cut Weight =" << qg_edge.cut_he_weight << ")";
         _rounds[round + 1].pushBlockPairIntoQueue(BlockPair { blocks.i, blocks.j });
   }
 
@@ -241,16 +266,55 @@ void QuotientGraph<TypeTraits>::ActiveBlockScheduler::finalizeSearch(const Block
 }
 
 template<typename TypeTraits>
-bool QuotientGraph<TypeTraits>::ActiveBlockScheduler::isActiveBlockPair(const PartitionID i,
-                                                                        const PartitionID j) const {
+bool QuotientGraph<TypeTraits>::ActiveBlockScheduler::popBlockPairFromQueueOfRounds(BlockPair& blocks,
+                                                                                    size_t& round) {
+  round = _first_active_round;
+  while ( !_terminate && round < _num_rounds ) {
+    if ( _rounds[round].popBlockPairFromQueue(blocks) ) {
+      return true;
+    }
+    ++round;
+  }
+  return false;
+}
+
+template<typename TypeTraits>
+bool QuotientGraph<TypeTraits>::ActiveBlockScheduler::popNonConflictingBlockPairFromQueueOfRounds(BlockPair& blocks,
+                                                                                                  size_t& round) {
+  round = _first_active_round;
+  while ( !_terminate && round < _num_rounds ) {
+    if ( _rounds[round].popNonConflictingBlockPairFromQueue(blocks, _num_searches_of_block) ) {
+      return true;
+    }
+    ++round;
+  }
+  return false;
+}
+
+template<typename TypeTraits>
+void QuotientGraph<TypeTraits>::ActiveBlockScheduler::scheduleIncidentBlockPairs(const PartitionID block,
+                                                                                 const size_t round) {
+  ASSERT(round < _rounds.size());
+  _quotient_graph.doForAllIncidentEdges(block, [&](const QuotientGraphEdge& qg_edge) {
+    if ( isActiveBlockPair(qg_edge) ) {
+      DBG << "Schedule blocks (" << qg_edge.blocks.i << "," << qg_edge.blocks.j << ") in round" << (round + 1) << " ("
+          << "Total Improvement =" << qg_edge.total_improvement << ","
+          << "Cut Weight =" << qg_edge.cut_he_weight << ")";
+      _rounds[round].pushBlockPairIntoQueue(qg_edge.blocks);
+    }
+  });
+}
+
+template<typename TypeTraits>
+bool QuotientGraph<TypeTraits>::ActiveBlockScheduler::isActiveBlockPair(const QuotientGraphEdge& qg_edge) const {
   const bool skip_small_cuts = !_is_input_hypergraph &&
     _context.refinement.flows.skip_small_cuts;
   const bool contains_enough_cut_hes =
-    (skip_small_cuts && _quotient_graph[i][j].cut_he_weight > 10) ||
-    (!skip_small_cuts && _quotient_graph[i][j].cut_he_weight > 0);
+    (skip_small_cuts && qg_edge.cut_he_weight > 10) ||
+    (!skip_small_cuts && qg_edge.cut_he_weight > 0);
   const bool is_promising_blocks_pair =
     !_context.refinement.flows.skip_unpromising_blocks ||
-      ( _first_active_round == 0 || _quotient_graph[i][j].num_improvements_found > 0 );
+      ( _first_active_round == 0 || qg_edge.num_improvements_found > 0 );
   return contains_enough_cut_hes && is_promising_blocks_pair;
 }
 
@@ -264,7 +328,7 @@ SearchID QuotientGraph<TypeTraits>::requestNewSearch(FlowRefinerAdapter<TypeTrai
   _register_search_lock.lock();
 
   const SearchID tmp_search_id = _searches.size();
-  if ( success && _quotient_graph[blocks.i][blocks.j].acquire(tmp_search_id) ) {
+  if ( success && _quotient_graph.edge(blocks.i, blocks.j).acquire(tmp_search_id) ) {
     ++_num_active_searches;
     // Create new search
     search_id = tmp_search_id;
@@ -283,6 +347,68 @@ SearchID QuotientGraph<TypeTraits>::requestNewSearch(FlowRefinerAdapter<TypeTrai
   return search_id;
 }
 
+template<typename TypeTraits>
+vec<BlockPair> QuotientGraph<TypeTraits>::deterministicBlockPairs(const vec<uint8_t>& active_blocks,
+                                                                  const size_t round) const {
+  const bool skip_small_cuts = !isInputHypergraph() &&
+    _context.refinement.flows.skip_small_cuts;
+  vec<const QuotientGraphEdge*> qg_edges;
+  _quotient_graph.doForAllEdges([&](const QuotientGraphEdge& qg_edge) {
+    const bool contains_enough_cut_hes =
+      qg_edge.cut_he_weight.load(std::memory_order_relaxed) > (skip_small_cuts ? 10 : 0);
+    const bool is_promising_blocks_pair =
+      !_context.refinement.flows.skip_unpromising_blocks ||
+        ( round == 0 || qg_edge.num_improvements_found.load(std::memory_order_relaxed) > 0 );
+    if ( ( active_blocks[qg_edge.blocks.i] || active_blocks[qg_edge.blocks.j] ) &&
+         contains_enough_cut_hes && is_promising_blocks_pair ) {
+      qg_edges.push_back(&qg_edge);
+    }
+  });
+
+  std::sort(qg_edges.begin(), qg_edges.end(),
+    [&](const QuotientGraphEdge* lhs, const QuotientGraphEdge* rhs) {
+      const HyperedgeWeight lhs_improvement = lhs->total_improvement.load(std::memory_order_relaxed);
+      const HyperedgeWeight rhs_improvement = rhs->total_improvement.load(std::memory_order_relaxed);
+      const HyperedgeWeight lhs_cut_weight = lhs->cut_he_weight.load(std::memory_order_relaxed);
+      const HyperedgeWeight rhs_cut_weight = rhs->cut_he_weight.load(std::memory_order_relaxed);
+      return std::tie(rhs_improvement, rhs_cut_weight, lhs->blocks.i, lhs->blocks.j) <
+        std::tie(lhs_improvement, lhs_cut_weight, rhs->blocks.i, rhs->blocks.j);
+    });
+
+  vec<BlockPair> block_pairs;
+  block_pairs.reserve(qg_edges.size());
+  for ( const QuotientGraphEdge* qg_edge : qg_edges ) {
+    block_pairs.push_back(qg_edge->blocks);
+  }
+  return block_pairs;
+}
+
+template<typename TypeTraits>
+SearchID QuotientGraph<TypeTraits>::registerDeterministicSearch(const BlockPair& blocks) {
+  ASSERT(_phg);
+  const SearchID search_id = _searches.size();
+  const bool success = _quotient_graph.edge(blocks.i, blocks.j).acquire(search_id);
+  ASSERT(success); unused(success);
+  ++_num_active_searches;
+  _searches.emplace_back(blocks, 0);
+  return search_id;
+}
+
+template<typename TypeTraits>
+void QuotientGraph<TypeTraits>::finalizeDeterministicSearch(const SearchID search_id,
+                                                            const HyperedgeWeight total_improvement) {
+  ASSERT(search_id < _searches.size());
+  ASSERT(_searches[search_id].is_finalized);
+  const BlockPair& blocks = _searches[search_id].blocks;
+  QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
+  ++qg_edge.num_searches;
+  if ( total_improvement > 0 ) {
+    ++qg_edge.num_improvements_found;
+    qg_edge.total_improvement += total_improvement;
+  }
+  --_num_active_searches;
+}
+
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::addNewCutHyperedge(const HyperedgeID he,
                                                    const PartitionID block) {
@@ -291,7 +417,7 @@ void QuotientGraph<TypeTraits>::addNewCutHyperedge(const HyperedgeID he,
   // Add hyperedge he as a cut hyperedge to each block pair that contains 'block'
   for ( const PartitionID& other_block : _phg->connectivitySet(he) ) {
     if ( other_block != block ) {
-      _quotient_graph[std::min(block, other_block)][std::max(block, other_block)]
+      _quotient_graph.edge(std::min(block, other_block), std::max(block, other_block))
         .add_hyperedge(he, _phg->edgeWeight(he));
     }
   }
@@ -302,7 +428,7 @@ void QuotientGraph<TypeTraits>::finalizeConstruction(const SearchID search_id) {
   ASSERT(search_id < _searches.size());
   _searches[search_id].is_finalized = true;
   const BlockPair& blocks = _searches[search_id].blocks;
-  _quotient_graph[blocks.i][blocks.j].release(search_id);
+  _quotient_graph.edge(blocks.i, blocks.j).release(search_id);
 }
 
 template<typename TypeTraits>
@@ -313,7 +439,8 @@ void QuotientGraph<TypeTraits>::finalizeSearch(const SearchID search_id,
   ASSERT(_searches[search_id].is_finalized);
 
   const BlockPair& blocks = _searches[search_id].blocks;
-  QuotientGraphEdge& qg_edge = _quotient_graph[blocks.i][blocks.j];
+  QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
+  ++qg_edge.num_searches;
   if ( total_improvement > 0 ) {
     // If the search improves the quality of the partition, we reinsert
     // all hyperedges that were used by the search and are still cut.
@@ -336,7 +463,8 @@ void QuotientGraph<TypeTraits>::initialize(const PartitionedHypergraph& phg) {
   _num_active_searches.store(0, std::memory_order_relaxed);
   _searches.clear();
 
-  // Find all cut hyperedges between the blocks
+  // Find all cut hyperedges between the blocks. Edges of the quotient
+  // graph are only created for block pairs that are actually adjacent.
   tbb::enumerable_thread_specific<HyperedgeID> local_num_hes(0);
   phg.doParallelForAllEdges([&](const HyperedgeID he) {
     ++local_num_hes.local();
@@ -344,7 +472,7 @@ void QuotientGraph<TypeTraits>::initialize(const PartitionedHypergraph& phg) {
     for ( const PartitionID i : phg.connectivitySet(he) ) {
       for ( const PartitionID j : phg.connectivitySet(he) ) {
         if ( i < j ) {
-          _quotient_graph[i][j].add_hyperedge(he, edge_weight);
+          _quotient_graph.edge(i, j).add_hyperedge(he, edge_weight);
         }
       }
     }
@@ -359,17 +487,7 @@ void QuotientGraph<TypeTraits>::initialize(const PartitionedHypergraph& phg) {
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::changeNumberOfBlocks(const PartitionID new_k) {
   // Reset improvement history as the number of blocks had changed
-  for ( size_t i = 0; i < _quotient_graph.size(); ++i ) {
-    for ( size_t j = 0; j < _quotient_graph.size(); ++j ) {
-      _quotient_graph[i][j].num_improvements_found.store(0, std::memory_order_relaxed);
-      _quotient_graph[i][j].total_improvement.store(0, std::memory_order_relaxed);
-    }
-  }
-
-  if ( static_cast<size_t>(new_k) > _quotient_graph.size() ) {
-    _quotient_graph.clear();
-    _quotient_graph.assign(new_k, vec<QuotientGraphEdge>(new_k));
-  }
+  _quotient_graph.reset(new_k);
 }
 
 template<typename TypeTraits>
@@ -379,11 +497,9 @@ size_t QuotientGraph<TypeTraits>::numActiveBlockPairs() const {
 
 template<typename TypeTraits>
 void QuotientGraph<TypeTraits>::resetQuotientGraphEdges() {
-  for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-    for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-      _quotient_graph[i][j].reset();
-    }
-  }
+  _quotient_graph.doForAllEdges([&](QuotientGraphEdge& qg_edge) {
+    qg_edge.reset();
+  });
 }
 
 INSTANTIATE_CLASS_WITH_TYPE_TRAITS(QuotientGraph)
@@ -26,7 +26,8 @@
 
 #pragma once
 
-#include <tbb/concurrent_queue.h>
+#include <tbb/concurrent_hash_map.h>
+#include <tbb/concurrent_priority_queue.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/enumerable_thread_specific.h>
 
@@ -34,6 +35,7 @@
 #include "mt-kahypar/partition/refinement/flows/refiner_adapter.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/randomize.h"
+#include "mt-kahypar/utils/reproducible_random.h"
 
 namespace mt_kahypar {
 
@@ -59,6 +61,7 @@ class QuotientGraph {
       cut_hes(),
       num_cut_hes(0),
       cut_he_weight(0),
+      num_searches(0),
       num_improvements_found(0),
       total_improvement(0) { }
 
@@ -106,6 +109,16 @@ class QuotientGraph {
       return is_in_queue.compare_exchange_strong(expected, desired);
     }
 
+    // ! Cheap predictor for the improvement of a search on this block pair.
+    // ! Weights the current cut by the (smoothed) fraction of previous
+    // ! searches on this block pair that found an improvement.
+    double expectedImprovement() const {
+      const double success_rate =
+        ( static_cast<double>(num_improvements_found.load(std::memory_order_relaxed)) + 1.0 ) /
+        ( static_cast<double>(num_searches.load(std::memory_order_relaxed)) + 2.0 );
+      return success_rate * cut_he_weight.load(std::memory_order_relaxed);
+    }
+
     // ! Block pair this quotient graph edge represents
     BlockPair blocks;
     // ! Atomic that contains the search currently constructing
@@ -119,23 +132,179 @@ class QuotientGraph {
     CAtomic<size_t> num_cut_hes;
     // ! Current weight of all cut hyperedges
     CAtomic<HyperedgeWeight> cut_he_weight;
+    // ! Number of searches performed on this block pair
+    CAtomic<size_t> num_searches;
     // ! Number of improvements found on this block pair
     CAtomic<size_t> num_improvements_found;
     // ! Total improvement found on this block pair
     CAtomic<HyperedgeWeight> total_improvement;
   };
 
+  /**
+   * Sparse representation of the quotient graph that only stores edges
+   * between adjacent blocks. An edge is created when the first cut hyperedge
+   * between its two blocks is registered and is not removed until the number
+   * of blocks changes. Edges are stored in a concurrent vector, which means that
+   * references to them remain valid while new edges are inserted concurrently.
+   * For small k, edges are located via a dense k x k index table, otherwise
+   * via a concurrent hash map.
+   */
+  class SparseQuotientGraph {
+
+    static constexpr size_t INVALID_EDGE = std::numeric_limits<size_t>::max();
+    static constexpr PartitionID MAX_K_FOR_DENSE_INDEX = 256;
+
+    using EdgeIndex = tbb::concurrent_hash_map<uint64_t, size_t>;
+
+   public:
+    explicit SparseQuotientGraph(const PartitionID k) :
+      _k(0),
+      _edges(),
+      _dense_index(),
+      _edge_index(),
+      _create_lock(),
+      _incident_edges() {
+      reset(k);
+    }
+
+    // ! Removes all edges
+    void reset(const PartitionID k) {
+      _k = k;
+      _edges.clear();
+      _edge_index.clear();
+      _dense_index.clear();
+      if ( _k <= MAX_K_FOR_DENSE_INDEX ) {
+        _dense_index.assign(static_cast<size_t>(_k) * _k, CAtomic<size_t>(INVALID_EDGE));
+      }
+      _incident_edges.assign(_k, vec<size_t>());
+    }
+
+    // ! Returns the edge between block i and j (i < j) or nullptr,
+    // ! if both blocks are not adjacent
+    const QuotientGraphEdge* find(const PartitionID i, const PartitionID j) const {
+      const size_t idx = findIndex(i, j);
+      return idx != INVALID_EDGE ? &_edges[idx] : nullptr;
+    }
+
+    // ! Returns the edge between block i and j (i < j). The edge is created,
+    // ! if both blocks were not adjacent before (thread-safe).
+    QuotientGraphEdge& edge(const PartitionID i, const PartitionID j) {
+      size_t idx = findIndex(i, j);
+      if ( idx == INVALID_EDGE ) {
+        _create_lock.lock();
+        idx = findIndex(i, j);
+        if ( idx == INVALID_EDGE ) {
+          idx = createEdge(i, j);
+        }
+        _create_lock.unlock();
+      }
+      return _edges[idx];
+    }
+
+    // ! Number of edges. Only reliable if no edges are inserted concurrently.
+    size_t numEdges() const {
+      return _edges.size();
+    }
+
+    template<typename F>
+    void doForAllEdges(const F& f) {
+      for ( QuotientGraphEdge& qg_edge : _edges ) {
+        f(qg_edge);
+      }
+    }
+
+    template<typename F>
+    void doForAllEdges(const F& f) const {
+      for ( const QuotientGraphEdge& qg_edge : _edges ) {
+        f(qg_edge);
+      }
+    }
+
+    // ! Calls f for all edges incident to the corresponding block.
+    // ! Edges inserted concurrently may or may not be visited.
+    template<typename F>
+    void doForAllIncidentEdges(const PartitionID block, const F& f) {
+      ASSERT(block < _k);
+      _create_lock.lock();
+      const vec<size_t> incident_edges = _incident_edges[block];
+      _create_lock.unlock();
+      for ( const size_t idx : incident_edges ) {
+        f(_edges[idx]);
+      }
+    }
+
+   private:
+    uint64_t key(const PartitionID i, const PartitionID j) const {
+      ASSERT(0 <= i && i < j && j < _k);
+      return static_cast<uint64_t>(i) * _k + j;
+    }
+
+    size_t findIndex(const PartitionID i, const PartitionID j) const {
+      if ( !_dense_index.empty() ) {
+        return _dense_index[key(i, j)].load(std::memory_order_acquire);
+      } else {
+        typename EdgeIndex::const_accessor acc;
+        return _edge_index.find(acc, key(i, j)) ? acc->second : INVALID_EDGE;
+      }
+    }
+
+    // ! Must be called while holding the create lock
+    size_t createEdge(const PartitionID i, const PartitionID j) {
+      auto it = _edges.grow_by(1);
+      it->blocks = BlockPair { i, j };
+      const size_t idx = std::distance(_edges.begin(), it);
+      _incident_edges[i].push_back(idx);
+      _incident_edges[j].push_back(idx);
+      // Publish the edge after it is fully constructed
+      if ( !_dense_index.empty() ) {
+        _dense_index[key(i, j)].store(idx, std::memory_order_release);
+      } else {
+        _edge_index.insert(std::make_pair(key(i, j), idx));
+      }
+      return idx;
+    }
+
+    PartitionID _k;
+    // ! Edges of the quotient graph
+    tbb::concurrent_vector<QuotientGraphEdge> _edges;
+    // ! Maps a block pair to its edge (small k)
+    vec<CAtomic<size_t>> _dense_index;
+    // ! Maps a block pair to its edge (large k)
+    EdgeIndex _edge_index;
+    // ! Serializes the creation of new edges
+    SpinLock _create_lock;
+    // ! Edges incident to each block
+    vec<vec<size_t>> _incident_edges;
+  };
+
   /**
    * Maintains the block pair of a round of the active block scheduling strategy
    */
   class ActiveBlockSchedulingRound {
 
+    // ! Block pair in the queue of a round. If block pairs are prioritized, the
+    // ! block pair with the highest expected improvement is scheduled first.
+    // ! Otherwise (or for ties), block pairs are scheduled in insertion order.
+    struct ScheduledBlockPair {
+      BlockPair blocks;
+      double priority;
+      size_t position;
+    };
+
+    struct ScheduledBlockPairComparator {
+      bool operator()(const ScheduledBlockPair& lhs, const ScheduledBlockPair& rhs) const {
+        return lhs.priority < rhs.priority ||
+          ( lhs.priority == rhs.priority && lhs.position > rhs.position );
+      }
+    };
+
    public:
     explicit ActiveBlockSchedulingRound(const Context& context,
-                                        vec<vec<QuotientGraphEdge>>& quotient_graph) :
+                                        SparseQuotientGraph& quotient_graph) :
       _context(context),
       _quotient_graph(quotient_graph),
       _unscheduled_blocks(),
+      _num_pushed_blocks(0),
       _round_improvement(0),
       _active_blocks_lock(),
       _active_blocks(context.partition.k, false),
@@ -146,6 +315,12 @@ class QuotientGraph {
     // ! The corresponding block pair will be stored in blocks.
     bool popBlockPairFromQueue(BlockPair& blocks);
 
+    // ! Pops the block pair with the highest priority from the queue where both blocks
+    // ! are currently not part of a search (num_searches_of_block[b] == 0).
+    // ! Conflicting block pairs remain in the queue.
+    bool popNonConflictingBlockPairFromQueue(BlockPair& blocks,
+                                             const vec<uint32_t>& num_searches_of_block);
+
     // ! Pushes a block pair into the queue.
     // ! Return true, if the block pair was successfully pushed into the queue.
     // ! Note, that a block pair is only allowed to be contained in one queue
@@ -171,11 +346,15 @@ class QuotientGraph {
       return _remaining_blocks;
     }
 
+    double priority(const QuotientGraphEdge& qg_edge) const;
+
    const Context& _context;
    // ! Quotient graph
-    vec<vec<QuotientGraphEdge>>& _quotient_graph;
+    SparseQuotientGraph& _quotient_graph;
     // ! Queue that contains all unscheduled block pairs of the current round
-    tbb::concurrent_queue<BlockPair> _unscheduled_blocks;
+    tbb::concurrent_priority_queue<ScheduledBlockPair, ScheduledBlockPairComparator> _unscheduled_blocks;
+    // ! Number of block pairs pushed into the queue so far
+    CAtomic<size_t> _num_pushed_blocks;
     // ! Current improvement made in this round
     CAtomic<HyperedgeWeight> _round_improvement;
     // Active blocks for next round
@@ -197,12 +376,17 @@ class QuotientGraph {
    * Thus, there can be multiple active searches that process block pairs from different
    * rounds. However, block pairs from earlier rounds have an higher priority to be
    * scheduled.
+   * If matching-based scheduling is enabled, a new search prefers the block pair with
+   * the highest priority whose blocks are not part of any running search. Since
+   * block pairs are (by default) prioritized by their cut weight, the running searches
+   * form a greedy maximal weighted matching of the quotient graph as long as enough
+   * disjoint block pairs are available.
    */
   class ActiveBlockScheduler {
 
    public:
     explicit ActiveBlockScheduler(const Context& context,
-                                  vec<vec<QuotientGraphEdge>>& quotient_graph) :
+                                  SparseQuotientGraph& quotient_graph) :
       _context(context),
       _quotient_graph(quotient_graph),
       _num_rounds(0),
@@ -211,7 +395,9 @@ class QuotientGraph {
       _terminate(false),
       _round_lock(),
       _first_active_round(0),
-      _is_input_hypergraph(false) { }
+      _is_input_hypergraph(false),
+      _matching_lock(),
+      _num_searches_of_block() { }
 
     // ! Initialize the first round of the active block scheduling strategy
     void initialize(const vec<uint8_t>& active_blocks,
@@ -252,12 +438,19 @@ class QuotientGraph {
       _terminate = false;
     }
 
-    bool isActiveBlockPair(const PartitionID i,
-                           const PartitionID j) const;
+    bool isActiveBlockPair(const QuotientGraphEdge& qg_edge) const;
+
+    bool popBlockPairFromQueueOfRounds(BlockPair& blocks, size_t& round);
+
+    bool popNonConflictingBlockPairFromQueueOfRounds(BlockPair& blocks, size_t& round);
+
+    // ! Pushes all active block pairs that contain the corresponding block
+    // ! into the queue of the given round
+    void scheduleIncidentBlockPairs(const PartitionID block, const size_t round);
 
     const Context& _context;
     // ! Quotient graph
-    vec<vec<QuotientGraphEdge>>& _quotient_graph;
+    SparseQuotientGraph& _quotient_graph;
     // Contains all active block scheduling rounds
     CAtomic<size_t> _num_rounds;
     tbb::concurrent_vector<ActiveBlockSchedulingRound> _rounds;
@@ -270,6 +463,9 @@ class QuotientGraph {
     size_t _first_active_round;
     // ! Indicate if the current hypergraph represents the input hypergraph
     bool _is_input_hypergraph;
+    // ! Number of running searches per block (only used for matching-based scheduling)
+    SpinLock _matching_lock;
+    vec<uint32_t> _num_searches_of_block;
   };
 
   // Contains information required by a local search
@@ -297,19 +493,11 @@ public:
     _context(context),
     _initial_num_edges(num_hyperedges),
     _current_num_edges(kInvalidHyperedge),
-    _quotient_graph(context.partition.k,
-      vec<QuotientGraphEdge>(context.partition.k)),
+    _quotient_graph(context.partition.k),
     _register_search_lock(),
     _active_block_scheduler(context, _quotient_graph),
     _num_active_searches(0),
-    _searches() {
-    for ( PartitionID i = 0; i < _context.partition.k; ++i ) {
-      for ( PartitionID j = i + 1; j < _context.partition.k; ++j ) {
-        _quotient_graph[i][j].blocks.i = i;
-        _quotient_graph[i][j].blocks.j = j;
-      }
-    }
-  }
+    _searches() { }
 
   QuotientGraph(const QuotientGraph&) = delete;
   QuotientGraph(QuotientGraph&&) = delete;
@@ -332,6 +520,12 @@ public:
     return _searches[search_id].blocks;
   }
 
+  // ! Number of cut hyperedges registered for the corresponding block pair
+  size_t numCutHyperedges(const BlockPair& blocks) const {
+    const QuotientGraphEdge* qg_edge = _quotient_graph.find(blocks.i, blocks.j);
+    return qg_edge ? qg_edge->num_cut_hes.load(std::memory_order_relaxed) : 0;
+  }
+
   // ! Number of block pairs used by the corresponding search
   size_t numBlockPairs(const SearchID) const {
     return 1;
@@ -340,12 +534,21 @@ public:
   template<typename F>
   void doForAllCutHyperedgesOfSearch(const SearchID search_id, const F& f) {
     const BlockPair& blocks = _searches[search_id].blocks;
-    const size_t num_cut_hes = _quotient_graph[blocks.i][blocks.j].num_cut_hes.load();
-    std::shuffle(_quotient_graph[blocks.i][blocks.j].cut_hes.begin(),
-                 _quotient_graph[blocks.i][blocks.j].cut_hes.begin() + num_cut_hes,
-                 utils::Randomize::instance().getGenerator());
+    QuotientGraphEdge& qg_edge = _quotient_graph.edge(blocks.i, blocks.j);
+    const size_t num_cut_hes = qg_edge.num_cut_hes.load();
+    auto begin = qg_edge.cut_hes.begin();
+    if ( _context.partition.deterministic ) {
+      // The order in which cut hyperedges are registered depends on the
+      // thread schedule => restore a canonical order before shuffling
+      std::sort(begin, begin + num_cut_hes);
+      std::mt19937 prng(utils::seed_iteration(_context.partition.seed, search_id));
+      std::shuffle(begin, begin + num_cut_hes, prng);
+    } else {
+      std::shuffle(begin, begin + num_cut_hes,
+                   utils::Randomize::instance().getGenerator());
+    }
     for ( size_t i = 0; i < num_cut_hes; ++i ) {
-      const HyperedgeID he = _quotient_graph[blocks.i][blocks.j].cut_hes[i];
+      const HyperedgeID he = qg_edge.cut_hes[i];
       if ( _phg->pinCountInPart(he, blocks.i) > 0 && _phg->pinCountInPart(he, blocks.j) > 0 ) {
         f(he);
       }
@@ -353,6 +556,30 @@ public:
   }
 
 
+  /**
+   * Returns the block pairs that are refined in the next round of the
+   * deterministic scheduling mode. A block pair is scheduled if one of its
+   * blocks is active and it passes the same filters as in the active block
+   * scheduling strategy. The block pairs are sorted in a canonical order
+   * (total improvement and cut weight descending, then block IDs).
+   */
+  vec<BlockPair> deterministicBlockPairs(const vec<uint8_t>& active_blocks,
+                                         const size_t round) const;
+
+  /**
+   * Registers a search on the given block pair, bypassing the active block
+   * scheduler. Must be called sequentially such that search IDs only depend
+   * on the order of the block pairs.
+   */
+  SearchID registerDeterministicSearch(const BlockPair& blocks);
+
+  /**
+   * Notifies the quotient graph that a search started with
+   * registerDeterministicSearch(...) terminated.
+   */
+  void finalizeDeterministicSearch(const SearchID search_id,
+                                   const HyperedgeWeight total_improvement);
+
   /**
    * Notifies the quotient graph that hyperedge he contains
    * a new block, which was previously not contained. The thread
@@ -393,7 +620,8 @@ public:
     ASSERT(i < j);
     ASSERT(0 <= i && i < _context.partition.k);
     ASSERT(0 <= j && j < _context.partition.k);
-    return _quotient_graph[i][j].cut_he_weight;
+    const QuotientGraphEdge* qg_edge = _quotient_graph.find(i, j);
+    return qg_edge ? qg_edge->cut_he_weight.load() : 0;
   }
 
   void changeNumberOfBlocks(const PartitionID new_k);
@@ -412,8 +640,9 @@ public:
   HypernodeID _current_num_edges;
 
   // ! Each edge contains stats and the cut hyperedges
-  // ! of the block pair which its represents.
-  vec<vec<QuotientGraphEdge>> _quotient_graph;
+  // ! of the block pair which its represents. Only
+  // ! adjacent block pairs are stored.
+  SparseQuotientGraph _quotient_graph;
 
   SpinLock _register_search_lock;
   // ! Queue that contains all block pairs.
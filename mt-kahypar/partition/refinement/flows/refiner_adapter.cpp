@@ -43,31 +43,46 @@ bool FlowRefinerAdapter<TypeTraits>::registerNewSearch(const SearchID search_id,
   bool success = true;
   size_t refiner_idx = INVALID_REFINER_IDX;
   if ( _unused_refiners.try_pop(refiner_idx) ) {
-    // Note, search id are usually consecutive starting from 0.
-    // However, this function is not called in increasing search id order.
-    _search_lock.lock();
-    while ( static_cast<size_t>(search_id) >= _active_searches.size() ) {
-      _active_searches.push_back(ActiveSearch { INVALID_REFINER_IDX, NOW, 0.0, false });
-    }
-    _search_lock.unlock();
-
-    if ( !_refiner[refiner_idx] ) {
-      // Lazy initialization of refiner
-      _refiner[refiner_idx] = initializeRefiner();
-    }
-
-    _active_searches[search_id].refiner_idx = refiner_idx;
-    _active_searches[search_id].start = NOW;
-    mt_kahypar_partitioned_hypergraph_const_t partitioned_hg =
-      utils::partitioned_hg_const_cast(phg);
-    _refiner[refiner_idx]->initialize(partitioned_hg);
-    _refiner[refiner_idx]->updateTimeLimit(timeLimit());
+    assignRefiner(search_id, refiner_idx, phg);
   } else {
     success = false;
   }
   return success;
 }
 
+template<typename TypeTraits>
+void FlowRefinerAdapter<TypeTraits>::registerNewSearch(const SearchID search_id,
+                                                       const size_t refiner_idx,
+                                                       const PartitionedHypergraph& phg) {
+  ASSERT(refiner_idx < numAvailableRefiner());
+  assignRefiner(search_id, refiner_idx, phg);
+}
+
+template<typename TypeTraits>
+void FlowRefinerAdapter<TypeTraits>::assignRefiner(const SearchID search_id,
+                                                   const size_t refiner_idx,
+                                                   const PartitionedHypergraph& phg) {
+  // Note, search id are usually consecutive starting from 0.
+  // However, this function is not called in increasing search id order.
+  _search_lock.lock();
+  while ( static_cast<size_t>(search_id) >= _active_searches.size() ) {
+    _active_searches.push_back(ActiveSearch { INVALID_REFINER_IDX, NOW, 0.0, false });
+  }
+  _search_lock.unlock();
+
+  if ( !_refiner[refiner_idx] ) {
+    // Lazy initialization of refiner
+    _refiner[refiner_idx] = initializeRefiner();
+  }
+
+  _active_searches[search_id].refiner_idx = refiner_idx;
+  _active_searches[search_id].start = NOW;
+  mt_kahypar_partitioned_hypergraph_const_t partitioned_hg =
+    utils::partitioned_hg_const_cast(phg);
+  _refiner[refiner_idx]->initialize(partitioned_hg);
+  _refiner[refiner_idx]->updateTimeLimit(timeLimit());
+}
+
 template<typename TypeTraits>
 MoveSequence FlowRefinerAdapter<TypeTraits>::refine(const SearchID search_id,
                                                     const PartitionedHypergraph& phg,
@@ -79,10 +94,15 @@ MoveSequence FlowRefinerAdapter<TypeTraits>::refine(const SearchID search_id,
   mt_kahypar_partitioned_hypergraph_const_t partitioned_hg =
     utils::partitioned_hg_const_cast(phg);
   const size_t refiner_idx = _active_searches[search_id].refiner_idx;
-  const size_t num_free_threads = _threads.acquireFreeThreads();
+  // In deterministic mode, each search runs sequentially since the number
+  // of idle threads depends on the thread schedule
+  const bool deterministic = _context.partition.deterministic;
+  const size_t num_free_threads = deterministic ? 1 : _threads.acquireFreeThreads();
   _refiner[refiner_idx]->setNumThreadsForSearch(num_free_threads);
   MoveSequence moves = _refiner[refiner_idx]->refine(partitioned_hg, sub_hg, _active_searches[search_id].start);
-  _threads.releaseThreads(num_free_threads);
+  if ( !deterministic ) {
+    _threads.releaseThreads(num_free_threads);
+  }
   _active_searches[search_id].reaches_time_limit = moves.state == MoveSequenceState::TIME_LIMIT;
   return moves;
 }
@@ -120,13 +140,20 @@ void FlowRefinerAdapter<TypeTraits>::finalizeSearch(const SearchID search_id) {
   }
 
   ASSERT(_active_searches[search_id].refiner_idx != INVALID_REFINER_IDX);
-  _unused_refiners.push(_active_searches[search_id].refiner_idx);
+  if ( !_context.partition.deterministic ) {
+    // In deterministic mode, refiners are assigned explicitly to searches
+    _unused_refiners.push(_active_searches[search_id].refiner_idx);
+  }
   _active_searches[search_id].refiner_idx = INVALID_REFINER_IDX;
 }
 
 template<typename TypeTraits>
 void FlowRefinerAdapter<TypeTraits>::initialize(const size_t max_parallelism) {
   _num_parallel_refiners = max_parallelism;
+  if ( _refiner.size() < max_parallelism ) {
+    // In deterministic mode, the number of refiners does not depend on the number of threads
+    _refiner.resize(max_parallelism);
+  }
   _threads.num_threads = _context.shared_memory.num_threads;
   _threads.num_parallel_refiners = max_parallelism;
   _threads.num_active_refiners = 0;
@@ -126,6 +126,13 @@ public:
   bool registerNewSearch(const SearchID search_id,
                          const PartitionedHypergraph& phg);
 
+  // ! Associates the refiner with the given index with a search id.
+  // ! Used by the deterministic scheduling mode, where the assignment
+  // ! must not depend on the order in which searches are started.
+  void registerNewSearch(const SearchID search_id,
+                         const size_t refiner_idx,
+                         const PartitionedHypergraph& phg);
+
   MoveSequence refine(const SearchID search_id,
                       const PartitionedHypergraph& phg,
                       const Subhypergraph& sub_hg);
@@ -139,6 +146,18 @@ public:
   // ! available again
   void finalizeSearch(const SearchID search_id);
 
+  // ! Acquires idle threads for the problem construction of a search (at least one).
+  // ! They must be released with releaseThreads(...) before the search is refined.
+  size_t acquireFreeThreads() {
+    return _context.partition.deterministic ? 1 : _threads.acquireFreeThreads();
+  }
+
+  void releaseThreads(const size_t num_threads) {
+    if ( !_context.partition.deterministic ) {
+      _threads.releaseThreads(num_threads);
+    }
+  }
+
   void terminateRefiner() {
     _threads.terminateRefiner();
   }
@@ -158,6 +177,17 @@ public:
         _average_running_time, 0.1) : std::numeric_limits<double>::max();
   }
 
+  // ! Reports the memory of all refiners. Note that the refiners keep
+  // ! their buffers alive across searches and levels.
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    ASSERT(parent);
+    for ( const std::unique_ptr<IFlowRefiner>& refiner : _refiner ) {
+      if ( refiner ) {
+        refiner->memoryConsumption(parent);
+      }
+    }
+  }
+
   // ! Only for testing
   size_t numUsedThreads() const {
     return _threads.num_used_threads;
@@ -166,8 +196,15 @@ public:
 private:
   std::unique_ptr<IFlowRefiner> initializeRefiner();
 
+  void assignRefiner(const SearchID search_id,
+                     const size_t refiner_idx,
+                     const PartitionedHypergraph& phg);
+
   bool shouldSetTimeLimit() const {
-    return _num_refinements > static_cast<size_t>(_context.partition.k) &&
+    // Time limits depend on the running time of previous searches
+    // and would therefore break deterministic mode
+    return !_context.partition.deterministic &&
+      _num_refinements > static_cast<size_t>(_context.partition.k) &&
       _context.refinement.flows.time_limit_factor > 1.0;
   }
 
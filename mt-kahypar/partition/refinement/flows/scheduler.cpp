@@ -66,55 +66,94 @@ bool FlowRefinementScheduler<GraphAndGainTypes>::refineImpl(
   PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(hypergraph);
   ASSERT(_phg == &phg);
   _quotient_graph.setObjective(best_metrics.quality);
+  _constructor.resetCachedProblems();
 
   std::atomic<HyperedgeWeight> overall_delta(0);
   utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
-  tbb::parallel_for(UL(0), _refiner.numAvailableRefiner(), [&](const size_t i) {
-    while ( i < std::max(UL(1), static_cast<size_t>(
-        std::ceil(_context.refinement.flows.parallel_searches_multiplier *
-            _quotient_graph.numActiveBlockPairs()))) ) {
-      SearchID search_id = _quotient_graph.requestNewSearch(_refiner);
-      if ( search_id != QuotientGraph<TypeTraits>::INVALID_SEARCH_ID ) {
-        DBG << "Start search" << search_id
-            << "( Blocks =" << blocksOfSearch(search_id)
-            << ", Refiner =" << i << ")";
-        timer.start_timer("region_growing", "Grow Region", true);
-        const Subhypergraph sub_hg =
-          _constructor.construct(search_id, _quotient_graph, phg);
-        _quotient_graph.finalizeConstruction(search_id);
-        timer.stop_timer("region_growing");
-
-        HyperedgeWeight delta = 0;
-        bool improved_solution = false;
-        if ( sub_hg.numNodes() > 0 ) {
-          ++_stats.num_refinements;
-          MoveSequence sequence = _refiner.refine(search_id, phg, sub_hg);
-
-          if ( !sequence.moves.empty() ) {
-            timer.start_timer("apply_moves", "Apply Moves", true);
-            delta = applyMoves(search_id, sequence);
-            overall_delta -= delta;
-            improved_solution = sequence.state == MoveSequenceState::SUCCESS && delta > 0;
-            timer.stop_timer("apply_moves");
-          } else if ( sequence.state == MoveSequenceState::TIME_LIMIT ) {
-            ++_stats.num_time_limits;
-            DBG << RED << "Search" << search_id << "reaches the time limit ( Time Limit ="
-                << _refiner.timeLimit() << "s )" << END;
+  if ( _context.partition.deterministic ) {
+    overall_delta = refineDeterministically(phg, best_metrics.quality);
+  } else {
+    auto run_searches = [&] {
+      tbb::parallel_for(UL(0), _refiner.numAvailableRefiner(), [&](const size_t i) {
+        while ( i < std::max(UL(1), static_cast<size_t>(
+            std::ceil(_context.refinement.flows.parallel_searches_multiplier *
+                _quotient_graph.numActiveBlockPairs()))) ) {
+          if ( _context.isTimeLimitExceeded() ) {
+            break;
+          }
+          SearchID search_id = _quotient_graph.requestNewSearch(_refiner);
+          if ( search_id != QuotientGraph<TypeTraits>::INVALID_SEARCH_ID ) {
+            utils::Timer::ScopedTraceSpan span(timer, "Flow Search", "flows");
+            span.addArg("blocks", blocksOfSearch(search_id));
+            DBG << "Start search" << search_id
+                << "( Blocks =" << blocksOfSearch(search_id)
+                << ", Refiner =" << i << ")";
+            timer.start_timer("region_growing", "Grow Region", true);
+            const size_t num_threads = _context.refinement.flows.parallel_region_growing ?
+              _refiner.acquireFreeThreads() : 1;
+            const Subhypergraph sub_hg =
+              _constructor.construct(search_id, _quotient_graph, phg, num_threads);
+            if ( _context.refinement.flows.parallel_region_growing ) {
+              _refiner.releaseThreads(num_threads);
+            }
+            const bool is_unimprovable = _constructor.isUnimprovable(
+              search_id, _quotient_graph.getBlockPair(search_id));
+            _quotient_graph.finalizeConstruction(search_id);
+            timer.stop_timer("region_growing");
+
+            HyperedgeWeight delta = 0;
+            bool improved_solution = false;
+            if ( is_unimprovable ) {
+              DBG << "Skip search" << search_id << "( Blocks =" << blocksOfSearch(search_id)
+                  << ") as its problem did not change since the last search without improvement";
+            } else if ( sub_hg.numNodes() > 0 ) {
+              ++_stats.num_refinements;
+              MoveSequence sequence = _refiner.refine(search_id, phg, sub_hg);
+
+              if ( sequence.moves.empty() && sequence.state != MoveSequenceState::TIME_LIMIT ) {
+                _constructor.markAsUnimprovable(search_id, _quotient_graph.getBlockPair(search_id));
+              }
+              if ( !sequence.moves.empty() ) {
+                timer.start_timer("apply_moves", "Apply Moves", true);
+                delta = applyMoves(search_id, sequence);
+                overall_delta -= delta;
+                improved_solution = sequence.state == MoveSequenceState::SUCCESS && delta > 0;
+                timer.stop_timer("apply_moves");
+              } else if ( sequence.state == MoveSequenceState::TIME_LIMIT ) {
+                ++_stats.num_time_limits;
+                DBG << RED << "Search" << search_id << "reaches the time limit ( Time Limit ="
+                    << _refiner.timeLimit() << "s )" << END;
+              }
+            }
+            _quotient_graph.finalizeSearch(search_id, improved_solution ? delta : 0);
+            _refiner.finalizeSearch(search_id);
+            DBG << "End search" << search_id
+                << "( Blocks =" << blocksOfSearch(search_id)
+                << ", Refiner =" << i
+                << ", Running Time =" << _refiner.runningTime(search_id) << ")";
+          } else {
+            break;
           }
         }
-        _quotient_graph.finalizeSearch(search_id, improved_solution ? delta : 0);
-        _refiner.finalizeSearch(search_id);
-        DBG << "End search" << search_id
-            << "( Blocks =" << blocksOfSearch(search_id)
-            << ", Refiner =" << i
-            << ", Running Time =" << _refiner.runningTime(search_id) << ")";
-      } else {
-        break;
-      }
+        _refiner.terminateRefiner();
+        DBG << RED << "Refiner" << i << "terminates!" << END;
+      });
+    };
+
+    // The flow computations are compute-bound and do not benefit from hyperthreads.
+    // Thus, we run them in a separate task arena that is restricted to the physical
+    // performance cores, if we are not already in a smaller arena (e.g., a portfolio run).
+    TBBInitializer& tbb_initializer = TBBInitializer::instance();
+    const int max_concurrency = tbb::this_task_arena::max_concurrency();
+    const int num_flow_threads = _context.shared_memory.num_threads_for_flows > 0 ?
+      static_cast<int>(_context.shared_memory.num_threads_for_flows) : tbb_initializer.num_used_performance_cores();
+    if ( max_concurrency == tbb_initializer.total_number_of_threads() &&
+         num_flow_threads > 0 && num_flow_threads < max_concurrency ) {
+      tbb_initializer.execute_with_threads(num_flow_threads, run_searches);
+    } else {
+      run_searches();
     }
-    _refiner.terminateRefiner();
-    DBG << RED << "Refiner" << i << "terminates!" << END;
-  });
+  }
 
   DBG << _stats;
 
@@ -145,11 +184,137 @@ bool FlowRefinementScheduler<GraphAndGainTypes>::refineImpl(
     });
   }
 
+  if ( _context.partition.show_memory_consumption && _context.partition.verbose_output
+       && _context.type == ContextType::main
+       && phg.initialNumNodes() == _was_moved.size() /* top level */ ) {
+    printMemoryConsumption();
+  }
+
   HEAVY_REFINEMENT_ASSERT(phg.checkTrackedPartitionInformation(_gain_cache));
   _phg = nullptr;
   return overall_delta.load(std::memory_order_relaxed) < 0;
 }
 
+template<typename GraphAndGainTypes>
+HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::refineDeterministically(
+                PartitionedHypergraph& phg,
+                const HyperedgeWeight objective) {
+  const HyperedgeWeight min_improvement_per_round =
+    _context.refinement.flows.min_relative_improvement_per_round * objective;
+  HyperedgeWeight overall_delta = 0;
+  vec<uint8_t> active_blocks(_context.partition.k, true);
+  vec<uint8_t> is_matched(_context.partition.k, false);
+  vec<BlockPair> matching;
+  vec<BlockPair> remaining_block_pairs;
+  const bool has_refiners = _refiner.numAvailableRefiner() > 0;
+  for ( size_t round = 0; has_refiners && !_context.isTimeLimitExceeded(); ++round ) {
+    vec<BlockPair> block_pairs = _quotient_graph.deterministicBlockPairs(active_blocks, round);
+    if ( block_pairs.empty() ) {
+      break;
+    }
+
+    std::fill(active_blocks.begin(), active_blocks.end(), false);
+    HyperedgeWeight round_improvement = 0;
+    while ( !block_pairs.empty() && !_context.isTimeLimitExceeded() ) {
+      // Greedily select block pairs with disjoint blocks in canonical order
+      matching.clear();
+      remaining_block_pairs.clear();
+      std::fill(is_matched.begin(), is_matched.end(), false);
+      for ( const BlockPair& blocks : block_pairs ) {
+        if ( !is_matched[blocks.i] && !is_matched[blocks.j] ) {
+          is_matched[blocks.i] = true;
+          is_matched[blocks.j] = true;
+          matching.push_back(blocks);
+        } else {
+          remaining_block_pairs.push_back(blocks);
+        }
+      }
+      block_pairs.swap(remaining_block_pairs);
+      round_improvement += refineMatching(phg, matching, active_blocks);
+    }
+    overall_delta -= round_improvement;
+
+    DBG << GREEN << "Round" << (round + 1) << "terminates with improvement" << round_improvement
+        << "(Minimum Required Improvement =" << min_improvement_per_round << ")" << END;
+    // We require that minimum improvement per round must be greater than a threshold,
+    // otherwise we terminate early
+    if ( round_improvement < min_improvement_per_round ) {
+      break;
+    }
+  }
+  return overall_delta;
+}
+
+template<typename GraphAndGainTypes>
+HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::refineMatching(
+                PartitionedHypergraph& phg,
+                const vec<BlockPair>& matching,
+                vec<uint8_t>& active_blocks) {
+  // Search IDs are assigned sequentially such that they only depend on the matching
+  const size_t num_searches = matching.size();
+  vec<SearchID> search_ids(num_searches);
+  for ( size_t i = 0; i < num_searches; ++i ) {
+    search_ids[i] = _quotient_graph.registerDeterministicSearch(matching[i]);
+  }
+
+  // Refiner r processes the searches r, r + num_refiners, ... such that the
+  // state of each refiner only depends on the sequence of its searches
+  vec<MoveSequence> sequences(num_searches, MoveSequence { {}, 0 });
+  const size_t num_refiners = std::min(_refiner.numAvailableRefiner(), num_searches);
+  utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+  tbb::parallel_for(UL(0), num_refiners, [&](const size_t r) {
+    for ( size_t i = r; i < num_searches; i += num_refiners ) {
+      const SearchID search_id = search_ids[i];
+      utils::Timer::ScopedTraceSpan span(timer, "Flow Search", "flows");
+      span.addArg("blocks", blocksOfSearch(search_id));
+      _refiner.registerNewSearch(search_id, r, phg);
+      DBG << "Start search" << search_id
+          << "( Blocks =" << blocksOfSearch(search_id)
+          << ", Refiner =" << r << ")";
+      timer.start_timer("region_growing", "Grow Region", true);
+      const Subhypergraph sub_hg =
+        _constructor.construct(search_id, _quotient_graph, phg);
+      const bool is_unimprovable = _constructor.isUnimprovable(search_id, matching[i]);
+      _quotient_graph.finalizeConstruction(search_id);
+      timer.stop_timer("region_growing");
+
+      if ( !is_unimprovable && sub_hg.numNodes() > 0 ) {
+        ++_stats.num_refinements;
+        sequences[i] = _refiner.refine(search_id, phg, sub_hg);
+        if ( sequences[i].moves.empty() && sequences[i].state != MoveSequenceState::TIME_LIMIT ) {
+          _constructor.markAsUnimprovable(search_id, matching[i]);
+        }
+      }
+    }
+  });
+
+  // Apply the move sequences in matching order
+  HyperedgeWeight improvement = 0;
+  for ( size_t i = 0; i < num_searches; ++i ) {
+    const SearchID search_id = search_ids[i];
+    MoveSequence& sequence = sequences[i];
+    HyperedgeWeight delta = 0;
+    bool improved_solution = false;
+    if ( !sequence.moves.empty() ) {
+      timer.start_timer("apply_moves", "Apply Moves", true);
+      delta = applyMoves(search_id, sequence);
+      improved_solution = sequence.state == MoveSequenceState::SUCCESS && delta > 0;
+      timer.stop_timer("apply_moves");
+    }
+    improvement += delta;
+    if ( improved_solution ) {
+      active_blocks[matching[i].i] = true;
+      active_blocks[matching[i].j] = true;
+    }
+    _quotient_graph.finalizeDeterministicSearch(search_id, improved_solution ? delta : 0);
+    _refiner.finalizeSearch(search_id);
+    DBG << "End search" << search_id
+        << "( Blocks =" << blocksOfSearch(search_id)
+        << ", Running Time =" << _refiner.runningTime(search_id) << ")";
+  }
+  return improvement;
+}
+
 template<typename GraphAndGainTypes>
 void FlowRefinementScheduler<GraphAndGainTypes>::initializeImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph)  {
   PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(hypergraph);
@@ -191,6 +356,16 @@ void FlowRefinementScheduler<GraphAndGainTypes>::resizeDataStructuresForCurrentK
   }
 }
 
+template<typename GraphAndGainTypes>
+void FlowRefinementScheduler<GraphAndGainTypes>::printMemoryConsumption() {
+  utils::MemoryTreeNode flow_memory("Flow Refinement", utils::OutputType::MEGABYTE);
+  _refiner.memoryConsumption(&flow_memory);
+  flow_memory.finalize();
+
+  LOG << BOLD << "\n Flow Memory Consumption" << END;
+  LOG << flow_memory;
+}
+
 namespace {
 
 struct NewCutHyperedge {
@@ -291,8 +466,10 @@ HyperedgeWeight FlowRefinementScheduler<GraphAndGainTypes>::applyMoves(const Sea
 
   HyperedgeWeight improvement = 0;
   vec<NewCutHyperedge> new_cut_hes;
+  _constructor.startMoveSequence();
   auto delta_func = [&](const SynchronizedEdgeUpdate& sync_update) {
     improvement -= AttributedGains::gain(sync_update);
+    _constructor.notifyChangedHyperedge(_phg->uniqueEdgeID(sync_update.he));
 
     // Collect hyperedges with new blocks in its connectivity set
     if ( sync_update.pin_count_in_to_part_after == 1 ) {
@@ -205,8 +205,25 @@ private:
 
   void initializeImpl(mt_kahypar_partitioned_hypergraph_t& phg) final;
 
+  /**
+   * Deterministic scheduling mode. Each round refines all active block pairs.
+   * The block pairs of a round are processed in a sequence of matchings
+   * (greedily computed in canonical block pair order). The searches of a
+   * matching run in parallel on the same partition and their move sequences
+   * are applied afterwards in matching order. Returns the change in solution
+   * quality.
+   */
+  HyperedgeWeight refineDeterministically(PartitionedHypergraph& phg,
+                                          const HyperedgeWeight objective);
+
+  HyperedgeWeight refineMatching(PartitionedHypergraph& phg,
+                                 const vec<BlockPair>& matching,
+                                 vec<uint8_t>& active_blocks);
+
   void resizeDataStructuresForCurrentK();
 
+  void printMemoryConsumption();
+
   PartWeightUpdateResult partWeightUpdate(const vec<HypernodeWeight>& part_weight_deltas,
                                           const bool rollback);
 
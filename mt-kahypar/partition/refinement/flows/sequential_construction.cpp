@@ -29,7 +29,6 @@
 #include "kahypar-resources/utils/math.h"
 
 #include "mt-kahypar/definitions.h"
-#include "mt-kahypar/parallel/stl/scalable_queue.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 
 namespace mt_kahypar {
@@ -427,11 +426,12 @@ void SequentialConstruction<GraphAndGainTypes>::determineDistanceFromCut(const P
   _visited_hns.reset();   // Review Note
 
   // Initialize bfs queue with vertices contained in cut hyperedges
-  parallel::scalable_queue<whfc::Node> q, next_q;
+  _bfs_queue.clear();
+  _next_bfs_queue.clear();
   for ( const whfc::Hyperedge& he : _cut_hes ) {
     for ( const whfc::FlowHypergraph::Pin& pin : _flow_hg.pinsOf(he) ) {
       if ( pin.pin != source && pin.pin != sink && !_visited_hns[pin.pin] ) {
-        q.push(pin.pin);
+        _bfs_queue.push_back(pin.pin);
         _visited_hns.setUnsafe(pin.pin, true);
       }
     }
@@ -442,41 +442,54 @@ void SequentialConstruction<GraphAndGainTypes>::determineDistanceFromCut(const P
   whfc::HopDistance dist = 1;
   whfc::HopDistance max_dist_source(0);
   whfc::HopDistance max_dist_sink(0);
-  while ( !q.empty() ) {
-    const whfc::Node u = q.front();
-    q.pop();
-
-    const PartitionID block_of_u = phg.partID(whfc_to_node[u]);
-    if ( block_of_u == block_0 ) {
-      distances[u] = -dist;
-      max_dist_source = std::max(max_dist_source, dist);
-    } else if ( block_of_u == block_1 ) {
-      distances[u] = dist;
-      max_dist_sink = std::max(max_dist_sink, dist);
-    }
+  while ( !_bfs_queue.empty() ) {
+    for ( const whfc::Node& u : _bfs_queue ) {
+      const PartitionID block_of_u = phg.partID(whfc_to_node[u]);
+      if ( block_of_u == block_0 ) {
+        distances[u] = -dist;
+        max_dist_source = std::max(max_dist_source, dist);
+      } else if ( block_of_u == block_1 ) {
+        distances[u] = dist;
+        max_dist_sink = std::max(max_dist_sink, dist);
+      }
 
-    for ( const whfc::FlowHypergraph::InHe& in_he : _flow_hg.hyperedgesOf(u) ) {
-      const whfc::Hyperedge he = in_he.e;
-      if ( !_visited_hns[_flow_hg.numNodes() + he] ) {
-        for ( const whfc::FlowHypergraph::Pin& pin : _flow_hg.pinsOf(he) ) {
-          if ( pin.pin != source && pin.pin != sink && !_visited_hns[pin.pin] ) {
-            next_q.push(pin.pin);
-            _visited_hns.setUnsafe(pin.pin, true);
+      for ( const whfc::FlowHypergraph::InHe& in_he : _flow_hg.hyperedgesOf(u) ) {
+        const whfc::Hyperedge he = in_he.e;
+        if ( !_visited_hns[_flow_hg.numNodes() + he] ) {
+          for ( const whfc::FlowHypergraph::Pin& pin : _flow_hg.pinsOf(he) ) {
+            if ( pin.pin != source && pin.pin != sink && !_visited_hns[pin.pin] ) {
+              _next_bfs_queue.push_back(pin.pin);
+              _visited_hns.setUnsafe(pin.pin, true);
+            }
           }
+          _visited_hns.setUnsafe(_flow_hg.numNodes() + he, true);
         }
-        _visited_hns.setUnsafe(_flow_hg.numNodes() + he, true);
       }
     }
-
-    if ( q.empty() ) {
-      std::swap(q, next_q);
-      ++dist;
-    }
+    _bfs_queue.clear();
+    std::swap(_bfs_queue, _next_bfs_queue);
+    ++dist;
   }
   distances[source] = -(max_dist_source + 1);
   distances[sink] = max_dist_sink + 1;
 }
 
+template<typename GraphAndGainTypes>
+void SequentialConstruction<GraphAndGainTypes>::memoryConsumption(utils::MemoryTreeNode* parent) const {
+  ASSERT(parent);
+
+  utils::MemoryTreeNode* construction_node = parent->addChild("Sequential Construction");
+  construction_node->addChild("Node Mapping")->updateSize(
+    _node_to_whfc.size_in_bytes() + _he_to_whfc.size_in_bytes());
+  construction_node->addChild("Visited Nodes")->updateSize(_visited_hns.size_in_bytes());
+  construction_node->addChild("Temporary Pins")->updateSize(
+    _tmp_pins.capacity() * sizeof(whfc::Node) + _pins.capacity() * sizeof(TmpPin) +
+    _cut_hes.capacity() * sizeof(whfc::Hyperedge));
+  construction_node->addChild("BFS Queues")->updateSize(
+    ( _bfs_queue.capacity() + _next_bfs_queue.capacity() ) * sizeof(whfc::Node));
+  construction_node->addChild("Identical Net Detection")->updateSize(_identical_nets.size_in_bytes());
+}
+
 namespace {
 #define SEQUENTIAL_CONSTRUCTION(X) SequentialConstruction<X>
 }
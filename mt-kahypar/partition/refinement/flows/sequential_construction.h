@@ -96,6 +96,14 @@ class SequentialConstruction {
       ++_threshold;
     }
 
+    size_t size_in_bytes() const {
+      size_t size = _hash_buckets.capacity() * sizeof(HashBucket);
+      for ( const HashBucket& bucket : _hash_buckets ) {
+        size += bucket.identical_nets.capacity() * sizeof(TmpHyperedge);
+      }
+      return size;
+    }
+
    private:
     whfc::FlowHypergraph& _flow_hg;
     vec<HashBucket> _hash_buckets;
@@ -116,6 +124,8 @@ class SequentialConstruction {
     _cut_hes(),
     _pins(),
     _he_to_whfc(),
+    _bfs_queue(),
+    _next_bfs_queue(),
     _identical_nets(num_hyperedges, flow_hg, context) { }
 
   SequentialConstruction(const SequentialConstruction&) = delete;
@@ -140,6 +150,8 @@ class SequentialConstruction {
                                       vec<HypernodeID>& whfc_to_node,
                                       const bool default_construction);
 
+  void memoryConsumption(utils::MemoryTreeNode* parent) const;
+
  private:
   FlowProblem constructDefault(const PartitionedHypergraph& phg,
                                const Subhypergraph& sub_hg,
@@ -173,6 +185,11 @@ class SequentialConstruction {
   vec<TmpPin> _pins;
   ds::DynamicSparseMap<HyperedgeID, HyperedgeID> _he_to_whfc;
 
+  // ! BFS queues used to compute the distance of each node from the cut.
+  // ! They are kept alive across searches to avoid reallocations.
+  vec<whfc::Node> _bfs_queue;
+  vec<whfc::Node> _next_bfs_queue;
+
   DynamicIdenticalNetDetection _identical_nets;
 };
 }  // namespace mt_kahypar
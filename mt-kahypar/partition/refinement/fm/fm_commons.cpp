@@ -50,23 +50,24 @@ namespace mt_kahypar {
                                                              HypernodeWeight initial_imbalance,
                                                              HypernodeWeight moved_weight) const {
     ASSERT(initialized && to != kInvalidPartition);
-    // TODO test whether it is faster to save the previous position locally
-    BucketID bucketId = 0;
-    while (bucketId < NUM_BUCKETS
-           && initial_imbalance + moved_weight > bucket_weights[indexForBucket(to, bucketId)]) {
-      ++bucketId;
-    }
-    if (bucketId < NUM_BUCKETS) {
-      return std::ceil(moved_weight * gainPerWeightForBucket(bucketId));
+    // The bucket weights of a block are prefix sums. Thus, the penalty is determined
+    // by the first bucket whose weight is at least the imbalance after the move.
+    const HypernodeWeight imbalance = initial_imbalance + moved_weight;
+    const auto first = bucket_weights.cbegin() + indexForBucket(to, 0);
+    const auto last = first + NUM_BUCKETS;
+    const auto it = std::lower_bound(first, last, imbalance);
+    if (it != last) {
+      return std::ceil(moved_weight * gain_per_weight[it - first]);
     }
 
     // fallback case (it should be very unlikely that fallback_bucket_weights contains elements)
-    while (bucketId < NUM_BUCKETS + fallback_bucket_weights[to].size()
-           && initial_imbalance + moved_weight > fallback_bucket_weights[to][bucketId - NUM_BUCKETS]) {
-      ++bucketId;
+    const auto& fallback_weights = fallback_bucket_weights[to];
+    const auto fallback_it = std::lower_bound(fallback_weights.cbegin(), fallback_weights.cend(), imbalance);
+    if (fallback_it == fallback_weights.cend()) {
+      return std::numeric_limits<Gain>::max();
     }
-    return (bucketId == NUM_BUCKETS + fallback_bucket_weights[to].size()) ?
-              std::numeric_limits<Gain>::max() : std::ceil(moved_weight * gainPerWeightForBucket(bucketId));
+    const BucketID bucketId = NUM_BUCKETS + (fallback_it - fallback_weights.cbegin());
+    return std::ceil(moved_weight * gainPerWeightForBucket(bucketId));
   }
 
 
@@ -75,16 +76,27 @@ namespace mt_kahypar {
             UnconstrainedFMData& data, const Context& context,
             const typename GraphAndGainTypes::PartitionedHypergraph& phg,
             const typename GraphAndGainTypes::GainCache& gain_cache) {
-    auto get_node_stats = [&](const HypernodeID hypernode) {
-      // TODO(maas): we might want to save the total incident weight in the hypergraph data structure
-      // at some point in the future
-      HyperedgeWeight total_incident_weight = 0;
-      for (const HyperedgeID& he : phg.incidentEdges(hypernode)) {
-        total_incident_weight += phg.edgeWeight(he);
+    // The total incident weights do not change between the rounds of a refinement call.
+    // Thus, only the bucket weights are recomputed, which only requires gain cache lookups.
+    auto& total_incident_weights = data.total_incident_weights;
+    if (!data.incident_weights_are_valid) {
+      if (total_incident_weights.size() < phg.initialNumNodes()) {
+        total_incident_weights.resize(phg.initialNumNodes());
       }
+      phg.doParallelForAllNodes([&](const HypernodeID hn) {
+        HyperedgeWeight total_incident_weight = 0;
+        for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+          total_incident_weight += phg.edgeWeight(he);
+        }
+        total_incident_weights[hn] = total_incident_weight;
+      });
+      data.incident_weights_are_valid = true;
+    }
+
+    auto get_node_stats = [&](const HypernodeID hypernode) {
       HyperedgeWeight internal_weight = gain_cache.penaltyTerm(hypernode, phg.partID(hypernode));
       ASSERT(internal_weight == gain_cache.recomputePenaltyTerm(phg, hypernode));
-      return std::make_pair(internal_weight, total_incident_weight);
+      return std::make_pair(internal_weight, total_incident_weights[hypernode]);
     };
 
     const double bn_treshold = context.refinement.fm.treshold_border_node_inclusion;
@@ -26,31 +26,51 @@
 
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <limits>
 
+#include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
 #include "mt-kahypar/datastructures/priority_queue.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/multi_queue.h"
 #include "mt-kahypar/parallel/work_stack.h"
 
 #include "kahypar-resources/datastructure/fast_reset_flag_array.h"
 
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 namespace mt_kahypar {
 
 
 struct GlobalMoveTracker {
-  vec<Move> moveOrder;
-  vec<MoveID> moveOfNode;
+  // ! Move sequence of the current round. The entries are not initialized, i.e.,
+  // ! only the pages that store performed moves are ever touched.
+  ds::Array<Move> moveOrder;
+  // ! Zero-initialized lazily by the operating system for large instances
+  ds::Array<MoveID> moveOfNode;
   CAtomic<MoveID> runningMoveID;
   MoveID firstMoveID = 1;
 
   explicit GlobalMoveTracker(size_t numNodes = 0) :
-          moveOrder(numNodes),
-          moveOfNode(numNodes, 0),
-          runningMoveID(1) { }
+          moveOrder(),
+          moveOfNode(),
+          runningMoveID(1) {
+    // An allocated array can not be resized, i.e., the default-constructed
+    // tracker must stay unallocated until allocate(...) is called
+    if ( numNodes > 0 ) {
+      allocate(numNodes);
+    }
+  }
+
+  void allocate(const size_t numNodes) {
+    ASSERT(moveOrder.empty() && moveOfNode.empty());
+    moveOrder.resizeNoAssign(numNodes);
+    moveOfNode.resize(numNodes, 0);
+  }
 
   // Returns true if stored move IDs should be reset
   bool reset() {
@@ -67,10 +87,30 @@ struct GlobalMoveTracker {
 
   MoveID insertMove(const Move &m) {
     const MoveID move_id = runningMoveID.fetch_add(1, std::memory_order_relaxed);
+    insertMove(m, move_id);
+    return move_id;
+  }
+
+  // ! Reserves consecutive IDs for a sequence of moves of one thread with a single atomic
+  // ! operation. Each reserved ID must be filled via insertMove(m, move_id) afterwards.
+  MoveID reserveMoveIDs(const size_t num_moves) {
+    const MoveID first_move_id = runningMoveID.fetch_add(num_moves, std::memory_order_relaxed);
+    assert(first_move_id + num_moves - firstMoveID <= moveOrder.size());
+    return first_move_id;
+  }
+
+  void insertMove(const Move &m, const MoveID move_id) {
     assert(move_id - firstMoveID < moveOrder.size());
     moveOrder[move_id - firstMoveID] = m;
     moveOfNode[m.node] = move_id;
-    return move_id;
+  }
+
+  // ! Fills a reserved ID with an invalid move (e.g., if the move could not be applied)
+  void insertInvalidMove(const Move &m, const MoveID move_id) {
+    assert(move_id - firstMoveID < moveOrder.size());
+    Move& invalid_move = moveOrder[move_id - firstMoveID];
+    invalid_move = m;
+    invalid_move.invalidate();
   }
 
   Move& getMove(MoveID move_id) {
@@ -146,6 +186,40 @@ struct NodeTracker {
   }
 };
 
+// Stores the blocks whose vertex PQ was modified since the block PQ of a localized search was last
+// synchronized. This allows to update the block PQ in time proportional to the number of touched
+// blocks instead of k, which matters for very large k where a search only sees a few blocks.
+struct TouchedBlocks {
+  vec<PartitionID> blocks;
+  vec<uint8_t> isTouched;
+
+  explicit TouchedBlocks(const PartitionID k = 0) : blocks(), isTouched(k, false) { }
+
+  void add(const PartitionID block) {
+    ASSERT(static_cast<size_t>(block) < isTouched.size());
+    if ( !isTouched[block] ) {
+      isTouched[block] = true;
+      blocks.push_back(block);
+    }
+  }
+
+  void clear() {
+    for ( const PartitionID block : blocks ) {
+      isTouched[block] = false;
+    }
+    blocks.clear();
+  }
+
+  void resize(const PartitionID k) {
+    clear();
+    isTouched.assign(k, false);
+  }
+
+  size_t size_in_bytes() const {
+    return blocks.capacity() * sizeof(PartitionID) + isTouched.capacity() * sizeof(uint8_t);
+  }
+};
+
 
 // Contains data required for unconstrained FM: We group non-border nodes in buckets based on their
 // incident weight to node weight ratio. This allows to give a (pessimistic) estimate of the effective
@@ -174,7 +248,13 @@ class UnconstrainedFMData {
     bucket_weights(),
     virtual_weight_delta(),
     local_bucket_weights(),
-    rebalancing_nodes(num_nodes) { }
+    rebalancing_nodes(num_nodes),
+    total_incident_weights(),
+    incident_weights_are_valid(false) {
+    for (BucketID bucketId = 0; bucketId < NUM_BUCKETS; ++bucketId) {
+      gain_per_weight[bucketId] = gainPerWeightForBucket(bucketId);
+    }
+  }
 
   template<typename GraphAndGainTypes>
   void initialize(const Context& context,
@@ -199,6 +279,12 @@ class UnconstrainedFMData {
 
   void reset();
 
+  // ! The total incident weights of the nodes are computed once and reused in all
+  // ! subsequent rounds. Must be called if the (hyper)graph changes.
+  void invalidateIncidentWeights() {
+    incident_weights_are_valid = false;
+  }
+
   void changeNumberOfBlocks(PartitionID new_k) {
     if (new_k != current_k) {
       current_k = new_k;
@@ -246,6 +332,84 @@ class UnconstrainedFMData {
   tbb::enumerable_thread_specific<parallel::scalable_vector<HypernodeWeight>> local_bucket_weights;
   parallel::scalable_vector<parallel::scalable_vector<HypernodeWeight>> fallback_bucket_weights;
   kahypar::ds::FastResetFlagArray<> rebalancing_nodes;
+  // ! Upper bound of the gain values in each (non-fallback) bucket
+  std::array<double, NUM_BUCKETS> gain_per_weight;
+  // ! Sum of the weights of all incident (hyper)edges of each node
+  parallel::scalable_vector<HyperedgeWeight> total_incident_weights;
+  bool incident_weights_are_valid;
+};
+
+
+/*!
+ * Statistics about the localized FM searches of the current level. For each improvement,
+ * we record the number of moves since the previous improvement of the search in a histogram
+ * with buckets for powers of two. The adaptive stop rule uses them to stop searches that run
+ * far past the point where the searches of previous rounds found their improvements.
+ */
+class FMStopStatistics {
+  static constexpr size_t NUM_BUCKETS = 32;
+  static constexpr size_t MIN_NUM_IMPROVEMENTS = 32;
+  static constexpr size_t MIN_MOVES_WITHOUT_IMPROVEMENT = 16;
+  static constexpr double QUANTILE = 0.95;
+
+ public:
+  FMStopStatistics() {
+    reset();
+  }
+
+  void reset() {
+    for ( CAtomic<size_t>& count : _moves_until_improvement ) {
+      count.store(0, std::memory_order_relaxed);
+    }
+    _num_moves.store(0, std::memory_order_relaxed);
+    _num_wasted_moves.store(0, std::memory_order_relaxed);
+  }
+
+  // ! Registers that a search improved the solution after the given number of moves
+  void addImprovement(const size_t num_moves) {
+    ASSERT(num_moves > 0);
+    const size_t bucket = std::min(NUM_BUCKETS - 1, static_cast<size_t>(std::log2(num_moves)));
+    _moves_until_improvement[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // ! Registers a finished search, which discarded its last num_wasted_moves moves
+  void addSearch(const size_t num_moves, const size_t num_wasted_moves) {
+    _num_moves.fetch_add(num_moves, std::memory_order_relaxed);
+    _num_wasted_moves.fetch_add(num_wasted_moves, std::memory_order_relaxed);
+  }
+
+  // ! Returns the number of moves without improvement after which a search should stop
+  size_t maxMovesWithoutImprovement(const double factor) const {
+    size_t num_improvements = 0;
+    for ( const CAtomic<size_t>& count : _moves_until_improvement ) {
+      num_improvements += count.load(std::memory_order_relaxed);
+    }
+    if ( factor <= 0.0 || num_improvements < MIN_NUM_IMPROVEMENTS ) {
+      return std::numeric_limits<size_t>::max();
+    }
+
+    size_t bucket = 0;
+    size_t prefix_sum = _moves_until_improvement[0].load(std::memory_order_relaxed);
+    while ( prefix_sum < QUANTILE * num_improvements ) {
+      prefix_sum += _moves_until_improvement[++bucket].load(std::memory_order_relaxed);
+    }
+    // upper bound of the number of moves in the bucket
+    const size_t max_moves = (UL(1) << (bucket + 1)) - 1;
+    return std::max(MIN_MOVES_WITHOUT_IMPROVEMENT, static_cast<size_t>(factor * max_moves));
+  }
+
+  size_t numMoves() const {
+    return _num_moves.load(std::memory_order_relaxed);
+  }
+
+  size_t numWastedMoves() const {
+    return _num_wasted_moves.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::array<CAtomic<size_t>, NUM_BUCKETS> _moves_until_improvement;
+  CAtomic<size_t> _num_moves;
+  CAtomic<size_t> _num_wasted_moves;
 };
 
 
@@ -253,9 +417,17 @@ struct FMSharedData {
   // ! Number of Nodes
   size_t numberOfNodes;
 
+  // ! Number of threads that can run localized FM searches (one work queue per thread)
+  size_t numberOfThreads;
+
   // ! Nodes to initialize the localized FM searches with
   WorkContainer<HypernodeID> refinementNodes;
 
+  // ! Nodes to initialize the localized FM searches with, ordered by their gain
+  // ! (used instead of refinementNodes if gain_ordered_seeds is set)
+  MultiQueue<HypernodeID, Gain> prioritizedRefinementNodes;
+  bool gain_ordered_seeds = false;
+
   // ! PQ handles shared by all threads (each vertex is only held by one thread)
   vec<PosT> vertexPQHandles;
 
@@ -271,6 +443,12 @@ struct FMSharedData {
   // ! Additional data for unconstrained FM algorithm
   UnconstrainedFMData unconstrained;
 
+  // ! Statistics of the localized searches used by the adaptive stop rule
+  FMStopStatistics stopStatistics;
+
+  // ! A localized search stops after this number of moves without improvement
+  size_t maxMovesWithoutImprovement = std::numeric_limits<size_t>::max();
+
   // ! Stop parallel refinement if finishedTasks > finishedTasksLimit to avoid long-running single searches
   CAtomic<size_t> finishedTasks;
   size_t finishedTasksLimit = std::numeric_limits<size_t>::max();
@@ -279,7 +457,9 @@ struct FMSharedData {
 
   FMSharedData(size_t numNodes, size_t numThreads) :
     numberOfNodes(numNodes),
+    numberOfThreads(numThreads),
     refinementNodes(), //numNodes, numThreads),
+    prioritizedRefinementNodes(),
     vertexPQHandles(), //numPQHandles, invalid_position),
     moveTracker(), //numNodes),
     nodeTracker(), //numNodes),
@@ -288,28 +468,38 @@ struct FMSharedData {
     finishedTasks.store(0, std::memory_order_relaxed);
 
     tbb::parallel_invoke([&] {
-      moveTracker.moveOrder.resize(numNodes);
-    }, [&] {
-      moveTracker.moveOfNode.resize(numNodes);
+      moveTracker.allocate(numNodes);
     }, [&] {
       nodeTracker.searchOfNode.resize(numNodes, CAtomic<SearchID>(0));
     }, [&] {
       vertexPQHandles.resize(numNodes, invalid_position);
     }, [&] {
       refinementNodes.tls_queues.resize(numThreads);
+      prioritizedRefinementNodes.resize(numThreads);
     }, [&] {
       targetPart.resize(numNodes, kInvalidPartition);
     });
   }
 
+  // ! Sized for the task arena in which the refiner is constructed, which
+  // ! might be smaller than the number of threads of the process
   FMSharedData(size_t numNodes) :
     FMSharedData(
       numNodes,
-      TBBInitializer::instance().total_number_of_threads())  { }
+      tbb::this_task_arena::max_concurrency())  { }
 
   FMSharedData() :
     FMSharedData(0, 0) { }
 
+  size_t numRefinementNodes() const {
+    return gain_ordered_seeds ? prioritizedRefinementNodes.unsafe_size() : refinementNodes.unsafe_size();
+  }
+
+  bool tryPopRefinementNode(HypernodeID& dest, size_t thread_id) {
+    return gain_ordered_seeds ? prioritizedRefinementNodes.try_pop(dest, thread_id) :
+                                refinementNodes.try_pop(dest, thread_id);
+  }
+
   void memoryConsumption(utils::MemoryTreeNode* parent) const {
     ASSERT(parent);
 
@@ -318,11 +508,12 @@ struct FMSharedData {
     utils::MemoryTreeNode* pq_handles_node = shared_fm_data_node->addChild("PQ Handles");
     pq_handles_node->updateSize(vertexPQHandles.capacity() * sizeof(PosT));
     utils::MemoryTreeNode* move_tracker_node = shared_fm_data_node->addChild("Move Tracker");
-    move_tracker_node->updateSize(moveTracker.moveOrder.capacity() * sizeof(Move) +
-                                  moveTracker.moveOfNode.capacity() * sizeof(MoveID));
+    move_tracker_node->updateSize(moveTracker.moveOrder.size() * sizeof(Move) +
+                                  moveTracker.moveOfNode.size() * sizeof(MoveID));
     utils::MemoryTreeNode* node_tracker_node = shared_fm_data_node->addChild("Node Tracker");
     node_tracker_node->updateSize(nodeTracker.searchOfNode.capacity() * sizeof(SearchID));
     refinementNodes.memoryConsumption(shared_fm_data_node);
+    prioritizedRefinementNodes.memoryConsumption(shared_fm_data_node);
   }
 };
 
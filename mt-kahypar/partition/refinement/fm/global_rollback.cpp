@@ -26,7 +26,7 @@
 
 #include "mt-kahypar/partition/refinement/fm/global_rollback.h"
 
-#include <tbb/parallel_scan.h>
+#include <tbb/parallel_reduce.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/metrics.h"
@@ -34,126 +34,11 @@
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
 #include "mt-kahypar/datastructures/synchronized_edge_update.h"
+#include "mt-kahypar/parallel/parallel_counting_sort.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 
 namespace mt_kahypar {
 
-  template<typename PartitionedHypergraph>
-  struct BalanceAndBestIndexScan {
-    const PartitionedHypergraph& phg;
-    const vec<Move>& moves;
-
-    struct Prefix {
-      Gain gain = 0;                           /** gain when using valid moves up to best_index */
-      MoveID best_index = 0;                   /** local ID of first move to revert */
-      HypernodeWeight heaviest_weight =
-              std::numeric_limits<HypernodeWeight>::max();   /** weight of the heaviest part */
-
-      bool operator<(const Prefix& o) const {
-        return gain > o.gain ||
-               (gain == o.gain && std::tie(heaviest_weight, best_index) < std::tie(o.heaviest_weight, o.best_index));
-      }
-    };
-    std::shared_ptr< tbb::enumerable_thread_specific<Prefix> > local_best;
-
-    Gain gain_sum = 0;
-
-    vec<HypernodeWeight> part_weights;
-    const std::vector<HypernodeWeight>& max_part_weights;
-
-    BalanceAndBestIndexScan(BalanceAndBestIndexScan& b, tbb::split) :
-            phg(b.phg),
-            moves(b.moves),
-            local_best(b.local_best),
-            gain_sum(0),
-            part_weights(b.part_weights.size(), 0),
-            max_part_weights(b.max_part_weights) { }
-
-
-    BalanceAndBestIndexScan(const PartitionedHypergraph& phg,
-                            const vec<Move>& moves,
-                            const vec<HypernodeWeight>& part_weights,
-                            const std::vector<HypernodeWeight>& max_part_weights) :
-            phg(phg),
-            moves(moves),
-            local_best(std::make_shared< tbb::enumerable_thread_specific<Prefix> >()),
-            part_weights(part_weights),
-            max_part_weights(max_part_weights)
-    {
-    }
-
-
-    void operator()(const tbb::blocked_range<MoveID>& r, tbb::pre_scan_tag ) {
-      for (MoveID i = r.begin(); i < r.end(); ++i) {
-        const Move& m = moves[i];
-        if (m.isValid()) {  // skip locally reverted moves
-          gain_sum += m.gain;
-          part_weights[m.from] -= phg.nodeWeight(m.node);
-          part_weights[m.to] += phg.nodeWeight(m.node);
-        }
-      }
-    }
-
-    // subranges a | b | c | d . assuming this ran pre_scan on c,
-    // then lhs ran pre_scan on b and final_scan of this will be on d
-    void reverse_join(BalanceAndBestIndexScan& lhs) {
-      for (size_t i = 0; i < part_weights.size(); ++i) {
-        part_weights[i] += lhs.part_weights[i];
-      }
-      gain_sum += lhs.gain_sum;
-    }
-
-    void operator()(const tbb::blocked_range<MoveID>& r, tbb::final_scan_tag ) {
-      size_t overloaded = 0;
-      for (size_t i = 0; i < part_weights.size(); ++i) {
-        if (part_weights[i] > max_part_weights[i]) {
-          overloaded++;
-        }
-      }
-
-      Prefix current;
-      for (MoveID i = r.begin(); i < r.end(); ++i) {
-        const Move& m = moves[i];
-
-        if (m.isValid()) {  // skip locally reverted moves
-          gain_sum += m.gain;
-
-          const bool from_overloaded = part_weights[m.from] > max_part_weights[m.from];
-          part_weights[m.from] -= phg.nodeWeight(m.node);
-          if (from_overloaded && part_weights[m.from] <= max_part_weights[m.from]) {
-            overloaded--;
-          }
-          const bool to_overloaded = part_weights[m.to] > max_part_weights[m.to];
-          part_weights[m.to] += phg.nodeWeight(m.node);
-          if (!to_overloaded && part_weights[m.to] > max_part_weights[m.to]) {
-            overloaded++;
-          }
-
-          if (overloaded == 0 && gain_sum >= current.gain) {
-            Prefix new_prefix = { gain_sum, i + 1, *std::max_element(part_weights.begin(), part_weights.end()) };
-            current = std::min(current, new_prefix);
-          }
-        }
-      }
-
-      if (current.best_index != 0) {
-        Prefix& lb = local_best->local();
-        lb = std::min(lb, current);
-      }
-    }
-
-    void assign(BalanceAndBestIndexScan& b) {
-      gain_sum = b.gain_sum;
-    }
-
-    Prefix finalize(const vec<HypernodeWeight>& initial_part_weights) {
-      Prefix res { 0, 0, *std::max_element(initial_part_weights.begin(), initial_part_weights.end()) };
-      for (const Prefix& x : *local_best) {
-        res = std::min(res, x);
-      }
-      return res;
-    }
-  };
-
   template<typename GraphAndGainTypes>
   HyperedgeWeight GlobalRollback<GraphAndGainTypes>::revertToBestPrefixParallel(
           PartitionedHypergraph& phg, FMSharedData& sharedData,
@@ -161,15 +46,12 @@ namespace mt_kahypar {
     const MoveID numMoves = sharedData.moveTracker.numPerformedMoves();
     if (numMoves == 0) return 0;
 
-    const vec<Move>& move_order = sharedData.moveTracker.moveOrder;
+    const ds::Array<Move>& move_order = sharedData.moveTracker.moveOrder;
 
     recalculateGains(phg, sharedData);
     HEAVY_REFINEMENT_ASSERT(verifyGains(phg, sharedData));
 
-    BalanceAndBestIndexScan<PartitionedHypergraph> s(phg, move_order, partWeights, maxPartWeights);
-    // TODO set grain size in blocked_range? to avoid too many copies of part weights array. experiment with different values
-    tbb::parallel_scan(tbb::blocked_range<MoveID>(0, numMoves), s);
-    typename BalanceAndBestIndexScan<PartitionedHypergraph>::Prefix b = s.finalize(partWeights);
+    const BestPrefix b = findBestPrefix(phg, move_order, numMoves, partWeights, maxPartWeights);
 
     tbb::parallel_for(b.best_index, numMoves, [&](const MoveID moveID) {
       const Move& m = move_order[moveID];
@@ -191,6 +73,96 @@ namespace mt_kahypar {
     return b.gain;
   }
 
+  template<typename GraphAndGainTypes>
+  typename GlobalRollback<GraphAndGainTypes>::BestPrefix GlobalRollback<GraphAndGainTypes>::findBestPrefix(
+          const PartitionedHypergraph& phg, const ds::Array<Move>& move_order, const MoveID num_moves,
+          const vec<HypernodeWeight>& part_weights, const std::vector<HypernodeWeight>& max_part_weights) {
+    const PartitionID k = context.partition.k;
+    const size_t num_deltas = 2 * static_cast<size_t>(num_moves);
+    tbb::parallel_invoke([&] {
+      prefix_gains.resize(num_moves);
+    }, [&] {
+      num_overloaded_blocks.resize(num_moves);
+    }, [&] {
+      weight_deltas.resize(num_deltas);
+    }, [&] {
+      sorted_weight_deltas.resize(num_deltas);
+    }, [&] {
+      block_weights.resize(num_deltas);
+    });
+
+    // Each move induces a weight change for its source and target block.
+    // Note that a locally reverted move does not change the gain or the block weights.
+    tbb::parallel_for(MoveID(0), num_moves, [&](const MoveID i) {
+      const Move& m = move_order[i];
+      const bool is_valid = m.isValid();
+      const HypernodeWeight weight = is_valid ? phg.nodeWeight(m.node) : 0;
+      prefix_gains[i] = is_valid ? m.gain : 0;
+      weight_deltas[2 * i] = BlockWeightDelta { is_valid ? m.from : 0, 2 * i, -weight };
+      weight_deltas[2 * i + 1] = BlockWeightDelta { is_valid ? m.to : 0, 2 * i + 1, weight };
+    });
+
+    // Group the weight changes by block (the sort is stable, i.e., the move order is preserved)
+    // and compute the weight of each block after each move via a prefix sum per block
+    auto get_block = [&](const BlockWeightDelta& delta) {
+      return static_cast<size_t>(delta.block);
+    };
+    const vec<uint32_t> block_begin = parallel::counting_sort(
+      weight_deltas, sorted_weight_deltas, k, get_block, context.shared_memory.num_threads);
+    tbb::parallel_for(UL(0), num_deltas, [&](const size_t j) {
+      block_weights[j] = sorted_weight_deltas[j].delta;
+    });
+    tbb::parallel_for(PartitionID(0), k, [&](const PartitionID block) {
+      parallel_prefix_sum(block_weights.begin() + block_begin[block],
+                          block_weights.begin() + block_begin[block + 1],
+                          block_weights.begin() + block_begin[block],
+                          std::plus<HypernodeWeight>(), 0);
+    });
+
+    // Determine how each move changes the number of overloaded blocks. We reuse
+    // the unsorted weight deltas to store the change at the position of the move.
+    tbb::parallel_for(UL(0), num_deltas, [&](const size_t j) {
+      const BlockWeightDelta& delta = sorted_weight_deltas[j];
+      const HypernodeWeight weight_after = part_weights[delta.block] + block_weights[j];
+      const HypernodeWeight weight_before = weight_after - delta.delta;
+      weight_deltas[delta.index].delta =
+        static_cast<HypernodeWeight>(weight_after > max_part_weights[delta.block]) -
+        static_cast<HypernodeWeight>(weight_before > max_part_weights[delta.block]);
+    });
+    int initial_num_overloaded_blocks = 0;
+    for (PartitionID block = 0; block < k; ++block) {
+      if (part_weights[block] > max_part_weights[block]) {
+        ++initial_num_overloaded_blocks;
+      }
+    }
+    tbb::parallel_for(MoveID(0), num_moves, [&](const MoveID i) {
+      num_overloaded_blocks[i] = weight_deltas[2 * i].delta + weight_deltas[2 * i + 1].delta;
+    });
+    num_overloaded_blocks[0] += initial_num_overloaded_blocks;
+
+    // Prefix sums yield the gain and the number of overloaded blocks after each move
+    tbb::parallel_invoke([&] {
+      parallel_prefix_sum(prefix_gains.begin(), prefix_gains.end(),
+                          prefix_gains.begin(), std::plus<Gain>(), 0);
+    }, [&] {
+      parallel_prefix_sum(num_overloaded_blocks.begin(), num_overloaded_blocks.end(),
+                          num_overloaded_blocks.begin(), std::plus<int>(), 0);
+    });
+
+    // Find the balanced prefix with highest gain. Ties are broken in favor of shorter prefixes.
+    return tbb::parallel_reduce(tbb::blocked_range<MoveID>(0, num_moves), BestPrefix { 0, 0 },
+      [&](const tbb::blocked_range<MoveID>& r, BestPrefix best) {
+        for (MoveID i = r.begin(); i < r.end(); ++i) {
+          if (move_order[i].isValid() && num_overloaded_blocks[i] == 0) {
+            best = std::min(best, BestPrefix { prefix_gains[i], i + 1 });
+          }
+        }
+        return best;
+      }, [](const BestPrefix& lhs, const BestPrefix& rhs) {
+        return std::min(lhs, rhs);
+      });
+  }
+
   template<typename GraphAndGainTypes>
   void GlobalRollback<GraphAndGainTypes>::recalculateGainForHyperedge(PartitionedHypergraph& phg,
                                                                    FMSharedData& sharedData,
@@ -400,7 +372,7 @@ namespace mt_kahypar {
 
     GlobalMoveTracker& tracker = sharedData.moveTracker;
     const MoveID numMoves = tracker.numPerformedMoves();
-    const vec<Move>& move_order = tracker.moveOrder;
+    const ds::Array<Move>& move_order = tracker.moveOrder;
 
     // revert all moves
     tbb::parallel_for(0U, numMoves, [&](const MoveID localMoveID) {
@@ -466,7 +438,7 @@ namespace mt_kahypar {
 
   template<typename GraphAndGainTypes>
   bool GlobalRollback<GraphAndGainTypes>::verifyGains(PartitionedHypergraph& phg, FMSharedData& sharedData) {
-    vec<Move>& move_order = sharedData.moveTracker.moveOrder;
+    ds::Array<Move>& move_order = sharedData.moveTracker.moveOrder;
 
     auto recompute_penalty_terms = [&] {
       for (MoveID localMoveID = 0; localMoveID < sharedData.moveTracker.numPerformedMoves(); ++localMoveID) {
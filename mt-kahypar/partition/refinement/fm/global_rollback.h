@@ -43,6 +43,21 @@ class GlobalRollback {
   using Rollback = typename GraphAndGainTypes::Rollback;
   using RecalculationData = typename Rollback::RecalculationData;
 
+  struct BestPrefix {
+    Gain gain = 0;             /** gain when using valid moves up to best_index */
+    MoveID best_index = 0;     /** local ID of first move to revert */
+
+    bool operator<(const BestPrefix& o) const {
+      return gain > o.gain || (gain == o.gain && best_index < o.best_index);
+    }
+  };
+
+  struct BlockWeightDelta {
+    PartitionID block;
+    size_t index;               /** 2 * move ID for the source block and 2 * move ID + 1 for the target block */
+    HypernodeWeight delta;
+  };
+
 public:
   explicit GlobalRollback(const HyperedgeID num_hyperedges,
                           const Context& context,
@@ -52,7 +67,12 @@ public:
     max_part_weight_scaling(context.refinement.fm.rollback_balance_violation_factor),
     ets_recalc_data([&] { return vec<RecalculationData>(context.partition.k); }),
     last_recalc_round(),
-    round(1) {
+    round(1),
+    prefix_gains(),
+    num_overloaded_blocks(),
+    weight_deltas(),
+    sorted_weight_deltas(),
+    block_weights() {
     if (context.refinement.fm.iter_moves_on_recalc && context.refinement.fm.rollback_parallel) {
       last_recalc_round.resize(num_hyperedges, CAtomic<uint32_t>(0));
     }
@@ -85,6 +105,14 @@ public:
                                                      const HyperedgeID& he);
   void recalculateGains(PartitionedHypergraph& phg, FMSharedData& sharedData);
 
+  // ! Computes the balanced prefix of the move sequence with the highest gain
+  // ! via parallel prefix sums over the move gains and the block weights
+  BestPrefix findBestPrefix(const PartitionedHypergraph& phg,
+                            const ds::Array<Move>& move_order,
+                            const MoveID num_moves,
+                            const vec<HypernodeWeight>& part_weights,
+                            const std::vector<HypernodeWeight>& max_part_weights);
+
   HyperedgeWeight revertToBestPrefixSequential(PartitionedHypergraph& phg,
                                                FMSharedData& sharedData,
                                                const vec<HypernodeWeight>&,
@@ -116,6 +144,13 @@ private:
   tbb::enumerable_thread_specific< vec<RecalculationData> > ets_recalc_data;
   vec<CAtomic<uint32_t>> last_recalc_round;
   uint32_t round;
+
+  // ! Buffers for finding the best prefix
+  vec<Gain> prefix_gains;
+  vec<int> num_overloaded_blocks;
+  vec<BlockWeightDelta> weight_deltas;
+  vec<BlockWeightDelta> sorted_weight_deltas;
+  vec<HypernodeWeight> block_weights;
 };
 
 }
\ No newline at end of file
@@ -31,6 +31,8 @@
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/gain_cache_strategy.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/unconstrained_strategy.h"
+#include "mt-kahypar/utils/prefetch.h"
+#include "mt-kahypar/utils/utilities.h"
 
 namespace mt_kahypar {
 
@@ -43,7 +45,7 @@ namespace mt_kahypar {
 
     HypernodeID seedNode;
     HypernodeID pushes = 0;
-    while (pushes < numSeeds && sharedData.refinementNodes.try_pop(seedNode, taskID)) {
+    while (pushes < numSeeds && sharedData.tryPopRefinementNode(seedNode, taskID)) {
       if (sharedData.nodeTracker.tryAcquireNode(seedNode, thisSearch)) {
         fm_strategy.insertIntoPQ(phg, gain_cache, seedNode);
         pushes++;
@@ -51,16 +53,54 @@ namespace mt_kahypar {
     }
 
     if (pushes > 0) {
+      utils::Timer::ScopedTraceSpan span(
+        utils::Utilities::instance().getTimer(context.utility_id), "Localized FM Search", "fm");
+      span.addArg("seeds", pushes);
       deltaPhg.clear();
       deltaPhg.setPartitionedHypergraph(&phg);
       delta_gain_cache.clear();
-      internalFindMoves(phg, fm_strategy);
+      internalFindMoves<false>(phg, fm_strategy);
       return true;
     } else {
       return false;
     }
   }
 
+  template<typename GraphAndGainTypes>
+  template<typename DispatchedFMStrategy>
+  void LocalizedKWayFM<GraphAndGainTypes>::findMovesInRegion(DispatchedFMStrategy& fm_strategy, PartitionedHypergraph& phg,
+                                                          const vec<HypernodeID>& seeds, const size_t first, const size_t last,
+                                                          const vec<SearchID>& search_region, const SearchID region,
+                                                          vec<Move>& moves) {
+    localMoves.clear();
+    moves.clear();
+    // Note that the value of the search ID is not deterministic, but it is only used to identify the nodes of this search
+    thisSearch = ++sharedData.nodeTracker.highestActiveSearchID;
+    searchRegion = &search_region;
+    thisRegion = region;
+
+    HypernodeID pushes = 0;
+    for (size_t i = first; i < last; ++i) {
+      const HypernodeID seedNode = seeds[i];
+      if (search_region[seedNode] == region && sharedData.nodeTracker.tryAcquireNode(seedNode, thisSearch)) {
+        fm_strategy.insertIntoPQ(phg, gain_cache, seedNode);
+        pushes++;
+      }
+    }
+
+    if (pushes > 0) {
+      deltaPhg.clear();
+      deltaPhg.setPartitionedHypergraph(&phg);
+      delta_gain_cache.clear();
+      internalFindMoves<true>(phg, fm_strategy);
+      for (const auto& local_move : localMoves) {
+        moves.push_back(local_move.first);
+      }
+      localMoves.clear();
+    }
+    searchRegion = nullptr;
+  }
+
   template<typename Partition>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE std::pair<PartitionID, HypernodeWeight>
   heaviestPartAndWeight(const Partition& partition, const PartitionID k) {
@@ -76,7 +116,7 @@ namespace mt_kahypar {
   }
 
   template<typename GraphAndGainTypes>
-  template<bool has_fixed_vertices, typename PHG, typename CACHE, typename DispatchedFMStrategy>
+  template<bool has_fixed_vertices, bool deterministic, typename PHG, typename CACHE, typename DispatchedFMStrategy>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void LocalizedKWayFM<GraphAndGainTypes>::acquireOrUpdateNeighbors(PHG& phg, CACHE& gain_cache, const Move& move,
                                                                  DispatchedFMStrategy& fm_strategy) {
@@ -84,32 +124,37 @@ namespace mt_kahypar {
       SearchID searchOfV = sharedData.nodeTracker.searchOfNode[v].load(std::memory_order_relaxed);
       if (searchOfV == thisSearch) {
         fm_strategy.updateGain(phg, gain_cache, v, move);
-      } else if (sharedData.nodeTracker.tryAcquireNode(v, thisSearch)) {
+      } else if ((!deterministic || (*searchRegion)[v] == thisRegion)
+                 && sharedData.nodeTracker.tryAcquireNode(v, thisSearch)) {
         fm_strategy.insertIntoPQ(phg, gain_cache, v);
       }
     };
 
     if constexpr (PartitionedHypergraph::is_graph) {
       // simplified case for graphs: neighbors can't be duplicated
-      for (HyperedgeID e : phg.incidentEdges(move.node)) {
+      utils::forEachWithLookahead(phg.incidentEdges(move.node), [&](const HyperedgeID e) {
+        utils::prefetch(sharedData.nodeTracker.searchOfNode.data() + phg.edgeTarget(e));
+      }, [&](const HyperedgeID e) {
         HypernodeID v = phg.edgeTarget(e);
-        if ( has_fixed_vertices && phg.isFixed(v) ) continue;
+        if ( has_fixed_vertices && phg.isFixed(v) ) return;
 
         updateOrAcquire(v);
-      }
+      });
     } else {
       // Note: only vertices incident to edges with gain changes can become new boundary vertices.
       // Vertices that already were boundary vertices, can still be considered later since they are in the task queue
       for (HyperedgeID e : edgesWithGainChanges) {
         if (phg.edgeSize(e) < context.partition.ignore_hyperedge_size_threshold) {
-          for (HypernodeID v : phg.pins(e)) {
-            if ( has_fixed_vertices && phg.isFixed(v) ) continue;
+          utils::forEachWithLookahead(phg.pins(e), [&](const HypernodeID v) {
+            utils::prefetch(sharedData.nodeTracker.searchOfNode.data() + v);
+          }, [&](const HypernodeID v) {
+            if ( has_fixed_vertices && phg.isFixed(v) ) return;
 
             if (neighborDeduplicator[v] != deduplicationTime) {
               updateOrAcquire(v);
               neighborDeduplicator[v] = deduplicationTime;
             }
-          }
+          });
         }
       }
 
@@ -122,20 +167,29 @@ namespace mt_kahypar {
 
 
   template<typename GraphAndGainTypes>
-  template<typename DispatchedFMStrategy>
+  template<bool deterministic, typename DispatchedFMStrategy>
   void LocalizedKWayFM<GraphAndGainTypes>::internalFindMoves(PartitionedHypergraph& phg,
                                                           DispatchedFMStrategy& fm_strategy) {
-    StopRule stopRule(phg.initialNumNodes());
+    StopRule stopRule(phg.initialNumNodes(),
+      deterministic ? std::numeric_limits<size_t>::max() : sharedData.maxMovesWithoutImprovement);
     Move move;
+    size_t numMoves = 0;
 
     Gain estimatedImprovement = 0;
     Gain bestImprovement = 0;
+    // In deterministic mode, moves are not applied to the global partition during the search.
+    // Instead, we remember the length of the best prefix of the local move sequence.
+    size_t bestPrefixLength = 0;
 
     HypernodeWeight heaviestPartWeight = 0;
     HypernodeWeight fromWeight = 0, toWeight = 0;
 
-    while (!stopRule.searchShouldStop()
-           && sharedData.finishedTasks.load(std::memory_order_relaxed) < sharedData.finishedTasksLimit) {
+    auto reachedFinishedTasksLimit = [&] {
+      return !deterministic &&
+        sharedData.finishedTasks.load(std::memory_order_relaxed) >= sharedData.finishedTasksLimit;
+    };
+
+    while (!stopRule.searchShouldStop() && !reachedFinishedTasksLimit()) {
 
       if (!fm_strategy.findNextMove(deltaPhg, delta_gain_cache, move)) break;
       sharedData.nodeTracker.deactivateNode(move.node, thisSearch);
@@ -162,7 +216,7 @@ namespace mt_kahypar {
       heaviestPartWeight = heaviestPartAndWeight(deltaPhg, context.partition.k).second;
       fromWeight = deltaPhg.partWeight(move.from);
       toWeight = deltaPhg.partWeight(move.to);
-      if (expect_improvement) {
+      if (expect_improvement && !deterministic) {
         // since we will flush the move sequence, don't bother running it through the deltaPhg
         // this is intended to allow moving high deg nodes (blow up hash tables) if they give an improvement.
         // The nets affected by a gain cache update are collected when we apply this improvement on the
@@ -180,6 +234,7 @@ namespace mt_kahypar {
       }
 
       if (moved) {
+        ++numMoves;
         estimatedImprovement += move.gain;
         localMoves.emplace_back(move, move_id);
         stopRule.update(move.gain);
@@ -187,15 +242,26 @@ namespace mt_kahypar {
         bool improved_balance_less_equal_km1 = estimatedImprovement >= bestImprovement
                                                      && fromWeight == heaviestPartWeight
                                                      && toWeight + phg.nodeWeight(move.node) < heaviestPartWeight;
-        if (improved_km1 || improved_balance_less_equal_km1) {
-          // Apply move sequence to global partition
+        if ((improved_km1 || improved_balance_less_equal_km1) && deterministic) {
+          bestPrefixLength = localMoves.size();
+          stopRule.reset();
+          bestImprovement = estimatedImprovement;
+        } else if (improved_km1 || improved_balance_less_equal_km1) {
+          sharedData.stopStatistics.addImprovement(localMoves.size());
+          // Apply move sequence to global partition. The IDs of the whole sequence
+          // are reserved at once to avoid contention on the global move counter.
+          const MoveID first_move_id = sharedData.moveTracker.reserveMoveIDs(localMoves.size());
           for (size_t i = 0; i < localMoves.size(); ++i) {
             const Move& local_move = localMoves[i].first;
-            phg.changeNodePart(
+            const bool moved = phg.changeNodePart(
                     gain_cache, local_move.node, local_move.from, local_move.to,
                     std::numeric_limits<HypernodeWeight>::max(),
-                    [&] { sharedData.moveTracker.insertMove(local_move); },
+                    [&] { sharedData.moveTracker.insertMove(local_move, first_move_id + i); },
                     [&](const SynchronizedEdgeUpdate& ) {});
+            if (!moved) {
+              // the reserved ID must not refer to an uninitialized entry
+              sharedData.moveTracker.insertInvalidMove(local_move, first_move_id + i);
+            }
           }
           localMoves.clear();
           fm_strategy.flushLocalChanges();
@@ -206,20 +272,25 @@ namespace mt_kahypar {
         }
 
         // no need to update our PQs if we stop anyways
-        if (stopRule.searchShouldStop()
-              || sharedData.finishedTasks.load(std::memory_order_relaxed) >= sharedData.finishedTasksLimit) {
+        if (stopRule.searchShouldStop() || reachedFinishedTasksLimit()) {
           break;
         }
 
         if (phg.hasFixedVertices()) {
-          acquireOrUpdateNeighbors<true>(deltaPhg, delta_gain_cache, move, fm_strategy);
+          acquireOrUpdateNeighbors<true, deterministic>(deltaPhg, delta_gain_cache, move, fm_strategy);
         } else {
-          acquireOrUpdateNeighbors<false>(deltaPhg, delta_gain_cache, move, fm_strategy);
+          acquireOrUpdateNeighbors<false, deterministic>(deltaPhg, delta_gain_cache, move, fm_strategy);
         }
 
       }
     }
 
+    if constexpr (deterministic) {
+      localMoves.resize(bestPrefixLength);
+    } else {
+      // moves after the last improvement are not applied to the global partition
+      sharedData.stopStatistics.addSearch(numMoves, localMoves.size());
+    }
     fm_strategy.reset();
   }
 
@@ -228,6 +299,7 @@ namespace mt_kahypar {
   void LocalizedKWayFM<GraphAndGainTypes>::changeNumberOfBlocks(const PartitionID new_k) {
     deltaPhg.changeNumberOfBlocks(new_k);
     blockPQ.resize(new_k);
+    touchedBlocks.resize(new_k);
     for ( VertexPriorityQueue& pq : vertexPQs ) {
       pq.setHandle(sharedData.vertexPQHandles.data(), sharedData.numberOfNodes);
     }
@@ -251,7 +323,7 @@ namespace mt_kahypar {
             vertexPQs.begin(), vertexPQs.end(), 0,
             [](size_t init, const VertexPriorityQueue& pq) { return init + pq.size_in_bytes(); }
     );
-    localized_fm_node->addChild("PQs", blockPQ.size_in_bytes() + vertex_pq_sizes);
+    localized_fm_node->addChild("PQs", blockPQ.size_in_bytes() + vertex_pq_sizes + touchedBlocks.size_in_bytes());
 
     utils::MemoryTreeNode *local_moves_node = parent->addChild("Local FM Moves");
     local_moves_node->updateSize(localMoves.capacity() * sizeof(std::pair<Move, MoveID>));
@@ -265,7 +337,10 @@ namespace mt_kahypar {
     template bool LocalizedKWayFM<X>::findMoves(LocalUnconstrainedStrategy&,                            \
                     typename LocalizedKWayFM<X>::PartitionedHypergraph&, size_t, size_t);               \
     template bool LocalizedKWayFM<X>::findMoves(LocalGainCacheStrategy&,                                \
-                    typename LocalizedKWayFM<X>::PartitionedHypergraph&, size_t, size_t)
+                    typename LocalizedKWayFM<X>::PartitionedHypergraph&, size_t, size_t);               \
+    template void LocalizedKWayFM<X>::findMovesInRegion(LocalGainCacheStrategy&,                        \
+                    typename LocalizedKWayFM<X>::PartitionedHypergraph&, const vec<HypernodeID>&,       \
+                    size_t, size_t, const vec<SearchID>&, SearchID, vec<Move>&)
   }
 
   INSTANTIATE_CLASS_WITH_VALID_TRAITS(LOCALIZED_KWAY_FM)
@@ -67,28 +67,38 @@ public:
     sharedData(sharedData),
     blockPQ(static_cast<size_t>(context.partition.k)),
     vertexPQs(static_cast<size_t>(context.partition.k),
-      VertexPriorityQueue(sharedData.vertexPQHandles.data(), sharedData.numberOfNodes)) {
+      VertexPriorityQueue(sharedData.vertexPQHandles.data(), sharedData.numberOfNodes)),
+    touchedBlocks(context.partition.k) {
     const bool top_level = context.type == ContextType::main;
     delta_gain_cache.initialize(top_level ? MAP_SIZE_LARGE : MAP_SIZE_MOVE_DELTA);
   }
 
   template<typename DispatchedFMStrategy>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE DispatchedFMStrategy initializeDispatchedStrategy() {
-    return DispatchedFMStrategy(context, sharedData, blockPQ, vertexPQs);
+    return DispatchedFMStrategy(context, sharedData, blockPQ, vertexPQs, touchedBlocks);
   }
 
   template<typename DispatchedFMStrategy>
   bool findMoves(DispatchedFMStrategy& fm_strategy, PartitionedHypergraph& phg, size_t taskID, size_t numSeeds);
 
+  // ! Deterministic variant of findMoves(...) used in deterministic mode. The search starts from
+  // ! seeds[first, last) and only acquires nodes in its search region (searchRegion[u] == region).
+  // ! The moves are only performed on the delta partition and the best prefix is stored in moves,
+  // ! i.e., the result only depends on the current global partition and the search region.
+  template<typename DispatchedFMStrategy>
+  void findMovesInRegion(DispatchedFMStrategy& fm_strategy, PartitionedHypergraph& phg,
+                         const vec<HypernodeID>& seeds, size_t first, size_t last,
+                         const vec<SearchID>& searchRegion, SearchID region, vec<Move>& moves);
+
   void memoryConsumption(utils::MemoryTreeNode* parent) const;
 
   void changeNumberOfBlocks(const PartitionID new_k);
 
 private:
-  template<typename DispatchedFMStrategy>
+  template<bool deterministic, typename DispatchedFMStrategy>
   void internalFindMoves(PartitionedHypergraph& phg, DispatchedFMStrategy& fm_strategy);
 
-  template<bool has_fixed_vertices, typename PHG, typename CACHE, typename DispatchedFMStrategy>
+  template<bool has_fixed_vertices, bool deterministic, typename PHG, typename CACHE, typename DispatchedFMStrategy>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void acquireOrUpdateNeighbors(PHG& phg, CACHE& gain_cache, const Move& move, DispatchedFMStrategy& fm_strategy);
 
@@ -100,6 +110,10 @@ private:
   // ! Unique search id associated with the current local search
   SearchID thisSearch;
 
+  // ! Search region of each node and the region of the current search (only used in deterministic mode)
+  const vec<SearchID>* searchRegion = nullptr;
+  SearchID thisRegion = 0;
+
   // ! Local data members required for one localized search run
   //FMLocalData localData;
   vec< std::pair<Move, MoveID> > localMoves;
@@ -129,6 +143,10 @@ private:
   // ! in that block) touched by the current local search associated
   // ! with their gain values
   vec<VertexPriorityQueue> vertexPQs;
+
+  // ! Blocks whose vertex PQ was modified since the block PQ was last updated.
+  // ! Keeps block PQ updates and resets proportional to the blocks seen by a search.
+  TouchedBlocks touchedBlocks;
 };
 
 }
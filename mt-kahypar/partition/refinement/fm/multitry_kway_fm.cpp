@@ -30,10 +30,13 @@
 #include "mt-kahypar/partition/refinement/fm/multitry_kway_fm.h"
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/chunking.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/partition/factories.h"   // TODO removing this could make compilation a lot faster
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
+#include "mt-kahypar/partition/refinement/fm/strategies/local_gain_cache_strategy.h"
 #include "mt-kahypar/utils/memory_tree.h"
 #include "mt-kahypar/utils/cast.h"
 
@@ -54,8 +57,17 @@ namespace mt_kahypar {
     fm_strategy(FMStrategyFactory::getInstance().createObject(context.refinement.fm.algorithm, context, sharedData)),
     globalRollback(num_hyperedges, context, gainCache),
     ets_fm([&] { return constructLocalizedKWayFMSearch(); }),
-    tmp_move_order(num_hypernodes),
-    rebalancer(rb) {
+    tmp_move_order(),
+    rebalancer(rb),
+    prng(c.partition.seed),
+    permutation(),
+    deterministic_seeds(),
+    search_region(c.partition.deterministic ? num_hypernodes : 0, kInvalidRegion),
+    proposed_search_region(c.partition.deterministic ? num_hypernodes : 0, CAtomic<SearchID>(kInvalidRegion)),
+    region_nodes(),
+    new_region_nodes(),
+    search_moves() {
+    tmp_move_order.resizeNoAssign(num_hypernodes);
     if (context.refinement.fm.obey_minimal_parallelism) {
       sharedData.finishedTasksLimit = std::min(UL(8), context.shared_memory.num_threads);
     }
@@ -88,11 +100,15 @@ namespace mt_kahypar {
                                                   const double time_limit) {
     PartitionedHypergraph& phg = utils::cast<PartitionedHypergraph>(hypergraph);
     resizeDataStructuresForCurrentK();
+    // the hypergraph might have changed since the last call (e.g., due to uncontractions)
+    sharedData.unconstrained.invalidateIncidentWeights();
+    sharedData.stopStatistics.reset();
 
     Gain overall_improvement = 0;
     size_t consecutive_rounds_with_too_little_improvement = 0;
     enable_light_fm = false;
     sharedData.release_nodes = context.refinement.fm.release_nodes;
+    sharedData.gain_ordered_seeds = context.refinement.fm.gain_ordered_seeds;
     double current_time_limit = time_limit;
     tbb::task_group tg;
     vec<HypernodeWeight> initialPartWeights(size_t(context.partition.k));
@@ -101,11 +117,15 @@ namespace mt_kahypar {
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
 
     for (size_t round = 0; round < context.refinement.fm.multitry_rounds; ++round) { // global multi try rounds
+      if ( context.isTimeLimitExceeded() ) {
+        break;
+      }
+
       for (PartitionID i = 0; i < context.partition.k; ++i) {
         initialPartWeights[i] = phg.partWeight(i);
       }
 
-      const bool is_unconstrained = fm_strategy->isUnconstrainedRound(round);
+      const bool is_unconstrained = !context.partition.deterministic && fm_strategy->isUnconstrainedRound(round);
       if (is_unconstrained) {
         timer.start_timer("initialize_data_unconstrained", "Initialize Data for Unc. FM");
         sharedData.unconstrained.initialize<GraphAndGainTypes>(context, phg, gain_cache);
@@ -113,15 +133,21 @@ namespace mt_kahypar {
       }
 
       timer.start_timer("collect_border_nodes", "Collect Border Nodes");
-      roundInitialization(phg, refinement_nodes);
+      if (context.partition.deterministic) {
+        deterministicRoundInitialization(phg, refinement_nodes);
+      } else {
+        roundInitialization(phg, refinement_nodes);
+      }
       timer.stop_timer("collect_border_nodes");
 
-      size_t num_border_nodes = sharedData.refinementNodes.unsafe_size();
+      size_t num_border_nodes = context.partition.deterministic ?
+        deterministic_seeds.size() : sharedData.numRefinementNodes();
       if (num_border_nodes == 0) {
         break;
       }
       size_t num_seeds = context.refinement.fm.num_seed_nodes;
       if (context.type == ContextType::main
+          && !context.partition.deterministic
           && !refinement_nodes.empty()  /* n-level */
           && num_border_nodes < 20 * context.shared_memory.num_threads) {
         num_seeds = num_border_nodes / (4 * context.shared_memory.num_threads);
@@ -130,10 +156,17 @@ namespace mt_kahypar {
       }
 
       timer.start_timer("find_moves", "Find Moves");
-      size_t num_tasks = std::min(num_border_nodes, size_t(TBBInitializer::instance().total_number_of_threads()));
-      sharedData.finishedTasks.store(0, std::memory_order_relaxed);
-      fm_strategy->findMoves(utils::localized_fm_cast(ets_fm), hypergraph,
-                             num_tasks, num_seeds, round);
+      if (context.partition.deterministic) {
+        findMovesDeterministically(phg, num_seeds);
+      } else {
+        size_t num_tasks = std::min(num_border_nodes, sharedData.numberOfThreads);
+        sharedData.finishedTasks.store(0, std::memory_order_relaxed);
+        // the stop rule only uses the statistics of previous rounds
+        sharedData.maxMovesWithoutImprovement = sharedData.stopStatistics.maxMovesWithoutImprovement(
+          context.refinement.fm.adaptive_stop_rule_factor);
+        fm_strategy->findMoves(utils::localized_fm_cast(ets_fm), hypergraph,
+                               num_tasks, num_seeds, round);
+      }
       timer.stop_timer("find_moves");
 
       if (is_unconstrained && !isBalanced(phg, max_part_weights)) {
@@ -184,11 +217,17 @@ namespace mt_kahypar {
         LOG << V(round) << V(improvement) << V(metrics::quality(phg, context))
             << V(metrics::imbalance(phg, context)) << V(num_border_nodes) << V(roundImprovementFraction)
             << V(elapsed_time) << V(current_time_limit);
+        if ( !sharedData.gain_ordered_seeds ) {
+          const StealStats steal_stats = sharedData.refinementNodes.steal_stats();
+          LOG << V(steal_stats.num_steals) << V(steal_stats.num_stolen_elements)
+              << V(steal_stats.num_failed_steals);
+        }
       }
 
       // Enforce a time limit (based on k and coarsening time).
       // Switch to more "light-weight" FM after reaching it the first time. Abort after second time.
-      if ( elapsed_time > current_time_limit ) {
+      // Note that this is skipped in deterministic mode, since the running time is not reproducible.
+      if ( !context.partition.deterministic && elapsed_time > current_time_limit ) {
         if ( !enable_light_fm ) {
           DBG << RED << "Multitry FM reached time limit => switch to Light FM Configuration" << END;
           sharedData.release_nodes = false;
@@ -212,6 +251,15 @@ namespace mt_kahypar {
       printMemoryConsumption();
     }
 
+    if (context.type == ContextType::main && !context.partition.deterministic) {
+      // moves that are discarded at the end of a localized search (wasted work)
+      const FMStopStatistics& stop_stats = sharedData.stopStatistics;
+      utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+      stats.update_stat("fm_moves", static_cast<int64_t>(stop_stats.numMoves()));
+      stats.update_stat("fm_wasted_moves", static_cast<int64_t>(stop_stats.numWastedMoves()));
+      DBG << "Wasted moves:" << stop_stats.numWastedMoves() << "of" << stop_stats.numMoves();
+    }
+
     metrics.quality -= overall_improvement;
     metrics.imbalance = metrics::imbalance(phg, context);
     HEAVY_REFINEMENT_ASSERT(phg.checkTrackedPartitionInformation(gain_cache));
@@ -226,35 +274,44 @@ namespace mt_kahypar {
                                                                   const vec<HypernodeID>& refinement_nodes) {
     // clear border nodes
     sharedData.refinementNodes.clear();
+    sharedData.prioritizedRefinementNodes.clear();
+    auto push_seed = [&](const HypernodeID u, const int task_id) {
+      if ( sharedData.gain_ordered_seeds ) {
+        sharedData.prioritizedRefinementNodes.safe_push(u, bestSeedGain(phg, u), task_id);
+      } else {
+        sharedData.refinementNodes.safe_push(u, task_id);
+      }
+    };
 
     if ( refinement_nodes.empty() ) {
       // log(n) level case
-      // iterate over all nodes and insert border nodes into task queue
-      tbb::parallel_for(tbb::blocked_range<HypernodeID>(0, phg.initialNumNodes()),
-        [&](const tbb::blocked_range<HypernodeID>& r) {
-          const int task_id = tbb::this_task_arena::current_thread_index();
-          // In really rare cases, the tbb::this_task_arena::current_thread_index()
-          // function a thread id greater than max_concurrency which causes an
-          // segmentation fault if we do not perform the check here. This is caused by
-          // our working queue for border nodes with which we initialize the localized
-          // FM searches. For now, we do not know why this occurs but this prevents
-          // the segmentation fault.
-          if ( task_id >= 0 && task_id < TBBInitializer::instance().total_number_of_threads() ) {
-            for (HypernodeID u = r.begin(); u < r.end(); ++u) {
-              if (phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u)) {
-                sharedData.refinementNodes.safe_push(u, task_id);
-              }
-            }
+      // iterate over the incrementally maintained border nodes and insert them into task queue.
+      // The border nodes are computed once per level and then updated on each move.
+      if ( !phg.isTrackingBorderNodes() ) {
+        phg.initializeBorderNodes();
+      }
+      phg.doParallelForAllBorderNodes([&](const HypernodeID u) {
+        const int task_id = tbb::this_task_arena::current_thread_index();
+        // In really rare cases, the tbb::this_task_arena::current_thread_index()
+        // function a thread id greater than max_concurrency which causes an
+        // segmentation fault if we do not perform the check here. This is caused by
+        // our working queue for border nodes with which we initialize the localized
+        // FM searches. For now, we do not know why this occurs but this prevents
+        // the segmentation fault.
+        if ( task_id >= 0 && static_cast<size_t>(task_id) < sharedData.numberOfThreads ) {
+          if (phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u)) {
+            push_seed(u, task_id);
           }
-        });
+        }
+      });
     } else {
       // n-level case
       tbb::parallel_for(UL(0), refinement_nodes.size(), [&](const size_t i) {
         const HypernodeID u = refinement_nodes[i];
         const int task_id = tbb::this_task_arena::current_thread_index();
-        if ( task_id >= 0 && task_id < TBBInitializer::instance().total_number_of_threads() ) {
+        if ( task_id >= 0 && static_cast<size_t>(task_id) < sharedData.numberOfThreads ) {
           if (phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u)) {
-            sharedData.refinementNodes.safe_push(u, task_id);
+            push_seed(u, task_id);
           }
         }
       });
@@ -262,12 +319,186 @@ namespace mt_kahypar {
 
     // shuffle task queue if requested
     if (context.refinement.fm.shuffle) {
-      sharedData.refinementNodes.shuffle();
+      if ( sharedData.gain_ordered_seeds ) {
+        // only randomizes the order of seed nodes with equal gain
+        sharedData.prioritizedRefinementNodes.shuffle();
+      } else {
+        sharedData.refinementNodes.shuffle();
+      }
+    }
+    if ( sharedData.gain_ordered_seeds ) {
+      sharedData.prioritizedRefinementNodes.build();
     }
 
     // requesting new searches activates all nodes by raising the deactivated node marker
     // also clears the array tracking search IDs in case of overflow
-    sharedData.nodeTracker.requestNewSearches(static_cast<SearchID>(sharedData.refinementNodes.unsafe_size()));
+    sharedData.nodeTracker.requestNewSearches(static_cast<SearchID>(sharedData.numRefinementNodes()));
+  }
+
+  template<typename GraphAndGainTypes>
+  void MultiTryKWayFM<GraphAndGainTypes>::deterministicRoundInitialization(const PartitionedHypergraph& phg,
+                                                                          const vec<HypernodeID>& refinement_nodes) {
+    const bool use_refinement_nodes = !refinement_nodes.empty();
+    const bool shuffle = context.refinement.fm.shuffle && !use_refinement_nodes;
+    const size_t num_candidates = use_refinement_nodes ? refinement_nodes.size() : phg.initialNumNodes();
+    if ( shuffle ) {
+      permutation.random_grouping(phg.initialNumNodes(), context.shared_memory.static_balancing_work_packages, prng());
+    }
+    auto candidate = [&](const size_t i) -> HypernodeID {
+      return use_refinement_nodes ? refinement_nodes[i] : (shuffle ? permutation.at(i) : static_cast<HypernodeID>(i));
+    };
+    auto is_seed = [&](const HypernodeID u) {
+      return phg.nodeIsEnabled(u) && phg.isBorderNode(u) && !phg.isFixed(u);
+    };
+
+    // Seed nodes keep the order of the candidates, which is determined via a prefix sum
+    vec<HypernodeID> seed_position(num_candidates + 1, 0);
+    tbb::parallel_for(UL(0), num_candidates, [&](const size_t i) {
+      seed_position[i + 1] = is_seed(candidate(i)) ? 1 : 0;
+    });
+    parallel_prefix_sum(seed_position.begin(), seed_position.end(), seed_position.begin(),
+                        std::plus<HypernodeID>(), 0);
+    deterministic_seeds.resize(seed_position.back());
+    tbb::parallel_for(UL(0), num_candidates, [&](const size_t i) {
+      if ( seed_position[i] != seed_position[i + 1] ) {
+        deterministic_seeds[seed_position[i]] = candidate(i);
+      }
+    });
+
+    sharedData.nodeTracker.requestNewSearches(static_cast<SearchID>(deterministic_seeds.size()));
+  }
+
+  template<typename GraphAndGainTypes>
+  void MultiTryKWayFM<GraphAndGainTypes>::findMovesDeterministically(PartitionedHypergraph& phg, size_t num_seeds) {
+    num_seeds = std::max(num_seeds, UL(1));
+    const size_t num_sub_rounds = std::max(context.refinement.deterministic_refinement.num_sub_rounds_fm, UL(1));
+    const size_t seeds_per_sub_round = parallel::chunking::idiv_ceil(deterministic_seeds.size(), num_sub_rounds);
+    for ( size_t sub_round = 0; sub_round < num_sub_rounds; ++sub_round ) {
+      size_t first = 0;
+      size_t last = 0;
+      std::tie(first, last) = parallel::chunking::bounds(sub_round, deterministic_seeds.size(), seeds_per_sub_round);
+      if ( first == last ) {
+        break;
+      }
+
+      growSearchRegions(phg, first, last, num_seeds);
+      const size_t num_searches = parallel::chunking::idiv_ceil(last - first, num_seeds);
+      if ( search_moves.size() < num_searches ) {
+        search_moves.resize(num_searches);
+      }
+      tbb::parallel_for(UL(0), num_searches, [&](const size_t search) {
+        size_t first_seed = 0;
+        size_t last_seed = 0;
+        std::tie(first_seed, last_seed) = parallel::chunking::bounds(search, last - first, num_seeds);
+        LocalizedFMSearch& fm = ets_fm.local();
+        LocalGainCacheStrategy local_strategy = fm.template initializeDispatchedStrategy<LocalGainCacheStrategy>();
+        fm.findMovesInRegion(local_strategy, phg, deterministic_seeds, first + first_seed, first + last_seed,
+                             search_region, static_cast<SearchID>(search), search_moves[search]);
+      });
+      applyMovesOfSearches(phg, num_searches);
+    }
+  }
+
+  template<typename GraphAndGainTypes>
+  void MultiTryKWayFM<GraphAndGainTypes>::growSearchRegions(const PartitionedHypergraph& phg,
+                                                            const size_t first_seed,
+                                                            const size_t last_seed,
+                                                            const size_t num_seeds) {
+    // reset search regions of the previous sub-round
+    tbb::parallel_for(UL(0), region_nodes.size(), [&](const size_t i) {
+      const HypernodeID u = region_nodes[i];
+      search_region[u] = kInvalidRegion;
+      proposed_search_region[u].store(kInvalidRegion, std::memory_order_relaxed);
+    });
+    region_nodes.clear();
+
+    NodeTracker& node_tracker = sharedData.nodeTracker;
+    for ( size_t i = first_seed; i < last_seed; ++i ) {
+      const HypernodeID u = deterministic_seeds[i];
+      if ( node_tracker.canNodeStartNewSearch(u) ) {
+        const SearchID region = static_cast<SearchID>((i - first_seed) / num_seeds);
+        search_region[u] = region;
+        proposed_search_region[u].store(region, std::memory_order_relaxed);
+        region_nodes.push_back(u);
+      }
+    }
+
+    // Grow the regions in synchronous BFS steps. A node is assigned to the smallest region
+    // proposed in a step, which makes the result independent of the scheduling of the threads.
+    size_t frontier_begin = 0;
+    for ( size_t step = 0; step < SEARCH_REGION_RADIUS; ++step ) {
+      const size_t frontier_end = region_nodes.size();
+      if ( frontier_begin == frontier_end ) {
+        break;
+      }
+
+      new_region_nodes.clear_sequential();
+      tbb::parallel_for(frontier_begin, frontier_end, [&](const size_t i) {
+        const HypernodeID u = region_nodes[i];
+        const SearchID region = search_region[u];
+        auto propose = [&](const HypernodeID v) {
+          if ( search_region[v] == kInvalidRegion && !phg.isFixed(v) && node_tracker.canNodeStartNewSearch(v) ) {
+            SearchID current = proposed_search_region[v].load(std::memory_order_relaxed);
+            while ( region < current ) {
+              if ( proposed_search_region[v].compare_exchange_weak(current, region, std::memory_order_relaxed) ) {
+                if ( current == kInvalidRegion ) {
+                  new_region_nodes.stream(v);
+                }
+                break;
+              }
+            }
+          }
+        };
+
+        for ( const HyperedgeID& he : phg.incidentEdges(u) ) {
+          if constexpr ( PartitionedHypergraph::is_graph ) {
+            propose(phg.edgeTarget(he));
+          } else if ( phg.edgeSize(he) < context.partition.ignore_hyperedge_size_threshold ) {
+            for ( const HypernodeID& v : phg.pins(he) ) {
+              propose(v);
+            }
+          }
+        }
+      });
+
+      const vec<HypernodeID> new_nodes = new_region_nodes.copy_parallel();
+      region_nodes.insert(region_nodes.end(), new_nodes.begin(), new_nodes.end());
+      tbb::parallel_for(frontier_end, region_nodes.size(), [&](const size_t i) {
+        const HypernodeID v = region_nodes[i];
+        search_region[v] = proposed_search_region[v].load(std::memory_order_relaxed);
+      });
+      frontier_begin = frontier_end;
+    }
+  }
+
+  template<typename GraphAndGainTypes>
+  void MultiTryKWayFM<GraphAndGainTypes>::applyMovesOfSearches(PartitionedHypergraph& phg, const size_t num_searches) {
+    vec<MoveID> move_offset(num_searches + 1, 0);
+    for ( size_t search = 0; search < num_searches; ++search ) {
+      move_offset[search + 1] = move_offset[search] + search_moves[search].size();
+    }
+
+    // The searches moved disjoint sets of nodes, which allows to apply their moves in parallel.
+    // The IDs of the moves follow the order of the searches to obtain a deterministic move sequence.
+    GlobalMoveTracker& move_tracker = sharedData.moveTracker;
+    const MoveID first_move_id = move_tracker.runningMoveID.load(std::memory_order_relaxed);
+    tbb::parallel_for(UL(0), num_searches, [&](const size_t search) {
+      const vec<Move>& moves = search_moves[search];
+      for ( size_t i = 0; i < moves.size(); ++i ) {
+        const Move& m = moves[i];
+        const MoveID move_id = first_move_id + move_offset[search] + i;
+        phg.changeNodePart(gain_cache, m.node, m.from, m.to);
+        move_tracker.moveOrder[move_id - move_tracker.firstMoveID] = m;
+        move_tracker.moveOfNode[m.node] = move_id;
+      }
+    });
+    move_tracker.runningMoveID.store(first_move_id + move_offset[num_searches], std::memory_order_relaxed);
+
+    if constexpr ( GainCache::invalidates_entries ) {
+      tbb::parallel_for(first_move_id, first_move_id + move_offset[num_searches], [&](const MoveID move_id) {
+        gain_cache.recomputeInvalidTerms(phg, move_tracker.getMove(move_id).node);
+      });
+    }
   }
 
   template<typename GraphAndGainTypes>
@@ -335,7 +566,7 @@ namespace mt_kahypar {
       insert_moves_to_balance_part(part);
     }
 
-    const vec<Move>& move_order = move_tracker.moveOrder;
+    const ds::Array<Move>& move_order = move_tracker.moveOrder;
     const MoveID num_moves = move_tracker.numPerformedMoves();
     for (MoveID move_id = 0; move_id < num_moves; ++move_id) {
       const Move& m = move_order[move_id];
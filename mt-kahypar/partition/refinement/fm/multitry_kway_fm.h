@@ -27,8 +27,11 @@
 
 #pragma once
 
+#include <random>
+
 #include <tbb/enumerable_thread_specific.h>
 
+#include "mt-kahypar/datastructures/streaming_vector.h"
 #include "mt-kahypar/partition/context.h"
 
 #include "mt-kahypar/partition/refinement/i_refiner.h"
@@ -37,6 +40,7 @@
 #include "mt-kahypar/partition/refinement/fm/global_rollback.h"
 #include "mt-kahypar/partition/refinement/fm/strategies/i_fm_strategy.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
+#include "mt-kahypar/utils/reproducible_random.h"
 
 namespace mt_kahypar {
 
@@ -53,6 +57,11 @@ class MultiTryKWayFM final : public IRefiner {
 
   static_assert(GainCache::TYPE != GainPolicy::none);
 
+  // ! Deterministic mode: marks nodes that are not contained in a search region
+  static constexpr SearchID kInvalidRegion = std::numeric_limits<SearchID>::max();
+  // ! Deterministic mode: maximum distance of a node in a search region to one of its seed nodes
+  static constexpr size_t SEARCH_REGION_RADIUS = 3;
+
  public:
 
   MultiTryKWayFM(const HypernodeID num_hypernodes,
@@ -82,6 +91,21 @@ class MultiTryKWayFM final : public IRefiner {
   void roundInitialization(PartitionedHypergraph& phg,
                            const vec<HypernodeID>& refinement_nodes);
 
+  // ! Deterministic mode: collects the seed nodes in an order that does not depend on the number of threads
+  void deterministicRoundInitialization(const PartitionedHypergraph& phg,
+                                        const vec<HypernodeID>& refinement_nodes);
+
+  // ! Deterministic mode: the seed nodes are processed in sub-rounds. In each sub-round, the localized
+  // ! searches run in parallel on disjoint search regions without modifying the global partition.
+  // ! Afterwards, the best move sequence of each search is applied in the order of the searches.
+  void findMovesDeterministically(PartitionedHypergraph& phg, size_t num_seeds);
+
+  // ! Deterministic mode: assigns each node close to the seed nodes of a search to the search region of
+  // ! the nearest seed node (ties are broken in favor of the search with smaller ID)
+  void growSearchRegions(const PartitionedHypergraph& phg, size_t first_seed, size_t last_seed, size_t num_seeds);
+
+  void applyMovesOfSearches(PartitionedHypergraph& phg, size_t num_searches);
+
   void interleaveMoveSequenceWithRebalancingMoves(const PartitionedHypergraph& phg,
                                                   const vec<HypernodeWeight>& initialPartWeights,
                                                   const std::vector<HypernodeWeight>& max_part_weights,
@@ -104,6 +128,19 @@ class MultiTryKWayFM final : public IRefiner {
     return true;
   }
 
+  // ! Gain of the best move of a seed node (ignoring the balance constraint)
+  Gain bestSeedGain(const PartitionedHypergraph& phg, const HypernodeID u) const {
+    const PartitionID from = phg.partID(u);
+    HyperedgeWeight best_benefit = std::numeric_limits<HyperedgeWeight>::min();
+    for ( const PartitionID& to : gain_cache.adjacentBlocks(u) ) {
+      if ( to != from ) {
+        best_benefit = std::max(best_benefit, gain_cache.benefitTerm(u, to));
+      }
+    }
+    return best_benefit != std::numeric_limits<HyperedgeWeight>::min() ?
+      best_benefit - gain_cache.penaltyTerm(u, from) : std::numeric_limits<Gain>::min() + 1;
+  }
+
   LocalizedFMSearch constructLocalizedKWayFMSearch() {
     return LocalizedFMSearch(context, initial_num_nodes, sharedData, gain_cache);
   }
@@ -126,8 +163,18 @@ class MultiTryKWayFM final : public IRefiner {
   std::unique_ptr<IFMStrategy> fm_strategy;
   Rollback globalRollback;
   tbb::enumerable_thread_specific<LocalizedFMSearch> ets_fm;
-  vec<Move> tmp_move_order;
+  ds::Array<Move> tmp_move_order;
   IRebalancer& rebalancer;
+
+  // ! Data structures for deterministic mode
+  std::mt19937 prng;
+  utils::ParallelPermutation<HypernodeID> permutation;
+  vec<HypernodeID> deterministic_seeds;
+  vec<SearchID> search_region;
+  vec<CAtomic<SearchID>> proposed_search_region;
+  vec<HypernodeID> region_nodes;
+  ds::StreamingVector<HypernodeID> new_region_nodes;
+  vec<vec<Move>> search_moves;
 };
 
 } // namespace mt_kahypar
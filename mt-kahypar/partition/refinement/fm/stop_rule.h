@@ -27,17 +27,24 @@
 
 #pragma once
 
+#include <limits>
+
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 
 namespace mt_kahypar {
 
 // adaptive random walk stopping rule from KaHyPar
+// (additionally stops after maxSteps steps without improvement, see FMStopStatistics)
 class StopRule {
 public:
-  StopRule(HypernodeID numNodes) : beta(std::log(numNodes)) { }
+  StopRule(HypernodeID numNodes,
+           size_t maxSteps = std::numeric_limits<size_t>::max()) :
+    beta(std::log(numNodes)),
+    maxSteps(maxSteps) { }
 
   bool searchShouldStop() {
-    return (numSteps > beta) && (Mk == 0 || numSteps >= ( variance / (Mk*Mk) ) * stopFactor );
+    return numSteps >= maxSteps ||
+      ((numSteps > beta) && (Mk == 0 || numSteps >= ( variance / (Mk*Mk) ) * stopFactor ));
   }
 
   void update(Gain gain) {
@@ -68,5 +75,6 @@ private:
   const double alpha = 1.0;   // make parameter if it doesn't work well
   const double stopFactor = (alpha / 2.0) - 0.25;
   double beta;
+  size_t maxSteps;
 };
 }
\ No newline at end of file
@@ -40,7 +40,7 @@ namespace mt_kahypar {
    * static constexpr bool maintain_gain_cache_between_rounds
    * static constexpr bool is_unconstrained
    *
-   * Constructor(context, sharedData, blockPQ, vertexPQs, runStats)
+   * Constructor(context, sharedData, blockPQ, vertexPQs, touchedBlocks)
    * insertIntoPQ(phg, gain_cache, node)
    * updateGain(phg, gain_cache, node, move)
    * findNextMove(phg, gain_cache, move)
@@ -63,11 +63,13 @@ public:
   LocalGainCacheStrategy(const Context& context,
                          FMSharedData& sharedData,
                          BlockPriorityQueue& blockPQ,
-                         vec<VertexPriorityQueue>& vertexPQs) :
+                         vec<VertexPriorityQueue>& vertexPQs,
+                         TouchedBlocks& touchedBlocks) :
       context(context),
       sharedData(sharedData),
       blockPQ(blockPQ),
-      vertexPQs(vertexPQs) { }
+      vertexPQs(vertexPQs),
+      touchedBlocks(touchedBlocks) { }
 
   template<typename PartitionedHypergraph, typename GainCache>
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
@@ -80,6 +82,7 @@ public:
     ASSERT(target < context.partition.k, V(target) << V(context.partition.k));
     sharedData.targetPart[v] = target;
     vertexPQs[pv].insert(v, gain);  // blockPQ updates are done later, collectively.
+    touchedBlocks.add(pv);
   }
 
   template<typename PartitionedHypergraph, typename GainCache>
@@ -111,6 +114,7 @@ public:
 
     sharedData.targetPart[v] = newTarget;
     vertexPQs[pv].adjustKey(v, gain);
+    touchedBlocks.add(pv);
   }
 
   template<typename PartitionedHypergraph, typename GainCache>
@@ -135,6 +139,7 @@ public:
         m.node = u; m.to = to; m.from = from;
         m.gain = gain;
         vertexPQs[from].deleteTop();  // blockPQ updates are done later, collectively.
+        touchedBlocks.add(from);
         return true;
       } else {
         vertexPQs[from].adjustKey(u, gain);
@@ -158,19 +163,18 @@ public:
   }
 
   void reset() {
-    // release all nodes that were not moved
-    if (sharedData.release_nodes) {
-      // Release all nodes contained in PQ
-      for (PartitionID i = 0; i < context.partition.k; ++i) {
-        for (PosT j = 0; j < vertexPQs[i].size(); ++j) {
-          const HypernodeID v = vertexPQs[i].at(j);
+    // only blocks contained in the block PQ can have a non-empty vertex PQ
+    updatePQs();
+    for (PosT i = 0; i < blockPQ.size(); ++i) {
+      const PartitionID block = blockPQ.at(i);
+      if (sharedData.release_nodes) {
+        // release all nodes that were not moved
+        for (PosT j = 0; j < vertexPQs[block].size(); ++j) {
+          const HypernodeID v = vertexPQs[block].at(j);
           sharedData.nodeTracker.releaseNode(v);
         }
       }
-    }
-
-    for (PartitionID i = 0; i < context.partition.k; ++i) {
-      vertexPQs[i].clear();
+      vertexPQs[block].clear();
     }
     blockPQ.clear();
   }
@@ -189,13 +193,14 @@ public:
 private:
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void updatePQs() {
-    for (PartitionID i = 0; i < context.partition.k; ++i) {
+    for (const PartitionID i : touchedBlocks.blocks) {
       if (!vertexPQs[i].empty()) {
         blockPQ.insertOrAdjustKey(i, vertexPQs[i].topKey());
       } else if (blockPQ.contains(i)) {
         blockPQ.remove(i);
       }
     }
+    touchedBlocks.clear();
   }
 
   template<typename PartitionedHypergraph, typename GainCache>
@@ -269,6 +274,9 @@ protected:
   // ! in that block) touched by the current local search associated
   // ! with their gain values
   vec<VertexPriorityQueue>& vertexPQs;
+
+  // ! Blocks whose vertex PQ changed since the last update of the block PQ
+  TouchedBlocks& touchedBlocks;
 };
 
 }
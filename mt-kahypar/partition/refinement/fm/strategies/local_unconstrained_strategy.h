@@ -40,7 +40,7 @@ namespace mt_kahypar {
    * static constexpr bool maintain_gain_cache_between_rounds
    * static constexpr bool is_unconstrained
    *
-   * Constructor(context, sharedData, blockPQ, vertexPQs, runStats)
+   * Constructor(context, sharedData, blockPQ, vertexPQs, touchedBlocks)
    * insertIntoPQ(phg, gain_cache, node)
    * updateGain(phg, gain_cache, node, move)
    * findNextMove(phg, gain_cache, move)
@@ -64,11 +64,13 @@ class LocalUnconstrainedStrategy {
   LocalUnconstrainedStrategy(const Context& context,
                              FMSharedData& sharedData,
                              BlockPriorityQueue& blockPQ,
-                             vec<VertexPriorityQueue>& vertexPQs) :
+                             vec<VertexPriorityQueue>& vertexPQs,
+                             TouchedBlocks& touchedBlocks) :
       context(context),
       sharedData(sharedData),
       blockPQ(blockPQ),
       vertexPQs(vertexPQs),
+      touchedBlocks(touchedBlocks),
       localVirtualWeightDelta(context.partition.k),
       penaltyFactor(context.refinement.fm.imbalance_penalty_max),
       upperBound(context.refinement.fm.unconstrained_upper_bound) { }
@@ -84,6 +86,7 @@ class LocalUnconstrainedStrategy {
     ASSERT(target < context.partition.k);
     sharedData.targetPart[v] = target;
     vertexPQs[pv].insert(v, gain);  // blockPQ updates are done later, collectively.
+    touchedBlocks.add(pv);
   }
 
   template<typename PartitionedHypergraph, typename GainCache>
@@ -111,6 +114,7 @@ class LocalUnconstrainedStrategy {
 
     sharedData.targetPart[v] = newTarget;
     vertexPQs[pv].adjustKey(v, gain);
+    touchedBlocks.add(pv);
   }
 
   template<typename PartitionedHypergraph, typename GainCache>
@@ -152,6 +156,7 @@ class LocalUnconstrainedStrategy {
         m.node = u; m.to = to; m.from = from;
         m.gain = gain;
         vertexPQs[from].deleteTop();  // blockPQ updates are done later, collectively.
+        touchedBlocks.add(from);
         return true;
       } else {
         vertexPQs[from].adjustKey(u, gain);
@@ -185,19 +190,18 @@ class LocalUnconstrainedStrategy {
   }
 
   void reset() {
-    // release all nodes that were not moved
-    if (sharedData.release_nodes) {
-      // Release all nodes contained in PQ
-      for (PartitionID i = 0; i < context.partition.k; ++i) {
-        for (PosT j = 0; j < vertexPQs[i].size(); ++j) {
-          const HypernodeID v = vertexPQs[i].at(j);
+    // only blocks contained in the block PQ can have a non-empty vertex PQ
+    updatePQs();
+    for (PosT i = 0; i < blockPQ.size(); ++i) {
+      const PartitionID block = blockPQ.at(i);
+      if (sharedData.release_nodes) {
+        // release all nodes that were not moved
+        for (PosT j = 0; j < vertexPQs[block].size(); ++j) {
+          const HypernodeID v = vertexPQs[block].at(j);
           sharedData.nodeTracker.releaseNode(v);
         }
       }
-    }
-
-    for (PartitionID i = 0; i < context.partition.k; ++i) {
-      vertexPQs[i].clear();
+      vertexPQs[block].clear();
     }
     blockPQ.clear();
     localVirtualWeightDelta.clear();
@@ -226,13 +230,14 @@ class LocalUnconstrainedStrategy {
 private:
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void updatePQs() {
-    for (PartitionID i = 0; i < context.partition.k; ++i) {
+    for (const PartitionID i : touchedBlocks.blocks) {
       if (!vertexPQs[i].empty()) {
         blockPQ.insertOrAdjustKey(i, vertexPQs[i].topKey());
       } else if (blockPQ.contains(i)) {
         blockPQ.remove(i);
       }
     }
+    touchedBlocks.clear();
   }
 
   template<typename PartitionedHypergraph, typename GainCache>
@@ -343,6 +348,9 @@ private:
   // ! with their gain values
   vec<VertexPriorityQueue>& vertexPQs;
 
+  // ! Blocks whose vertex PQ changed since the last update of the block PQ
+  TouchedBlocks& touchedBlocks;
+
   // ! Virtual block weights are saved as delta to the actual block weight. They
   // ! are necessary to ensure a reasonable penalty estimation in some edge cases.
   VirtualWeightMap localVirtualWeightDelta;
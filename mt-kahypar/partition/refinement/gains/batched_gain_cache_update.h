@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/thread_safe_fast_reset_flag_array.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Synchronous refiners (e.g., deterministic Jet) apply all moves of a round at once.
+ * Instead of updating the gain cache for each move via delta gain updates (which
+ * contend on the gain cache entries of high-degree nodes), a gain cache with
+ * supports_batched_updates = true allows to apply the moves without gain cache and
+ * to recompute the entries of all affected nodes afterwards in parallel.
+ *
+ * A node is affected by the batch if it is moved or if it shares a (hyper)edge with a
+ * moved node. The predicate is_moved(u) must return true for each node moved in the batch.
+ * For hypergraphs, edge_flags must contain one flag per hyperedge and is reset afterwards.
+ */
+template<typename PartitionedHypergraph, typename GainCache, typename IsMovedFunc>
+void recomputeGainCacheEntriesAfterBatch(const PartitionedHypergraph& partitioned_hg,
+                                         GainCache& gain_cache,
+                                         const IsMovedFunc& is_moved,
+                                         ds::ThreadSafeFastResetFlagArray<>& edge_flags) {
+  static_assert(GainCache::supports_batched_updates);
+  ASSERT(gain_cache.isInitialized());
+  if constexpr ( PartitionedHypergraph::is_graph ) {
+    unused(edge_flags);
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID u) {
+      bool is_affected = is_moved(u);
+      for ( const HyperedgeID& e : partitioned_hg.incidentEdges(u) ) {
+        if ( is_affected ) break;
+        is_affected = is_moved(partitioned_hg.edgeTarget(e));
+      }
+      if ( is_affected ) {
+        gain_cache.recomputeGainCacheEntry(partitioned_hg, u);
+      }
+    });
+  } else {
+    ASSERT(edge_flags.size() >= partitioned_hg.initialNumEdges());
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID u) {
+      if ( is_moved(u) ) {
+        for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u) ) {
+          edge_flags.set(he, true);
+        }
+      }
+    });
+    partitioned_hg.doParallelForAllNodes([&](const HypernodeID u) {
+      bool is_affected = false;
+      for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u) ) {
+        if ( edge_flags[he] ) {
+          is_affected = true;
+          break;
+        }
+      }
+      if ( is_affected ) {
+        gain_cache.recomputeGainCacheEntry(partitioned_hg, u);
+      }
+    });
+    edge_flags.reset();
+  }
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "mt-kahypar/partition/refinement/gains/benefit_aggregation.h"
+
+#include <algorithm>
+
+namespace mt_kahypar {
+namespace benefit_aggregation {
+
+namespace {
+
+/*!
+ * Aggregates the weights into a local array with a compile-time number of lanes,
+ * which allows the compiler to fully unroll and vectorize the loop over the blocks.
+ * Blocks b >= k are never contained in a connectivity set and remain zero.
+ */
+template<PartitionID NUM_LANES>
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void aggregate(const uint64_t* __restrict__ connectivity_sets,
+                                                  const HyperedgeWeight* __restrict__ weights,
+                                                  const size_t num_hyperedges,
+                                                  const PartitionID k,
+                                                  Gain* __restrict__ benefits) {
+  alignas(64) Gain local_benefits[NUM_LANES] = { };
+  for ( size_t i = 0; i < num_hyperedges; ++i ) {
+    const uint64_t connectivity_set = connectivity_sets[i];
+    const Gain weight = weights[i];
+    // Processing the connectivity set in 32-bit chunks allows 32-bit lanes
+    for ( PartitionID chunk = 0; chunk < NUM_LANES; chunk += 32 ) {
+      const uint32_t bits = static_cast<uint32_t>(connectivity_set >> chunk);
+      for ( PartitionID b = 0; b < std::min(NUM_LANES, 32); ++b ) {
+        // Expands bit b to an all-ones or all-zeros mask
+        const Gain mask = -static_cast<Gain>((bits >> b) & 1U);
+        local_benefits[chunk + b] += mask & weight;
+      }
+    }
+  }
+  for ( PartitionID b = 0; b < k; ++b ) {
+    benefits[b] += local_benefits[b];
+  }
+}
+
+} // namespace
+
+MT_KAHYPAR_ATTRIBUTE_TARGET_CLONES
+void addWeightsToConnectedBlocks(const uint64_t* __restrict__ connectivity_sets,
+                                 const HyperedgeWeight* __restrict__ weights,
+                                 const size_t num_hyperedges,
+                                 const PartitionID k,
+                                 Gain* __restrict__ benefits) {
+  ASSERT(k <= MAX_NUM_BLOCKS);
+  if ( k <= 8 ) {
+    aggregate<8>(connectivity_sets, weights, num_hyperedges, k, benefits);
+  } else if ( k <= 16 ) {
+    aggregate<16>(connectivity_sets, weights, num_hyperedges, k, benefits);
+  } else if ( k <= 32 ) {
+    aggregate<32>(connectivity_sets, weights, num_hyperedges, k, benefits);
+  } else {
+    aggregate<64>(connectivity_sets, weights, num_hyperedges, k, benefits);
+  }
+}
+
+}  // namespace benefit_aggregation
+}  // namespace mt_kahypar
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+namespace mt_kahypar {
+namespace benefit_aggregation {
+
+// ! Maximum number of blocks for which the connectivity set of a hyperedge
+// ! fits into a single 64-bit bitset block
+static constexpr PartitionID MAX_NUM_BLOCKS = 64;
+
+// ! Up to this number of blocks, the branch-free aggregation is faster than iterating
+// ! over the connectivity sets, even if most hyperedges only connect two blocks
+static constexpr PartitionID MAX_NUM_BLOCKS_FOR_DENSE_AGGREGATION = 32;
+
+// ! Number of hyperedges that are buffered before their weights are aggregated
+static constexpr size_t BATCH_SIZE = 128;
+
+/*!
+ * For each hyperedge i in [0, num_hyperedges) and each block b < k contained in
+ * its connectivity set, adds weights[i] to benefits[b]. The connectivity sets
+ * are given as single 64-bit bitset blocks, which requires k <= MAX_NUM_BLOCKS.
+ * The loop over the blocks is branch-free and vectorized. The implementation
+ * is compiled for SSE4.2, AVX2 and AVX-512, and the best version supported by
+ * the CPU is selected at runtime.
+ */
+void addWeightsToConnectedBlocks(const uint64_t* connectivity_sets,
+                                 const HyperedgeWeight* weights,
+                                 const size_t num_hyperedges,
+                                 const PartitionID k,
+                                 Gain* benefits);
+
+/*!
+ * Buffers the connectivity sets and weights of the incident hyperedges of a node
+ * and aggregates them in batches via addWeightsToConnectedBlocks(...).
+ */
+class BenefitAggregationBuffer {
+
+ public:
+  BenefitAggregationBuffer(const PartitionID k, Gain* benefits) :
+    _k(k),
+    _benefits(benefits),
+    _size(0) {
+    ASSERT(k <= MAX_NUM_BLOCKS);
+  }
+
+  BenefitAggregationBuffer(const BenefitAggregationBuffer&) = delete;
+  BenefitAggregationBuffer & operator= (const BenefitAggregationBuffer &) = delete;
+
+  ~BenefitAggregationBuffer() {
+    flush();
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void add(const uint64_t connectivity_set,
+                                              const HyperedgeWeight weight) {
+    _connectivity_sets[_size] = connectivity_set;
+    _weights[_size] = weight;
+    if ( ++_size == BATCH_SIZE ) {
+      flush();
+    }
+  }
+
+  void flush() {
+    if ( _size > 0 ) {
+      addWeightsToConnectedBlocks(_connectivity_sets, _weights, _size, _k, _benefits);
+      _size = 0;
+    }
+  }
+
+ private:
+  const PartitionID _k;
+  Gain* _benefits;
+  size_t _size;
+  uint64_t _connectivity_sets[BATCH_SIZE];
+  HyperedgeWeight _weights[BATCH_SIZE];
+};
+
+}  // namespace benefit_aggregation
+}  // namespace mt_kahypar
@@ -44,6 +44,7 @@ struct BipartitioningPolicy {
       case GainPolicy::steiner_tree: return true;
       case GainPolicy::cut_for_graphs: return false;
       case GainPolicy::steiner_tree_for_graphs: return false;
+      case GainPolicy::km1_sparse: return true;
       case GainPolicy::none: throw InvalidParameterException("Gain policy is unknown");
     }
     throw InvalidParameterException("Gain policy is unknown");
@@ -58,6 +59,7 @@ struct BipartitioningPolicy {
       case GainPolicy::steiner_tree: return 1;
       case GainPolicy::cut_for_graphs: return 1;
       case GainPolicy::steiner_tree_for_graphs: return 1;
+      case GainPolicy::km1_sparse: return 1;
       case GainPolicy::none: throw InvalidParameterException("Gain policy is unknown");
     }
     throw InvalidParameterException("Gain policy is unknown");
@@ -32,6 +32,7 @@
 
 #include "mt-kahypar/datastructures/synchronized_edge_update.h"
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/weighted_parallel_for.h"
 
 namespace mt_kahypar {
 
@@ -48,10 +49,13 @@ void CutGainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
   tbb::enumerable_thread_specific< vec<HyperedgeWeight> > ets_mtb(_k, 0);
   tbb::concurrent_vector<HypernodeID> high_degree_vertices;
   // Compute gain of all low degree vertices
-  tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), partitioned_hg.initialNumNodes()),
-    [&](tbb::blocked_range<HypernodeID>& r) {
+  parallel::weighted_parallel_for_ranges(HypernodeID(0), partitioned_hg.initialNumNodes(),
+    [&](const HypernodeID u) {
+      return partitioned_hg.nodeIsEnabled(u) ?
+        std::min<HyperedgeID>(partitioned_hg.nodeDegree(u), HIGH_DEGREE_THRESHOLD) : 0;
+    }, [&](const HypernodeID first, const HypernodeID last) {
       vec<HyperedgeWeight>& benefit_aggregator = ets_mtb.local();
-      for (HypernodeID u = r.begin(); u < r.end(); ++u) {
+      for (HypernodeID u = first; u < last; ++u) {
         if ( partitioned_hg.nodeIsEnabled(u)) {
           if ( partitioned_hg.nodeDegree(u) <= HIGH_DEGREE_THRESHOLD) {
             initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator);
@@ -44,6 +44,8 @@ class CutGainComputation : public GainComputationBase<CutGainComputation, CutAtt
 
  public:
   using RatingMap = typename Base::RatingMap;
+  // ! The gain contributions of the incident nets can be aggregated in parallel
+  static constexpr bool supports_parallel_gain_aggregation = true;
 
   CutGainComputation(const Context& context,
                      bool disable_randomization = false) :
@@ -54,28 +56,50 @@ class CutGainComputation : public GainComputationBase<CutGainComputation, CutAtt
   // ! and the gain to all adjacent blocks assuming the node is in an isolated block.
   // ! The gain of that node to a block to can then be computed by
   // ! 'isolated_block_gain - tmp_scores[to]' (see gain(...))
-  template<typename PartitionedHypergraph>
+  template<typename PartitionedHypergraph, typename Scores>
   void precomputeGains(const PartitionedHypergraph& phg,
                        const HypernodeID hn,
-                       RatingMap& tmp_scores,
+                       Scores& tmp_scores,
                        Gain& isolated_block_gain,
                        const bool) {
     ASSERT(tmp_scores.size() == 0, "Rating map not empty");
     PartitionID from = phg.partID(hn);
-    for (const HyperedgeID& he : phg.incidentEdges(hn)) {
-      PartitionID connectivity = phg.connectivity(he);
-      HypernodeID pin_count_in_from_part = phg.pinCountInPart(he, from);
-      HyperedgeWeight weight = phg.edgeWeight(he);
-      if (connectivity == 1 && phg.edgeSize(he) > 1) {
-        // In case, the hyperedge is a non-cut hyperedge, we would increase
-        // the cut, if we move vertex hn to an other block.
-        isolated_block_gain += weight;
-      } else if (connectivity == 2 && pin_count_in_from_part == 1) {
+    if ( phg.k() == 2 ) {
+      for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+        precomputeGainOfIncidentEdge<true>(phg, from, he, tmp_scores, isolated_block_gain);
+      }
+    } else {
+      for (const HyperedgeID& he : phg.incidentEdges(hn)) {
+        precomputeGainOfIncidentEdge<false>(phg, from, he, tmp_scores, isolated_block_gain);
+      }
+    }
+  }
+
+  // ! Adds the contribution of incident edge he to the precomputed gains (see precomputeGains(...)).
+  // ! The contributions of the incident edges are independent of each other.
+  // ! For bipartitions, the other block of a cut hyperedge is always 1 - from.
+  template<bool is_bipartition = false, typename PartitionedHypergraph, typename Scores>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void precomputeGainOfIncidentEdge(const PartitionedHypergraph& phg,
+                                                                      const PartitionID from,
+                                                                      const HyperedgeID he,
+                                                                      Scores& tmp_scores,
+                                                                      Gain& isolated_block_gain) {
+    PartitionID connectivity = phg.connectivity(he);
+    HypernodeID pin_count_in_from_part = phg.pinCountInPart(he, from);
+    HyperedgeWeight weight = phg.edgeWeight(he);
+    if (connectivity == 1 && phg.edgeSize(he) > 1) {
+      // In case, the hyperedge is a non-cut hyperedge, we would increase
+      // the cut, if we move vertex hn to an other block.
+      isolated_block_gain += weight;
+    } else if (connectivity == 2 && pin_count_in_from_part == 1) {
+      // In case there are only two blocks contained in the current
+      // hyperedge and only one pin left in the from part of the hyperedge,
+      // we would make the current hyperedge a non-cut hyperedge when moving
+      // vertex hn to the other block.
+      if constexpr ( is_bipartition ) {
+        tmp_scores[1 - from] += weight;
+      } else {
         for (const PartitionID& to : phg.connectivitySet(he)) {
-          // In case there are only two blocks contained in the current
-          // hyperedge and only one pin left in the from part of the hyperedge,
-          // we would make the current hyperedge a non-cut hyperedge when moving
-          // vertex hn to the other block.
           if (from != to) {
             tmp_scores[to] += weight;
           }
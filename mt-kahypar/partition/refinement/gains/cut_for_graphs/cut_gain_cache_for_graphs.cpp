@@ -40,7 +40,22 @@ void GraphCutGainCache::initializeGainCache(const PartitionedGraph& partitioned_
   ASSERT(!_is_initialized, "Gain cache is already initialized");
   ASSERT(_k <= 0 || _k >= partitioned_graph.k(),
     "Gain cache was already initialized for a different k" << V(_k) << V(partitioned_graph.k()));
-  allocateGainTable(partitioned_graph.topLevelNumNodes(), partitioned_graph.k());
+  const HypernodeID num_nodes = partitioned_graph.initialNumNodes();
+  const double avg_degree = num_nodes > 0 ?
+    static_cast<double>(partitioned_graph.initialNumEdges()) / num_nodes : 0.0;
+  allocateGainTable(partitioned_graph.topLevelNumNodes(), partitioned_graph.k(), avg_degree);
+
+  if ( _compute_on_the_fly ) {
+    // The incident weights are computed on demand on the current partitioned graph.
+    // The versions of the nodes are incremented to invalidate the thread-local buffers.
+    _graph = &partitioned_graph;
+    _aggregate_incident_weights = &aggregateIncidentWeights<PartitionedGraph>;
+    tbb::parallel_for(UL(0), _node_version.size(), [&](const size_t u) {
+      incrementVersion(u);
+    });
+    _is_initialized = true;
+    return;
+  }
 
   // assert that current gain values are zero
   ASSERT(!_is_initialized &&
@@ -69,6 +84,10 @@ void GraphCutGainCache::deltaGainUpdate(const PartitionedGraph& partitioned_grap
                                         const SynchronizedEdgeUpdate& sync_update) {
   ASSERT(_is_initialized, "Gain cache is not initialized");
   const HypernodeID target = partitioned_graph.edgeTarget(sync_update.he);
+  if ( _compute_on_the_fly ) {
+    incrementVersion(target);
+    return;
+  }
   const size_t index_in_from_part = incident_weight_index(target, sync_update.from);
   _gain_cache[index_in_from_part].fetch_sub(sync_update.edge_weight, std::memory_order_relaxed);
   const size_t index_in_to_part = incident_weight_index(target, sync_update.to);
@@ -81,7 +100,10 @@ void GraphCutGainCache::uncontractUpdateAfterRestore(const PartitionedGraph& par
                                                      const HypernodeID v,
                                                      const HyperedgeID he,
                                                      const HypernodeID) {
-  if ( _is_initialized ) {
+  if ( _is_initialized && _compute_on_the_fly ) {
+    incrementVersion(u);
+    incrementVersion(v);
+  } else if ( _is_initialized ) {
     // the edge weight is added to u and v
     const PartitionID block = partitioned_graph.partID(u);
     const HyperedgeWeight we = partitioned_graph.edgeWeight(he);
@@ -96,7 +118,10 @@ void GraphCutGainCache::uncontractUpdateAfterReplacement(const PartitionedGraph&
                                                          const HypernodeID u,
                                                          const HypernodeID v,
                                                          const HyperedgeID he) {
-  if ( _is_initialized ) {
+  if ( _is_initialized && _compute_on_the_fly ) {
+    incrementVersion(u);
+    incrementVersion(v);
+  } else if ( _is_initialized ) {
     // the edge weight shifts from u to v
     const HypernodeID w = partitioned_graph.edgeTarget(he);
     const PartitionID block_of_w = partitioned_graph.partID(w);
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include "kahypar-resources/meta/policy_registry.h"
 
 #include "mt-kahypar/partition/context_enum_classes.h"
@@ -55,6 +57,13 @@ class DeltaGraphCutGainCache;
  * We call b(u, V_j) the benefit term and p(u) the penalty term. Our gain cache stores and maintains these
  * entries for each node and block. Note that p(u) = b(u, V_i).
  * Thus, the gain cache stores k entries per node.
+ *
+ * If k is large compared to the average degree of the graph, most of these entries are zero. In that case,
+ * the gain cache does not store the entries, but computes the incident weights w(u, V') of a node to all blocks
+ * on demand by scanning its neighborhood (see Context::partition.graph_gain_cache_on_the_fly_factor).
+ * The incident weights of the last queried node are kept in a thread-local buffer, which is valid as long
+ * as the version of the node does not change. The version of a node is incremented whenever one of its
+ * neighbors is moved, such that the gain cache only stores one entry per node.
 */
 class GraphCutGainCache {
 
@@ -64,20 +73,33 @@ class GraphCutGainCache {
   static constexpr bool requires_notification_before_update = false;
   static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = false;
   static constexpr bool invalidates_entries = false;
+  static constexpr bool supports_batched_updates = true;
 
   using AdjacentBlocksIterator = IntegerRangeIterator<PartitionID>::const_iterator;
 
   GraphCutGainCache() :
     _is_initialized(false),
     _k(kInvalidPartition),
+    _on_the_fly_factor(0.0),
+    _compute_on_the_fly(false),
     _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _dummy_adjacent_blocks(),
+    _graph(nullptr),
+    _aggregate_incident_weights(nullptr),
+    _node_version(),
+    _local_incident_weights() { }
 
-  GraphCutGainCache(const Context&) :
+  GraphCutGainCache(const Context& context) :
     _is_initialized(false),
     _k(kInvalidPartition),
+    _on_the_fly_factor(context.partition.graph_gain_cache_on_the_fly_factor),
+    _compute_on_the_fly(false),
     _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _dummy_adjacent_blocks(),
+    _graph(nullptr),
+    _aggregate_incident_weights(nullptr),
+    _node_version(),
+    _local_incident_weights() { }
 
   GraphCutGainCache(const GraphCutGainCache&) = delete;
   GraphCutGainCache & operator= (const GraphCutGainCache &) = delete;
@@ -92,7 +114,7 @@ class GraphCutGainCache {
   }
 
   void reset(const bool run_parallel = true) {
-    if ( _is_initialized ) {
+    if ( _is_initialized && !_compute_on_the_fly ) {
       _gain_cache.assign(_gain_cache.size(),  CAtomic<HyperedgeWeight>(0), run_parallel);
     }
     _is_initialized = false;
@@ -102,6 +124,17 @@ class GraphCutGainCache {
     return _gain_cache.size();
   }
 
+  // ! Returns whether the incident weights of the nodes are computed on demand
+  bool computesOnTheFly() const {
+    return _compute_on_the_fly;
+  }
+
+  // ! The incident weights are computed on demand, if k is large compared to the average degree
+  void setOnTheFlyFactor(const double factor) {
+    ASSERT(!_is_initialized);
+    _on_the_fly_factor = factor;
+  }
+
   // ! Initializes all gain cache entries
   template<typename PartitionedGraph>
   void initializeGainCache(const PartitionedGraph& partitioned_graph);
@@ -133,7 +166,7 @@ class GraphCutGainCache {
   HyperedgeWeight penaltyTerm(const HypernodeID u,
                               const PartitionID from) const {
     ASSERT(_is_initialized, "Gain cache is not initialized");
-    return _gain_cache[incident_weight_index(u, from)].load(std::memory_order_relaxed);
+    return incidentWeight(u, from);
   }
 
   template<typename PartitionedGraph>
@@ -143,12 +176,34 @@ class GraphCutGainCache {
     // Do nothing here (only relevant for hypergraph gain cache)
   }
 
+  // ! Recomputes the incident weights of node u from scratch. Used to apply a batch of
+  // ! moves without delta gain updates (see batched_gain_cache_update.h).
+  template<typename PartitionedGraph>
+  void recomputeGainCacheEntry(const PartitionedGraph& partitioned_graph,
+                               const HypernodeID u) {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    if ( _compute_on_the_fly ) {
+      incrementVersion(u);
+      return;
+    }
+    for ( PartitionID to = 0; to < _k; ++to ) {
+      _gain_cache[incident_weight_index(u, to)].store(0, std::memory_order_relaxed);
+    }
+    for ( const HyperedgeID& e : partitioned_graph.incidentEdges(u) ) {
+      if ( !partitioned_graph.isSinglePin(e) ) {
+        const size_t index = incident_weight_index(u,
+          partitioned_graph.partID(partitioned_graph.edgeTarget(e)));
+        _gain_cache[index].fetch_add(partitioned_graph.edgeWeight(e), std::memory_order_relaxed);
+      }
+    }
+  }
+
   // ! Returns the benefit term for moving node u to block to.
   // ! More formally, b(u, V_j) := w(u, V_j)
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
     ASSERT(_is_initialized, "Gain cache is not initialized");
-    return _gain_cache[incident_weight_index(u, to)].load(std::memory_order_relaxed);
+    return incidentWeight(u, to);
   }
 
   // ! Returns the gain of moving node u from its current block to a target block V_j.
@@ -266,18 +321,75 @@ class GraphCutGainCache {
  private:
   friend class DeltaGraphCutGainCache;
 
+  // ! Thread-local buffer that stores the incident weights of the last queried node
+  struct IncidentWeights {
+    HypernodeID node = kInvalidHypernode;
+    uint32_t version = 0;
+    vec<HyperedgeWeight> weights;
+    vec<PartitionID> touched_blocks;
+  };
+
+  using AggregateIncidentWeights = void (*)(const void*, const HypernodeID, IncidentWeights&);
+
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   size_t incident_weight_index(const HypernodeID u, const PartitionID p) const {
     return size_t(u) * _k  + p;
   }
 
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight incidentWeight(const HypernodeID u, const PartitionID p) const {
+    if ( !_compute_on_the_fly ) {
+      return _gain_cache[incident_weight_index(u, p)].load(std::memory_order_relaxed);
+    }
+    IncidentWeights& incident_weights = _local_incident_weights.local();
+    const uint32_t version = _node_version[u].load(std::memory_order_acquire);
+    if ( incident_weights.node != u || incident_weights.version != version ) {
+      for ( const PartitionID block : incident_weights.touched_blocks ) {
+        incident_weights.weights[block] = 0;
+      }
+      incident_weights.touched_blocks.clear();
+      incident_weights.weights.resize(_k, 0);
+      _aggregate_incident_weights(_graph, u, incident_weights);
+      incident_weights.node = u;
+      incident_weights.version = version;
+    }
+    return incident_weights.weights[p];
+  }
+
+  // ! Invalidates the incident weights of node u stored in the thread-local buffers
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void incrementVersion(const HypernodeID u) {
+    _node_version[u].fetch_add(1, std::memory_order_release);
+  }
+
+  template<typename PartitionedGraph>
+  static void aggregateIncidentWeights(const void* graph,
+                                       const HypernodeID u,
+                                       IncidentWeights& incident_weights) {
+    const PartitionedGraph& partitioned_graph = *static_cast<const PartitionedGraph*>(graph);
+    for ( const HyperedgeID& e : partitioned_graph.incidentEdges(u) ) {
+      if ( !partitioned_graph.isSinglePin(e) ) {
+        const PartitionID block = partitioned_graph.partID(partitioned_graph.edgeTarget(e));
+        if ( incident_weights.weights[block] == 0 ) {
+          incident_weights.touched_blocks.push_back(block);
+        }
+        incident_weights.weights[block] += partitioned_graph.edgeWeight(e);
+      }
+    }
+  }
+
   // ! Allocates the memory required to store the gain cache
   void allocateGainTable(const HypernodeID num_nodes,
-                         const PartitionID k) {
-    if (_gain_cache.size() == 0 && k != kInvalidPartition) {
+                         const PartitionID k,
+                         const double avg_degree) {
+    if (_gain_cache.size() == 0 && _node_version.size() == 0 && k != kInvalidPartition) {
       _k = k;
       _dummy_adjacent_blocks = IntegerRangeIterator<PartitionID>(k);
-      _gain_cache.resize("Refinement", "incident_weight_in_part", num_nodes * size_t(_k), true);
+      _compute_on_the_fly = _on_the_fly_factor > 0 && k >= _on_the_fly_factor * avg_degree;
+      if ( _compute_on_the_fly ) {
+        _node_version.resize("Refinement", "incident_weight_version", num_nodes, true);
+      } else {
+        _gain_cache.resize("Refinement", "incident_weight_in_part", num_nodes * size_t(_k), true);
+      }
     }
   }
 
@@ -287,11 +399,27 @@ class GraphCutGainCache {
   // ! Number of blocks
   PartitionID _k;
 
+  // ! The incident weights are computed on demand if k >= _on_the_fly_factor * average degree
+  double _on_the_fly_factor;
+  bool _compute_on_the_fly;
+
   // ! Array of size |V| * k, which stores the benefit and penalty terms of each node.
   ds::Array< CAtomic<HyperedgeWeight> > _gain_cache;
 
   // ! Provides an iterator from 0 to k (:= number of blocks)
   IntegerRangeIterator<PartitionID> _dummy_adjacent_blocks;
+
+  // ! Partitioned graph on which the incident weights are computed on demand
+  const void* _graph;
+
+  // ! Computes the incident weights of a node on _graph
+  AggregateIncidentWeights _aggregate_incident_weights;
+
+  // ! Version of each node, which is incremented when a neighbor is moved
+  ds::Array< CAtomic<uint32_t> > _node_version;
+
+  // ! Incident weights of the last queried node of each thread
+  mutable tbb::enumerable_thread_specific<IncidentWeights> _local_incident_weights;
 };
 
 /**
@@ -34,6 +34,9 @@
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/partition/refinement/gains/km1/km1_gain_cache.h"
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
+#endif
 #include "mt-kahypar/partition/refinement/gains/cut/cut_gain_cache.h"
 #include "mt-kahypar/partition/refinement/gains/soed/soed_gain_cache.h"
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
@@ -84,6 +87,10 @@ class GainCachePtr {
         return function(cast<GraphSteinerTreeGainCache>(gain_cache));
       #endif
       #endif
+      case GainPolicy::km1_sparse:
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+        return function(cast<SparseKm1GainCache>(gain_cache));
+      #endif
       case GainPolicy::none: break;
     }
     throw InvalidParameterException("No gain policy set");
@@ -109,6 +116,10 @@ class GainCachePtr {
           return function(cast<CutGainCache>(gain_cache));
         case GainPolicy::km1:
           return function(cast<Km1GainCache>(gain_cache));
+        #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+        case GainPolicy::km1_sparse:
+          return function(cast<SparseKm1GainCache>(gain_cache));
+        #endif
         #ifdef KAHYPAR_ENABLE_SOED_METRIC
         case GainPolicy::soed:
           return function(cast<SoedGainCache>(gain_cache));
@@ -127,6 +138,9 @@ class GainCachePtr {
     switch(context.partition.gain_policy) {
       case GainPolicy::cut: return constructGainCache<CutGainCache>(context);
       case GainPolicy::km1: return constructGainCache<Km1GainCache>(context);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case GainPolicy::km1_sparse: return constructGainCache<SparseKm1GainCache>(context);
+      #endif
       #ifdef KAHYPAR_ENABLE_SOED_METRIC
       case GainPolicy::soed: return constructGainCache<SoedGainCache>(context);
       #endif
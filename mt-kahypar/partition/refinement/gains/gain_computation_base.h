@@ -30,12 +30,16 @@
 
 #include "kahypar-resources/meta/mandatory.h"
 
+#include <tbb/blocked_range.h>
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/datastructures/synchronized_edge_update.h"
 
 namespace mt_kahypar {
 
@@ -46,8 +50,19 @@ class GainComputationBase {
 
  public:
   using RatingMap = ds::SparseMap<PartitionID, Gain>;
+  // ! Hash map whose size is proportional to the number of adjacent blocks of a node
+  using HashedRatingMap = ds::DynamicSparseMap<PartitionID, Gain>;
   using TmpScores = tbb::enumerable_thread_specific<RatingMap>;
+  using HashedTmpScores = tbb::enumerable_thread_specific<HashedRatingMap>;
   using Penalty = tbb::enumerable_thread_specific<Gain>;
+  // ! Derived classes that aggregate the gain as a sum over the incident nets
+  // ! (see precomputeGainOfIncidentEdge(...)) set this to true
+  static constexpr bool supports_parallel_gain_aggregation = false;
+  // ! For large k, the scores of nodes with a small degree are aggregated in a hash map
+  // ! instead of the k-sized rating map, since a node can only be adjacent to few blocks
+  // ! and the k-sized arrays of each thread do not fit into the cache.
+  static constexpr PartitionID HASHED_RATING_MAP_MIN_K = 1024;
+  static constexpr PartitionID HASHED_RATING_MAP_DEGREE_RATIO = 16;
 
   GainComputationBase(const Context& context,
                       const bool disable_randomization) :
@@ -57,6 +72,7 @@ class GainComputationBase {
     _tmp_scores([&] {
       return constructLocalTmpScores();
     }),
+    _hashed_tmp_scores(),
     _isolated_block_gain(0) { }
 
   template<typename PartitionedHypergraph>
@@ -65,21 +81,69 @@ class GainComputationBase {
                           const bool rebalance = false,
                           const bool consider_non_adjacent_blocks = false,
                           const bool allow_imbalance = false) {
-    Derived* derived = static_cast<Derived*>(this);
-    RatingMap& tmp_scores = _tmp_scores.local();
-    Gain& isolated_block_gain = _isolated_block_gain.local();
-    derived->precomputeGains(phg, hn, tmp_scores, isolated_block_gain, consider_non_adjacent_blocks);
-    Move best_move = computeMaxGainMoveForScores(phg, tmp_scores, isolated_block_gain, hn,
-                        rebalance, consider_non_adjacent_blocks, allow_imbalance);
-
-    isolated_block_gain = 0;
-    tmp_scores.clear();
-    return best_move;
+    if ( useHashedRatingMap(phg, hn) ) {
+      return computeMaxGainMoveImpl(phg, hn, _hashed_tmp_scores.local(),
+        rebalance, consider_non_adjacent_blocks, allow_imbalance);
+    } else {
+      return computeMaxGainMoveImpl(phg, hn, _tmp_scores.local(),
+        rebalance, consider_non_adjacent_blocks, allow_imbalance);
+    }
   }
 
+  // ! Same as computeMaxGainMove(...), but the gain contributions of the incident nets are
+  // ! aggregated in parallel. This is intended for nodes with a very large degree, which
+  // ! would otherwise be processed by a single thread.
   template<typename PartitionedHypergraph>
+  Move computeMaxGainMoveInParallel(const PartitionedHypergraph& phg,
+                                    const HypernodeID hn,
+                                    const bool rebalance = false,
+                                    const bool consider_non_adjacent_blocks = false,
+                                    const bool allow_imbalance = false) {
+    if constexpr ( Derived::supports_parallel_gain_aggregation ) {
+      Derived* derived = static_cast<Derived*>(this);
+      const PartitionID from = phg.partID(hn);
+      // Several high degree nodes can be processed concurrently, so the aggregators are local to this call
+      tbb::enumerable_thread_specific<RatingMap> local_scores([&] {
+        return constructLocalTmpScores();
+      });
+      tbb::enumerable_thread_specific<Gain> local_isolated_block_gain(0);
+      // Isolation prevents the calling thread from picking up other work that uses its thread-local scores
+      tbb::this_task_arena::isolate([&] {
+        tbb::parallel_for(tbb::blocked_range<size_t>(UL(0), phg.nodeDegree(hn)),
+          [&](const tbb::blocked_range<size_t>& range) {
+          RatingMap& tmp_scores = local_scores.local();
+          Gain& isolated_block_gain = local_isolated_block_gain.local();
+          size_t current_pos = range.begin();
+          for ( const HyperedgeID& he : phg.incidentEdges(hn, range.begin()) ) {
+            if ( current_pos == range.end() ) {
+              break;
+            }
+            derived->precomputeGainOfIncidentEdge(phg, from, he, tmp_scores, isolated_block_gain);
+            ++current_pos;
+          }
+        });
+      });
+
+      RatingMap& tmp_scores = _tmp_scores.local();
+      ASSERT(tmp_scores.size() == 0, "Rating map not empty");
+      for ( const RatingMap& scores : local_scores ) {
+        for ( const auto& entry : scores ) {
+          tmp_scores[entry.key] += entry.value;
+        }
+      }
+      const Gain isolated_block_gain = local_isolated_block_gain.combine(std::plus<Gain>());
+      Move best_move = computeMaxGainMoveForScores(phg, tmp_scores, isolated_block_gain, hn,
+                         rebalance, consider_non_adjacent_blocks, allow_imbalance);
+      tmp_scores.clear();
+      return best_move;
+    } else {
+      return computeMaxGainMove(phg, hn, rebalance, consider_non_adjacent_blocks, allow_imbalance);
+    }
+  }
+
+  template<typename PartitionedHypergraph, typename Scores>
   Move computeMaxGainMoveForScores(const PartitionedHypergraph& phg,
-                                   const RatingMap& tmp_scores,
+                                   const Scores& tmp_scores,
                                    const Gain isolated_block_gain,
                                    const HypernodeID hn,
                                    const bool rebalance = false,
@@ -184,6 +248,31 @@ class GainComputationBase {
   }
 
 private:
+  template<typename PartitionedHypergraph>
+  bool useHashedRatingMap(const PartitionedHypergraph& phg, const HypernodeID hn) const {
+    return _context.partition.k >= HASHED_RATING_MAP_MIN_K &&
+      phg.nodeDegree(hn) < static_cast<HyperedgeID>(
+        _context.partition.k / HASHED_RATING_MAP_DEGREE_RATIO);
+  }
+
+  template<typename PartitionedHypergraph, typename Scores>
+  Move computeMaxGainMoveImpl(const PartitionedHypergraph& phg,
+                              const HypernodeID hn,
+                              Scores& tmp_scores,
+                              const bool rebalance,
+                              const bool consider_non_adjacent_blocks,
+                              const bool allow_imbalance) {
+    Derived* derived = static_cast<Derived*>(this);
+    Gain& isolated_block_gain = _isolated_block_gain.local();
+    derived->precomputeGains(phg, hn, tmp_scores, isolated_block_gain, consider_non_adjacent_blocks);
+    Move best_move = computeMaxGainMoveForScores(phg, tmp_scores, isolated_block_gain, hn,
+                        rebalance, consider_non_adjacent_blocks, allow_imbalance);
+
+    isolated_block_gain = 0;
+    tmp_scores.clear();
+    return best_move;
+  }
+
   RatingMap constructLocalTmpScores() const {
     return RatingMap(_context.partition.k);
   }
@@ -193,6 +282,7 @@ private:
   const bool _disable_randomization;
   DeltaGain _deltas;
   TmpScores _tmp_scores;
+  HashedTmpScores _hashed_tmp_scores;
   Penalty _isolated_block_gain;
 };
 
@@ -37,6 +37,9 @@
 #include "mt-kahypar/partition/refinement/gains/km1/km1_gain_computation.h"
 #include "mt-kahypar/partition/refinement/gains/km1/km1_attributed_gains.h"
 #include "mt-kahypar/partition/refinement/gains/km1/km1_flow_network_construction.h"
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
+#endif
 #include "mt-kahypar/partition/refinement/gains/cut/cut_gain_cache.h"
 #include "mt-kahypar/partition/refinement/gains/cut/cut_rollback.h"
 #include "mt-kahypar/partition/refinement/gains/cut/cut_gain_computation.h"
@@ -66,6 +69,7 @@
 #include "mt-kahypar/partition/refinement/gains/cut_for_graphs/cut_gain_cache_for_graphs.h"
 #include "mt-kahypar/partition/refinement/gains/cut_for_graphs/cut_attributed_gains_for_graphs.h"
 #endif
+#include "mt-kahypar/partition/refinement/gains/batched_gain_cache_update.h"
 #include "mt-kahypar/macros.h"
 
 namespace mt_kahypar {
@@ -79,6 +83,17 @@ struct Km1GainTypes : public kahypar::meta::PolicyBase {
   using FlowNetworkConstruction = Km1FlowNetworkConstruction;
 };
 
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+struct SparseKm1GainTypes : public kahypar::meta::PolicyBase {
+  using GainComputation = Km1GainComputation;
+  using AttributedGains = Km1AttributedGains;
+  using GainCache = SparseKm1GainCache;
+  using DeltaGainCache = DeltaSparseKm1GainCache;
+  using Rollback = Km1Rollback;
+  using FlowNetworkConstruction = Km1FlowNetworkConstruction;
+};
+#endif
+
 struct CutGainTypes : public kahypar::meta::PolicyBase {
   using GainComputation = CutGainComputation;
   using AttributedGains = CutAttributedGains;
@@ -154,7 +169,8 @@ using GainTypes = kahypar::meta::Typelist<Km1GainTypes,
                                           ENABLE_SOED(COMMA SoedGainTypes)
                                           ENABLE_STEINER_TREE(COMMA SteinerTreeGainTypes)
                                           ENABLE_GRAPHS(COMMA CutGainForGraphsTypes)
-                                          ENABLE_GRAPHS(ENABLE_STEINER_TREE(COMMA SteinerTreeForGraphsTypes))>;
+                                          ENABLE_GRAPHS(ENABLE_STEINER_TREE(COMMA SteinerTreeForGraphsTypes))
+                                          ENABLE_LARGE_K(COMMA SparseKm1GainTypes)>;
 
 #define _LIST_HYPERGRAPH_COMBINATIONS(TYPE_TRAITS)                                     \
   GraphAndGainTypes<TYPE_TRAITS, Km1GainTypes>,                                           \
@@ -170,7 +186,8 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
                                                       ENABLE_GRAPHS(COMMA _LIST_GRAPH_COMBINATIONS(StaticGraphTypeTraits))
                                                       ENABLE_HIGHEST_QUALITY(COMMA _LIST_HYPERGRAPH_COMBINATIONS(DynamicHypergraphTypeTraits))
                                                       ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(COMMA _LIST_GRAPH_COMBINATIONS(DynamicGraphTypeTraits))
-                                                      ENABLE_LARGE_K(COMMA _LIST_HYPERGRAPH_COMBINATIONS(LargeKHypergraphTypeTraits))>;
+                                                      ENABLE_LARGE_K(COMMA _LIST_HYPERGRAPH_COMBINATIONS(LargeKHypergraphTypeTraits))
+                                                      ENABLE_LARGE_K(COMMA GraphAndGainTypes<LargeKHypergraphTypeTraits COMMA SparseKm1GainTypes>)>;
 
 
 #define _INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, TYPE_TRAITS)                  \
@@ -189,7 +206,8 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
   ENABLE_GRAPHS(_INSTANTIATE_CLASS_MACRO_FOR_GRAPH_COMBINATIONS(C, StaticGraphTypeTraits))                        \
   ENABLE_HIGHEST_QUALITY(_INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, DynamicHypergraphTypeTraits))    \
   ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(_INSTANTIATE_CLASS_MACRO_FOR_GRAPH_COMBINATIONS(C, DynamicGraphTypeTraits))   \
-  ENABLE_LARGE_K(_INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, LargeKHypergraphTypeTraits))
+  ENABLE_LARGE_K(_INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, LargeKHypergraphTypeTraits))             \
+  ENABLE_LARGE_K(template class C(GraphAndGainTypes<LargeKHypergraphTypeTraits COMMA SparseKm1GainTypes>);)
 
 
 // functionality for retrieving combined policy of partition type and gain
@@ -211,6 +229,14 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
   }                                                                                           \
 }
 
+// the sparse gain cache for the connectivity metric is only available for large k partitioning
+#define SWITCH_LARGE_K_HYPERGRAPH_GAIN_TYPES(gain_policy) {                                         \
+  if ( gain_policy == GainPolicy::km1_sparse ) {                                                    \
+    ENABLE_LARGE_K(_RETURN_COMBINED_POLICY(LargeKHypergraphTypeTraits, SparseKm1GainTypes))         \
+  }                                                                                                 \
+  SWITCH_HYPERGRAPH_GAIN_TYPES(LargeKHypergraphTypeTraits, gain_policy)                             \
+}
+
 #define SWITCH_GRAPH_GAIN_TYPES(TYPE_TRAITS, gain_policy) {                                                   \
   switch ( gain_policy ) {                                                                                    \
     case GainPolicy::cut_for_graphs:                                                                          \
@@ -32,6 +32,8 @@
 
 #include "mt-kahypar/datastructures/synchronized_edge_update.h"
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/weighted_parallel_for.h"
+#include "mt-kahypar/partition/refinement/gains/benefit_aggregation.h"
 
 namespace mt_kahypar {
 
@@ -49,13 +51,21 @@ void Km1GainCache::initializeGainCache(const PartitionedHypergraph& partitioned_
   tbb::enumerable_thread_specific< vec<HyperedgeWeight> > ets_mtb(_k, 0);
   tbb::concurrent_vector<HypernodeID> high_degree_vertices;
   // Compute gain of all low degree vertices
-  tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), partitioned_hg.initialNumNodes()),
-    [&](tbb::blocked_range<HypernodeID>& r) {
+  parallel::weighted_parallel_for_ranges(HypernodeID(0), partitioned_hg.initialNumNodes(),
+    [&](const HypernodeID u) {
+      return partitioned_hg.nodeIsEnabled(u) ?
+        std::min<HyperedgeID>(partitioned_hg.nodeDegree(u), HIGH_DEGREE_THRESHOLD) : 0;
+    }, [&](const HypernodeID first, const HypernodeID last) {
       vec<HyperedgeWeight>& benefit_aggregator = ets_mtb.local();
-      for (HypernodeID u = r.begin(); u < r.end(); ++u) {
+      for (HypernodeID u = first; u < last; ++u) {
+        if ( _lazy_initialization ) {
+          _lazy_block[u].store(ENTRY_IS_WRITTEN, std::memory_order_relaxed);
+        }
         if ( partitioned_hg.nodeIsEnabled(u)) {
           if ( partitioned_hg.nodeDegree(u) <= HIGH_DEGREE_THRESHOLD) {
-            initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator);
+            if ( !_lazy_initialization || !initializeLazyGainCacheEntryForNode(partitioned_hg, u) ) {
+              initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator);
+            }
           } else {
             // Collect high degree vertices
             high_degree_vertices.push_back(u);
@@ -132,6 +142,8 @@ void Km1GainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
   const HyperedgeWeight edge_weight = sync_update.edge_weight;
   const HypernodeID pin_count_in_from_part_after = sync_update.pin_count_in_from_part_after;
   const HypernodeID pin_count_in_to_part_after = sync_update.pin_count_in_to_part_after;
+  // Penalty terms of lazily initialized nodes are always up-to-date. Only the benefit
+  // term updates require to write the remaining entries of the node first.
   if ( pin_count_in_from_part_after == 1 ) {
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, from));
@@ -142,6 +154,7 @@ void Km1GainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
   } else if (pin_count_in_from_part_after == 0) {
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, from));
+      ensureEntryIsWritten(u);
       _gain_cache[benefit_index(u, from)].fetch_sub(edge_weight, std::memory_order_relaxed);
     }
   }
@@ -149,6 +162,7 @@ void Km1GainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
   if (pin_count_in_to_part_after == 1) {
     for (const HypernodeID& u : partitioned_hg.pins(he)) {
       ASSERT(nodeGainAssertions(u, to));
+      ensureEntryIsWritten(u);
       _gain_cache[benefit_index(u, to)].fetch_add(edge_weight, std::memory_order_relaxed);
     }
   } else if (pin_count_in_to_part_after == 2) {
@@ -243,13 +257,33 @@ void Km1GainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
                                                   vec<Gain>& benefit_aggregator) {
   PartitionID from = partitioned_hg.partID(u);
   Gain penalty = 0;
-  for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
-    HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
-    if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
-      penalty += ew;
+  bool is_aggregated = false;
+  if constexpr ( PartitionedHypergraph::has_dense_connectivity_set ) {
+    if ( _k <= benefit_aggregation::MAX_NUM_BLOCKS_FOR_DENSE_AGGREGATION ) {
+      // The connectivity set of each hyperedge is a single bitset block,
+      // which allows to aggregate the benefits of all blocks branch-free
+      benefit_aggregation::BenefitAggregationBuffer buffer(_k, benefit_aggregator.data());
+      for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+        HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+        if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
+          penalty += ew;
+        }
+        buffer.add(partitioned_hg.connectivitySetBlock(e, 0), ew);
+      }
+      buffer.flush();
+      is_aggregated = true;
     }
-    for (const PartitionID& i : partitioned_hg.connectivitySet(e)) {
-      benefit_aggregator[i] += ew;
+  }
+
+  if ( !is_aggregated ) {
+    for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+      HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+      if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
+        penalty += ew;
+      }
+      for (const PartitionID& i : partitioned_hg.connectivitySet(e)) {
+        benefit_aggregator[i] += ew;
+      }
     }
   }
 
@@ -260,6 +294,29 @@ void Km1GainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
   }
 }
 
+template<typename PartitionedHypergraph>
+bool Km1GainCache::initializeLazyGainCacheEntryForNode(const PartitionedHypergraph& partitioned_hg,
+                                                       const HypernodeID u) {
+  const PartitionID from = partitioned_hg.partID(u);
+  Gain penalty = 0;
+  Gain benefit = 0;
+  for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+    if ( partitioned_hg.connectivity(e) > 1 ) {
+      return false;
+    }
+    const HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+    if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
+      penalty += ew;
+    }
+    benefit += ew;
+  }
+
+  _gain_cache[penalty_index(u)].store(penalty, std::memory_order_relaxed);
+  _gain_cache[benefit_index(u, from)].store(benefit, std::memory_order_relaxed);
+  _lazy_block[u].store(from, std::memory_order_relaxed);
+  return true;
+}
+
 namespace {
 #define KM1_INITIALIZE_GAIN_CACHE(X) void Km1GainCache::initializeGainCache(const X&)
 #define KM1_DELTA_GAIN_UPDATE(X) void Km1GainCache::deltaGainUpdate(const X&,                     \
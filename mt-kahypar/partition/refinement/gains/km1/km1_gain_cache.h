@@ -28,6 +28,8 @@
 
 #include <algorithm>
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include "kahypar-resources/meta/policy_registry.h"
 
 #include "mt-kahypar/partition/context_enum_classes.h"
@@ -62,6 +64,11 @@ namespace mt_kahypar {
  *            = b(u, V_j) - p(u)
  * We call b(u, V_j) the benefit term and p(u) the penalty term. Our gain cache stores and maintains these
  * entries for each node and block. Thus, the gain cache stores k + 1 entries per node.
+ *
+ * If lazy initialization is enabled, the initialization only writes p(u) and b(u, V_i) for a node u
+ * that is not incident to a cut hyperedge (all other benefit terms are zero). The remaining k - 1
+ * entries are written on the first access of the node (either a gain query or a delta gain update).
+ * Thus, the initialization costs scale with the number of border nodes instead of |V| * k.
 */
 class Km1GainCache {
 
@@ -75,18 +82,27 @@ class Km1GainCache {
   static constexpr bool requires_notification_before_update = false;
   static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = false;
   static constexpr bool invalidates_entries = true;
+  static constexpr bool supports_batched_updates = true;
 
   Km1GainCache() :
     _is_initialized(false),
+    _lazy_initialization(false),
     _k(kInvalidPartition),
     _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _lazy_block(),
+    _dummy_adjacent_blocks(),
+    _ets_benefit_aggregator() { }
 
-  Km1GainCache(const Context&) :
+  Km1GainCache(const Context& context) :
     _is_initialized(false),
+    // The uncontraction updates of the n-level partitioner do not support lazy entries
+    _lazy_initialization(context.refinement.lazy_gain_cache_initialization &&
+      !context.isNLevelPartitioning()),
     _k(),
     _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _lazy_block(),
+    _dummy_adjacent_blocks(),
+    _ets_benefit_aggregator() { }
 
   Km1GainCache(const Km1GainCache&) = delete;
   Km1GainCache & operator= (const Km1GainCache &) = delete;
@@ -139,6 +155,7 @@ class Km1GainCache {
   HyperedgeWeight penaltyTerm(const HypernodeID u,
                               const PartitionID /* only relevant for graphs */) const {
     ASSERT(_is_initialized, "Gain cache is not initialized");
+    ensureEntryIsWritten(u);
     return _gain_cache[penalty_index(u)].load(std::memory_order_relaxed);
   }
 
@@ -148,15 +165,31 @@ class Km1GainCache {
   void recomputeInvalidTerms(const PartitionedHypergraph& partitioned_hg,
                              const HypernodeID u) {
     ASSERT(_is_initialized, "Gain cache is not initialized");
+    ensureEntryIsWritten(u);
     _gain_cache[penalty_index(u)].store(recomputePenaltyTerm(
       partitioned_hg, u), std::memory_order_relaxed);
   }
 
+  // ! Recomputes all gain cache entries of node u from scratch. Used to apply a batch of
+  // ! moves without delta gain updates (see batched_gain_cache_update.h).
+  template<typename PartitionedHypergraph>
+  void recomputeGainCacheEntry(const PartitionedHypergraph& partitioned_hg,
+                               const HypernodeID u) {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    ensureEntryIsWritten(u);
+    vec<Gain>& benefit_aggregator = _ets_benefit_aggregator.local();
+    if ( benefit_aggregator.size() < static_cast<size_t>(_k) ) {
+      benefit_aggregator.assign(_k, 0);
+    }
+    initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator);
+  }
+
   // ! Returns the benefit term for moving node u to block to.
   // ! More formally, b(u, V_j) := w({ e \in I(u) | pin_count(e, V_j) >= 1 })
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
     ASSERT(_is_initialized, "Gain cache is not initialized");
+    ensureEntryIsWritten(u);
     return _gain_cache[benefit_index(u, to)].load(std::memory_order_relaxed);
   }
 
@@ -276,6 +309,40 @@ class Km1GainCache {
  private:
   friend class DeltaKm1GainCache;
 
+  // ! Marks a node whose gain cache entries are completely written
+  static constexpr PartitionID ENTRY_IS_WRITTEN = kInvalidPartition;
+  // ! Marks a node whose gain cache entries are currently written by another thread
+  static constexpr PartitionID ENTRY_IS_LOCKED = kInvalidPartition - 1;
+
+  // ! Writes the remaining gain cache entries of a lazily initialized node
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void ensureEntryIsWritten(const HypernodeID u) const {
+    if ( _lazy_initialization ) {
+      const PartitionID block = _lazy_block[u].load(std::memory_order_acquire);
+      if ( block != ENTRY_IS_WRITTEN ) {
+        writeLazyEntry(u, block);
+      }
+    }
+  }
+
+  void writeLazyEntry(const HypernodeID u, PartitionID block) const {
+    while ( block != ENTRY_IS_WRITTEN ) {
+      if ( block == ENTRY_IS_LOCKED ) {
+        // Another thread writes the entries of the node
+        block = _lazy_block[u].load(std::memory_order_acquire);
+      } else if ( _lazy_block[u].compare_exchange_strong(block, ENTRY_IS_LOCKED,
+                    std::memory_order_acquire) ) {
+        // The penalty term and benefit term of the block of the node are already written
+        for ( PartitionID p = 0; p < _k; ++p ) {
+          if ( p != block ) {
+            _gain_cache[benefit_index(u, p)].store(0, std::memory_order_relaxed);
+          }
+        }
+        _lazy_block[u].store(ENTRY_IS_WRITTEN, std::memory_order_release);
+        block = ENTRY_IS_WRITTEN;
+      }
+    }
+  }
+
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   size_t penalty_index(const HypernodeID u) const {
     return size_t(u) * ( _k + 1 );
@@ -295,6 +362,9 @@ class Km1GainCache {
       _gain_cache.resize(
         "Refinement", "gain_cache", num_nodes * size_t(_k + 1), true);
     }
+    if ( _lazy_initialization && _lazy_block.size() == 0 ) {
+      _lazy_block.resize("Refinement", "lazy_gain_cache_entries", num_nodes, true);
+    }
   }
 
   // ! Initializes the benefit and penalty terms for a node u
@@ -304,6 +374,13 @@ class Km1GainCache {
                                        const HypernodeID u,
                                        vec<Gain>& benefit_aggregator);
 
+  // ! Initializes the penalty term and the benefit term of the block of node u if u is
+  // ! not incident to a cut hyperedge. Returns false, if u is incident to a cut hyperedge.
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  bool initializeLazyGainCacheEntryForNode(const PartitionedHypergraph& partitioned_hg,
+                                           const HypernodeID u);
+
   bool nodeGainAssertions(const HypernodeID u, const PartitionID p) const {
     if ( p == kInvalidPartition || p >= _k ) {
       LOG << "Invalid block ID (Node" << u << "is part of block" << p
@@ -323,14 +400,24 @@ class Km1GainCache {
   // ! Indicate whether or not the gain cache is initialized
   bool _is_initialized;
 
+  // ! Indicates whether or not the entries of nodes not incident to a cut hyperedge are written lazily
+  bool _lazy_initialization;
+
   // ! Number of blocks
   PartitionID _k;
 
   // ! Array of size |V| * (k + 1), which stores the benefit and penalty terms of each node.
-  ds::Array< CAtomic<HyperedgeWeight> > _gain_cache;
+  // ! (mutable, since lazy entries are written on the first gain query)
+  mutable ds::Array< CAtomic<HyperedgeWeight> > _gain_cache;
+
+  // ! Stores for each lazily initialized node its block (or ENTRY_IS_WRITTEN)
+  mutable ds::Array< CAtomic<PartitionID> > _lazy_block;
 
   // ! Provides an iterator from 0 to k (:= number of blocks)
   IntegerRangeIterator<PartitionID> _dummy_adjacent_blocks;
+
+  // ! Thread-local buffers to aggregate the benefit terms of a node
+  tbb::enumerable_thread_specific<vec<Gain>> _ets_benefit_aggregator;
 };
 
 /**
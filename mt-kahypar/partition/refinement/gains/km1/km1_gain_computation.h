@@ -32,6 +32,7 @@
 #include "mt-kahypar/partition/refinement/gains/km1/km1_attributed_gains.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/prefetch.h"
 
 namespace mt_kahypar {
 
@@ -42,6 +43,8 @@ class Km1GainComputation : public GainComputationBase<Km1GainComputation, Km1Att
 
  public:
   using RatingMap = typename Base::RatingMap;
+  // ! The gain contributions of the incident nets can be aggregated in parallel
+  static constexpr bool supports_parallel_gain_aggregation = true;
 
   Km1GainComputation(const Context& context,
                      bool disable_randomization = false) :
@@ -52,31 +55,60 @@ class Km1GainComputation : public GainComputationBase<Km1GainComputation, Km1Att
   // ! and the gain to all adjacent blocks assuming the node is in an isolated block.
   // ! The gain of that node to a block to can then be computed by
   // ! 'isolated_block_gain - tmp_scores[to]' (see gain(...))
-  template<typename PartitionedHypergraph>
+  template<typename PartitionedHypergraph, typename Scores>
   void precomputeGains(const PartitionedHypergraph& phg,
                        const HypernodeID hn,
-                       RatingMap& tmp_scores,
+                       Scores& tmp_scores,
                        Gain& isolated_block_gain,
                        const bool) {
     ASSERT(tmp_scores.size() == 0, "Rating map not empty");
     PartitionID from = phg.partID(hn);
-    for (const HyperedgeID& he : phg.incidentEdges(hn)) {
-      HypernodeID pin_count_in_from_part = phg.pinCountInPart(he, from);
-      HyperedgeWeight he_weight = phg.edgeWeight(he);
-
-      // In case, there is more one than one pin left in from part, we would
-      // increase the connectivity, if we would move the pin to one block
-      // no contained in the connectivity set. In such cases, we can only
-      // increase the connectivity of a hyperedge and therefore gather
-      // the edge weight of all those edges and add it later to move gain
-      // to all other blocks.
-      if ( pin_count_in_from_part > 1 ) {
-        isolated_block_gain += he_weight;
-      }
+    auto prefetch_pin_counts = [&](const HyperedgeID& he) {
+      phg.prefetchPinCounts(he);
+    };
+    if ( phg.k() == 2 ) {
+      utils::forEachWithLookahead(phg.incidentEdges(hn), prefetch_pin_counts, [&](const HyperedgeID& he) {
+        precomputeGainOfIncidentEdge<true>(phg, from, he, tmp_scores, isolated_block_gain);
+      });
+    } else {
+      utils::forEachWithLookahead(phg.incidentEdges(hn), prefetch_pin_counts, [&](const HyperedgeID& he) {
+        precomputeGainOfIncidentEdge<false>(phg, from, he, tmp_scores, isolated_block_gain);
+      });
+    }
+  }
+
+  // ! Adds the contribution of incident edge he to the precomputed gains (see precomputeGains(...)).
+  // ! The contributions of the incident edges are independent of each other.
+  // ! For bipartitions, the only block besides from is 1 - from, which replaces the
+  // ! iteration over the connectivity set with a single pin count lookup.
+  template<bool is_bipartition = false, typename PartitionedHypergraph, typename Scores>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void precomputeGainOfIncidentEdge(const PartitionedHypergraph& phg,
+                                                                      const PartitionID from,
+                                                                      const HyperedgeID he,
+                                                                      Scores& tmp_scores,
+                                                                      Gain& isolated_block_gain) {
+    HypernodeID pin_count_in_from_part = phg.pinCountInPart(he, from);
+    HyperedgeWeight he_weight = phg.edgeWeight(he);
 
-      // Substract edge weight of all incident blocks.
-      // Note, in case the pin count in from part is greater than one
-      // we will later add that edge weight to the gain (see internal_weight).
+    // In case, there is more one than one pin left in from part, we would
+    // increase the connectivity, if we would move the pin to one block
+    // no contained in the connectivity set. In such cases, we can only
+    // increase the connectivity of a hyperedge and therefore gather
+    // the edge weight of all those edges and add it later to move gain
+    // to all other blocks.
+    if ( pin_count_in_from_part > 1 ) {
+      isolated_block_gain += he_weight;
+    }
+
+    // Substract edge weight of all incident blocks.
+    // Note, in case the pin count in from part is greater than one
+    // we will later add that edge weight to the gain (see internal_weight).
+    if constexpr ( is_bipartition ) {
+      const PartitionID to = 1 - from;
+      if ( phg.pinCountInPart(he, to) > 0 ) {
+        tmp_scores[to] += he_weight;
+      }
+    } else {
       for (const PartitionID& to : phg.connectivitySet(he)) {
         if (from != to) {
           tmp_scores[to] += he_weight;
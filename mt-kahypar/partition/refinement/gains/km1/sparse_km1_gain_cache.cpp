@@ -0,0 +1,393 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
+
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/concurrent_vector.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+
+namespace mt_kahypar {
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::allocateGainTable(const PartitionedHypergraph& partitioned_hg) {
+  const HypernodeID num_nodes = partitioned_hg.initialNumNodes();
+  if ( _k == kInvalidPartition ) {
+    _k = partitioned_hg.k();
+    const HypernodeID top_level_num_nodes = partitioned_hg.topLevelNumNodes();
+    _offsets.resize("Refinement", "sparse_gain_cache_offsets", top_level_num_nodes + 1);
+    _penalties.resize("Refinement", "sparse_gain_cache_penalties", top_level_num_nodes, true);
+    _node_locks.resize(top_level_num_nodes);
+    _has_overflow_entries.resize(top_level_num_nodes);
+  }
+  _num_blocks = partitioned_hg.k();
+  ASSERT(num_nodes + 1 <= _offsets.size());
+
+  // Compute the number of slots of each node. The number of blocks adjacent to a node
+  // is bounded by the sum of the sizes of its incident hyperedges. During n-level uncoarsening,
+  // nodes and hyperedges change over time. We therefore store all benefit terms densely in that case.
+  const PartitionID num_dense_slots = numDenseSlots(_k);
+  _offsets[0] = 0;
+  tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID u) {
+    PartitionID num_slots = num_dense_slots;
+    if constexpr ( PartitionedHypergraph::is_static_hypergraph ) {
+      size_t max_adjacent_blocks = 0;
+      for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u) ) {
+        max_adjacent_blocks += partitioned_hg.edgeSize(he);
+        if ( max_adjacent_blocks >= static_cast<size_t>(_k) ) {
+          break;
+        }
+      }
+      max_adjacent_blocks = std::min(max_adjacent_blocks, static_cast<size_t>(_k));
+      if ( max_adjacent_blocks > 0 ) {
+        // Hash table with a load factor of at most 0.5
+        size_t num_hash_table_slots = 1;
+        while ( num_hash_table_slots < 2 * max_adjacent_blocks ) {
+          num_hash_table_slots <<= 1;
+        }
+        if ( num_hash_table_slots < static_cast<size_t>(num_dense_slots) ) {
+          num_slots = num_hash_table_slots;
+        }
+      } else {
+        num_slots = 0;
+      }
+    }
+    _offsets[u + 1] = num_slots;
+    _has_overflow_entries[u].store(false, std::memory_order_relaxed);
+  });
+  parallel_prefix_sum(_offsets.data() + 1, _offsets.data() + num_nodes + 1,
+    _offsets.data() + 1, std::plus<size_t>(), UL(0));
+
+  const size_t num_entries = _offsets[num_nodes];
+  if ( num_entries > _entries.size() ) {
+    _entries = ds::Array< CAtomic<Entry> >();
+    _entries.resize(num_entries);
+  }
+  _overflow_table.clear();
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::initializeGainCache(const PartitionedHypergraph& partitioned_hg) {
+  ASSERT(!_is_initialized, "Gain cache is already initialized");
+  ASSERT(_k <= 0 || _k >= partitioned_hg.k(),
+    "Gain cache was already initialized for a different k" << V(_k) << V(partitioned_hg.k()));
+  allocateGainTable(partitioned_hg);
+
+  // Gain calculation consist of two stages
+  //  1. Compute gain of all low degree vertices
+  //  2. Compute gain of all high degree vertices
+  tbb::enumerable_thread_specific< vec<HyperedgeWeight> > ets_mtb(_k, 0);
+  tbb::enumerable_thread_specific< vec<PartitionID> > ets_adjacent_blocks;
+  tbb::concurrent_vector<HypernodeID> high_degree_vertices;
+  // Compute gain of all low degree vertices
+  tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), partitioned_hg.initialNumNodes()),
+    [&](tbb::blocked_range<HypernodeID>& r) {
+      vec<HyperedgeWeight>& benefit_aggregator = ets_mtb.local();
+      vec<PartitionID>& adjacent_blocks = ets_adjacent_blocks.local();
+      for (HypernodeID u = r.begin(); u < r.end(); ++u) {
+        if ( partitioned_hg.nodeIsEnabled(u)) {
+          if ( partitioned_hg.nodeDegree(u) <= HIGH_DEGREE_THRESHOLD) {
+            const PartitionID from = partitioned_hg.partID(u);
+            HyperedgeWeight penalty = 0;
+            for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+              const HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+              if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
+                penalty += ew;
+              }
+              for (const PartitionID& i : partitioned_hg.connectivitySet(e)) {
+                if ( benefit_aggregator[i] == 0 ) {
+                  adjacent_blocks.push_back(i);
+                }
+                benefit_aggregator[i] += ew;
+              }
+            }
+            _penalties[u].store(penalty, std::memory_order_relaxed);
+            storeBenefitTerms(u, benefit_aggregator, adjacent_blocks);
+            for ( const PartitionID& i : adjacent_blocks ) {
+              benefit_aggregator[i] = 0;
+            }
+            adjacent_blocks.clear();
+          } else {
+            // Collect high degree vertices
+            high_degree_vertices.push_back(u);
+          }
+        } else {
+          _penalties[u].store(0, std::memory_order_relaxed);
+          storeBenefitTerms(u, benefit_aggregator, adjacent_blocks);
+        }
+      }
+    });
+
+  // Compute gain of all high degree vertices
+  vec<HyperedgeWeight> benefits(_k, 0);
+  vec<PartitionID> adjacent_blocks;
+  for ( const HypernodeID& u : high_degree_vertices ) {
+    tbb::enumerable_thread_specific<HyperedgeWeight> ets_mfp(0);
+    const PartitionID from = partitioned_hg.partID(u);
+    const HypernodeID degree_of_u = partitioned_hg.nodeDegree(u);
+    tbb::parallel_for(tbb::blocked_range<HypernodeID>(ID(0), degree_of_u),
+      [&](tbb::blocked_range<HypernodeID>& r) {
+      vec<HyperedgeWeight>& benefit_aggregator = ets_mtb.local();
+      HyperedgeWeight& penalty_aggregator = ets_mfp.local();
+      size_t current_pos = r.begin();
+      for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u, r.begin()) ) {
+        const HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
+        if (partitioned_hg.pinCountInPart(he, from) > 1) {
+          penalty_aggregator += edge_weight;
+        }
+        for (const PartitionID block : partitioned_hg.connectivitySet(he)) {
+          benefit_aggregator[block] += edge_weight;
+        }
+        ++current_pos;
+        if ( current_pos == r.end() ) {
+          break;
+        }
+      }
+    });
+
+    // Aggregate thread locals to compute overall gain of the high degree vertex
+    _penalties[u].store(ets_mfp.combine(std::plus<HyperedgeWeight>()), std::memory_order_relaxed);
+    for (PartitionID p = 0; p < _k; ++p) {
+      for ( auto& l_move_to_benefit : ets_mtb ) {
+        benefits[p] += l_move_to_benefit[p];
+        l_move_to_benefit[p] = 0;
+      }
+      if ( benefits[p] != 0 ) {
+        adjacent_blocks.push_back(p);
+      }
+    }
+    storeBenefitTerms(u, benefits, adjacent_blocks);
+    for ( const PartitionID& p : adjacent_blocks ) {
+      benefits[p] = 0;
+    }
+    adjacent_blocks.clear();
+  }
+
+  _is_initialized = true;
+}
+
+void SparseKm1GainCache::storeBenefitTerms(const HypernodeID u,
+                                           const vec<HyperedgeWeight>& benefits,
+                                           const vec<PartitionID>& adjacent_blocks) {
+  const size_t begin = _offsets[u];
+  const size_t end = _offsets[u + 1];
+  if ( isDense(u) ) {
+    for ( PartitionID p = 0; p < _k; p += 2 ) {
+      const HyperedgeWeight upper = p + 1 < _k ? benefits[p + 1] : 0;
+      _entries[begin + p / 2].store(( static_cast<Entry>(static_cast<uint32_t>(upper)) << 32 ) |
+        static_cast<Entry>(static_cast<uint32_t>(benefits[p])), std::memory_order_relaxed);
+    }
+  } else {
+    for ( size_t pos = begin; pos < end; ++pos ) {
+      _entries[pos].store(makeEntry(EMPTY_BLOCK, 0), std::memory_order_relaxed);
+    }
+    const size_t num_slots = end - begin;
+    for ( const PartitionID& p : adjacent_blocks ) {
+      if ( benefits[p] != 0 ) {
+        ASSERT(num_slots >= 2 * adjacent_blocks.size());
+        size_t pos = hash(p) & ( num_slots - 1 );
+        while ( blockOf(_entries[begin + pos].load(std::memory_order_relaxed)) != EMPTY_BLOCK ) {
+          pos = ( pos + 1 ) & ( num_slots - 1 );
+        }
+        _entries[begin + pos].store(makeEntry(p, benefits[p]), std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+void SparseKm1GainCache::addToBenefitTerm(const HypernodeID u,
+                                          const PartitionID block,
+                                          const HyperedgeWeight delta) {
+  ASSERT(block != kInvalidPartition && block < _k);
+  if ( delta == 0 ) {
+    return;
+  }
+
+  if ( isDense(u) ) {
+    CAtomic<Entry>& slot = _entries[_offsets[u] + block / 2];
+    Entry entry = slot.load(std::memory_order_relaxed);
+    while ( !slot.compare_exchange_weak(entry,
+      addToDenseEntry(entry, block, delta), std::memory_order_relaxed) ) { }
+    return;
+  }
+
+  // Lock-free update, if the hash table already contains the block
+  size_t pos = findSlot(u, block);
+  while ( pos != INVALID_SLOT ) {
+    if ( tryAddToEntry(pos, block, delta) ) {
+      return;
+    }
+    // Entry was removed concurrently
+    pos = findSlot(u, block);
+  }
+
+  // Insert new entry. Only one thread can insert entries into
+  // the hash table of a node at a time.
+  _node_locks[u].lock();
+  const size_t num_slots = numSlots(u);
+  const size_t begin = _offsets[u];
+  size_t insert_pos = INVALID_SLOT;
+  bool found = false;
+  pos = hash(block) & ( num_slots - 1 );
+  for ( size_t i = 0; i < num_slots && !found; ++i ) {
+    const PartitionID stored_block = blockOf(_entries[begin + pos].load(std::memory_order_relaxed));
+    if ( stored_block == block ) {
+      found = tryAddToEntry(begin + pos, block, delta);
+    } else if ( stored_block == DELETED_BLOCK || stored_block == EMPTY_BLOCK ) {
+      if ( insert_pos == INVALID_SLOT ) {
+        insert_pos = begin + pos;
+      }
+      if ( stored_block == EMPTY_BLOCK ) {
+        break;
+      }
+    }
+    pos = ( pos + 1 ) & ( num_slots - 1 );
+  }
+
+  if ( !found ) {
+    if ( insert_pos != INVALID_SLOT ) {
+      // Deleted and empty slots are only modified by the thread holding the lock
+      _entries[insert_pos].store(makeEntry(block, delta), std::memory_order_relaxed);
+    } else {
+      _has_overflow_entries[u].store(true, std::memory_order_relaxed);
+      OverflowTable::accessor acc;
+      _overflow_table.insert(acc, overflow_key(u, block));
+      acc->second += delta;
+    }
+  }
+  _node_locks[u].unlock();
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
+                                         const SynchronizedEdgeUpdate& sync_update) {
+  ASSERT(_is_initialized, "Gain cache is not initialized");
+  const HyperedgeID he = sync_update.he;
+  const PartitionID from = sync_update.from;
+  const PartitionID to = sync_update.to;
+  const HyperedgeWeight edge_weight = sync_update.edge_weight;
+  const HypernodeID pin_count_in_from_part_after = sync_update.pin_count_in_from_part_after;
+  const HypernodeID pin_count_in_to_part_after = sync_update.pin_count_in_to_part_after;
+  if ( pin_count_in_from_part_after == 1 ) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      if (partitioned_hg.partID(u) == from) {
+        _penalties[u].fetch_sub(edge_weight, std::memory_order_relaxed);
+      }
+    }
+  } else if (pin_count_in_from_part_after == 0) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      addToBenefitTerm(u, from, -edge_weight);
+    }
+  }
+
+  if (pin_count_in_to_part_after == 1) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      addToBenefitTerm(u, to, edge_weight);
+    }
+  } else if (pin_count_in_to_part_after == 2) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      if (partitioned_hg.partID(u) == to) {
+        _penalties[u].fetch_add(edge_weight, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::uncontractUpdateAfterRestore(const PartitionedHypergraph& partitioned_hg,
+                                                      const HypernodeID u,
+                                                      const HypernodeID v,
+                                                      const HyperedgeID he,
+                                                      const HypernodeID pin_count_in_part_after) {
+  if ( _is_initialized ) {
+    // See Km1GainCache::uncontractUpdateAfterRestore(...)
+    const PartitionID block = partitioned_hg.partID(u);
+    const HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
+    if ( pin_count_in_part_after == 2 ) {
+      for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+        if ( pin != v && partitioned_hg.partID(pin) == block ) {
+          _penalties[pin].add_fetch(edge_weight, std::memory_order_relaxed);
+          break;
+        }
+      }
+    }
+
+    _penalties[v].add_fetch(edge_weight, std::memory_order_relaxed);
+    for ( const PartitionID block : partitioned_hg.connectivitySet(he) ) {
+      addToBenefitTerm(v, block, edge_weight);
+    }
+  }
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::uncontractUpdateAfterReplacement(const PartitionedHypergraph& partitioned_hg,
+                                                          const HypernodeID u,
+                                                          const HypernodeID v,
+                                                          const HyperedgeID he) {
+  if ( _is_initialized ) {
+    // See Km1GainCache::uncontractUpdateAfterReplacement(...)
+    const PartitionID block = partitioned_hg.partID(u);
+    const HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
+    if ( partitioned_hg.pinCountInPart(he, block) == 1 ) {
+      _penalties[u].add_fetch(edge_weight, std::memory_order_relaxed);
+      _penalties[v].sub_fetch(edge_weight, std::memory_order_relaxed);
+    }
+
+    _penalties[u].sub_fetch(edge_weight, std::memory_order_relaxed);
+    _penalties[v].add_fetch(edge_weight, std::memory_order_relaxed);
+    for ( const PartitionID block : partitioned_hg.connectivitySet(he) ) {
+      addToBenefitTerm(u, block, -edge_weight);
+      addToBenefitTerm(v, block, edge_weight);
+    }
+  }
+}
+
+namespace {
+#define SPARSE_KM1_INITIALIZE_GAIN_CACHE(X) void SparseKm1GainCache::initializeGainCache(const X&)
+#define SPARSE_KM1_ALLOCATE_GAIN_TABLE(X) void SparseKm1GainCache::allocateGainTable(const X&)
+#define SPARSE_KM1_DELTA_GAIN_UPDATE(X) void SparseKm1GainCache::deltaGainUpdate(const X&,                     \
+                                                                                const SynchronizedEdgeUpdate&)
+#define SPARSE_KM1_RESTORE_UPDATE(X) void SparseKm1GainCache::uncontractUpdateAfterRestore(const X&,          \
+                                                                                          const HypernodeID, \
+                                                                                          const HypernodeID, \
+                                                                                          const HyperedgeID, \
+                                                                                          const HypernodeID)
+#define SPARSE_KM1_REPLACEMENT_UPDATE(X) void SparseKm1GainCache::uncontractUpdateAfterReplacement(const X&,            \
+                                                                                                  const HypernodeID,   \
+                                                                                                  const HypernodeID,   \
+                                                                                                  const HyperedgeID)
+}
+
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_INITIALIZE_GAIN_CACHE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_ALLOCATE_GAIN_TABLE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_DELTA_GAIN_UPDATE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_RESTORE_UPDATE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_REPLACEMENT_UPDATE)
+
+}  // namespace mt_kahypar
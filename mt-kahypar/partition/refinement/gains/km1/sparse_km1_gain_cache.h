@@ -0,0 +1,702 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <iterator>
+
+#include <tbb/concurrent_hash_map.h>
+
+#include "kahypar-resources/meta/policy_registry.h"
+
+#include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/partition/refinement/gains/km1/km1_gain_cache.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/datastructures/synchronized_edge_update.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/range.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+/**
+ * Gain cache for the connectivity metric that only stores the benefit terms of adjacent blocks.
+ *
+ * The gain values are defined exactly as in the Km1GainCache (g(u, V_j) = b(u, V_j) - p(u)).
+ * However, the dense gain cache stores k + 1 entries per node, which does not fit into
+ * memory for large k and large hypergraphs. Since b(u, V_j) = 0 for all blocks V_j not adjacent
+ * to u, it is sufficient to store the benefit terms of the adjacent blocks. The number of blocks
+ * adjacent to u is bounded by the sum of the sizes of its incident hyperedges. We therefore assign
+ * each node a region of 2^ceil(log2(2 * min(k, \sum_{e \in I(u)} |e|))) slots which we use as an
+ * open-addressing hash table (linear probing). Each slot stores a block ID and its benefit term
+ * in one 64-bit word such that updates of existing entries are lock-free. Entries are removed
+ * when their benefit term becomes zero, and new entries are only inserted while holding a per-node
+ * lock. If the hash table of a node would be larger than a dense representation, we store the
+ * benefit terms of that node densely (two 32-bit benefit terms per slot).
+ *
+ * The blocks stored in the hash table of a node are exactly its adjacent blocks. Thus, the gain cache
+ * also provides blockIsAdjacent(...) and adjacentBlocks(...), which allows the FM algorithm to only
+ * evaluate moves to adjacent blocks. In the rare case that the hash table of a node overflows (can
+ * only happen temporarily due to concurrent delta gain updates), the remaining benefit terms are
+ * stored in a global concurrent hash table and all blocks are reported as adjacent to the node.
+*/
+class SparseKm1GainCache {
+
+  static constexpr HyperedgeID HIGH_DEGREE_THRESHOLD = ID(100000);
+
+  using Entry = uint64_t;
+  using OverflowTable = tbb::concurrent_hash_map<size_t, HyperedgeWeight>;
+
+  static_assert(sizeof(PartitionID) == 4 && sizeof(HyperedgeWeight) == 4,
+    "Sparse gain cache packs a block ID and a benefit term into a 64-bit word");
+
+  static constexpr PartitionID EMPTY_BLOCK = kInvalidPartition;
+  static constexpr PartitionID DELETED_BLOCK = kInvalidPartition - 1;
+
+ public:
+
+  // ! Iterates over all blocks with a non-zero benefit term of a node
+  class AdjacentBlocksIterator {
+
+    enum class Mode : uint8_t {
+      sparse,
+      dense,
+      all_blocks
+    };
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PartitionID;
+    using reference = PartitionID;
+    using pointer = const PartitionID*;
+    using difference_type = std::ptrdiff_t;
+
+    // ! Iterates over all slots of the hash table of a node
+    static AdjacentBlocksIterator sparse(const CAtomic<Entry>* entries,
+                                         const PartitionID num_slots,
+                                         const bool end) {
+      return AdjacentBlocksIterator(Mode::sparse, entries, num_slots, end);
+    }
+
+    // ! Iterates over the densely stored benefit terms of a node
+    static AdjacentBlocksIterator dense(const CAtomic<Entry>* entries,
+                                        const PartitionID k,
+                                        const bool end) {
+      return AdjacentBlocksIterator(Mode::dense, entries, k, end);
+    }
+
+    // ! Iterates over all blocks
+    static AdjacentBlocksIterator allBlocks(const PartitionID k, const bool end) {
+      return AdjacentBlocksIterator(Mode::all_blocks, nullptr, k, end);
+    }
+
+    PartitionID operator*() const {
+      return _block;
+    }
+
+    AdjacentBlocksIterator& operator++() {
+      ++_pos;
+      skipEmptyEntries();
+      return *this;
+    }
+
+    AdjacentBlocksIterator operator++(int) {
+      AdjacentBlocksIterator copy = *this;
+      operator++();
+      return copy;
+    }
+
+    bool operator==(const AdjacentBlocksIterator& other) const {
+      return _pos == other._pos && _entries == other._entries;
+    }
+
+    bool operator!=(const AdjacentBlocksIterator& other) const {
+      return !operator==(other);
+    }
+
+   private:
+    AdjacentBlocksIterator(const Mode mode,
+                           const CAtomic<Entry>* entries,
+                           const PartitionID size,
+                           const bool end) :
+      _mode(mode),
+      _entries(entries),
+      _pos(end ? size : 0),
+      _size(size),
+      _block(kInvalidPartition) {
+      skipEmptyEntries();
+    }
+
+    void skipEmptyEntries() {
+      for ( ; _pos < _size; ++_pos ) {
+        if ( _mode == Mode::all_blocks ) {
+          _block = _pos;
+          return;
+        } else if ( _mode == Mode::dense ) {
+          if ( denseBenefitOf(_entries[_pos / 2].load(std::memory_order_relaxed), _pos) != 0 ) {
+            _block = _pos;
+            return;
+          }
+        } else {
+          const Entry entry = _entries[_pos].load(std::memory_order_relaxed);
+          if ( blockOf(entry) >= 0 && benefitOf(entry) != 0 ) {
+            _block = blockOf(entry);
+            return;
+          }
+        }
+      }
+      _block = kInvalidPartition;
+    }
+
+    Mode _mode;
+    const CAtomic<Entry>* _entries;
+    PartitionID _pos;
+    PartitionID _size;
+    PartitionID _block;
+  };
+
+  static constexpr GainPolicy TYPE = GainPolicy::km1_sparse;
+  static constexpr bool requires_notification_before_update = false;
+  static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = false;
+  static constexpr bool invalidates_entries = true;
+  static constexpr bool supports_batched_updates = false;
+
+  SparseKm1GainCache() :
+    _is_initialized(false),
+    _k(kInvalidPartition),
+    _num_blocks(kInvalidPartition),
+    _offsets(),
+    _penalties(),
+    _entries(),
+    _node_locks(),
+    _has_overflow_entries(),
+    _overflow_table() { }
+
+  SparseKm1GainCache(const Context&) :
+    SparseKm1GainCache() { }
+
+  SparseKm1GainCache(const SparseKm1GainCache&) = delete;
+  SparseKm1GainCache & operator= (const SparseKm1GainCache &) = delete;
+
+  SparseKm1GainCache(SparseKm1GainCache&& other) = default;
+  SparseKm1GainCache & operator= (SparseKm1GainCache&& other) = default;
+
+  // ####################### Initialization #######################
+
+  bool isInitialized() const {
+    return _is_initialized;
+  }
+
+  void reset(const bool run_parallel = true) {
+    unused(run_parallel);
+    _is_initialized = false;
+  }
+
+  size_t size() const {
+    return _entries.size();
+  }
+
+  // ! Initializes all gain cache entries
+  template<typename PartitionedHypergraph>
+  void initializeGainCache(const PartitionedHypergraph& partitioned_hg);
+
+  template<typename PartitionedHypergraph>
+  void initializeGainCacheEntryForNode(const PartitionedHypergraph&,
+                                       const HypernodeID&) {
+    // Do nothing
+  }
+
+  // ! Returns whether the block is adjacent to the node
+  bool blockIsAdjacent(const HypernodeID u, const PartitionID block) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    return hasOverflowEntries(u) || benefitTerm(u, block) != 0;
+  }
+
+  // ! Returns an iterator over the adjacent blocks of a node
+  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID u) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    if ( hasOverflowEntries(u) ) {
+      return IteratorRange<AdjacentBlocksIterator>(
+        AdjacentBlocksIterator::allBlocks(_num_blocks, false),
+        AdjacentBlocksIterator::allBlocks(_num_blocks, true));
+    }
+
+    const CAtomic<Entry>* entries = _entries.data() + _offsets[u];
+    if ( isDense(u) ) {
+      return IteratorRange<AdjacentBlocksIterator>(
+        AdjacentBlocksIterator::dense(entries, _num_blocks, false),
+        AdjacentBlocksIterator::dense(entries, _num_blocks, true));
+    } else {
+      return IteratorRange<AdjacentBlocksIterator>(
+        AdjacentBlocksIterator::sparse(entries, numSlots(u), false),
+        AdjacentBlocksIterator::sparse(entries, numSlots(u), true));
+    }
+  }
+
+  // ####################### Gain Computation #######################
+
+  // ! Returns the penalty term of node u.
+  // ! More formally, p(u) := w({ e \in I(u) | pin_count(e, V_i) > 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight penaltyTerm(const HypernodeID u,
+                              const PartitionID /* only relevant for graphs */) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    return _penalties[u].load(std::memory_order_relaxed);
+  }
+
+  // ! Recomputes the penalty term entry in the gain cache
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void recomputeInvalidTerms(const PartitionedHypergraph& partitioned_hg,
+                             const HypernodeID u) {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    _penalties[u].store(recomputePenaltyTerm(partitioned_hg, u), std::memory_order_relaxed);
+  }
+
+  // ! Returns the benefit term for moving node u to block to.
+  // ! More formally, b(u, V_j) := w({ e \in I(u) | pin_count(e, V_j) >= 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    ASSERT(to != kInvalidPartition && to < _k);
+    HyperedgeWeight benefit = 0;
+    if ( isDense(u) ) {
+      benefit = denseBenefitOf(_entries[_offsets[u] + to / 2].load(std::memory_order_relaxed), to);
+    } else {
+      const size_t pos = findSlot(u, to);
+      if ( pos != INVALID_SLOT ) {
+        benefit = benefitOf(_entries[pos].load(std::memory_order_relaxed));
+      }
+    }
+    if ( hasOverflowEntries(u) ) {
+      OverflowTable::const_accessor acc;
+      if ( _overflow_table.find(acc, overflow_key(u, to)) ) {
+        benefit += acc->second;
+      }
+    }
+    return benefit;
+  }
+
+  // ! Returns the gain of moving node u from its current block to a target block V_j.
+  // ! More formally, g(u, V_j) := b(u, V_j) - p(u).
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight gain(const HypernodeID u,
+                       const PartitionID, /* only relevant for graphs */
+                       const PartitionID to ) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    return benefitTerm(u, to) - penaltyTerm(u, kInvalidPartition);
+  }
+
+  // ####################### Delta Gain Update #######################
+
+  // ! This function returns true if the corresponding syncronized edge update triggers
+  // ! a gain cache update.
+  static bool triggersDeltaGainUpdate(const SynchronizedEdgeUpdate& sync_update) {
+    return Km1GainCache::triggersDeltaGainUpdate(sync_update);
+  }
+
+  // ! The partitioned (hyper)graph call this function when its updates its internal
+  // ! data structures before calling the delta gain update function. The partitioned
+  // ! (hyper)graph holds a lock for the corresponding (hyper)edge when calling this
+  // ! function. Thus, it is guaranteed that no other thread will modify the hyperedge.
+  template<typename PartitionedHypergraph>
+  void notifyBeforeDeltaGainUpdate(const PartitionedHypergraph&, const SynchronizedEdgeUpdate&) {
+    // Do nothing
+  }
+
+  // ! This functions implements the delta gain updates for the connecitivity metric
+  // ! (see Km1GainCache::deltaGainUpdate(...)).
+  template<typename PartitionedHypergraph>
+  void deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
+                       const SynchronizedEdgeUpdate& sync_update);
+
+  // ####################### Uncontraction #######################
+
+  // ! This function implements the gain cache update after an uncontraction that restores node v in
+  // ! hyperedge he. After the uncontraction operation, node u and v are contained in hyperedge he.
+  template<typename PartitionedHypergraph>
+  void uncontractUpdateAfterRestore(const PartitionedHypergraph& partitioned_hg,
+                                    const HypernodeID u,
+                                    const HypernodeID v,
+                                    const HyperedgeID he,
+                                    const HypernodeID pin_count_in_part_after);
+
+  // ! This function implements the gain cache update after an uncontraction that replaces u with v in
+  // ! hyperedge he. After the uncontraction only node v is contained in hyperedge he.
+  template<typename PartitionedHypergraph>
+  void uncontractUpdateAfterReplacement(const PartitionedHypergraph& partitioned_hg,
+                                        const HypernodeID u,
+                                        const HypernodeID v,
+                                        const HyperedgeID he);
+
+  // ! This function is called after restoring a single-pin hyperedge. The function assumes that
+  // ! u is the only pin of the corresponding hyperedge, while block_of_u is its corresponding block ID.
+  void restoreSinglePinHyperedge(const HypernodeID u,
+                                 const PartitionID block_of_u,
+                                 const HyperedgeWeight weight_of_he) {
+    if ( _is_initialized ) {
+      addToBenefitTerm(u, block_of_u, weight_of_he);
+    }
+  }
+
+  // ! This function is called after restoring a net that became identical to another due to a contraction.
+  template<typename PartitionedHypergraph>
+  void restoreIdenticalHyperedge(const PartitionedHypergraph&,
+                                 const HyperedgeID) {
+    // Do nothing
+  }
+
+  // ! Notifies the gain cache that all uncontractions of the current batch are completed.
+  void batchUncontractionsCompleted() {
+    // Do nothing
+  }
+
+  // ####################### Only for Testing #######################
+
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight recomputePenaltyTerm(const PartitionedHypergraph& partitioned_hg,
+                                       const HypernodeID u) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    const PartitionID block_of_u = partitioned_hg.partID(u);
+    HyperedgeWeight penalty = 0;
+    for (HyperedgeID e : partitioned_hg.incidentEdges(u)) {
+      if ( partitioned_hg.pinCountInPart(e, block_of_u) > 1 ) {
+        penalty += partitioned_hg.edgeWeight(e);
+      }
+    }
+    return penalty;
+  }
+
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight recomputeBenefitTerm(const PartitionedHypergraph& partitioned_hg,
+                                       const HypernodeID u,
+                                       const PartitionID to) const {
+    HyperedgeWeight benefit = 0;
+    for (HyperedgeID e : partitioned_hg.incidentEdges(u)) {
+      if (partitioned_hg.pinCountInPart(e, to) >= 1) {
+        benefit += partitioned_hg.edgeWeight(e);
+      }
+    }
+    return benefit;
+  }
+
+  void changeNumberOfBlocks(const PartitionID new_k) {
+    ASSERT(new_k <= _k);
+    _num_blocks = new_k;
+  }
+
+  template<typename PartitionedHypergraph>
+  bool verifyTrackedAdjacentBlocksOfNodes(const PartitionedHypergraph&) const {
+    // Adjacent blocks are implicitly given by the benefit terms
+    return true;
+  }
+
+  // ! Returns true, if the benefit terms of node u are stored densely
+  bool isDense(const HypernodeID u) const {
+    return numSlots(u) == numDenseSlots(_k);
+  }
+
+ private:
+  friend class DeltaSparseKm1GainCache;
+
+  static constexpr size_t INVALID_SLOT = std::numeric_limits<size_t>::max();
+
+  // ####################### Entry Encoding #######################
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static Entry makeEntry(const PartitionID block, const HyperedgeWeight benefit) {
+    return ( static_cast<Entry>(static_cast<uint32_t>(block)) << 32 ) |
+      static_cast<Entry>(static_cast<uint32_t>(benefit));
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static PartitionID blockOf(const Entry entry) {
+    return static_cast<PartitionID>(static_cast<uint32_t>(entry >> 32));
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static HyperedgeWeight benefitOf(const Entry entry) {
+    return static_cast<HyperedgeWeight>(static_cast<uint32_t>(entry));
+  }
+
+  // ! A dense slot stores the benefit terms of block 2i (lower half) and 2i + 1 (upper half)
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static HyperedgeWeight denseBenefitOf(const Entry entry, const PartitionID block) {
+    return static_cast<HyperedgeWeight>(static_cast<uint32_t>(entry >> ( 32 * ( block & 1 ) )));
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static Entry addToDenseEntry(const Entry entry, const PartitionID block, const HyperedgeWeight delta) {
+    const uint32_t shift = 32 * ( block & 1 );
+    const uint32_t benefit = static_cast<uint32_t>(entry >> shift) + static_cast<uint32_t>(delta);
+    return ( entry & ~( static_cast<Entry>(UINT32_MAX) << shift ) ) |
+      ( static_cast<Entry>(benefit) << shift );
+  }
+
+  static PartitionID numDenseSlots(const PartitionID k) {
+    return ( k + 1 ) / 2;
+  }
+
+  // ####################### Hash Table Operations #######################
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  PartitionID numSlots(const HypernodeID u) const {
+    return static_cast<PartitionID>(_offsets[u + 1] - _offsets[u]);
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static size_t hash(const PartitionID block) {
+    return static_cast<size_t>(static_cast<uint32_t>(block) * UINT32_C(0x9E3779B1));
+  }
+
+  // ! Returns the position of the slot which stores block in the hash table of node u
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t findSlot(const HypernodeID u, const PartitionID block) const {
+    const size_t num_slots = numSlots(u);
+    const size_t begin = _offsets[u];
+    size_t pos = hash(block) & ( num_slots - 1 );
+    for ( size_t i = 0; i < num_slots; ++i ) {
+      const PartitionID stored_block = blockOf(_entries[begin + pos].load(std::memory_order_relaxed));
+      if ( stored_block == block ) {
+        return begin + pos;
+      } else if ( stored_block == EMPTY_BLOCK ) {
+        break;
+      }
+      pos = ( pos + 1 ) & ( num_slots - 1 );
+    }
+    return INVALID_SLOT;
+  }
+
+  // ! Adds delta to the benefit term of an entry, if it contains block. The entry is
+  // ! removed from the hash table if its benefit term becomes zero.
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  bool tryAddToEntry(const size_t pos, const PartitionID block, const HyperedgeWeight delta) {
+    Entry entry = _entries[pos].load(std::memory_order_relaxed);
+    while ( blockOf(entry) == block ) {
+      const HyperedgeWeight benefit = benefitOf(entry) + delta;
+      const Entry desired = benefit != 0 ? makeEntry(block, benefit) : makeEntry(DELETED_BLOCK, 0);
+      if ( _entries[pos].compare_exchange_weak(entry, desired, std::memory_order_relaxed) ) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // ! Adds delta to the benefit term b(u, block)
+  void addToBenefitTerm(const HypernodeID u, const PartitionID block, const HyperedgeWeight delta);
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  bool hasOverflowEntries(const HypernodeID u) const {
+    return _has_overflow_entries[u].load(std::memory_order_relaxed);
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t overflow_key(const HypernodeID u, const PartitionID p) const {
+    return size_t(u) * _k + p;
+  }
+
+  // ! The delta gain cache uses the same (virtual) indices as the Km1GainCache
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t penalty_index(const HypernodeID u) const {
+    return size_t(u) * ( _k + 1 );
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t benefit_index(const HypernodeID u, const PartitionID p) const {
+    return size_t(u) * ( _k + 1 )  + p + 1;
+  }
+
+  // ! Computes the number of slots of each node and allocates the gain cache
+  template<typename PartitionedHypergraph>
+  void allocateGainTable(const PartitionedHypergraph& partitioned_hg);
+
+  // ! Writes the benefit terms of node u into its region
+  void storeBenefitTerms(const HypernodeID u,
+                         const vec<HyperedgeWeight>& benefits,
+                         const vec<PartitionID>& adjacent_blocks);
+
+  // ! Indicate whether or not the gain cache is initialized
+  bool _is_initialized;
+
+  // ! Number of blocks
+  PartitionID _k;
+
+  // ! Number of blocks reported as adjacent if a node has overflow entries
+  PartitionID _num_blocks;
+
+  // ! Start of the region of each node in _entries
+  ds::Array<size_t> _offsets;
+
+  // ! Penalty term of each node
+  ds::Array< CAtomic<HyperedgeWeight> > _penalties;
+
+  // ! Hash tables (resp. dense benefit terms) of all nodes
+  ds::Array< CAtomic<Entry> > _entries;
+
+  // ! Inserting a new block into the hash table of a node requires its lock
+  ds::Array<SpinLock> _node_locks;
+
+  // ! Indicates whether some benefit terms of a node are stored in the overflow table
+  ds::Array< CAtomic<uint8_t> > _has_overflow_entries;
+
+  // ! Stores benefit terms that do not fit into the hash table of a node
+  OverflowTable _overflow_table;
+};
+
+/**
+ * Delta gain cache for the SparseKm1GainCache (see DeltaKm1GainCache). Note that adjacent blocks
+ * are reported with respect to the shared gain cache, i.e., blocks that only become adjacent to a node
+ * due to local moves are not enumerated by adjacentBlocks(...).
+*/
+class DeltaSparseKm1GainCache {
+
+  using AdjacentBlocksIterator = typename SparseKm1GainCache::AdjacentBlocksIterator;
+
+ public:
+  static constexpr bool requires_connectivity_set = false;
+
+  DeltaSparseKm1GainCache(const SparseKm1GainCache& gain_cache) :
+    _gain_cache(gain_cache),
+    _gain_cache_delta() { }
+
+  // ####################### Initialize & Reset #######################
+
+  void initialize(const size_t size) {
+    _gain_cache_delta.initialize(size);
+  }
+
+  void clear() {
+    _gain_cache_delta.clear();
+  }
+
+  void dropMemory() {
+    _gain_cache_delta.freeInternalData();
+  }
+
+  size_t size_in_bytes() const {
+    return _gain_cache_delta.size_in_bytes();
+  }
+
+  // ####################### Gain Computation #######################
+
+  // ! Returns whether the block is adjacent to the node
+  bool blockIsAdjacent(const HypernodeID hn, const PartitionID block) const {
+    return _gain_cache.blockIsAdjacent(hn, block) || benefitTerm(hn, block) != 0;
+  }
+
+  // ! Returns an iterator over the adjacent blocks of a node
+  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID hn) const {
+    return _gain_cache.adjacentBlocks(hn);
+  }
+
+  // ! Returns the penalty term of node u.
+  // ! More formally, p(u) := w({ e \in I(u) | pin_count(e, V_i) > 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight penaltyTerm(const HypernodeID u,
+                              const PartitionID from) const {
+    const HyperedgeWeight* penalty_delta =
+      _gain_cache_delta.get_if_contained(_gain_cache.penalty_index(u));
+    return _gain_cache.penaltyTerm(u, from) + ( penalty_delta ? *penalty_delta : 0 );
+  }
+
+  // ! Returns the benefit term for moving node u to block to.
+  // ! More formally, b(u, V_j) := w({ e \in I(u) | pin_count(e, V_j) >= 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
+    ASSERT(to != kInvalidPartition && to < _gain_cache._k);
+    const HyperedgeWeight* benefit_delta =
+      _gain_cache_delta.get_if_contained(_gain_cache.benefit_index(u, to));
+    return _gain_cache.benefitTerm(u, to) + ( benefit_delta ? *benefit_delta : 0 );
+  }
+
+  // ! Returns the gain of moving node u from its current block to a target block V_j.
+  // ! More formally, g(u, V_j) := b(u, V_j) - p(u).
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight gain(const HypernodeID u,
+                       const PartitionID from,
+                       const PartitionID to ) const {
+    return benefitTerm(u, to) - penaltyTerm(u, from);
+  }
+
+ // ####################### Delta Gain Update #######################
+
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
+                       const SynchronizedEdgeUpdate& sync_update) {
+    const HyperedgeID he = sync_update.he;
+    const PartitionID from = sync_update.from;
+    const PartitionID to = sync_update.to;
+    const HyperedgeWeight edge_weight = sync_update.edge_weight;
+    const HypernodeID pin_count_in_from_part_after = sync_update.pin_count_in_from_part_after;
+    const HypernodeID pin_count_in_to_part_after = sync_update.pin_count_in_to_part_after;
+    if (pin_count_in_from_part_after == 1) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        if (partitioned_hg.partID(u) == from) {
+          _gain_cache_delta[_gain_cache.penalty_index(u)] -= edge_weight;
+        }
+      }
+    } else if (pin_count_in_from_part_after == 0) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        _gain_cache_delta[_gain_cache.benefit_index(u, from)] -= edge_weight;
+      }
+    }
+
+    if (pin_count_in_to_part_after == 1) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        _gain_cache_delta[_gain_cache.benefit_index(u, to)] += edge_weight;
+      }
+    } else if (pin_count_in_to_part_after == 2) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        if (partitioned_hg.partID(u) == to) {
+          _gain_cache_delta[_gain_cache.penalty_index(u)] += edge_weight;
+        }
+      }
+    }
+  }
+
+ // ####################### Miscellaneous #######################
+
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    ASSERT(parent);
+    utils::MemoryTreeNode* gain_cache_delta_node = parent->addChild("Delta Gain Cache");
+    gain_cache_delta_node->updateSize(size_in_bytes());
+  }
+
+ private:
+  const SparseKm1GainCache& _gain_cache;
+
+  // ! Stores the delta of each locally touched gain cache entry
+  // ! relative to the gain cache in '_phg'
+  ds::DynamicFlatMap<size_t, HyperedgeWeight> _gain_cache_delta;
+};
+
+}  // namespace mt_kahypar
@@ -32,6 +32,8 @@
 
 #include "mt-kahypar/datastructures/synchronized_edge_update.h"
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/weighted_parallel_for.h"
+#include "mt-kahypar/partition/refinement/gains/benefit_aggregation.h"
 
 namespace mt_kahypar {
 
@@ -49,10 +51,13 @@ void SoedGainCache::initializeGainCache(const PartitionedHypergraph& partitioned
   tbb::enumerable_thread_specific< vec<HyperedgeWeight> > ets_mtb(_k, 0);
   tbb::concurrent_vector<HypernodeID> high_degree_vertices;
   // Compute gain of all low degree vertices
-  tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), partitioned_hg.initialNumNodes()),
-    [&](tbb::blocked_range<HypernodeID>& r) {
+  parallel::weighted_parallel_for_ranges(HypernodeID(0), partitioned_hg.initialNumNodes(),
+    [&](const HypernodeID u) {
+      return partitioned_hg.nodeIsEnabled(u) ?
+        std::min<HyperedgeID>(partitioned_hg.nodeDegree(u), HIGH_DEGREE_THRESHOLD) : 0;
+    }, [&](const HypernodeID first, const HypernodeID last) {
       vec<HyperedgeWeight>& benefit_aggregator = ets_mtb.local();
-      for (HypernodeID u = r.begin(); u < r.end(); ++u) {
+      for (HypernodeID u = first; u < last; ++u) {
         if ( partitioned_hg.nodeIsEnabled(u)) {
           if ( partitioned_hg.nodeDegree(u) <= HIGH_DEGREE_THRESHOLD) {
             initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator);
@@ -345,19 +350,55 @@ void SoedGainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph&
                                                     vec<Gain>& benefit_aggregator) {
   PartitionID from = partitioned_hg.partID(u);
   Gain penalty = 0;
-  for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
-    const HypernodeID edge_size = partitioned_hg.edgeSize(e);
-    if ( edge_size > 1 ) {
-      const HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
-      const HypernodeID pin_count_from = partitioned_hg.pinCountInPart(e, from);
-      const HyperedgeWeight penalty_multiplier =
-        ( pin_count_from > 1 ) + ( pin_count_from == edge_size );
-      penalty += penalty_multiplier * ew;
+  bool is_aggregated = false;
+  if constexpr ( PartitionedHypergraph::has_dense_connectivity_set ) {
+    if ( _k <= benefit_aggregation::MAX_NUM_BLOCKS_FOR_DENSE_AGGREGATION ) {
+      // Each block of the connectivity set gains the edge weight once, which is
+      // aggregated branch-free across all blocks. Only the blocks that contain all
+      // but one pin of the hyperedge gain the edge weight a second time.
+      benefit_aggregation::BenefitAggregationBuffer buffer(_k, benefit_aggregator.data());
+      for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+        const HypernodeID edge_size = partitioned_hg.edgeSize(e);
+        if ( edge_size > 1 ) {
+          const HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+          const HypernodeID pin_count_from = partitioned_hg.pinCountInPart(e, from);
+          const HyperedgeWeight penalty_multiplier =
+            ( pin_count_from > 1 ) + ( pin_count_from == edge_size );
+          penalty += penalty_multiplier * ew;
+
+          buffer.add(partitioned_hg.connectivitySetBlock(e, 0), ew);
+          if ( pin_count_from == 1 || pin_count_from == edge_size - 1 ) {
+            // Since u is part of block from, a block can only contain edge_size - 1
+            // pins, if either u is the only pin in block from or block from itself
+            // contains edge_size - 1 pins
+            for (const PartitionID& to : partitioned_hg.connectivitySet(e)) {
+              if ( partitioned_hg.pinCountInPart(e, to) == edge_size - 1 ) {
+                benefit_aggregator[to] += ew;
+              }
+            }
+          }
+        }
+      }
+      buffer.flush();
+      is_aggregated = true;
+    }
+  }
 
-      for (const PartitionID& to : partitioned_hg.connectivitySet(e)) {
-        const HyperedgeWeight benefit_multiplier = 1 +
-          ( partitioned_hg.pinCountInPart(e, to) == edge_size - 1 );
-        benefit_aggregator[to] += benefit_multiplier * ew;
+  if ( !is_aggregated ) {
+    for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+      const HypernodeID edge_size = partitioned_hg.edgeSize(e);
+      if ( edge_size > 1 ) {
+        const HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+        const HypernodeID pin_count_from = partitioned_hg.pinCountInPart(e, from);
+        const HyperedgeWeight penalty_multiplier =
+          ( pin_count_from > 1 ) + ( pin_count_from == edge_size );
+        penalty += penalty_multiplier * ew;
+
+        for (const PartitionID& to : partitioned_hg.connectivitySet(e)) {
+          const HyperedgeWeight benefit_multiplier = 1 +
+            ( partitioned_hg.pinCountInPart(e, to) == edge_size - 1 );
+          benefit_aggregator[to] += benefit_multiplier * ew;
+        }
       }
     }
   }
@@ -28,6 +28,8 @@
 
 #include <algorithm>
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include "kahypar-resources/meta/policy_registry.h"
 
 #include "mt-kahypar/partition/context_enum_classes.h"
@@ -76,18 +78,21 @@ class SoedGainCache {
   static constexpr bool requires_notification_before_update = false;
   static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = false;
   static constexpr bool invalidates_entries = true;
+  static constexpr bool supports_batched_updates = true;
 
   SoedGainCache() :
     _is_initialized(false),
     _k(kInvalidPartition),
     _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _dummy_adjacent_blocks(),
+    _ets_benefit_aggregator() { }
 
   SoedGainCache(const Context&) :
     _is_initialized(false),
     _k(kInvalidPartition),
     _gain_cache(),
-    _dummy_adjacent_blocks() { }
+    _dummy_adjacent_blocks(),
+    _ets_benefit_aggregator() { }
 
   SoedGainCache(const SoedGainCache&) = delete;
   SoedGainCache & operator= (const SoedGainCache &) = delete;
@@ -154,6 +159,19 @@ class SoedGainCache {
       partitioned_hg, u), std::memory_order_relaxed);
   }
 
+  // ! Recomputes all gain cache entries of node u from scratch. Used to apply a batch of
+  // ! moves without delta gain updates (see batched_gain_cache_update.h).
+  template<typename PartitionedHypergraph>
+  void recomputeGainCacheEntry(const PartitionedHypergraph& partitioned_hg,
+                               const HypernodeID u) {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    vec<Gain>& benefit_aggregator = _ets_benefit_aggregator.local();
+    if ( benefit_aggregator.size() < static_cast<size_t>(_k) ) {
+      benefit_aggregator.assign(_k, 0);
+    }
+    initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator);
+  }
+
   // ! Returns the benefit term for moving node u to block to.
   // ! More formally,
   // ! b(u, V_j) := w({ e \in I(u) | pin_count(e, V_j) >= 1 }) + w({ e \in I(u) | pin_count(e, V_j) = |e| - 1 })
@@ -338,6 +356,9 @@ class SoedGainCache {
 
   // ! Provides an iterator from 0 to k (:= number of blocks)
   IntegerRangeIterator<PartitionID> _dummy_adjacent_blocks;
+
+  // ! Thread-local buffers to aggregate the benefit terms of a node
+  tbb::enumerable_thread_specific<vec<Gain>> _ets_benefit_aggregator;
 };
 
 /**
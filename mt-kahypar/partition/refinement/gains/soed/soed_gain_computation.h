@@ -42,6 +42,8 @@ class SoedGainComputation : public GainComputationBase<SoedGainComputation, Soed
 
  public:
   using RatingMap = typename Base::RatingMap;
+  // ! The gain contributions of the incident nets can be aggregated in parallel
+  static constexpr bool supports_parallel_gain_aggregation = true;
 
   SoedGainComputation(const Context& context,
                       bool disable_randomization = false) :
@@ -52,42 +54,53 @@ class SoedGainComputation : public GainComputationBase<SoedGainComputation, Soed
   // ! and the gain to all adjacent blocks assuming the node is in an isolated block.
   // ! The gain of that node to a block to can then be computed by
   // ! 'isolated_block_gain - tmp_scores[to]' (see gain(...))
-  template<typename PartitionedHypergraph>
+  template<typename PartitionedHypergraph, typename Scores>
   void precomputeGains(const PartitionedHypergraph& phg,
                        const HypernodeID hn,
-                       RatingMap& tmp_scores,
+                       Scores& tmp_scores,
                        Gain& isolated_block_gain,
                        const bool) {
     ASSERT(tmp_scores.size() == 0, "Rating map not empty");
     PartitionID from = phg.partID(hn);
     for (const HyperedgeID& he : phg.incidentEdges(hn)) {
-      const HypernodeID edge_size = phg.edgeSize(he);
-
-      if ( edge_size > 1 ) {
-        HypernodeID pin_count_in_from_part = phg.pinCountInPart(he, from);
-        HyperedgeWeight he_weight = phg.edgeWeight(he);
-
-        // In case, there is more one than one pin left in from part, we would
-        // increase the connectivity, if we would move the pin to one block
-        // not contained in the connectivity set. In such cases, we can only
-        // increase the connectivity of a hyperedge and therefore gather
-        // the edge weight of all those edges and add it later to move gain
-        // to all other blocks. There is one percularity. If the hyperedge is not
-        // a cut edge, we would increase the soed metric by 2 * w(e) where w(e)
-        // is the weight of the hyperedge.
-        if ( pin_count_in_from_part > 1 ) {
-          isolated_block_gain += (pin_count_in_from_part == edge_size ? 2 : 1) * he_weight;
-        }
+      precomputeGainOfIncidentEdge(phg, from, he, tmp_scores, isolated_block_gain);
+    }
+  }
+
+  // ! Adds the contribution of incident edge he to the precomputed gains (see precomputeGains(...)).
+  // ! The contributions of the incident edges are independent of each other.
+  template<typename PartitionedHypergraph, typename Scores>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void precomputeGainOfIncidentEdge(const PartitionedHypergraph& phg,
+                                                                      const PartitionID from,
+                                                                      const HyperedgeID he,
+                                                                      Scores& tmp_scores,
+                                                                      Gain& isolated_block_gain) {
+    const HypernodeID edge_size = phg.edgeSize(he);
+
+    if ( edge_size > 1 ) {
+      HypernodeID pin_count_in_from_part = phg.pinCountInPart(he, from);
+      HyperedgeWeight he_weight = phg.edgeWeight(he);
+
+      // In case, there is more one than one pin left in from part, we would
+      // increase the connectivity, if we would move the pin to one block
+      // not contained in the connectivity set. In such cases, we can only
+      // increase the connectivity of a hyperedge and therefore gather
+      // the edge weight of all those edges and add it later to move gain
+      // to all other blocks. There is one percularity. If the hyperedge is not
+      // a cut edge, we would increase the soed metric by 2 * w(e) where w(e)
+      // is the weight of the hyperedge.
+      if ( pin_count_in_from_part > 1 ) {
+        isolated_block_gain += (pin_count_in_from_part == edge_size ? 2 : 1) * he_weight;
+      }
 
-        // Substract edge weight from all incident blocks.
-        // If the we would make the hyperedge a non-cut edge, we would improve
-        // the objective function by 2 * w(e) where w(e) is the weight of the hyperedge.
-        // Note, in case the pin count in from part is greater than one
-        // we will later add that edge weight to the gain (see internal_weight).
-        for (const PartitionID& to : phg.connectivitySet(he)) {
-          if (from != to) {
-            tmp_scores[to] += (phg.pinCountInPart(he, to) == edge_size - 1 ? 2 : 1) * he_weight;
-          }
+      // Substract edge weight from all incident blocks.
+      // If the we would make the hyperedge a non-cut edge, we would improve
+      // the objective function by 2 * w(e) where w(e) is the weight of the hyperedge.
+      // Note, in case the pin count in from part is greater than one
+      // we will later add that edge weight to the gain (see internal_weight).
+      for (const PartitionID& to : phg.connectivitySet(he)) {
+        if (from != to) {
+          tmp_scores[to] += (phg.pinCountInPart(he, to) == edge_size - 1 ? 2 : 1) * he_weight;
         }
       }
     }
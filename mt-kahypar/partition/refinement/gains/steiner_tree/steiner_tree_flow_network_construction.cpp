@@ -60,38 +60,31 @@ HyperedgeWeight SteinerTreeFlowNetworkConstruction::capacity(const PartitionedHy
   const HypernodeID pin_count_block_0 = phg.pinCountInPart(he, block_0);
   const HypernodeID pin_count_block_1 = phg.pinCountInPart(he, block_1);
   ds::Bitset& connectivity_set = phg.deepCopyOfConnectivitySet(he);
-  const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
+  const BlockPairDistances distances =
+    target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
   if ( pin_count_block_0 > 0 && pin_count_block_1 == 0 ) {
     // Hyperedge is non-cut
     // => we use gain for making the hyperedge cut as capacity to get a lower bound for the
     // actual improvement
-    HyperedgeWeight distance_with_block_1 = 0;
-    if ( pin_count_block_0 == 1 ) {
-      distance_with_block_1 = target_graph.distanceAfterExchangingBlocks(connectivity_set, block_0, block_1);
-    } else {
-      distance_with_block_1 = target_graph.distanceWithBlock(connectivity_set, block_1);
-    }
-    return std::abs(current_distance - distance_with_block_1) * edge_weight;
+    const HyperedgeWeight distance_with_block_1 = pin_count_block_0 == 1 ?
+      distances.with_block_1 : distances.with_both_blocks;
+    return std::abs(distances.with_block_0 - distance_with_block_1) * edge_weight;
   } else if ( pin_count_block_0 == 0 && pin_count_block_1 > 0 ) {
     // Hyperedge is non-cut
     // => we use gain for making the hyperedge cut as capacity to get a lower bound for the
     // actual improvement
-    HyperedgeWeight distance_with_block_0 = 0;
-    if ( pin_count_block_1 == 1 ) {
-      distance_with_block_0 = target_graph.distanceAfterExchangingBlocks(connectivity_set, block_1, block_0);
-    } else {
-      distance_with_block_0 = target_graph.distanceWithBlock(connectivity_set, block_0);
-    }
-    return std::abs(current_distance - distance_with_block_0) * edge_weight;
-  } else {
+    const HyperedgeWeight distance_with_block_0 = pin_count_block_1 == 1 ?
+      distances.with_block_0 : distances.with_both_blocks;
+    return std::abs(distances.with_block_1 - distance_with_block_0) * edge_weight;
+  } else if ( pin_count_block_0 > 0 && pin_count_block_1 > 0 ) {
     // Hyperedge is cut
     // => does we either use min(gain_0, gain_1) to compute a lower bound for the actual improvement or
     // max(gain_0,gain_1) to compute an uppter bound for the actual improvement.
-    const HyperedgeWeight distance_without_block_0 = target_graph.distanceWithoutBlock(connectivity_set, block_0);
-    const HyperedgeWeight distance_without_block_1 = target_graph.distanceWithoutBlock(connectivity_set, block_1);
-    const HyperedgeWeight gain_0 = (current_distance - distance_without_block_0) * edge_weight;
-    const HyperedgeWeight gain_1 = (current_distance - distance_without_block_1) * edge_weight;
+    const HyperedgeWeight gain_0 = (distances.with_both_blocks - distances.with_block_1) * edge_weight;
+    const HyperedgeWeight gain_1 = (distances.with_both_blocks - distances.with_block_0) * edge_weight;
     return capacity_for_cut_edge(context.refinement.flows.steiner_tree_policy, gain_0, gain_1);
+  } else {
+    return capacity_for_cut_edge(context.refinement.flows.steiner_tree_policy, 0, 0);
   }
 }
 
@@ -106,24 +99,18 @@ bool SteinerTreeFlowNetworkConstruction::connectToSource(const PartitionedHyperg
   const TargetGraph& target_graph = *partitioned_hg.targetGraph();
   if ( pin_count_block_0 > 0 && pin_count_block_1 == 0 ) {
     ds::Bitset& connectivity_set = partitioned_hg.deepCopyOfConnectivitySet(he);
-    const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
-    const HyperedgeWeight distance_after_exchange =
-      target_graph.distanceAfterExchangingBlocks(connectivity_set, block_0, block_1);
-    if ( current_distance < distance_after_exchange ) {
-      // If all nodes from block_0 would move to block_1, we would worsen the steiner tree metric,
-      // even though the connectivity of the hyperedge does not change. To model this percurlarity in the flow network,
-      // we add the corresponding hyperedge to the source.
-      return true;
-    }
+    const BlockPairDistances distances =
+      target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
+    // If all nodes from block_0 would move to block_1, we would worsen the steiner tree metric,
+    // even though the connectivity of the hyperedge does not change. To model this percurlarity in the flow network,
+    // we add the corresponding hyperedge to the source.
+    return distances.with_block_0 < distances.with_block_1;
   }
   if ( pin_count_block_0 == 0 && pin_count_block_1 == 1 ) {
     ds::Bitset& connectivity_set = partitioned_hg.deepCopyOfConnectivitySet(he);
-    const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
-    const HyperedgeWeight distance_after_exchange =
-      target_graph.distanceAfterExchangingBlocks(connectivity_set, block_1, block_0);
-    if ( current_distance > distance_after_exchange ) {
-      return true;
-    }
+    const BlockPairDistances distances =
+      target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
+    return distances.with_block_1 > distances.with_block_0;
   }
   return false;
 }
@@ -138,26 +125,20 @@ bool SteinerTreeFlowNetworkConstruction::connectToSink(const PartitionedHypergra
   const HypernodeID pin_count_block_0 = partitioned_hg.pinCountInPart(he, block_0);
   const HypernodeID pin_count_block_1 = partitioned_hg.pinCountInPart(he, block_1);
   const TargetGraph& target_graph = *partitioned_hg.targetGraph();
-  if ( partitioned_hg.pinCountInPart(he, block_0) == 0 && partitioned_hg.pinCountInPart(he, block_1) > 0 ) {
+  if ( pin_count_block_0 == 0 && pin_count_block_1 > 0 ) {
     ds::Bitset& connectivity_set = partitioned_hg.deepCopyOfConnectivitySet(he);
-    const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
-    const HyperedgeWeight distance_after_exchange =
-      target_graph.distanceAfterExchangingBlocks(connectivity_set, block_1, block_0);
-    if ( current_distance < distance_after_exchange ) {
-      // If all nodes from block_1 would move to block_0, we would worsen the steiner tree metric,
-      // even though the connectivity of the hyperedge does not change. To model this percurlarity in the flow network,
-      // we add the corresponding hyperedge to the sink.
-      return true;
-    }
+    const BlockPairDistances distances =
+      target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
+    // If all nodes from block_1 would move to block_0, we would worsen the steiner tree metric,
+    // even though the connectivity of the hyperedge does not change. To model this percurlarity in the flow network,
+    // we add the corresponding hyperedge to the sink.
+    return distances.with_block_1 < distances.with_block_0;
   }
   if ( pin_count_block_0 == 1 && pin_count_block_1 == 0 ) {
     ds::Bitset& connectivity_set = partitioned_hg.deepCopyOfConnectivitySet(he);
-    const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
-    const HyperedgeWeight distance_after_exchange =
-      target_graph.distanceAfterExchangingBlocks(connectivity_set, block_0, block_1);
-    if ( current_distance > distance_after_exchange ) {
-      return true;
-    }
+    const BlockPairDistances distances =
+      target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
+    return distances.with_block_0 > distances.with_block_1;
   }
   return false;
 }
@@ -173,21 +154,15 @@ bool SteinerTreeFlowNetworkConstruction::isCut(const PartitionedHypergraph& part
   const TargetGraph& target_graph = *partitioned_hg.targetGraph();
   if ( pin_count_block_0 == 0 && pin_count_block_1 == 1 ) {
     ds::Bitset& connectivity_set = partitioned_hg.deepCopyOfConnectivitySet(he);
-    const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
-    const HyperedgeWeight distance_after_exchange =
-      target_graph.distanceAfterExchangingBlocks(connectivity_set, block_1, block_0);
-    if ( current_distance > distance_after_exchange ) {
-      return true;
-    }
+    const BlockPairDistances distances =
+      target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
+    return distances.with_block_1 > distances.with_block_0;
   }
   if ( pin_count_block_0 == 1 && pin_count_block_1 == 0 ) {
     ds::Bitset& connectivity_set = partitioned_hg.deepCopyOfConnectivitySet(he);
-    const HyperedgeWeight current_distance = target_graph.distance(connectivity_set);
-    const HyperedgeWeight distance_after_exchange =
-      target_graph.distanceAfterExchangingBlocks(connectivity_set, block_0, block_1);
-    if ( current_distance > distance_after_exchange ) {
-      return true;
-    }
+    const BlockPairDistances distances =
+      target_graph.distancesForBlockPair(connectivity_set, block_0, block_1);
+    return distances.with_block_0 > distances.with_block_1;
   }
   return false;
 }
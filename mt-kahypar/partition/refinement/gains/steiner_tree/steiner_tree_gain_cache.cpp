@@ -145,18 +145,29 @@ void SteinerTreeGainCache::deltaGainUpdate(const PartitionedHypergraph& partitio
       // Connectivity set has changed
       // => Recompute gain of hyperedge for all pins and their adjacent blocks
 
+      // The gain of the hyperedge only depends on the block of a pin and the target block.
+      // If several pins share a block, we compute the gain for each pair of blocks only once.
+      const bool use_memo = partitioned_hg.edgeSize(he) > static_cast<HypernodeID>(connectivity_set.popcount());
+      HyperedgeGainMemo& memo = _ets_gain_memo.local();
+      auto gain_of_hyperedge = [&](const PartitionID source, const PartitionID target) {
+        auto compute_gain = [&] {
+          return gainOfHyperedge(source, target, edge_weight, target_graph, pin_counts, connectivity_set);
+        };
+        return use_memo ? memo.gain(source, target, _k, compute_gain) : compute_gain();
+      };
+
       // Compute new gain of hyperedge for all pins and their adjacent blocks and
       // add it to the gain cache entries
       for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
         const PartitionID source = partitioned_hg.partID(pin);
         for ( const PartitionID& target : _adjacent_blocks.connectivitySet(pin) ) {
           if ( source != target ) {
-            const HyperedgeWeight gain_after = gainOfHyperedge(
-              source, target, edge_weight, target_graph, pin_counts, connectivity_set);
+            const HyperedgeWeight gain_after = gain_of_hyperedge(source, target);
             _gain_cache[benefit_index(pin, target)].add_fetch(gain_after, std::memory_order_relaxed);
           }
         }
       }
+      memo.reset();
 
       // Reconstruct connectivity set and pin counts before the node move
       reconstructConnectivitySetAndPinCountsBeforeMove(sync_update, connectivity_set, pin_counts);
@@ -166,12 +177,12 @@ void SteinerTreeGainCache::deltaGainUpdate(const PartitionedHypergraph& partitio
         const PartitionID source = partitioned_hg.partID(pin);
         for ( const PartitionID& target : _adjacent_blocks.connectivitySet(pin) ) {
             if ( source != target ) {
-            const HyperedgeWeight gain_before = gainOfHyperedge(
-              source, target, edge_weight, target_graph, pin_counts, connectivity_set);
+            const HyperedgeWeight gain_before = gain_of_hyperedge(source, target);
             _gain_cache[benefit_index(pin, target)].sub_fetch(gain_before, std::memory_order_relaxed);
           }
         }
       }
+      memo.reset();
     } else {
       if ( pin_count_in_from_part_after == 1 ) {
         // In this case, there is only one pin left in block `from` and moving it to another block
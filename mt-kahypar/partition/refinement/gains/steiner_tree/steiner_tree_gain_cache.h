@@ -74,6 +74,59 @@ class SteinerTreeGainCache {
 
   using AdjacentBlocksIterator = IteratorRange<typename ds::ConnectivitySets::Iterator>;
 
+  // ! Stores the gain of a hyperedge for moving a pin from a source to a target block.
+  // ! The gain only depends on the two blocks, i.e., all pins of the same block share
+  // ! the same values. The blocks of a hyperedge are ranked in the order in which they
+  // ! are queried, such that the memo only requires |Λ(e)| * k entries.
+  class HyperedgeGainMemo {
+
+    static constexpr HyperedgeWeight kUnknownGain = std::numeric_limits<HyperedgeWeight>::min();
+
+   public:
+    template<typename F>
+    MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+    HyperedgeWeight gain(const PartitionID source,
+                         const PartitionID target,
+                         const PartitionID k,
+                         const F& compute_gain) {
+      if ( _rank_of_block.size() < static_cast<size_t>(k) ) {
+        _rank_of_block.assign(k, kInvalidPartition);
+      }
+      PartitionID& rank = _rank_of_block[source];
+      if ( rank == kInvalidPartition ) {
+        rank = _sources.size();
+        _sources.push_back(source);
+        const size_t required_size = static_cast<size_t>(rank + 1) * k;
+        if ( _gains.size() < required_size ) {
+          _gains.resize(required_size, kUnknownGain);
+        }
+      }
+      const size_t idx = static_cast<size_t>(rank) * k + target;
+      if ( _gains[idx] == kUnknownGain ) {
+        _gains[idx] = compute_gain();
+        _touched.push_back(idx);
+      }
+      return _gains[idx];
+    }
+
+    void reset() {
+      for ( const PartitionID source : _sources ) {
+        _rank_of_block[source] = kInvalidPartition;
+      }
+      for ( const size_t idx : _touched ) {
+        _gains[idx] = kUnknownGain;
+      }
+      _sources.clear();
+      _touched.clear();
+    }
+
+   private:
+    vec<PartitionID> _rank_of_block;
+    vec<PartitionID> _sources;
+    vec<HyperedgeWeight> _gains;
+    vec<size_t> _touched;
+  };
+
  public:
   struct HyperedgeState {
     HyperedgeState() :
@@ -88,6 +141,7 @@ class SteinerTreeGainCache {
   static constexpr bool requires_notification_before_update = true;
   static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = true;
   static constexpr bool invalidates_entries = true;
+  static constexpr bool supports_batched_updates = false;
 
   SteinerTreeGainCache() :
     _is_initialized(false),
@@ -98,6 +152,7 @@ class SteinerTreeGainCache {
     _adjacent_blocks(),
     _version(),
     _ets_version(),
+    _ets_gain_memo(),
     _large_he_threshold(std::numeric_limits<HypernodeID>::max()) { }
 
   SteinerTreeGainCache(const Context& context) :
@@ -109,6 +164,7 @@ class SteinerTreeGainCache {
     _adjacent_blocks(),
     _version(),
     _ets_version(),
+    _ets_gain_memo(),
     _large_he_threshold(context.mapping.large_he_threshold) { }
 
   SteinerTreeGainCache(const SteinerTreeGainCache&) = delete;
@@ -402,6 +458,9 @@ class SteinerTreeGainCache {
   // ! Array to store version IDs when we lazily initialize a gain cache entry
   tbb::enumerable_thread_specific<vec<uint32_t>> _ets_version;
 
+  // ! Thread-local memo to share gains between pins of the same block during delta gain updates
+  tbb::enumerable_thread_specific<HyperedgeGainMemo> _ets_gain_memo;
+
   // ! Threshold for the size of a hyperedge that we do not count when tracking adjacent blocks
   HypernodeID _large_he_threshold;
 };
@@ -105,6 +105,7 @@ class GraphSteinerTreeGainCache {
   static constexpr bool requires_notification_before_update = true;
   static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = true;
   static constexpr bool invalidates_entries = false;
+  static constexpr bool supports_batched_updates = false;
 
   GraphSteinerTreeGainCache() :
     _is_initialized(false),
@@ -64,10 +64,10 @@ class GraphSteinerTreeGainComputation : public GainComputationBase<GraphSteinerT
   // ! and the gain to all adjacent blocks assuming the node is in an isolated block.
   // ! The gain of that node to a block to can then be computed by
   // ! 'isolated_block_gain - tmp_scores[to]' (see gain(...))
-  template<typename PartitionedHypergraph>
+  template<typename PartitionedHypergraph, typename Scores>
   void precomputeGains(const PartitionedHypergraph& phg,
                        const HypernodeID hn,
-                       RatingMap& tmp_scores,
+                       Scores& tmp_scores,
                        Gain&,
                        const bool consider_non_adjacent_blocks) {
     ASSERT(tmp_scores.size() == 0, "Rating map not empty");
@@ -28,8 +28,11 @@
 #include "mt-kahypar/partition/refinement/label_propagation/label_propagation_refiner.h"
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/numa_placement.h"
+#include "mt-kahypar/parallel/weighted_parallel_for.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -50,7 +53,11 @@ namespace mt_kahypar {
     if ( hypergraph.isBorderNode(hn) && !hypergraph.isFixed(hn) ) {
       ASSERT(hypergraph.nodeIsEnabled(hn));
 
-      Move best_move = _gain.computeMaxGainMove(hypergraph, hn, false, false, unconstrained);
+      // The incident nets of high degree vertices are processed in parallel,
+      // since they would otherwise stall the thread that processes the vertex
+      Move best_move = hypergraph.nodeDegree(hn) > _context.refinement.label_propagation.high_degree_threshold ?
+        _gain.computeMaxGainMoveInParallel(hypergraph, hn, false, false, unconstrained) :
+        _gain.computeMaxGainMove(hypergraph, hn, false, false, unconstrained);
       // We perform a move if it either improves the solution quality or, in case of a
       // zero gain move, the balance of the solution.
       const bool positive_gain = best_move.gain < 0;
@@ -109,7 +116,7 @@ namespace mt_kahypar {
     initializeActiveNodes(hypergraph, refinement_nodes);
 
     // Perform Label Propagation
-    labelPropagation(hypergraph, best_metrics);
+    labelPropagation(hypergraph, refinement_nodes, best_metrics);
 
     HEAVY_REFINEMENT_ASSERT(hypergraph.checkTrackedPartitionInformation(_gain_cache));
     ASSERT(best_metrics.quality == metrics::quality(hypergraph, _context,
@@ -127,21 +134,30 @@ namespace mt_kahypar {
 
   template <typename GraphAndGainTypes>
   void LabelPropagationRefiner<GraphAndGainTypes>::labelPropagation(PartitionedHypergraph& hypergraph,
+                                                                 const vec<HypernodeID>& refinement_nodes,
                                                                  Metrics& best_metrics) {
-    NextActiveNodes next_active_nodes;
-    vec<Move> rebalance_moves;
+    // Active nodes and rebalancing moves are stored in member buffers
+    // such that their capacity is reused on all levels of the hierarchy
     bool should_stop = false;
     for (size_t i = 0; i < _context.refinement.label_propagation.maximum_iterations
-                       && !should_stop && !_active_nodes.empty(); ++i) {
-      should_stop = labelPropagationRound(hypergraph, next_active_nodes, best_metrics, rebalance_moves,
+                       && !should_stop && !_active_nodes.empty() && !_context.isTimeLimitExceeded(); ++i) {
+      should_stop = labelPropagationRound(hypergraph, _next_active_nodes, best_metrics, _rebalance_moves,
                                           _context.refinement.label_propagation.unconstrained);
 
+      // The next round only visits the neighbors of the vertices moved in this round.
+      // Thus, label propagation converged if no vertex was activated.
       if ( _context.refinement.label_propagation.execute_sequential ) {
-        _active_nodes = next_active_nodes.copy_sequential();
+        _next_active_nodes.copy_sequential(_active_nodes);
       } else {
-        _active_nodes = next_active_nodes.copy_parallel();
+        _next_active_nodes.copy_parallel(_active_nodes);
+      }
+      _next_active_nodes.clear_sequential();
+
+      if ( !_context.refinement.label_propagation.use_active_node_set &&
+           !should_stop && !_active_nodes.empty() ) {
+        // Visit all border vertices in the next round
+        initializeActiveNodes(hypergraph, refinement_nodes);
       }
-      next_active_nodes.clear_sequential();
     }
   }
 
@@ -241,11 +257,29 @@ namespace mt_kahypar {
           if (should_mark_nodes) { _active_node_was_moved[j] = uint8_t(true); }
         }
       }
+    } else if ( _context.shared_memory.use_numa_aware_placement ) {
+      // Each thread processes a contiguous range of vertex IDs, which is (mostly)
+      // the same range that the thread initialized and therefore resides on its
+      // NUMA node. Nodes are only shuffled within the range of a thread.
+      tbb::parallel_sort(_active_nodes.begin(), _active_nodes.end());
+      parallel::static_parallel_for_ranges(UL(0), _active_nodes.size(),
+        [&](const size_t start, const size_t end) {
+        utils::Randomize::instance().shuffleVector(_active_nodes, start, end, THREAD_ID);
+        for ( size_t j = start; j < end; ++j ) {
+          const HypernodeID hn = _active_nodes[j];
+          if ( moveVertex<unconstrained>(phg, hn, next_active_nodes, objective_delta) ) {
+            if (should_mark_nodes) { _active_node_was_moved[j] = uint8_t(true); }
+          }
+        }
+      });
     } else {
       utils::Randomize::instance().parallelShuffleVector(
               _active_nodes, UL(0), _active_nodes.size());
 
-      tbb::parallel_for(UL(0), _active_nodes.size(), [&](const size_t& j) {
+      // Chunks of roughly equal total degree prevent stragglers on skewed degree distributions
+      parallel::weighted_parallel_for(UL(0), _active_nodes.size(), [&](const size_t j) {
+        return phg.nodeDegree(_active_nodes[j]);
+      }, [&](const size_t& j) {
         const HypernodeID hn = _active_nodes[j];
         if ( moveVertex<unconstrained>(phg, hn, next_active_nodes, objective_delta) ) {
           if (should_mark_nodes) { _active_node_was_moved[j] = uint8_t(true); }
@@ -335,6 +369,11 @@ namespace mt_kahypar {
     _active_nodes.clear();
     if ( refinement_nodes.empty() ) {
       _might_be_uninitialized = false;
+      // The border nodes are maintained incrementally on each move, which makes
+      // the border node checks of the following rounds constant time operations
+      if ( !hypergraph.isTrackingBorderNodes() ) {
+        hypergraph.initializeBorderNodes();
+      }
       if ( _context.refinement.label_propagation.execute_sequential ) {
         for ( const HypernodeID hn : hypergraph.nodes() ) {
           if ( _context.refinement.label_propagation.rebalancing || hypergraph.isBorderNode(hn) ) {
@@ -344,14 +383,24 @@ namespace mt_kahypar {
             _old_part[hn] = hypergraph.partID(hn);
           }
         }
+      } else if ( !_context.refinement.label_propagation.rebalancing &&
+                  !_context.refinement.label_propagation.unconstrained ) {
+        // Only border vertices are active => iterate over the border node set
+        hypergraph.doParallelForAllBorderNodes([&](const HypernodeID& hn) {
+          if ( hypergraph.isBorderNode(hn) && _next_active.compare_and_set_to_true(hn) ) {
+            _next_active_nodes.stream(hn);
+          }
+        });
+
+        _next_active_nodes.copy_parallel(_active_nodes);
+        _next_active_nodes.clear_sequential();
       } else {
         // Setup active nodes in parallel
         // A node is active, if it is a border vertex.
-        NextActiveNodes tmp_active_nodes;
         hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
           if ( _context.refinement.label_propagation.rebalancing || hypergraph.isBorderNode(hn) ) {
             if ( _next_active.compare_and_set_to_true(hn) ) {
-              tmp_active_nodes.stream(hn);
+              _next_active_nodes.stream(hn);
             }
           }
           if ( _context.refinement.label_propagation.unconstrained ) {
@@ -359,7 +408,8 @@ namespace mt_kahypar {
           }
         });
 
-        _active_nodes = tmp_active_nodes.copy_parallel();
+        _next_active_nodes.copy_parallel(_active_nodes);
+        _next_active_nodes.clear_sequential();
       }
     } else {
       _active_nodes = refinement_nodes;
@@ -37,6 +37,7 @@
 #include "mt-kahypar/partition/refinement/i_rebalancer.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/prefetch.h"
 
 
 namespace mt_kahypar {
@@ -68,6 +69,8 @@ class LabelPropagationRefiner final : public IRefiner {
     _current_num_edges(kInvalidHyperedge),
     _gain(context),
     _active_nodes(),
+    _next_active_nodes(),
+    _rebalance_moves(),
     _active_node_was_moved(2 * num_hypernodes, uint8_t(false)),
     _old_part(_context.refinement.label_propagation.unconstrained || context.refinement.global.lp_unconstrained ? num_hypernodes : 0, kInvalidPartition),
     _old_part_is_initialized(_context.refinement.label_propagation.unconstrained || context.refinement.global.lp_unconstrained ? num_hypernodes : 0),
@@ -95,7 +98,9 @@ class LabelPropagationRefiner final : public IRefiner {
                   Metrics& best_metrics,
                   double) final ;
 
-  void labelPropagation(PartitionedHypergraph& phg, Metrics& best_metrics);
+  void labelPropagation(PartitionedHypergraph& phg,
+                        const parallel::scalable_vector<HypernodeID>& refinement_nodes,
+                        Metrics& best_metrics);
 
   bool labelPropagationRound(PartitionedHypergraph& hypergraph,
                              NextActiveNodes& next_active_nodes,
@@ -160,17 +165,19 @@ class LabelPropagationRefiner final : public IRefiner {
 
     // Set all neighbors of the vertex to active
     if constexpr (Hypergraph::is_graph) {
-      for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+      utils::forEachWithLookahead(hypergraph.incidentEdges(hn), [&](const HyperedgeID& he) {
+        hypergraph.prefetchPartID(hypergraph.edgeTarget(he));
+      }, [&](const HyperedgeID& he) {
         activate(hypergraph.edgeTarget(he));
-      }
+      });
     } else {
       for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
         if ( hypergraph.edgeSize(he) <=
               ID(_context.refinement.label_propagation.hyperedge_size_activation_threshold) ) {
           if ( !_visited_he[he] ) {
-            for (const HypernodeID& pin : hypergraph.pins(he)) {
-              activate(pin);
-            }
+            utils::forEachWithLookahead(hypergraph.pins(he), [&](const HypernodeID& pin) {
+              hypergraph.prefetchPartID(pin);
+            }, activate);
             _visited_he.set(he, true);
           }
         }
@@ -204,6 +211,8 @@ class LabelPropagationRefiner final : public IRefiner {
   HyperedgeID _current_num_edges;
   GainCalculator _gain;
   ActiveNodes _active_nodes;
+  NextActiveNodes _next_active_nodes;
+  vec<Move> _rebalance_moves;
   parallel::scalable_vector<uint8_t> _active_node_was_moved;
   parallel::scalable_vector<PartitionID> _old_part;
   kahypar::ds::FastResetFlagArray<> _old_part_is_initialized;
@@ -164,44 +164,54 @@ namespace impl {
       _target_part[v] = newTarget;
     }
 
-    bool checkCandidate(HypernodeID u, float& gain_in_pq) {
-      if (!_node_state[u].tryLock()) return false;
+    enum class Candidate : uint8_t { accepted, stale, locked };
+
+    Candidate checkCandidate(HypernodeID u, float& gain_in_pq) {
+      if (!_node_state[u].tryLock()) return Candidate::locked;
       auto [to, true_gain] = computeBestTargetBlock(_phg, _context, _gain_cache, u, _phg.partID(u));
       if (true_gain >= gain_in_pq) {
         next_move.node = u;
         next_move.to = to;
         next_move.from = _phg.partID(u);
         next_move.gain = true_gain;
-        return true;
+        return Candidate::accepted;
       } else {
         _target_part[u] = to;
         gain_in_pq = true_gain;
         _node_state[u].unlock();
-        return false;
+        return Candidate::stale;
       }
     }
 
     bool lockedModifyPQ(size_t best_id) {
+      // Maximum number of entries inspected per lock acquisition
+      static constexpr size_t MAX_ENTRIES_PER_LOCK = 8;
       auto& gpq = _pqs[best_id];
       auto& pq = gpq.pq;
 
-      HypernodeID node = pq.top();
-      float gain_in_pq = pq.topKey();
-      const bool success = checkCandidate(node, gain_in_pq);
-
-      if (success) {
-        pq.deleteTop();
-        gpq.top_key = pq.empty() ? std::numeric_limits<float>::min() : pq.topKey();
-      } else {
-        // gain was updated by success_func in this case
-        if (_target_part[node] != kInvalidPartition) {
-          pq.adjustKey(node, gain_in_pq);
-          gpq.top_key = pq.topKey();
-        } else {
+      // Entries with outdated gains are repaired while we hold the lock. Otherwise,
+      // each of them would require to sample and lock a PQ again.
+      bool success = false;
+      for (size_t i = 0; i < MAX_ENTRIES_PER_LOCK && !success && !pq.empty(); ++i) {
+        HypernodeID node = pq.top();
+        float gain_in_pq = pq.topKey();
+        const Candidate candidate = checkCandidate(node, gain_in_pq);
+        if (candidate == Candidate::accepted) {
           pq.deleteTop();
-          gpq.top_key = pq.empty() ? std::numeric_limits<float>::min() : pq.topKey();
+          success = true;
+        } else if (candidate == Candidate::stale) {
+          // gain was updated by checkCandidate in this case
+          if (_target_part[node] != kInvalidPartition) {
+            pq.adjustKey(node, gain_in_pq);
+          } else {
+            pq.deleteTop();
+          }
+        } else {
+          // node is currently updated by another thread
+          break;
         }
       }
+      gpq.top_key = pq.empty() ? std::numeric_limits<float>::min() : pq.topKey();
       gpq.lock.unlock();
       return success;
     }
@@ -215,7 +225,7 @@ namespace impl {
         if (first.pq.empty() && second.pq.empty()) continue;
         size_t best_id = two[0];
         if (first.pq.empty() || first.top_key < second.top_key) best_id = two[1];
-        if (!_pqs[best_id].lock.tryLock()) continue;
+        if (!_pqs[best_id].tryLock()) continue;
         // could also check for top key. would want to distinguish tries that failed due to high contention
         // vs approaching the end
         if (_pqs[best_id].pq.empty()) {
@@ -238,7 +248,7 @@ namespace impl {
           }
         }
         if (best_id == -1) return false;
-        if (!_pqs[best_id].lock.tryLock()) continue;
+        if (!_pqs[best_id].tryLock()) continue;
         if (_pqs[best_id].pq.empty()) {
           _pqs[best_id].lock.unlock();
           continue;
@@ -301,7 +311,7 @@ namespace impl {
       int my_pq_id = -1;
       while (true) {
         my_pq_id = token.getRandomPQ();
-        if (_pqs[my_pq_id].lock.tryLock()) {
+        if (_pqs[my_pq_id].tryLock()) {
           break;
         }
       }
@@ -39,8 +39,16 @@ namespace rebalancer {
   struct GuardedPQ {
     GuardedPQ(PosT *handles, size_t num_nodes) : pq(handles, num_nodes) { }
     SpinLock lock;
-    ds::MaxHeap<float, HypernodeID> pq;
+    ds::MaxHeap<float, HypernodeID, 4> pq;
     float top_key = std::numeric_limits<float>::min();
+    bool tryLock() {
+      if (lock.tryLock()) {
+        parallel::ContentionStats::recordAcquisition(parallel::ContentionSite::rebalancer_pq, 0);
+        return true;
+      }
+      parallel::ContentionStats::recordFailedTryLock(parallel::ContentionSite::rebalancer_pq);
+      return false;
+    }
     void reset() {
       pq.clear();
       top_key = std::numeric_limits<float>::min();
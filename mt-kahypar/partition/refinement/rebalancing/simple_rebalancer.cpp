@@ -30,9 +30,9 @@
 
 #include <boost/dynamic_bitset.hpp>
 
-#include <tbb/parallel_for_each.h>
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/metrics.h"
@@ -42,6 +42,77 @@
 
 namespace mt_kahypar {
 
+  namespace {
+  // Orders moves by gain per weight: a heavy node is preferred
+  // if its move improves the objective and penalized otherwise
+  float gainPerWeight(const Gain gain, const HypernodeWeight weight) {
+    float priority = gain;
+    if ( gain > 0 ) {
+      priority /= weight;
+    } else if ( gain < 0 ) {
+      priority *= weight;
+    }
+    return priority;
+  }
+  } // namespace
+
+  template <typename GraphAndGainTypes>
+  template <typename F>
+  size_t SimpleRebalancer<GraphAndGainTypes>::bulkRebalancingRound(PartitionedHypergraph& phg,
+                                                                   const F& objective_delta) {
+    const PartitionID k = _context.partition.k;
+    for ( PartitionID block = 0; block < k; ++block ) {
+      _tmp_moves[block].clear_sequential();
+    }
+
+    // Compute the best rebalancing move for each node of an overloaded block
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      const PartitionID from = phg.partID(hn);
+      if ( !phg.isFixed(hn) && _part_weights[from] > _context.partition.max_part_weights[from] ) {
+        Move move = _gain.computeMaxGainMove(phg, hn, true /* rebalance move */);
+        if ( move.gain == std::numeric_limits<Gain>::max() ) {
+          // Compute move to non-adjacent block
+          move = _gain.computeMaxGainMove(phg, hn,
+            true /* rebalance move */, true /* non-adjacent block */);
+        }
+        if ( move.from != move.to && move.gain != std::numeric_limits<Gain>::max() ) {
+          _tmp_moves[from].stream(move);
+        }
+      }
+    });
+
+    // For each overloaded block, we select the prefix of the moves sorted by
+    // gain per weight that covers its excess weight and apply it in parallel.
+    // The target blocks are protected against overloading by moveVertex(...).
+    std::atomic<size_t> num_moves(0);
+    tbb::parallel_for(0, k, [&](const PartitionID block) {
+      const HypernodeWeight excess = _part_weights[block] - _context.partition.max_part_weights[block];
+      if ( excess <= 0 || _tmp_moves[block].size() == 0 ) {
+        return;
+      }
+      vec<Move>& moves = _moves[block];
+      _tmp_moves[block].copy_parallel(moves);
+      tbb::parallel_sort(moves.begin(), moves.end(), [&](const Move& lhs, const Move& rhs) {
+        const float lhs_priority = gainPerWeight(lhs.gain, phg.nodeWeight(lhs.node));
+        const float rhs_priority = gainPerWeight(rhs.gain, phg.nodeWeight(rhs.node));
+        return lhs_priority < rhs_priority || (lhs_priority == rhs_priority && lhs.node < rhs.node);
+      });
+
+      size_t num_selected = 0;
+      HypernodeWeight selected_weight = 0;
+      for ( ; num_selected < moves.size() && selected_weight < excess; ++num_selected ) {
+        selected_weight += phg.nodeWeight(moves[num_selected].node);
+      }
+
+      tbb::parallel_for(UL(0), num_selected, [&](const size_t i) {
+        if ( moveVertex(phg, moves[i].node, moves[i], objective_delta) ) {
+          ++num_moves;
+        }
+      });
+    });
+    return num_moves.load();
+  }
+
   template <typename GraphAndGainTypes>
   bool SimpleRebalancer<GraphAndGainTypes>::refineImpl(mt_kahypar_partitioned_hypergraph_t& hypergraph,
                                                     const vec<HypernodeID>&,
@@ -73,12 +144,6 @@ namespace mt_kahypar {
       }
 
       // We first try to perform moves that does not worsen solution quality of the partition
-      // Moves that would worsen the solution quality are gathered in a thread local priority queue
-      // and processed afterwards if partition is still imbalanced
-      std::atomic<size_t> idx(0);
-      tbb::enumerable_thread_specific<IndexedMovePQ> move_pqs([&] {
-        return IndexedMovePQ(idx++);
-      });
       phg.doParallelForAllNodes([&](const HypernodeID& hn) {
         const PartitionID from = phg.partID(hn);
         if ( phg.isBorderNode(hn) && !phg.isFixed(hn) &&
@@ -86,15 +151,6 @@ namespace mt_kahypar {
           Move rebalance_move = _gain.computeMaxGainMove(phg, hn, true /* rebalance move */);
           if ( rebalance_move.gain <= 0 ) {
             moveVertex(phg, hn, rebalance_move, objective_delta);
-          } else if ( rebalance_move.gain != std::numeric_limits<Gain>::max() ) {
-            move_pqs.local().pq.emplace(std::move(rebalance_move));
-          } else {
-            // Try to find a move to an non-adjacent block
-            rebalance_move = _gain.computeMaxGainMove(phg, hn,
-              true /* rebalance move */, true /* non-adjacent block */ );
-            if ( rebalance_move.gain != std::numeric_limits<Gain>::max() ) {
-              move_pqs.local().pq.emplace(std::move(rebalance_move));
-            }
           }
         }
       });
@@ -108,71 +164,12 @@ namespace mt_kahypar {
         return true;
       }(), "Rebalancer part weights are wrong");
 
-      // If partition is still imbalanced, we try execute moves stored into
-      // the thread local priority queue which could possibly worsen solution quality
-      if ( !metrics::isBalanced(phg, _context) ) {
-
-        // Initialize minimum gain value of each priority queue
-        parallel::scalable_vector<uint8_t> active_pqs(idx.load(), false);
-        parallel::scalable_vector<Gain> min_pq_gain(idx.load(),
-          std::numeric_limits<Gain>::max() - MIN_PQ_GAIN_THRESHOLD);
-        for ( const IndexedMovePQ& idx_pq : move_pqs ) {
-          if ( !idx_pq.pq.empty() ) {
-            min_pq_gain[idx_pq.idx] = idx_pq.pq.top().gain;
-          }
+      // If partition is still imbalanced, we execute moves that possibly worsen
+      // solution quality in bulk rounds
+      for ( size_t round = 0; round < MAX_BULK_ROUNDS && !metrics::isBalanced(phg, _context); ++round ) {
+        if ( bulkRebalancingRound(phg, objective_delta) == 0 ) {
+          break;
         }
-
-        // Function returns minimum gain value of all priority queues
-        auto global_pq_min_gain = [&](const bool only_active_pqs) {
-          Gain min_gain = std::numeric_limits<Gain>::max() - MIN_PQ_GAIN_THRESHOLD;
-          for ( size_t i = 0; i < min_pq_gain.size(); ++i ) {
-            if ( (!only_active_pqs || active_pqs[i]) && min_pq_gain[i] < min_gain ) {
-              min_gain = min_pq_gain[i];
-            }
-          }
-          return min_gain;
-        };
-
-        // We process each priority queue in parallel. When we perform
-        // a move we make sure that the current minimum gain value of the local
-        // PQ is within a certain threshold of the global minimum gain value.
-        // Otherwise, we perform busy waiting until all moves with a better gain
-        // are processed.
-        tbb::parallel_for_each(move_pqs, [&](IndexedMovePQ& idx_pq) {
-          const size_t idx = idx_pq.idx;
-          MovePQ& pq = idx_pq.pq;
-          active_pqs[idx] = true;
-          Gain current_global_min_pq_gain = global_pq_min_gain(false);
-          while ( !pq.empty() ) {
-            Move move = pq.top();
-            min_pq_gain[idx] = move.gain;
-            pq.pop();
-
-            // If the minimum gain value of the local priority queue is not within
-            // a certain threshold of the global priority queue, we perform busy waiting
-            // until all moves with a better gain of other pqs are performed.
-            while ( move.gain > current_global_min_pq_gain + MIN_PQ_GAIN_THRESHOLD ) {
-              current_global_min_pq_gain = global_pq_min_gain(true);
-            }
-
-            const PartitionID from = move.from;
-            if ( phg.partWeight(from) > _context.partition.max_part_weights[from] ) {
-              Move real_move = _gain.computeMaxGainMove(phg, move.node, true /* rebalance move */);
-              if ( real_move.gain == std::numeric_limits<Gain>::max() ) {
-                // Compute move to non-adjacent block
-                real_move = _gain.computeMaxGainMove(phg, move.node,
-                  true /* rebalance move */, true /* non-adjacent block */);
-              }
-              if ( real_move.gain <= move.gain ) {
-                moveVertex(phg, real_move.node, real_move, objective_delta);
-              } else if ( real_move.gain != std::numeric_limits<Gain>::max() ) {
-                pq.emplace(std::move(real_move));
-              }
-            }
-          }
-          active_pqs[idx] = false;
-          min_pq_gain[idx] = std::numeric_limits<Gain>::max() - MIN_PQ_GAIN_THRESHOLD;
-        });
       }
 
       // Update metrics statistics
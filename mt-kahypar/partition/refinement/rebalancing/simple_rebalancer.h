@@ -27,8 +27,9 @@
 
 #pragma once
 
-#include <queue>
+#include <algorithm>
 
+#include "mt-kahypar/datastructures/streaming_vector.h"
 #include "mt-kahypar/partition/context.h"
 #include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/refinement/i_refiner.h"
@@ -51,7 +52,9 @@ class SimpleRebalancer final : public IRebalancer {
   static constexpr bool debug = false;
   static constexpr bool enable_heavy_assert = false;
 
-  static constexpr Gain MIN_PQ_GAIN_THRESHOLD = 5;
+  // ! Maximum number of bulk rebalancing rounds. Each round only fails to rebalance a block
+  // ! if the target blocks of the selected moves run full concurrently.
+  static constexpr size_t MAX_BULK_ROUNDS = 10;
 
 public:
 
@@ -61,22 +64,13 @@ public:
     }
   };
 
-  using MovePQ = std::priority_queue<Move, vec<Move>, MoveGainComparator>;
-
-  struct IndexedMovePQ {
-    explicit IndexedMovePQ(const size_t idx) :
-      idx(idx),
-      pq() { }
-
-    size_t idx;
-    MovePQ pq;
-  };
-
   explicit SimpleRebalancer(const Context& context) :
     _context(context),
     _current_k(context.partition.k),
     _gain(context),
-    _part_weights(_context.partition.k) { }
+    _part_weights(_context.partition.k),
+    _tmp_moves(_context.partition.k),
+    _moves(_context.partition.k) { }
 
   explicit SimpleRebalancer(HypernodeID , const Context& context, GainCache&) :
     SimpleRebalancer(context) { }
@@ -117,6 +111,12 @@ public:
 
 private:
 
+  // ! Collects the best rebalancing move of each node in an overloaded block and
+  // ! executes per block the moves with the best gain per weight until the excess
+  // ! weight of the block is covered. Returns the number of executed moves.
+  template<typename F>
+  size_t bulkRebalancingRound(PartitionedHypergraph& phg, const F& objective_delta);
+
   template<typename F>
   bool moveVertex(PartitionedHypergraph& phg,
                   const HypernodeID hn,
@@ -151,6 +151,8 @@ private:
       _current_k = _context.partition.k;
       _gain.changeNumberOfBlocks(_current_k);
       _part_weights = parallel::scalable_vector<AtomicWeight>(_context.partition.k);
+      _tmp_moves = parallel::scalable_vector<ds::StreamingVector<Move>>(_context.partition.k);
+      _moves.resize(_context.partition.k);
     }
   }
 
@@ -158,6 +160,8 @@ private:
   PartitionID _current_k;
   GainCalculator _gain;
   parallel::scalable_vector<AtomicWeight> _part_weights;
+  parallel::scalable_vector<ds::StreamingVector<Move>> _tmp_moves;
+  parallel::scalable_vector<vec<Move>> _moves;
 };
 
 }  // namespace kahypar
@@ -47,44 +47,91 @@ namespace mt_kahypar {
       }
       return 0;
     }
+
+    template<typename Hypergraph>
+    MemoryPoolDimensions dimensions_of(const Hypergraph& hypergraph) {
+      MemoryPoolDimensions dimensions;
+      dimensions.num_hypernodes = hypergraph.initialNumNodes();
+      dimensions.num_hyperedges = hypergraph.initialNumEdges();
+      dimensions.num_pins = hypergraph.initialNumPins();
+      dimensions.max_edge_size = hypergraph.maxEdgeSize();
+      return dimensions;
+    }
+
+    template<typename Hypergraph>
+    void register_memory_chunks(const MemoryPoolDimensions& dimensions,
+                                const Context& context);
   }
 
-  void register_memory_pool(const mt_kahypar_hypergraph_t hypergraph,
-                            const Context& context) {
+  MemoryPoolDimensions memory_pool_dimensions(const mt_kahypar_hypergraph_t hypergraph) {
     if ( hypergraph.type == STATIC_GRAPH ) {
-      register_memory_pool(utils::cast_const<ds::StaticGraph>(hypergraph), context);
+      return dimensions_of(utils::cast_const<ds::StaticGraph>(hypergraph));
     } else if ( hypergraph.type == DYNAMIC_GRAPH ) {
-      register_memory_pool(utils::cast_const<ds::DynamicGraph>(hypergraph), context);
+      return dimensions_of(utils::cast_const<ds::DynamicGraph>(hypergraph));
     } else if ( hypergraph.type == STATIC_HYPERGRAPH ) {
-      register_memory_pool(utils::cast_const<ds::StaticHypergraph>(hypergraph), context);
+      return dimensions_of(utils::cast_const<ds::StaticHypergraph>(hypergraph));
     } else if ( hypergraph.type == DYNAMIC_HYPERGRAPH ) {
-      register_memory_pool(utils::cast_const<ds::DynamicHypergraph>(hypergraph), context);
+      return dimensions_of(utils::cast_const<ds::DynamicHypergraph>(hypergraph));
+    }
+    return MemoryPoolDimensions();
+  }
+
+  void register_memory_pool(const mt_kahypar_hypergraph_t hypergraph,
+                            const Context& context) {
+    register_memory_pool(hypergraph.type, memory_pool_dimensions(hypergraph), context);
+  }
+
+  void register_memory_pool(const mt_kahypar_hypergraph_type_t type,
+                            const MemoryPoolDimensions& dimensions,
+                            const Context& context) {
+    if ( type == STATIC_GRAPH ) {
+      register_memory_chunks<ds::StaticGraph>(dimensions, context);
+    } else if ( type == DYNAMIC_GRAPH ) {
+      register_memory_chunks<ds::DynamicGraph>(dimensions, context);
+    } else if ( type == STATIC_HYPERGRAPH ) {
+      register_memory_chunks<ds::StaticHypergraph>(dimensions, context);
+    } else if ( type == DYNAMIC_HYPERGRAPH ) {
+      register_memory_chunks<ds::DynamicHypergraph>(dimensions, context);
     }
   }
 
   template<typename Hypergraph>
   void register_memory_pool(const Hypergraph& hypergraph,
                             const Context& context) {
+    register_memory_chunks<Hypergraph>(dimensions_of(hypergraph), context);
+  }
+
+  namespace {
+  template<typename Hypergraph>
+  void register_memory_chunks(const MemoryPoolDimensions& dimensions,
+                              const Context& context) {
 
     if (context.partition.mode == Mode::direct ||
         context.partition.mode == Mode::deep_multilevel ) {
 
       // ########## Preprocessing Memory ##########
 
-      const HypernodeID num_hypernodes = hypergraph.initialNumNodes();
-      const HyperedgeID num_hyperedges = hypergraph.initialNumEdges();
-      const HypernodeID num_pins = hypergraph.initialNumPins();
+      const HypernodeID num_hypernodes = dimensions.num_hypernodes;
+      const HyperedgeID num_hyperedges = dimensions.num_hyperedges;
+      const HypernodeID num_pins = dimensions.num_pins;
 
       auto& pool = parallel::MemoryPool::instance();
 
-      if ( context.preprocessing.use_community_detection ) {
-        const bool is_graph = hypergraph.maxEdgeSize() == 2;
+      if ( context.preprocessing.use_community_detection &&
+           context.preprocessing.community_detection_algorithm == CommunityDetectionAlgorithm::louvain ) {
+        const bool is_graph = dimensions.max_edge_size == 2;
         const size_t num_star_expansion_nodes = num_hypernodes + (is_graph ? 0 : num_hyperedges);
         const size_t num_star_expansion_edges = is_graph ? num_pins : (2UL * num_pins);
 
+        // The implicit bipartite graph view does not store any arcs
+        const bool use_bipartite_graph_view = std::is_same_v<Hypergraph, ds::StaticHypergraph> &&
+          !is_graph && context.preprocessing.community_detection.low_memory_contraction;
+
         pool.register_memory_group("Preprocessing", 1);
-        pool.register_memory_chunk("Preprocessing", "indices", num_star_expansion_nodes + 1, sizeof(size_t));
-        pool.register_memory_chunk("Preprocessing", "arcs", num_star_expansion_edges, sizeof(Arc));
+        if ( !use_bipartite_graph_view ) {
+          pool.register_memory_chunk("Preprocessing", "indices", num_star_expansion_nodes + 1, sizeof(size_t));
+          pool.register_memory_chunk("Preprocessing", "arcs", num_star_expansion_edges, sizeof(Arc));
+        }
         pool.register_memory_chunk("Preprocessing", "node_volumes", num_star_expansion_nodes, sizeof(ArcWeight));
 
         if ( !context.preprocessing.community_detection.low_memory_contraction ) {
@@ -134,6 +181,7 @@ namespace mt_kahypar {
       pool.register_memory_chunk("Refinement", "part_ids", num_hypernodes, sizeof(PartitionID));
 
       if (Hypergraph::is_graph) {
+        pool.register_memory_chunk("Refinement", "node_moves", num_hypernodes, sizeof(uint64_t));
         pool.register_memory_chunk("Refinement", "edge_sync", num_hyperedges, size_of_edge_sync<Hypergraph>());
         pool.register_memory_chunk("Refinement", "edge_locks", num_hyperedges, sizeof(SpinLock));
         if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
@@ -142,8 +190,8 @@ namespace mt_kahypar {
                                     sizeof(CAtomic<HyperedgeWeight>));
         }
       } else {
-        const HypernodeID max_he_size = hypergraph.maxEdgeSize();
-        if ( context.partition.preset_type == PresetType::large_k ) {
+        const HypernodeID max_he_size = dimensions.max_edge_size;
+        if ( context.partition.partition_type == LARGE_K_PARTITIONING ) {
           pool.register_memory_chunk("Refinement", "pin_count_in_part",
                                     ds::SparsePinCounts::num_elements(num_hyperedges, context.partition.k, max_he_size),
                                     sizeof(ds::SparsePinCounts::Value));
@@ -163,7 +211,9 @@ namespace mt_kahypar {
             pool.register_memory_chunk("Refinement", "num_incident_edges_of_block",
                                       static_cast<size_t>(num_hypernodes) * context.partition.k,
                                       sizeof(CAtomic<HyperedgeID>));
-          } else {
+          } else if ( context.partition.gain_policy != GainPolicy::km1_sparse ) {
+            // The size of the sparse gain cache depends on the current level
+            // of the multilevel hierarchy. It therefore allocates its memory on demand.
             pool.register_memory_chunk("Refinement", "gain_cache",
                                       static_cast<size_t>(num_hypernodes) * ( context.partition.k + 1 ),
                                       sizeof(CAtomic<HyperedgeWeight>));
@@ -180,6 +230,7 @@ namespace mt_kahypar {
       timer.stop_timer("memory_pool_allocation");
     }
   }
+  } // namespace
 
   namespace {
   #define REGISTER_MEMORY_POOL(X) void register_memory_pool(const X& hypergraph, const Context& context)
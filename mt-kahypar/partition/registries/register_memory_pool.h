@@ -31,8 +31,31 @@
 
 namespace mt_kahypar {
 
+// ! Instance sizes that determine the size of the memory chunks
+struct MemoryPoolDimensions {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_pins = 0;
+  HypernodeID max_edge_size = 0;
+
+  // ! Returns true, if memory chunks registered for these dimensions
+  // ! are large enough for an instance with the other dimensions
+  bool contains(const MemoryPoolDimensions& other) const {
+    return num_hypernodes >= other.num_hypernodes && num_hyperedges >= other.num_hyperedges &&
+           num_pins >= other.num_pins && max_edge_size >= other.max_edge_size;
+  }
+};
+
+MemoryPoolDimensions memory_pool_dimensions(const mt_kahypar_hypergraph_t hypergraph);
+
 void register_memory_pool(const mt_kahypar_hypergraph_t hypergraph, const Context& context);
 
+// ! Registers and allocates the memory chunks for an instance of the
+// ! given type that is at most as large as the given dimensions
+void register_memory_pool(const mt_kahypar_hypergraph_type_t type,
+                          const MemoryPoolDimensions& dimensions,
+                          const Context& context);
+
 template<typename Hypergraph>
 void register_memory_pool(const Hypergraph& hypergraph, const Context& context);
 
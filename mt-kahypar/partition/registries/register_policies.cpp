@@ -97,6 +97,9 @@ void register_policies() {
   // //////////////////////////////////////////////////////////////////////////////
   REGISTER_POLICY(GainPolicy, GainPolicy::km1, Km1GainTypes);
   REGISTER_POLICY(GainPolicy, GainPolicy::cut, CutGainTypes);
+  #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+  REGISTER_POLICY(GainPolicy, GainPolicy::km1_sparse, SparseKm1GainTypes);
+  #endif
   #ifdef KAHYPAR_ENABLE_SOED_METRIC
   REGISTER_POLICY(GainPolicy, GainPolicy::soed, SoedGainTypes);
   #endif
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "register_coarsening_algorithms.h"
 #include "register_initial_partitioning_algorithms.h"
 #include "register_policies.h"
@@ -34,10 +36,15 @@
 namespace mt_kahypar {
 
 void register_algorithms_and_policies() {
+  // Registering is idempotent, but repeated calls (e.g., one per initialization
+  // of the library) would unnecessarily rebuild all factory maps
+  static std::once_flag registered;
+  std::call_once(registered, [] {
     register_coarsening_algorithms();
     register_initial_partitioning_algorithms();
     register_refinement_algorithms();
     register_policies();
+  });
 }
 
 } // namespace mt_kahypar
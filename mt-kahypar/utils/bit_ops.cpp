@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/utils/bit_ops.h"
+
+// The function multiversioning of GCC and Clang generates one clone per target and an
+// ifunc resolver, which selects the best clone based on CPUID when the symbol is bound.
+#if defined(KAHYPAR_ENABLE_RUNTIME_CPU_DISPATCH) && defined(__x86_64__) && defined(__linux__)
+#define KAHYPAR_TARGET_CLONES \
+  __attribute__((target_clones("arch=icelake-server", "arch=haswell", "popcnt", "default")))
+#else
+#define KAHYPAR_TARGET_CLONES
+#endif
+
+namespace mt_kahypar::utils::detail {
+
+KAHYPAR_TARGET_CLONES
+int popcount_blocks_kernel(const uint64_t* blocks, const size_t num_blocks) {
+  int cnt = 0;
+  for ( size_t i = 0; i < num_blocks; ++i ) {
+    cnt += __builtin_popcountll(blocks[i]);
+  }
+  return cnt;
+}
+
+KAHYPAR_TARGET_CLONES
+int xor_popcount_blocks_kernel(const uint64_t* lhs, const uint64_t* rhs, const size_t num_blocks) {
+  int cnt = 0;
+  for ( size_t i = 0; i < num_blocks; ++i ) {
+    cnt += __builtin_popcountll(lhs[i] ^ rhs[i]);
+  }
+  return cnt;
+}
+
+}  // namespace mt_kahypar::utils::detail
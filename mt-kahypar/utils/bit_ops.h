@@ -27,15 +27,64 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
+#include "mt-kahypar/utils/cpu_features.h"
+
+// Without -mpopcnt (portable build flags), __builtin_popcountll is a call into libgcc.
+// With runtime dispatch, we use the POPCNT instruction if the CPU supports it.
+#if defined(KAHYPAR_ENABLE_RUNTIME_CPU_DISPATCH) && defined(__x86_64__) && !defined(__POPCNT__)
+#define KAHYPAR_DISPATCH_POPCNT
+#endif
+
 namespace mt_kahypar::utils {
 
 inline int popcount_64(const uint64_t x) {
+#ifdef KAHYPAR_DISPATCH_POPCNT
+  if ( __builtin_expect(cpu_has_popcnt, 1) ) {
+    uint64_t cnt;
+    __asm__("popcntq %1, %0" : "=r"(cnt) : "rm"(x) : "cc");
+    return static_cast<int>(cnt);
+  }
+#endif
   // this should be GCC specific
   return __builtin_popcountll(x);
 }
 
+namespace detail {
+// ! Kernels for larger bitsets. If runtime dispatch is enabled, they are compiled
+// ! for several instruction sets (e.g., AVX-512 VPOPCNTDQ) and the variant is
+// ! selected on the first call based on CPUID (see bit_ops.cpp).
+int popcount_blocks_kernel(const uint64_t* blocks, const size_t num_blocks);
+int xor_popcount_blocks_kernel(const uint64_t* lhs, const uint64_t* rhs, const size_t num_blocks);
+} // namespace detail
+
+// ! Returns the number of one bits in the given blocks
+inline int popcount_blocks(const uint64_t* blocks, const size_t num_blocks) {
+  if ( num_blocks <= 2 ) {
+    // Small bitsets (k <= 128) are the common case, where a call does not pay off
+    int cnt = 0;
+    for ( size_t i = 0; i < num_blocks; ++i ) {
+      cnt += popcount_64(blocks[i]);
+    }
+    return cnt;
+  }
+  return detail::popcount_blocks_kernel(blocks, num_blocks);
+}
+
+// ! Returns the number of one bits in lhs XOR rhs
+inline int xor_popcount_blocks(const uint64_t* lhs, const uint64_t* rhs, const size_t num_blocks) {
+  if ( num_blocks <= 2 ) {
+    int cnt = 0;
+    for ( size_t i = 0; i < num_blocks; ++i ) {
+      cnt += popcount_64(lhs[i] ^ rhs[i]);
+    }
+    return cnt;
+  }
+  return detail::xor_popcount_blocks_kernel(lhs, rhs, num_blocks);
+}
+
 inline int lowest_set_bit_64(const uint64_t x) {
   return __builtin_ctzll(x);
 }
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/utils/cpu_features.h"
+
+namespace mt_kahypar::utils {
+
+namespace {
+CpuFeatures detectCpuFeatures() {
+  CpuFeatures features;
+  #if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  __builtin_cpu_init();
+  features.popcnt = __builtin_cpu_supports("popcnt");
+  features.bmi2 = __builtin_cpu_supports("bmi2");
+  features.avx2 = __builtin_cpu_supports("avx2");
+  features.avx512f = __builtin_cpu_supports("avx512f");
+  features.avx512vpopcntdq = __builtin_cpu_supports("avx512vpopcntdq");
+  #endif
+  return features;
+}
+} // namespace
+
+const CpuFeatures& cpuFeatures() {
+  static const CpuFeatures features = detectCpuFeatures();
+  return features;
+}
+
+std::string cpuFeaturesToString(const CpuFeatures& features) {
+  std::string result;
+  auto add = [&](const bool supported, const char* name) {
+    if ( supported ) {
+      result += result.empty() ? name : std::string(", ") + name;
+    }
+  };
+  add(features.popcnt, "popcnt");
+  add(features.bmi2, "bmi2");
+  add(features.avx2, "avx2");
+  add(features.avx512f, "avx512f");
+  add(features.avx512vpopcntdq, "avx512vpopcntdq");
+  return result.empty() ? "none" : result;
+}
+
+extern const bool cpu_has_popcnt = cpuFeatures().popcnt;
+
+}  // namespace mt_kahypar::utils
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <string>
+
+namespace mt_kahypar::utils {
+
+/*!
+ * Instruction set extensions of the CPU we are running on. The default build flags
+ * are portable, i.e., the compiler is not allowed to use instructions such as POPCNT
+ * or AVX2 in general code. If the cmake option KAHYPAR_ENABLE_RUNTIME_CPU_DISPATCH is
+ * enabled, the bit operation kernels in bit_ops.h are compiled for several instruction
+ * sets and the best variant is selected at startup based on these flags.
+ */
+struct CpuFeatures {
+  bool popcnt = false;
+  bool bmi2 = false;
+  bool avx2 = false;
+  bool avx512f = false;
+  bool avx512vpopcntdq = false;
+};
+
+// ! Detects the instruction set extensions of the CPU (the result is cached)
+const CpuFeatures& cpuFeatures();
+
+// ! Returns the supported instruction set extensions as a comma-separated list
+std::string cpuFeaturesToString(const CpuFeatures& features);
+
+// ! True, if popcount_64(...) uses the POPCNT instruction. This flag is
+// ! initialized during static initialization and is false before.
+extern const bool cpu_has_popcnt;
+
+}  // namespace mt_kahypar::utils
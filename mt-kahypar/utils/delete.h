@@ -32,10 +32,11 @@
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/coarsening/coarsening_hierarchy.h"
 
 namespace mt_kahypar::utils {
 
-void delete_hypergraph(mt_kahypar_hypergraph_t hg) {
+inline void delete_hypergraph(mt_kahypar_hypergraph_t hg) {
   if ( hg.hypergraph ) {
     switch ( hg.type ) {
       case STATIC_HYPERGRAPH: delete reinterpret_cast<ds::StaticHypergraph*>(hg.hypergraph); break;
@@ -48,7 +49,7 @@ void delete_hypergraph(mt_kahypar_hypergraph_t hg) {
   }
 }
 
-void delete_partitioned_hypergraph(mt_kahypar_partitioned_hypergraph_t phg) {
+inline void delete_partitioned_hypergraph(mt_kahypar_partitioned_hypergraph_t phg) {
   if ( phg.partitioned_hg ) {
     switch ( phg.type ) {
       case MULTILEVEL_HYPERGRAPH_PARTITIONING: delete reinterpret_cast<StaticPartitionedHypergraph*>(phg.partitioned_hg); break;
@@ -62,5 +63,17 @@ void delete_partitioned_hypergraph(mt_kahypar_partitioned_hypergraph_t phg) {
   }
 }
 
+inline void delete_hierarchy(mt_kahypar_hierarchy_t hierarchy) {
+  if ( hierarchy.hierarchy ) {
+    switch ( hierarchy.type ) {
+      case STATIC_HYPERGRAPH: delete reinterpret_cast<CoarseningHierarchy<ds::StaticHypergraph>*>(hierarchy.hierarchy); break;
+      ENABLE_GRAPHS(case STATIC_GRAPH: delete reinterpret_cast<CoarseningHierarchy<ds::StaticGraph>*>(hierarchy.hierarchy); break;)
+      case DYNAMIC_HYPERGRAPH:
+      case DYNAMIC_GRAPH:
+      case NULLPTR_HYPERGRAPH:
+      default: break;
+    }
+  }
+}
 
 }  // namespace mt_kahypar
\ No newline at end of file
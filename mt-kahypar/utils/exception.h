@@ -97,4 +97,15 @@ class SystemException : public MtKaHyParException<SystemException> {
     Base(what) { }
 };
 
+class CancellationException : public MtKaHyParException<CancellationException> {
+
+  using Base = MtKaHyParException<CancellationException>;
+
+ public:
+  static constexpr char TYPE[] = "Cancelled";
+
+  CancellationException(const std::string& what) :
+    Base(what) { }
+};
+
 }  // namespace mt_kahypar
\ No newline at end of file
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+#include <mutex>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <tbb/task_scheduler_observer.h>
+#endif
+
+namespace mt_kahypar {
+namespace utils {
+
+/*!
+ * Values of the hardware counters recorded for a timer scope. The counters are
+ * only recorded if Mt-KaHyPar is built with KAHYPAR_ENABLE_HARDWARE_COUNTERS.
+ */
+struct HardwareCounterValues {
+  enum Counter : uint8_t {
+    CYCLES = 0,
+    INSTRUCTIONS = 1,
+    CACHE_MISSES = 2,
+    BRANCH_MISSES = 3,
+    NUM_COUNTERS = 4
+  };
+
+  // ! Each cache miss transfers one cache line from memory
+  static constexpr uint64_t CACHE_LINE_SIZE = 64;
+
+  uint64_t cycles() const {
+    return values[CYCLES];
+  }
+
+  uint64_t instructions() const {
+    return values[INSTRUCTIONS];
+  }
+
+  uint64_t cacheMisses() const {
+    return values[CACHE_MISSES];
+  }
+
+  uint64_t branchMisses() const {
+    return values[BRANCH_MISSES];
+  }
+
+  double ipc() const {
+    return cycles() > 0 ? static_cast<double>(instructions()) / cycles() : 0.0;
+  }
+
+  // ! Estimated memory bandwidth in GB/s based on the last level cache misses
+  double bandwidth(const double seconds) const {
+    return seconds > 0 ? static_cast<double>(cacheMisses() * CACHE_LINE_SIZE) / seconds / 1e9 : 0.0;
+  }
+
+  HardwareCounterValues& operator+= (const HardwareCounterValues& other) {
+    for ( size_t i = 0; i < NUM_COUNTERS; ++i ) {
+      values[i] += other.values[i];
+    }
+    return *this;
+  }
+
+  HardwareCounterValues operator- (const HardwareCounterValues& other) const {
+    HardwareCounterValues result;
+    for ( size_t i = 0; i < NUM_COUNTERS; ++i ) {
+      // Counters of a thread can only grow, but the threads are read one after another
+      result.values[i] = values[i] > other.values[i] ? values[i] - other.values[i] : 0;
+    }
+    return result;
+  }
+
+  std::array<uint64_t, NUM_COUNTERS> values { };
+};
+
+#ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+/*!
+ * Opens a group of perf events (cycles, instructions, last level cache misses and
+ * branch misses) for each thread that participates in the TBB scheduler and sums up
+ * the counters of all threads on request. Thus, the counters of a timer scope include
+ * the work of all threads executed while the scope is active.
+ *
+ * If the perf events are not accessible (e.g., due to /proc/sys/kernel/perf_event_paranoid),
+ * all counters are reported as zero.
+ */
+class HardwareCounters : public tbb::task_scheduler_observer {
+
+  struct ReadFormat {
+    uint64_t nr;
+    uint64_t values[HardwareCounterValues::NUM_COUNTERS];
+  };
+
+ public:
+  static HardwareCounters& instance() {
+    static HardwareCounters instance;
+    return instance;
+  }
+
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters & operator= (const HardwareCounters &) = delete;
+
+  HardwareCounters(HardwareCounters&&) = delete;
+  HardwareCounters & operator= (HardwareCounters &&) = delete;
+
+  ~HardwareCounters() {
+    observe(false);
+    for ( const int fd : _fds ) {
+      close(fd);
+    }
+  }
+
+  void on_scheduler_entry(bool) override {
+    registerThread();
+  }
+
+  // ! Sum of the counters of all registered threads
+  HardwareCounterValues read() {
+    HardwareCounterValues result;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for ( const int fd : _group_fds ) {
+      ReadFormat data;
+      if ( ::read(fd, &data, sizeof(ReadFormat)) == static_cast<ssize_t>(sizeof(ReadFormat)) ) {
+        for ( size_t i = 0; i < HardwareCounterValues::NUM_COUNTERS; ++i ) {
+          result.values[i] += data.values[i];
+        }
+      }
+    }
+    return result;
+  }
+
+ private:
+  HardwareCounters() :
+    tbb::task_scheduler_observer(),
+    _mutex(),
+    _group_fds(),
+    _fds() {
+    registerThread();
+    observe(true);
+  }
+
+  void registerThread() {
+    static thread_local bool is_registered = false;
+    if ( !is_registered ) {
+      is_registered = true;
+      static constexpr std::array<uint64_t, HardwareCounterValues::NUM_COUNTERS> events = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+      std::array<int, HardwareCounterValues::NUM_COUNTERS> fds;
+      fds.fill(-1);
+      for ( size_t i = 0; i < events.size(); ++i ) {
+        fds[i] = open(events[i], fds[0]);
+        if ( fds[i] == -1 ) {
+          for ( size_t j = 0; j < i; ++j ) {
+            close(fds[j]);
+          }
+          return;
+        }
+      }
+      ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      std::lock_guard<std::mutex> lock(_mutex);
+      _group_fds.push_back(fds[0]);
+      _fds.insert(_fds.end(), fds.begin(), fds.end());
+    }
+  }
+
+  // ! Opens a counter for the calling thread on any CPU
+  static int open(const uint64_t event, const int group_fd) {
+    perf_event_attr attr { };
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(perf_event_attr);
+    attr.config = event;
+    attr.disabled = group_fd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+
+  std::mutex _mutex;
+  // ! Group leader of the counters of each registered thread
+  std::vector<int> _group_fds;
+  std::vector<int> _fds;
+};
+#endif
+
+}  // namespace utils
+}  // namespace mt_kahypar
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <random>
@@ -204,6 +205,66 @@ struct SimpleIntHash {
   }
 };
 
+//! Hash of a pin used by the footprints for identical net detection in the contraction
+template<typename T>
+struct SquareHash {
+  using hash_type = T;
+
+  T operator()(const T& x) const {
+    return x * x;
+  }
+};
+
+/*!
+ * Computes the footprints of several nets, where the footprint of a net is the seed plus
+ * the sum of the hashes of its pins (independent of the order of the pins). The pins of
+ * net i are stored in pins[offsets[i], offsets[i + 1]).
+ *
+ * The nets are processed in groups of num_lanes nets whose pins are hashed in lock-step,
+ * i.e., the j-th pin of all nets of a group is processed before the (j+1)-th pin. The
+ * loop over the lanes has no dependencies and a fixed trip count, which allows the compiler
+ * to vectorize it (gather of the pins, hashing and masked accumulation in SIMD lanes).
+ * This pays off for many small nets, for which a sequential reduction per net is dominated
+ * by loop overhead.
+ */
+template<size_t num_lanes = 8, typename Pin, typename Offset, typename Footprint, typename HashFunction>
+void batchedFootprints(const Pin* pins,
+                       const Offset* offsets,
+                       const size_t num_nets,
+                       const Footprint seed,
+                       const HashFunction& hash,
+                       Footprint* footprints) {
+  for ( size_t first = 0; first < num_nets; first += num_lanes ) {
+    const size_t num_active_lanes = std::min(num_lanes, num_nets - first);
+    std::array<Offset, num_lanes> begin { };
+    std::array<Offset, num_lanes> size { };
+    std::array<Footprint, num_lanes> footprint;
+    Offset max_size = 0;
+    for ( size_t lane = 0; lane < num_lanes; ++lane ) {
+      if ( lane < num_active_lanes ) {
+        size[lane] = offsets[first + lane + 1] - offsets[first + lane];
+        // Empty nets point to the first pin, since their begin might be out of bounds
+        begin[lane] = size[lane] > 0 ? offsets[first + lane] : 0;
+        max_size = std::max(max_size, size[lane]);
+      }
+      footprint[lane] = seed;
+    }
+
+    for ( Offset j = 0; j < max_size; ++j ) {
+      for ( size_t lane = 0; lane < num_lanes; ++lane ) {
+        // Lanes of smaller nets read a valid pin, but do not accumulate it
+        const bool is_active = j < size[lane];
+        const Pin pin = pins[begin[lane] + ( is_active ? j : 0 )];
+        footprint[lane] += is_active ? static_cast<Footprint>(hash(pin)) : 0;
+      }
+    }
+
+    for ( size_t lane = 0; lane < num_active_lanes; ++lane ) {
+      footprints[first + lane] = footprint[lane];
+    }
+  }
+}
+
 
 // implements the rng interface required for std::uniform_int_distribution
 template<typename HashFunction>
@@ -25,13 +25,17 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#pragma once
+
 #include <cstdint>
 #include <vector>
 
 #include <tbb/parallel_reduce.h>
 #include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
 
 namespace mt_kahypar {
 namespace utils {
@@ -75,5 +79,53 @@ static inline double avgHypernodeDegree(const Hypergraph& hypergraph) {
     return static_cast<double>(hypergraph.initialNumPins()) / hypergraph.initialNumNodes();
 }
 
+// ! Returns true, if all enabled hyperedges contain exactly two pins
+template<typename Hypergraph>
+bool isGraph(const Hypergraph& hypergraph) {
+    if (Hypergraph::is_graph) {
+        return true;
+    }
+    return tbb::parallel_reduce(tbb::blocked_range<HyperedgeID>(
+                    ID(0), hypergraph.initialNumEdges()), true, [&](const tbb::blocked_range<HyperedgeID>& range, bool isGraph) {
+        if ( isGraph ) {
+            bool tmp_is_graph = isGraph;
+            for (HyperedgeID he = range.begin(); he < range.end(); ++he) {
+                if ( hypergraph.edgeIsEnabled(he) ) {
+                    tmp_is_graph &= (hypergraph.edgeSize(he) == 2);
+                }
+            }
+            return tmp_is_graph;
+        }
+        return false;
+    }, [&](const bool lhs, const bool rhs) {
+        return lhs && rhs;
+    });
+}
+
+// ! Returns true, if the node degrees are nearly uniform (as in meshes)
+template<typename Hypergraph>
+bool isMeshGraph(const Hypergraph& graph) {
+    const HypernodeID num_nodes = graph.initialNumNodes();
+    const double avg_hn_degree = avgHypernodeDegree(graph);
+    std::vector<HyperedgeID> hn_degrees;
+    hn_degrees.resize(graph.initialNumNodes());
+    graph.doParallelForAllNodes([&](const HypernodeID& hn) {
+        hn_degrees[hn] = graph.nodeDegree(hn);
+    });
+    const double stdev_hn_degree = parallel_stdev(hn_degrees, avg_hn_degree, num_nodes);
+    if (stdev_hn_degree > avg_hn_degree / 2) {
+        return false;
+    }
+
+    // test whether 99.9th percentile hypernode degree is at most 4 times the average degree
+    tbb::enumerable_thread_specific<size_t> num_high_degree_nodes(0);
+    graph.doParallelForAllNodes([&](const HypernodeID& node) {
+        if (graph.nodeDegree(node) > 4 * avg_hn_degree) {
+            num_high_degree_nodes.local() += 1;
+        }
+    });
+    return num_high_degree_nodes.combine(std::plus<>()) <= num_nodes / 1000;
+}
+
 } // namespace utils
 } // namespace mt_kahypar
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include <tbb/concurrent_vector.h>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace mt_kahypar {
+namespace utils {
+
+/*!
+ * Samples the resident set size (RSS) of the process in a background thread.
+ * In contrast to the memory consumption of the data structures (see MemoryTreeNode),
+ * the samples also capture transient peaks caused by temporaries, thread-local
+ * storage and allocator fragmentation. The timer attributes the peak RSS observed
+ * while a scope is active to that scope.
+ *
+ * The allocation volume of a scope is measured as the number of bytes faulted into
+ * the process (minor page faults times page size), since the scalable allocator
+ * does not expose allocation counters. It includes memory that is freed and
+ * requested from the OS again, but not allocations served from memory that the
+ * allocator already holds.
+ *
+ * The sampler is only available on Linux. Otherwise, all values are zero.
+ */
+class MemorySampler {
+
+ public:
+  static MemorySampler& instance() {
+    static MemorySampler instance;
+    return instance;
+  }
+
+  MemorySampler(const MemorySampler&) = delete;
+  MemorySampler & operator= (const MemorySampler &) = delete;
+
+  MemorySampler(MemorySampler&&) = delete;
+  MemorySampler & operator= (MemorySampler &&) = delete;
+
+  ~MemorySampler() {
+    stop();
+  }
+
+  // ! Starts sampling the RSS every interval_ms milliseconds. Previous samples are discarded.
+  // ! Note, must not be called concurrently to start_timer(...) or stop_timer(...) of a timer
+  void start(const size_t interval_ms) {
+    stop();
+    _samples.clear();
+    _samples.push_back(readRSS());
+    _num_samples.store(1, std::memory_order_release);
+    _terminate = false;
+    _is_active.store(true, std::memory_order_release);
+    _sampler = std::thread([this, interval_ms] {
+      std::unique_lock<std::mutex> lock(_mutex);
+      while ( !_cv.wait_for(lock, std::chrono::milliseconds(std::max(interval_ms, size_t(1))),
+                            [&] { return _terminate; }) ) {
+        _samples.push_back(readRSS());
+        _num_samples.fetch_add(1, std::memory_order_release);
+      }
+    });
+  }
+
+  // ! Stops the background thread. The samples remain accessible.
+  void stop() {
+    if ( _sampler.joinable() ) {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+      }
+      _cv.notify_one();
+      _sampler.join();
+    }
+    _is_active.store(false, std::memory_order_release);
+  }
+
+  bool isActive() const {
+    return _is_active.load(std::memory_order_acquire);
+  }
+
+  // ! Index of the most recent sample (a timer scope records it at its start)
+  size_t currentSample() const {
+    return _num_samples.load(std::memory_order_acquire) - 1;
+  }
+
+  // ! Maximum RSS in bytes over all samples recorded since the given sample
+  size_t peakRSSSince(const size_t first_sample) const {
+    const size_t num_samples = _num_samples.load(std::memory_order_acquire);
+    size_t peak = 0;
+    for ( size_t i = std::min(first_sample, num_samples - 1); i < num_samples; ++i ) {
+      peak = std::max(peak, _samples[i]);
+    }
+    return peak;
+  }
+
+  // ! Current resident set size of the process in bytes
+  static size_t readRSS() {
+    #if defined(__linux__)
+    size_t rss = 0;
+    if ( FILE* file = std::fopen("/proc/self/statm", "r") ) {
+      unsigned long total_pages = 0;
+      unsigned long resident_pages = 0;
+      if ( std::fscanf(file, "%lu %lu", &total_pages, &resident_pages) == 2 ) {
+        rss = resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      }
+      std::fclose(file);
+    }
+    return rss;
+    #else
+    return 0;
+    #endif
+  }
+
+  // ! Number of bytes faulted into the process since its start (all threads)
+  static size_t faultedBytes() {
+    #if defined(__linux__)
+    rusage usage;
+    if ( getrusage(RUSAGE_SELF, &usage) == 0 ) {
+      return static_cast<size_t>(usage.ru_minflt) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    #endif
+    return 0;
+  }
+
+ private:
+  MemorySampler() :
+    _is_active(false),
+    _samples(),
+    _num_samples(0),
+    _sampler(),
+    _mutex(),
+    _cv(),
+    _terminate(false) { }
+
+  std::atomic<bool> _is_active;
+  // ! RSS samples in bytes. Samples are published by incrementing _num_samples
+  tbb::concurrent_vector<size_t> _samples;
+  std::atomic<size_t> _num_samples;
+  std::thread _sampler;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _terminate;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
@@ -54,6 +54,18 @@ class MemoryTreeNode {
 
   void finalize();
 
+  const std::string& name() const {
+    return _name;
+  }
+
+  size_t sizeInBytes() const {
+    return _size_in_bytes;
+  }
+
+  const map_type& children() const {
+    return _children;
+  }
+
  private:
 
   void dfs(std::ostream& str, const size_t parent_size_in_bytes, int level) const ;
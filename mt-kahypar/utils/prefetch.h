@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar::utils {
+
+/*!
+ * Software prefetching for incidence traversal loops. Loops like the rating of the
+ * coarsener or the gain computation iterate over the incident nets of a node and their
+ * pins and perform dependent random accesses (partition IDs, pin counts, cluster IDs)
+ * for each element, which are memory-latency bound on large instances.
+ * forEachWithLookahead(...) issues the prefetch for the element PREFETCH_DISTANCE
+ * positions ahead of the element that is currently processed.
+ *
+ * Prefetching is opt-in via the cmake option KAHYPAR_ENABLE_PREFETCHING. Otherwise,
+ * all functions in this file reduce to a plain range-based for loop.
+ */
+static constexpr size_t PREFETCH_DISTANCE = 4;
+
+template<typename T>
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void prefetch(const T* addr) {
+#ifdef KAHYPAR_ENABLE_PREFETCHING
+  __builtin_prefetch(static_cast<const void*>(addr));
+#else
+  (void) addr;
+#endif
+}
+
+// ! Calls func(element) for each element of the range and prefetch_func(element)
+// ! for the element PREFETCH_DISTANCE positions ahead
+template<typename Range, typename PrefetchFunc, typename Func>
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void forEachWithLookahead(Range&& range,
+                                                             const PrefetchFunc& prefetch_func,
+                                                             const Func& func) {
+#ifdef KAHYPAR_ENABLE_PREFETCHING
+  auto it = std::begin(range);
+  auto ahead = it;
+  const auto end = std::end(range);
+  for ( size_t i = 0; i < PREFETCH_DISTANCE && ahead != end; ++i, ++ahead ) {
+    prefetch_func(*ahead);
+  }
+  for ( ; it != end; ++it ) {
+    if ( ahead != end ) {
+      prefetch_func(*ahead);
+      ++ahead;
+    }
+    func(*it);
+  }
+#else
+  (void) prefetch_func;
+  for ( const auto& element : range ) {
+    func(element);
+  }
+#endif
+}
+
+}  // namespace mt_kahypar::utils
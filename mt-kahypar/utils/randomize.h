@@ -27,25 +27,99 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <random>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 #include <tbb/parallel_for.h>
 
+#undef __TBB_ARENA_OBSERVER
+#define __TBB_ARENA_OBSERVER true
+#include <tbb/task_scheduler_observer.h>
+#undef __TBB_ARENA_OBSERVER
+
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
 
 namespace mt_kahypar::utils {
 
+/*!
+ * xoshiro256** pseudo random number generator (Blackman and Vigna). It is considerably
+ * faster than std::mt19937 and its state fits into 32 bytes. The class satisfies the
+ * UniformRandomBitGenerator requirements and can be used with the distributions and
+ * algorithms of the standard library.
+ */
+class Xoshiro256 {
+ public:
+  using result_type = uint64_t;
+
+  explicit Xoshiro256(const uint64_t seed = 0) {
+    this->seed(seed);
+  }
+
+  // ! Initializes the state with splitmix64 (as recommended by the authors)
+  void seed(uint64_t seed) {
+    for ( uint64_t& s : _state ) {
+      seed += UINT64_C(0x9e3779b97f4a7c15);
+      uint64_t z = seed;
+      z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+      z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+      s = z ^ (z >> 31);
+    }
+  }
+
+  static constexpr result_type min() {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    const uint64_t result = rotl(_state[1] * 5, 7) * 9;
+    const uint64_t t = _state[1] << 17;
+    _state[2] ^= _state[0];
+    _state[3] ^= _state[1];
+    _state[1] ^= _state[2];
+    _state[0] ^= _state[3];
+    _state[2] ^= t;
+    _state[3] = rotl(_state[3], 45);
+    return result;
+  }
+
+ private:
+  static uint64_t rotl(const uint64_t x, const int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  uint64_t _state[4];
+};
+
+class ArenaLocalRandomize;
+
 class Randomize {
+  friend class ArenaLocalRandomize;
+
   static constexpr bool debug = false;
   static constexpr size_t PRECOMPUTED_FLIP_COINS = 128;
+  // ! Below this size, parallelShuffleVector(...) shuffles sequentially
+  static constexpr size_t PARALLEL_SHUFFLE_THRESHOLD = 100000;
 
-  using SwapBlock = std::pair<size_t, size_t>;
+ public:
+  using Generator = Xoshiro256;
+
+ private:
 
   class RandomFunctions {
    public:
@@ -84,7 +158,7 @@ class Randomize {
       return _norm_dist(_gen, std::normal_distribution<float>::param_type(mean, std_dev));
     }
 
-    std::mt19937& getGenerator() {
+    Generator& getGenerator() {
       return _gen;
     }
 
@@ -97,7 +171,7 @@ class Randomize {
     }
 
     int _seed;
-    std::mt19937 _gen;
+    Generator _gen;
     size_t _next_coin_flip;
     std::vector<bool> _precomputed_flip_coins;
     std::uniform_int_distribution<int> _int_dist;
@@ -106,7 +180,14 @@ class Randomize {
   };
 
  public:
+  // ! Returns the random number generators of the calling thread. Threads of a task arena
+  // ! with an ArenaLocalRandomize observer use the generators bound to that arena.
   static Randomize& instance() {
+    const LocalInstance& local = _local_instance;
+    if ( local.instance &&
+         local.instance->_generation.load(std::memory_order_relaxed) == local.generation ) {
+      return *local.instance;
+    }
     static Randomize instance;
     return instance;
   }
@@ -186,37 +267,10 @@ class Randomize {
         const size_t end = i + (k == P - 1 ? N : (k + 1) * step);
         localizedShuffleVector(vector, start, end, THREAD_ID);
       });
+    } else if ( N < PARALLEL_SHUFFLE_THRESHOLD ) {
+      std::shuffle(vector.begin() + i, vector.begin() + j, _rand[THREAD_ID].getGenerator());
     } else {
-      // Compute blocks that should be swapped before
-      // random shuffling
-      parallel::scalable_vector<SwapBlock> swap_blocks;
-      parallel::scalable_vector<bool> matched_blocks(P, false);
-      int cpu_id = THREAD_ID;
-      for ( size_t a = 0; a < P; ++a ) {
-        if ( !matched_blocks[a] ) {
-          matched_blocks[a] = true;
-          size_t b = getRandomInt(0, P - 1, cpu_id);
-          while ( matched_blocks[b] ) {
-            b = ( b + 1 ) % P;
-          }
-          matched_blocks[b] = true;
-          swap_blocks.push_back(std::make_pair(a, b));
-        }
-      }
-      ASSERT(swap_blocks.size() == P / 2, V(swap_blocks.size()) << V(P));
-
-      tbb::parallel_for(UL(0), P / 2, [&](const size_t k) {
-        const size_t block_1 = swap_blocks[k].first;
-        const size_t block_2 = swap_blocks[k].second;
-        const size_t start_1 = i + block_1 * step;
-        const size_t end_1 = i + (block_1 == P - 1 ? N : (block_1 + 1) * step);
-        const size_t start_2 = i + block_2 * step;
-        const size_t end_2 = i + (block_2 == P - 1 ? N : (block_2 + 1) * step);
-        const int cpu_id = THREAD_ID;
-        swapBlocks(vector, start_1, end_1, start_2, end_2);
-        std::shuffle(vector.begin() + start_1, vector.begin() + end_1, _rand[cpu_id].getGenerator());
-        std::shuffle(vector.begin() + start_2, vector.begin() + end_2, _rand[cpu_id].getGenerator());
-      });
+      scatterShuffleVector(vector, i, j, P);
     }
   }
 
@@ -237,31 +291,118 @@ class Randomize {
     return _rand[cpu_id].getNormalDistributedFloat(mean, std_dev);
   }
 
-  std::mt19937& getGenerator() {
+  Generator& getGenerator() {
     int cpu_id = THREAD_ID;
     return _rand[cpu_id].getGenerator();
   }
 
  private:
+  // ! Generators bound to a task arena. The generation is incremented when the
+  // ! arena releases them, which invalidates stale references of its threads.
+  struct LocalInstance {
+    Randomize* instance;
+    size_t generation;
+  };
+
+  // ! Instances bound to task arenas are reused, but never freed, since threads
+  // ! can still refer to them after the observer of the arena was disabled
+  struct LocalInstancePool {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Randomize>> instances;
+    std::vector<Randomize*> free_instances;
+  };
+
   explicit Randomize() :
     _rand(std::thread::hardware_concurrency()),
     _perform_localized_random_shuffle(false),
-    _localized_random_shuffle_block_size(1024) { }
+    _localized_random_shuffle_block_size(1024),
+    _generation(0) { }
+
+  static LocalInstancePool& localInstancePool() {
+    static LocalInstancePool pool;
+    return pool;
+  }
 
+  static Randomize* acquireLocalInstance() {
+    LocalInstancePool& pool = localInstancePool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if ( pool.free_instances.empty() ) {
+      pool.instances.emplace_back(new Randomize());
+      pool.free_instances.push_back(pool.instances.back().get());
+    }
+    Randomize* local = pool.free_instances.back();
+    pool.free_instances.pop_back();
+    return local;
+  }
+
+  static void releaseLocalInstance(Randomize* local) {
+    LocalInstancePool& pool = localInstancePool();
+    local->_generation.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.free_instances.push_back(local);
+  }
+
+  /*!
+   * Uniform parallel shuffle: Each of the P chunks of the range assigns its elements
+   * to random buckets and the elements are scattered into their buckets (stable within
+   * each chunk). Afterwards, each bucket is shuffled independently and copied back.
+   * The bucket sequence of a chunk is generated twice (once for counting and once for
+   * scattering) from a per-chunk seed, such that we do not have to store it.
+   */
   template <typename T>
-  void swapBlocks(parallel::scalable_vector<T>& vector,
-                  const size_t start_1,
-                  const size_t end_1,
-                  const size_t start_2,
-                  const size_t end_2) {
-    ASSERT(start_1 <= end_1);
-    ASSERT(start_2 <= end_2);
-    ASSERT(end_1 <= vector.size());
-    ASSERT(end_2 <= vector.size());
-    size_t N = std::min(end_1 - start_1, end_2 - start_2);
-    for ( size_t i = 0; i < N; ++i ) {
-      std::swap(vector[start_1 + i], vector[start_2 + i]);
+  void scatterShuffleVector(parallel::scalable_vector<T>& vector,
+                            const size_t i,
+                            const size_t j,
+                            const size_t P) {
+    const size_t N = j - i;
+    const size_t step = N / P;
+    auto chunk_begin = [&](const size_t c) { return i + c * step; };
+    auto chunk_end = [&](const size_t c) { return c == P - 1 ? j : i + (c + 1) * step; };
+    auto bucket = [&](Generator& gen) {
+      return static_cast<size_t>(((gen() >> 32) * P) >> 32);
+    };
+
+    parallel::scalable_vector<uint64_t> seeds(P);
+    Generator& gen = _rand[THREAD_ID].getGenerator();
+    for ( size_t c = 0; c < P; ++c ) {
+      seeds[c] = gen();
+    }
+
+    // offsets[b * P + c] = number of elements of chunk c assigned to bucket b
+    parallel::scalable_vector<size_t> offsets(P * P + 1, 0);
+    tbb::parallel_for(UL(0), P, [&](const size_t c) {
+      Generator chunk_gen(seeds[c]);
+      for ( size_t pos = chunk_begin(c); pos < chunk_end(c); ++pos ) {
+        ++offsets[bucket(chunk_gen) * P + c];
+      }
+    });
+    size_t sum = 0;
+    for ( size_t& offset : offsets ) {
+      const size_t count = offset;
+      offset = sum;
+      sum += count;
+    }
+    ASSERT(sum == N);
+
+    parallel::scalable_vector<size_t> bucket_bounds(P + 1);
+    for ( size_t b = 0; b <= P; ++b ) {
+      bucket_bounds[b] = offsets[b * P];
     }
+
+    parallel::scalable_vector<T> tmp(N);
+    tbb::parallel_for(UL(0), P, [&](const size_t c) {
+      Generator chunk_gen(seeds[c]);
+      for ( size_t pos = chunk_begin(c); pos < chunk_end(c); ++pos ) {
+        tmp[offsets[bucket(chunk_gen) * P + c]++] = std::move(vector[pos]);
+      }
+    });
+
+    tbb::parallel_for(UL(0), P, [&](const size_t b) {
+      std::shuffle(tmp.begin() + bucket_bounds[b], tmp.begin() + bucket_bounds[b + 1],
+                   _rand[THREAD_ID].getGenerator());
+      std::move(tmp.begin() + bucket_bounds[b], tmp.begin() + bucket_bounds[b + 1],
+                vector.begin() + i + bucket_bounds[b]);
+    });
   }
 
   template <typename T>
@@ -276,6 +417,69 @@ class Randomize {
   std::vector<RandomFunctions> _rand;
   bool _perform_localized_random_shuffle;
   size_t _localized_random_shuffle_block_size;
+  std::atomic<size_t> _generation;
+
+  static inline thread_local LocalInstance _local_instance = { nullptr, 0 };
+};
+
+/*!
+ * Binds separate random number generators seeded with the given seed to a task arena.
+ * Threads that join the arena use them instead of the global generators. Thread indices
+ * are local to an arena, so concurrent portfolio runs or recombinations in separate
+ * arenas would otherwise access the same global generators.
+ */
+class ArenaLocalRandomize : public tbb::task_scheduler_observer {
+  using Base = tbb::task_scheduler_observer;
+
+ public:
+  explicit ArenaLocalRandomize(tbb::task_arena& arena, const int seed) :
+    Base(arena),
+    _instance(Randomize::acquireLocalInstance()),
+    _generation(_instance->_generation.load(std::memory_order_relaxed)),
+    _mutex(),
+    _instance_before() {
+    const Randomize& global = Randomize::instance();
+    _instance->_perform_localized_random_shuffle = global._perform_localized_random_shuffle;
+    _instance->_localized_random_shuffle_block_size = global._localized_random_shuffle_block_size;
+    _instance->setSeed(seed);
+    observe(true);
+  }
+
+  ArenaLocalRandomize(const ArenaLocalRandomize&) = delete;
+  ArenaLocalRandomize & operator= (const ArenaLocalRandomize &) = delete;
+
+  ArenaLocalRandomize(ArenaLocalRandomize&&) = delete;
+  ArenaLocalRandomize & operator= (ArenaLocalRandomize &&) = delete;
+
+  ~ArenaLocalRandomize() {
+    // Threads that are still in the arena do not receive an exit notification
+    // after the observer is disabled => invalidate their references first
+    Randomize::releaseLocalInstance(_instance);
+    observe(false);
+  }
+
+  void on_scheduler_entry(bool) override {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _instance_before[std::this_thread::get_id()] = Randomize::_local_instance;
+    }
+    Randomize::_local_instance = Randomize::LocalInstance { _instance, _generation };
+  }
+
+  void on_scheduler_exit(bool) override {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _instance_before.find(std::this_thread::get_id());
+    if ( it != _instance_before.end() ) {
+      Randomize::_local_instance = it->second;
+      _instance_before.erase(it);
+    }
+  }
+
+ private:
+  Randomize* _instance;
+  const size_t _generation;
+  std::mutex _mutex;
+  std::unordered_map<std::thread::id, Randomize::LocalInstance> _instance_before;
 };
 
 }  // namespace mt_kahypar::utils
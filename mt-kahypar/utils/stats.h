@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <algorithm>
+#include <vector>
 
 #include "mt-kahypar/macros.h"
 
@@ -112,6 +113,10 @@ class Stats {
       _value_5 += delta;
     }
 
+    Type type() const {
+      return _type;
+    }
+
     friend std::ostream & operator<< (std::ostream& str, const Stat& stat);
 
    private:
@@ -184,6 +189,16 @@ class Stats {
     _stats.clear();
   }
 
+  // ! Returns all stats sorted by their key
+  std::vector<std::pair<std::string, Stat>> sortedStats() const {
+    std::vector<std::pair<std::string, Stat>> stats(_stats.begin(), _stats.end());
+    std::sort(stats.begin(), stats.end(),
+      [&](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+      });
+    return stats;
+  }
+
   friend std::ostream & operator<< (std::ostream& str, const Stats& stats);
 
  private:
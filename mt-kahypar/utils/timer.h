@@ -26,23 +26,47 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/hardware_counters.h"
+#include "mt-kahypar/utils/memory_sampler.h"
 
 namespace mt_kahypar {
 namespace utils {
+/*!
+ * Hierarchical timer. Completed timings are aggregated in thread-local maps,
+ * such that starting and stopping a timer in a parallel context requires no
+ * synchronization between threads. The thread-local maps are merged when the
+ * timings are exported. Timer scopes started in a sequential context are kept on
+ * a global stack, which is protected by a mutex. Time is measured with the
+ * monotonic steady clock.
+ *
+ * If tracing is enabled, the timer additionally records the begin and end of
+ * each timer scope and of each traced task (see ScopedTraceSpan) together with
+ * the thread that executed it. In contrast to the aggregated timings, spans are
+ * also recorded while the timer is disabled (e.g., during initial partitioning).
+ *
+ * If the memory sampler is active, the timer attributes the peak RSS and the
+ * number of bytes faulted into the process during a timer scope to that scope
+ * (see MemorySampler). Both are process-wide quantities, i.e., timer scopes that
+ * run concurrently on different threads observe the same values.
+ */
 class Timer {
   static constexpr bool debug = false;
 
-  using HighResClockTimepoint = std::chrono::time_point<std::chrono::high_resolution_clock>;
+  using Clock = std::chrono::steady_clock;
+  using ClockTimepoint = std::chrono::time_point<Clock>;
 
  public:
   static constexpr int MAX_LINE_LENGTH = 45;
@@ -74,33 +98,66 @@ class Timer {
     ActiveTiming() :
       _key(""),
       _description(""),
-      _start() { }
+      _start(),
+      _start_sample(0),
+      _start_faulted_bytes(0) { }
 
     ActiveTiming(const std::string& key,
                  const std::string& description,
-                 const HighResClockTimepoint& start) :
+                 const ClockTimepoint& start) :
       _key(key),
       _description(description),
-      _start(start) { }
+      _start(start),
+      _start_sample(0),
+      _start_faulted_bytes(0) { }
 
-    std::string key() const {
+    const std::string& key() const {
       return _key;
     }
 
-    std::string description() const {
+    const std::string& description() const {
       return _description;
     }
 
-    HighResClockTimepoint start() const {
+    const ClockTimepoint& start() const {
       return _start;
     }
 
+    size_t startSample() const {
+      return _start_sample;
+    }
+
+    size_t startFaultedBytes() const {
+      return _start_faulted_bytes;
+    }
+
+    void setStartMemory(const size_t start_sample, const size_t start_faulted_bytes) {
+      _start_sample = start_sample;
+      _start_faulted_bytes = start_faulted_bytes;
+    }
+
+    #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+    const HardwareCounterValues& startCounters() const {
+      return _start_counters;
+    }
+
+    void setStartCounters(const HardwareCounterValues& counters) {
+      _start_counters = counters;
+    }
+    #endif
+
    private:
     std::string _key;
     std::string _description;
-    HighResClockTimepoint _start;
+    ClockTimepoint _start;
+    size_t _start_sample;
+    size_t _start_faulted_bytes;
+    #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+    HardwareCounterValues _start_counters;
+    #endif
   };
 
+ public:
   class Timing {
    public:
     Timing(const std::string& key,
@@ -111,7 +168,11 @@ class Timer {
       _description(description),
       _parent(parent),
       _order(order),
-      _timing(0.0) { }
+      _timing(0.0),
+      _counters(),
+      _has_memory_samples(false),
+      _peak_rss(0),
+      _faulted_bytes(0) { }
 
     std::string key() const {
       return _key;
@@ -141,49 +202,164 @@ class Timer {
       _timing += timing;
     }
 
+    // ! Hardware counters accumulated over all executions of the timer scope
+    // ! (all zero if hardware counters are disabled)
+    const HardwareCounterValues& counters() const {
+      return _counters;
+    }
+
+    void add_counters(const HardwareCounterValues& counters) {
+      _counters += counters;
+    }
+
+    // ! True, if the memory sampler was active during an execution of the timer scope
+    bool has_memory_samples() const {
+      return _has_memory_samples;
+    }
+
+    // ! Maximum RSS (in bytes) observed during any execution of the timer scope
+    size_t peak_rss() const {
+      return _peak_rss;
+    }
+
+    // ! Bytes faulted into the process accumulated over all executions of the timer scope
+    size_t faulted_bytes() const {
+      return _faulted_bytes;
+    }
+
+    void add_memory(const size_t peak_rss, const size_t faulted_bytes) {
+      _has_memory_samples = true;
+      _peak_rss = std::max(_peak_rss, peak_rss);
+      _faulted_bytes += faulted_bytes;
+    }
+
+    // ! Adds the timing of the same timer scope recorded on an other thread
+    void merge(const Timing& other) {
+      _order = std::min(_order, other._order);
+      _timing += other._timing;
+      _counters += other._counters;
+      _has_memory_samples |= other._has_memory_samples;
+      _peak_rss = std::max(_peak_rss, other._peak_rss);
+      _faulted_bytes += other._faulted_bytes;
+    }
+
    private:
     std::string _key;
     std::string _description;
     std::string _parent;
     int _order;
     double _timing;
+    HardwareCounterValues _counters;
+    bool _has_memory_samples;
+    size_t _peak_rss;
+    size_t _faulted_bytes;
+  };
+
+  // ! Begin/end span of a timer scope or traced task executed on a thread.
+  // ! Timestamps are given in microseconds relative to the start of tracing.
+  struct TraceSpan {
+    std::string name;
+    std::string category;
+    std::string args;
+    int thread;
+    double start;
+    double duration;
+  };
+
+  // ! Records a span from its construction until its destruction on the calling thread,
+  // ! if tracing is enabled. Optional arguments are shown in the details of the span.
+  class ScopedTraceSpan {
+   public:
+    ScopedTraceSpan(Timer& timer, const char* name, const char* category) :
+      _timer(timer.isTracing() ? &timer : nullptr),
+      _name(name),
+      _category(category),
+      _args(),
+      _start(_timer ? Clock::now() : ClockTimepoint()) { }
+
+    ScopedTraceSpan(const ScopedTraceSpan&) = delete;
+    ScopedTraceSpan & operator= (const ScopedTraceSpan &) = delete;
+
+    ScopedTraceSpan(ScopedTraceSpan&&) = delete;
+    ScopedTraceSpan & operator= (ScopedTraceSpan &&) = delete;
+
+    ~ScopedTraceSpan() {
+      if ( _timer ) {
+        _timer->record_span(_name, _category, _start, Clock::now(), _args.str());
+      }
+    }
+
+    template<typename T>
+    void addArg(const std::string& key, const T& value) {
+      if ( _timer ) {
+        _args << (_args.tellp() > 0 ? ", " : "") << key << "=" << value;
+      }
+    }
+
+   private:
+    Timer* _timer;
+    const char* _name;
+    const char* _category;
+    std::stringstream _args;
+    ClockTimepoint _start;
+  };
+
+ private:
+  struct TraceBuffer {
+    int thread = -1;
+    std::vector<TraceSpan> spans;
   };
 
   using ActiveTimingStack = std::vector<ActiveTiming>;
   using LocalActiveTimingStack = tbb::enumerable_thread_specific<ActiveTimingStack>;
+  using TimingMap = std::unordered_map<Key, Timing, KeyHasher, KeyEqual>;
+  using LocalTimingMap = tbb::enumerable_thread_specific<TimingMap>;
+  using LocalTraceBuffer = tbb::enumerable_thread_specific<TraceBuffer>;
 
  public:
   explicit Timer() :
-    _timing_mutex(),
-    _timings(),
+    _local_timings(),
+    _active_timings_mutex(),
     _active_timings(),
     _local_active_timings(),
     _index(0),
     _is_enabled(true),
     _show_detailed_timings(false),
-    _max_output_depth(std::numeric_limits<size_t>::max()) { }
+    _max_output_depth(std::numeric_limits<size_t>::max()),
+    _is_tracing(false),
+    _trace_start(),
+    _trace_buffers(),
+    _num_traced_threads(0) { }
 
   Timer(const Timer& other) :
-    _timing_mutex(),
-    _timings(other._timings),
+    _local_timings(other._local_timings),
+    _active_timings_mutex(),
     _active_timings(other._active_timings),
     _local_active_timings(other._local_active_timings),
     _index(other._index.load(std::memory_order_relaxed)),
     _is_enabled(other._is_enabled),
     _show_detailed_timings(other._show_detailed_timings),
-    _max_output_depth(other._max_output_depth) { }
+    _max_output_depth(other._max_output_depth),
+    _is_tracing(other._is_tracing),
+    _trace_start(other._trace_start),
+    _trace_buffers(other._trace_buffers),
+    _num_traced_threads(other._num_traced_threads.load(std::memory_order_relaxed)) { }
 
   Timer & operator= (const Timer &) = delete;
 
   Timer(Timer&& other) :
-    _timing_mutex(),
-    _timings(std::move(other._timings)),
+    _local_timings(std::move(other._local_timings)),
+    _active_timings_mutex(),
     _active_timings(std::move(other._active_timings)),
     _local_active_timings(std::move(other._local_active_timings)),
     _index(other._index.load(std::memory_order_relaxed)),
     _is_enabled(std::move(other._is_enabled)),
     _show_detailed_timings(std::move(other._show_detailed_timings)),
-    _max_output_depth(std::move(other._max_output_depth)) { }
+    _max_output_depth(std::move(other._max_output_depth)),
+    _is_tracing(other._is_tracing),
+    _trace_start(other._trace_start),
+    _trace_buffers(std::move(other._trace_buffers)),
+    _num_traced_threads(other._num_traced_threads.load(std::memory_order_relaxed)) { }
 
   Timer & operator= (Timer &&) = delete;
 
@@ -200,20 +376,40 @@ class Timer {
   }
 
   void enable() {
-    std::lock_guard<std::mutex> lock(_timing_mutex);
     _is_enabled = true;
   }
 
   void disable() {
-    std::lock_guard<std::mutex> lock(_timing_mutex);
     _is_enabled = false;
   }
 
+  bool isTracing() const {
+    return _is_tracing;
+  }
+
+  // ! Starts recording spans. Previously recorded spans are discarded.
+  // ! Note, must not be called concurrently to start_timer(...) or stop_timer(...)
+  void enableTracing() {
+    clearTrace();
+    _trace_start = Clock::now();
+    _is_tracing = true;
+  }
+
+  void disableTracing() {
+    _is_tracing = false;
+  }
+
+  // ! Note, must not be called concurrently to start_timer(...) or stop_timer(...)
   void clear() {
-    std::lock_guard<std::mutex> lock(_timing_mutex);
-    _timings.clear();
-    _active_timings.clear();
+    for ( TimingMap& timings : _local_timings ) {
+      timings.clear();
+    }
+    {
+      std::lock_guard<std::mutex> lock(_active_timings_mutex);
+      _active_timings.clear();
+    }
     _index = 0;
+    clearTrace();
   }
 
   void start_timer(const std::string& key,
@@ -221,11 +417,19 @@ class Timer {
                    bool is_parallel_context = false,
                    bool force = false) {
     if (_is_enabled || force) {
-      std::lock_guard<std::mutex> lock(_timing_mutex);
-      if (force || is_parallel_context) {
-        _local_active_timings.local().emplace_back(key, description, std::chrono::high_resolution_clock::now());
+      ActiveTiming timing(key, description, Clock::now());
+      const MemorySampler& sampler = MemorySampler::instance();
+      if ( sampler.isActive() ) {
+        timing.setStartMemory(sampler.currentSample(), MemorySampler::faultedBytes());
+      }
+      #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+      timing.setStartCounters(HardwareCounters::instance().read());
+      #endif
+      if ( force || is_parallel_context ) {
+        _local_active_timings.local().push_back(std::move(timing));
       } else {
-        _active_timings.emplace_back(key, description, std::chrono::high_resolution_clock::now());
+        std::lock_guard<std::mutex> lock(_active_timings_mutex);
+        _active_timings.push_back(std::move(timing));
       }
     }
   }
@@ -233,22 +437,26 @@ class Timer {
   void stop_timer(const std::string& key, bool force = false) {
     unused(key);
     if (_is_enabled || force) {
-      std::lock_guard<std::mutex> lock(_timing_mutex);
-      HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
-      ASSERT(!force || !_local_active_timings.local().empty());
+      const ClockTimepoint end = Clock::now();
+      #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+      const HardwareCounterValues end_counters = HardwareCounters::instance().read();
+      #endif
+      ActiveTimingStack& local_stack = _local_active_timings.local();
+      ASSERT(!force || !local_stack.empty());
       ActiveTiming current_timing;
+      std::string parent = "";
       // First check if there are some active timings on the local stack
       // (in that case we are in a parallel context) and if there are
-      // no active timings we pop from global stack
-      if (!_local_active_timings.local().empty()) {
-        ASSERT(_local_active_timings.local().back().key() == key,
-          V(_local_active_timings.local().back().key()) << V(key));
-        current_timing = _local_active_timings.local().back();
-        _local_active_timings.local().pop_back();
+      // no active timings we pop from global stack.
+      if (!local_stack.empty()) {
+        ASSERT(local_stack.back().key() == key, V(local_stack.back().key()) << V(key));
+        current_timing = std::move(local_stack.back());
+        local_stack.pop_back();
       } else {
+        std::lock_guard<std::mutex> lock(_active_timings_mutex);
         ASSERT(!_active_timings.empty());
         ASSERT(_active_timings.back().key() == key, V(_active_timings.back().key()) << V(key));
-        current_timing = _active_timings.back();
+        current_timing = std::move(_active_timings.back());
         _active_timings.pop_back();
       }
 
@@ -256,31 +464,79 @@ class Timer {
       // if there are no timings on the local stack the parent is
       // on the global stack. If there are no elements on the global
       // stack the timing represents a root.
-      std::string parent = "";
-      if (!_local_active_timings.local().empty()) {
-        parent = _local_active_timings.local().back().key();
-      } else if (!_active_timings.empty()) {
-        parent = _active_timings.back().key();
+      if (!local_stack.empty()) {
+        parent = local_stack.back().key();
+      } else {
+        std::lock_guard<std::mutex> lock(_active_timings_mutex);
+        if (!_active_timings.empty()) {
+          parent = _active_timings.back().key();
+        }
       }
 
+      // The timing is recorded in the map of the calling thread
+      TimingMap& timings = _local_timings.local();
       Key timing_key { parent, current_timing.key() };
-      if (_timings.find(timing_key) == _timings.end()) {
-        _timings.emplace(
+      auto it = timings.find(timing_key);
+      if (it == timings.end()) {
+        it = timings.emplace(
           std::piecewise_construct,
           std::forward_as_tuple(timing_key),
           std::forward_as_tuple(current_timing.key(),
-                                current_timing.description(), parent, _index++));
+                                current_timing.description(), parent, _index++)).first;
+      }
+      it->second.add_timing(std::chrono::duration<double>(end - current_timing.start()).count());
+      const MemorySampler& sampler = MemorySampler::instance();
+      if ( sampler.isActive() ) {
+        // The RSS at the end of the scope is included since the scope might be
+        // shorter than the sampling interval
+        const size_t faulted_bytes = MemorySampler::faultedBytes();
+        it->second.add_memory(
+          std::max(sampler.peakRSSSince(current_timing.startSample()), MemorySampler::readRSS()),
+          faulted_bytes - std::min(faulted_bytes, current_timing.startFaultedBytes()));
+      }
+      #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+      it->second.add_counters(end_counters - current_timing.startCounters());
+      #endif
+      if ( _is_tracing ) {
+        record_span(current_timing.description(), "timer",
+          current_timing.start(), end, "key=" + current_timing.key());
       }
-      double time = std::chrono::duration<double>(end - current_timing.start()).count();
-      _timings.at(timing_key).add_timing(time);
     }
   }
 
-  void serialize(std::ostream& str) {
-    std::vector<Timing> timings;
-    for (const auto& timing : _timings) {
-      timings.emplace_back(timing.second);
+  // ! Records a span on the calling thread (no-op if tracing is disabled)
+  void record_span(const std::string& name,
+                   const std::string& category,
+                   const ClockTimepoint& start,
+                   const ClockTimepoint& end,
+                   const std::string& args = "") {
+    if ( _is_tracing ) {
+      TraceBuffer& buffer = _trace_buffers.local();
+      if ( buffer.thread == -1 ) {
+        buffer.thread = _num_traced_threads++;
+      }
+      buffer.spans.push_back(TraceSpan { name, category, args, buffer.thread,
+        std::chrono::duration<double, std::micro>(start - _trace_start).count(),
+        std::chrono::duration<double, std::micro>(end - start).count() });
     }
+  }
+
+  // ! Returns the spans of all threads sorted by their start time.
+  // ! Note, must not be called concurrently to stop_timer(...) or record_span(...)
+  std::vector<TraceSpan> traceSpans() const {
+    std::vector<TraceSpan> spans;
+    for ( const TraceBuffer& buffer : _trace_buffers ) {
+      spans.insert(spans.end(), buffer.spans.begin(), buffer.spans.end());
+    }
+    std::sort(spans.begin(), spans.end(),
+              [&](const TraceSpan& lhs, const TraceSpan& rhs) {
+          return lhs.start < rhs.start || (lhs.start == rhs.start && lhs.thread < rhs.thread);
+        });
+    return spans;
+  }
+
+  void serialize(std::ostream& str) {
+    std::vector<Timing> timings = merged_timings();
     std::sort(timings.begin(), timings.end(),
               [&](const Timing& lhs, const Timing& rhs) {
           return lhs.key() < rhs.key();
@@ -315,19 +571,58 @@ class Timer {
 
   friend std::ostream & operator<< (std::ostream& str, const Timer& timer);
 
+  // ! Returns all timings sorted in the order in which they were first recorded
+  std::vector<Timing> timings() const {
+    std::vector<Timing> timings = merged_timings();
+    std::sort(timings.begin(), timings.end(),
+              [&](const Timing& lhs, const Timing& rhs) {
+          return lhs.order() < rhs.order();
+        });
+    return timings;
+  }
+
   double get(std::string key) const {
-    for (const auto& x : _timings) {
+    for (const Timing& timing : merged_timings()) {
       // unfortunately it has to be linear search because the parent (which we can't lookup at this stage) is part of the map key
-      if (x.first.key == key) {
-        return x.second.timing();
+      if (timing.key() == key) {
+        return timing.timing();
       }
     }
     return 0.0;
   }
 
  private:
-  std::mutex _timing_mutex;
-  std::unordered_map<Key, Timing, KeyHasher, KeyEqual> _timings;
+  // ! Merges the timings recorded on the different threads.
+  // ! Note, must not be called concurrently to stop_timer(...)
+  std::vector<Timing> merged_timings() const {
+    TimingMap merged;
+    for (const TimingMap& local_timings : _local_timings) {
+      for (const auto& timing : local_timings) {
+        auto it = merged.find(timing.first);
+        if (it == merged.end()) {
+          merged.emplace(timing.first, timing.second);
+        } else {
+          it->second.merge(timing.second);
+        }
+      }
+    }
+    std::vector<Timing> timings;
+    for (const auto& timing : merged) {
+      timings.emplace_back(timing.second);
+    }
+    return timings;
+  }
+
+  void clearTrace() {
+    for ( TraceBuffer& buffer : _trace_buffers ) {
+      buffer.spans.clear();
+    }
+  }
+
+  // Completed timings of each thread
+  LocalTimingMap _local_timings;
+  // Protects the global active timing stack
+  std::mutex _active_timings_mutex;
   // Global Active Timing Stack
   // Timings are pushed to the global stack
   // if we are in a sequential context
@@ -340,16 +635,18 @@ class Timer {
   bool _is_enabled;
   bool _show_detailed_timings;
   size_t _max_output_depth;
+  // Spans recorded on each thread if tracing is enabled
+  bool _is_tracing;
+  ClockTimepoint _trace_start;
+  LocalTraceBuffer _trace_buffers;
+  std::atomic<int> _num_traced_threads;
 };
 
 inline char Timer::TOP_LEVEL_PREFIX[] = " + ";
 inline char Timer::SUB_LEVEL_PREFIX[] = " + ";
 
 inline std::ostream & operator<< (std::ostream& str, const Timer& timer) {
-  std::vector<Timer::Timing> timings;
-  for (const auto& timing : timer._timings) {
-    timings.emplace_back(timing.second);
-  }
+  std::vector<Timer::Timing> timings = timer.merged_timings();
   std::sort(timings.begin(), timings.end(),
             [&](const Timer::Timing& lhs, const Timer::Timing& rhs) {
         return lhs.order() < rhs.order();
@@ -367,7 +664,19 @@ inline std::ostream & operator<< (std::ostream& str, const Timer& timer) {
                  if (length < Timer::MAX_LINE_LENGTH) {
                    str << std::string(Timer::MAX_LINE_LENGTH - length, ' ');
                  }
-                 str << " = " << timing.timing() << " s\n";
+                 str << " = " << timing.timing() << " s";
+                 if ( timing.has_memory_samples() ) {
+                   str << " [peak RSS = " << timing.peak_rss() / (1024.0 * 1024.0) << " MB"
+                       << ", faulted = " << timing.faulted_bytes() / (1024.0 * 1024.0) << " MB]";
+                 }
+                 #ifdef KAHYPAR_ENABLE_HARDWARE_COUNTERS
+                 const HardwareCounterValues& counters = timing.counters();
+                 str << " [IPC = " << counters.ipc()
+                     << ", cache misses = " << counters.cacheMisses()
+                     << ", branch misses = " << counters.branchMisses()
+                     << ", est. bandwidth = " << counters.bandwidth(timing.timing()) << " GB/s]";
+                 #endif
+                 str << "\n";
                };
 
   std::function<void(std::ostream&, const Timer::Timing&, int)> dfs =
@@ -26,6 +26,7 @@
  ******************************************************************************/
 
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
 
@@ -34,6 +35,9 @@
 #include <tbb/parallel_for.h>
 
 #include <atomic>
+#include <exception>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -52,6 +56,10 @@
 #include "mt-kahypar/partition/mapping/target_graph.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/io/shared_memory.h"
+#include "mt-kahypar/parallel/background_reclamation.h"
+#include "mt-kahypar/parallel/huge_pages.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/delete.h"
 #include "mt-kahypar/utils/exception.h"
@@ -86,6 +94,104 @@ namespace {
     }
   }
 
+  // Contiguous NumPy array, other types or layouts are converted on input
+  template<typename T>
+  using NumpyArray = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+  template<typename T>
+  void ensure_correct_size(size_t expected, const NumpyArray<T>& data, const char* data_kind) {
+    if (static_cast<size_t>(data.size()) != expected) {
+      throw InvalidInputException(std::string("Number of ") + data_kind + " does not match length of input data!");
+    }
+  }
+
+  template<typename T>
+  const T* optional_data(size_t expected, const std::optional<NumpyArray<T>>& data, const char* data_kind) {
+    if (!data) {
+      return nullptr;
+    }
+    ensure_correct_size(expected, *data, data_kind);
+    return data->data();
+  }
+
+  // Transforms a hypergraph in CSR format into the adjacency list expected by the factories
+  vec<vec<HypernodeID>> edge_vector_from_csr(const HypernodeID num_hypernodes,
+                                             const HyperedgeID num_hyperedges,
+                                             const NumpyArray<size_t>& hyperedge_indices,
+                                             const NumpyArray<HypernodeID>& hyperedges) {
+    ensure_correct_size(num_hyperedges + 1, hyperedge_indices, "hyperedge indices");
+    const size_t* indices = hyperedge_indices.data();
+    const HypernodeID* pins = hyperedges.data();
+    if (indices[0] != 0 || indices[num_hyperedges] != static_cast<size_t>(hyperedges.size())) {
+      throw InvalidInputException("Hyperedge indices do not match length of input data!");
+    }
+    vec<vec<HypernodeID>> edge_vector(num_hyperedges);
+    std::atomic_bool valid = true;
+    tbb::parallel_for<HyperedgeID>(0, num_hyperedges, [&](const HyperedgeID he) {
+      if (indices[he] > indices[he + 1]) {
+        valid = false;
+        return;
+      }
+      edge_vector[he].assign(pins + indices[he], pins + indices[he + 1]);
+      for (const HypernodeID pin : edge_vector[he]) {
+        if (pin >= num_hypernodes) {
+          valid = false;
+        }
+      }
+    });
+    if (!valid) {
+      throw InvalidInputException("Hyperedge indices must be non-decreasing and pins must be valid node IDs!");
+    }
+    return edge_vector;
+  }
+
+  // Transforms an array of shape (num_edges, 2) into the edge list expected by the factories
+  vec<std::pair<HypernodeID,HypernodeID>> edge_vector_from_array(const HypernodeID num_nodes,
+                                                                 const HyperedgeID num_edges,
+                                                                 const NumpyArray<HypernodeID>& edges) {
+    if (edges.ndim() != 2 || edges.shape(1) != 2 || static_cast<size_t>(edges.shape(0)) != num_edges) {
+      throw InvalidInputException("Edges must be given as an array of shape (num_edges, 2)!");
+    }
+    const HypernodeID* data = edges.data();
+    vec<std::pair<HypernodeID,HypernodeID>> edge_vector(num_edges);
+    std::atomic_bool valid = true;
+    tbb::parallel_for<HyperedgeID>(0, num_edges, [&](const HyperedgeID e) {
+      edge_vector[e] = { data[2 * e], data[2 * e + 1] };
+      if (edge_vector[e].first >= num_nodes || edge_vector[e].second >= num_nodes) {
+        valid = false;
+      }
+    });
+    if (!valid) {
+      throw InvalidInputException("Edges must contain valid node IDs!");
+    }
+    return edge_vector;
+  }
+
+  void check_shared_hyperedge_is_valid(const io::SharedMemoryHypergraph& hg, const HyperedgeID he) {
+    if ( he >= hg.numEdges() ) {
+      throw InvalidInputException("Invalid hyperedge: ID is \"" + std::to_string(he) +
+        "\", but there are only " + std::to_string(hg.numEdges()) + " edges");
+    }
+  }
+
+  // Wraps memory owned by base in a read-only NumPy array without copying it
+  template<typename T>
+  py::array_t<T> read_only_array(const size_t size, const T* data, const py::object& base) {
+    py::array_t<T> array(size, data, base);
+    array.attr("setflags")(py::arg("write") = false);
+    return array;
+  }
+
+  // Runs func(*args) on a background thread of the module-wide executor. The returned
+  // concurrent.futures.Future can be awaited in asyncio via asyncio.wrap_future(...).
+  py::object submit_async(const py::object& func, const py::tuple& args) {
+    py::module_ module = py::module_::import("mtkahypar");
+    if (module.attr("_executor").is_none()) {
+      module.attr("_executor") = py::module_::import("concurrent.futures").attr("ThreadPoolExecutor")();
+    }
+    return module.attr("_executor").attr("submit")(func, *args);
+  }
+
   const ds::StaticGraph& target_graph_cast(mt_kahypar_py_target_graph_t target_graph) {
     ASSERT(target_graph.type == STATIC_GRAPH);
     return utils::cast_const<ds::StaticGraph>(target_graph);
@@ -122,8 +228,14 @@ PYBIND11_MODULE(mtkahypar, m) {
   auto graph_class = py::class_<mt_kahypar_py_graph_t, mt_kahypar_hypergraph_t,
     std::unique_ptr<mt_kahypar_py_graph_t, HypergraphDeleter>>(m, "Graph");
 
-  py::class_<mt_kahypar_py_target_graph_t, mt_kahypar_py_graph_t,
+  auto target_graph_class = py::class_<mt_kahypar_py_target_graph_t, mt_kahypar_py_graph_t,
     std::unique_ptr<mt_kahypar_py_target_graph_t, HypergraphDeleter>>(m, "TargetGraph");
+
+  auto precomputed_target_graph_class =
+    py::class_<TargetGraph, std::shared_ptr<TargetGraph>>(m, "PrecomputedTargetGraph");
+
+  auto shared_hg_class =
+    py::class_<io::SharedMemoryHypergraph, std::shared_ptr<io::SharedMemoryHypergraph>>(m, "SharedHypergraph");
   
   auto phg_class = py::class_<mt_kahypar_partitioned_hypergraph_t,
     std::unique_ptr<mt_kahypar_partitioned_hypergraph_t, PartitionedHypergraphDeleter>>(m, "PartitionedHypergraph");
@@ -134,7 +246,10 @@ PYBIND11_MODULE(mtkahypar, m) {
   using mt_kahypar::FileFormat;
   py::enum_<FileFormat>(m, "FileFormat", py::module_local())
     .value("HMETIS", FileFormat::hMetis)
-    .value("METIS", FileFormat::Metis);
+    .value("METIS", FileFormat::Metis)
+    .value("BINARY", FileFormat::binary)
+    .value("SNAP", FileFormat::SNAP)
+    .value("MATRIX_MARKET", FileFormat::MatrixMarket);
 
   using mt_kahypar::PresetType;
   py::enum_<PresetType>(m, "PresetType", py::module_local())
@@ -170,6 +285,65 @@ PYBIND11_MODULE(mtkahypar, m) {
     }, "Initializes the random number generator with the given seed",
     py::arg("seed"));
 
+  m.def("set_huge_page_allocation", [&](const bool enable) {
+      if ( enable ) {
+        mt_kahypar::parallel::HugePages::instance().activate();
+      } else {
+        mt_kahypar::parallel::HugePages::instance().deactivate();
+      }
+    }, "Enables or disables huge page backed storage for large internal arrays",
+    py::arg("enable"));
+
+  m.def("set_asynchronous_deallocation", [&](const bool enable) {
+      if ( enable ) {
+        mt_kahypar::parallel::BackgroundReclamation::instance().activate();
+      } else {
+        mt_kahypar::parallel::BackgroundReclamation::instance().deactivate();
+      }
+    }, "Enables or disables freeing large data structures on a background thread",
+    py::arg("enable"));
+
+#ifndef KAHYPAR_DISABLE_HWLOC
+  m.def("set_hardware_topology", [&](const std::string& xml) {
+      if ( !mt_kahypar::parallel::HwlocTopology::set_xml(xml) ) {
+        throw InvalidInputException("Invalid hardware topology or topology was already loaded");
+      }
+    }, "Uses the given hardware topology in hwloc XML format instead of discovering it (must be called before initialize)",
+    py::arg("xml"));
+
+  m.def("export_hardware_topology", [&]() {
+      return HardwareTopology::instance().export_topology();
+    }, "Returns the hardware topology in hwloc XML format");
+#endif
+
+
+  m.def("partition_batch", [&](const std::vector<mt_kahypar_hypergraph_t*>& hypergraphs,
+                                const std::vector<const Context*>& contexts) {
+      if ( hypergraphs.size() != contexts.size() ) {
+        throw InvalidInputException("Number of hypergraphs does not match number of contexts!");
+      }
+      std::vector<mt_kahypar_hypergraph_t> instances;
+      for ( const mt_kahypar_hypergraph_t* hypergraph : hypergraphs ) {
+        instances.push_back(*hypergraph);
+      }
+      std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(instances.size());
+      std::exception_ptr ex = nullptr;
+      {
+        py::gil_scoped_release release;
+        ex = lib::partition_batch(instances.data(), contexts.data(), instances.size(), partitioned_hgs.data());
+      }
+      if ( ex ) {
+        for ( mt_kahypar_partitioned_hypergraph_t& phg : partitioned_hgs ) {
+          utils::delete_partitioned_hypergraph(phg);
+        }
+        std::rethrow_exception(ex);
+      }
+      return partitioned_hgs;
+    }, R"pbdoc(
+  Partitions many independent (hyper)graphs concurrently, where the i-th (hyper)graph is partitioned
+  with the i-th context. Each instance is partitioned sequentially by a single thread, which maximizes
+  the throughput for a large number of small instances.
+          )pbdoc", py::arg("hypergraphs"), py::arg("contexts"));
 
   // ####################### The Initializer #######################
 
@@ -236,6 +410,40 @@ Construct a weighted hypergraph.
       py::arg("hyperedges"),
       py::arg("node_weights"),
       py::arg("hyperedge_weights"))
+    .def("create_hypergraph_from_csr",
+      [](Initializer&,
+         const Context& context,
+         const HypernodeID num_hypernodes,
+         const HyperedgeID num_hyperedges,
+         const NumpyArray<size_t>& hyperedge_indices,
+         const NumpyArray<HypernodeID>& hyperedges,
+         const std::optional<NumpyArray<HypernodeWeight>>& node_weights,
+         const std::optional<NumpyArray<HyperedgeWeight>>& hyperedge_weights) {
+        const vec<vec<HypernodeID>> edge_vector = edge_vector_from_csr(
+          num_hypernodes, num_hyperedges, hyperedge_indices, hyperedges);
+        return lib::create_hypergraph(context, num_hypernodes, num_hyperedges, edge_vector,
+          optional_data(num_hyperedges, hyperedge_weights, "hyperedges"),
+          optional_data(num_hypernodes, node_weights, "nodes"));
+      }, R"pbdoc(
+Construct a hypergraph from NumPy arrays in CSR format. The pins of hyperedge i are stored in
+hyperedges[hyperedge_indices[i]:hyperedge_indices[i + 1]]. The weights are read directly from the
+arrays without converting them into Python lists.
+
+:param context: the partitioning context
+:param num_hypernodes: Number of nodes
+:param num_hyperedges: Number of hyperedges
+:param hyperedge_indices: array with num_hyperedges + 1 entries containing the start of each hyperedge
+:param hyperedges: array containing the pins of all hyperedges
+:param node_weights: optional array with the weights of all hypernodes
+:param hyperedge_weights: optional array with the weights of all hyperedges
+          )pbdoc",
+      py::arg("context"),
+      py::arg("num_hypernodes"),
+      py::arg("num_hyperedges"),
+      py::arg("hyperedge_indices"),
+      py::arg("hyperedges"),
+      py::arg("node_weights") = py::none(),
+      py::arg("hyperedge_weights") = py::none())
     .def("hypergraph_from_file",
       [](Initializer&,
          const std::string& file_name,
@@ -294,6 +502,69 @@ Construct a weighted graph.
       py::arg("edges"),
       py::arg("node_weights"),
       py::arg("edge_weights"))
+    .def("create_graph_from_array",
+      [](Initializer&,
+         const Context& context,
+         const HypernodeID num_nodes,
+         const HyperedgeID num_edges,
+         const NumpyArray<HypernodeID>& edges,
+         const std::optional<NumpyArray<HypernodeWeight>>& node_weights,
+         const std::optional<NumpyArray<HyperedgeWeight>>& edge_weights) {
+        const vec<std::pair<HypernodeID,HypernodeID>> edge_vector =
+          edge_vector_from_array(num_nodes, num_edges, edges);
+        return mt_kahypar_py_graph_t{lib::create_graph(context, num_nodes, num_edges, edge_vector,
+          optional_data(num_edges, edge_weights, "edges"),
+          optional_data(num_nodes, node_weights, "nodes"))};
+      }, R"pbdoc(
+Construct a graph from NumPy arrays. The weights are read directly from the
+arrays without converting them into Python lists.
+
+:param context: the partitioning context
+:param num_nodes: Number of nodes
+:param num_edges: Number of edges
+:param edges: array of shape (num_edges, 2) containing all edges
+:param node_weights: optional array with the weights of all nodes
+:param edge_weights: optional array with the weights of all edges
+          )pbdoc",
+      py::arg("context"),
+      py::arg("num_nodes"),
+      py::arg("num_edges"),
+      py::arg("edges"),
+      py::arg("node_weights") = py::none(),
+      py::arg("edge_weights") = py::none())
+    .def("create_graph_from_csr",
+      [](Initializer&,
+         const Context& context,
+         const HypernodeID num_nodes,
+         const NumpyArray<size_t>& xadj,
+         const NumpyArray<HypernodeID>& adjncy,
+         const std::optional<NumpyArray<HypernodeWeight>>& node_weights,
+         const std::optional<NumpyArray<HyperedgeWeight>>& edge_weights) {
+        ensure_correct_size(num_nodes + 1, xadj, "adjacency offsets");
+        if (xadj.data()[num_nodes] != static_cast<size_t>(adjncy.size())) {
+          throw InvalidInputException("Adjacency offsets do not match length of input data!");
+        }
+        return mt_kahypar_py_graph_t{lib::create_graph_from_csr(context, num_nodes, xadj.data(), adjncy.data(),
+          optional_data(adjncy.size(), edge_weights, "edges"),
+          optional_data(num_nodes, node_weights, "nodes"))};
+      }, R"pbdoc(
+Construct a graph from NumPy arrays in CSR format (as in METIS). The neighbors of node u are stored in
+adjncy[xadj[u]:xadj[u + 1]] and each edge is contained in both directions. The graph is built
+directly from the adjacency array.
+
+:param context: the partitioning context
+:param num_nodes: Number of nodes
+:param xadj: array with num_nodes + 1 entries containing the start of the neighbors of each node
+:param adjncy: array containing the neighbors of all nodes
+:param node_weights: optional array with the weights of all nodes
+:param edge_weights: optional array with one weight per entry of adjncy
+          )pbdoc",
+      py::arg("context"),
+      py::arg("num_nodes"),
+      py::arg("xadj"),
+      py::arg("adjncy"),
+      py::arg("node_weights") = py::none(),
+      py::arg("edge_weights") = py::none())
     .def("graph_from_file",
       [](Initializer&,
          const std::string& file_name,
@@ -396,6 +667,48 @@ Construct a target graph.
       }, [](Context& context, const size_t num_vcycles) {
         context.partition.num_vcycles = num_vcycles;
       }, "Sets the number of V-cycles")
+    .def_property("vcycle_min_relative_improvement",
+      [](const Context& context) {
+        return context.partition.vcycle_min_relative_improvement;
+      }, [](Context& context, const double min_improvement) {
+        context.partition.vcycle_min_relative_improvement = min_improvement;
+      }, "V-cycles terminate early if a cycle improves the objective relatively by less "
+         "than this threshold (0 = always run all V-cycles)")
+    .def_property("vcycle_truncated_contraction_limit_factor",
+      [](const Context& context) {
+        return context.partition.vcycle_truncated_contraction_limit_factor;
+      }, [](Context& context, const double factor) {
+        context.partition.vcycle_truncated_contraction_limit_factor = factor;
+      }, "If > 1, V-cycles first only coarsen down to this factor times the contraction limit "
+         "(truncated cycles) and switch to full cycles once they stop improving the objective")
+    .def_property("nested_partitions",
+      [](const Context& context) {
+        return context.partition.nested_partitions;
+      }, [](Context& context, const bool nested_partitions) {
+        context.partition.nested_partitions = nested_partitions;
+      }, "If true, the partition is computed with recursive bisection of the blocks, "
+         "such that its nested partitions can be extracted with get_nested_partition(...)")
+    .def_property("sanitize_during_construction",
+      [](const Context& context) {
+        return context.preprocessing.sanitize_during_construction;
+      }, [](Context& context, const bool sanitize) {
+        context.preprocessing.sanitize_during_construction = sanitize;
+      }, "If true, duplicated pins and single-pin hyperedges are removed and identical hyperedges "
+         "are merged while constructing a hypergraph")
+    .def_property("time_limit",
+      [](const Context& context) {
+        return context.partition.time_limit;
+      }, [](Context& context, const double time_limit) {
+        context.partition.time_limit = time_limit;
+      }, "Sets a wall-clock time limit in seconds for each partitioning call (0 = no limit). "
+         "If exceeded, the remaining phases are cut short and a balanced partition is returned.")
+    .def_property("memory_budget",
+      [](const Context& context) {
+        return context.partition.memory_budget;
+      }, [](Context& context, const size_t memory_budget) {
+        context.partition.memory_budget = memory_budget;
+      }, "Sets a memory budget in MB for each partitioning call (0 = no limit). "
+         "If the estimated peak memory exceeds it, cheaper algorithm configurations are used.")
     .def_property("logging",
       [](const Context& context) {
         return context.partition.verbose_output;
@@ -505,6 +818,38 @@ corresponding node or -1 if the node is not fixed.
           return py::make_iterator(range.begin(), range.end());
         });
       }, "Iterator over pins of hyperedge", py::arg("hyperedge"), py::keep_alive<0, 1>())
+    .def("csr_arrays",
+      [&](mt_kahypar_hypergraph_t hypergraph) {
+        return lib::switch_hg<py::tuple, true>(hypergraph, [](const auto& hg) {
+          const HyperedgeID num_edges = hg.initialNumEdges();
+          NumpyArray<size_t> indices(num_edges + 1);
+          size_t* indices_data = indices.mutable_data();
+          indices_data[0] = 0;
+          tbb::parallel_for<HyperedgeID>(0, num_edges, [&](const HyperedgeID he) {
+            indices_data[he + 1] = hg.edgeIsEnabled(he) ? hg.edgeSize(he) : 0;
+          });
+          parallel_prefix_sum(indices_data + 1, indices_data + num_edges + 1,
+            indices_data + 1, std::plus<size_t>(), UL(0));
+          NumpyArray<HypernodeID> pins(indices_data[num_edges]);
+          HypernodeID* pins_data = pins.mutable_data();
+          tbb::parallel_for<HyperedgeID>(0, num_edges, [&](const HyperedgeID he) {
+            if (hg.edgeIsEnabled(he)) {
+              size_t pos = indices_data[he];
+              for (const HypernodeID& pin : hg.pins(he)) {
+                pins_data[pos++] = pin;
+              }
+            }
+          });
+          return py::make_tuple(indices, pins);
+        });
+      }, R"pbdoc(
+Returns the (hyper)graph in CSR format as a tuple of two NumPy arrays (hyperedge_indices, hyperedges).
+The pins of hyperedge i are stored in hyperedges[hyperedge_indices[i]:hyperedge_indices[i + 1]].
+          )pbdoc")
+    .def("to_shared_memory", &lib::hypergraph_to_shared_memory, R"pbdoc(
+Stores the (hyper)graph in a new named shared memory segment. Other processes can attach to it in constant
+time via SharedHypergraph(name). The segment must be removed with SharedHypergraph.unlink() once it is no longer needed.
+          )pbdoc", py::arg("name"))
     .def("is_compatible",
       [&](mt_kahypar_hypergraph_t hypergraph, PresetType preset) {
         return lib::is_compatible(hypergraph, lib::get_preset_c_type(preset));
@@ -513,7 +858,31 @@ corresponding node or -1 if the node is not fixed.
       [&](mt_kahypar_hypergraph_t hypergraph, const Context& context) {
         return lib::partition(hypergraph, context);
       }, "Partitions the hypergraph with the parameters given in the partitioning context",
-      py::arg("context"))
+      py::arg("context"), py::call_guard<py::gil_scoped_release>())
+    .def("partition_async",
+      [&](py::object hypergraph, py::object context) {
+        return submit_async(hypergraph.attr("partition"), py::make_tuple(context));
+      }, R"pbdoc(
+  Partitions the hypergraph on a background thread and returns a concurrent.futures.Future
+  for the partitioned hypergraph (use asyncio.wrap_future(...) to await it in an event loop).
+          )pbdoc", py::arg("context"))
+    .def("repartition",
+      [&](mt_kahypar_hypergraph_t hypergraph,
+          const Context& context,
+          const vec<PartitionID>& previous_partition,
+          const vec<HypernodeID>& touched_nodes) {
+        ensure_correct_size(lib::num_nodes<true>(hypergraph), previous_partition, "nodes");
+        return lib::repartition(hypergraph, context, previous_partition.data(),
+                                touched_nodes.data(), touched_nodes.size());
+      }, R"pbdoc(
+  Repartitions a (hyper)graph that was obtained from a previously partitioned (hyper)graph by a small number
+  of modifications. The previous partition is projected onto the (hyper)graph (-1 marks new nodes) and is
+  improved with localized refinement that is seeded only from the touched nodes.
+
+:param previous_partition: list of block IDs for each node (-1 for new nodes)
+:param touched_nodes: list of nodes affected by the modifications (e.g., pins of modified hyperedges)
+          )pbdoc", py::arg("context"), py::arg("previous_partition"), py::arg("touched_nodes"),
+      py::call_guard<py::gil_scoped_release>())
     .def("map_onto_graph",
       [&](mt_kahypar_hypergraph_t hypergraph, mt_kahypar_py_target_graph_t graph, const Context& context) {
         TargetGraph target_graph(target_graph_cast(graph).copy());
@@ -527,7 +896,41 @@ corresponding node or -1 if the node is not fixed.
   that spans a subset of the nodes (in our case the hyperedges) on the target graph. This objective function
   is able to acurately model wire-lengths in VLSI design or communication costs in a distributed system where some
   processors do not communicate directly with each other or different speeds.
+          )pbdoc", py::arg("target_graph"), py::arg("context"), py::call_guard<py::gil_scoped_release>())
+    .def("map_onto_graph",
+      [&](mt_kahypar_hypergraph_t hypergraph, const std::shared_ptr<TargetGraph>& target_graph, const Context& context) {
+        return lib::map(hypergraph, *target_graph, context);
+      }, R"pbdoc(
+  Maps a (hyper)graph onto a precomputed target graph with the parameters given in the partitioning context.
+  The precomputed Steiner trees are reused, which is much faster when mapping many (hyper)graphs onto the same target graph.
+          )pbdoc", py::arg("target_graph"), py::arg("context"), py::call_guard<py::gil_scoped_release>())
+    .def("map_onto_graph_async",
+      [&](py::object hypergraph, py::object graph, py::object context) {
+        return submit_async(hypergraph.attr("map_onto_graph"), py::make_tuple(graph, context));
+      }, R"pbdoc(
+  Maps the hypergraph onto a target graph on a background thread and returns a
+  concurrent.futures.Future for the partitioned hypergraph.
           )pbdoc", py::arg("target_graph"), py::arg("context"))
+  .def("create_partitioned_hypergraph",
+    [&](mt_kahypar_hypergraph_t hypergraph,
+        const Context& context,
+        const PartitionID num_blocks,
+        const NumpyArray<PartitionID>& partition) {
+      ensure_correct_size(lib::num_nodes<true>(hypergraph), partition, "nodes");
+      auto result = lib::create_partitioned_hypergraph(hypergraph, context, num_blocks, partition.data());
+      if (result.partitioned_hg == nullptr) {
+        throw UnsupportedOperationException("Input is not a valid hypergraph!");
+      }
+      return result;
+    }, R"pbdoc(
+Construct a partitioned hypergraph from this hypergraph.
+
+:param num_blocks: number of block in which the hypergraph should be partitioned into
+:param partition: NumPy array of block IDs for each node
+        )pbdoc",
+    py::arg("num_blocks"), py::arg("context"),py::arg("partition"),
+    // prevent hypergraph from being freed while the PHG is still alive
+    py::keep_alive<0, 1>())
   .def("create_partitioned_hypergraph",
     [&](mt_kahypar_hypergraph_t hypergraph,
         const Context& context,
@@ -570,6 +973,113 @@ Construct a partitioned hypergraph from this hypergraph.
     // prevent hypergraph from being freed while the PHG is still alive
     py::keep_alive<0, 1>());
 
+  target_graph_class
+    .def("precompute",
+      [&](mt_kahypar_py_target_graph_t graph, const Context& context) {
+        auto target_graph = std::make_shared<TargetGraph>(target_graph_cast(graph).copy());
+        lib::precompute_target_graph(*target_graph, context);
+        return target_graph;
+      }, R"pbdoc(
+  Precomputes the Steiner trees of the target graph for the mapping parameters of the context. The returned
+  target graph is immutable and can be shared by several (also concurrent) calls of map_onto_graph and improve_mapping.
+          )pbdoc", py::arg("context"), py::call_guard<py::gil_scoped_release>());
+
+  precomputed_target_graph_class
+    .def("num_blocks", &TargetGraph::numBlocks, "Number of nodes of the target graph");
+
+  // ####################### Shared Memory Hypergraph #######################
+
+  shared_hg_class
+    .def(py::init<const std::string&>(), R"pbdoc(
+Attaches to the (hyper)graph stored in the shared memory segment with the given name
+(see Hypergraph.to_shared_memory). Attaching only maps the segment into the process and does not copy
+the (hyper)graph, which makes it cheap to use the same (hyper)graph in many worker processes.
+Shared hypergraphs can be pickled, only the name of the segment is transferred.
+          )pbdoc", py::arg("name"))
+    .def("name", &io::SharedMemoryHypergraph::name, "Name of the shared memory segment")
+    .def("is_graph", &io::SharedMemoryHypergraph::isGraph, "Returns whether or not the segment stores a graph")
+    .def("num_nodes", &io::SharedMemoryHypergraph::numNodes, "Number of nodes")
+    .def("num_edges", &io::SharedMemoryHypergraph::numEdges,
+      "Number of hyperedges (each undirected edge is counted once for graphs)")
+    .def("num_pins", &io::SharedMemoryHypergraph::numPins, "Number of pins")
+    .def("total_weight", &io::SharedMemoryHypergraph::totalWeight, "Total weight of all nodes")
+    .def("edge_size",
+      [&](const io::SharedMemoryHypergraph& hg, const HyperedgeID he) {
+        check_shared_hyperedge_is_valid(hg, he);
+        return hg.edgeSize(he);
+      }, "Size of hyperedge", py::arg("hyperedge"))
+    .def("edge_weight",
+      [&](const io::SharedMemoryHypergraph& hg, const HyperedgeID he) {
+        check_shared_hyperedge_is_valid(hg, he);
+        return hg.edgeWeight(he);
+      }, "Weight of hyperedge", py::arg("hyperedge"))
+    .def("node_weight",
+      [&](const io::SharedMemoryHypergraph& hg, const HypernodeID hn) {
+        if ( hn >= hg.numNodes() ) {
+          throw InvalidInputException("Invalid hypernode: ID is \"" + std::to_string(hn) +
+            "\", but there are only " + std::to_string(hg.numNodes()) + " nodes");
+        }
+        return hg.nodeWeight(hn);
+      }, "Weight of node", py::arg("node"))
+    .def("pins",
+      [&](const py::object& self, const HyperedgeID he) {
+        const io::SharedMemoryHypergraph& hg = self.cast<const io::SharedMemoryHypergraph&>();
+        check_shared_hyperedge_is_valid(hg, he);
+        auto range = hg.pins(he);
+        return read_only_array<HypernodeID>(std::distance(range.begin(), range.end()), range.begin(), self);
+      }, "Read-only NumPy array of the pins of hyperedge (without copying)", py::arg("hyperedge"))
+    .def("csr_arrays",
+      [&](const py::object& self) {
+        const io::SharedMemoryHypergraph& hg = self.cast<const io::SharedMemoryHypergraph&>();
+        const io::BinarySnapshotView& view = hg.view();
+        return py::make_tuple(
+          read_only_array<uint64_t>(view.num_edges + 1, view.offsets, self),
+          read_only_array<HypernodeID>(view.num_pins, reinterpret_cast<const HypernodeID*>(view.pins), self));
+      }, R"pbdoc(
+Returns the (hyper)graph in CSR format as a tuple of two read-only NumPy arrays (hyperedge_indices, hyperedges)
+that point directly into the shared memory segment.
+          )pbdoc")
+    .def("hypergraph",
+      [&](const io::SharedMemoryHypergraph& hg, const Context& context) -> py::object {
+        mt_kahypar_hypergraph_t hypergraph = [&] {
+          py::gil_scoped_release release;
+          return lib::hypergraph_from_shared_memory(hg, context);
+        }();
+        if ( hg.isGraph() ) {
+          return py::cast(mt_kahypar_py_graph_t{hypergraph});
+        }
+        return py::cast(hypergraph);
+      }, R"pbdoc(
+Constructs the (hyper)graph data structure for the preset of the context directly from the shared memory
+segment (no file I/O is involved).
+          )pbdoc", py::arg("context"))
+    .def("partition",
+      [&](const py::object& self, const Context& context) {
+        py::object hypergraph = self.attr("hypergraph")(context);
+        py::object partitioned_hg = hypergraph.attr("partition")(context);
+        // the partitioned hypergraph references the constructed hypergraph
+        py::detail::keep_alive_impl(partitioned_hg, hypergraph);
+        return partitioned_hg;
+      }, "Partitions the shared (hyper)graph with the parameters given in the partitioning context",
+      py::arg("context"))
+    .def("unlink",
+      [&](const io::SharedMemoryHypergraph& hg) {
+        io::SharedMemoryHypergraph::unlink(hg.name());
+      }, R"pbdoc(
+Removes the name of the shared memory segment. Processes that are attached to the segment can still use it,
+the memory is freed once the last process detaches.
+          )pbdoc")
+    .def(py::pickle(
+      [](const io::SharedMemoryHypergraph& hg) {
+        return py::make_tuple(hg.name());
+      },
+      [](const py::tuple& state) {
+        if ( state.size() != 1 ) {
+          throw InvalidInputException("Invalid state of shared hypergraph!");
+        }
+        return std::make_shared<io::SharedMemoryHypergraph>(state[0].cast<std::string>());
+      }));
+
   graph_class
     .def("num_directed_edges",
       [&](mt_kahypar_py_graph_t g) {
@@ -654,6 +1164,13 @@ Construct a partitioned hypergraph from this hypergraph.
           return metrics::quality(phg, Objective::steiner_tree);
         });
       }, "Computes the sum-of-external-degree metric of the partition", py::arg("target_graph"))
+    .def("steiner_tree",
+      [&](mt_kahypar_partitioned_hypergraph_t p, const std::shared_ptr<TargetGraph>& target_graph) {
+        return lib::switch_phg<PartitionID, true>(p, [&](auto& phg) {
+          phg.setTargetGraph(target_graph.get());
+          return metrics::quality(phg, Objective::steiner_tree);
+        });
+      }, "Computes the Steiner tree metric of the partition on a precomputed target graph", py::arg("target_graph"))
     .def("is_compatible",
       [&](mt_kahypar_partitioned_hypergraph_t phg, PresetType preset) {
         return lib::is_compatible(phg, lib::get_preset_c_type(preset));
@@ -668,17 +1185,84 @@ Construct a partitioned hypergraph from this hypergraph.
         lib::get_partition<true>(phg, result.data());
         return result;
       }, "Returns a list with the block to which each node is assigned.")
+    .def("get_nested_partition",
+      [&](mt_kahypar_partitioned_hypergraph_t phg, const PartitionID num_blocks) {
+        std::vector<PartitionID> result;
+        HypernodeID num_nodes = lib::switch_phg<HypernodeID, true>(phg, [=](const auto& p) {
+          return p.initialNumNodes();
+        });
+        result.resize(num_nodes, 0);
+        lib::get_nested_partition<true>(phg, num_blocks, result.data());
+        return result;
+      }, "Returns a list with the block of each node in the nested partition with the given number "
+         "of blocks (a power of two smaller than k)", py::arg("num_blocks"))
+    .def("get_block_ordering",
+      [&](mt_kahypar_partitioned_hypergraph_t p) {
+        return lib::switch_phg<py::tuple, true>(p, [=](const auto& phg) {
+          const block_ordering::BlockOrdering ordering = block_ordering::computeBlockOrdering(phg);
+          return py::make_tuple(
+            std::vector<HypernodeID>(ordering.permutation.begin(), ordering.permutation.end()),
+            std::vector<HypernodeID>(ordering.block_offsets.begin(), ordering.block_offsets.end()),
+            std::vector<HypernodeID>(ordering.halo_offsets.begin(), ordering.halo_offsets.end()),
+            std::vector<HyperedgeID>(ordering.cut_nets.begin(), ordering.cut_nets.end()));
+        });
+      }, "Returns a tuple (permutation, block_offsets, halo_offsets, cut_nets). The nodes of block b are "
+         "permutation[block_offsets[b]:block_offsets[b + 1]], with the interior nodes first followed by the "
+         "halo nodes (nodes incident to a cut net) starting at halo_offsets[b]. cut_nets contains the "
+         "(hyper)edges that span more than one block.")
+    .def("partition_array",
+      [&](mt_kahypar_partitioned_hypergraph_t phg) {
+        NumpyArray<PartitionID> result(lib::switch_phg<HypernodeID, true>(phg, [=](const auto& p) {
+          return p.initialNumNodes();
+        }));
+        lib::get_partition<true>(phg, result.mutable_data());
+        return result;
+      }, "Returns a NumPy array with the block to which each node is assigned.")
+    .def("block_weights",
+      [&](mt_kahypar_partitioned_hypergraph_t phg) {
+        NumpyArray<HypernodeWeight> result(lib::num_blocks<true>(phg));
+        lib::get_block_weights<true>(phg, result.mutable_data());
+        return result;
+      }, "Returns a NumPy array with the weight of each block.")
     .def("write_partition_to_file", &lib::write_partition_to_file<true>,
       "Writes the partition to a file", py::arg("partition_file"))
     .def("improve_partition", &lib::improve,
       "Improves the partition using the iterated multilevel cycle technique (V-cycles)",
-      py::arg("context"), py::arg("num_vcycles"))
+      py::arg("context"), py::arg("num_vcycles"), py::call_guard<py::gil_scoped_release>())
+    .def("improve_partition_async",
+      [&](py::object phg, py::object context, py::object num_vcycles) {
+        return submit_async(phg.attr("improve_partition"), py::make_tuple(context, num_vcycles));
+      }, R"pbdoc(
+  Improves the partition on a background thread and returns a concurrent.futures.Future
+  that completes once all V-cycles are finished.
+          )pbdoc", py::arg("context"), py::arg("num_vcycles"))
+    .def("improve_region",
+      [&](mt_kahypar_partitioned_hypergraph_t phg,
+          const Context& context,
+          const vec<HypernodeID>& region_nodes,
+          const HypernodeID radius) {
+        lib::improve_region(phg, context, region_nodes.data(), region_nodes.size(), radius);
+      }, R"pbdoc(
+  Improves the partition locally around the given nodes. Only nodes within the given number of hops
+  from the region nodes are moved, while all other nodes remain in their current block.
+
+:param region_nodes: list of nodes that define the region
+:param radius: number of hops by which the region is expanded (0 = only the given nodes)
+          )pbdoc", py::arg("context"), py::arg("region_nodes"), py::arg("radius") = 0,
+      py::call_guard<py::gil_scoped_release>())
     .def("improve_mapping",
       [&](mt_kahypar_partitioned_hypergraph_t phg, mt_kahypar_py_target_graph_t graph, const Context& context, size_t num_vcycles) {
         TargetGraph target_graph(target_graph_cast(graph).copy());
         lib::improve_mapping(phg, target_graph, context, num_vcycles);
       }, "Improves a mapping onto a graph using the iterated multilevel cycle technique (V-cycles)",
-      py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"))
+      py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"),
+      py::call_guard<py::gil_scoped_release>())
+    .def("improve_mapping",
+      [&](mt_kahypar_partitioned_hypergraph_t phg, const std::shared_ptr<TargetGraph>& target_graph, const Context& context, size_t num_vcycles) {
+        lib::improve_mapping(phg, *target_graph, context, num_vcycles);
+      }, "Improves a mapping onto a precomputed target graph using the iterated multilevel cycle technique (V-cycles)",
+      py::arg("target_graph"), py::arg("context"), py::arg("num_vcycles"),
+      py::call_guard<py::gil_scoped_release>())
     .def("connectivity_set",
       [&](mt_kahypar_partitioned_hypergraph_t p, HyperedgeID he) {
         return lib::switch_phg<py::iterator, true>(p, [=](const auto& phg) {
@@ -690,6 +1274,9 @@ Construct a partitioned hypergraph from this hypergraph.
       py::arg("hyperedge"), py::keep_alive<0, 1>());
 
 
+  // Executor for the asynchronous variants, created on first use
+  m.attr("_executor") = py::none();
+
 #ifdef VERSION_INFO
     m.attr("__version__") = VERSION_INFO;
 #else
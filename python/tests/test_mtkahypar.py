@@ -28,6 +28,12 @@ import unittest
 import os
 import multiprocessing
 import math
+import pickle
+
+try:
+  import numpy as np
+except ImportError:
+  np = None
 
 import mtkahypar
 
@@ -297,6 +303,57 @@ class MainTest(unittest.TestCase):
     self.assertEqual(hypergraph.edge_weight(2), 3)
     self.assertEqual(hypergraph.edge_weight(3), 4)
 
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_construct_hypergraph_from_csr_arrays(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    hypergraph = mtk.create_hypergraph_from_csr(context, 7, 4,
+      np.array([0,2,6,9,12]), np.array([0,2,0,1,3,4,3,4,6,2,5,6]),
+      np.array([1,2,3,4,5,6,7]), np.array([1,2,3,4]))
+
+    self.assertEqual(hypergraph.num_pins(), 12)
+    self.assertEqual(hypergraph.total_weight(), 28)
+    self.assertEqual([pin for pin in hypergraph.pins(1)], [0,1,3,4])
+    self.assertEqual(hypergraph.edge_weight(3), 4)
+
+    indices, pins = hypergraph.csr_arrays()
+    self.assertEqual(indices.tolist(), [0,2,6,9,12])
+    self.assertEqual(pins.tolist(), [0,2,0,1,3,4,3,4,6,2,5,6])
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_construct_hypergraph_from_invalid_csr_arrays(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    self.assertRaises(mtkahypar.InvalidInputError, lambda: mtk.create_hypergraph_from_csr(
+      context, 7, 4, np.array([0,2,6,9]), np.array([0,2,0,1,3,4,3,4,6])))
+    self.assertRaises(mtkahypar.InvalidInputError, lambda: mtk.create_hypergraph_from_csr(
+      context, 7, 2, np.array([0,2,4]), np.array([0,2,0,7])))
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_share_hypergraph_via_shared_memory(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    hypergraph = mtk.create_hypergraph(context,
+      7, 4, [[0,2],[0,1,3,4],[3,4,6],[2,5,6]],
+      [1,2,3,4,5,6,7], [1,2,3,4])
+    name = "mt_kahypar_python_test_" + str(os.getpid())
+    hypergraph.to_shared_memory(name)
+    try:
+      shared = pickle.loads(pickle.dumps(mtkahypar.SharedHypergraph(name)))
+      self.assertFalse(shared.is_graph())
+      self.assertEqual(shared.num_nodes(), 7)
+      self.assertEqual(shared.num_edges(), 4)
+      self.assertEqual(shared.total_weight(), 28)
+      self.assertEqual(shared.edge_weight(3), 4)
+      self.assertEqual(shared.pins(1).tolist(), [0,1,3,4])
+      indices, pins = shared.csr_arrays()
+      self.assertEqual(indices.tolist(), [0,2,6,9,12])
+      self.assertEqual(pins.tolist(), [0,2,0,1,3,4,3,4,6,2,5,6])
+      self.assertRaises(mtkahypar.InvalidInputError, lambda: shared.edge_size(4))
+
+      context.set_partitioning_parameters(2, 0.03, mtkahypar.Objective.KM1)
+      partitioned_hg = shared.partition(context)
+      self.assertEqual(partitioned_hg.num_blocks(), 2)
+    finally:
+      mtkahypar.SharedHypergraph(name).unlink()
+
   def test_hypergraph_applies_bounds_checking(self):
     context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
     hypergraph = mtk.create_hypergraph(context,
@@ -352,6 +409,28 @@ class MainTest(unittest.TestCase):
     self.assertEqual(partitioned_graph.block_weight(1), 2)
     self.assertEqual(partitioned_graph.block_weight(2), 2)
 
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_partition_and_block_weights_as_arrays(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph = mtk.create_graph_from_array(context, 5, 6,
+      np.array([(0,1),(0,2),(1,2),(1,3),(2,3),(3,4)]), node_weights=np.array([1,2,3,4,5]))
+    partitioned_graph = graph.create_partitioned_hypergraph(context, 3, np.array([0,1,1,2,2], dtype=np.int32))
+
+    self.assertEqual(partitioned_graph.cut(), 4)
+    self.assertEqual(partitioned_graph.partition_array().tolist(), [0,1,1,2,2])
+    self.assertEqual(partitioned_graph.block_weights().tolist(), [1,5,9])
+
+  @unittest.skipIf(np is None, "requires numpy")
+  def test_create_graph_from_csr(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph = mtk.create_graph_from_csr(context, 5,
+      np.array([0,2,5,8,11,12]), np.array([1,2,0,2,3,0,1,3,1,2,4,3]), node_weights=np.array([1,2,3,4,5]))
+    partitioned_graph = graph.create_partitioned_hypergraph(context, 3, np.array([0,1,1,2,2], dtype=np.int32))
+
+    self.assertEqual(graph.num_nodes(), 5)
+    self.assertEqual(graph.num_edges(), 12)
+    self.assertEqual(partitioned_graph.cut(), 4)
+
   def test_cut_metric_for_graph(self):
     context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
     graph = mtk.create_graph(context, 5, 6, [(0,1),(0,2),(1,2),(1,3),(2,3),(3,4)])
@@ -1056,6 +1135,14 @@ class MainTest(unittest.TestCase):
     partitioner.map_onto_graph()
     partitioner.improveMapping(1)
 
+  def test_maps_hypergraphs_onto_precomputed_target_graph(self):
+    partitioner = self.HypergraphPartitioner(mtkahypar.PresetType.DEFAULT, 8, 0.03, mtkahypar.Objective.KM1, False)
+    partitioner.target_graph = partitioner.target_graph.precompute(partitioner.context)
+    self.assertEqual(partitioner.target_graph.num_blocks(), 8)
+    partitioner.map_onto_graph()
+    partitioner.map_onto_graph()
+    partitioner.improveMapping(1)
+
   def test_partitions_a_hypergraph_with_fixed_vertices_and_default_preset(self):
     partitioner = self.HypergraphPartitioner(mtkahypar.PresetType.DEFAULT, 4, 0.03, mtkahypar.Objective.KM1, False)
     partitioner.addFixedVertices()
@@ -1072,5 +1159,39 @@ class MainTest(unittest.TestCase):
     partitioner.partition()
     partitioner.improvePartition(1)
 
+  def test_partitions_a_batch_of_hypergraphs_and_graphs(self):
+    hg_context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    hg_context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    hg_context.logging = logging
+    graph_context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    graph_context.set_partitioning_parameters(2, 0.03, mtkahypar.Objective.CUT)
+    graph_context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", hg_context)
+    graph = mtk.graph_from_file(mydir + "/test_instances/delaunay_n15.graph", graph_context)
+
+    instances = [hypergraph, graph, hypergraph, graph]
+    contexts = [hg_context, graph_context, hg_context, graph_context]
+    partitioned_hgs = mtkahypar.partition_batch(instances, contexts)
+    self.assertEqual(len(partitioned_hgs), len(instances))
+    for i in range(len(instances)):
+      self.assertLessEqual(partitioned_hgs[i].imbalance(contexts[i]), 0.03)
+      self.assertEqual(partitioned_hgs[i].num_blocks(), contexts[i].k)
+
+  def test_partitions_hypergraphs_asynchronously(self):
+    context = mtk.context_from_preset(mtkahypar.PresetType.DEFAULT)
+    context.set_partitioning_parameters(4, 0.03, mtkahypar.Objective.KM1)
+    context.logging = logging
+    hypergraph = mtk.hypergraph_from_file(mydir + "/test_instances/ibm01.hgr", context)
+
+    futures = [hypergraph.partition_async(context) for _ in range(2)]
+    for future in futures:
+      partitioned_hg = future.result()
+      self.assertLessEqual(partitioned_hg.imbalance(context), 0.03)
+      self.assertEqual(partitioned_hg.num_blocks(), 4)
+
+    km1_before = partitioned_hg.km1()
+    partitioned_hg.improve_partition_async(context, 1).result()
+    self.assertLessEqual(partitioned_hg.km1(), km1_before)
+
 if __name__ == '__main__':
   unittest.main()
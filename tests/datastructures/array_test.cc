@@ -276,7 +276,27 @@ TEST(AArray, AllocatesOwnMemoryIfAlreadyRequestedInMemoryPool) {
   parallel::MemoryPool::instance().free_memory_chunks();
 }
 
+TEST(AArray, IsZeroInitializedIfMappedFromTheOperatingSystem) {
+  const size_t size = 2 * parallel::ZeroPages::MIN_ALLOCATION_SIZE / sizeof(size_t);
+  Array<size_t> vec(size);
+  for ( size_t i = 0; i < size; ++i ) {
+    ASSERT_EQ(0, vec[i]);
+  }
+  vec[size - 1] = 42;
+  ASSERT_EQ(42, vec[size - 1]);
+
+  // Moved arrays release the mapped memory only once
+  Array<size_t> moved_vec(std::move(vec));
+  ASSERT_EQ(42, moved_vec[size - 1]);
+}
 
+TEST(AArray, IsInitializedWithNonZeroValueIfLarge) {
+  const size_t size = 2 * parallel::ZeroPages::MIN_ALLOCATION_SIZE / sizeof(size_t);
+  Array<size_t> vec(size, 7);
+  for ( size_t i = 0; i < size; ++i ) {
+    ASSERT_EQ(7, vec[i]);
+  }
+}
 
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -32,6 +32,7 @@
 
 #include "mt-kahypar/datastructures/connectivity_set.h"
 #include "mt-kahypar/datastructures/delta_connectivity_set.h"
+#include "mt-kahypar/datastructures/connectivity_info.h"
 
 using ::testing::Test;
 
@@ -783,5 +784,79 @@ TEST(ADeltaConnectivitySet, AddAndRemovesSomeBlocksFromConnectivitySet) {
   verify(delta_con_set, 32, { 9, 10, 14, 15, 16, 17, 18, 29, 30, 31 });
 }
 
+TEST(AConnectivitySet, VisitsAllBlocksOfAHyperedge) {
+  ConnectivitySets conn_set(2, 300);
+  const std::set<PartitionID> expected = { 0, 42, 64, 128, 255, 299 };
+  for ( const PartitionID& block : expected ) {
+    conn_set.add(1, block);
+  }
+  std::set<PartitionID> visited;
+  conn_set.doForAllBlocks(1, [&](const PartitionID block) {
+    visited.insert(block);
+  });
+  ASSERT_EQ(expected, visited);
+}
+
+TEST(AConnectivitySet, ComputesUnionOfConnectivitySetsForOneBitsetBlock) {
+  ConnectivitySets conn_set(3, 32);
+  conn_set.add(0, 1);
+  conn_set.add(1, 5);
+  conn_set.add(1, 1);
+  conn_set.add(2, 31);
+  Bitset adjacent_blocks(32);
+  conn_set.unionOfConnectivitySets(std::vector<HyperedgeID> { 0, 1 }, adjacent_blocks);
+  ASSERT_EQ(2, adjacent_blocks.popcount());
+  ASSERT_TRUE(adjacent_blocks.isSet(1));
+  ASSERT_TRUE(adjacent_blocks.isSet(5));
+}
+
+TEST(AConnectivitySet, ComputesUnionOfConnectivitySetsForSeveralBitsetBlocks) {
+  ConnectivitySets conn_set(3, 200);
+  conn_set.add(0, 1);
+  conn_set.add(0, 150);
+  conn_set.add(1, 70);
+  conn_set.add(2, 150);
+  conn_set.add(2, 199);
+  Bitset adjacent_blocks(200);
+  conn_set.unionOfConnectivitySets(std::vector<HyperedgeID> { 0, 2 }, adjacent_blocks);
+  ASSERT_EQ(3, adjacent_blocks.popcount());
+  ASSERT_TRUE(adjacent_blocks.isSet(1));
+  ASSERT_TRUE(adjacent_blocks.isSet(150));
+  ASSERT_TRUE(adjacent_blocks.isSet(199));
+  ASSERT_FALSE(adjacent_blocks.isSet(70));
+}
+
+TEST(AConnectivityInfo, CoLocatesConnectivitySetAndPinCountsForSmallK) {
+  ConnectivityInfo con_info(5, 8, 20);
+  ASSERT_TRUE(con_info.isCoLocated());
+  ASSERT_FALSE(ConnectivityInfo(5, 64, 20).isCoLocated());
+  for ( HyperedgeID he = 0; he < 5; ++he ) {
+    for ( PartitionID block = 0; block < 8; ++block ) {
+      con_info.setPinCountInPart(he, block, (he + block) % 3);
+      if ( (he + block) % 3 > 0 ) {
+        con_info.addBlock(he, block);
+      }
+    }
+  }
+  for ( HyperedgeID he = 0; he < 5; ++he ) {
+    PartitionID expected_connectivity = 0;
+    for ( PartitionID block = 0; block < 8; ++block ) {
+      const HypernodeID expected_pin_count = (he + block) % 3;
+      ASSERT_EQ(expected_pin_count, con_info.pinCountInPart(he, block));
+      ASSERT_EQ(expected_pin_count > 0, con_info.containsBlock(he, block));
+      expected_connectivity += expected_pin_count > 0;
+    }
+    ASSERT_EQ(expected_connectivity, con_info.connectivity(he));
+  }
+
+  con_info.reset();
+  for ( HyperedgeID he = 0; he < 5; ++he ) {
+    ASSERT_EQ(0, con_info.connectivity(he));
+    for ( PartitionID block = 0; block < 8; ++block ) {
+      ASSERT_EQ(0, con_info.pinCountInPart(he, block));
+    }
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -337,6 +337,58 @@ TEST(AContractionTree, ContainsCorrectVersionRoots4) {
   verifyChildsOfVersion(tree, 7, 2, { 9 });
 }
 
+TEST(AContractionTree, ComputesSubtreeSizesOfDeepTrees) {
+  const HypernodeID num_nodes = 10000;
+  ContractionTree tree;
+  tree.initialize(num_nodes);
+  // Node 0 is the root of a path over all even nodes and
+  // each odd node is a leaf attached to its predecessor
+  for ( HypernodeID u = 1; u < num_nodes; ++u ) {
+    tree.setParent(u, u % 2 == 0 ? u - 2 : u - 1);
+  }
+  tree.finalize();
+
+  verifyRoots(tree.roots(), { 0 });
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    const HypernodeID expected = u % 2 == 0 ? num_nodes - u - 1 : 0;
+    ASSERT_EQ(expected, tree.subtreeSize(u)) << V(u);
+  }
+}
+
+TEST(AContractionTree, CreatesBatchUncontractionHierarchiesOfAllVersions) {
+  ContractionTree tree;
+  tree.initialize(10);
+  tree.setParent(1, 0, 4);
+  tree.setParent(2, 0, 4);
+  tree.setParent(3, 1, 1);
+  tree.setParent(4, 2, 2);
+  tree.setParent(6, 5, 3);
+  tree.setParent(7, 5, 4);
+  tree.setParent(8, 6, 0);
+  tree.setParent(9, 7, 2);
+  tree.finalize(5);
+
+  const VersionedBatchVector versioned_batches = tree.createBatchUncontractionHierarchy(2);
+  ASSERT_EQ(5, versioned_batches.size());
+  for ( size_t version = 0; version < versioned_batches.size(); ++version ) {
+    std::set<HypernodeID> uncontracted;
+    for ( const Batch& batch : versioned_batches[version] ) {
+      ASSERT_GE(2, batch.size());
+      for ( const Memento& memento : batch ) {
+        ASSERT_EQ(version, tree.version(memento.v));
+        ASSERT_EQ(memento.u, tree.parent(memento.v));
+        uncontracted.insert(memento.v);
+      }
+    }
+    for ( HypernodeID v = 0; v < 10; ++v ) {
+      ASSERT_EQ(tree.parent(v) != v && tree.version(v) == version,
+                uncontracted.count(v) > 0) << V(version) << V(v);
+    }
+  }
+  // Version 4 contains the uncontractions of 1, 2 and 7. Since the
+  // batch size is two, they are distributed over two batches.
+  ASSERT_EQ(2, versioned_batches[4].size());
+}
 
 } // namespace ds
 } // namespace mt_kahypar
\ No newline at end of file
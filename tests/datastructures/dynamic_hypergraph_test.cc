@@ -27,6 +27,7 @@
 #include "gmock/gmock.h"
 
 #include <atomic>
+#include <random>
 
 #include "mt-kahypar/definitions.h"
 #include "tests/datastructures/hypergraph_fixtures.h"
@@ -1092,6 +1093,25 @@ TEST_F(ADynamicHypergraph, CreateBatchUncontractionHierarchy5) {
   verifyBatchUncontractionHierarchy(tree, versioned_batches, 6);
 }
 
+TEST_F(ADynamicHypergraph, CreateBatchUncontractionHierarchyWithUnbalancedSubtrees) {
+  ContractionTree tree;
+  // One large random tree and many small trees, which lets threads
+  // that only process small trees steal subtrees of the large tree
+  const HypernodeID num_nodes_of_large_tree = 5000;
+  const HypernodeID num_small_trees = 1000;
+  tree.initialize(num_nodes_of_large_tree + 2 * num_small_trees);
+  std::mt19937 rng(420);
+  for ( HypernodeID u = 1; u < num_nodes_of_large_tree; ++u ) {
+    tree.setParent(u, rng() % u);
+  }
+  for ( HypernodeID i = 0; i < num_small_trees; ++i ) {
+    tree.setParent(num_nodes_of_large_tree + 2 * i + 1, num_nodes_of_large_tree + 2 * i);
+  }
+  auto versioned_batches = hypergraph.createBatchUncontractionHierarchy(tree.copy(), 16);
+  ASSERT_EQ(1, versioned_batches.size());
+  verifyBatchUncontractionHierarchy(tree, versioned_batches, 16);
+}
+
 
 // TODO(heuer): test fails sporadically on CI -> further investigation and fix required
 // TEST_F(ADynamicHypergraph, CreateBatchUncontractionHierarchy6) {
@@ -1410,6 +1430,41 @@ TEST_F(ADynamicHypergraph, RestoresSinglePinAndParallelNets2) {
   ASSERT_EQ(1, hypergraph.edgeWeight(3));
 }
 
+TEST_F(ADynamicHypergraph, IteratesParallelOnlyOverEnabledElementsAfterRemovingSinglePinAndParallelNets) {
+  const parallel::scalable_vector<Memento> contractions =
+   { Memento { 0, 2 }, Memento { 1, 5 }, Memento { 6, 3 }, Memento { 6, 4 } };
+
+  for ( const Memento& memento : contractions ) {
+    hypergraph.registerContraction(memento.u, memento.v);
+    hypergraph.contract(memento.v);
+  }
+
+  auto visited_nodes = [&] {
+    std::vector<uint8_t> visited(7, false);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+      visited[hn] = true;
+    });
+    return visited;
+  };
+  auto visited_edges = [&] {
+    std::vector<uint8_t> visited(4, false);
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID he) {
+      visited[he] = true;
+    });
+    return visited;
+  };
+
+  // More than half of the nodes and edges are disabled => iteration is restricted to the enabled ones
+  auto removed_hyperedges = hypergraph.removeSinglePinAndParallelHyperedges();
+  ASSERT_EQ(std::vector<uint8_t>({ 1, 1, 0, 0, 0, 0, 1 }), visited_nodes());
+  ASSERT_EQ(std::vector<uint8_t>({ 0, 1, 0, 0 }), visited_edges());
+
+  hypergraph.restoreSinglePinAndParallelNets(removed_hyperedges);
+  ASSERT_EQ(std::vector<uint8_t>({ 1, 1, 1, 1 }), visited_edges());
+  hypergraph.enableHypernode(2);
+  ASSERT_EQ(std::vector<uint8_t>({ 1, 1, 1, 0, 0, 0, 1 }), visited_nodes());
+}
+
 TEST_F(ADynamicHypergraph, GeneratesACompactifiedHypergraph1) {
   const parallel::scalable_vector<Memento> contractions =
    { Memento { 0, 2 } };
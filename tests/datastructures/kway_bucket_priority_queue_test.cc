@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <random>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/datastructures/kway_bucket_priority_queue.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace ds {
+
+class AKWayBucketPriorityQueue : public Test {
+ public:
+  AKWayBucketPriorityQueue() :
+    pq(3) {
+    pq.initialize(10, 5);
+  }
+
+  KWayBucketPriorityQueue pq;
+};
+
+TEST_F(AKWayBucketPriorityQueue, IsEmptyAfterInitialization) {
+  for ( PartitionID part = 0; part < 3; ++part ) {
+    ASSERT_EQ(0, pq.size(part));
+    ASSERT_FALSE(pq.isEnabled(part));
+  }
+  ASSERT_EQ(0, pq.numNonEmptyParts());
+  ASSERT_EQ(0, pq.numEnabledParts());
+}
+
+TEST_F(AKWayBucketPriorityQueue, InsertsElements) {
+  pq.insert(0, 0, 3);
+  pq.insert(1, 0, -5);
+  pq.insert(0, 2, 5);
+  ASSERT_EQ(2, pq.size(0));
+  ASSERT_EQ(0, pq.size(1));
+  ASSERT_EQ(1, pq.size(2));
+  ASSERT_EQ(2, pq.numNonEmptyParts());
+  ASSERT_EQ(0, pq.numEnabledParts());
+  ASSERT_TRUE(pq.contains(0, 0));
+  ASSERT_TRUE(pq.contains(1, 0));
+  ASSERT_TRUE(pq.contains(0, 2));
+  ASSERT_FALSE(pq.contains(0, 1));
+  ASSERT_EQ(3, pq.key(0, 0));
+  ASSERT_EQ(-5, pq.key(1, 0));
+  ASSERT_EQ(5, pq.key(0, 2));
+}
+
+TEST_F(AKWayBucketPriorityQueue, CanOnlyEnableNonEmptyParts) {
+  pq.insert(0, 0, 3);
+  pq.enablePart(0);
+  pq.enablePart(1);
+  ASSERT_TRUE(pq.isEnabled(0));
+  ASSERT_FALSE(pq.isEnabled(1));
+  ASSERT_EQ(1, pq.numEnabledParts());
+}
+
+TEST_F(AKWayBucketPriorityQueue, DisablesPartIfItBecomesEmpty) {
+  pq.insert(0, 0, 3);
+  pq.enablePart(0);
+  pq.remove(0, 0);
+  ASSERT_FALSE(pq.isEnabled(0));
+  ASSERT_FALSE(pq.contains(0, 0));
+  ASSERT_EQ(0, pq.numNonEmptyParts());
+  ASSERT_EQ(0, pq.numEnabledParts());
+}
+
+TEST_F(AKWayBucketPriorityQueue, UpdatesKeys) {
+  pq.insert(0, 0, 3);
+  pq.insert(1, 0, 1);
+  pq.updateKeyBy(0, 0, -4);
+  pq.updateKeyBy(1, 0, 2);
+  ASSERT_EQ(-1, pq.key(0, 0));
+  ASSERT_EQ(3, pq.key(1, 0));
+
+  HypernodeID hn = kInvalidHypernode;
+  Gain key = 0;
+  pq.deleteMaxFromPartition(hn, key, 0);
+  ASSERT_EQ(1, hn);
+  ASSERT_EQ(3, key);
+  pq.deleteMaxFromPartition(hn, key, 0);
+  ASSERT_EQ(0, hn);
+  ASSERT_EQ(-1, key);
+  ASSERT_EQ(0, pq.size(0));
+}
+
+TEST_F(AKWayBucketPriorityQueue, DeletesMaxOnlyFromEnabledParts) {
+  pq.insert(0, 0, 1);
+  pq.insert(1, 1, 4);
+  pq.insert(2, 2, 2);
+  pq.enablePart(0);
+  pq.enablePart(2);
+
+  HypernodeID hn = kInvalidHypernode;
+  Gain key = 0;
+  PartitionID part = kInvalidPartition;
+  pq.deleteMax(hn, key, part);
+  ASSERT_EQ(2, hn);
+  ASSERT_EQ(2, key);
+  ASSERT_EQ(2, part);
+  pq.deleteMax(hn, key, part);
+  ASSERT_EQ(0, hn);
+  ASSERT_EQ(1, key);
+  ASSERT_EQ(0, part);
+  ASSERT_EQ(0, pq.numEnabledParts());
+  ASSERT_EQ(1, pq.numNonEmptyParts());
+}
+
+TEST_F(AKWayBucketPriorityQueue, IsEmptyAfterClear) {
+  pq.insert(0, 0, 1);
+  pq.insert(1, 1, 4);
+  pq.enablePart(1);
+  pq.clear();
+  ASSERT_EQ(0, pq.numNonEmptyParts());
+  ASSERT_EQ(0, pq.numEnabledParts());
+  ASSERT_FALSE(pq.contains(0, 0));
+  ASSERT_FALSE(pq.contains(1, 1));
+
+  pq.insert(1, 1, -2);
+  HypernodeID hn = kInvalidHypernode;
+  Gain key = 0;
+  pq.deleteMaxFromPartition(hn, key, 1);
+  ASSERT_EQ(1, hn);
+  ASSERT_EQ(-2, key);
+}
+
+TEST(AKWayBucketPriorityQueueRandomized, ExtractsElementsWithMaximumKey) {
+  const PartitionID k = 4;
+  const HypernodeID n = 100;
+  const Gain max_key = 20;
+  KWayBucketPriorityQueue pq(k);
+  pq.initialize(n, max_key);
+  // naive model of the queue
+  std::vector<std::vector<bool>> contained(k, std::vector<bool>(n, false));
+  std::vector<std::vector<Gain>> keys(k, std::vector<Gain>(n, 0));
+
+  std::mt19937 rng(420);
+  std::uniform_int_distribution<HypernodeID> random_node(0, n - 1);
+  std::uniform_int_distribution<PartitionID> random_part(0, k - 1);
+  std::uniform_int_distribution<Gain> random_key(-max_key, max_key);
+  for ( size_t i = 0; i < 5000; ++i ) {
+    const HypernodeID hn = random_node(rng);
+    const PartitionID part = random_part(rng);
+    if ( !contained[part][hn] ) {
+      const Gain key = random_key(rng);
+      pq.insert(hn, part, key);
+      contained[part][hn] = true;
+      keys[part][hn] = key;
+    } else if ( i % 3 == 0 ) {
+      pq.remove(hn, part);
+      contained[part][hn] = false;
+    } else if ( i % 3 == 1 ) {
+      const Gain new_key = random_key(rng);
+      pq.updateKeyBy(hn, part, new_key - keys[part][hn]);
+      keys[part][hn] = new_key;
+    } else {
+      pq.enablePart(part);
+      HypernodeID max_hn = kInvalidHypernode;
+      Gain max_hn_key = 0;
+      PartitionID max_part = kInvalidPartition;
+      pq.deleteMax(max_hn, max_hn_key, max_part);
+      ASSERT_TRUE(contained[max_part][max_hn]);
+      ASSERT_EQ(keys[max_part][max_hn], max_hn_key);
+      for ( PartitionID p = 0; p < k; ++p ) {
+        if ( pq.isEnabled(p) || p == max_part ) {
+          for ( HypernodeID u = 0; u < n; ++u ) {
+            if ( contained[p][u] ) {
+              ASSERT_LE(keys[p][u], max_hn_key);
+            }
+          }
+        }
+      }
+      contained[max_part][max_hn] = false;
+    }
+
+    for ( PartitionID p = 0; p < k; ++p ) {
+      const size_t expected_size = std::count(contained[p].begin(), contained[p].end(), true);
+      ASSERT_EQ(expected_size, pq.size(p));
+      ASSERT_TRUE(pq.size(p) > 0 || !pq.isEnabled(p));
+    }
+  }
+}
+
+}  // namespace ds
+}  // namespace mt_kahypar
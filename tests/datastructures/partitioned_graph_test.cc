@@ -26,6 +26,8 @@
  ******************************************************************************/
 
 #include <atomic>
+#include <mutex>
+#include <set>
 
 #include "gmock/gmock.h"
 
@@ -276,6 +278,36 @@ TYPED_TEST(APartitionedGraph, HasCorrectInitialBorderNodes) {
   ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(6));
 }
 
+TYPED_TEST(APartitionedGraph, TracksBorderNodesIncrementally) {
+  this->partitioned_hypergraph.initializeBorderNodes();
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(4, 1, 0));
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(3, 1, 0));
+  ASSERT_TRUE(this->partitioned_hypergraph.isTrackingBorderNodes());
+
+  ASSERT_FALSE(this->partitioned_hypergraph.isBorderNode(1));
+  ASSERT_FALSE(this->partitioned_hypergraph.isBorderNode(2));
+  ASSERT_FALSE(this->partitioned_hypergraph.isBorderNode(3));
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(4));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(5));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(6));
+  ASSERT_TRUE(this->partitioned_hypergraph.checkTrackedPartitionInformation());
+
+  std::mutex lock;
+  std::set<HypernodeID> border_nodes;
+  this->partitioned_hypergraph.doParallelForAllBorderNodes([&](const HypernodeID hn) {
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_TRUE(border_nodes.insert(hn).second) << V(hn);
+  });
+  ASSERT_EQ(std::set<HypernodeID>({ 4, 5, 6 }), border_nodes);
+}
+
+TYPED_TEST(APartitionedGraph, StopsTrackingBorderNodesIfPartitionIsReset) {
+  this->partitioned_hypergraph.initializeBorderNodes();
+  ASSERT_TRUE(this->partitioned_hypergraph.isTrackingBorderNodes());
+  this->partitioned_hypergraph.resetPartition();
+  ASSERT_FALSE(this->partitioned_hypergraph.isTrackingBorderNodes());
+}
+
 
 TYPED_TEST(APartitionedGraph, ExtractBlockZero) {
   auto extracted_hg = this->partitioned_hypergraph.extract(0, nullptr, true, true);
@@ -431,5 +463,37 @@ TYPED_TEST(APartitionedGraph, ComputesDeltaAndGainsCorrectlyIfAllNodesMoveConcur
   this->verifyGains(6, {0, -2, -2});
 }
 
+TYPED_TEST(APartitionedGraph, ComputesCorrectCutDeltaIfNodesAreMovedAndRevertedConcurrently) {
+  this->gain_cache.initializeGainCache(this->partitioned_hypergraph);
+  const HyperedgeWeight initial_cut = metrics::quality(this->partitioned_hypergraph, Objective::cut);
+
+  // Each node is moved through all blocks several times, which also reverts previous moves
+  CAtomic<HyperedgeWeight> delta(0);
+  tbb::parallel_for(ID(0), this->hypergraph.initialNumNodes(), [&](const HypernodeID& hn) {
+    if ( this->hypergraph.nodeIsEnabled(hn) ) {
+      for ( size_t i = 0; i < 100; ++i ) {
+        const PartitionID from = this->partitioned_hypergraph.partID(hn);
+        const PartitionID to = ( from + 1 + i % 2 ) % this->partitioned_hypergraph.k();
+        this->partitioned_hypergraph.changeNodePart(this->gain_cache, hn, from, to,
+          std::numeric_limits<HypernodeWeight>::max(), []{},
+          [&](const SynchronizedEdgeUpdate& sync_update) {
+            delta.fetch_add(CutAttributedGains::gain(sync_update), std::memory_order_relaxed);
+          });
+      }
+    }
+  });
+
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, Objective::cut), initial_cut + delta.load());
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    const PartitionID from = this->partitioned_hypergraph.partID(hn);
+    ASSERT_EQ(this->gain_cache.recomputePenaltyTerm(this->partitioned_hypergraph, hn),
+      this->gain_cache.penaltyTerm(hn, from)) << V(hn);
+    for ( PartitionID to = 0; to < this->partitioned_hypergraph.k(); ++to ) {
+      ASSERT_EQ(this->gain_cache.recomputeBenefitTerm(this->partitioned_hypergraph, hn, to),
+        this->gain_cache.benefitTerm(hn, to)) << V(hn) << V(to);
+    }
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
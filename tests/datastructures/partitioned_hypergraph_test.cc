@@ -27,6 +27,8 @@
 
 
 #include <atomic>
+#include <mutex>
+#include <set>
 #include <mt-kahypar/parallel/tbb_initializer.h>
 
 #include "gmock/gmock.h"
@@ -419,6 +421,79 @@ TYPED_TEST(APartitionedHypergraph, HasCorrectBorderNodesIfNodesAreMovingConcurre
   ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(6));
 }
 
+TYPED_TEST(APartitionedHypergraph, TracksBorderNodesIncrementally) {
+  this->partitioned_hypergraph.initializeBorderNodes();
+  ASSERT_TRUE(this->partitioned_hypergraph.isTrackingBorderNodes());
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(4, 1, 0));
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(3, 1, 0));
+  ASSERT_TRUE(this->partitioned_hypergraph.isTrackingBorderNodes());
+
+  ASSERT_FALSE(this->partitioned_hypergraph.isBorderNode(0));
+  ASSERT_FALSE(this->partitioned_hypergraph.isBorderNode(1));
+  ASSERT_TRUE(this->partitioned_hypergraph.isBorderNode(2));
+  ASSERT_EQ(0, this->partitioned_hypergraph.numIncidentCutHyperedges(0));
+  ASSERT_EQ(0, this->partitioned_hypergraph.numIncidentCutHyperedges(1));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(2));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(3));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(4));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(5));
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(6));
+  ASSERT_TRUE(this->partitioned_hypergraph.checkTrackedPartitionInformation());
+}
+
+TYPED_TEST(APartitionedHypergraph, IteratesOverTrackedBorderNodes) {
+  this->partitioned_hypergraph.initializeBorderNodes();
+  // Removes hyperedges 1 and 3 from the cut
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(2, 0, 2));
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(3, 1, 0));
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(4, 1, 0));
+
+  std::mutex lock;
+  std::set<HypernodeID> border_nodes;
+  this->partitioned_hypergraph.doParallelForAllBorderNodes([&](const HypernodeID hn) {
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_TRUE(border_nodes.insert(hn).second) << V(hn);
+  });
+  ASSERT_EQ(std::set<HypernodeID>({ 0, 2, 3, 4, 6 }), border_nodes);
+  ASSERT_TRUE(this->partitioned_hypergraph.checkTrackedPartitionInformation());
+
+  // Node 1 becomes a border node again
+  ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(1, 0, 1));
+  border_nodes.clear();
+  this->partitioned_hypergraph.doParallelForAllBorderNodes([&](const HypernodeID hn) {
+    std::lock_guard<std::mutex> guard(lock);
+    ASSERT_TRUE(border_nodes.insert(hn).second) << V(hn);
+  });
+  ASSERT_EQ(std::set<HypernodeID>({ 0, 1, 2, 3, 4, 6 }), border_nodes);
+}
+
+TYPED_TEST(APartitionedHypergraph, TracksBorderNodesIfNodesAreMovingConcurrently) {
+  this->partitioned_hypergraph.initializeBorderNodes();
+  executeConcurrent([&] {
+    ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(3, 1, 0));
+    ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(1, 0, 1));
+  }, [&] {
+    ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(4, 1, 0));
+    ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(2, 0, 1));
+  });
+
+  ASSERT_TRUE(this->partitioned_hypergraph.isTrackingBorderNodes());
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(0));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(1));
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(2));
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(3));
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(4));
+  ASSERT_EQ(1, this->partitioned_hypergraph.numIncidentCutHyperedges(5));
+  ASSERT_EQ(2, this->partitioned_hypergraph.numIncidentCutHyperedges(6));
+}
+
+TYPED_TEST(APartitionedHypergraph, StopsTrackingBorderNodesIfPartitionIsReset) {
+  this->partitioned_hypergraph.initializeBorderNodes();
+  ASSERT_TRUE(this->partitioned_hypergraph.isTrackingBorderNodes());
+  this->partitioned_hypergraph.resetPartition();
+  ASSERT_FALSE(this->partitioned_hypergraph.isTrackingBorderNodes());
+}
+
 TYPED_TEST(APartitionedHypergraph, HasCorrectBorderNodesIfNodesAreMovingConcurrently3) {
   executeConcurrent([&] {
     ASSERT_TRUE(this->partitioned_hypergraph.changeNodePart(6, 2, 0));
@@ -771,6 +846,29 @@ TYPED_TEST(APartitionedHypergraph, ComputesConnectivitySetCorrectIfNodePartsAreS
   this->verifyConnectivitySet(3, { 0, 2 });
 }
 
+TYPED_TEST(APartitionedHypergraph, InitializesPartitionFromABlockFunction) {
+  const std::vector<PartitionID> blocks = { 0, 0, 0, 1, 1, 2, 2 };
+  this->partitioned_hypergraph.resetPartition();
+  this->partitioned_hypergraph.initializePartition([&](const HypernodeID hn) {
+    return blocks[hn];
+  });
+
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    ASSERT_EQ(blocks[hn], this->partitioned_hypergraph.partID(hn));
+  }
+  ASSERT_EQ(3, this->partitioned_hypergraph.partWeight(0));
+  ASSERT_EQ(2, this->partitioned_hypergraph.partWeight(1));
+  ASSERT_EQ(2, this->partitioned_hypergraph.partWeight(2));
+  this->verifyPartitionPinCounts(0, { 2, 0, 0 });
+  this->verifyPartitionPinCounts(1, { 2, 2, 0 });
+  this->verifyPartitionPinCounts(2, { 0, 2, 1 });
+  this->verifyPartitionPinCounts(3, { 1, 0, 2 });
+  this->verifyConnectivitySet(0, { 0 });
+  this->verifyConnectivitySet(1, { 0, 1 });
+  this->verifyConnectivitySet(2, { 1, 2 });
+  this->verifyConnectivitySet(3, { 0, 2 });
+}
+
 TYPED_TEST(APartitionedHypergraph, ComputesBorderNodesCorrectIfNodePartsAreSetOnly) {
   this->partitioned_hypergraph.resetPartition();
   this->partitioned_hypergraph.setOnlyNodePart(0, 0);
@@ -799,5 +897,25 @@ TYPED_TEST(APartitionedHypergraph, ComputesBorderNodesCorrectIfNodePartsAreSetOn
   ASSERT_TRUE(this->partitioned_hypergraph.isBorderNode(6));
 }
 
+TYPED_TEST(APartitionedHypergraph, TreatsNodesOutsideOfTheMovableRegionAsFixed) {
+  ASSERT_FALSE(this->partitioned_hypergraph.hasFixedVertices());
+  Bitset region(this->hypergraph.initialNumNodes());
+  region.set(3);
+  region.set(4);
+  this->partitioned_hypergraph.setMovableRegion(&region);
+
+  ASSERT_TRUE(this->partitioned_hypergraph.hasFixedVertices());
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    const bool in_region = hn == 3 || hn == 4;
+    ASSERT_EQ(!in_region, this->partitioned_hypergraph.isFixed(hn)) << V(hn);
+    ASSERT_EQ(in_region ? kInvalidPartition : this->partitioned_hypergraph.partID(hn),
+              this->partitioned_hypergraph.fixedVertexBlock(hn)) << V(hn);
+  }
+
+  this->partitioned_hypergraph.setMovableRegion(nullptr);
+  ASSERT_FALSE(this->partitioned_hypergraph.hasFixedVertices());
+  ASSERT_FALSE(this->partitioned_hypergraph.isFixed(0));
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
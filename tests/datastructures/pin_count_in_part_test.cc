@@ -30,6 +30,7 @@
 #include <mt-kahypar/macros.h>
 
 #include "gmock/gmock.h"
+#include <tbb/parallel_for.h>
 #include <tbb/task_group.h>
 
 #include "mt-kahypar/datastructures/pin_count_in_part.h"
@@ -807,6 +808,86 @@ TYPED_TEST(APinCountDataStructure, MakesASnapshot2) {
   EXPECT_EQ(0, snapshot_2.pinCountInPart(7));
 }
 
+TYPED_TEST(APinCountDataStructure, StoresPinCountsInShortLanes_k16_Max1000) {
+  const HyperedgeID num_hyperedges = 10;
+  const PartitionID k = 16;
+  const HypernodeID max_value = 1000;
+  ASSERT_EQ(2, PinCountLayout::num_lane_bytes(k, max_value));
+  this->initialize(num_hyperedges, k, max_value);
+
+  this->pin_count.setPinCountInPart(3, 15, 1000);
+  this->pin_count.setPinCountInPart(4, 0, 255);
+  this->pin_count.incrementPinCountInPart(4, 0);
+  this->pin_count.decrementPinCountInPart(3, 15);
+  ASSERT_EQ(999, this->pin_count.pinCountInPart(3, 15));
+  ASSERT_EQ(256, this->pin_count.pinCountInPart(4, 0));
+  ASSERT_EQ(0, this->pin_count.pinCountInPart(3, 14));
+  ASSERT_EQ(0, this->pin_count.pinCountInPart(4, 1));
+
+  PinCountSnapshot& snapshot = this->pin_count.snapshot(4);
+  EXPECT_EQ(256, snapshot.pinCountInPart(0));
+  EXPECT_EQ(0, snapshot.pinCountInPart(15));
+}
+
+TYPED_TEST(APinCountDataStructure, PacksPinCountsForLargeK_k128_Max2) {
+  const HyperedgeID num_hyperedges = 10;
+  const PartitionID k = 128;
+  const HypernodeID max_value = 2;
+  ASSERT_EQ(0, PinCountLayout::num_lane_bytes(k, max_value));
+  this->initialize(num_hyperedges, k, max_value);
+
+  std::vector<HypernodeID> expected_pin_count(k, 0);
+  for ( PartitionID block = 0; block < k; ++block ) {
+    expected_pin_count[block] = rand() % (max_value + 1);
+    this->pin_count.setPinCountInPart(7, block, expected_pin_count[block]);
+  }
+
+  PinCountSnapshot& snapshot = this->pin_count.snapshot(7);
+  for ( PartitionID block = 0; block < k; ++block ) {
+    ASSERT_EQ(expected_pin_count[block], this->pin_count.pinCountInPart(7, block));
+    ASSERT_EQ(expected_pin_count[block], snapshot.pinCountInPart(block));
+    ASSERT_EQ(0, this->pin_count.pinCountInPart(6, block));
+  }
+}
+
+
+TEST(APinCountInPart, MovesPinsAtomicallyIfPinCountsAreStoredInOneWord) {
+  PinCountInPart pin_count(2, 4, 1000);
+  ASSERT_TRUE(pin_count.isStoredInOneWord());
+  pin_count.setPinCountInPart(1, 0, 2);
+  pin_count.setPinCountInPart(1, 3, 999);
+
+  ASSERT_EQ(std::make_pair(ID(1), ID(1000)), pin_count.movePinAtomically(1, 0, 3));
+  ASSERT_EQ(std::make_pair(ID(999), ID(1)), pin_count.movePinAtomically(1, 3, 2));
+  ASSERT_EQ(1, pin_count.pinCountInPart(1, 0));
+  ASSERT_EQ(0, pin_count.pinCountInPart(1, 1));
+  ASSERT_EQ(1, pin_count.pinCountInPart(1, 2));
+  ASSERT_EQ(999, pin_count.pinCountInPart(1, 3));
+  for ( PartitionID block = 0; block < 4; ++block ) {
+    ASSERT_EQ(0, pin_count.pinCountInPart(0, block));
+  }
+}
+
+TEST(APinCountInPart, MovesPinsAtomicallyInParallel) {
+  const HypernodeID num_pins = 1000;
+  PinCountInPart pin_count(1, 4, num_pins);
+  ASSERT_TRUE(pin_count.isStoredInOneWord());
+  pin_count.setPinCountInPart(0, 0, num_pins);
+
+  std::atomic<HypernodeID> num_moves_to_empty_block(0);
+  tbb::parallel_for(UL(0), UL(num_pins), [&](const size_t i) {
+    const PartitionID to = 1 + i % 3;
+    if ( pin_count.movePinAtomically(0, 0, to).second == 1 ) {
+      ++num_moves_to_empty_block;
+    }
+  });
+
+  ASSERT_EQ(0, pin_count.pinCountInPart(0, 0));
+  ASSERT_EQ(334, pin_count.pinCountInPart(0, 1));
+  ASSERT_EQ(333, pin_count.pinCountInPart(0, 2));
+  ASSERT_EQ(333, pin_count.pinCountInPart(0, 3));
+  ASSERT_EQ(3, num_moves_to_empty_block.load());
+}
 
 #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
 
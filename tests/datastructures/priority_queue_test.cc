@@ -42,7 +42,7 @@ namespace ds {
 
 
 namespace QuadHeap {
-  using EMaxHeap = ExclusiveHandleHeap<MaxHeap<int, int>>;
+  using EMaxHeap = ExclusiveHandleHeap<MaxHeap<int, int, 4>>;
 
   TEST(APriorityQueue, ReturnsMax) {
     EMaxHeap h(400);
@@ -270,5 +270,68 @@ namespace BinaryHeap {
 
 }
 
+namespace OctaHeap {
+  using EMaxHeap = ExclusiveHandleHeap<MaxHeap<int, int, 8>>;
+
+  TEST(APriorityQueue, HeapSort) {
+    size_t n = 50000;
+    EMaxHeap h(n);
+    std::vector<std::pair<int, int>> kv_pairs;
+    std::mt19937 rng(420);
+    std::uniform_int_distribution dist(0, 1000000);
+    for (size_t i = 0; i < n; ++i) {
+      kv_pairs.emplace_back(dist(rng), i);
+    }
+    std::shuffle(kv_pairs.begin(), kv_pairs.end(), rng);
+
+    for (auto& x : kv_pairs) {
+      h.insert(x.second, x.first);
+    }
+
+    std::sort(kv_pairs.begin(), kv_pairs.end(), std::greater<std::pair<int, int>>());
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.topKey(), kv_pairs[i].first);
+      i++;
+      h.deleteTop();
+    }
+    ASSERT_EQ(i, n);
+  }
+
+  TEST(APriorityQueue, HeapSortAfterAdjustingAndRemovingKeys) {
+    size_t n = 20000;
+    EMaxHeap h(n);
+    std::vector<int> keys(n);
+    std::mt19937 rng(420);
+    std::uniform_int_distribution dist(0, 1000000);
+    for (size_t i = 0; i < n; ++i) {
+      keys[i] = dist(rng);
+      h.insert(i, keys[i]);
+    }
+    for (size_t i = 0; i < n; i += 3) {
+      keys[i] = dist(rng);
+      h.adjustKey(i, keys[i]);
+    }
+    std::vector<int> expected_keys;
+    for (size_t i = 0; i < n; ++i) {
+      if ( i % 7 == 0 ) {
+        h.remove(i);
+      } else {
+        expected_keys.push_back(keys[i]);
+      }
+    }
+
+    std::sort(expected_keys.begin(), expected_keys.end(), std::greater<int>());
+    ASSERT_EQ(expected_keys.size(), h.size());
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.topKey(), expected_keys[i++]);
+      h.deleteTop();
+    }
+    h.insert(5, 42);
+    ASSERT_EQ(5, h.top());
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/datastructures/sharded_lru_cache.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace ds {
+
+// Entry has 16 bytes, a bucket stores four entries
+constexpr size_t BUCKET_SIZE_IN_BYTES = 64;
+
+TEST(AShardedLRUCache, HasCapacityBoundedByMemoryBudget) {
+  ShardedLRUCache<int> cache;
+  cache.initialize(1000 * BUCKET_SIZE_IN_BYTES, 4);
+  // 250 buckets per shard are rounded down to 128 buckets
+  ASSERT_EQ(4 * 128 * 4, cache.capacity());
+}
+
+TEST(AShardedLRUCache, FindsInsertedElements) {
+  ShardedLRUCache<int> cache;
+  cache.initialize(1024 * BUCKET_SIZE_IN_BYTES, 4);
+  for ( uint64_t key = 0; key < 100; ++key ) {
+    cache.insert(key, static_cast<int>(2 * key));
+  }
+  ASSERT_EQ(100, cache.size());
+  for ( uint64_t key = 0; key < 100; ++key ) {
+    int value = -1;
+    ASSERT_TRUE(cache.find(key, value));
+    ASSERT_EQ(2 * key, value);
+  }
+  int value = -1;
+  ASSERT_FALSE(cache.find(100, value));
+  ASSERT_EQ(100, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+}
+
+TEST(AShardedLRUCache, UpdatesValueOfExistingElement) {
+  ShardedLRUCache<int> cache;
+  cache.initialize(BUCKET_SIZE_IN_BYTES, 1);
+  cache.insert(42, 1);
+  cache.insert(42, 2);
+  int value = -1;
+  ASSERT_TRUE(cache.find(42, value));
+  ASSERT_EQ(2, value);
+  ASSERT_EQ(1, cache.size());
+}
+
+TEST(AShardedLRUCache, EvictsLeastRecentlyUsedElement) {
+  ShardedLRUCache<int> cache;
+  // Only one bucket with four entries
+  cache.initialize(BUCKET_SIZE_IN_BYTES, 1);
+  ASSERT_EQ(4, cache.capacity());
+  for ( uint64_t key = 0; key < 4; ++key ) {
+    cache.insert(key, static_cast<int>(key));
+  }
+  int value = -1;
+  ASSERT_TRUE(cache.find(0, value));
+  ASSERT_TRUE(cache.find(2, value));
+  ASSERT_TRUE(cache.find(3, value));
+  cache.insert(4, 4);
+  ASSERT_EQ(4, cache.size());
+  ASSERT_FALSE(cache.find(1, value));
+  ASSERT_TRUE(cache.find(0, value));
+  ASSERT_TRUE(cache.find(4, value));
+  ASSERT_EQ(4, value);
+}
+
+TEST(AShardedLRUCache, NeverExceedsItsCapacity) {
+  ShardedLRUCache<int> cache;
+  cache.initialize(16 * BUCKET_SIZE_IN_BYTES, 2);
+  for ( uint64_t key = 0; key < 10000; ++key ) {
+    cache.insert(key, static_cast<int>(key));
+  }
+  ASSERT_LE(cache.size(), cache.capacity());
+  size_t num_contained = 0;
+  for ( uint64_t key = 0; key < 10000; ++key ) {
+    int value = -1;
+    if ( cache.find(key, value) ) {
+      ASSERT_EQ(key, value);
+      ++num_contained;
+    }
+  }
+  ASSERT_EQ(cache.size(), num_contained);
+}
+
+TEST(AShardedLRUCache, InsertsAndFindsElementsConcurrently) {
+  ShardedLRUCache<int> cache;
+  cache.initialize(4096 * BUCKET_SIZE_IN_BYTES, 16);
+  tbb::parallel_for(UL(0), UL(1000), [&](const size_t key) {
+    int value = -1;
+    if ( !cache.find(key, value) ) {
+      cache.insert(key, static_cast<int>(key));
+    }
+    ASSERT_TRUE(cache.find(key, value));
+    ASSERT_EQ(key, value);
+  });
+  ASSERT_EQ(1000, cache.size());
+  ASSERT_EQ(1000, cache.hits() + cache.misses() - 1000);
+}
+
+}  // namespace ds
+}  // namespace mt_kahypar
@@ -101,5 +101,24 @@ TYPED_TEST(ADynamicSparseMap, IsForcedToGrow) {
   }
 }
 
+TYPED_TEST(ADynamicSparseMap, ClearsAllElementsAndKeepsItsCapacity) {
+  auto& map = this->map;
+  map.initialize(16);
+  for ( size_t round = 0; round < 3; ++round ) {
+    for ( size_t i = 0; i < 100; ++i ) {
+      ASSERT_FALSE(map.contains(i));
+      map[i] = i + round;
+    }
+    ASSERT_EQ(100, map.size());
+    for ( size_t i = 0; i < 100; ++i ) {
+      ASSERT_EQ(i + round, map.get(i));
+    }
+    const size_t capacity = map.capacity();
+    map.clear();
+    ASSERT_EQ(0, map.size());
+    ASSERT_EQ(capacity, map.capacity());
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -142,5 +142,76 @@ TEST(AStaticBitset, PerformsXOROperation2) {
   verify_iterator(res_bitset, { 0, 25, 85 });
 }
 
+TEST(AStaticBitset, PerformsOROperation) {
+  Bitset bits_1(128);
+  set_one_bits(bits_1, { 0, 3, 65, 121 });
+  Bitset bits_2(128);
+  set_one_bits(bits_2, { 3, 6, 85 });
+  StaticBitset bitset_1(bits_1.numBlocks(), bits_1.data());
+  StaticBitset bitset_2(bits_2.numBlocks(), bits_2.data());
+  Bitset res = bitset_1 | bitset_2;
+  StaticBitset res_bitset(res.numBlocks(), res.data());
+  verify_iterator(res_bitset, { 0, 3, 6, 65, 85, 121 });
+}
+
+TEST(AStaticBitset, PerformsANDOperation) {
+  Bitset bits_1(128);
+  set_one_bits(bits_1, { 0, 3, 65, 85, 121 });
+  Bitset bits_2(128);
+  set_one_bits(bits_2, { 3, 6, 85, 121 });
+  StaticBitset bitset_1(bits_1.numBlocks(), bits_1.data());
+  StaticBitset bitset_2(bits_2.numBlocks(), bits_2.data());
+  Bitset res = bitset_1 & bitset_2;
+  StaticBitset res_bitset(res.numBlocks(), res.data());
+  verify_iterator(res_bitset, { 3, 85, 121 });
+}
+
+TEST(AStaticBitset, VisitsAllOneBits) {
+  Bitset bits(512);
+  const vec<PartitionID> expected = { 0, 1, 63, 64, 200, 383, 384, 511 };
+  set_one_bits(bits, expected);
+  StaticBitset bitset(bits.numBlocks(), bits.data());
+  vec<PartitionID> visited;
+  bitset.doForAllOneBits([&](const PartitionID pos) {
+    visited.push_back(pos);
+  });
+  ASSERT_EQ(expected, visited);
+}
+
+TEST(ABitset, ComputesUnionAndIntersection) {
+  Bitset bits_1(128);
+  set_one_bits(bits_1, { 1, 70, 100 });
+  Bitset bits_2(128);
+  set_one_bits(bits_2, { 2, 70 });
+  bits_1.unionWith(bits_2.numBlocks(), bits_2.data());
+  verify_iterator(StaticBitset(bits_1.numBlocks(), bits_1.data()), { 1, 2, 70, 100 });
+  ASSERT_EQ(4, bits_1.popcount());
+
+  Bitset bits_3(64);
+  set_one_bits(bits_3, { 1, 5 });
+  bits_1.intersectWith(bits_3.numBlocks(), bits_3.data());
+  verify_iterator(StaticBitset(bits_1.numBlocks(), bits_1.data()), { 1 });
+  ASSERT_EQ(1, bits_1.popcount());
+}
+
+TEST(ABitset, CountsOneBitsOfLargeBitsets) {
+  // More than two blocks are counted by the (runtime dispatched) kernel
+  Bitset bits_1(1000);
+  Bitset bits_2(1000);
+  int expected_popcount = 0;
+  int expected_xor_popcount = 0;
+  for ( size_t i = 0; i < 1000; ++i ) {
+    const bool in_1 = i % 3 == 0;
+    const bool in_2 = i % 5 == 0;
+    if ( in_1 ) bits_1.set(i);
+    if ( in_2 ) bits_2.set(i);
+    expected_popcount += in_1;
+    expected_xor_popcount += in_1 != in_2;
+  }
+  ASSERT_EQ(expected_popcount, bits_1.popcount());
+  ASSERT_EQ(expected_xor_popcount,
+    utils::xor_popcount_blocks(bits_1.data(), bits_2.data(), bits_1.numBlocks()));
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
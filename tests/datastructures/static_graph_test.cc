@@ -350,5 +350,35 @@ TEST_F(AStaticGraph, ContractsCommunities2) {
   verifyPins(c_graph, { 1 }, { {1, 2} });
 }
 
+TEST(AStaticGraphWithManyParallelEdges, AggregatesParallelEdgesOfMediumDegreeClusters) {
+  // Node i < 300 is adjacent to node 300 + i. All nodes i < 300 are contracted
+  // into one cluster and the other nodes into three clusters, which results in
+  // a cluster with 300 incident edges and only three distinct neighbors.
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID i = 0; i < 300; ++i ) {
+    edges.push_back({ i, 300 + i });
+  }
+  StaticGraph graph = StaticGraphFactory::construct(600, edges.size(), edges);
+  parallel::scalable_vector<HypernodeID> c_mapping(600, 0);
+  for ( HypernodeID i = 300; i < 600; ++i ) {
+    c_mapping[i] = 300 + i % 3;
+  }
+  StaticGraph c_graph = graph.contract(c_mapping);
+
+  ASSERT_EQ(4, c_graph.initialNumNodes());
+  ASSERT_EQ(6, c_graph.initialNumEdges());
+  ASSERT_EQ(3, c_graph.nodeDegree(0));
+  HypernodeID last_target = 0;
+  for ( const HyperedgeID& he : c_graph.incidentEdges(0) ) {
+    ASSERT_LT(last_target, c_graph.edgeTarget(he));
+    ASSERT_EQ(100, c_graph.edgeWeight(he));
+    last_target = c_graph.edgeTarget(he);
+  }
+  for ( HypernodeID u = 1; u < 4; ++u ) {
+    ASSERT_EQ(1, c_graph.nodeDegree(u));
+    ASSERT_EQ(100, c_graph.nodeWeight(u));
+  }
+}
+
 }
 } // namespace mt_kahypar
\ No newline at end of file
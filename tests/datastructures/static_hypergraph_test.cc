@@ -317,6 +317,33 @@ TEST_F(AStaticHypergraph, ComparesCommunityIdsIfCopiedSequential) {
   ASSERT_EQ(hypergraph.communityID(6), copy_hg.communityID(6));
 }
 
+TEST_F(AStaticHypergraph, ComparesIncidentNetsAndPinsOfAShallowCopy) {
+  StaticHypergraph copy_hg = hypergraph.shallowCopy(parallel_tag_t());
+  ASSERT_EQ(hypergraph.initialNumPins(), copy_hg.initialNumPins());
+  ASSERT_EQ(hypergraph.totalWeight(), copy_hg.totalWeight());
+  verifyIncidentNets(copy_hg, 0, { 0, 1 });
+  verifyIncidentNets(copy_hg, 3, { 1, 2 });
+  verifyIncidentNets(copy_hg, 6, { 2, 3 });
+  verifyPins(copy_hg, { 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+}
+
+TEST_F(AStaticHypergraph, DoesNotModifyTheOriginalIfAHyperedgeIsRemovedFromAShallowCopy) {
+  StaticHypergraph copy_hg = hypergraph.shallowCopy(parallel_tag_t());
+  copy_hg.removeLargeEdge(1);
+  copy_hg.removeDegreeZeroHypernode(1);
+  verifyIncidentNets(copy_hg, 0, { 0 });
+  verifyIncidentNets(copy_hg, 3, { 2 });
+  ASSERT_FALSE(copy_hg.nodeIsEnabled(1));
+
+  verifyIncidentNets(0, { 0, 1 });
+  verifyIncidentNets(1, { 1 });
+  verifyIncidentNets(3, { 1, 2 });
+  verifyIncidentNets(4, { 1, 2 });
+  ASSERT_TRUE(hypergraph.edgeIsEnabled(1));
+  ASSERT_TRUE(hypergraph.nodeIsEnabled(1));
+}
+
 TEST_F(AStaticHypergraph, ContractsCommunities1) {
   parallel::scalable_vector<HypernodeID> c_mapping = {1, 4, 1, 5, 5, 4, 5};
   StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping);
@@ -521,5 +548,27 @@ TEST_F(AStaticHypergraph, ContractCommunitiesIfCommunityInformationAreAvailable)
 }
 
 
+TEST_F(AStaticHypergraph, RemovesDuplicatedPinsAndMergesIdenticalHyperedgesDuringConstruction) {
+  InputSanitization sanitization;
+  const HyperedgeWeight hyperedge_weights[] = { 1, 2, 3, 4, 5, 6 };
+  StaticHypergraph sanitized_hg = StaticHypergraphFactory::construct_sanitized(5, 6,
+    { { 0, 1, 1 }, { 2 }, { 1, 0 }, { 2, 3, 4 }, { 3, 3 }, { 4, 2, 3 } },
+    hyperedge_weights, nullptr, false, sanitization);
+
+  ASSERT_EQ(2, sanitized_hg.initialNumEdges());
+  ASSERT_EQ(5, sanitized_hg.initialNumPins());
+  ASSERT_EQ(2, sanitized_hg.numRemovedHyperedges());
+  ASSERT_EQ(2, sanitization.num_removed_duplicated_pins);
+  ASSERT_EQ(2, sanitization.num_removed_single_pin_hyperedges);
+  ASSERT_EQ(2, sanitization.num_removed_identical_hyperedges);
+  ASSERT_EQ(vec<HyperedgeID>({ 0, kInvalidHyperedge, 0, 1, kInvalidHyperedge, 1 }),
+            sanitization.hyperedge_mapping);
+  verifyPins(sanitized_hg, { 0, 1 }, { {0, 1}, {2, 3, 4} });
+  ASSERT_EQ(4, sanitized_hg.edgeWeight(0));
+  ASSERT_EQ(10, sanitized_hg.edgeWeight(1));
+  ASSERT_EQ(1, sanitized_hg.nodeDegree(0));
+  ASSERT_EQ(1, sanitized_hg.nodeDegree(3));
+}
+
 }
 } // namespace mt_kahypar
\ No newline at end of file
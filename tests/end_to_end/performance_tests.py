@@ -0,0 +1,165 @@
+#!/usr/bin/python3
+# Performance regression tests: Runs each configuration of performance_tests.json several
+# times, records the running time of the multilevel phases (from the JSON timing export)
+# and the peak resident set size, and compares the medians against stored baselines.
+#
+# Usage: performance_tests.py [--executable <MtKaHyPar>] [--baselines <file>] [--record]
+#   --record  stores the measured values as new baselines instead of comparing them
+import argparse
+import json
+import os
+import os.path
+import statistics
+import subprocess
+import sys
+import tempfile
+
+mt_kahypar_dir = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", "..")) + "/"
+config_dir = mt_kahypar_dir + "config/"
+performance_test_json_file = mt_kahypar_dir + "tests/end_to_end/performance_tests.json"
+default_baseline_file = mt_kahypar_dir + "tests/end_to_end/performance_baselines.json"
+default_executable = mt_kahypar_dir + "build/mt-kahypar/application/MtKaHyPar"
+
+
+partitioners = { "Mt-KaHyPar-D":       { "config":  config_dir + "default_preset.ini",
+                                         "mode": "direct" },
+                 "Mt-KaHyPar-Q":       { "config":  config_dir + "quality_preset.ini",
+                                         "mode": "direct" },
+                 "Mt-KaHyPar-Q-F":     { "config":  config_dir + "highest_quality_preset.ini",
+                                         "mode": "direct" },
+                 "Mt-KaHyPar-D-Graph": { "config":  config_dir + "default_preset.ini",
+                                         "mode": "direct" },
+                 "Mt-KaHyPar-D-Deep":  { "config":  config_dir + "default_preset.ini",
+                                         "mode": "deep" } }
+
+def bold(msg):
+  return "\033[1m" + msg + "\033[0m"
+
+def print_error(msg):
+  print("\033[1;91m[ERROR]\033[0m " + bold(msg))
+
+def print_success(msg):
+  print("\033[1;92m[SUCCESS]\033[0m " + bold(msg))
+
+def configuration_key(test, instance, k):
+  return test["partitioner"] + " " + instance + " k=" + str(k) + \
+    ("" if "parameters" not in test else " " + " ".join(test["parameters"]))
+
+def command(executable, test, instance, k, epsilon, threads, json_file):
+  partitioner = partitioners[test["partitioner"]]
+  parameters = test["parameters"] if "parameters" in test else []
+  return [ executable,
+           "-h" + instance,
+           "-p" + partitioner["config"],
+           "-k" + str(k),
+           "-e" + str(epsilon),
+           "-t" + str(threads),
+           "-m" + partitioner["mode"],
+           "-okm1",
+           "--seed=1",
+           "--verbose=false",
+           "--json-output-file=" + json_file ] + parameters
+
+# Sums up the timings of all timer scopes with the given key
+def phase_time(timings, key):
+  time = 0.0
+  for timing in timings:
+    if timing["key"] == key:
+      time += timing["time"]
+    else:
+      time += phase_time(timing["children"], key)
+  return time
+
+# Runs the partitioner once and returns the phase timings and the peak RSS in KB
+def run_once(cmd, json_file, phases):
+  proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+  _, status, rusage = os.wait4(proc.pid, 0)
+  if not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0:
+    print_error("Partitioner terminates with non-zero exit code (Command = " + " ".join(cmd) + ")")
+    sys.exit(-1)
+  with open(json_file) as f:
+    result = json.load(f)
+  measurement = { "total_time": result["total_time"], "peak_rss": rusage.ru_maxrss }
+  for phase in phases:
+    measurement[phase] = phase_time(result["timings"], phase)
+  return measurement
+
+def measure(cmd, json_file, phases, runs):
+  measurements = [ run_once(cmd, json_file, phases) for _ in range(runs) ]
+  return { key: statistics.median([ m[key] for m in measurements ]) for key in measurements[0] }
+
+# Returns the list of metrics that are slower (or use more memory) than the baseline
+def compare(measurement, baseline, tolerance):
+  regressions = []
+  for key, value in measurement.items():
+    if key not in baseline:
+      continue
+    reference = baseline[key]
+    if key == "peak_rss":
+      limit = reference * (1.0 + tolerance["peak_rss"])
+    else:
+      # Short phases are dominated by noise, thus we allow an additional absolute slack
+      limit = max(reference * (1.0 + tolerance["time"]),
+                  reference + tolerance["min_absolute_time"])
+    if value > limit:
+      regressions.append(key + " = " + str(round(value, 3)) + " (baseline = " + str(round(reference, 3)) + ")")
+  return regressions
+
+def main():
+  parser = argparse.ArgumentParser(description="Mt-KaHyPar performance regression tests")
+  parser.add_argument("--executable", default=default_executable)
+  parser.add_argument("--baselines", default=default_baseline_file)
+  parser.add_argument("--record", action="store_true",
+                      help="store the measurements as new baselines")
+  args = parser.parse_args()
+
+  with open(performance_test_json_file) as performance_test_file:
+    performance_tests = json.load(performance_test_file)
+
+  baselines = { }
+  if os.path.exists(args.baselines):
+    with open(args.baselines) as baseline_file:
+      baselines = json.load(baseline_file)
+  elif not args.record:
+    print_error("No baselines found at " + args.baselines + " (record them with --record)")
+    sys.exit(-1)
+
+  phases = performance_tests["phases"]
+  tolerance = performance_tests["tolerance"]
+  num_regressions = 0
+  with tempfile.TemporaryDirectory() as tmp_dir:
+    json_file = os.path.join(tmp_dir, "result.json")
+    for experiment in performance_tests["performance_tests"]:
+      print(bold(experiment["name"]))
+      print("".rjust(len(experiment["name"]), "-"))
+      for instance in experiment["instances"]:
+        for k in performance_tests["k"]:
+          for test in experiment["tests"]:
+            key = configuration_key(test, instance, k)
+            cmd = command(args.executable, test, mt_kahypar_dir + instance, k,
+                          performance_tests["epsilon"], performance_tests["threads"], json_file)
+            measurement = measure(cmd, json_file, phases, performance_tests["runs"])
+            if args.record:
+              baselines[key] = measurement
+              print_success(key + " recorded (Total Time = " + str(round(measurement["total_time"], 3)) + ")")
+            elif key not in baselines:
+              print_error(key + ": no baseline found")
+              num_regressions += 1
+            else:
+              regressions = compare(measurement, baselines[key], tolerance)
+              if regressions:
+                print_error(key + ": " + ", ".join(regressions))
+                num_regressions += 1
+              else:
+                print_success(key + " (Total Time = " + str(round(measurement["total_time"], 3)) + ")")
+      print()
+
+  if args.record:
+    with open(args.baselines, "w") as baseline_file:
+      json.dump(baselines, baseline_file, indent=2, sort_keys=True)
+  elif num_regressions > 0:
+    print_error(str(num_regressions) + " configuration(s) exceed the tolerance of their baseline")
+    sys.exit(-1)
+
+if __name__ == "__main__":
+  main()
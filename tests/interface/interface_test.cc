@@ -27,9 +27,13 @@
 
 #include "gmock/gmock.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <thread>
 
 #include <tbb/parallel_invoke.h>
+#include <tbb/task_arena.h>
 
 #include "mtkahypar.h"
 #include "mt-kahypar/macros.h"
@@ -78,7 +82,11 @@ namespace mt_kahypar {
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, OBJECTIVE, "km1", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "0", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "3", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, VCYCLE_MIN_RELATIVE_IMPROVEMENT, "0.0001", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, VCYCLE_TRUNCATED_CONTRACTION_LIMIT_FACTOR, "4", &error));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, VERBOSE, "1", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, WRITE_STEINER_TREE_TABLES, "1", &error));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, PARTITION_TWO_PIN_HYPERGRAPHS_AS_GRAPHS, "0", &error));
 
     ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_set_context_parameter(context, NUM_BLOCKS, "x", &error));
     check_error_status();
@@ -96,7 +104,11 @@ namespace mt_kahypar {
     ASSERT_EQ(0.03, c.partition.epsilon);
     ASSERT_EQ(Objective::km1, c.partition.objective);
     ASSERT_EQ(3, c.partition.num_vcycles);
+    ASSERT_EQ(0.0001, c.partition.vcycle_min_relative_improvement);
+    ASSERT_EQ(4.0, c.partition.vcycle_truncated_contraction_limit_factor);
     ASSERT_TRUE(c.partition.verbose_output);
+    ASSERT_TRUE(c.mapping.write_steiner_tree_tables);
+    ASSERT_FALSE(c.partition.partition_two_pin_hypergraphs_as_graphs);
 
     mt_kahypar_free_context(context);
   }
@@ -239,6 +251,100 @@ namespace mt_kahypar {
     mt_kahypar_free_hypergraph(graph);
   }
 
+  TEST(MtKaHyPar, ConstructGraphFromCSR) {
+    mt_kahypar_error_t error{};
+    mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+    const mt_kahypar_hypernode_id_t num_vertices = 5;
+
+    std::unique_ptr<size_t[]> xadj = std::make_unique<size_t[]>(6);
+    xadj[0] = 0; xadj[1] = 2; xadj[2] = 5; xadj[3] = 8; xadj[4] = 11; xadj[5] = 12;
+    std::unique_ptr<mt_kahypar_hypernode_id_t[]> adjncy =
+      std::make_unique<mt_kahypar_hypernode_id_t[]>(12);
+    adjncy[0] = 1;  adjncy[1] = 2;
+    adjncy[2] = 0;  adjncy[3] = 2;  adjncy[4] = 3;
+    adjncy[5] = 0;  adjncy[6] = 1;  adjncy[7] = 3;
+    adjncy[8] = 1;  adjncy[9] = 2;  adjncy[10] = 4;
+    adjncy[11] = 3;
+
+    mt_kahypar_hypergraph_t graph = mt_kahypar_create_graph_from_csr(
+      context, num_vertices, xadj.get(), adjncy.get(), nullptr, nullptr, &error);
+    ASSERT_EQ(graph.type, STATIC_GRAPH);
+
+    ASSERT_EQ(5, mt_kahypar_num_hypernodes(graph));
+    ASSERT_EQ(12, mt_kahypar_num_hyperedges(graph));
+    ASSERT_EQ(5, mt_kahypar_hypergraph_weight(graph));
+
+    mt_kahypar_free_hypergraph(graph);
+    mt_kahypar_free_context(context);
+  }
+
+  TEST(MtKaHyPar, RejectsAsymmetricCSRGraph) {
+    mt_kahypar_error_t error{};
+    mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+
+    std::unique_ptr<size_t[]> xadj = std::make_unique<size_t[]>(4);
+    xadj[0] = 0; xadj[1] = 2; xadj[2] = 3; xadj[3] = 4;
+    std::unique_ptr<mt_kahypar_hypernode_id_t[]> adjncy =
+      std::make_unique<mt_kahypar_hypernode_id_t[]>(4);
+    adjncy[0] = 1; adjncy[1] = 2;
+    adjncy[2] = 0;
+    adjncy[3] = 1;
+
+    mt_kahypar_hypergraph_t graph = mt_kahypar_create_graph_from_csr(
+      context, 3, xadj.get(), adjncy.get(), nullptr, nullptr, &error);
+    ASSERT_EQ(nullptr, graph.hypergraph);
+    ASSERT_EQ(INVALID_INPUT, error.status);
+    mt_kahypar_free_error_content(&error);
+    mt_kahypar_free_context(context);
+  }
+
+  TEST(MtKaHyPar, RejectsGraphsThatExceedTheIDRange) {
+    mt_kahypar_error_t error{};
+    mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+    ASSERT_EQ(sizeof(HypernodeID) == 8, mt_kahypar_uses_64_bit_ids());
+    if ( !mt_kahypar_uses_64_bit_ids() ) {
+      const mt_kahypar_hypernode_id_t num_vertices =
+        static_cast<mt_kahypar_hypernode_id_t>(std::numeric_limits<HypernodeID>::max()) + 1;
+      mt_kahypar_hypergraph_t graph = mt_kahypar_create_graph(
+        context, num_vertices, 0, nullptr, nullptr, nullptr, &error);
+      ASSERT_EQ(nullptr, graph.hypergraph);
+      ASSERT_EQ(INVALID_INPUT, error.status);
+      mt_kahypar_free_error_content(&error);
+    }
+    mt_kahypar_free_context(context);
+  }
+
+  TEST(MtKaHyPar, ConstructHypergraphFromOwnedBuffers) {
+    mt_kahypar_error_t error{};
+    mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+
+    size_t* hyperedge_indices = new size_t[5] { 0, 2, 6, 9, 12 };
+    mt_kahypar_hyperedge_id_t* hyperedges = new mt_kahypar_hyperedge_id_t[12] {
+      0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 };
+    std::vector<void*> freed_buffers;
+    auto free_buffer = [](void* buffer, void* user_data) {
+      static_cast<std::vector<void*>*>(user_data)->push_back(buffer);
+    };
+
+    mt_kahypar_hypergraph_t hypergraph = mt_kahypar_create_hypergraph_from_owned_buffers(
+      context, 7, 4, hyperedge_indices, hyperedges, nullptr, nullptr, free_buffer, &freed_buffers, &error);
+    ASSERT_EQ(hypergraph.type, STATIC_HYPERGRAPH);
+    // Hyperedge indices are released after construction, the pins are owned by the hypergraph
+    ASSERT_EQ(1, freed_buffers.size());
+    ASSERT_EQ(hyperedge_indices, freed_buffers[0]);
+
+    ASSERT_EQ(7, mt_kahypar_num_hypernodes(hypergraph));
+    ASSERT_EQ(4, mt_kahypar_num_hyperedges(hypergraph));
+    ASSERT_EQ(12, mt_kahypar_num_pins(hypergraph));
+
+    mt_kahypar_free_hypergraph(hypergraph);
+    ASSERT_EQ(2, freed_buffers.size());
+    ASSERT_EQ(static_cast<void*>(hyperedges), freed_buffers[1]);
+    delete[] hyperedge_indices;
+    delete[] hyperedges;
+    mt_kahypar_free_context(context);
+  }
+
   TEST(MtKaHyPar, ConstructHypergraphWithNodeWeights) {
     mt_kahypar_error_t error;
     mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
@@ -653,6 +759,67 @@ namespace mt_kahypar {
     mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
   }
 
+  TEST(MtKaHyPar, ComputesAndIncrementallyUpdatesMetrics) {
+    mt_kahypar_error_t error{};
+    mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(context, 2, 0.03, KM1);
+    const mt_kahypar_hypernode_id_t num_vertices = 7;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = 4;
+
+    std::unique_ptr<size_t[]> hyperedge_indices = std::make_unique<size_t[]>(5);
+    hyperedge_indices[0] = 0; hyperedge_indices[1] = 2; hyperedge_indices[2] = 6;
+    hyperedge_indices[3] = 9; hyperedge_indices[4] = 12;
+
+    std::unique_ptr<mt_kahypar_hyperedge_id_t[]> hyperedges = std::make_unique<mt_kahypar_hyperedge_id_t[]>(12);
+    hyperedges[0] = 0;  hyperedges[1] = 2;                                        // Hyperedge 0
+    hyperedges[2] = 0;  hyperedges[3] = 1; hyperedges[4] = 3;  hyperedges[5] = 4; // Hyperedge 1
+    hyperedges[6] = 3;  hyperedges[7] = 4; hyperedges[8] = 6;                     // Hyperedge 2
+    hyperedges[9] = 2; hyperedges[10] = 5; hyperedges[11] = 6;                    // Hyperedge 3
+
+    mt_kahypar_hypergraph_t hypergraph = mt_kahypar_create_hypergraph(
+      context, num_vertices, num_hyperedges, hyperedge_indices.get(), hyperedges.get(), nullptr, nullptr, &error);
+
+    std::unique_ptr<mt_kahypar_partition_id_t[]> partition = std::make_unique<mt_kahypar_partition_id_t[]>(7);
+    partition[0] = 0; partition[1] = 0; partition[2] = 0;
+    partition[3] = 1; partition[4] = 1; partition[5] = 1; partition[6] = 1;
+
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg =
+      mt_kahypar_create_partitioned_hypergraph(hypergraph, context, 2, partition.get(), &error);
+
+    mt_kahypar_metrics_t metrics;
+    ASSERT_EQ(SUCCESS, mt_kahypar_compute_metrics(partitioned_hg, context, &metrics, &error));
+    ASSERT_EQ(2, metrics.cut);
+    ASSERT_EQ(2, metrics.km1);
+    ASSERT_EQ(4, metrics.soed);
+    ASSERT_DOUBLE_EQ(mt_kahypar_imbalance(partitioned_hg, context), metrics.imbalance);
+
+    std::vector<mt_kahypar_hypernode_id_t> nodes = { 2, 5 };
+    std::vector<mt_kahypar_partition_id_t> blocks = { 1, 0 };
+    ASSERT_EQ(SUCCESS, mt_kahypar_apply_moves(partitioned_hg, context,
+      nodes.size(), nodes.data(), blocks.data(), &metrics, &error));
+    ASSERT_EQ(mt_kahypar_cut(partitioned_hg), metrics.cut);
+    ASSERT_EQ(mt_kahypar_km1(partitioned_hg), metrics.km1);
+    ASSERT_EQ(mt_kahypar_soed(partitioned_hg), metrics.soed);
+    ASSERT_DOUBLE_EQ(mt_kahypar_imbalance(partitioned_hg, context), metrics.imbalance);
+
+    nodes = { 0, 1, 5 };
+    blocks = { 1, 1, 1 };
+    ASSERT_EQ(SUCCESS, mt_kahypar_apply_moves(partitioned_hg, context,
+      nodes.size(), nodes.data(), blocks.data(), &metrics, &error));
+    ASSERT_EQ(0, metrics.cut);
+    ASSERT_EQ(0, metrics.km1);
+    ASSERT_EQ(0, metrics.soed);
+
+    blocks = { 1, 1, 2 };
+    ASSERT_EQ(INVALID_INPUT, mt_kahypar_apply_moves(partitioned_hg, context,
+      nodes.size(), nodes.data(), blocks.data(), &metrics, &error));
+    mt_kahypar_free_error_content(&error);
+
+    mt_kahypar_free_context(context);
+    mt_kahypar_free_hypergraph(hypergraph);
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+  }
+
   TEST(MtKaHyPar, WritesAndLoadsGraphPartitionFile) {
     mt_kahypar_error_t error;
     mt_kahypar_context_t* context = mt_kahypar_context_from_preset(DEFAULT);
@@ -748,6 +915,35 @@ namespace mt_kahypar {
     mt_kahypar_free_partitioned_hypergraph(partitioned_graph);
   }
 
+  TEST(MtKaHyPar, ExportsAndRejectsHardwareTopology) {
+    mt_kahypar_error_t error{};
+    const size_t size = mt_kahypar_export_hardware_topology(nullptr, 0);
+    #ifndef KAHYPAR_DISABLE_HWLOC
+    ASSERT_GT(size, 1);
+    std::vector<char> xml(size);
+    ASSERT_EQ(size, mt_kahypar_export_hardware_topology(xml.data(), xml.size()));
+    ASSERT_EQ(size - 1, std::strlen(xml.data()));
+    ASSERT_NE(nullptr, std::strstr(xml.data(), "<topology"));
+
+    // A too small buffer receives a truncated, null-terminated prefix
+    char prefix[6];
+    ASSERT_EQ(size, mt_kahypar_export_hardware_topology(prefix, sizeof(prefix)));
+    ASSERT_EQ(std::string(xml.data(), sizeof(prefix) - 1), std::string(prefix));
+
+    ASSERT_EQ(INVALID_INPUT, mt_kahypar_set_hardware_topology("invalid", &error));
+    ASSERT_EQ(error.status, INVALID_INPUT);
+    mt_kahypar_free_error_content(&error);
+
+    // The topology was already loaded by the export above
+    ASSERT_EQ(INVALID_INPUT, mt_kahypar_set_hardware_topology(xml.data(), &error));
+    mt_kahypar_free_error_content(&error);
+    #else
+    ASSERT_EQ(0, size);
+    ASSERT_EQ(UNSUPPORTED_OPERATION, mt_kahypar_set_hardware_topology("", &error));
+    mt_kahypar_free_error_content(&error);
+    #endif
+  }
+
   class APartitioner : public Test {
     private:
       static constexpr bool debug = false;
@@ -817,6 +1013,21 @@ namespace mt_kahypar {
       mt_kahypar_free_hypergraph(hg);
     }
 
+    void MapAnotherHypergraph(const char* filename,
+                              const mt_kahypar_file_format_type_t format,
+                              const mt_kahypar_preset_type_t preset,
+                              const double epsilon) {
+      mt_kahypar_context_t* c = mt_kahypar_context_from_preset(preset);
+      mt_kahypar_set_partitioning_parameters(c, 8, epsilon, KM1);
+      mt_kahypar_set_context_parameter(c, VERBOSE, debug ? "1" : "0", &error);
+
+      mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(filename, c, format, &error);
+      partition(hg, nullptr, c, 8, epsilon, target_graph);
+
+      mt_kahypar_free_context(c);
+      mt_kahypar_free_hypergraph(hg);
+    }
+
     void ImprovePartition(const mt_kahypar_preset_type_t preset,
                           const mt_kahypar_partition_id_t num_blocks,
                           const double epsilon,
@@ -1001,6 +1212,91 @@ namespace mt_kahypar {
     Partition(GRAPH_FILE, METIS, DEFAULT, 4, 0.03, CUT, false);
   }
 
+  void createTwoPinGrid(std::vector<size_t>& hyperedge_indices,
+                        std::vector<mt_kahypar_hyperedge_id_t>& hyperedges) {
+    // 32 x 32 grid, each edge is a net with two pins
+    const mt_kahypar_hypernode_id_t width = 32;
+    const mt_kahypar_hypernode_id_t num_vertices = width * width;
+    hyperedge_indices.assign(1, 0);
+    hyperedges.clear();
+    for ( mt_kahypar_hypernode_id_t u = 0; u < num_vertices; ++u ) {
+      if ( u % width + 1 < width ) {
+        hyperedges.push_back(u);
+        hyperedges.push_back(u + 1);
+        hyperedge_indices.push_back(hyperedges.size());
+      }
+      if ( u + width < num_vertices ) {
+        hyperedges.push_back(u);
+        hyperedges.push_back(u + width);
+        hyperedge_indices.push_back(hyperedges.size());
+      }
+    }
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphWithOnlyTwoPinNetsAsGraph) {
+    std::vector<size_t> hyperedge_indices;
+    std::vector<mt_kahypar_hyperedge_id_t> hyperedges;
+    createTwoPinGrid(hyperedge_indices, hyperedges);
+    const mt_kahypar_hypernode_id_t num_vertices = 32 * 32;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = hyperedge_indices.size() - 1;
+
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    hypergraph = mt_kahypar_create_hypergraph(context, num_vertices, num_hyperedges,
+      hyperedge_indices.data(), hyperedges.data(), nullptr, nullptr, &error);
+    ASSERT_EQ(STATIC_HYPERGRAPH, hypergraph.type);
+
+    PartitionNoSetup(4, 0.03);
+    ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, partitioned_hg.type);
+    ASSERT_EQ(num_hyperedges, mt_kahypar_num_hyperedges(hypergraph));
+    ASSERT_EQ(mt_kahypar_cut(partitioned_hg), mt_kahypar_km1(partitioned_hg));
+    ASSERT_LT(mt_kahypar_cut(partitioned_hg), num_hyperedges / 4);
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphWithOnlyTwoPinNetsWithoutConversion) {
+    std::vector<size_t> hyperedge_indices;
+    std::vector<mt_kahypar_hyperedge_id_t> hyperedges;
+    createTwoPinGrid(hyperedge_indices, hyperedges);
+    const mt_kahypar_hypernode_id_t num_vertices = 32 * 32;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = hyperedge_indices.size() - 1;
+
+    SetUpContext(DEFAULT, 4, 0.03, SOED);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(
+      context, PARTITION_TWO_PIN_HYPERGRAPHS_AS_GRAPHS, "0", &error));
+    hypergraph = mt_kahypar_create_hypergraph(context, num_vertices, num_hyperedges,
+      hyperedge_indices.data(), hyperedges.data(), nullptr, nullptr, &error);
+    ASSERT_EQ(STATIC_HYPERGRAPH, hypergraph.type);
+
+    PartitionNoSetup(4, 0.03);
+    ASSERT_EQ(MULTILEVEL_HYPERGRAPH_PARTITIONING, partitioned_hg.type);
+    ASSERT_EQ(2 * mt_kahypar_cut(partitioned_hg), mt_kahypar_soed(partitioned_hg));
+    ASSERT_LT(mt_kahypar_cut(partitioned_hg), num_hyperedges / 4);
+  }
+
+  TEST_F(APartitioner, UsesSparseConnectivityInfoForMediumKAndSmallNets) {
+    // Nets with three pins and one large net, for which the dense pin counts need many bits
+    const mt_kahypar_hypernode_id_t num_vertices = 2048;
+    std::vector<size_t> hyperedge_indices(1, 0);
+    std::vector<mt_kahypar_hyperedge_id_t> hyperedges;
+    for ( mt_kahypar_hypernode_id_t u = 0; u + 2 < num_vertices; ++u ) {
+      hyperedges.insert(hyperedges.end(), { u, u + 1, u + 2 });
+      hyperedge_indices.push_back(hyperedges.size());
+    }
+    for ( mt_kahypar_hypernode_id_t u = 0; u < 300; ++u ) {
+      hyperedges.push_back(u);
+    }
+    hyperedge_indices.push_back(hyperedges.size());
+    const mt_kahypar_hyperedge_id_t num_hyperedges = hyperedge_indices.size() - 1;
+
+    SetUpContext(DEFAULT, 128, 0.03, KM1);
+    hypergraph = mt_kahypar_create_hypergraph(context, num_vertices, num_hyperedges,
+      hyperedge_indices.data(), hyperedges.data(), nullptr, nullptr, &error);
+    PartitionNoSetup(128, 0.03);
+    ASSERT_EQ(LARGE_K_PARTITIONING, partitioned_hg.type);
+
+    // Improving the partition with the default preset uses the same data structure
+    ASSERT_EQ(SUCCESS, mt_kahypar_improve_partition(partitioned_hg, context, 1, &error));
+  }
+
   TEST_F(APartitioner, PartitionsAHypergraphInTwoBlocksWithQualityPreset) {
     Partition(HYPERGRAPH_FILE, HMETIS, QUALITY, 2, 0.03, KM1, false);
   }
@@ -1085,6 +1381,424 @@ namespace mt_kahypar {
     });
   }
 
+  TEST_F(APartitioner, PartitionsSeveralHypergraphsWithTheSameSession) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    mt_kahypar_session_t* session = mt_kahypar_create_session(context);
+    ASSERT_NE(session, nullptr);
+
+    const auto partition_with_session = [&](const char* filename,
+                                            const mt_kahypar_file_format_type_t format) {
+      Load(filename, format);
+      const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+      std::vector<mt_kahypar_partition_id_t> partition(num_nodes, -1);
+      ASSERT_EQ(SUCCESS, mt_kahypar_session_partition(session, hypergraph, partition.data(), &error));
+      for ( mt_kahypar_hypernode_id_t hn = 0; hn < num_nodes; ++hn ) {
+        ASSERT_GE(partition[hn], 0);
+        ASSERT_LT(partition[hn], 4);
+      }
+
+      mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+      partitioned_hg = mt_kahypar_create_partitioned_hypergraph(
+        hypergraph, context, 4, partition.data(), &error);
+      ASSERT_LE(mt_kahypar_imbalance(partitioned_hg, context), 0.03);
+    };
+
+    partition_with_session(HYPERGRAPH_FILE, HMETIS);
+    partition_with_session(GRAPH_FILE, METIS);
+    partition_with_session(HYPERGRAPH_FILE, HMETIS);
+    mt_kahypar_free_session(session);
+  }
+
+  TEST_F(APartitioner, CanPartitionWithAndWithoutSessionSimultanously) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    mt_kahypar_session_t* session = mt_kahypar_create_session(context);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    tbb::parallel_invoke([&]() {
+      std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hypergraph), -1);
+      for ( size_t i = 0; i < 2; ++i ) {
+        ASSERT_EQ(SUCCESS, mt_kahypar_session_partition(session, hypergraph, partition.data(), &error));
+      }
+    }, [&] {
+      PartitionAnotherHypergraph(GRAPH_FILE, METIS, DEFAULT, 8, 0.03, CUT, false);
+    });
+    mt_kahypar_free_session(session);
+  }
+
+  TEST_F(APartitioner, PartitionsAGraphStreamWithBuffers) {
+    SetUpContext(DEFAULT, 4, 0.03, CUT);
+    // Grid graph whose nodes arrive in row-major order
+    const mt_kahypar_hypernode_id_t width = 40;
+    const mt_kahypar_hypernode_id_t num_nodes = width * width;
+    mt_kahypar_streaming_partitioner_t* streaming_partitioner =
+      mt_kahypar_create_streaming_partitioner(context, num_nodes, num_nodes, 400, &error);
+    ASSERT_NE(nullptr, streaming_partitioner);
+
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes, -1);
+    for ( mt_kahypar_hypernode_id_t u = 0; u < num_nodes; ++u ) {
+      std::vector<mt_kahypar_hypernode_id_t> neighbors;
+      if ( u % width > 0 ) neighbors.push_back(u - 1);
+      if ( u % width + 1 < width ) neighbors.push_back(u + 1);
+      if ( u >= width ) neighbors.push_back(u - width);
+      if ( u + width < num_nodes ) neighbors.push_back(u + width);
+      ASSERT_EQ(SUCCESS, mt_kahypar_stream_node(streaming_partitioner, 1,
+        neighbors.data(), nullptr, neighbors.size(), &error));
+      if ( u == 399 ) {
+        // The first buffer is partitioned as soon as it is full
+        mt_kahypar_get_stream_partition(streaming_partitioner, partition.data());
+        ASSERT_GE(partition[0], 0);
+        ASSERT_EQ(-1, partition[400]);
+      }
+    }
+    // Only full buffers are partitioned before the stream is flushed
+    ASSERT_EQ(SUCCESS, mt_kahypar_flush_stream(streaming_partitioner, &error));
+    mt_kahypar_get_stream_partition(streaming_partitioner, partition.data());
+
+    std::vector<mt_kahypar_hypernode_weight_t> block_weights(4, 0);
+    for ( mt_kahypar_hypernode_id_t u = 0; u < num_nodes; ++u ) {
+      ASSERT_GE(partition[u], 0);
+      ASSERT_LT(partition[u], 4);
+      ++block_weights[partition[u]];
+    }
+    for ( const mt_kahypar_hypernode_weight_t weight : block_weights ) {
+      ASSERT_LE(weight, std::ceil(1.03 * num_nodes / 4));
+    }
+    mt_kahypar_free_streaming_partitioner(streaming_partitioner);
+  }
+
+  TEST_F(APartitioner, RejectsStreamsWithMoreNodesThanAnnounced) {
+    SetUpContext(DEFAULT, 2, 0.03, CUT);
+    mt_kahypar_streaming_partitioner_t* streaming_partitioner =
+      mt_kahypar_create_streaming_partitioner(context, 1, 1, 10, &error);
+    ASSERT_EQ(SUCCESS, mt_kahypar_stream_node(streaming_partitioner, 1, nullptr, nullptr, 0, &error));
+    ASSERT_EQ(INVALID_INPUT, mt_kahypar_stream_node(streaming_partitioner, 1, nullptr, nullptr, 0, &error));
+    mt_kahypar_free_error_content(&error);
+    mt_kahypar_free_streaming_partitioner(streaming_partitioner);
+  }
+
+  TEST_F(APartitioner, PartitionsWithAPrecomputedHierarchyForSeveralK) {
+    SetUpContext(DEFAULT, 2, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    mt_kahypar_hierarchy_t hierarchy = mt_kahypar_create_hierarchy(hypergraph, context, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+    ASSERT_EQ(SUCCESS, mt_kahypar_write_hierarchy_to_file(hierarchy, "tmp.hierarchy", &error));
+    mt_kahypar_hierarchy_t hierarchy_from_file =
+      mt_kahypar_read_hierarchy_from_file(hypergraph, context, "tmp.hierarchy", &error);
+    ASSERT_EQ(SUCCESS, error.status);
+
+    const auto partition_with_hierarchy = [&](const mt_kahypar_hierarchy_t h,
+                                              const mt_kahypar_partition_id_t k,
+                                              const double epsilon) {
+      mt_kahypar_set_partitioning_parameters(context, k, epsilon, KM1);
+      mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+      partitioned_hg = mt_kahypar_partition_with_hierarchy(hypergraph, h, context, &error);
+      ASSERT_EQ(SUCCESS, error.status);
+      std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hypergraph), -1);
+      mt_kahypar_get_partition(partitioned_hg, partition.data());
+      for ( const mt_kahypar_partition_id_t block : partition ) {
+        ASSERT_GE(block, 0);
+        ASSERT_LT(block, k);
+      }
+      ASSERT_LE(mt_kahypar_imbalance(partitioned_hg, context), epsilon);
+    };
+
+    partition_with_hierarchy(hierarchy, 2, 0.03);
+    partition_with_hierarchy(hierarchy, 8, 0.05);
+    partition_with_hierarchy(hierarchy_from_file, 4, 0.03);
+    partition_with_hierarchy(hierarchy_from_file, 16, 0.1);
+    mt_kahypar_free_hierarchy(hierarchy);
+    mt_kahypar_free_hierarchy(hierarchy_from_file);
+  }
+
+  TEST_F(APartitioner, ExtractsNestedPartitionsFromOnePartitioningCall) {
+    SetUpContext(DEFAULT, 8, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, NESTED_PARTITIONS, "1", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(8, 0.03);
+
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes, -1);
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    std::vector<mt_kahypar_partition_id_t> nested_partition(num_nodes, -1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_get_nested_partition(partitioned_hg, 8, nested_partition.data(), &error));
+    ASSERT_EQ(partition, nested_partition);
+
+    std::vector<mt_kahypar_partition_id_t> finer_partition = partition;
+    for ( const mt_kahypar_partition_id_t nested_k : { 4, 2 } ) {
+      ASSERT_EQ(SUCCESS, mt_kahypar_get_nested_partition(
+        partitioned_hg, nested_k, nested_partition.data(), &error));
+      for ( mt_kahypar_hypernode_id_t hn = 0; hn < num_nodes; ++hn ) {
+        ASSERT_GE(nested_partition[hn], 0);
+        ASSERT_LT(nested_partition[hn], nested_k);
+        ASSERT_EQ(finer_partition[hn] / 2, nested_partition[hn]);
+      }
+      finer_partition = nested_partition;
+    }
+
+    ASSERT_EQ(INVALID_PARAMETER, mt_kahypar_get_nested_partition(
+      partitioned_hg, 3, nested_partition.data(), &error));
+    mt_kahypar_free_error_content(&error);
+  }
+
+  TEST_F(APartitioner, ExtractsBlockOrdering) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    const mt_kahypar_hyperedge_id_t num_edges = mt_kahypar_num_hyperedges(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes, -1);
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    std::vector<mt_kahypar_hypernode_id_t> permutation(num_nodes);
+    std::vector<mt_kahypar_hypernode_id_t> block_offsets(5);
+    std::vector<mt_kahypar_hypernode_id_t> halo_offsets(4);
+    std::vector<mt_kahypar_hyperedge_id_t> cut_nets(num_edges);
+    mt_kahypar_hyperedge_id_t num_cut_nets = 0;
+    mt_kahypar_get_block_ordering(partitioned_hg, permutation.data(), block_offsets.data(),
+      halo_offsets.data(), cut_nets.data(), &num_cut_nets);
+
+    ASSERT_EQ(0, block_offsets[0]);
+    ASSERT_EQ(num_nodes, block_offsets[4]);
+    std::vector<bool> visited(num_nodes, false);
+    for ( mt_kahypar_partition_id_t block = 0; block < 4; ++block ) {
+      ASSERT_LE(block_offsets[block], halo_offsets[block]);
+      ASSERT_LE(halo_offsets[block], block_offsets[block + 1]);
+      for ( mt_kahypar_hypernode_id_t i = block_offsets[block]; i < block_offsets[block + 1]; ++i ) {
+        ASSERT_FALSE(visited[permutation[i]]);
+        visited[permutation[i]] = true;
+        ASSERT_EQ(block, partition[permutation[i]]);
+        if ( i != block_offsets[block] && i != halo_offsets[block] ) {
+          ASSERT_LT(permutation[i - 1], permutation[i]);
+        }
+      }
+    }
+
+    ASSERT_GT(num_cut_nets, 0);
+    ASSERT_LE(num_cut_nets, num_edges);
+    ASSERT_TRUE(std::is_sorted(cut_nets.begin(), cut_nets.begin() + num_cut_nets));
+  }
+
+  TEST_F(APartitioner, FailsToPartitionWithAHierarchyOfAnotherHypergraph) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    mt_kahypar_hierarchy_t hierarchy = mt_kahypar_create_hierarchy(hypergraph, context, &error);
+    ASSERT_EQ(SUCCESS, error.status);
+    Load(GRAPH_FILE, METIS);
+    partitioned_hg = mt_kahypar_partition_with_hierarchy(hypergraph, hierarchy, context, &error);
+    ASSERT_EQ(INVALID_INPUT, error.status);
+    ASSERT_EQ(nullptr, partitioned_hg.partitioned_hg);
+    mt_kahypar_free_error_content(&error);
+    mt_kahypar_free_hierarchy(hierarchy);
+  }
+
+  TEST_F(APartitioner, ReturnsBalancedPartitionIfTimeLimitIsExceeded) {
+    SetUpContext(QUALITY, 8, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "0.001", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(8, 0.03);
+  }
+
+  TEST_F(APartitioner, PartitionsWithinATightMemoryBudget) {
+    SetUpContext(HIGHEST_QUALITY, 8, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, MEMORY_BUDGET, "1", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(8, 0.03);
+  }
+
+  TEST_F(APartitioner, PartitionsConcurrentlyWithAThreadLimitInsideAnExternalTaskArena) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, MAX_THREADS, "1", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    tbb::task_arena arena(2);
+    arena.execute([&] {
+      tbb::parallel_invoke([&] {
+        mt_kahypar_error_t local_error{};
+        mt_kahypar_partitioned_hypergraph_t phg = mt_kahypar_partition(hypergraph, context, &local_error);
+        ASSERT_EQ(SUCCESS, local_error.status);
+        ASSERT_LE(mt_kahypar_imbalance(phg, context), 0.03);
+        mt_kahypar_free_partitioned_hypergraph(phg);
+      }, [&] {
+        PartitionAnotherHypergraph(GRAPH_FILE, METIS, DEFAULT, 8, 0.03, CUT, false);
+      });
+    });
+  }
+
+  TEST_F(APartitioner, PartitionsTheSameHypergraphConcurrentlyWithASharedInput) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(context, SHARED_INPUT, "1", &error));
+    mt_kahypar_context_t* quality_context = mt_kahypar_context_from_preset(QUALITY);
+    mt_kahypar_set_partitioning_parameters(quality_context, 8, 0.03, CUT);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(quality_context, VERBOSE, "0", &error));
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(quality_context, SHARED_INPUT, "1", &error));
+    Load(HYPERGRAPH_FILE, HMETIS);
+    const mt_kahypar_hypernode_id_t num_pins = mt_kahypar_num_pins(hypergraph);
+    const mt_kahypar_hypernode_id_t total_weight = mt_kahypar_hypergraph_weight(hypergraph);
+
+    std::vector<mt_kahypar_partitioned_hypergraph_t> phgs(4);
+    tbb::parallel_for(UL(0), phgs.size(), [&](const size_t i) {
+      mt_kahypar_error_t local_error{};
+      phgs[i] = mt_kahypar_partition(hypergraph, i % 2 == 0 ? context : quality_context, &local_error);
+      ASSERT_EQ(SUCCESS, local_error.status);
+    });
+
+    for ( size_t i = 0; i < phgs.size(); ++i ) {
+      ASSERT_LE(mt_kahypar_imbalance(phgs[i], i % 2 == 0 ? context : quality_context), 0.03);
+      mt_kahypar_free_partitioned_hypergraph(phgs[i]);
+    }
+    ASSERT_EQ(num_pins, mt_kahypar_num_pins(hypergraph));
+    ASSERT_EQ(total_weight, mt_kahypar_hypergraph_weight(hypergraph));
+    mt_kahypar_free_context(quality_context);
+  }
+
+  TEST_F(APartitioner, ReportsProgressOfAPartitioningCall) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    std::vector<mt_kahypar_progress_t> progress;
+    mt_kahypar_set_progress_callback(context, [](const mt_kahypar_progress_t* p, void* data) {
+      static_cast<std::vector<mt_kahypar_progress_t>*>(data)->push_back(*p);
+    }, &progress);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    PartitionNoSetup(4, 0.03);
+
+    ASSERT_FALSE(progress.empty());
+    ASSERT_EQ(PROGRESS_COARSENING, progress.front().phase);
+    ASSERT_EQ(PROGRESS_REFINEMENT, progress.back().phase);
+    ASSERT_EQ(mt_kahypar_num_hypernodes(hypergraph), progress.back().num_nodes);
+    ASSERT_EQ(mt_kahypar_km1(partitioned_hg), progress.back().objective);
+    ASSERT_EQ(1, std::count_if(progress.begin(), progress.end(), [](const mt_kahypar_progress_t& p) {
+      return p.phase == PROGRESS_INITIAL_PARTITIONING;
+    }));
+  }
+
+  TEST_F(APartitioner, CancelsAPartitioningCall) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    mt_kahypar_set_cancel_callback(context, [](void*) { return true; }, nullptr);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    partitioned_hg = mt_kahypar_partition(hypergraph, context, &error);
+    ASSERT_EQ(nullptr, partitioned_hg.partitioned_hg);
+    ASSERT_EQ(CANCELLED, error.status);
+    mt_kahypar_free_error_content(&error);
+  }
+
+  TEST_F(APartitioner, RepartitionsAHypergraphWithUnassignedNodes) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, partition.data());
+    const mt_kahypar_hyperedge_weight_t km1_before = mt_kahypar_km1(partitioned_hg);
+
+    // Simulate that the first 1% of the nodes were inserted into the hypergraph
+    std::vector<mt_kahypar_hypernode_id_t> touched_nodes;
+    for ( mt_kahypar_hypernode_id_t hn = 0; hn < num_nodes / 100; ++hn ) {
+      partition[hn] = -1;
+      touched_nodes.push_back(hn);
+    }
+
+    mt_kahypar_partitioned_hypergraph_t repartitioned_hg = mt_kahypar_repartition(hypergraph, context,
+      partition.data(), touched_nodes.data(), touched_nodes.size(), &error);
+    ASSERT_NE(nullptr, repartitioned_hg.partitioned_hg);
+    ASSERT_LE(mt_kahypar_imbalance(repartitioned_hg, context), 0.03);
+    ASSERT_LE(mt_kahypar_km1(repartitioned_hg), 1.1 * km1_before);
+
+    std::vector<mt_kahypar_partition_id_t> new_partition(num_nodes);
+    mt_kahypar_get_partition(repartitioned_hg, new_partition.data());
+    for ( mt_kahypar_hypernode_id_t hn = 0; hn < num_nodes; ++hn ) {
+      ASSERT_GE(new_partition[hn], 0);
+      ASSERT_LT(new_partition[hn], 4);
+    }
+    mt_kahypar_free_partitioned_hypergraph(repartitioned_hg);
+  }
+
+  TEST_F(APartitioner, RejectsInvalidBlocksWhenRepartitioning) {
+    SetUpContext(DEFAULT, 4, 0.03, KM1);
+    Load(HYPERGRAPH_FILE, HMETIS);
+    std::vector<mt_kahypar_partition_id_t> partition(mt_kahypar_num_hypernodes(hypergraph), 0);
+    partition[0] = 4;
+
+    mt_kahypar_error_t repartition_error{};
+    mt_kahypar_partitioned_hypergraph_t repartitioned_hg = mt_kahypar_repartition(hypergraph, context,
+      partition.data(), nullptr, 0, &repartition_error);
+    ASSERT_EQ(nullptr, repartitioned_hg.partitioned_hg);
+    ASSERT_EQ(INVALID_INPUT, repartition_error.status);
+    mt_kahypar_free_error_content(&repartition_error);
+  }
+
+  TEST_F(APartitioner, ImprovesAPartitionOnlyWithinARegion) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+    std::vector<mt_kahypar_partition_id_t> partition_before(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, partition_before.data());
+    const mt_kahypar_hyperedge_weight_t km1_before = mt_kahypar_km1(partitioned_hg);
+
+    std::vector<mt_kahypar_hypernode_id_t> region_nodes;
+    for ( mt_kahypar_hypernode_id_t hn = 0; hn < num_nodes / 10; ++hn ) {
+      region_nodes.push_back(hn);
+    }
+    ASSERT_EQ(SUCCESS, mt_kahypar_improve_partition_in_region(partitioned_hg, context,
+      region_nodes.data(), region_nodes.size(), 0, &error));
+    ASSERT_LE(mt_kahypar_km1(partitioned_hg), km1_before);
+    ASSERT_LE(mt_kahypar_imbalance(partitioned_hg, context), 0.03);
+
+    std::vector<mt_kahypar_partition_id_t> partition_after(num_nodes);
+    mt_kahypar_get_partition(partitioned_hg, partition_after.data());
+    for ( mt_kahypar_hypernode_id_t hn = num_nodes / 10; hn < num_nodes; ++hn ) {
+      ASSERT_EQ(partition_before[hn], partition_after[hn]);
+    }
+  }
+
+  TEST_F(APartitioner, PartitionsABatchOfHypergraphsAndGraphs) {
+    mt_kahypar_context_t* hg_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(hg_context, 4, 0.03, KM1);
+    mt_kahypar_set_context_parameter(hg_context, VERBOSE, "0", &error);
+    mt_kahypar_context_t* graph_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(graph_context, 2, 0.03, CUT);
+    mt_kahypar_set_context_parameter(graph_context, VERBOSE, "0", &error);
+    mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, hg_context, HMETIS, &error);
+    mt_kahypar_hypergraph_t graph = mt_kahypar_read_hypergraph_from_file(GRAPH_FILE, graph_context, METIS, &error);
+
+    const size_t num_instances = 6;
+    std::vector<mt_kahypar_hypergraph_t> instances;
+    std::vector<const mt_kahypar_context_t*> contexts;
+    for ( size_t i = 0; i < num_instances; ++i ) {
+      instances.push_back(i % 2 == 0 ? hg : graph);
+      contexts.push_back(i % 2 == 0 ? hg_context : graph_context);
+    }
+    std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(num_instances);
+    ASSERT_EQ(SUCCESS, mt_kahypar_partition_batch(instances.data(), contexts.data(),
+      num_instances, partitioned_hgs.data(), &error));
+
+    for ( size_t i = 0; i < num_instances; ++i ) {
+      ASSERT_NE(nullptr, partitioned_hgs[i].partitioned_hg);
+      ASSERT_EQ(i % 2 == 0 ? 4 : 2, mt_kahypar_num_blocks(partitioned_hgs[i]));
+      ASSERT_LE(mt_kahypar_imbalance(partitioned_hgs[i], contexts[i]), 0.03);
+      mt_kahypar_free_partitioned_hypergraph(partitioned_hgs[i]);
+    }
+    mt_kahypar_free_hypergraph(hg);
+    mt_kahypar_free_hypergraph(graph);
+    mt_kahypar_free_context(hg_context);
+    mt_kahypar_free_context(graph_context);
+  }
+
+  TEST_F(APartitioner, ReportsFailedInstancesOfABatch) {
+    mt_kahypar_context_t* hg_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(hg_context, 4, 0.03, KM1);
+    mt_kahypar_set_context_parameter(hg_context, VERBOSE, "0", &error);
+    mt_kahypar_context_t* invalid_context = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_context_parameter(invalid_context, VERBOSE, "0", &error);
+    mt_kahypar_hypergraph_t hg = mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, hg_context, HMETIS, &error);
+
+    std::vector<mt_kahypar_hypergraph_t> instances = { hg, hg };
+    std::vector<const mt_kahypar_context_t*> contexts = { invalid_context, hg_context };
+    std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(2);
+    mt_kahypar_error_t batch_error{};
+    ASSERT_NE(SUCCESS, mt_kahypar_partition_batch(instances.data(), contexts.data(),
+      2, partitioned_hgs.data(), &batch_error));
+    ASSERT_EQ(nullptr, partitioned_hgs[0].partitioned_hg);
+    ASSERT_NE(nullptr, partitioned_hgs[1].partitioned_hg);
+
+    mt_kahypar_free_error_content(&batch_error);
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hgs[1]);
+    mt_kahypar_free_hypergraph(hg);
+    mt_kahypar_free_context(hg_context);
+    mt_kahypar_free_context(invalid_context);
+  }
+
   TEST_F(APartitioner, ChecksIfDeterministicPresetProducesSameResultsForHypergraphs) {
     Partition(HYPERGRAPH_FILE, HMETIS, DETERMINISTIC, 8, 0.03, KM1, false);
     const double objective_1 = mt_kahypar_km1(partitioned_hg);
@@ -1137,6 +1851,15 @@ namespace mt_kahypar {
     ImprovePartition(DEFAULT, 4, 0.03, CUT, 3, false);
   }
 
+  TEST_F(APartitioner, ImprovesHypergraphPartitionWithTruncatedVCyclesAndEarlyTermination) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(
+      context, VCYCLE_MIN_RELATIVE_IMPROVEMENT, "0.001", &error));
+    ASSERT_EQ(SUCCESS, mt_kahypar_set_context_parameter(
+      context, VCYCLE_TRUNCATED_CONTRACTION_LIMIT_FACTOR, "8", &error));
+    ImprovePartition(DEFAULT, 4, 0.03, KM1, 5, false);
+  }
+
   TEST_F(APartitioner, PartitionsHypergraphWithIndividualBlockWeightsAndVCycle) {
     // Setup Individual Block Weights
     SetUpContext(DEFAULT, 4, 0.03, KM1, false);
@@ -1225,6 +1948,21 @@ namespace mt_kahypar {
     ASSERT_EQ(objective_1, objective_3);
   }
 
+  TEST_F(APartitioner, MapsSeveralHypergraphsOntoAPrecomputedTargetGraphSimultanously) {
+    mt_kahypar_context_t* c = mt_kahypar_context_from_preset(DEFAULT);
+    mt_kahypar_set_partitioning_parameters(c, 8, 0.03, KM1);
+    ASSERT_EQ(SUCCESS, mt_kahypar_precompute_target_graph(target_graph, c, &error));
+    mt_kahypar_free_context(c);
+
+    tbb::parallel_invoke([&]() {
+      MapAnotherHypergraph(HYPERGRAPH_FILE, HMETIS, DEFAULT, 0.03);
+    }, [&] {
+      MapAnotherHypergraph(GRAPH_FILE, METIS, DEFAULT, 0.03);
+    }, [&]() {
+      MapAnotherHypergraph(HYPERGRAPH_FILE, HMETIS, QUALITY, 0.03);
+    });
+  }
+
   TEST_F(APartitioner, MapsAGraphOntoATargetGraphWithDefaultPreset) {
     Map(GRAPH_FILE, METIS, DEFAULT, 0.03, false);
   }
@@ -24,11 +24,29 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifdef KAHYPAR_USE_ZLIB
+#include <zlib.h>
+#endif
+
 #include "gmock/gmock.h"
 
 #include "tests/definitions.h"
+#include "mt-kahypar/io/compressed_input.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/io/shared_memory.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/exception.h"
 
 using ::testing::Test;
 
@@ -233,6 +251,18 @@ TYPED_TEST(AHypergraphReader, ReadsAnHypergraphWithNodeAndEdgeWeights) {
   ASSERT_EQ(8, this->hypergraph.edgeWeight(3));
 }
 
+TYPED_TEST(AHypergraphReader, ReadsAnHypergraphWithIrregularLines) {
+  this->readHypergraph("../tests/instances/hypergraph_with_irregular_lines.hgr", FileFormat::hMetis);
+
+  // Single-pin hyperedge { 3 } is removed and duplicated pins are removed
+  ASSERT_EQ(4, this->hypergraph.initialNumEdges());
+  ASSERT_EQ(1, this->hypergraph.numRemovedHyperedges());
+
+  // Verify Pins
+  this->verifyPins({ { 0, 2 }, { 0, 1, 3, 4 },
+    { 3, 4, 6 }, { 2, 5, 6 } });
+}
+
 TYPED_TEST(AGraphReader, ReadsAMetisGraph) {
   this->readHypergraph("../tests/instances/unweighted_graph.graph", FileFormat::Metis);
 
@@ -343,5 +373,375 @@ TYPED_TEST(AGraphReader, ReadsAMetisGraphWithNodeAndEdgeWeights) {
   ASSERT_EQ(1, this->hypergraph.nodeWeight(7));
 }
 
+TYPED_TEST(AHypergraphReader, ReadsABinarySnapshotOfAHypergraph) {
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_removed_hyperedges = 0;
+  HyperedgeVector hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  readHypergraphFile("../tests/instances/hypergraph_with_node_and_edge_weights.hgr",
+    num_hyperedges, num_hypernodes, num_removed_hyperedges,
+    hyperedges, hyperedges_weight, hypernodes_weight);
+  writeBinaryFile("hypergraph_snapshot.bin", num_hypernodes, hyperedges,
+    hyperedges_weight, hypernodes_weight, false);
+
+  ASSERT_FALSE(isBinaryGraphFile("hypergraph_snapshot.bin"));
+  this->readHypergraph("hypergraph_snapshot.bin", FileFormat::binary);
+  std::remove("hypergraph_snapshot.bin");
+
+  // Verify Incident Nets
+  this->verifyIncidentNets(
+    { { 0, 1 }, { 1 }, { 0, 3 }, { 1, 2 },
+      {1, 2}, { 3 }, { 2, 3 } });
+
+  // Verify Pins
+  this->verifyPins({ { 0, 2 }, { 0, 1, 3, 4 },
+    { 3, 4, 6 }, { 2, 5, 6 } });
+
+  // Verify Node Weights
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(1));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(2));
+  ASSERT_EQ(3, this->hypergraph.nodeWeight(3));
+  ASSERT_EQ(4, this->hypergraph.nodeWeight(4));
+  ASSERT_EQ(9, this->hypergraph.nodeWeight(5));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(6));
+
+  // Verify Edge Weights
+  ASSERT_EQ(4, this->hypergraph.edgeWeight(0));
+  ASSERT_EQ(2, this->hypergraph.edgeWeight(1));
+  ASSERT_EQ(3, this->hypergraph.edgeWeight(2));
+  ASSERT_EQ(8, this->hypergraph.edgeWeight(3));
+}
+
+TYPED_TEST(AGraphReader, ReadsABinarySnapshotOfAGraph) {
+  HyperedgeID num_edges = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeVector edges;
+  vec<HyperedgeWeight> edges_weight;
+  vec<HypernodeWeight> nodes_weight;
+  readGraphFile("../tests/instances/graph_with_edge_weights.graph",
+    num_edges, num_nodes, edges, edges_weight, nodes_weight);
+  writeBinaryFile("graph_snapshot.bin", num_nodes, edges, edges_weight, nodes_weight, true);
+
+  ASSERT_TRUE(isBinaryGraphFile("graph_snapshot.bin"));
+  this->readHypergraph("graph_snapshot.bin", FileFormat::binary);
+  std::remove("graph_snapshot.bin");
+
+  // Verify Neighbors and Edge Weights
+  this->verifyNeighborsAndEdgeWeights(
+    { { { 1, 1 }, { 2, 2 }, { 4, 1 } },
+      { { 0, 1 }, { 2, 2 }, { 3, 1 } },
+      { { 0, 2 }, { 1, 2 }, { 3, 2 }, { 4, 3 } },
+      { { 1, 1 }, { 2, 2 }, { 5, 2 }, { 6, 5 } },
+      { { 0, 1 }, { 2, 3 }, { 5, 2 } },
+      { { 3, 2 }, { 4, 2 }, { 6, 6 } },
+      { { 3, 5 }, { 5, 6 } },
+      { } } );
+
+  // Verify Node Weights
+  for ( HypernodeID hn = 0; hn < 8; ++hn ) {
+    ASSERT_EQ(1, this->hypergraph.nodeWeight(hn));
+  }
+}
+
+#ifndef _WIN32
+TEST(ASharedMemoryHypergraph, ProvidesReadOnlyAccessToTheStoredHypergraph) {
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_removed_hyperedges = 0;
+  HyperedgeVector hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  readHypergraphFile("../tests/instances/hypergraph_with_node_and_edge_weights.hgr",
+    num_hyperedges, num_hypernodes, num_removed_hyperedges,
+    hyperedges, hyperedges_weight, hypernodes_weight);
+  const std::string name = "/mt_kahypar_io_test_" + std::to_string(getpid());
+  SharedMemoryHypergraph::create(name, num_hypernodes, hyperedges,
+    hyperedges_weight, hypernodes_weight, false);
+  ASSERT_THROW(SharedMemoryHypergraph::create(name, num_hypernodes, hyperedges,
+    hyperedges_weight, hypernodes_weight, false), SystemException);
+
+  SharedMemoryHypergraph shared_hg(name);
+  SharedMemoryHypergraph::unlink(name);
+  ASSERT_THROW(SharedMemoryHypergraph attached(name), InvalidInputException);
+
+  // The attached segment remains valid after unlinking its name
+  ASSERT_FALSE(shared_hg.isGraph());
+  ASSERT_EQ(7, shared_hg.numNodes());
+  ASSERT_EQ(4, shared_hg.numEdges());
+  ASSERT_EQ(12, shared_hg.numPins());
+  ASSERT_EQ(39, shared_hg.totalWeight());
+  for ( HyperedgeID he = 0; he < shared_hg.numEdges(); ++he ) {
+    ASSERT_EQ(hyperedges[he].size(), shared_hg.edgeSize(he));
+    ASSERT_EQ(hyperedges_weight[he], shared_hg.edgeWeight(he));
+    size_t i = 0;
+    for ( const HypernodeID& pin : shared_hg.pins(he) ) {
+      ASSERT_EQ(hyperedges[he][i++], pin);
+    }
+  }
+  for ( HypernodeID hn = 0; hn < shared_hg.numNodes(); ++hn ) {
+    ASSERT_EQ(hypernodes_weight[hn], shared_hg.nodeWeight(hn));
+  }
+
+  mt_kahypar_hypergraph_t hypergraph =
+    readSharedMemoryHypergraph(shared_hg, PresetType::default_preset, true);
+  ASSERT_EQ(STATIC_HYPERGRAPH, hypergraph.type);
+  const ds::StaticHypergraph& hg = utils::cast<ds::StaticHypergraph>(hypergraph);
+  ASSERT_EQ(7, hg.initialNumNodes());
+  ASSERT_EQ(4, hg.initialNumEdges());
+  ASSERT_EQ(39, hg.totalWeight());
+  ASSERT_EQ(8, hg.edgeWeight(3));
+  utils::delete_hypergraph(hypergraph);
+}
+#endif
+
+TEST(ABinaryFileReader, RejectsTextInput) {
+  ASSERT_THROW(isBinaryGraphFile("../tests/instances/unweighted_hypergraph.hgr"), InvalidInputException);
+}
+
+TYPED_TEST(AGraphReader, ReadsASnapEdgeList) {
+  this->readHypergraph("../tests/instances/unweighted_graph.snap", FileFormat::SNAP);
+
+  // Node IDs are compacted, and the self-loop and duplicated edge are removed
+  ASSERT_EQ(7, this->hypergraph.initialNumNodes());
+  this->verifyNeighbors(
+    { { 1, 2, 4 },
+      { 0, 2, 3 },
+      { 0, 1, 3, 4 },
+      { 1, 2, 5, 6 },
+      { 0, 2, 5 },
+      { 3, 4, 6 },
+      { 3, 5 } } );
+  for ( const HyperedgeID& he : this->hypergraph.edges() ) {
+    ASSERT_EQ(1, this->hypergraph.edgeWeight(he));
+  }
+}
+
+TYPED_TEST(AGraphReader, ReadsAMatrixMarketFile) {
+  this->readHypergraph("../tests/instances/unweighted_graph.mtx", FileFormat::MatrixMarket);
+
+  // Diagonal entries and values are ignored
+  ASSERT_EQ(8, this->hypergraph.initialNumNodes());
+  this->verifyNeighbors(
+    { { 1, 2, 4 },
+      { 0, 2, 3 },
+      { 0, 1, 3, 4 },
+      { 1, 2, 5, 6 },
+      { 0, 2, 5 },
+      { 3, 4, 6 },
+      { 3, 5 },
+      { } } );
+  for ( const HyperedgeID& he : this->hypergraph.edges() ) {
+    ASSERT_EQ(1, this->hypergraph.edgeWeight(he));
+  }
+}
+
+TEST(AMatrixMarketReader, RejectsNonSquareMatrices) {
+  {
+    std::ofstream out("non_square.mtx");
+    out << "%%MatrixMarket matrix coordinate pattern general\n3 4 2\n1 2\n3 4\n";
+  }
+  HyperedgeID num_edges = 0;
+  HypernodeID num_vertices = 0;
+  HyperedgeVector edges;
+  ASSERT_THROW(readEdgeListFile("non_square.mtx", FileFormat::MatrixMarket,
+    num_edges, num_vertices, edges), InvalidInputException);
+  std::remove("non_square.mtx");
+}
+
+TEST(AMatrixMarketReader, RejectsEntriesOutOfBounds) {
+  {
+    std::ofstream out("out_of_bounds.mtx");
+    out << "%%MatrixMarket matrix coordinate pattern general\n3 3 2\n1 2\n3 4\n";
+  }
+  HyperedgeID num_edges = 0;
+  HypernodeID num_vertices = 0;
+  HyperedgeVector edges;
+  ASSERT_THROW(readEdgeListFile("out_of_bounds.mtx", FileFormat::MatrixMarket,
+    num_edges, num_vertices, edges), InvalidInputException);
+  std::remove("out_of_bounds.mtx");
+}
+
+static void writeWeightedBinarySnapshot(const std::string& filename) {
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_removed_hyperedges = 0;
+  HyperedgeVector hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  readHypergraphFile("../tests/instances/hypergraph_with_node_and_edge_weights.hgr",
+    num_hyperedges, num_hypernodes, num_removed_hyperedges,
+    hyperedges, hyperedges_weight, hypernodes_weight);
+  writeBinaryFile(filename, num_hypernodes, hyperedges,
+    hyperedges_weight, hypernodes_weight, false);
+}
+
+TEST(ASemiExternalCoarsening, ContractsBinaryFileUntilContractionLimitIsReached) {
+  writeWeightedBinarySnapshot("semi_external_snapshot.bin");
+  const SemiExternalCoarsening coarsening =
+    coarsenBinaryFile("semi_external_snapshot.bin", 4, 100, 4);
+  std::remove("semi_external_snapshot.bin");
+
+  ASSERT_EQ(7, coarsening.num_fine_nodes);
+  ASSERT_EQ(4, coarsening.num_coarse_nodes);
+  ASSERT_EQ(vec<HypernodeID>({ 0, 0, 0, 0, 1, 2, 3 }), coarsening.fine_to_coarse);
+  ASSERT_EQ(vec<HypernodeWeight>({ 18, 4, 9, 8 }), coarsening.hypernodes_weight);
+  // The first net becomes a single-pin net and is removed
+  ASSERT_EQ(3, coarsening.hyperedges.size());
+  ASSERT_EQ(Hyperedge({ 0, 1 }), coarsening.hyperedges[0]);
+  ASSERT_EQ(Hyperedge({ 0, 1, 3 }), coarsening.hyperedges[1]);
+  ASSERT_EQ(Hyperedge({ 0, 2, 3 }), coarsening.hyperedges[2]);
+  ASSERT_EQ(vec<HyperedgeWeight>({ 2, 3, 8 }), coarsening.hyperedges_weight);
+}
+
+TEST(ASemiExternalCoarsening, RespectsMaximumClusterWeight) {
+  writeWeightedBinarySnapshot("semi_external_snapshot.bin");
+  const SemiExternalCoarsening coarsening =
+    coarsenBinaryFile("semi_external_snapshot.bin", 4, 10, 4);
+  std::remove("semi_external_snapshot.bin");
+
+  ASSERT_EQ(5, coarsening.num_coarse_nodes);
+  for ( const HypernodeWeight& weight : coarsening.hypernodes_weight ) {
+    ASSERT_LE(weight, 10);
+  }
+}
+
+TEST(AnInputStatisticsReader, ComputesStatisticsOfAHypergraph) {
+  const InputStatistics stats = readInputStatistics(
+    "../tests/instances/hypergraph_with_node_and_edge_weights.hgr", FileFormat::hMetis);
+  ASSERT_FALSE(stats.is_graph);
+  ASSERT_EQ(7, stats.num_nodes);
+  ASSERT_EQ(4, stats.num_edges);
+  ASSERT_EQ(12, stats.num_pins);
+  ASSERT_EQ(vec<HypernodeID>({ 2, 4, 3, 3 }), stats.edge_sizes);
+  ASSERT_EQ(vec<HyperedgeWeight>({ 4, 2, 3, 8 }), stats.edge_weights);
+  ASSERT_EQ(vec<HyperedgeID>({ 2, 1, 2, 2, 2, 1, 2 }), stats.node_degrees);
+  ASSERT_EQ(vec<HypernodeWeight>({ 5, 8, 2, 3, 4, 9, 8 }), stats.node_weights);
+}
+
+TEST(AnInputStatisticsReader, ComputesStatisticsOfAGraph) {
+  InputStatistics stats = readInputStatistics(
+    "../tests/instances/graph_with_edge_weights.graph", FileFormat::Metis);
+  ASSERT_TRUE(stats.is_graph);
+  ASSERT_EQ(8, stats.num_nodes);
+  ASSERT_EQ(11, stats.num_edges);
+  ASSERT_EQ(22, stats.num_pins);
+  ASSERT_EQ(vec<HypernodeID>(11, 2), stats.edge_sizes);
+  std::sort(stats.edge_weights.begin(), stats.edge_weights.end());
+  ASSERT_EQ(vec<HyperedgeWeight>({ 1, 1, 1, 2, 2, 2, 2, 2, 3, 5, 6 }), stats.edge_weights);
+  ASSERT_EQ(vec<HyperedgeID>({ 3, 3, 4, 4, 3, 3, 2, 0 }), stats.node_degrees);
+  ASSERT_EQ(vec<HypernodeWeight>(8, 1), stats.node_weights);
+}
+
+TEST(APartitionFile, IsWrittenAndReadInTextFormat) {
+  std::vector<PartitionID> partition(100000);
+  for ( size_t i = 0; i < partition.size(); ++i ) {
+    partition[i] = (i * 7) % 13 - 1;
+  }
+  writePartitionFile(partition.data(), partition.size(), "text.partition");
+  std::vector<PartitionID> actual_partition;
+  readPartitionFile("text.partition", partition.size(), actual_partition);
+  std::remove("text.partition");
+  ASSERT_EQ(partition, actual_partition);
+}
+
+TEST(APartitionFile, IsWrittenAndReadInBinaryFormat) {
+  std::vector<PartitionID> partition(100000);
+  for ( size_t i = 0; i < partition.size(); ++i ) {
+    partition[i] = (i * 7) % 13 - 1;
+  }
+  writePartitionFile(partition.data(), partition.size(), "binary.partition", true);
+  std::vector<PartitionID> actual_partition;
+  readPartitionFile("binary.partition", partition.size(), actual_partition);
+  ASSERT_EQ(partition, actual_partition);
+  ASSERT_THROW(readPartitionFile("binary.partition", partition.size() - 1, actual_partition), InvalidInputException);
+  std::remove("binary.partition");
+}
+
+TEST(APartitionFile, SkipsCommentsAndTrailingEmptyLines) {
+  {
+    std::ofstream out("comments.partition");
+    out << "% comment\n1\n-1\r\n3\n\n";
+  }
+  std::vector<PartitionID> partition;
+  readPartitionFile("comments.partition", 3, partition);
+  ASSERT_EQ(std::vector<PartitionID>({ 1, -1, 3 }), partition);
+  ASSERT_THROW(readPartitionFile("comments.partition", 2, partition), InvalidInputException);
+  ASSERT_THROW(readPartitionFile("comments.partition", 4, partition), InvalidInputException);
+  std::remove("comments.partition");
+}
+
+TEST(ACompressedFileReader, DetectsUncompressedInput) {
+  ASSERT_EQ(CompressionType::none, detectCompression("../tests/instances/unweighted_hypergraph.hgr"));
+}
+
+#ifdef KAHYPAR_USE_ZLIB
+void writeGzipFile(const std::string& input, const std::string& output) {
+  std::ifstream in(input);
+  std::stringstream content;
+  content << in.rdbuf();
+  const std::string data = content.str();
+  gzFile file = gzopen(output.c_str(), "wb");
+  gzwrite(file, data.data(), data.size());
+  gzclose(file);
+}
+
+TYPED_TEST(AHypergraphReader, ReadsAGzipCompressedHypergraph) {
+  writeGzipFile("../tests/instances/hypergraph_with_node_and_edge_weights.hgr", "hypergraph.hgr.gz");
+  ASSERT_EQ(CompressionType::gzip, detectCompression("hypergraph.hgr.gz"));
+  this->readHypergraph("hypergraph.hgr.gz", FileFormat::hMetis);
+  std::remove("hypergraph.hgr.gz");
+
+  // Verify Pins
+  this->verifyPins({ { 0, 2 }, { 0, 1, 3, 4 },
+    { 3, 4, 6 }, { 2, 5, 6 } });
+
+  // Verify Node Weights
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(6));
+
+  // Verify Edge Weights
+  ASSERT_EQ(4, this->hypergraph.edgeWeight(0));
+  ASSERT_EQ(8, this->hypergraph.edgeWeight(3));
+}
+
+TYPED_TEST(AGraphReader, ReadsAGzipCompressedMetisGraph) {
+  writeGzipFile("../tests/instances/graph_with_edge_weights.graph", "graph.graph.gz");
+  this->readHypergraph("graph.graph.gz", FileFormat::Metis);
+  std::remove("graph.graph.gz");
+
+  // Verify Neighbors and Edge Weights
+  this->verifyNeighborsAndEdgeWeights(
+    { { { 1, 1 }, { 2, 2 }, { 4, 1 } },
+      { { 0, 1 }, { 2, 2 }, { 3, 1 } },
+      { { 0, 2 }, { 1, 2 }, { 3, 2 }, { 4, 3 } },
+      { { 1, 1 }, { 2, 2 }, { 5, 2 }, { 6, 5 } },
+      { { 0, 1 }, { 2, 3 }, { 5, 2 } },
+      { { 3, 2 }, { 4, 2 }, { 6, 6 } },
+      { { 3, 5 }, { 5, 6 } },
+      { } } );
+}
+
+TEST(ACompressedFileReader, RejectsATruncatedGzipFile) {
+  writeGzipFile("../tests/instances/unweighted_hypergraph.hgr", "truncated.hgr.gz");
+  std::string data;
+  {
+    std::ifstream in("truncated.hgr.gz", std::ios::binary);
+    std::stringstream content;
+    content << in.rdbuf();
+    data = content.str();
+  }
+  {
+    std::ofstream out("truncated.hgr.gz", std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size() / 2);
+  }
+  size_t length = 0;
+  ASSERT_THROW(decompressFile("truncated.hgr.gz", CompressionType::gzip, length), InvalidInputException);
+  std::remove("truncated.hgr.gz");
+}
+#endif
+
 }  // namespace io
 }  // namespace mt_kahypar
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/instance_cache.h"
+#include "mt-kahypar/utils/exception.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace io {
+
+class AServerJob : public Test {
+
+ public:
+  AServerJob() :
+    num_reads(0),
+    read_hypergraph([&](const Context& context) {
+      ++num_reads;
+      return readInputFile(context.partition.graph_filename, context.partition.preset_type,
+        context.partition.instance_type, context.partition.file_format);
+    }) { }
+
+  static Context parse(const std::string& job) {
+    Context context(false);
+    processServerJob(context, job);
+    return context;
+  }
+
+  size_t num_reads;
+  std::function<mt_kahypar_hypergraph_t(const Context&)> read_hypergraph;
+};
+
+TEST_F(AServerJob, ParsesTheOptionsOfAWellFormedJob) {
+  const Context context = parse(
+    "-h ../tests/instances/ibm01.hgr -k 8 -e 0.05 -o cut --seed=7 --preset-type=default");
+  ASSERT_EQ("../tests/instances/ibm01.hgr", context.partition.graph_filename);
+  ASSERT_EQ(8, context.partition.k);
+  ASSERT_DOUBLE_EQ(0.05, context.partition.epsilon);
+  ASSERT_EQ(Objective::cut, context.partition.objective);
+  ASSERT_EQ(7, context.partition.seed);
+  ASSERT_EQ(PresetType::default_preset, context.partition.preset_type);
+  // Loaded from the preset
+  ASSERT_EQ(Mode::direct, context.partition.mode);
+}
+
+TEST_F(AServerJob, PrefersOptionsOfTheJobOverThePreset) {
+  const Context context = parse(
+    "  -h ../tests/instances/ibm01.hgr\t-k 8 -e 0.05 -o km1 -m rb --preset-type=default  ");
+  ASSERT_EQ(Mode::recursive_bipartitioning, context.partition.mode);
+}
+
+TEST_F(AServerJob, RejectsAnEmptyJob) {
+  ASSERT_THROW(parse(" \t "), InvalidInputException);
+}
+
+TEST_F(AServerJob, RejectsTheHelpOption) {
+  ASSERT_THROW(parse("-h ../tests/instances/ibm01.hgr --help"), InvalidInputException);
+}
+
+TEST_F(AServerJob, RejectsUnknownOptions) {
+  ASSERT_THROW(parse("-h ../tests/instances/ibm01.hgr -k 8 -e 0.03 -o km1 "
+    "--preset-type=default --no-such-option=1"), InvalidInputException);
+}
+
+TEST_F(AServerJob, RejectsJobsWithMissingRequiredOptions) {
+  ASSERT_THROW(parse("-h ../tests/instances/ibm01.hgr -e 0.03 -o km1 --preset-type=default"),
+    InvalidInputException);
+}
+
+TEST_F(AServerJob, RejectsInvalidOptionValues) {
+  ASSERT_THROW(parse("-h ../tests/instances/ibm01.hgr -k eight -e 0.03 -o km1 --preset-type=default"),
+    InvalidInputException);
+}
+
+TEST_F(AServerJob, RejectsJobsWithoutPreset) {
+  ASSERT_THROW(parse("-h ../tests/instances/ibm01.hgr -k 8 -e 0.03 -o km1"), InvalidInputException);
+}
+
+TEST_F(AServerJob, RejectsTheAutomaticPresetSelection) {
+  ASSERT_THROW(parse("-h ../tests/instances/ibm01.hgr -k 8 -e 0.03 -o km1 --preset-type=auto"),
+    UnsupportedOperationException);
+}
+
+TEST_F(AServerJob, ReadsARepeatedInstanceOnlyOnce) {
+  InstanceCache cache(2);
+  Context context = parse("-h ../tests/instances/ibm01.hgr -k 2 -e 0.03 -o km1 --preset-type=default");
+  context.partition.instance_type = InstanceType::hypergraph;
+  const mt_kahypar_hypergraph_t hypergraph = cache.get(context, read_hypergraph);
+  ASSERT_EQ(STATIC_HYPERGRAPH, hypergraph.type);
+  ASSERT_EQ(1, num_reads);
+
+  context = parse("-h ../tests/instances/ibm01.hgr -k 8 -e 0.1 -o cut --preset-type=quality");
+  context.partition.instance_type = InstanceType::hypergraph;
+  ASSERT_EQ(hypergraph.hypergraph, cache.get(context, read_hypergraph).hypergraph);
+  ASSERT_EQ(1, num_reads);
+  ASSERT_EQ(1, cache.size());
+}
+
+TEST_F(AServerJob, ReadsTheInstanceAgainIfItIsConstructedDifferently) {
+  InstanceCache cache(2);
+  Context context = parse("-h ../tests/instances/ibm01.hgr -k 2 -e 0.03 -o km1 --preset-type=default");
+  context.partition.instance_type = InstanceType::hypergraph;
+  cache.get(context, read_hypergraph);
+  context.preprocessing.stable_construction_of_incident_edges = true;
+  cache.get(context, read_hypergraph);
+  ASSERT_EQ(2, num_reads);
+  ASSERT_EQ(2, cache.size());
+}
+
+TEST_F(AServerJob, EvictsTheLeastRecentlyUsedInstance) {
+  InstanceCache cache(2);
+  Context hypergraph_context = parse(
+    "-h ../tests/instances/ibm01.hgr -k 2 -e 0.03 -o km1 --preset-type=default");
+  hypergraph_context.partition.instance_type = InstanceType::hypergraph;
+  Context graph_context = parse(
+    "-h ../tests/instances/delaunay_n10.graph -k 2 -e 0.03 -o cut --preset-type=default --input-file-format=metis");
+  graph_context.partition.instance_type = InstanceType::graph;
+  Context twocenters_context = parse(
+    "-h ../tests/instances/twocenters.hgr -k 2 -e 0.03 -o km1 --preset-type=default");
+  twocenters_context.partition.instance_type = InstanceType::hypergraph;
+
+  cache.get(hypergraph_context, read_hypergraph);
+  cache.get(graph_context, read_hypergraph);
+  // Hypergraph is now the most recently used instance
+  cache.get(hypergraph_context, read_hypergraph);
+  ASSERT_EQ(2, num_reads);
+  // Evicts the graph
+  cache.get(twocenters_context, read_hypergraph);
+  ASSERT_EQ(3, num_reads);
+  ASSERT_EQ(2, cache.size());
+  cache.get(hypergraph_context, read_hypergraph);
+  ASSERT_EQ(3, num_reads);
+  cache.get(graph_context, read_hypergraph);
+  ASSERT_EQ(4, num_reads);
+}
+
+TEST_F(AServerJob, FailsIfTheInstanceDoesNotExist) {
+  InstanceCache cache(1);
+  const Context context = parse("-h no_such_file.hgr -k 2 -e 0.03 -o km1 --preset-type=default");
+  ASSERT_THROW(cache.get(context, read_hypergraph), InvalidInputException);
+  ASSERT_EQ(0, num_reads);
+}
+
+}  // namespace io
+}  // namespace mt_kahypar
@@ -35,6 +35,7 @@
 #include "tests/definitions.h"
 #include "mt-kahypar/io/sql_plottools_serializer.h"
 #include "mt-kahypar/io/csv_output.h"
+#include "mt-kahypar/io/json_output.h"
 
 using ::testing::Test;
 
@@ -62,7 +63,10 @@ std::set<std::string> excluded_members =
     "community_redistribution", "coarsening_rating", "label_propagation", "lp_execute_sequential", "deterministic_refinement", "jet",
     "snapshot_interval", "initial_partitioning_refinement", "initial_partitioning_enabled_ip_algos", "original_num_threads",
     "stable_construction_of_incident_edges", "fm", "global", "flows", "rebalancing", "csv_output", "preset_file", "preset_type", "instance_type", "degree_of_parallelism",
-    "mapping_target_graph_file" };
+    "mapping_target_graph_file", "json_output_file", "trace_output_file", "report_callback", "report_callback_data", "deadline",
+    "binary_partition_file", "progress_callback", "progress_callback_data", "cancel_callback", "cancel_callback_data",
+    "start_time", "community_cache_dir", "hwloc_topology_file", "memory_sampling_interval",
+    "auto_tuning_cache_dir" };
 
 bool is_target_struct(const std::string& line) {
   for ( const std::string& target_struct : target_structs ) {
@@ -222,5 +226,76 @@ TEST(CSVTest, HeaderAndRowContainSameNumberOfColumns) {
   ASSERT_EQ(std::count(body.begin(), body.end(), ','), std::count(header.begin(), header.end(), ','));
 }
 
+TEST(JSONTest, EscapesSpecialCharacters) {
+  ASSERT_EQ("plain", json::escape("plain"));
+  ASSERT_EQ("a\\\"b\\\\c", json::escape("a\"b\\c"));
+  ASSERT_EQ("line\\nbreak\\ttab", json::escape("line\nbreak\ttab"));
+  ASSERT_EQ("\\u0001", json::escape(std::string(1, '\x01')));
+}
+
+TEST(JSONTest, ContainsTimerHierarchyStatsAndMemoryConsumption) {
+  tests::Hypergraph dummy_hypergraph;
+  tests::PartitionedHypergraph dummy_partitioned_hypergraph(2, dummy_hypergraph);
+  Context dummy_context;
+  dummy_context.partition.graph_filename = "path/to/dummy.hgr";
+  dummy_context.partition.k = 2;
+  dummy_context.partition.perfect_balance_part_weights.assign(2, 0);
+  dummy_context.partition.max_part_weights.assign(2, 0);
+  dummy_context.utility_id = utils::Utilities::instance().registerNewUtilityObjects();
+
+  utils::Timer& timer = utils::Utilities::instance().getTimer(dummy_context.utility_id);
+  timer.start_timer("refinement", "Refinement");
+  timer.start_timer("fm", "FM");
+  timer.stop_timer("fm");
+  timer.stop_timer("refinement");
+  utils::Stats& stats = utils::Utilities::instance().getStats(dummy_context.utility_id);
+  stats.add_stat("num_moves", static_cast<int64_t>(42));
+  stats.add_stat("converged", true);
+
+  const std::string body = json::serialize(dummy_partitioned_hypergraph, dummy_context, std::chrono::duration<double>(0.2));
+  ASSERT_EQ(std::count(body.begin(), body.end(), '{'), std::count(body.begin(), body.end(), '}'));
+  ASSERT_EQ(std::count(body.begin(), body.end(), '['), std::count(body.begin(), body.end(), ']'));
+  ASSERT_NE(std::string::npos, body.find("\"graph\":\"dummy.hgr\""));
+  ASSERT_NE(std::string::npos, body.find("\"total_time\":0.2"));
+  ASSERT_NE(std::string::npos, body.find("\"timings\":[{\"key\":\"refinement\",\"description\":\"Refinement\""));
+  ASSERT_NE(std::string::npos, body.find("\"children\":[{\"key\":\"fm\",\"description\":\"FM\""));
+  ASSERT_NE(std::string::npos, body.find("\"stats\":{\"converged\":true,\"num_moves\":42}"));
+  ASSERT_NE(std::string::npos, body.find("\"partitioned_hypergraph\":{\"name\":\"Partitioned Hypergraph\""));
+  ASSERT_NE(std::string::npos, body.find("\"memory_pool\":{\"name\":\"Memory Pool\""));
+}
+
+TEST(JSONTest, ContainsTraceSpansOfEachThread) {
+  utils::Timer timer;
+  timer.enableTracing();
+  timer.disable();
+  timer.start_timer("coarsening", "Coarsening");
+  timer.stop_timer("coarsening");
+  timer.enable();
+  timer.start_timer("refinement", "Refinement");
+  {
+    utils::Timer::ScopedTraceSpan span(timer, "Flow Search", "flows");
+    span.addArg("blocks", "(0,1)");
+  }
+  timer.stop_timer("refinement");
+
+  const std::vector<utils::Timer::TraceSpan> spans = timer.traceSpans();
+  ASSERT_EQ(2, spans.size());
+  ASSERT_EQ("Refinement", spans[0].name);
+  ASSERT_EQ("Flow Search", spans[1].name);
+  ASSERT_EQ("blocks=(0,1)", spans[1].args);
+  ASSERT_EQ(spans[0].thread, spans[1].thread);
+  ASSERT_LE(spans[0].start, spans[1].start);
+  ASSERT_LE(spans[1].start + spans[1].duration, spans[0].start + spans[0].duration);
+
+  const std::string body = json::serializeChromeTrace(timer);
+  ASSERT_EQ(std::count(body.begin(), body.end(), '{'), std::count(body.begin(), body.end(), '}'));
+  ASSERT_NE(std::string::npos, body.find("\"name\":\"thread_name\""));
+  ASSERT_NE(std::string::npos, body.find("{\"name\":\"Refinement\",\"cat\":\"timer\",\"ph\":\"X\""));
+  ASSERT_NE(std::string::npos, body.find("\"args\":{\"info\":\"blocks=(0,1)\"}"));
+
+  timer.clear();
+  ASSERT_TRUE(timer.traceSpans().empty());
+}
+
 }  // namespace io
 }  // namespace mt_kahypar
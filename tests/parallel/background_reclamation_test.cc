@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/parallel/background_reclamation.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+class ABackgroundReclamation : public Test {
+ public:
+  ABackgroundReclamation() {
+    BackgroundReclamation::instance().activate();
+  }
+
+  ~ABackgroundReclamation() {
+    BackgroundReclamation::instance().deactivate();
+  }
+
+  // ! Increments the counter when it is destroyed
+  struct DestructionCounter {
+    explicit DestructionCounter(std::atomic<size_t>& c) :
+      counter(&c) { }
+
+    DestructionCounter(DestructionCounter&& other) :
+      counter(other.counter) {
+      other.counter = nullptr;
+    }
+
+    ~DestructionCounter() {
+      if ( counter ) {
+        ++(*counter);
+      }
+    }
+
+    std::atomic<size_t>* counter;
+  };
+};
+
+TEST_F(ABackgroundReclamation, IsOnlyActiveIfRequested) {
+  ASSERT_TRUE(BackgroundReclamation::instance().isActive());
+  BackgroundReclamation::instance().deactivate();
+  ASSERT_FALSE(BackgroundReclamation::instance().isActive());
+}
+
+TEST_F(ABackgroundReclamation, DestroysRetiredObjects) {
+  std::atomic<size_t> num_destroyed(0);
+  for ( size_t i = 0; i < 100; ++i ) {
+    BackgroundReclamation::instance().retire(DestructionCounter(num_destroyed));
+  }
+  BackgroundReclamation::instance().waitUntilIdle();
+  ASSERT_EQ(100, num_destroyed.load());
+}
+
+TEST_F(ABackgroundReclamation, DestroysRetiredObjectsOnBackgroundThread) {
+  std::thread::id thread_id = std::this_thread::get_id();
+  BackgroundReclamation::instance().defer([&] {
+    thread_id = std::this_thread::get_id();
+  });
+  BackgroundReclamation::instance().waitUntilIdle();
+  ASSERT_NE(std::this_thread::get_id(), thread_id);
+}
+
+TEST_F(ABackgroundReclamation, DestroysRetiredObjectsImmediatelyIfNotActive) {
+  BackgroundReclamation::instance().deactivate();
+  std::atomic<size_t> num_destroyed(0);
+  BackgroundReclamation::instance().retire(DestructionCounter(num_destroyed));
+  ASSERT_EQ(1, num_destroyed.load());
+}
+
+TEST_F(ABackgroundReclamation, DestroysPendingObjectsWhenDeactivated) {
+  std::atomic<size_t> num_destroyed(0);
+  for ( size_t i = 0; i < 100; ++i ) {
+    BackgroundReclamation::instance().retire(DestructionCounter(num_destroyed));
+  }
+  BackgroundReclamation::instance().deactivate();
+  ASSERT_EQ(100, num_destroyed.load());
+}
+
+TEST_F(ABackgroundReclamation, RetiresLargeArrays) {
+  ds::Array<size_t> array(1000000, 7);
+  BackgroundReclamation::instance().retire(std::move(array));
+  BackgroundReclamation::instance().waitUntilIdle();
+  ASSERT_EQ(0, array.size());
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
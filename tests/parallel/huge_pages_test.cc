@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/parallel/huge_pages.h"
+#include "mt-kahypar/parallel/memory_pool.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+class AHugePageAllocation : public Test {
+ public:
+  AHugePageAllocation() {
+    HugePages::instance().activate();
+  }
+
+  ~AHugePageAllocation() {
+    HugePages::instance().deactivate();
+  }
+
+  static constexpr size_t NUM_ELEMENTS = HugePages::MIN_ALLOCATION_SIZE / sizeof(size_t) + 42;
+};
+
+TEST_F(AHugePageAllocation, IsOnlyActiveIfRequested) {
+  ASSERT_TRUE(HugePages::instance().isActive());
+  HugePages::instance().deactivate();
+  ASSERT_FALSE(HugePages::instance().isActive());
+}
+
+TEST_F(AHugePageAllocation, IgnoresUnalignedAndSmallRegions) {
+  std::vector<char> data(HugePages::HUGE_PAGE_SIZE);
+  HugePages::instance().advise(data.data() + 1, data.size() - 1);
+  HugePages::instance().advise(nullptr, HugePages::MIN_ALLOCATION_SIZE);
+}
+
+TEST_F(AHugePageAllocation, InitializesLargeArray) {
+  ds::Array<size_t> array(NUM_ELEMENTS, 7);
+  ASSERT_EQ(NUM_ELEMENTS, array.size());
+  for ( size_t i = 0; i < NUM_ELEMENTS; ++i ) {
+    ASSERT_EQ(7, array[i]);
+  }
+}
+
+TEST_F(AHugePageAllocation, ZeroInitializesLargeMemoryChunks) {
+  MemoryPool::instance().register_memory_group("TEST_GROUP", 1);
+  MemoryPool::instance().register_memory_chunk("TEST_GROUP", "TEST_CHUNK", NUM_ELEMENTS, sizeof(size_t));
+  MemoryPool::instance().allocate_memory_chunks();
+
+  size_t* data = reinterpret_cast<size_t*>(MemoryPool::instance().mem_chunk("TEST_GROUP", "TEST_CHUNK"));
+  ASSERT_NE(nullptr, data);
+  for ( size_t i = 0; i < NUM_ELEMENTS; ++i ) {
+    ASSERT_EQ(0, data[i]);
+  }
+
+  MemoryPool::instance().free_memory_chunks();
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -140,6 +140,36 @@ TEST(AMemoryPool, RequestMemoryAfterRelease) {
   MemoryPool::instance().free_memory_chunks();
 }
 
+TEST(AMemoryPool, RequestsAndReleasesMemoryViaHandle) {
+  setupMemoryPool(false);
+
+  const MemoryChunkHandle handle =
+    MemoryPool::instance().memory_chunk_handle("TEST_GROUP_1", "TEST_CHUNK_1");
+  ASSERT_TRUE(handle.exists());
+  ASSERT_EQ(MemoryPool::instance().mem_chunk("TEST_GROUP_1", "TEST_CHUNK_1"),
+            MemoryPool::instance().request_mem_chunk(handle, 5, sizeof(size_t)));
+  ASSERT_EQ(nullptr, MemoryPool::instance().request_mem_chunk("TEST_GROUP_1", "TEST_CHUNK_1", 5, sizeof(size_t)));
+  MemoryPool::instance().release_mem_chunk(handle);
+  ASSERT_EQ(MemoryPool::instance().mem_chunk("TEST_GROUP_1", "TEST_CHUNK_1"),
+            MemoryPool::instance().request_mem_chunk("TEST_GROUP_1", "TEST_CHUNK_1", 5, sizeof(size_t)));
+  ASSERT_FALSE(MemoryPool::instance().memory_chunk_handle("TEST_GROUP_1", "TEST_CHUNK_3").exists());
+
+  MemoryPool::instance().free_memory_chunks();
+}
+
+TEST(AMemoryPool, InvalidatesHandlesWhenMemoryIsFreed) {
+  setupMemoryPool(false);
+  const MemoryChunkHandle handle =
+    MemoryPool::instance().memory_chunk_handle("TEST_GROUP_1", "TEST_CHUNK_1");
+  MemoryPool::instance().free_memory_chunks();
+
+  setupMemoryPool(false);
+  ASSERT_EQ(nullptr, MemoryPool::instance().request_mem_chunk(handle, 5, sizeof(size_t)));
+  ASSERT_EQ(nullptr, MemoryPool::instance().mem_chunk(handle));
+
+  MemoryPool::instance().free_memory_chunks();
+}
+
 TEST(AMemoryPool, OnlyOneRequestSucceedsOnConcurrentAccess) {
   setupMemoryPool(false);
 
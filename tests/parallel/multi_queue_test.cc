@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <thread>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+
+#include "mt-kahypar/parallel/multi_queue.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace parallel {
+
+TEST(MultiQueue, ReturnsAllElementsAfterParallelInsertionAndDeletion) {
+  int m = 75000;
+  MultiQueue<int, int> mq(std::thread::hardware_concurrency());
+  tbb::parallel_for(0, m, [&](int i) {
+    mq.safe_push(i, i % 100, tbb::this_task_arena::current_thread_index());
+  });
+  mq.build();
+  ASSERT_EQ(mq.unsafe_size(), m);
+
+  tbb::enumerable_thread_specific<int> counters;
+  tbb::task_group tg;
+  int num_tasks = 7;
+  for (int i = 0; i < num_tasks; ++i) {
+    tg.run([&]() {
+      int res = 0;
+      int& lc = counters.local();
+      while (mq.try_pop(res, tbb::this_task_arena::current_thread_index())) {
+        lc++;
+      }
+    });
+  }
+  tg.wait();
+
+  int overall = counters.combine(std::plus<int>());
+  ASSERT_EQ(overall, m);
+  ASSERT_EQ(mq.unsafe_size(), 0);
+}
+
+TEST(MultiQueue, ReturnsElementsWithHighKeysFirst) {
+  MultiQueue<int, int> mq(1);
+  // thread 0 distributes the elements alternately to its two heaps
+  for (int i = 0; i < 1000; ++i) {
+    mq.safe_push(i, i, 0);
+  }
+  mq.build();
+
+  // each pop returns the top element of one of the two heaps
+  int res = 0;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(mq.try_pop(res, 0));
+    ASSERT_GE(res, 999 - 2 * 10);
+  }
+  for (int i = 10; i < 1000; ++i) {
+    ASSERT_TRUE(mq.try_pop(res, 0));
+  }
+  ASSERT_FALSE(mq.try_pop(res, 0));
+}
+
+TEST(MultiQueue, ClearWorks) {
+  MultiQueue<int, int> mq(std::thread::hardware_concurrency());
+  mq.safe_push(5, 1, tbb::this_task_arena::current_thread_index());
+  mq.safe_push(420, 2, tbb::this_task_arena::current_thread_index());
+  mq.build();
+  ASSERT_EQ(mq.unsafe_size(), 2);
+  mq.clear();
+  ASSERT_EQ(mq.unsafe_size(), 0);
+  int res = 0;
+  ASSERT_FALSE(mq.try_pop(res, tbb::this_task_arena::current_thread_index()));
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/numa_placement.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+  TEST(StaticParallelFor, VisitsEachIndexExactlyOnce) {
+    const size_t n = 100000;
+    vec<CAtomic<uint32_t>> visited(n);
+    parallel::static_parallel_for(UL(0), n, [&](const size_t i) {
+      visited[i].fetch_add(1, std::memory_order_relaxed);
+    });
+    for ( size_t i = 0; i < n; ++i ) {
+      ASSERT_EQ(1, visited[i].load());
+    }
+  }
+
+  TEST(StaticParallelFor, HandlesEmptyRanges) {
+    size_t num_calls = 0;
+    parallel::static_parallel_for(UL(5), UL(5), [&](const size_t) {
+      ++num_calls;
+    });
+    ASSERT_EQ(0, num_calls);
+  }
+
+  TEST(StaticParallelFor, PassesContiguousSubranges) {
+    const size_t n = 100000;
+    vec<CAtomic<uint32_t>> visited(n);
+    parallel::static_parallel_for_ranges(UL(10), n, [&](const size_t start, const size_t end) {
+      ASSERT_LE(10, start);
+      ASSERT_LT(start, end);
+      ASSERT_LE(end, n);
+      for ( size_t i = start; i < end; ++i ) {
+        visited[i].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+    for ( size_t i = 0; i < n; ++i ) {
+      ASSERT_EQ(i < 10 ? 0 : 1, visited[i].load());
+    }
+  }
+
+}  // namespace mt_kahypar
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/parallel/parallel_radix_sort.h"
+
+#include <random>
+#include <algorithm>
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+  TEST(RadixSortTest, SortsSmallKeys) {
+    size_t n = 1 << 19;
+    vec<uint32_t> in(n, 0);
+    std::mt19937 rng(420);
+    std::uniform_int_distribution<uint32_t> dist(0, 1 << 20);
+    std::generate(in.begin(), in.end(), [&] { return dist(rng); });
+
+    vec<uint32_t> expected = in;
+    std::sort(expected.begin(), expected.end());
+
+    parallel::ParallelRadixSorter<uint32_t> sorter;
+    sorter.sort(in.data(), in.data() + n, [](const uint32_t x) { return x; });
+    ASSERT_EQ(expected, in);
+  }
+
+  TEST(RadixSortTest, IsStable) {
+    size_t n = 1 << 19;
+    vec<std::pair<uint32_t, size_t>> in(n);
+    std::mt19937 rng(420);
+    std::uniform_int_distribution<uint32_t> dist(0, 1000);
+    for (size_t i = 0; i < n; ++i) {
+      in[i] = std::make_pair(dist(rng), i);
+    }
+
+    vec<std::pair<uint32_t, size_t>> expected = in;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.first < rhs.first;
+    });
+
+    parallel::ParallelRadixSorter<std::pair<uint32_t, size_t>> sorter;
+    sorter.sort(in.data(), in.data() + n, [](const auto& x) { return x.first; });
+    ASSERT_EQ(expected, in);
+  }
+
+  TEST(RadixSortTest, SortsLargeKeysAndReusesBuffers) {
+    parallel::ParallelRadixSorter<uint64_t> sorter;
+    std::mt19937_64 rng(420);
+    for (size_t n : { UL(1) << 10, UL(1) << 19, UL(1) << 16 }) {
+      vec<uint64_t> in(n, 0);
+      std::generate(in.begin(), in.end(), rng);
+
+      vec<uint64_t> expected = in;
+      std::sort(expected.begin(), expected.end());
+
+      sorter.sort(in.data(), in.data() + n, [](const uint64_t x) { return x; });
+      ASSERT_EQ(expected, in);
+    }
+  }
+
+}  // namespace mt_kahypar
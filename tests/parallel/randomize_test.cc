@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+
+#include <tbb/task_arena.h>
+
+#include "mt-kahypar/utils/randomize.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+  TEST(RandomizeTest, GeneratorIsDeterministic) {
+    utils::Xoshiro256 gen_1(420);
+    utils::Xoshiro256 gen_2(420);
+    utils::Xoshiro256 gen_3(421);
+    bool differs = false;
+    for (size_t i = 0; i < 1000; ++i) {
+      const uint64_t value = gen_1();
+      ASSERT_EQ(value, gen_2());
+      differs |= value != gen_3();
+    }
+    ASSERT_TRUE(differs);
+  }
+
+  TEST(RandomizeTest, ParallelShuffleComputesPermutation) {
+    size_t n = 1 << 20;
+    vec<size_t> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    utils::Randomize::instance().parallelShuffleVector(values, UL(0), n);
+
+    size_t num_fixed_points = 0;
+    vec<bool> contained(n, false);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_LT(values[i], n);
+      ASSERT_FALSE(contained[values[i]]);
+      contained[values[i]] = true;
+      num_fixed_points += values[i] == i;
+    }
+    // The expected number of fixed points of a random permutation is one
+    ASSERT_LE(num_fixed_points, 100);
+  }
+
+  TEST(RandomizeTest, ParallelShuffleOnlyPermutesRange) {
+    size_t n = 1 << 18;
+    vec<size_t> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    const size_t start = 1000;
+    const size_t end = n - 1000;
+    utils::Randomize::instance().parallelShuffleVector(values, start, end);
+
+    for (size_t i = 0; i < start; ++i) {
+      ASSERT_EQ(i, values[i]);
+    }
+    for (size_t i = end; i < n; ++i) {
+      ASSERT_EQ(i, values[i]);
+    }
+    vec<size_t> sorted(values.begin() + start, values.begin() + end);
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = start; i < end; ++i) {
+      ASSERT_EQ(i, sorted[i - start]);
+    }
+  }
+
+  std::vector<int> randomIntsInArena(const int seed) {
+    tbb::task_arena arena(1);
+    utils::ArenaLocalRandomize randomize(arena, seed);
+    std::vector<int> values;
+    arena.execute([&] {
+      for (size_t i = 0; i < 100; ++i) {
+        values.push_back(utils::Randomize::instance().getRandomInt(0, 1000000, THREAD_ID));
+      }
+    });
+    return values;
+  }
+
+  TEST(RandomizeTest, ThreadsOfAnArenaUseLocalGenerators) {
+    utils::Randomize& global = utils::Randomize::instance();
+    tbb::task_arena arena(1);
+    utils::Randomize* local = nullptr;
+    {
+      utils::ArenaLocalRandomize randomize(arena, 42);
+      arena.execute([&] {
+        local = &utils::Randomize::instance();
+      });
+      ASSERT_EQ(&global, &utils::Randomize::instance());
+    }
+    ASSERT_NE(&global, local);
+    // The generators are no longer used after the observer was destroyed
+    arena.execute([&] {
+      ASSERT_EQ(&global, &utils::Randomize::instance());
+    });
+  }
+
+  TEST(RandomizeTest, LocalGeneratorsAreSeededWithTheSeedOfTheArena) {
+    const std::vector<int> values = randomIntsInArena(42);
+    ASSERT_EQ(values, randomIntsInArena(42));
+    ASSERT_NE(values, randomIntsInArena(43));
+  }
+
+  TEST(RandomizeTest, LocalGeneratorsDoNotChangeTheGlobalGenerators) {
+    utils::Randomize& global = utils::Randomize::instance();
+    global.setSeed(42);
+    const int expected = global.getRandomInt(0, 1000000, 0);
+    global.setSeed(42);
+    randomIntsInArena(43);
+    ASSERT_EQ(expected, global.getRandomInt(0, 1000000, 0));
+  }
+
+  TEST(RandomizeTest, ConcurrentArenasUseDifferentGenerators) {
+    std::vector<utils::Randomize*> instances(2, nullptr);
+    std::vector<std::vector<int>> values(2);
+    std::atomic<size_t> num_started(0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 2; ++i) {
+      threads.emplace_back([&, i] {
+        tbb::task_arena arena(1);
+        utils::ArenaLocalRandomize randomize(arena, 42);
+        arena.execute([&] {
+          instances[i] = &utils::Randomize::instance();
+          for (size_t j = 0; j < 100; ++j) {
+            values[i].push_back(utils::Randomize::instance().getRandomInt(0, 1000000, THREAD_ID));
+          }
+        });
+        // Keep both arenas alive until both threads obtained their generators
+        ++num_started;
+        while (num_started.load() < 2) {
+          std::this_thread::yield();
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    ASSERT_NE(instances[0], instances[1]);
+    ASSERT_EQ(values[0], values[1]);
+  }
+
+  TEST(RandomizeTest, NestedArenasRestoreTheGeneratorsOfTheOuterArena) {
+    tbb::task_arena outer(1);
+    utils::ArenaLocalRandomize outer_randomize(outer, 42);
+    outer.execute([&] {
+      utils::Randomize* outer_instance = &utils::Randomize::instance();
+      tbb::task_arena inner(1);
+      utils::ArenaLocalRandomize inner_randomize(inner, 43);
+      inner.execute([&] {
+        ASSERT_NE(outer_instance, &utils::Randomize::instance());
+      });
+      ASSERT_EQ(outer_instance, &utils::Randomize::instance());
+    });
+  }
+
+}  // namespace mt_kahypar
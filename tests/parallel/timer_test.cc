@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+
+#include "mt-kahypar/utils/timer.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  const utils::Timer::Timing* find(const std::vector<utils::Timer::Timing>& timings,
+                                   const std::string& key) {
+    for ( const utils::Timer::Timing& timing : timings ) {
+      if ( timing.key() == key ) {
+        return &timing;
+      }
+    }
+    return nullptr;
+  }
+
+  void sleep(const size_t microseconds) {
+    std::this_thread::sleep_for(std::chrono::microseconds(microseconds));
+  }
+}
+
+TEST(ATimer, MergesTimingsRecordedInParallelTasks) {
+  utils::Timer timer;
+  const size_t num_tasks = 256;
+  timer.start_timer("root", "Root");
+  tbb::parallel_for(UL(0), num_tasks, [&](const size_t) {
+    timer.start_timer("task", "Task", true);
+    timer.start_timer("sub_task", "Sub Task", true);
+    sleep(100);
+    timer.stop_timer("sub_task");
+    timer.stop_timer("task");
+  });
+  timer.stop_timer("root");
+
+  const std::vector<utils::Timer::Timing> timings = timer.timings();
+  ASSERT_EQ(3, timings.size());
+  const utils::Timer::Timing* root = find(timings, "root");
+  const utils::Timer::Timing* task = find(timings, "task");
+  const utils::Timer::Timing* sub_task = find(timings, "sub_task");
+  ASSERT_NE(nullptr, root);
+  ASSERT_NE(nullptr, task);
+  ASSERT_NE(nullptr, sub_task);
+  ASSERT_TRUE(root->is_root());
+  ASSERT_EQ("root", task->parent());
+  ASSERT_EQ("task", sub_task->parent());
+  // Each task slept at least 100 microseconds
+  ASSERT_GE(sub_task->timing(), num_tasks * 100e-6);
+  ASSERT_GE(task->timing(), sub_task->timing());
+  ASSERT_DOUBLE_EQ(task->timing(), timer.get("task"));
+}
+
+TEST(ATimer, AccumulatesTimingsOfTheSameScopeFromAllThreads) {
+  utils::Timer timer;
+  const size_t num_tasks = 64;
+  tbb::parallel_for(UL(0), num_tasks, [&](const size_t) {
+    timer.start_timer("task", "Task", true);
+    sleep(100);
+    timer.stop_timer("task");
+  });
+  timer.start_timer("task", "Task", true);
+  sleep(100);
+  timer.stop_timer("task");
+
+  const std::vector<utils::Timer::Timing> timings = timer.timings();
+  ASSERT_EQ(1, timings.size());
+  ASSERT_TRUE(timings[0].is_root());
+  ASSERT_GE(timings[0].timing(), ( num_tasks + 1 ) * 100e-6);
+}
+
+TEST(ATimer, StartsAndStopsSequentialTimersConcurrently) {
+  utils::Timer timer;
+  const size_t num_tasks = 4;
+  const size_t num_repetitions = 1000;
+  // Timers of a sequential context share a global stack. Concurrent scopes end up
+  // with an arbitrary parent, but the stack must stay consistent.
+  tbb::task_group tg;
+  for ( size_t i = 0; i < num_tasks; ++i ) {
+    tg.run([&] {
+      for ( size_t j = 0; j < num_repetitions; ++j ) {
+        timer.start_timer("sequential", "Sequential");
+        timer.stop_timer("sequential");
+      }
+    });
+  }
+  tg.wait();
+
+  size_t num_timings = 0;
+  for ( const utils::Timer::Timing& timing : timer.timings() ) {
+    ASSERT_EQ("sequential", timing.key());
+    ++num_timings;
+  }
+  ASSERT_GE(num_timings, 1);
+  timer.start_timer("root", "Root");
+  timer.stop_timer("root");
+  ASSERT_TRUE(find(timer.timings(), "root")->is_root());
+}
+
+TEST(ATimer, ClearsAllTimings) {
+  utils::Timer timer;
+  tbb::parallel_for(UL(0), UL(16), [&](const size_t) {
+    timer.start_timer("task", "Task", true);
+    timer.stop_timer("task");
+  });
+  timer.clear();
+  ASSERT_TRUE(timer.timings().empty());
+  ASSERT_EQ(0.0, timer.get("task"));
+}
+
+#if defined(__linux__)
+TEST(ATimer, RecordsPeakRSSAndFaultedBytesOfScopes) {
+  utils::Timer timer;
+  timer.start_timer("without_sampler", "Without Sampler");
+  timer.stop_timer("without_sampler");
+
+  const size_t num_bytes = 64 * 1024 * 1024;
+  utils::MemorySampler::instance().start(1);
+  timer.start_timer("allocate", "Allocate");
+  {
+    // Touch each page such that it is faulted into the process
+    std::unique_ptr<char[]> memory(new char[num_bytes]);
+    std::memset(memory.get(), 1, num_bytes);
+    sleep(5000);
+    timer.stop_timer("allocate");
+  }
+  utils::MemorySampler::instance().stop();
+
+  const std::vector<utils::Timer::Timing> timings = timer.timings();
+  const utils::Timer::Timing* without_sampler = find(timings, "without_sampler");
+  const utils::Timer::Timing* allocate = find(timings, "allocate");
+  ASSERT_NE(nullptr, without_sampler);
+  ASSERT_NE(nullptr, allocate);
+  ASSERT_FALSE(without_sampler->has_memory_samples());
+  ASSERT_TRUE(allocate->has_memory_samples());
+  ASSERT_GE(allocate->peak_rss(), num_bytes);
+  ASSERT_GE(allocate->faulted_bytes(), num_bytes);
+}
+#endif
+
+}  // namespace mt_kahypar
@@ -172,6 +172,10 @@ class TopologyMock {
     return cpus;
   }
 
+  static std::vector<int> get_efficiency_cpus(topology_t) {
+    return { };
+  }
+
   static void destroy_topology(topology_t) { }
 
  private:
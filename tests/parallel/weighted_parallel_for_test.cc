@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include <atomic>
+
+#include "mt-kahypar/parallel/weighted_parallel_for.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+  TEST(WeightedChunking, SplitsIntoChunksOfEqualWeight) {
+    // Element 2 has weight 9 + 1, all others weight 0 + 1
+    vec<size_t> prefix_weights = { 0, 1, 2, 12, 13, 14, 15, 16 };
+    ASSERT_EQ(std::make_pair(UL(0), UL(3)), parallel::chunking::weighted_bounds(0, 7, 2, prefix_weights));
+    ASSERT_EQ(std::make_pair(UL(3), UL(7)), parallel::chunking::weighted_bounds(1, 7, 2, prefix_weights));
+  }
+
+  TEST(WeightedParallelFor, VisitsEachElementExactlyOnce) {
+    const size_t n = 1 << 18;
+    vec<std::atomic<size_t>> visits(n);
+    for ( size_t i = 0; i < n; ++i ) {
+      visits[i].store(0);
+    }
+    parallel::weighted_parallel_for(UL(0), n, [&](const size_t i) {
+      return i % 1000 == 0 ? UL(100000) : UL(1);
+    }, [&](const size_t i) {
+      visits[i].fetch_add(1);
+    });
+    for ( size_t i = 0; i < n; ++i ) {
+      ASSERT_EQ(1, visits[i].load());
+    }
+  }
+
+}  // namespace mt_kahypar
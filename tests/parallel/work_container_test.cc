@@ -26,6 +26,7 @@
 
 #include "gmock/gmock.h"
 
+#include <algorithm>
 #include <thread>
 
 #include <tbb/enumerable_thread_specific.h>
@@ -80,7 +81,8 @@ TEST(WorkContainer, ClearWorks) {
 
 
 TEST(WorkContainer, WorkStealingWorks) {
-  WorkContainer<int> cdc(std::thread::hardware_concurrency());
+  // The producer and consumer use the queues of thread 0 and 1
+  WorkContainer<int> cdc(std::max(2U, std::thread::hardware_concurrency()));
 
   std::atomic<size_t> stage { 0 };
   size_t steals = 0;
@@ -118,5 +120,38 @@ TEST(WorkContainer, WorkStealingWorks) {
   ASSERT_EQ(steals + own_pops, m);
 }
 
+TEST(WorkContainer, StealsElementsInBatches) {
+  WorkContainer<int> cdc(4);
+  int m = 100;
+  for (int i = 0; i < m; ++i) {
+    cdc.safe_push(i, 0);
+  }
+
+  int element = -1;
+  ASSERT_TRUE(cdc.try_pop(element, 1));
+  ASSERT_EQ(0, element);
+  StealStats stats = cdc.steal_stats();
+  ASSERT_EQ(1, stats.num_steals);
+  ASSERT_EQ(WorkContainer<int>::MAX_STEAL_BATCH_SIZE, stats.num_stolen_elements);
+  ASSERT_EQ(m - 1, cdc.unsafe_size());
+
+  // Stolen elements are popped in order before the next steal
+  for (size_t i = 1; i < WorkContainer<int>::MAX_STEAL_BATCH_SIZE; ++i) {
+    ASSERT_TRUE(cdc.try_pop(element, 1));
+    ASSERT_EQ(static_cast<int>(i), element);
+  }
+  ASSERT_EQ(1, cdc.steal_stats().num_steals);
+
+  int popped = WorkContainer<int>::MAX_STEAL_BATCH_SIZE;
+  while (cdc.try_pop(element, 2)) {
+    ++popped;
+  }
+  ASSERT_EQ(m, popped);
+  ASSERT_EQ(0, cdc.unsafe_size());
+  stats = cdc.steal_stats();
+  ASSERT_EQ(m, stats.num_stolen_elements);
+  ASSERT_EQ(1, stats.num_failed_steals);
+}
+
 }  // namespace parallel
 }  // namespace mt_kahypar
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/partition/auto_tuning.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+}
+
+class AnAutoTuning : public Test {
+
+ public:
+  AnAutoTuning() :
+    context(),
+    hypergraph() {
+    context.partition.seed = 42;
+    hypergraph = io::readInputFile<Hypergraph>(
+      "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(AnAutoTuning, SamplesTheRequestedNumberOfNodes) {
+  Hypergraph sample_hg = AutoTuning<TypeTraits>::sample(hypergraph, 1000, context);
+  ASSERT_EQ(1000, sample_hg.initialNumNodes());
+  ASSERT_GT(sample_hg.initialNumEdges(), 0);
+  for ( const HyperedgeID& he : sample_hg.edges() ) {
+    ASSERT_GE(sample_hg.edgeSize(he), 2);
+  }
+}
+
+TEST_F(AnAutoTuning, SamplesAllNodesIfTheSampleSizeExceedsTheNumberOfNodes) {
+  Hypergraph sample_hg = AutoTuning<TypeTraits>::sample(
+    hypergraph, hypergraph.initialNumNodes() + 1, context);
+  ASSERT_EQ(hypergraph.initialNumNodes(), sample_hg.initialNumNodes());
+  ASSERT_EQ(hypergraph.initialNumEdges(), sample_hg.initialNumEdges());
+  ASSERT_EQ(hypergraph.initialNumPins(), sample_hg.initialNumPins());
+}
+
+TEST_F(AnAutoTuning, ComputesTheSameSampleForTheSameSeed) {
+  Hypergraph sample_1 = AutoTuning<TypeTraits>::sample(hypergraph, 2000, context);
+  Hypergraph sample_2 = AutoTuning<TypeTraits>::sample(hypergraph, 2000, context);
+  ASSERT_EQ(sample_1.initialNumEdges(), sample_2.initialNumEdges());
+  ASSERT_EQ(sample_1.initialNumPins(), sample_2.initialNumPins());
+}
+
+}  // namespace mt_kahypar
@@ -35,6 +35,7 @@
 #include "mt-kahypar/partition/coarsening/nlevel_uncoarsener.h"
 #endif
 #include "mt-kahypar/partition/coarsening/do_nothing_coarsener.h"
+#include "mt-kahypar/partition/coarsening/coarsening_hierarchy.h"
 
 
 using ::testing::Test;
@@ -94,6 +95,116 @@ TEST_F(AMultilevelCoarsener, ProjectsPartitionBackToOriginalHypergraph) {
   }
 }
 
+class AMultilevelCoarsenerOnAStar : public Test {
+ public:
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using Coarsener = MultilevelCoarsener<TypeTraits,
+    HeavyEdgeScore, NoWeightPenalty, tmp::BestRatingWithoutTieBreaking>;
+
+  AMultilevelCoarsenerOnAStar() :
+    hypergraph(),
+    context(),
+    uncoarseningData(nullptr),
+    coarsener(nullptr) {
+    // Hub 0 is connected to 16 leaves
+    vec<vec<HypernodeID>> edges;
+    for ( HypernodeID leaf = 1; leaf <= 16; ++leaf ) {
+      edges.push_back({ 0, leaf });
+    }
+    hypergraph = Hypergraph::Factory::construct(17, edges.size(), edges, nullptr, nullptr, true);
+
+    context.partition.k = 2;
+    context.partition.epsilon = 0.03;
+    context.partition.mode = Mode::direct;
+    context.partition.preset_type = PresetType::default_preset;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = TypeTraits::PartitionedHypergraph::TYPE;
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+    context.coarsening.max_allowed_node_weight = 2;
+    context.coarsening.contraction_limit = 2;
+    context.coarsening.minimum_shrink_factor = 1.0;
+    context.coarsening.maximum_shrink_factor = 4.0;
+    context.coarsening.two_hop_clustering_shrink_factor = 2.0;
+    context.shared_memory.original_num_threads = std::thread::hardware_concurrency();
+    context.shared_memory.num_threads = std::thread::hardware_concurrency();
+    context.setupPartWeights(hypergraph.totalWeight());
+  }
+
+  // Fixes leaves 1-6 to block 0 and leaves 7-12 to block 1
+  void fixLeaves() {
+    ds::FixedVertexSupport<Hypergraph> fixed_vertices(hypergraph.initialNumNodes(), context.partition.k);
+    fixed_vertices.setHypergraph(&hypergraph);
+    for ( HypernodeID leaf = 1; leaf <= 12; ++leaf ) {
+      fixed_vertices.fixToBlock(leaf, leaf <= 6 ? 0 : 1);
+    }
+    hypergraph.addFixedVertexSupport(std::move(fixed_vertices));
+  }
+
+  HypernodeID numNodesAfterOnePass() {
+    uncoarseningData = std::make_unique<UncoarseningData<TypeTraits>>(false, hypergraph, context);
+    coarsener = std::make_unique<Coarsener>(utils::hypergraph_cast(hypergraph),
+      context, uncoarsening::to_pointer(*uncoarseningData));
+    coarsener->disableRandomization();
+    coarsener->initialize();
+    coarsener->coarseningPass();
+    return coarsener->currentNumberOfNodes();
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+  std::unique_ptr<UncoarseningData<TypeTraits>> uncoarseningData;
+  std::unique_ptr<Coarsener> coarsener;
+};
+
+TEST_F(AMultilevelCoarsenerOnAStar, ContractsOnlyOneLeafWithoutTwoHopClustering) {
+  context.coarsening.use_two_hop_clustering = false;
+  ASSERT_EQ(16, numNodesAfterOnePass());
+}
+
+TEST_F(AMultilevelCoarsenerOnAStar, GroupsLeavesWithTwoHopClustering) {
+  context.coarsening.use_two_hop_clustering = true;
+  // The hub is contracted with one leaf and the remaining 15 leaves
+  // are grouped into pairs (max allowed node weight is 2)
+  ASSERT_EQ(9, numNodesAfterOnePass());
+}
+
+TEST_F(AMultilevelCoarsenerOnAStar, ContractsOnlyOneLeafWithProposeResolveClustering) {
+  context.coarsening.propose_resolve_clustering = true;
+  context.coarsening.num_sub_rounds_propose_resolve = 1;
+  // All leaves propose the hub, but only one of them fits into its cluster
+  ASSERT_EQ(16, numNodesAfterOnePass());
+}
+
+TEST_F(AMultilevelCoarsenerOnAStar, GroupsLeavesWithProposeResolveAndTwoHopClustering) {
+  context.coarsening.propose_resolve_clustering = true;
+  context.coarsening.use_two_hop_clustering = true;
+  ASSERT_EQ(9, numNodesAfterOnePass());
+}
+
+TEST_F(AMultilevelCoarsenerOnAStar, ContractsNodesWithPinSampling) {
+  context.coarsening.use_two_hop_clustering = false;
+  // Each net is rated by visiting only one of its two pins
+  context.coarsening.rating.pin_sampling_threshold = 1;
+  ASSERT_LT(numNodesAfterOnePass(), 17);
+}
+
+TEST_F(AMultilevelCoarsenerOnAStar, DoesNotContractFixedLeavesWithTheHub) {
+  fixLeaves();
+  context.coarsening.precontract_fixed_vertices = false;
+  // Only the hub and one free leaf are contracted
+  ASSERT_EQ(16, numNodesAfterOnePass());
+}
+
+TEST_F(AMultilevelCoarsenerOnAStar, PrecontractsLeavesFixedToTheSameBlock) {
+  fixLeaves();
+  context.coarsening.precontract_fixed_vertices = true;
+  // Both groups of fixed leaves form one node, the hub is contracted
+  // with one free leaf and the three other free leaves remain
+  ASSERT_EQ(6, numNodesAfterOnePass());
+}
+
 #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
 using ANLevelCoarsener = ACoarsener<DynamicHypergraphTypeTraits,
                                     NLevelCoarsener,
@@ -180,4 +291,107 @@ TEST_F(ADoNothingCoarsener, ProjectsPartitionBackToOriginalHypergraph) {
   }
 }
 
+TEST(AnUncoarseningData, RestoresTheHierarchyOfThePreviousVCycle) {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  Context context;
+  context.coarsening.contraction_limit = 2;
+  context.coarsening.maximum_shrink_factor = 2.0;
+  Hypergraph hypergraph = Hypergraph::Factory::construct(
+    8, 4, { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 } }, nullptr, nullptr, true);
+  // Block IDs of the current partition are stored as community IDs
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    hypergraph.setCommunityID(hn, hn < 4 ? 0 : 1);
+  }
+
+  vec<Level<TypeTraits>> previous;
+  {
+    UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    uncoarseningData.performMultilevelContraction({ 0, 0, 2, 2, 4, 4, 6, 6 }, false, start);
+    uncoarseningData.performMultilevelContraction({ 0, 0, 2, 2 }, false, start);
+    previous = std::move(uncoarseningData.hierarchy);
+    uncoarseningData.hierarchy.clear();
+  }
+
+  auto verifyCoarsestHypergraph = [&](const UncoarseningData<TypeTraits>& uncoarseningData) {
+    const Hypergraph& coarsest = uncoarseningData.hierarchy.back().contractedHypergraph();
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      HypernodeID coarse_hn = hn;
+      for ( const Level<TypeTraits>& level : uncoarseningData.hierarchy ) {
+        coarse_hn = level.mapToContractedHypergraph(coarse_hn);
+      }
+      ASSERT_EQ(hypergraph.communityID(hn), coarsest.communityID(coarse_hn));
+    }
+  };
+
+  {
+    // The partition did not change => all levels are reused
+    UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
+    ASSERT_EQ(0, uncoarseningData.restoreHierarchy(std::move(previous)));
+    ASSERT_EQ(2, uncoarseningData.hierarchy.size());
+    ASSERT_EQ(2, uncoarseningData.hierarchy.back().contractedHypergraph().initialNumNodes());
+    verifyCoarsestHypergraph(uncoarseningData);
+    previous = std::move(uncoarseningData.hierarchy);
+    uncoarseningData.hierarchy.clear();
+  }
+
+  {
+    // Node 3 moved to block 1 => it is split off on both levels
+    hypergraph.setCommunityID(3, 1);
+    UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
+    ASSERT_EQ(2, uncoarseningData.restoreHierarchy(std::move(previous)));
+    ASSERT_EQ(2, uncoarseningData.hierarchy.size());
+    ASSERT_EQ(5, uncoarseningData.hierarchy[0].contractedHypergraph().initialNumNodes());
+    ASSERT_EQ(3, uncoarseningData.hierarchy[1].contractedHypergraph().initialNumNodes());
+    verifyCoarsestHypergraph(uncoarseningData);
+  }
+}
+
+TEST(ACoarseningHierarchy, RejectsFilesWhoseCountsDoNotMatchTheFileSize) {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  Context context;
+  Hypergraph hypergraph = Hypergraph::Factory::construct(
+    8, 4, { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 } }, nullptr, nullptr, true);
+  const std::string filename = "coarsening_hierarchy.bin";
+  {
+    UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    uncoarseningData.performMultilevelContraction({ 0, 0, 1, 1, 2, 2, 3, 3 }, false, start);
+    CoarseningHierarchy<Hypergraph> hierarchy(hypergraph, std::move(uncoarseningData.hierarchy), 2);
+    hierarchy.writeToFile(filename);
+  }
+  ASSERT_EQ(1, CoarseningHierarchy<Hypergraph>::readFromFile(filename).numLevels());
+
+  std::string content;
+  {
+    std::ifstream in(filename, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  auto readModifiedFile = [&](const std::string& modified_content) {
+    {
+      std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+      out.write(modified_content.data(), modified_content.size());
+    }
+    CoarseningHierarchy<Hypergraph>::readFromFile(filename);
+  };
+
+  // Truncated file
+  ASSERT_THROW(readModifiedFile(content.substr(0, content.size() - 1)), InvalidInputException);
+  // Trailing bytes
+  ASSERT_THROW(readModifiedFile(content + "x"), InvalidInputException);
+  // The number of nodes (offset 16) exceeds the file size
+  std::string huge_num_nodes = content;
+  const uint64_t num_nodes = uint64_t(1) << 31;
+  std::memcpy(&huge_num_nodes[16], &num_nodes, sizeof(uint64_t));
+  ASSERT_THROW(readModifiedFile(huge_num_nodes), InvalidInputException);
+  // The number of levels (offset 40) exceeds the file size
+  std::string huge_num_levels = content;
+  const uint64_t num_levels = uint64_t(1) << 40;
+  std::memcpy(&huge_num_levels[40], &num_levels, sizeof(uint64_t));
+  ASSERT_THROW(readModifiedFile(huge_num_levels), InvalidInputException);
+  std::remove(filename.c_str());
+}
+
 }  // namespace mt_kahypar
@@ -127,6 +127,45 @@ public:
     metrics.imbalance = metrics::imbalance(partitioned_hypergraph, context);
   }
 
+  void performRepeatedCoarsening() {
+    Hypergraph first;
+    for (size_t i = 0; i < num_repetitions; ++i) {
+      UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
+      uncoarsening_data_t* data_ptr = uncoarsening::to_pointer(uncoarseningData);
+      mt_kahypar_hypergraph_t hg = utils::hypergraph_cast(hypergraph);
+      DeterministicMultilevelCoarsener<TypeTraits> coarsener(hg, context, data_ptr);
+      coarsener.coarsen();
+      if (i == 0) {
+        mt_kahypar_hypergraph_t first_hg = coarsener.coarsestHypergraph();
+        first = utils::cast<Hypergraph>(first_hg).copy();
+        for (HypernodeID u : first.nodes()) {
+          ASSERT_LE(first.nodeWeight(u), context.coarsening.max_allowed_node_weight);
+        }
+      } else {
+        mt_kahypar_hypergraph_t other_hg = coarsener.coarsestHypergraph();
+        const Hypergraph& other = utils::cast<Hypergraph>(other_hg);
+        ASSERT_EQ(other.initialNumNodes(), first.initialNumNodes());
+        ASSERT_EQ(other.initialNumEdges(), first.initialNumEdges());
+        ASSERT_EQ(other.initialNumPins(), first.initialNumPins());
+        vec<HyperedgeID> inets_first, inets_other;
+        for (HypernodeID u : first.nodes()) {
+          for (HyperedgeID e : first.incidentEdges(u)) inets_first.push_back(e);
+          for (HyperedgeID e : other.incidentEdges(u)) inets_other.push_back(e);
+          ASSERT_EQ(inets_first, inets_other);
+          inets_first.clear(); inets_other.clear();
+        }
+
+        vec<HypernodeID> pins_first, pins_other;
+        for (HyperedgeID e : first.edges()) {
+          for (HypernodeID v : first.pins(e)) pins_first.push_back(v);
+          for (HypernodeID v : other.pins(e)) pins_other.push_back(v);
+          ASSERT_EQ(pins_first, pins_other);
+          pins_first.clear(); pins_other.clear();
+        }
+      }
+    }
+  }
+
   void performRepeatedRefinement() {
     initialPartition();
     vec<PartitionID> initial_partition(hypergraph.initialNumNodes());
@@ -232,39 +271,13 @@ TEST_F(DeterminismTest, Preprocessing) {
 }
 
 TEST_F(DeterminismTest, Coarsening) {
-  Hypergraph first;
-  for (size_t i = 0; i < num_repetitions; ++i) {
-    UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, context);
-    uncoarsening_data_t* data_ptr = uncoarsening::to_pointer(uncoarseningData);
-    mt_kahypar_hypergraph_t hg = utils::hypergraph_cast(hypergraph);
-    DeterministicMultilevelCoarsener<TypeTraits> coarsener(hg, context, data_ptr);
-    coarsener.coarsen();
-    if (i == 0) {
-      mt_kahypar_hypergraph_t first_hg = coarsener.coarsestHypergraph();
-      first = utils::cast<Hypergraph>(first_hg).copy();
-    } else {
-      mt_kahypar_hypergraph_t other_hg = coarsener.coarsestHypergraph();
-      const Hypergraph& other = utils::cast<Hypergraph>(other_hg);
-      ASSERT_EQ(other.initialNumNodes(), first.initialNumNodes());
-      ASSERT_EQ(other.initialNumEdges(), first.initialNumEdges());
-      ASSERT_EQ(other.initialNumPins(), first.initialNumPins());
-      vec<HyperedgeID> inets_first, inets_other;
-      for (HypernodeID u : first.nodes()) {
-        for (HyperedgeID e : first.incidentEdges(u)) inets_first.push_back(e);
-        for (HyperedgeID e : other.incidentEdges(u)) inets_other.push_back(e);
-        ASSERT_EQ(inets_first, inets_other);
-        inets_first.clear(); inets_other.clear();
-      }
+  performRepeatedCoarsening();
+}
 
-      vec<HypernodeID> pins_first, pins_other;
-      for (HyperedgeID e : first.edges()) {
-        for (HypernodeID v : first.pins(e)) pins_first.push_back(v);
-        for (HypernodeID v : other.pins(e)) pins_other.push_back(v);
-        ASSERT_EQ(pins_first, pins_other);
-        pins_first.clear(); pins_other.clear();
-      }
-    }
-  }
+TEST_F(DeterminismTest, CoarseningWithTooHeavyClusters) {
+  // Many nodes propose clusters that cannot take all of them
+  context.coarsening.max_allowed_node_weight = 4;
+  performRepeatedCoarsening();
 }
 
 TEST_F(DeterminismTest, Refinement) {
@@ -282,6 +295,12 @@ TEST_F(DeterminismTest, RefinementWithActiveNodeSet) {
   performRepeatedRefinement();
 }
 
+TEST_F(DeterminismTest, RefinementWithAdaptiveSubRounds) {
+  context.refinement.deterministic_refinement.num_sub_rounds_sync_lp = 8;
+  context.refinement.deterministic_refinement.adaptive_sub_rounds_sync_lp = true;
+  performRepeatedRefinement();
+}
+
 TEST_F(DeterminismTest, RefinementK2) {
   context.partition.k = 2;
   partitioned_hypergraph = PartitionedHypergraph(
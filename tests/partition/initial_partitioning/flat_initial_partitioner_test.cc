@@ -27,6 +27,7 @@
 #include "gmock/gmock.h"
 
 #include <atomic>
+#include <queue>
 
 #include <tbb/parallel_invoke.h>
 
@@ -40,6 +41,7 @@
 #include "mt-kahypar/partition/initial_partitioning/label_propagation_initial_partitioner.h"
 #include "mt-kahypar/partition/initial_partitioning/policies/gain_computation_policy.h"
 #include "mt-kahypar/partition/initial_partitioning/policies/pq_selection_policy.h"
+#include "mt-kahypar/partition/initial_partitioning/policies/pseudo_peripheral_start_nodes.h"
 #include "mt-kahypar/utils/randomize.h"
 
 using ::testing::Test;
@@ -308,5 +310,82 @@ TYPED_TEST(AFlatInitialPartitionerTest, CanHandleFixedVerticesInOnlyOneBlock) {
             this->context.partition.epsilon);
 }
 
+TEST(APseudoPeripheralStartNodeSearch, SelectsNodesOfTheLastLevelOfAParallelBFS) {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+  // 12 x 8 grid
+  const HypernodeID num_rows = 12;
+  const HypernodeID num_cols = 8;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID r = 0; r < num_rows; ++r ) {
+    for ( HypernodeID c = 0; c < num_cols; ++c ) {
+      const HypernodeID u = r * num_cols + c;
+      if ( c + 1 < num_cols ) edges.push_back({ u, u + 1 });
+      if ( r + 1 < num_rows ) edges.push_back({ u, u + num_cols });
+    }
+  }
+  Hypergraph hypergraph = Hypergraph::Factory::construct(
+    num_rows * num_cols, edges.size(), edges);
+  PartitionedHypergraph partitioned_hypergraph(4, hypergraph, parallel_tag_t());
+
+  Context context;
+  context.partition.k = 4;
+  context.partition.epsilon = 0.2;
+  context.partition.objective = Objective::km1;
+  context.partition.gain_policy = GainPolicy::km1;
+  context.initial_partitioning.min_num_nodes_for_parallel_bfs = 0;
+  context.setupPartWeights(hypergraph.totalWeight());
+
+  auto compute_start_nodes = [&] {
+    InitialPartitioningDataContainer<TypeTraits> ip_data(partitioned_hypergraph, context);
+    std::mt19937 rng(420);
+    return PseudoPeripheralStartNodes<TypeTraits>::computeStartNodes(
+      ip_data, context, kInvalidPartition, rng);
+  };
+  const vec<vec<HypernodeID>> start_nodes = compute_start_nodes();
+  ASSERT_EQ(start_nodes, compute_start_nodes());
+
+  // The random start node is assigned to block 0. The remaining blocks
+  // are visited in the order k - 1, 1, ..., k - 2.
+  const vec<PartitionID> order = { 0, 3, 1, 2 };
+  vec<HypernodeID> previous_start_nodes;
+  for ( const PartitionID block : order ) {
+    ASSERT_EQ(1, start_nodes[block].size());
+    const HypernodeID start_node = start_nodes[block][0];
+    if ( !previous_start_nodes.empty() ) {
+      // BFS from all previous start nodes
+      vec<HypernodeID> distance(hypergraph.initialNumNodes(), kInvalidHypernode);
+      std::queue<HypernodeID> queue;
+      for ( const HypernodeID& hn : previous_start_nodes ) {
+        distance[hn] = 0;
+        queue.push(hn);
+      }
+      HypernodeID max_distance = 0;
+      while ( !queue.empty() ) {
+        const HypernodeID hn = queue.front();
+        queue.pop();
+        max_distance = std::max(max_distance, distance[hn]);
+        for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+          for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+            if ( distance[pin] == kInvalidHypernode ) {
+              distance[pin] = distance[hn] + 1;
+              queue.push(pin);
+            }
+          }
+        }
+      }
+      HypernodeID expected_start_node = kInvalidHypernode;
+      for ( const HypernodeID& hn : hypergraph.nodes() ) {
+        if ( distance[hn] == max_distance ) {
+          expected_start_node = std::min(expected_start_node, hn);
+        }
+      }
+      ASSERT_EQ(expected_start_node, start_node);
+    }
+    previous_start_nodes.push_back(start_node);
+  }
+}
 
 }  // namespace mt_kahypar
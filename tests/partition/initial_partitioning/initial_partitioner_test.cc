@@ -140,6 +140,43 @@ class AInitialPartitionerTest : public Test {
     }
   }
 
+  void verifyPartition() {
+    // Check that each vertex is assigned to a block
+    for ( const HypernodeID& hn : partitioned_hypergraph.nodes() ) {
+      ASSERT_NE(partitioned_hypergraph.partID(hn), kInvalidPartition)
+        << "Hypernode " << hn << " is unassigned!";
+    }
+
+    // Check that non of the blocks is empty
+    for ( PartitionID part_id = 0; part_id < context.partition.k; ++part_id ) {
+      ASSERT_GT(partitioned_hypergraph.partWeight(part_id), 0)
+        << "Block " << part_id << " is empty!";
+    }
+
+    // Check that part weights are correct
+    std::vector<HypernodeWeight> part_weight(context.partition.k, 0);
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      PartitionID part_id = partitioned_hypergraph.partID(hn);
+      ASSERT(part_id >= 0 && part_id < context.partition.k);
+      part_weight[part_id] += partitioned_hypergraph.nodeWeight(hn);
+    }
+
+    for ( PartitionID part_id = 0; part_id < context.partition.k; ++part_id ) {
+      ASSERT_EQ(partitioned_hypergraph.partWeight(part_id), part_weight[part_id])
+        << "Expected part weight of block " << part_id << " is " << part_weight[part_id]
+        << ", but currently is " << partitioned_hypergraph.partWeight(part_id);
+    }
+
+    // Check that balance constraint is fullfilled
+    for ( PartitionID part_id = 0; part_id < context.partition.k; ++part_id ) {
+      ASSERT_LE(partitioned_hypergraph.partWeight(part_id),
+                context.partition.max_part_weights[part_id])
+        << "Block " << part_id << " violates the balance constraint (Part Weight = "
+        << partitioned_hypergraph.partWeight(part_id) << ", Max Part Weight = "
+        << context.partition.max_part_weights[part_id];
+    }
+  }
+
   Hypergraph hypergraph;
   PartitionedHypergraph partitioned_hypergraph;
   Context context;
@@ -151,6 +188,7 @@ size_t AInitialPartitionerTest<Config>::num_threads = HardwareTopology::instance
 typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, Mode::deep_multilevel, 2>,
                          TestConfig<StaticHypergraphTypeTraits, Mode::deep_multilevel, 3>,
                          TestConfig<StaticHypergraphTypeTraits, Mode::deep_multilevel, 4>,
+                         TestConfig<StaticHypergraphTypeTraits, Mode::deep_multilevel, 7>,
                          TestConfig<StaticHypergraphTypeTraits, Mode::recursive_bipartitioning, 2>,
                          TestConfig<StaticHypergraphTypeTraits, Mode::recursive_bipartitioning, 3>,
                          TestConfig<StaticHypergraphTypeTraits, Mode::recursive_bipartitioning, 4>
@@ -165,41 +203,15 @@ TYPED_TEST_SUITE(AInitialPartitionerTest, TestConfigs);
 
 TYPED_TEST(AInitialPartitionerTest, VerifiesComputedPartition) {
   this->runInitialPartitioning();
+  this->verifyPartition();
+}
 
-  // Check that each vertex is assigned to a block
-  for ( const HypernodeID& hn : this->partitioned_hypergraph.nodes() ) {
-    ASSERT_NE(this->partitioned_hypergraph.partID(hn), kInvalidPartition)
-      << "Hypernode " << hn << " is unassigned!";
-  }
-
-  // Check that non of the blocks is empty
-  for ( PartitionID part_id = 0; part_id < this->context.partition.k; ++part_id ) {
-    ASSERT_GT(this->partitioned_hypergraph.partWeight(part_id), 0)
-      << "Block " << part_id << " is empty!";
-  }
-
-  // Check that part weights are correct
-  std::vector<HypernodeWeight> part_weight(this->context.partition.k, 0);
-  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
-    PartitionID part_id = this->partitioned_hypergraph.partID(hn);
-    ASSERT(part_id >= 0 && part_id < this->context.partition.k);
-    part_weight[part_id] += this->partitioned_hypergraph.nodeWeight(hn);
-  }
-
-  for ( PartitionID part_id = 0; part_id < this->context.partition.k; ++part_id ) {
-    ASSERT_EQ(this->partitioned_hypergraph.partWeight(part_id), part_weight[part_id])
-      << "Expected part weight of block " << part_id << " is " << part_weight[part_id]
-      << ", but currently is " << this->partitioned_hypergraph.partWeight(part_id);
-  }
-
-  // Check that balance constraint is fullfilled
-  for ( PartitionID part_id = 0; part_id < this->context.partition.k; ++part_id ) {
-    ASSERT_LE(this->partitioned_hypergraph.partWeight(part_id),
-              this->context.partition.max_part_weights[part_id])
-      << "Block " << part_id << " violates the balance constraint (Part Weight = "
-      << this->partitioned_hypergraph.partWeight(part_id) << ", Max Part Weight = "
-      << this->context.partition.max_part_weights[part_id];
-  }
+TYPED_TEST(AInitialPartitionerTest, VerifiesComputedPartitionWithLimitedNumberOfHypergraphCopies) {
+  // Deep multilevel partitioning performs only one recursive call per level
+  // with all threads, since only one copy of the coarsest hypergraph fits
+  this->context.partition.deep_ml_copy_memory_limit = 1;
+  this->runInitialPartitioning();
+  this->verifyPartition();
 }
 
 }  // namespace mt_kahypar
@@ -250,6 +250,44 @@ TEST_F(AInitialPartitioningDataContainer, AppliesBestPartitionToHypergraph) {
   ASSERT_EQ(1, partitioned_hypergraph.partID(6));
 }
 
+TEST_F(AInitialPartitioningDataContainer, RefinesBestPartitionsConcurrentlyInDeterministicMode) {
+  context.partition.deterministic = true;
+  context.initial_partitioning.population_size = 2;
+  context.initial_partitioning.perform_refinement_on_best_partitions = true;
+  context.initial_partitioning.fm_refinment_rounds = 3;
+  PartitionedHypergraph partitioned_hypergraph(
+    context.partition.k, hypergraph);
+  InitialPartitioningDataContainer<TypeTraits> ip_data(
+    partitioned_hypergraph, context, false);
+  PartitionedHypergraph& local_hg = ip_data.local_partitioned_hypergraph();
+
+  // Cut = 3
+  local_hg.setNodePart(0, 0);
+  local_hg.setNodePart(1, 0);
+  local_hg.setNodePart(2, 0);
+  local_hg.setNodePart(3, 0);
+  local_hg.setNodePart(4, 1);
+  local_hg.setNodePart(5, 1);
+  local_hg.setNodePart(6, 1);
+  std::mt19937 prng(420);
+  ip_data.commit(InitialPartitioningAlgorithm::random, prng, 0);
+
+  // Cut = 4
+  local_hg.setNodePart(0, 1);
+  local_hg.setNodePart(1, 0);
+  local_hg.setNodePart(2, 0);
+  local_hg.setNodePart(3, 0);
+  local_hg.setNodePart(4, 1);
+  local_hg.setNodePart(5, 0);
+  local_hg.setNodePart(6, 1);
+  ip_data.commit(InitialPartitioningAlgorithm::random, prng, 1);
+
+  ip_data.apply();
+
+  ASSERT_LE(metrics::quality(partitioned_hypergraph, context.partition.objective), 3);
+  ASSERT_LE(metrics::imbalance(partitioned_hypergraph, context), context.partition.epsilon);
+}
+
 TEST_F(AInitialPartitioningDataContainer, AppliesBestPartitionWithImbalancedPartitionToHypergraph1) {
   PartitionedHypergraph partitioned_hypergraph(
     context.partition.k, hypergraph);
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/utils/utilities.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/datastructures/fixed_vertex_support.h"
+#include "mt-kahypar/partition/initial_partitioning/parallel_label_propagation_initial_partitioner.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/utils/randomize.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+template<typename TypeTraitsT, PartitionID k>
+struct TestConfig {
+  using TypeTraits = TypeTraitsT;
+  static constexpr PartitionID K = k;
+};
+
+template<typename Config>
+class AParallelLabelPropagationInitialPartitionerTest : public Test {
+
+ public:
+  using TypeTraits = typename Config::TypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+
+  AParallelLabelPropagationInitialPartitionerTest() :
+    hypergraph(),
+    partitioned_hypergraph(),
+    context() {
+    context.partition.k = Config::K;
+    context.partition.epsilon = 0.2;
+    context.partition.objective = Objective::km1;
+    context.partition.gain_policy = GainPolicy::km1;
+    context.initial_partitioning.lp_maximum_iterations = 20;
+    hypergraph = io::readInputFile<Hypergraph>(
+      "../tests/instances/test_instance.hgr", FileFormat::hMetis, true);
+    partitioned_hypergraph = PartitionedHypergraph(
+      context.partition.k, hypergraph, parallel_tag_t());
+    context.setupPartWeights(hypergraph.totalWeight());
+    utils::Utilities::instance().getTimer(context.utility_id).disable();
+  }
+
+  void execute() {
+    ParallelLabelPropagationInitialPartitioner<TypeTraits>::partition(partitioned_hypergraph, context);
+  }
+
+  void addFixedVertices(const double percentage) {
+    ds::FixedVertexSupport<Hypergraph> fixed_vertices(
+      hypergraph.initialNumNodes(), context.partition.k);
+    fixed_vertices.setHypergraph(&hypergraph);
+
+    const int threshold = percentage * 1000;
+    utils::Randomize& rand = utils::Randomize::instance();
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      if ( rand.getRandomInt(0, 1000, THREAD_ID) <= threshold ) {
+        fixed_vertices.fixToBlock(hn, rand.getRandomInt(0, context.partition.k - 1, THREAD_ID));
+      }
+    }
+    hypergraph.addFixedVertexSupport(std::move(fixed_vertices));
+  }
+
+  Hypergraph hypergraph;
+  PartitionedHypergraph partitioned_hypergraph;
+  Context context;
+};
+
+typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, 2>,
+                         TestConfig<StaticHypergraphTypeTraits, 4>,
+                         TestConfig<StaticHypergraphTypeTraits, 8>,
+                         TestConfig<StaticHypergraphTypeTraits, 32> > TestConfigs;
+
+TYPED_TEST_SUITE(AParallelLabelPropagationInitialPartitionerTest, TestConfigs);
+
+TYPED_TEST(AParallelLabelPropagationInitialPartitionerTest, AssignsEachHypernode) {
+  this->execute();
+
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    ASSERT_NE(kInvalidPartition, this->partitioned_hypergraph.partID(hn));
+  }
+}
+
+TYPED_TEST(AParallelLabelPropagationInitialPartitionerTest, HasValidImbalance) {
+  this->execute();
+
+  ASSERT_LE(metrics::imbalance(this->partitioned_hypergraph, this->context),
+            this->context.partition.epsilon);
+}
+
+TYPED_TEST(AParallelLabelPropagationInitialPartitionerTest, ComputesConsistentObjective) {
+  this->execute();
+
+  HyperedgeWeight expected_km1 = 0;
+  for ( const HyperedgeID& he : this->hypergraph.edges() ) {
+    vec<bool> blocks(this->context.partition.k, false);
+    PartitionID connectivity = 0;
+    for ( const HypernodeID& pin : this->hypergraph.pins(he) ) {
+      const PartitionID block = this->partitioned_hypergraph.partID(pin);
+      connectivity += !blocks[block];
+      blocks[block] = true;
+    }
+    expected_km1 += (connectivity - 1) * this->hypergraph.edgeWeight(he);
+  }
+  ASSERT_EQ(expected_km1, metrics::quality(this->partitioned_hypergraph, Objective::km1));
+}
+
+TYPED_TEST(AParallelLabelPropagationInitialPartitionerTest, CanHandleFixedVertices) {
+  this->addFixedVertices(0.25 /* 25% of the nodes are fixed */);
+  this->execute();
+
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    if ( this->hypergraph.isFixed(hn) ) {
+      ASSERT_EQ(this->hypergraph.fixedVertexBlock(hn),
+        this->partitioned_hypergraph.partID(hn));
+    }
+  }
+}
+
+}  // namespace mt_kahypar
@@ -166,6 +166,32 @@ TYPED_TEST(APoolInitialPartitionerTest, HasNoSignificantLowPartitionWeights) {
   }
 }
 
+TYPED_TEST(APoolInitialPartitionerTest, ComputesValidPartitionIfTimeLimitIsExceeded) {
+  this->context.partition.time_limit = 1e-9;
+  this->context.setupDeadline();
+  ASSERT_TRUE(this->context.isTimeLimitExceeded());
+  this->bipartition();
+
+  for ( const HypernodeID& hn : this->partitioned_hypergraph.nodes() ) {
+    ASSERT_NE(this->partitioned_hypergraph.partID(hn), -1);
+  }
+  ASSERT_LE(metrics::imbalance(this->partitioned_hypergraph, this->context),
+            this->context.partition.epsilon);
+}
+
+TYPED_TEST(APoolInitialPartitionerTest, ComputesValidPartitionWithPortfolioScheduling) {
+  this->context.initial_partitioning.use_portfolio_scheduling = true;
+  this->context.initial_partitioning.use_adaptive_ip_runs = true;
+  this->context.initial_partitioning.min_adaptive_ip_runs = 2;
+  this->bipartition();
+
+  for ( const HypernodeID& hn : this->partitioned_hypergraph.nodes() ) {
+    ASSERT_NE(this->partitioned_hypergraph.partID(hn), -1);
+  }
+  ASSERT_LE(metrics::imbalance(this->partitioned_hypergraph, this->context),
+            this->context.partition.epsilon);
+}
+
 TYPED_TEST(APoolInitialPartitionerTest, CanHandleFixedVertices) {
   this->addFixedVertices(0.25);
   this->bipartition();
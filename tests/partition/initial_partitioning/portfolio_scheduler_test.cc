@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <numeric>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/partition/initial_partitioning/portfolio_scheduler.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AIPPortfolioScheduler : public Test {
+
+  static constexpr size_t NUM_ALGORITHMS = static_cast<size_t>(InitialPartitioningAlgorithm::UNDEFINED);
+
+ public:
+  AIPPortfolioScheduler() :
+    context(),
+    stats(NUM_ALGORITHMS) {
+    context.partition.seed = 42;
+    context.initial_partitioning.runs = 10;
+    context.initial_partitioning.min_adaptive_ip_runs = 2;
+    context.initial_partitioning.enabled_ip_algos.assign(NUM_ALGORITHMS, false);
+    enable(InitialPartitioningAlgorithm::random);
+    enable(InitialPartitioningAlgorithm::bfs);
+    enable(InitialPartitioningAlgorithm::label_propagation);
+  }
+
+  void enable(const InitialPartitioningAlgorithm algorithm) {
+    context.initial_partitioning.enabled_ip_algos[static_cast<size_t>(algorithm)] = true;
+  }
+
+  void setStats(const InitialPartitioningAlgorithm algorithm,
+                const double average_quality,
+                const double stddev) {
+    IPAlgorithmStats& s = stats[static_cast<size_t>(algorithm)];
+    s.num_runs = context.initial_partitioning.min_adaptive_ip_runs;
+    s.average_quality = average_quality;
+    s.stddev = stddev;
+  }
+
+  // ! Returns the number of scheduled runs of each algorithm
+  vec<size_t> schedule(IPPortfolioScheduler& scheduler,
+                       const HyperedgeWeight best_quality,
+                       const size_t max_runs = std::numeric_limits<size_t>::max()) {
+    vec<size_t> num_runs(NUM_ALGORITHMS, 0);
+    InitialPartitioningAlgorithm algorithm = InitialPartitioningAlgorithm::UNDEFINED;
+    int seed = 0;
+    int tag = 0;
+    for ( size_t i = 0; i < max_runs && scheduler.next(stats, best_quality, algorithm, seed, tag); ++i ) {
+      ++num_runs[static_cast<size_t>(algorithm)];
+    }
+    return num_runs;
+  }
+
+  size_t runs(const vec<size_t>& num_runs, const InitialPartitioningAlgorithm algorithm) {
+    return num_runs[static_cast<size_t>(algorithm)];
+  }
+
+  Context context;
+  vec<IPAlgorithmStats> stats;
+};
+
+TEST_F(AIPPortfolioScheduler, SchedulesSameNumberOfRunsAsStaticScheduling) {
+  IPPortfolioScheduler scheduler(context);
+  ASSERT_EQ(30, scheduler.remainingRuns());
+  const vec<size_t> num_runs = schedule(scheduler, std::numeric_limits<HyperedgeWeight>::max());
+  ASSERT_EQ(30, std::accumulate(num_runs.begin(), num_runs.end(), UL(0)));
+  ASSERT_EQ(0, scheduler.remainingRuns());
+  ASSERT_EQ(0, runs(num_runs, InitialPartitioningAlgorithm::greedy_global_fm));
+}
+
+TEST_F(AIPPortfolioScheduler, PerformsWarmupRunsOfEachAlgorithmFirst) {
+  IPPortfolioScheduler scheduler(context);
+  const vec<size_t> num_runs = schedule(scheduler, std::numeric_limits<HyperedgeWeight>::max(), 6);
+  ASSERT_EQ(2, runs(num_runs, InitialPartitioningAlgorithm::random));
+  ASSERT_EQ(2, runs(num_runs, InitialPartitioningAlgorithm::bfs));
+  ASSERT_EQ(2, runs(num_runs, InitialPartitioningAlgorithm::label_propagation));
+}
+
+TEST_F(AIPPortfolioScheduler, PrunesAlgorithmsThatAreUnlikelyToFindABetterPartition) {
+  setStats(InitialPartitioningAlgorithm::random, 200, 10);
+  setStats(InitialPartitioningAlgorithm::bfs, 105, 10);
+  setStats(InitialPartitioningAlgorithm::label_propagation, 100, 10);
+  IPPortfolioScheduler scheduler(context);
+  const vec<size_t> num_runs = schedule(scheduler, 95);
+  ASSERT_EQ(2, runs(num_runs, InitialPartitioningAlgorithm::random));
+  ASSERT_EQ(28, runs(num_runs, InitialPartitioningAlgorithm::bfs) +
+                runs(num_runs, InitialPartitioningAlgorithm::label_propagation));
+}
+
+TEST_F(AIPPortfolioScheduler, SchedulesMoreRunsForAlgorithmsWithBetterQuality) {
+  setStats(InitialPartitioningAlgorithm::random, 300, 150);
+  setStats(InitialPartitioningAlgorithm::bfs, 200, 100);
+  setStats(InitialPartitioningAlgorithm::label_propagation, 100, 50);
+  IPPortfolioScheduler scheduler(context);
+  const vec<size_t> num_runs = schedule(scheduler, 90);
+  ASSERT_GT(runs(num_runs, InitialPartitioningAlgorithm::label_propagation),
+            runs(num_runs, InitialPartitioningAlgorithm::bfs));
+  ASSERT_GT(runs(num_runs, InitialPartitioningAlgorithm::bfs),
+            runs(num_runs, InitialPartitioningAlgorithm::random));
+}
+
+TEST_F(AIPPortfolioScheduler, StopsIfAllAlgorithmsArePruned) {
+  setStats(InitialPartitioningAlgorithm::random, 200, 10);
+  setStats(InitialPartitioningAlgorithm::bfs, 200, 10);
+  setStats(InitialPartitioningAlgorithm::label_propagation, 200, 10);
+  IPPortfolioScheduler scheduler(context);
+  const vec<size_t> num_runs = schedule(scheduler, 100);
+  ASSERT_EQ(6, std::accumulate(num_runs.begin(), num_runs.end(), UL(0)));
+  ASSERT_EQ(0, scheduler.remainingRuns());
+}
+
+}  // namespace mt_kahypar
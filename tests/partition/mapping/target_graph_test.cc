@@ -26,9 +26,14 @@
 
 #include "gmock/gmock.h"
 
+#include <cstdio>
+#include <set>
+
+#include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 
 #include "mt-kahypar/datastructures/static_graph_factory.h"
+#include "mt-kahypar/partition/mapping/all_pair_shortest_path.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
 
 using ::testing::Test;
@@ -107,6 +112,29 @@ class ATargetGraph : public Test {
     return graph->distanceAfterExchangingBlocks(con_set, removed_block, added_block);
   }
 
+  void verifyDistancesForBlockPair(const vec<PartitionID>& connectivity_set,
+                                   const PartitionID block_0,
+                                   const PartitionID block_1) {
+    ds::Bitset con_set = getBitset(connectivity_set);
+    con_set.unset(block_0);
+    con_set.unset(block_1);
+    const HyperedgeWeight with_block_0 = graph->distanceWithBlock(con_set, block_0);
+    const HyperedgeWeight with_block_1 = graph->distanceWithBlock(con_set, block_1);
+    con_set.set(block_0);
+    const HyperedgeWeight with_both_blocks = graph->distanceWithBlock(con_set, block_1);
+
+    con_set = getBitset(connectivity_set);
+    const BlockPairDistances distances = graph->distancesForBlockPair(con_set, block_0, block_1);
+    ASSERT_EQ(with_block_0, distances.with_block_0);
+    ASSERT_EQ(with_block_1, distances.with_block_1);
+    ASSERT_EQ(with_both_blocks, distances.with_both_blocks);
+    for ( PartitionID block = 0; block < graph->numBlocks(); ++block ) {
+      const bool is_contained = std::find(connectivity_set.begin(),
+        connectivity_set.end(), block) != connectivity_set.end();
+      ASSERT_EQ(is_contained, con_set.isSet(block));
+    }
+  }
+
   std::unique_ptr<TargetGraph> graph;
 
  private:
@@ -276,6 +304,29 @@ TEST_F(ATargetGraph, UsesACachedDistanceForNonPrecomputedSets) {
   ASSERT_EQ(8, distance({ 0, 5, 9, 10 }));
 }
 
+TEST_F(ATargetGraph, ComputesCorrectDistancesIfCacheEvictsEntries) {
+  // Cache consists of a single bucket per shard
+  graph->precomputeDistances(2, 64);
+  for ( size_t i = 0; i < 3; ++i ) {
+    ASSERT_EQ(8, distance({ 0, 5, 9, 10 }));
+    ASSERT_EQ(13, distance({ 0, 3, 10, 14 }));
+    ASSERT_EQ(13, distance({ 0, 4, 6, 13, 15 }));
+    ASSERT_EQ(10, distance({ 1, 5, 8, 10, 12 }));
+    ASSERT_EQ(15, distance({ 2, 3, 4, 8, 10, 14, 15 }));
+  }
+}
+
+TEST_F(ATargetGraph, ExportsCacheHitsAndMisses) {
+  graph->precomputeDistances(2);
+  ASSERT_EQ(8, distance({ 0, 5, 9, 10 }));
+  ASSERT_EQ(8, distance({ 0, 5, 9, 10 }));
+  ASSERT_EQ(13, distance({ 0, 3, 10, 14 }));
+  ASSERT_EQ(3, distance({ 0, 2 }));
+  std::stringstream oss;
+  graph->printStats(oss);
+  ASSERT_THAT(oss.str(), ::testing::HasSubstr(" used_mst=2 used_cached_mst=1 steiner_tree_cache_size=2"));
+}
+
 TEST_F(ATargetGraph, InsertsIntoCacheConcurrentlyForNonPrecomputedSets) {
   graph->precomputeDistances(2);
   executeConcurrent([&] {
@@ -289,5 +340,310 @@ TEST_F(ATargetGraph, InsertsIntoCacheConcurrentlyForNonPrecomputedSets) {
   ASSERT_EQ(13, distance({ 0, 4, 6, 13, 15 }));
 }
 
+TEST_F(ATargetGraph, ComputesDistancesForBlockPairOfPrecomputedSets) {
+  graph->precomputeDistances(4);
+  verifyDistancesForBlockPair({ 2, 3 }, 0, 5);
+  verifyDistancesForBlockPair({ 0, 2, 3 }, 0, 5);
+  verifyDistancesForBlockPair({ 2, 3, 5 }, 0, 5);
+  verifyDistancesForBlockPair({ 0, 2, 3, 5 }, 0, 5);
+  verifyDistancesForBlockPair({ 7, 12 }, 15, 4);
+}
+
+TEST_F(ATargetGraph, ComputesDistancesForBlockPairOfNonPrecomputedSets) {
+  graph->precomputeDistances(2);
+  verifyDistancesForBlockPair({ 0, 5, 9, 10 }, 5, 9);
+  verifyDistancesForBlockPair({ 0, 9, 10 }, 5, 9);
+  verifyDistancesForBlockPair({ 0, 5, 10 }, 5, 9);
+  // Uses cached distances of the current block pair
+  verifyDistancesForBlockPair({ 0, 5, 9, 10 }, 5, 9);
+  verifyDistancesForBlockPair({ 0, 10, 12 }, 5, 9);
+  // Block pair changes
+  verifyDistancesForBlockPair({ 0, 5, 9, 10 }, 0, 10);
+  verifyDistancesForBlockPair({ 2, 3, 4, 8, 10, 14, 15 }, 3, 4);
+}
+
+TEST_F(ATargetGraph, IsInitializedOnlyOnceIfSharedByThreads) {
+  tbb::task_group tg;
+  for ( size_t i = 0; i < 4; ++i ) {
+    tg.run([&] {
+      graph->initialize(3);
+    });
+  }
+  tg.wait();
+  graph->initialize(2);
+  ASSERT_TRUE(graph->isInitialized());
+  ASSERT_EQ(3, graph->maxPrecomputedConnectivity());
+  ASSERT_EQ(8, distance({ 0, 3, 9 }));
+  ASSERT_EQ(7, distance({ 8, 11, 13 }));
+}
+
+TEST_F(ATargetGraph, IsNotHierarchical) {
+  graph->precomputeDistances(2);
+  ASSERT_FALSE(graph->isHierarchical());
+}
+
+TEST_F(ATargetGraph, MapsWrittenSteinerTreeTables) {
+  const std::string prefix = "target_graph_test_tables";
+  graph->setPrecomputedTablesFile(prefix, true /* write tables */);
+  graph->precomputeDistances(3);
+  ASSERT_FALSE(graph->usesMappedTables());
+
+  TargetGraph mapped_graph(graph->graph().copy());
+  mapped_graph.setPrecomputedTablesFile(prefix, false /* write tables */);
+  mapped_graph.precomputeDistances(3);
+  ASSERT_TRUE(mapped_graph.usesMappedTables());
+  for ( PartitionID i = 0; i < graph->numBlocks(); ++i ) {
+    for ( PartitionID j = 0; j < graph->numBlocks(); ++j ) {
+      ASSERT_EQ(graph->distance(i, j), mapped_graph.distance(i, j));
+    }
+  }
+  ds::Bitset con_set(graph->numBlocks());
+  for ( const PartitionID block : { 0, 3, 9 } ) con_set.set(block);
+  ASSERT_EQ(8, mapped_graph.distance(con_set));
+
+  // Tables of a different maximum connectivity are not mapped
+  TargetGraph other_graph(graph->graph().copy());
+  other_graph.setPrecomputedTablesFile(prefix, false /* write tables */);
+  other_graph.precomputeDistances(2);
+  ASSERT_FALSE(other_graph.usesMappedTables());
+  std::remove(TargetGraph::precomputedTablesFile(prefix, 3).c_str());
+}
+
+// Constructs the target graph as tools/hierarchical_target_graph_generator.cc,
+// the hierarchy and weights are given from the lowest to the highest level
+TargetGraph constructHierarchicalTargetGraph(const vec<HypernodeID>& hierarchy,
+                                             const vec<HyperedgeWeight>& weights) {
+  HypernodeID num_nodes = 1;
+  for ( const HypernodeID a : hierarchy ) num_nodes *= a;
+  vec<vec<HypernodeID>> edges;
+  vec<HyperedgeWeight> edge_weights;
+  for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+    for ( HypernodeID v = u + 1; v < num_nodes; ++v ) {
+      HypernodeID group_size = 1;
+      size_t level = 0;
+      while ( u / (group_size * hierarchy[level]) != v / (group_size * hierarchy[level]) ) {
+        group_size *= hierarchy[level++];
+      }
+      edges.push_back({ u, v });
+      edge_weights.push_back(weights[level]);
+    }
+  }
+  return TargetGraph(ds::StaticGraphFactory::construct(
+    num_nodes, edges.size(), edges, edge_weights.data()));
+}
+
+TEST(AHierarchicalTargetGraph, IsDetected) {
+  TargetGraph graph = constructHierarchicalTargetGraph({ 2, 2, 2 }, { 1, 10, 100 });
+  graph.precomputeDistances(2);
+  ASSERT_TRUE(graph.isHierarchical());
+  ASSERT_EQ(0, graph.distance(3, 3));
+  ASSERT_EQ(1, graph.distance(2, 3));
+  ASSERT_EQ(10, graph.distance(1, 3));
+  ASSERT_EQ(100, graph.distance(7, 0));
+}
+
+TEST(AHierarchicalTargetGraph, ComputesOptimalSteinerTrees) {
+  TargetGraph graph = constructHierarchicalTargetGraph({ 2, 2, 2 }, { 1, 10, 100 });
+  graph.precomputeDistances(2);
+  ASSERT_TRUE(graph.isHierarchical());
+  auto steiner_tree = [&](const vec<PartitionID>& blocks) {
+    ds::Bitset connectivity_set(graph.numBlocks());
+    for ( const PartitionID block : blocks ) connectivity_set.set(block);
+    return graph.distance(connectivity_set);
+  };
+  ASSERT_EQ(0, steiner_tree({ 5 }));
+  ASSERT_EQ(1, steiner_tree({ 4, 5 }));
+  ASSERT_EQ(111, steiner_tree({ 0, 1, 2, 4 }));
+  ASSERT_EQ(12, steiner_tree({ 0, 1, 2, 3 }));
+  ASSERT_EQ(120, steiner_tree({ 0, 2, 4, 6 }));
+  ASSERT_EQ(124, steiner_tree({ 0, 1, 2, 3, 4, 5, 6, 7 }));
+}
+
+TEST(AHierarchicalTargetGraph, IsNotDetectedIfWeightsDoNotMatchHierarchy) {
+  // Edge weights on a higher level are lighter
+  TargetGraph graph = constructHierarchicalTargetGraph({ 2, 2, 2 }, { 100, 10, 1 });
+  graph.precomputeDistances(2);
+  ASSERT_FALSE(graph.isHierarchical());
+}
+
+TEST(AHierarchicalTargetGraph, DoesNotRequirePrecomputation) {
+  // Precomputing all steiner trees up to size four would exceed the memory limit
+  TargetGraph graph = constructHierarchicalTargetGraph({ 4, 4, 4, 4 }, { 1, 5, 10, 50 });
+  graph.precomputeDistances(4);
+  ASSERT_TRUE(graph.isHierarchical());
+  ds::Bitset connectivity_set(graph.numBlocks());
+  connectivity_set.set(0);
+  connectivity_set.set(3);
+  connectivity_set.set(17);
+  connectivity_set.set(255);
+  ASSERT_EQ(1 + 10 + 50, graph.distance(connectivity_set));
+}
+
+TEST(ALargeTargetGraph, DistinguishesNonPrecomputedSetsWithMoreThan64Blocks) {
+  const HypernodeID num_blocks = 128;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID u = 0; u + 1 < num_blocks; ++u ) {
+    edges.push_back({ u, u + 1 });
+  }
+  // Target graph is a path with unit edge weights
+  TargetGraph graph(ds::StaticGraphFactory::construct(num_blocks, edges.size(), edges));
+  graph.precomputeDistances(2);
+
+  ds::Bitset connectivity_set(num_blocks);
+  connectivity_set.set(0);
+  connectivity_set.set(70);
+  connectivity_set.set(100);
+  ASSERT_EQ(100, graph.distance(connectivity_set));
+
+  connectivity_set.reset();
+  connectivity_set.set(0);
+  connectivity_set.set(6);
+  connectivity_set.set(36);
+  ASSERT_EQ(36, graph.distance(connectivity_set));
+}
+
+TEST(AllPairShortestPath, ComputesSameDistancesAsUnblockedFloydWarshall) {
+  // Spans several blocks of the blocked Floyd-Warshall algorithm
+  const HypernodeID n = 150;
+  const HyperedgeWeight infinity = std::numeric_limits<HyperedgeWeight>::max() / 3;
+  std::set<std::pair<HypernodeID, HypernodeID>> edge_set;
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    for ( const HypernodeID v : { ( u + 1 ) % n, ( 37 * u + 11 ) % n } ) {
+      if ( u != v ) {
+        edge_set.insert({ std::min(u, v), std::max(u, v) });
+      }
+    }
+  }
+  vec<vec<HypernodeID>> edges;
+  vec<HyperedgeWeight> edge_weights;
+  for ( const auto& [u, v] : edge_set ) {
+    edges.push_back({ u, v });
+    edge_weights.push_back(1 + ( 7 * u + 3 * v ) % 29);
+  }
+  ds::StaticGraph graph = ds::StaticGraphFactory::construct(
+    n, edges.size(), edges, edge_weights.data());
+
+  vec<HyperedgeWeight> distances(n * n, infinity);
+  AllPairShortestPath::compute(graph, distances);
+
+  vec<HyperedgeWeight> expected(n * n, infinity);
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    expected[u + u * n] = 0;
+  }
+  for ( const HyperedgeID& e : graph.edges() ) {
+    expected[graph.edgeSource(e) + graph.edgeTarget(e) * n] = graph.edgeWeight(e);
+  }
+  for ( HypernodeID k = 0; k < n; ++k ) {
+    for ( HypernodeID u = 0; u < n; ++u ) {
+      for ( HypernodeID v = 0; v < n; ++v ) {
+        expected[u + v * n] = std::min(expected[u + v * n],
+          expected[u + k * n] + expected[k + v * n]);
+      }
+    }
+  }
+  ASSERT_EQ(expected, distances);
+}
+
+TEST(ASteinerTree, ComputesSameTreesInParallelAsSequentially) {
+  const HypernodeID n = 12;
+  std::set<std::pair<HypernodeID, HypernodeID>> edge_set;
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    for ( const HypernodeID v : { ( u + 1 ) % n, ( 5 * u + 3 ) % n } ) {
+      if ( u != v ) {
+        edge_set.insert({ std::min(u, v), std::max(u, v) });
+      }
+    }
+  }
+  vec<vec<HypernodeID>> edges;
+  vec<HyperedgeWeight> edge_weights;
+  for ( const auto& [u, v] : edge_set ) {
+    edges.push_back({ u, v });
+    edge_weights.push_back(1 + ( 3 * u + 7 * v ) % 11);
+  }
+  auto construct_graph = [&] {
+    return TargetGraph(ds::StaticGraphFactory::construct(
+      n, edges.size(), edges, edge_weights.data()));
+  };
+
+  // Subsets of one cardinality are processed in parallel and update the
+  // Steiner trees of larger sets with an atomic min
+  const size_t max_set_size = 4;
+  TargetGraph sequential_graph = construct_graph();
+  tbb::task_arena sequential_arena(1);
+  sequential_arena.execute([&] {
+    sequential_graph.precomputeDistances(max_set_size);
+  });
+  TargetGraph parallel_graph = construct_graph();
+  parallel_graph.precomputeDistances(max_set_size);
+
+  // The optimal Steiner tree of a terminal set D is a minimum spanning tree of D and
+  // at most |D| - 2 Steiner nodes in the metric closure of the graph
+  const HyperedgeWeight infinity = std::numeric_limits<HyperedgeWeight>::max() / 3;
+  vec<vec<HyperedgeWeight>> dist(n, vec<HyperedgeWeight>(n, infinity));
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    dist[u][u] = 0;
+  }
+  for ( size_t i = 0; i < edges.size(); ++i ) {
+    dist[edges[i][0]][edges[i][1]] = edge_weights[i];
+    dist[edges[i][1]][edges[i][0]] = edge_weights[i];
+  }
+  for ( HypernodeID k = 0; k < n; ++k ) {
+    for ( HypernodeID u = 0; u < n; ++u ) {
+      for ( HypernodeID v = 0; v < n; ++v ) {
+        dist[u][v] = std::min(dist[u][v], dist[u][k] + dist[k][v]);
+      }
+    }
+  }
+  auto mst_weight = [&](const vec<HypernodeID>& nodes) {
+    vec<HyperedgeWeight> min_dist(nodes.size(), infinity);
+    vec<bool> in_tree(nodes.size(), false);
+    min_dist[0] = 0;
+    HyperedgeWeight weight = 0;
+    for ( size_t step = 0; step < nodes.size(); ++step ) {
+      size_t next = nodes.size();
+      for ( size_t i = 0; i < nodes.size(); ++i ) {
+        if ( !in_tree[i] && ( next == nodes.size() || min_dist[i] < min_dist[next] ) ) {
+          next = i;
+        }
+      }
+      in_tree[next] = true;
+      weight += min_dist[next];
+      for ( size_t i = 0; i < nodes.size(); ++i ) {
+        min_dist[i] = std::min(min_dist[i], dist[nodes[next]][nodes[i]]);
+      }
+    }
+    return weight;
+  };
+
+  for ( uint32_t terminals = 1; terminals < ( UL(1) << n ); ++terminals ) {
+    const size_t num_terminals = __builtin_popcount(terminals);
+    if ( num_terminals < 2 || num_terminals > max_set_size ) {
+      continue;
+    }
+    HyperedgeWeight expected = infinity;
+    for ( uint32_t steiner_nodes = 0; steiner_nodes < ( UL(1) << n ); ++steiner_nodes ) {
+      if ( ( steiner_nodes & terminals ) == 0 &&
+           static_cast<size_t>(__builtin_popcount(steiner_nodes)) + 2 <= num_terminals ) {
+        vec<HypernodeID> nodes;
+        for ( HypernodeID u = 0; u < n; ++u ) {
+          if ( ( ( terminals | steiner_nodes ) >> u ) & 1 ) {
+            nodes.push_back(u);
+          }
+        }
+        expected = std::min(expected, mst_weight(nodes));
+      }
+    }
+
+    ds::Bitset connectivity_set(n);
+    for ( HypernodeID u = 0; u < n; ++u ) {
+      if ( ( terminals >> u ) & 1 ) {
+        connectivity_set.set(u);
+      }
+    }
+    ds::StaticBitset con_set(connectivity_set.numBlocks(), connectivity_set.data());
+    ASSERT_EQ(expected, sequential_graph.distance(con_set));
+    ASSERT_EQ(expected, parallel_graph.distance(con_set));
+  }
+}
 
 }  // namespace mt_kahypar
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <algorithm>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/command_line_options.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/presets.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/multilevel.h"
+#include "mt-kahypar/partition/partitioner.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+}
+
+class APortfolio : public Test {
+
+ public:
+  APortfolio() :
+    context(),
+    hypergraph() {
+    std::vector<option> preset = loadPreset(PresetType::deterministic);
+    presetToContext(context, preset, true);
+    context.partition.k = 4;
+    context.partition.epsilon = 0.03;
+    context.partition.objective = Objective::km1;
+    context.partition.seed = 42;
+    context.partition.file_format = FileFormat::hMetis;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.partition.partition_type = PartitionedHypergraph::TYPE;
+    // Each portfolio run uses one thread
+    context.partition.portfolio_runs = 2;
+    context.shared_memory.num_threads = 2;
+    context.shared_memory.original_num_threads = 2;
+    hypergraph = io::readInputFile<Hypergraph>(
+      "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  }
+
+  PartitionedHypergraph partition(Context& c) {
+    Hypergraph hg = hypergraph.copy();
+    PartitionedHypergraph phg = Partitioner<TypeTraits>::partition(hg, c);
+    // Return a partition of the input hypergraph, since the partitioned
+    // hypergraph refers to the local copy
+    PartitionedHypergraph result(c.partition.k, hypergraph, parallel_tag_t());
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      result.setOnlyNodePart(hn, phg.partID(hn));
+    });
+    result.initializePartition();
+    return result;
+  }
+
+  void verifyPartition(const PartitionedHypergraph& phg, const Context& c) {
+    for ( const HypernodeID& hn : phg.nodes() ) {
+      ASSERT_GE(phg.partID(hn), 0);
+      ASSERT_LT(phg.partID(hn), c.partition.k);
+    }
+    ASSERT_TRUE(metrics::isBalanced(phg, c));
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(APortfolio, ComputesAValidPartition) {
+  Context c(context);
+  PartitionedHypergraph phg = partition(c);
+  verifyPartition(phg, c);
+}
+
+TEST_F(APortfolio, IsDeterministicForAFixedSeed) {
+  Context c_1(context);
+  Context c_2(context);
+  PartitionedHypergraph phg_1 = partition(c_1);
+  PartitionedHypergraph phg_2 = partition(c_2);
+  ASSERT_EQ(metrics::quality(phg_1, c_1), metrics::quality(phg_2, c_2));
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(phg_1.partID(hn), phg_2.partID(hn));
+  }
+}
+
+TEST_F(APortfolio, ForwardsTheProgressOfAllRunsToTheProgressCallback) {
+  Context c(context);
+  std::vector<mt_kahypar_progress_t> progress;
+  c.partition.progress_callback = [](const mt_kahypar_progress_t* p, void* data) {
+    static_cast<std::vector<mt_kahypar_progress_t>*>(data)->push_back(*p);
+  };
+  c.partition.progress_callback_data = &progress;
+  partition(c);
+  // Each run reports its initial partition
+  ASSERT_EQ(2, std::count_if(progress.begin(), progress.end(), [](const mt_kahypar_progress_t& p) {
+    return p.phase == PROGRESS_INITIAL_PARTITIONING;
+  }));
+}
+
+TEST_F(APortfolio, RecombinesTwoPartitionsIntoAPartitionThatIsAtLeastAsGoodAsTheBetterParent) {
+  context.partition.portfolio_runs = 1;
+  context.shared_memory.num_threads = 1;
+  context.shared_memory.original_num_threads = 1;
+  Context c_1(context);
+  Context c_2(context);
+  c_2.partition.seed = 43;
+  PartitionedHypergraph parent_1 = partition(c_1);
+  PartitionedHypergraph parent_2 = partition(c_2);
+  verifyPartition(parent_1, c_1);
+  verifyPartition(parent_2, c_2);
+  if ( metrics::quality(parent_2, c_2) < metrics::quality(parent_1, c_1) ) {
+    std::swap(parent_1, parent_2);
+  }
+
+  vec<PartitionID> partition_1(hypergraph.initialNumNodes());
+  vec<PartitionID> partition_2(hypergraph.initialNumNodes());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    partition_1[hn] = parent_1.partID(hn);
+    partition_2[hn] = parent_2.partID(hn);
+  }
+  Hypergraph offspring_hg = hypergraph.copy();
+  PartitionedHypergraph offspring = Multilevel<TypeTraits>::recombine(
+    offspring_hg, partition_1, partition_2, c_1);
+  verifyPartition(offspring, c_1);
+  ASSERT_LE(metrics::quality(offspring, c_1), metrics::quality(parent_1, c_1));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include <cstdio>
+#include <sstream>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/community_cache.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar::community_detection {
+
+namespace {
+  using Hypergraph = ds::StaticHypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+}
+
+class ACommunityCache : public Test {
+
+ public:
+  ACommunityCache() :
+    context(),
+    hypergraph(HypergraphFactory::construct(
+      7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} })) {
+    context.preprocessing.community_cache_dir = ".";
+    context.preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::uniform;
+    context.preprocessing.community_detection.max_pass_iterations = 5;
+    hypergraph.setCommunityIDs(ds::Clustering { 0, 0, 1, 0, 0, 1, 1 });
+  }
+
+  ~ACommunityCache() {
+    std::remove(cacheFile().c_str());
+  }
+
+  std::string cacheFile() const {
+    std::stringstream ss;
+    ss << "./" << std::hex << fingerprint(hypergraph) << "_" << parameterHash(context) << ".community";
+    return ss.str();
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(ACommunityCache, ComputesTheSameFingerprintForTheSameHypergraph) {
+  Hypergraph other = HypergraphFactory::construct(
+    7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  ASSERT_EQ(fingerprint(hypergraph), fingerprint(other));
+}
+
+TEST_F(ACommunityCache, ComputesDifferentFingerprintsForDifferentHypergraphs) {
+  Hypergraph other = HypergraphFactory::construct(
+    7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 5}, {2, 5, 6} });
+  ASSERT_NE(fingerprint(hypergraph), fingerprint(other));
+  hypergraph.setEdgeWeight(0, 2);
+  other = HypergraphFactory::construct(
+    7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  ASSERT_NE(fingerprint(hypergraph), fingerprint(other));
+}
+
+TEST_F(ACommunityCache, LoadsCachedCommunities) {
+  cacheCommunities(hypergraph, context);
+  Hypergraph other = HypergraphFactory::construct(
+    7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  ASSERT_TRUE(loadCachedCommunities(other, context));
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(hypergraph.communityID(hn), other.communityID(hn));
+  }
+}
+
+TEST_F(ACommunityCache, DoesNotLoadCommunitiesComputedWithDifferentParameters) {
+  cacheCommunities(hypergraph, context);
+  Hypergraph other = HypergraphFactory::construct(
+    7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  context.preprocessing.community_detection.max_pass_iterations = 10;
+  ASSERT_FALSE(loadCachedCommunities(other, context));
+  context.preprocessing.community_detection.max_pass_iterations = 5;
+  ASSERT_TRUE(loadCachedCommunities(other, context));
+}
+
+TEST_F(ACommunityCache, DoesNotLoadCommunitiesOfAnotherHypergraph) {
+  cacheCommunities(hypergraph, context);
+  Hypergraph other = HypergraphFactory::construct(
+    7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 5}, {2, 5, 6} });
+  ASSERT_FALSE(loadCachedCommunities(other, context));
+}
+
+}  // namespace mt_kahypar::community_detection
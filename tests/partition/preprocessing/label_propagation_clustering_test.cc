@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/graph.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/label_propagation_clustering.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar::community_detection {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+}
+
+class ALabelPropagationClustering : public Test {
+
+ public:
+  ALabelPropagationClustering() :
+    context(),
+    karate_club_hg() {
+    context.partition.graph_filename = "../tests/instances/karate_club.graph.hgr";
+    context.preprocessing.community_detection.max_pass_iterations = 100;
+    context.preprocessing.community_detection.min_vertex_move_fraction = 0.0001;
+    context.shared_memory.num_threads = 1;
+    karate_club_hg = io::readInputFile<Hypergraph>(
+      context.partition.graph_filename, FileFormat::hMetis, true);
+  }
+
+  ds::Clustering runSequential(const Hypergraph& hypergraph) {
+    tbb::task_arena sequential_arena(1);
+    ds::Clustering communities(0);
+    sequential_arena.execute([&] {
+      communities = run_label_propagation_clustering(hypergraph, context, true);
+    });
+    return communities;
+  }
+
+  Context context;
+  Hypergraph karate_club_hg;
+};
+
+TEST_F(ALabelPropagationClustering, SeparatesDisconnectedCliques) {
+  Hypergraph hypergraph = HypergraphFactory::construct(
+    6, 4, { {0, 1, 2}, {0, 1}, {3, 4, 5}, {4, 5} });
+  context.partition.max_part_weights = { 6, 6 };
+  ds::Clustering communities = runSequential(hypergraph);
+
+  ASSERT_EQ(communities[0], communities[1]);
+  ASSERT_EQ(communities[0], communities[2]);
+  ASSERT_EQ(communities[3], communities[4]);
+  ASSERT_EQ(communities[3], communities[5]);
+  ASSERT_NE(communities[0], communities[3]);
+}
+
+TEST_F(ALabelPropagationClustering, RespectsTheMaximumClusterWeight) {
+  context.partition.max_part_weights = { 5, 8 };
+  ds::Clustering communities = runSequential(karate_club_hg);
+
+  vec<HypernodeWeight> cluster_weights(karate_club_hg.initialNumNodes(), 0);
+  for ( const HypernodeID& hn : karate_club_hg.nodes() ) {
+    cluster_weights[communities[hn]] += karate_club_hg.nodeWeight(hn);
+  }
+  for ( const HypernodeWeight weight : cluster_weights ) {
+    ASSERT_LE(weight, 5);
+  }
+}
+
+TEST_F(ALabelPropagationClustering, ComputesCommunitiesOnTheKarateClub) {
+  context.partition.max_part_weights = { 17, 17 };
+  ds::Clustering communities = runSequential(karate_club_hg);
+
+  Graph<Hypergraph> graph(karate_club_hg, LouvainEdgeWeight::uniform, true);
+  ASSERT_GT(metrics::modularity(graph, communities), 0.3);
+}
+
+}  // namespace mt_kahypar
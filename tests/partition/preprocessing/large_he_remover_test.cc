@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+}
+
+class ALargeHyperedgeRemover : public Test {
+
+ public:
+  ALargeHyperedgeRemover() :
+    context(),
+    hypergraph(HypergraphFactory::construct(
+      7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} })) {
+    context.partition.k = 2;
+    context.partition.objective = Objective::km1;
+    context.partition.large_hyperedge_size_threshold = 2;
+    context.partition.smallest_large_he_size_threshold = 0;
+    context.partition.verbose_output = false;
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(ALargeHyperedgeRemover, KeepsLargeHyperedgesIfDisabled) {
+  context.partition.remove_large_hyperedges = false;
+  LargeHyperedgeRemover<TypeTraits> remover(context);
+  ASSERT_EQ(0, remover.removeLargeHyperedges(hypergraph));
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    ASSERT_TRUE(hypergraph.edgeIsEnabled(he));
+  }
+}
+
+TEST_F(ALargeHyperedgeRemover, RemovesLargeHyperedges) {
+  context.partition.remove_large_hyperedges = true;
+  LargeHyperedgeRemover<TypeTraits> remover(context);
+  ASSERT_EQ(3, remover.removeLargeHyperedges(hypergraph));
+  ASSERT_TRUE(hypergraph.edgeIsEnabled(0));
+  ASSERT_FALSE(hypergraph.edgeIsEnabled(1));
+  ASSERT_FALSE(hypergraph.edgeIsEnabled(2));
+  ASSERT_FALSE(hypergraph.edgeIsEnabled(3));
+  ASSERT_EQ(1, hypergraph.nodeDegree(0));
+  ASSERT_EQ(0, hypergraph.nodeDegree(4));
+  ASSERT_EQ(0, hypergraph.nodeDegree(6));
+}
+
+TEST_F(ALargeHyperedgeRemover, RestoresLargeHyperedges) {
+  context.partition.remove_large_hyperedges = true;
+  LargeHyperedgeRemover<TypeTraits> remover(context);
+  remover.removeLargeHyperedges(hypergraph);
+
+  PartitionedHypergraph phg(context.partition.k, hypergraph, parallel_tag_t());
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    phg.setOnlyNodePart(hn, hn < 4 ? 0 : 1);
+  }
+  phg.initializePartition();
+  ASSERT_EQ(0, metrics::quality(phg, Objective::km1));
+
+  remover.restoreLargeHyperedges(phg);
+  for ( const HyperedgeID& he : phg.edges() ) {
+    ASSERT_TRUE(phg.edgeIsEnabled(he));
+  }
+  ASSERT_EQ(2, phg.nodeDegree(0));
+  ASSERT_EQ(2, phg.nodeDegree(4));
+  ASSERT_EQ(2, phg.nodeDegree(6));
+  ASSERT_EQ(3, phg.pinCountInPart(1, 0));
+  ASSERT_EQ(1, phg.pinCountInPart(1, 1));
+  ASSERT_EQ(3, metrics::quality(phg, Objective::km1));
+}
+
+}  // namespace mt_kahypar
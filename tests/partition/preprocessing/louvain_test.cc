@@ -203,4 +203,125 @@ TEST_F(ALouvain, KarateClubTest) {
             metrics::modularity(*karate_club_graph, expected_comm));
 }
 
+TEST_F(ALouvain, AssignsNodesWithOneNeighborToTheCommunityOfTheirNeighbor) {
+  context.preprocessing.community_detection.vertex_following = true;
+  ds::Clustering communities = run_parallel_louvain(*karate_club_graph, context, true);
+
+  karate_club_graph = std::make_unique<Graph<Hypergraph>>(
+    karate_club_hg, LouvainEdgeWeight::uniform, true);
+  for ( const NodeID u : karate_club_graph->nodes() ) {
+    if ( karate_club_graph->degree(u) == 1 ) {
+      const NodeID v = karate_club_graph->arcsOf(u).begin()->head;
+      ASSERT_EQ(communities[v], communities[u]);
+    }
+  }
+}
+
+TEST_F(ALouvain, ComputesCommunitiesWithAnActiveNodeSet) {
+  context.preprocessing.community_detection.use_active_node_set = true;
+  ds::Clustering communities = run_parallel_louvain(*karate_club_graph, context, true);
+  ds::Clustering expected_comm = { 1, 1, 1, 1, 0, 0, 0, 1, 3, 1, 0, 1, 1, 1, 3, 3, 0, 1,
+                                   3, 1, 3, 1, 3, 2, 2, 2, 3, 2, 2, 3, 3, 2, 3, 3 };
+
+  karate_club_graph = std::make_unique<Graph<Hypergraph>>(
+    karate_club_hg, LouvainEdgeWeight::uniform, true);
+  ASSERT_GE(metrics::modularity(*karate_club_graph, communities),
+            0.95 * metrics::modularity(*karate_club_graph, expected_comm));
+}
+
+TEST_F(ALouvain, ComputesCommunitiesWithThreadLocalVolumeUpdates) {
+  context.preprocessing.community_detection.volume_update_sub_rounds = 4;
+  ds::Clustering communities = run_parallel_louvain(*karate_club_graph, context, true);
+  ds::Clustering expected_comm = { 1, 1, 1, 1, 0, 0, 0, 1, 3, 1, 0, 1, 1, 1, 3, 3, 0, 1,
+                                   3, 1, 3, 1, 3, 2, 2, 2, 3, 2, 2, 3, 3, 2, 3, 3 };
+
+  karate_club_graph = std::make_unique<Graph<Hypergraph>>(
+    karate_club_hg, LouvainEdgeWeight::uniform, true);
+  ASSERT_GE(metrics::modularity(*karate_club_graph, communities),
+            0.95 * metrics::modularity(*karate_club_graph, expected_comm));
+}
+
+TEST_F(ALouvain, HasSameArcsOnBipartiteGraphViewAsOnMaterializedGraph) {
+  BipartiteGraphView<Hypergraph> view(hypergraph, LouvainEdgeWeight::non_uniform);
+  Graph<Hypergraph> bipartite_graph(hypergraph, LouvainEdgeWeight::non_uniform);
+  ASSERT_EQ(bipartite_graph.numNodes(), view.numNodes());
+  ASSERT_EQ(bipartite_graph.numArcs(), view.numArcs());
+  ASSERT_EQ(bipartite_graph.max_degree(), view.max_degree());
+  ASSERT_DOUBLE_EQ(bipartite_graph.totalVolume(), view.totalVolume());
+  for ( const NodeID u : view.nodes() ) {
+    ASSERT_EQ(bipartite_graph.degree(u), view.degree(u));
+    ASSERT_DOUBLE_EQ(bipartite_graph.nodeVolume(u), view.nodeVolume(u));
+    std::vector<std::pair<NodeID, ArcWeight>> expected_arcs;
+    for ( const Arc& arc : bipartite_graph.arcsOf(u) ) {
+      expected_arcs.emplace_back(arc.head, arc.weight);
+    }
+    std::vector<std::pair<NodeID, ArcWeight>> actual_arcs;
+    for ( const Arc& arc : view.arcsOf(u) ) {
+      actual_arcs.emplace_back(arc.head, arc.weight);
+    }
+    std::sort(expected_arcs.begin(), expected_arcs.end());
+    std::sort(actual_arcs.begin(), actual_arcs.end());
+    ASSERT_EQ(expected_arcs, actual_arcs);
+  }
+}
+
+TEST_F(ALouvain, ContractsIntoTheMemoryOfARecycledGraph) {
+  Graph<Hypergraph> fine_graph(karate_club_hg, LouvainEdgeWeight::uniform, true);
+  Graph<Hypergraph> recycled_graph(karate_club_hg, LouvainEdgeWeight::uniform, true);
+  ds::Clustering first_level(fine_graph.numNodes());
+  for ( const NodeID u : fine_graph.nodes() ) {
+    first_level[u] = u / 2;
+  }
+  Graph<Hypergraph> graph = fine_graph.contract_low_memory(first_level);
+
+  ds::Clustering second_level(graph.numNodes());
+  for ( const NodeID u : graph.nodes() ) {
+    second_level[u] = u / 3;
+  }
+  ds::Clustering second_level_copy = second_level;
+  Graph<Hypergraph> expected = graph.contract_low_memory(second_level);
+  Graph<Hypergraph> actual = graph.contract_low_memory(second_level_copy, recycled_graph);
+  ASSERT_FALSE(recycled_graph.canBeUsed(false));
+  ASSERT_TRUE(actual.canBeUsed());
+
+  ASSERT_EQ(second_level, second_level_copy);
+  ASSERT_EQ(expected.numNodes(), actual.numNodes());
+  ASSERT_EQ(expected.numArcs(), actual.numArcs());
+  ASSERT_EQ(expected.max_degree(), actual.max_degree());
+  ASSERT_DOUBLE_EQ(expected.totalVolume(), actual.totalVolume());
+  for ( const NodeID u : expected.nodes() ) {
+    ASSERT_EQ(expected.degree(u), actual.degree(u));
+    ASSERT_DOUBLE_EQ(expected.nodeVolume(u), actual.nodeVolume(u));
+    auto actual_arc = actual.arcsOf(u).begin();
+    for ( const Arc& arc : expected.arcsOf(u) ) {
+      ASSERT_EQ(arc.head, actual_arc->head);
+      ASSERT_DOUBLE_EQ(arc.weight, actual_arc->weight);
+      ++actual_arc;
+    }
+  }
+}
+
+TEST_F(ALouvain, KeepsTheInputGraphUsableWithLowMemoryContraction) {
+  context.preprocessing.community_detection.low_memory_contraction = true;
+  const size_t num_nodes = karate_club_graph->numNodes();
+  const size_t num_arcs = karate_club_graph->numArcs();
+  ds::Clustering first = run_parallel_louvain(*karate_club_graph, context, true);
+  ASSERT_TRUE(karate_club_graph->canBeUsed());
+  ASSERT_EQ(num_nodes, karate_club_graph->numNodes());
+  ASSERT_EQ(num_arcs, karate_club_graph->numArcs());
+  ds::Clustering second = run_parallel_louvain(*karate_club_graph, context, true);
+  ASSERT_EQ(first, second);
+}
+
+TEST_F(ALouvain, ComputesSameCommunitiesOnBipartiteGraphViewAsOnMaterializedGraph) {
+  context.preprocessing.community_detection.low_memory_contraction = true;
+  ds::Clustering expected_comm = run_parallel_louvain(*graph, context, true);
+
+  BipartiteGraphView<Hypergraph> view(hypergraph, LouvainEdgeWeight::uniform);
+  ds::Clustering communities = run_parallel_louvain(view, context, true);
+  ASSERT_EQ(expected_comm, communities);
+  ASSERT_DOUBLE_EQ(metrics::modularity(view, expected_comm),
+                   metrics::modularity(view, communities));
+}
+
 }  // namespace mt_kahypar
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/preprocessing/reordering/node_reordering.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+}
+
+class ANodeReordering : public Test {
+
+ public:
+  ANodeReordering() :
+    context(),
+    hypergraph(HypergraphFactory::construct(
+      7, 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} })) {
+    context.partition.k = 2;
+    context.partition.objective = Objective::km1;
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(ANodeReordering, ComputesBreadthFirstSearchOrder) {
+  vec<HyperedgeID> net_order;
+  vec<HypernodeID> new_node_id = NodeReordering<TypeTraits>::computeOrder(
+    hypergraph, std::numeric_limits<HypernodeID>::max(), &net_order);
+  ASSERT_EQ(vec<HypernodeID>({ 1, 0, 4, 2, 3, 6, 5 }), new_node_id);
+  ASSERT_EQ(vec<HyperedgeID>({ 1, 0, 2, 3 }), net_order);
+}
+
+TEST_F(ANodeReordering, DoesNotExpandLargeNets) {
+  vec<HypernodeID> new_node_id = NodeReordering<TypeTraits>::computeOrder(hypergraph, 3);
+  ASSERT_EQ(vec<HypernodeID>({ 4, 0, 2, 5, 6, 1, 3 }), new_node_id);
+}
+
+TEST_F(ANodeReordering, ReordersHypergraph) {
+  NodeReordering<TypeTraits> reordering(context);
+  Hypergraph reordered_hypergraph = reordering.reorder(hypergraph);
+  ASSERT_EQ(hypergraph.initialNumNodes(), reordered_hypergraph.initialNumNodes());
+  ASSERT_EQ(hypergraph.initialNumEdges(), reordered_hypergraph.initialNumEdges());
+  ASSERT_EQ(hypergraph.initialNumPins(), reordered_hypergraph.initialNumPins());
+  ASSERT_EQ(4, reordered_hypergraph.edgeSize(0));
+  ASSERT_EQ(2, reordered_hypergraph.edgeSize(1));
+  ASSERT_EQ(3, reordered_hypergraph.edgeSize(2));
+  ASSERT_EQ(3, reordered_hypergraph.edgeSize(3));
+}
+
+TEST_F(ANodeReordering, ProjectsPartitionToInputHypergraph) {
+  NodeReordering<TypeTraits> reordering(context);
+  Hypergraph reordered_hypergraph = reordering.reorder(hypergraph);
+  PartitionedHypergraph reordered_phg(context.partition.k, reordered_hypergraph, parallel_tag_t());
+  for ( const HypernodeID& hn : reordered_hypergraph.nodes() ) {
+    reordered_phg.setOnlyNodePart(hn, hn < 4 ? 0 : 1);
+  }
+  reordered_phg.initializePartition();
+
+  PartitionedHypergraph phg(context.partition.k, hypergraph, parallel_tag_t());
+  reordering.projectPartition(reordered_phg, phg);
+  ASSERT_EQ(metrics::quality(reordered_phg, Objective::km1), metrics::quality(phg, Objective::km1));
+  ASSERT_EQ(reordered_phg.partWeight(0), phg.partWeight(0));
+  ASSERT_EQ(0, phg.partID(1));
+  ASSERT_EQ(1, phg.partID(5));
+}
+
+}  // namespace mt_kahypar
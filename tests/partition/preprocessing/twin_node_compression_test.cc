@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/preprocessing/sparsification/twin_node_compression.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using HypergraphFactory = typename Hypergraph::Factory;
+}
+
+class ATwinNodeCompression : public Test {
+
+ public:
+  ATwinNodeCompression() :
+    context(),
+    hypergraph(HypergraphFactory::construct(
+      8, 4, { {0, 1, 2}, {1, 0, 3}, {3, 4, 5}, {5, 4, 6} })) {
+    context.partition.k = 2;
+    context.partition.objective = Objective::km1;
+    context.coarsening.max_allowed_node_weight = 10;
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+};
+
+TEST_F(ATwinNodeCompression, DetectsTwins) {
+  parallel::scalable_vector<HypernodeID> mapping =
+    TwinNodeCompression<TypeTraits>::computeTwinMapping(hypergraph, 10);
+  ASSERT_EQ(parallel::scalable_vector<HypernodeID>({ 0, 0, 2, 3, 4, 4, 6, 7 }), mapping);
+}
+
+TEST_F(ATwinNodeCompression, RespectsMaximumNodeWeight) {
+  parallel::scalable_vector<HypernodeID> mapping =
+    TwinNodeCompression<TypeTraits>::computeTwinMapping(hypergraph, 1);
+  ASSERT_EQ(parallel::scalable_vector<HypernodeID>({ 0, 1, 2, 3, 4, 5, 6, 7 }), mapping);
+}
+
+TEST_F(ATwinNodeCompression, ContractsTwinsIntoWeightedNodes) {
+  TwinNodeCompression<TypeTraits> compression(context);
+  Hypergraph compressed_hypergraph = compression.compress(hypergraph);
+  ASSERT_EQ(6, compressed_hypergraph.initialNumNodes());
+  ASSERT_EQ(2, compression.numRemovedNodes());
+  ASSERT_EQ(hypergraph.totalWeight(), compressed_hypergraph.totalWeight());
+  ASSERT_EQ(4, compressed_hypergraph.initialNumEdges());
+  ASSERT_EQ(8, compressed_hypergraph.initialNumPins());
+}
+
+TEST_F(ATwinNodeCompression, ExpandsPartitionToInputHypergraph) {
+  TwinNodeCompression<TypeTraits> compression(context);
+  Hypergraph compressed_hypergraph = compression.compress(hypergraph);
+  PartitionedHypergraph compressed_phg(context.partition.k, compressed_hypergraph, parallel_tag_t());
+  for ( const HypernodeID& hn : compressed_hypergraph.nodes() ) {
+    compressed_phg.setOnlyNodePart(hn, hn < 3 ? 0 : 1);
+  }
+  compressed_phg.initializePartition();
+
+  PartitionedHypergraph phg(context.partition.k, hypergraph, parallel_tag_t());
+  compression.projectPartition(compressed_phg, phg);
+  ASSERT_EQ(metrics::quality(compressed_phg, Objective::km1), metrics::quality(phg, Objective::km1));
+  ASSERT_EQ(compressed_phg.partWeight(0), phg.partWeight(0));
+  ASSERT_EQ(phg.partID(0), phg.partID(1));
+  ASSERT_EQ(phg.partID(4), phg.partID(5));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <algorithm>
+
+#include "mt-kahypar/partition/preset_selection.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class APresetSelection : public Test {
+
+ public:
+  APresetSelection() :
+    stats(),
+    context() {
+    // Default preset on one thread: 4e-7 * (1000000 + 100000) = 0.44s,
+    // quality = 0.66s and highest_quality = 1.32s
+    stats.num_nodes = 100000;
+    stats.num_edges = 100000;
+    stats.num_pins = 1000000;
+    stats.max_edge_size = 10;
+    stats.avg_edge_size = 10.0;
+    context.partition.k = 2;
+    context.partition.instance_type = InstanceType::hypergraph;
+    context.shared_memory.num_threads = 1;
+  }
+
+  PresetSelection select(const bool allow_instance_type_change = false) const {
+    return preset_selection::select(stats, context, allow_instance_type_change);
+  }
+
+  static bool hasReason(const PresetSelection& selection, const std::string& reason) {
+    return std::any_of(selection.reasons.begin(), selection.reasons.end(),
+      [&](const std::string& r) { return r.find(reason) != std::string::npos; });
+  }
+
+  InstanceStatistics stats;
+  Context context;
+};
+
+TEST_F(APresetSelection, EstimatesTheRunningTimeOfThePresets) {
+  ASSERT_DOUBLE_EQ(0.44, preset_selection::estimatedRunningTime(stats, PresetType::default_preset, 2, 1));
+  ASSERT_DOUBLE_EQ(0.44, preset_selection::estimatedRunningTime(stats, PresetType::deterministic, 2, 1));
+  ASSERT_DOUBLE_EQ(0.22, preset_selection::estimatedRunningTime(stats, PresetType::large_k, 2, 1));
+  ASSERT_DOUBLE_EQ(0.66, preset_selection::estimatedRunningTime(stats, PresetType::quality, 2, 1));
+  ASSERT_DOUBLE_EQ(1.32, preset_selection::estimatedRunningTime(stats, PresetType::highest_quality, 2, 1));
+}
+
+TEST_F(APresetSelection, ScalesTheEstimatedRunningTimeWithKAndTheNumberOfThreads) {
+  const double time = preset_selection::estimatedRunningTime(stats, PresetType::default_preset, 2, 1);
+  // One recursion level per factor of two
+  ASSERT_DOUBLE_EQ(3 * time, preset_selection::estimatedRunningTime(stats, PresetType::default_preset, 8, 1));
+  ASSERT_DOUBLE_EQ(time, preset_selection::estimatedRunningTime(stats, PresetType::default_preset, 1, 1));
+  // Parallel efficiency of 0.6
+  ASSERT_DOUBLE_EQ(time / 6, preset_selection::estimatedRunningTime(stats, PresetType::default_preset, 2, 10));
+  ASSERT_DOUBLE_EQ(time, preset_selection::estimatedRunningTime(stats, PresetType::default_preset, 2, 0));
+}
+
+TEST_F(APresetSelection, SelectsQualityForSmallInputsWithoutTimeLimit) {
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_EQ(Mode::direct, selection.mode);
+  ASSERT_EQ(InstanceType::hypergraph, selection.instance_type);
+  ASSERT_TRUE(hasReason(selection, "quality is affordable"));
+}
+
+TEST_F(APresetSelection, SelectsQualityForInputsWithExactlyTheQualityPinThreshold) {
+  stats.num_pins = 10000000;
+  ASSERT_EQ(PresetType::quality, select().preset);
+}
+
+TEST_F(APresetSelection, SelectsDefaultForLargeInputsWithoutTimeLimit) {
+  stats.num_pins = 10000001;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::default_preset, selection.preset);
+  ASSERT_TRUE(hasReason(selection, "=> default"));
+}
+
+TEST_F(APresetSelection, SelectsQualityForLargeMeshGraphsWithoutTimeLimit) {
+  stats.num_pins = 100000000;
+  stats.is_graph = true;
+  stats.is_mesh_graph = true;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_TRUE(hasReason(selection, "mesh-like graph"));
+}
+
+TEST_F(APresetSelection, SelectsDefaultForVeryLargeMeshGraphsWithoutTimeLimit) {
+  stats.num_pins = 100000001;
+  stats.is_graph = true;
+  stats.is_mesh_graph = true;
+  ASSERT_EQ(PresetType::default_preset, select().preset);
+}
+
+TEST_F(APresetSelection, SelectsDefaultForLargeGraphsThatAreNoMeshes) {
+  stats.num_pins = 100000000;
+  stats.is_graph = true;
+  ASSERT_EQ(PresetType::default_preset, select().preset);
+}
+
+#ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+TEST_F(APresetSelection, SelectsHighestQualityIfItFitsIntoTheTimeLimit) {
+  context.partition.time_limit = 3.0;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::highest_quality, selection.preset);
+  ASSERT_TRUE(hasReason(selection, "highest_quality fits into the time limit"));
+}
+
+TEST_F(APresetSelection, DoesNotSelectHighestQualityForVeryLargeInputs) {
+  context.partition.time_limit = 1000000.0;
+  stats.num_pins = 100000001;
+  ASSERT_EQ(PresetType::quality, select().preset);
+}
+
+TEST_F(APresetSelection, DoesNotSelectHighestQualityInDeepMultilevelMode) {
+  context.partition.time_limit = 3.0;
+  context.partition.mode = Mode::deep_multilevel;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_EQ(Mode::deep_multilevel, selection.mode);
+}
+
+TEST_F(APresetSelection, DoesNotSelectHighestQualityIfThereAreManyLargeHyperedges) {
+  context.partition.time_limit = 3.0;
+  stats.max_edge_size = 2000;
+  stats.num_large_edges = 1001;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_TRUE(hasReason(selection, "no n-level coarsening"));
+}
+
+TEST_F(APresetSelection, SelectsHighestQualityIfThereAreFewLargeHyperedges) {
+  context.partition.time_limit = 3.0;
+  stats.max_edge_size = 2000;
+  stats.num_large_edges = 1000;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::highest_quality, selection.preset);
+  ASSERT_FALSE(hasReason(selection, "no n-level coarsening"));
+}
+#endif
+
+TEST_F(APresetSelection, OnlyReportsLargeHyperedgesIfHighestQualityWasACandidate) {
+  stats.max_edge_size = 2000;
+  stats.num_large_edges = 1001;
+  // Without a time limit, highest_quality is never selected
+  PresetSelection selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_FALSE(hasReason(selection, "no n-level coarsening"));
+  // highest_quality does not fit into the time limit
+  context.partition.time_limit = 2.0;
+  selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_FALSE(hasReason(selection, "no n-level coarsening"));
+}
+
+TEST_F(APresetSelection, DowngradesToQualityIfHighestQualityExceedsTheTimeLimit) {
+  context.partition.time_limit = 2.0;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::quality, selection.preset);
+  ASSERT_TRUE(hasReason(selection, "quality fits into the time limit"));
+}
+
+TEST_F(APresetSelection, DowngradesToDefaultIfQualityExceedsTheTimeLimit) {
+  context.partition.time_limit = 1.0;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::default_preset, selection.preset);
+  ASSERT_TRUE(hasReason(selection, "exceeds the time limit"));
+}
+
+TEST_F(APresetSelection, SelectsQualityForLargeInputsIfItFitsIntoTheTimeLimit) {
+  // The pin thresholds are only used without a time limit
+  stats.num_pins = 50000000;
+  context.partition.time_limit = 2.0;
+  context.shared_memory.num_threads = 64;
+  ASSERT_EQ(PresetType::quality, select().preset);
+}
+
+TEST_F(APresetSelection, UsesMoreExpensivePresetsWithMoreThreads) {
+  context.partition.time_limit = 1.0;
+  ASSERT_EQ(PresetType::default_preset, select().preset);
+  context.shared_memory.num_threads = 3;
+  ASSERT_EQ(PresetType::quality, select().preset);
+}
+
+TEST_F(APresetSelection, SelectsDeepMultilevelModeIfThereAreFewNodesPerBlock) {
+  context.partition.k = 313;
+  const PresetSelection selection = select();
+  ASSERT_EQ(Mode::deep_multilevel, selection.mode);
+  ASSERT_TRUE(hasReason(selection, "deep multilevel mode"));
+  context.partition.k = 312;
+  ASSERT_EQ(Mode::direct, select().mode);
+}
+
+TEST_F(APresetSelection, KeepsTheModeOfTheContext) {
+  context.partition.k = 313;
+  context.partition.mode = Mode::recursive_bipartitioning;
+  const PresetSelection selection = select();
+  ASSERT_EQ(Mode::recursive_bipartitioning, selection.mode);
+  ASSERT_FALSE(hasReason(selection, "deep multilevel mode"));
+}
+
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+TEST_F(APresetSelection, SelectsLargeKForManyBlocks) {
+  stats.num_nodes = 10000000;
+  context.partition.k = 1024;
+  context.partition.time_limit = 1000000.0;
+  const PresetSelection selection = select();
+  ASSERT_EQ(PresetType::large_k, selection.preset);
+  ASSERT_EQ(Mode::deep_multilevel, selection.mode);
+}
+#endif
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+TEST_F(APresetSelection, ChangesTheInstanceTypeOfHypergraphsWithOnlyTwoPinNets) {
+  stats.is_graph = true;
+  ASSERT_EQ(InstanceType::hypergraph, select(false).instance_type);
+  const PresetSelection selection = select(true);
+  ASSERT_EQ(InstanceType::graph, selection.instance_type);
+  ASSERT_TRUE(hasReason(selection, "graph data structures"));
+}
+#endif
+
+}  // namespace mt_kahypar
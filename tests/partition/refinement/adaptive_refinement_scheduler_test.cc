@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <chrono>
+#include <thread>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/partition/refinement/adaptive_refinement_scheduler.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class AAdaptiveRefinementScheduler : public Test {
+ public:
+  AAdaptiveRefinementScheduler() :
+    params(),
+    metrics() {
+    params.adaptive_refinement = true;
+    params.adaptive_refinement_min_yield = 0.1;
+    metrics.quality = 1000000;
+  }
+
+  // Label propagation always improves the objective, while flows only consume time
+  void refineLevel(AdaptiveRefinementScheduler& scheduler) {
+    scheduler.nextLevel();
+    scheduler.run(RefinerType::label_propagation, metrics, [&] {
+      metrics.quality -= 100;
+      return true;
+    });
+    scheduler.run(RefinerType::flows, metrics, [&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      return false;
+    });
+  }
+
+  RefinementParameters params;
+  Metrics metrics;
+};
+
+TEST_F(AAdaptiveRefinementScheduler, ExecutesAllRefinersIfDisabled) {
+  params.adaptive_refinement = false;
+  AdaptiveRefinementScheduler scheduler(params);
+  for ( size_t i = 0; i < 5; ++i ) {
+    refineLevel(scheduler);
+    ASSERT_TRUE(scheduler.shouldRun(RefinerType::label_propagation));
+    ASSERT_TRUE(scheduler.shouldRun(RefinerType::flows));
+  }
+}
+
+TEST_F(AAdaptiveRefinementScheduler, SkipsRefinerWithPoorYield) {
+  AdaptiveRefinementScheduler scheduler(params);
+  refineLevel(scheduler);
+  refineLevel(scheduler);
+  ASSERT_TRUE(scheduler.shouldRun(RefinerType::flows));
+  refineLevel(scheduler);
+  ASSERT_TRUE(scheduler.shouldRun(RefinerType::label_propagation));
+  ASSERT_FALSE(scheduler.shouldRun(RefinerType::flows));
+  ASSERT_TRUE(scheduler.shouldRun(RefinerType::fm));
+}
+
+TEST_F(AAdaptiveRefinementScheduler, ExecutesSkippedRefinerAgainAfterSomeLevels) {
+  AdaptiveRefinementScheduler scheduler(params);
+  refineLevel(scheduler);
+  refineLevel(scheduler);
+  size_t num_skipped_levels = 0;
+  for ( size_t i = 0; i < 4; ++i ) {
+    refineLevel(scheduler);
+    num_skipped_levels += !scheduler.shouldRun(RefinerType::flows);
+  }
+  ASSERT_EQ(4, num_skipped_levels);
+  refineLevel(scheduler);
+  ASSERT_TRUE(scheduler.shouldRun(RefinerType::flows));
+  refineLevel(scheduler);
+  ASSERT_FALSE(scheduler.shouldRun(RefinerType::flows));
+}
+
+}  // namespace mt_kahypar
@@ -170,4 +170,40 @@ TYPED_TEST(RebalancerTest, ProducesBalancedResult) {
   }
 }
 
+TYPED_TEST(RebalancerTest, RepairsOutdatedGainsOfQueuedNodes) {
+  // 5 x 4 grid: moving a node changes the gains of its neighbors,
+  // which are still queued with their initial gains
+  const HypernodeID num_rows = 5;
+  const HypernodeID num_cols = 4;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID r = 0; r < num_rows; ++r ) {
+    for ( HypernodeID c = 0; c < num_cols; ++c ) {
+      const HypernodeID u = r * num_cols + c;
+      if ( c + 1 < num_cols ) edges.push_back({ u, u + 1 });
+      if ( r + 1 < num_rows ) edges.push_back({ u, u + num_cols });
+    }
+  }
+  this->constructFromValues(num_rows * num_cols, edges.size(), edges,
+    vec<HypernodeWeight>(num_rows * num_cols, 1));
+  this->setup();
+
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    this->partitioned_hypergraph.setOnlyNodePart(hn, 0);
+  }
+  this->partitioned_hypergraph.initializePartition();
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->rebalancer->initialize(phg);
+
+  Metrics metrics;
+  metrics.quality = metrics::quality(this->partitioned_hypergraph, this->context);
+  metrics.imbalance = metrics::imbalance(this->partitioned_hypergraph, this->context);
+  this->rebalancer->refine(phg, {}, metrics, std::numeric_limits<double>::max());
+
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context), metrics.quality);
+  ASSERT_DOUBLE_EQ(metrics::imbalance(this->partitioned_hypergraph, this->context), metrics.imbalance);
+  for (PartitionID part = 0; part < this->context.partition.k; ++part) {
+    ASSERT_LE(this->partitioned_hypergraph.partWeight(part), this->context.partition.max_part_weights[part]);
+  }
+}
+
 }
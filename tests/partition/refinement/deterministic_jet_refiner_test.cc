@@ -64,6 +64,18 @@ struct TestConfig<k, Objective::cut, rebalancing> {
     static constexpr RebalancingAlgorithm REBALANCER = rebalancing;
 };
 
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+template <PartitionID k, RebalancingAlgorithm rebalancing>
+struct GraphTestConfig {
+    using TypeTraits = StaticGraphTypeTraits;
+    using GainTypes = CutGainForGraphsTypes;
+    using Refiner = DeterministicJetRefiner<GraphAndGainTypes<TypeTraits, GainTypes>>;
+    static constexpr PartitionID K = k;
+    static constexpr Objective OBJECTIVE = Objective::cut;
+    static constexpr RebalancingAlgorithm REBALANCER = rebalancing;
+};
+#endif
+
 template <typename Config>
 class ADeterministicJetRefiner : public Test {
     static size_t num_threads;
@@ -88,11 +100,12 @@ public:
         context.partition.graph_community_filename = "../tests/instances/contracted_ibm01.hgr.community";
         context.partition.mode = Mode::direct;
         context.partition.objective = Config::OBJECTIVE;
-        context.partition.gain_policy = context.partition.objective == Objective::km1 ? GainPolicy::km1 : GainPolicy::cut;
+        context.partition.gain_policy = PartitionedHypergraph::is_graph ? GainPolicy::cut_for_graphs :
+            context.partition.objective == Objective::km1 ? GainPolicy::km1 : GainPolicy::cut;
         context.partition.epsilon = 0.25;
         context.partition.k = Config::K;
         context.partition.preset_type = PresetType::deterministic;
-        context.partition.instance_type = InstanceType::hypergraph;
+        context.partition.instance_type = PartitionedHypergraph::is_graph ? InstanceType::graph : InstanceType::hypergraph;
         context.partition.partition_type = PartitionedHypergraph::TYPE;
         context.partition.verbose_output = false;
 
@@ -113,8 +126,13 @@ public:
 
 
         // Read hypergraph
-        hypergraph = io::readInputFile<Hypergraph>(
-            "../tests/instances/contracted_unweighted_ibm01.hgr", FileFormat::hMetis, true);
+        if constexpr (PartitionedHypergraph::is_graph) {
+            hypergraph = io::readInputFile<Hypergraph>(
+                "../tests/instances/delaunay_n10.graph", FileFormat::Metis, true);
+        } else {
+            hypergraph = io::readInputFile<Hypergraph>(
+                "../tests/instances/contracted_unweighted_ibm01.hgr", FileFormat::hMetis, true);
+        }
         partitioned_hypergraph = PartitionedHypergraph(
             context.partition.k, hypergraph, parallel_tag_t());
         context.setupPartWeights(hypergraph.totalWeight());
@@ -173,6 +191,9 @@ typedef ::testing::Types<
     TestConfig<4, Objective::km1, RebalancingAlgorithm::advanced_rebalancer>,
     TestConfig<8, Objective::km1, RebalancingAlgorithm::deterministic>,
     TestConfig<8, Objective::km1, RebalancingAlgorithm::advanced_rebalancer>
+    ENABLE_GRAPHS(COMMA GraphTestConfig<2 COMMA RebalancingAlgorithm::deterministic>)
+    ENABLE_GRAPHS(COMMA GraphTestConfig<8 COMMA RebalancingAlgorithm::deterministic>)
+    ENABLE_GRAPHS(COMMA GraphTestConfig<8 COMMA RebalancingAlgorithm::advanced_rebalancer>)
 > TestConfigs;
 
 TYPED_TEST_CASE(ADeterministicJetRefiner, TestConfigs);
@@ -203,6 +224,19 @@ TYPED_TEST(ADeterministicJetRefiner, DoesNotWorsenSolutionQuality) {
     ASSERT_LE(this->metrics.quality, objective_before);
 }
 
+TYPED_TEST(ADeterministicJetRefiner, UpdatesMetricsCorrectlyWithInitializedGainCache) {
+    if (TypeParam::REBALANCER == RebalancingAlgorithm::deterministic) {
+        // The deterministic rebalancer does not maintain the gain cache
+        return;
+    }
+    this->gain_cache.initializeGainCache(this->partitioned_hypergraph);
+    HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+    mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+    this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+    ASSERT_LE(this->metrics.quality, objective_before);
+    ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+        this->metrics.quality);
+}
 
 TYPED_TEST(ADeterministicJetRefiner, IncreasesTheNumberOfBlocks) {
     using PartitionedHypergraph = typename TestFixture::PartitionedHypergraph;
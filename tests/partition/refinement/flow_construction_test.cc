@@ -405,4 +405,41 @@ TYPED_TEST(AFlowHypergraphConstructor, ConstructsAFlowHypergraphWithAllHypernode
   verifyFlowProblemStats(expected_prob, actual_prob);
 }
 
+
+TYPED_TEST(AFlowHypergraphConstructor, ComputesSameDistancesFromCutInConsecutiveSearches) {
+  this->context.refinement.flows.determine_distance_from_cut = true;
+  Subhypergraph sub_hg { 0, 1, {0, 1, 3}, {4, 5, 6}, 0, 0, {}, 0 };
+  constructSubhypergraph(this->phg, sub_hg);
+
+  FlowProblem prob = this->constructor->constructFlowHypergraph(
+    this->phg, sub_hg, 0, 1, this->whfc_to_node, this->is_default_construction());
+  const auto distances = this->hfc.cs.border_nodes.distance;
+  ASSERT_EQ(this->flow_hg.numNodes(), distances.size());
+  ASSERT_LT(distances[prob.source], 0);
+  ASSERT_GT(distances[prob.sink], 0);
+  for ( const whfc::Node& u : this->flow_hg.nodeIDs() ) {
+    if ( u != prob.source && u != prob.sink ) {
+      if ( this->phg.partID(this->whfc_to_node[u]) == 0 ) {
+        ASSERT_LT(distances[u], 0);
+        ASSERT_GT(distances[u], distances[prob.source]);
+      } else {
+        ASSERT_GT(distances[u], 0);
+        ASSERT_LT(distances[u], distances[prob.sink]);
+      }
+    }
+  }
+
+  // Run a search on a smaller problem in between
+  Subhypergraph small_sub_hg { 0, 1, {3}, {4}, 0, 0, {}, 0 };
+  constructSubhypergraph(this->phg, small_sub_hg);
+  this->flow_hg.clear();
+  this->constructor->constructFlowHypergraph(this->phg, small_sub_hg,
+    0, 1, this->whfc_to_node, this->is_default_construction());
+
+  this->flow_hg.clear();
+  this->constructor->constructFlowHypergraph(this->phg, sub_hg,
+    0, 1, this->whfc_to_node, this->is_default_construction());
+  ASSERT_EQ(distances, this->hfc.cs.border_nodes.distance);
+}
+
 }
\ No newline at end of file
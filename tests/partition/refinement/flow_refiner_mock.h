@@ -117,6 +117,8 @@ class FlowRefinerMock final : public IFlowRefiner {
     _num_threads = num_threads;
   }
 
+  void memoryConsumptionImpl(utils::MemoryTreeNode*) const override { }
+
   const PartitionID _max_num_blocks;
   size_t _num_threads;
   RefineFunc _refine_func;
@@ -53,8 +53,9 @@ struct AFMStrategy : public Test {
                                      Km1GainCache& gain_cache,
                                      FMSharedData& sd,
                                      BlockPriorityQueue& blockPQ,
-                                     vec<VertexPriorityQueue>& vertexPQs) {
-    Strategy strategy(context, sd, blockPQ, vertexPQs);
+                                     vec<VertexPriorityQueue>& vertexPQs,
+                                     TouchedBlocks& touchedBlocks) {
+    Strategy strategy(context, sd, blockPQ, vertexPQs, touchedBlocks);
 
     Move m;
     vec<Gain> gains;
@@ -101,9 +102,59 @@ TYPED_TEST(AFMStrategy, FindNextMove) {
   FMSharedData sd(hg.initialNumNodes(), false);
   BlockPriorityQueue blockPQ(k);
   vec<VertexPriorityQueue> vertexPQs(k, VertexPriorityQueue(sd.vertexPQHandles.data(), sd.numberOfNodes));
+  TouchedBlocks touchedBlocks(k);
 
-  vec<Gain> gains_cached = this->insertAndExtractAllMoves(phg, context, gain_cache, sd, blockPQ, vertexPQs);
+  vec<Gain> gains_cached = this->insertAndExtractAllMoves(phg, context, gain_cache, sd, blockPQ, vertexPQs, touchedBlocks);
   ASSERT_TRUE(std::is_sorted(gains_cached.begin(), gains_cached.end(), std::greater<Gain>()));
 }
 
+TYPED_TEST(AFMStrategy, ResetsOnlyTouchedBlocks) {
+  PartitionID k = 64;
+  Context context;
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  Hypergraph hg = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  context.setupPartWeights(hg.totalWeight());
+  PartitionedHypergraph phg = PartitionedHypergraph(k, hg);
+  for (PartitionID i = 0; i < k; ++i) {
+    context.partition.max_part_weights[i] = std::numeric_limits<HypernodeWeight>::max();
+  }
+
+  std::mt19937 rng(420);
+  std::uniform_int_distribution<PartitionID> distr(0, k - 1);
+  for (HypernodeID u : hg.nodes()) {
+    phg.setOnlyNodePart(u, distr(rng));
+  }
+  phg.initializePartition();
+  Km1GainCache gain_cache;
+  gain_cache.initializeGainCache(phg);
+
+  FMSharedData sd(hg.initialNumNodes(), false);
+  BlockPriorityQueue blockPQ(k);
+  vec<VertexPriorityQueue> vertexPQs(k, VertexPriorityQueue(sd.vertexPQHandles.data(), sd.numberOfNodes));
+  TouchedBlocks touchedBlocks(k);
+  TypeParam strategy(context, sd, blockPQ, vertexPQs, touchedBlocks);
+
+  // only insert nodes of a few blocks
+  for (HypernodeID u : hg.nodes()) {
+    if (phg.partID(u) < 4) {
+      strategy.insertIntoPQ(phg, gain_cache, u);
+    }
+  }
+  ASSERT_EQ(4, touchedBlocks.blocks.size());
+
+  Move m;
+  ASSERT_TRUE(strategy.findNextMove(phg, gain_cache, m));
+  ASSERT_LT(m.from, 4);
+  ASSERT_LE(blockPQ.size(), 4);
+  strategy.reset();
+
+  ASSERT_TRUE(blockPQ.empty());
+  ASSERT_TRUE(touchedBlocks.blocks.empty());
+  for (PartitionID i = 0; i < k; ++i) {
+    ASSERT_TRUE(vertexPQs[i].empty()) << V(i);
+  }
+}
+
 }
@@ -36,6 +36,7 @@
 #include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
+#include "mt-kahypar/partition/refinement/gains/benefit_aggregation.h"
 #include "mt-kahypar/partition/refinement/gains/gain_cache_ptr.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -174,6 +175,26 @@ class AGainCache : public Test {
     });
   }
 
+  void moveAllNodesAtRandomAsBatch() {
+    if constexpr ( GainCache::supports_batched_updates ) {
+      utils::Randomize& rand = utils::Randomize::instance();
+      was_moved.reset();
+      partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        if ( rand.flipCoin(THREAD_ID) ) {
+          const PartitionID from = partitioned_hg.partID(hn);
+          const PartitionID to = rand.getRandomInt(0, k - 1, THREAD_ID);
+          if ( from != to && was_moved.compare_and_set_to_true(hn) ) {
+            partitioned_hg.changeNodePart(hn, from, to);
+          }
+        }
+      });
+
+      ds::ThreadSafeFastResetFlagArray<> edge_flags(hypergraph.initialNumEdges());
+      recomputeGainCacheEntriesAfterBatch(partitioned_hg, gain_cache,
+        [&](const HypernodeID hn) { return was_moved[hn]; }, edge_flags);
+    }
+  }
+
   void moveAllNodesAtRandomOnDeltaPartition() {
     auto update_delta_gain_cache = [&](const SynchronizedEdgeUpdate& sync_update) {
       delta_gain_cache->deltaGainUpdate(*delta_phg, sync_update);
@@ -364,7 +385,14 @@ class AGainCache : public Test {
 
   bool supportsAdjacentBlocks() const {
     return GainCache::TYPE == GainPolicy::steiner_tree ||
-      GainCache::TYPE == GainPolicy::steiner_tree_for_graphs;
+      GainCache::TYPE == GainPolicy::steiner_tree_for_graphs ||
+      GainCache::TYPE == GainPolicy::km1_sparse;
+  }
+
+  bool deltaGainCacheSupportsAdjacentBlocks() const {
+    // The delta gain cache of the sparse gain cache reports the
+    // adjacent blocks of the shared gain cache
+    return supportsAdjacentBlocks() && GainCache::TYPE != GainPolicy::km1_sparse;
   }
 
   void verifyAdjacentBlocks() {
@@ -391,7 +419,7 @@ class AGainCache : public Test {
   }
 
   void verifyAdjacentBlocksOfDeltaGainCache() {
-    if ( supportsAdjacentBlocks() ) {
+    if ( deltaGainCacheSupportsAdjacentBlocks() ) {
       for ( const HypernodeID& hn : delta_phg->nodes() ) {
         ds::Bitset adjacent_blocks(delta_phg->k());
         ds::StaticBitset adjacent_blocks_view(
@@ -445,7 +473,8 @@ typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, Km1GainTypes>,
                          ENABLE_LARGE_K(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA Km1GainTypes>)
                          ENABLE_LARGE_K(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA CutGainTypes>)
                          ENABLE_LARGE_K(ENABLE_SOED(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SoedGainTypes>))
-                         ENABLE_LARGE_K(ENABLE_STEINER_TREE(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SteinerTreeGainTypes>))> TestConfigs;
+                         ENABLE_LARGE_K(ENABLE_STEINER_TREE(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SteinerTreeGainTypes>))
+                         ENABLE_LARGE_K(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SparseKm1GainTypes>)> TestConfigs;
 
 TYPED_TEST_SUITE(AGainCache, TestConfigs);
 
@@ -462,6 +491,13 @@ TYPED_TEST(AGainCache, HasCorrectGainsAfterMovingAllNodesAtRandom) {
   this->verifyGainCacheEntries();
 }
 
+TYPED_TEST(AGainCache, HasCorrectGainsAfterApplyingABatchOfMovesWithoutDeltaGainUpdates) {
+  this->initializePartition();
+  this->gain_cache.initializeGainCache(this->partitioned_hg);
+  this->moveAllNodesAtRandomAsBatch();
+  this->verifyGainCacheEntries();
+}
+
 TYPED_TEST(AGainCache, HasCorrectGainsAfterMovingAllNodesOnDeltaPartitionAtRandom) {
   this->initializePartition();
   this->gain_cache.initializeGainCache(this->partitioned_hg);
@@ -512,4 +548,195 @@ TYPED_TEST(AGainCache, HasCorrectGainsAfterNLevelUncontractionWithLocalizedRefin
 
 #endif
 
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+
+TEST(ASparseKm1GainCache, HasCorrectGainsForAllBlocksAfterMovingNodesAtRandom) {
+  using Hypergraph = typename LargeKHypergraphTypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename LargeKHypergraphTypeTraits::PartitionedHypergraph;
+  // For large k, most nodes store their benefit terms in a hash table
+  const PartitionID k = 128;
+  Hypergraph hypergraph = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_unweighted_ibm01.hgr", FileFormat::hMetis, true);
+  PartitionedHypergraph partitioned_hg(k, hypergraph, parallel_tag_t { });
+  utils::Randomize& rand = utils::Randomize::instance();
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    partitioned_hg.setOnlyNodePart(hn, rand.getRandomInt(0, k - 1, THREAD_ID));
+  }
+  partitioned_hg.initializePartition();
+
+  SparseKm1GainCache gain_cache;
+  gain_cache.initializeGainCache(partitioned_hg);
+  size_t num_sparse_nodes = 0;
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    num_sparse_nodes += !gain_cache.isDense(hn);
+  }
+  ASSERT_GT(num_sparse_nodes, 0);
+
+  ds::ThreadSafeFastResetFlagArray<> was_moved(hypergraph.initialNumNodes());
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    if ( rand.flipCoin(THREAD_ID) ) {
+      const PartitionID from = partitioned_hg.partID(hn);
+      const PartitionID to = rand.getRandomInt(0, k - 1, THREAD_ID);
+      if ( from != to && was_moved.compare_and_set_to_true(hn) ) {
+        partitioned_hg.changeNodePart(gain_cache, hn, from, to);
+      }
+    }
+  });
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    if ( was_moved[hn] ) {
+      gain_cache.recomputeInvalidTerms(partitioned_hg, hn);
+    }
+  });
+
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    ASSERT_EQ(gain_cache.recomputePenaltyTerm(partitioned_hg, hn),
+      gain_cache.penaltyTerm(hn, partitioned_hg.partID(hn))) << V(hn);
+    PartitionID num_adjacent_blocks = 0;
+    for ( PartitionID block = 0; block < k; ++block ) {
+      const HyperedgeWeight expected_benefit =
+        gain_cache.recomputeBenefitTerm(partitioned_hg, hn, block);
+      ASSERT_EQ(expected_benefit, gain_cache.benefitTerm(hn, block)) << V(hn) << V(block);
+      ASSERT_EQ(expected_benefit > 0, gain_cache.blockIsAdjacent(hn, block)) << V(hn) << V(block);
+      num_adjacent_blocks += expected_benefit > 0;
+    }
+    PartitionID num_reported_blocks = 0;
+    for ( const PartitionID block : gain_cache.adjacentBlocks(hn) ) {
+      ASSERT_GT(gain_cache.benefitTerm(hn, block), 0) << V(hn) << V(block);
+      ++num_reported_blocks;
+    }
+    ASSERT_EQ(num_adjacent_blocks, num_reported_blocks) << V(hn);
+  }
+}
+
+#endif
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+
+TEST(AGraphCutGainCache, ComputesCorrectGainsOnTheFlyAfterMovingNodesAtRandom) {
+  using Hypergraph = typename StaticGraphTypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename StaticGraphTypeTraits::PartitionedHypergraph;
+  const PartitionID k = 8;
+  Hypergraph hypergraph = io::readInputFile<Hypergraph>(
+    "../tests/instances/delaunay_n10.graph", FileFormat::Metis, true);
+  PartitionedHypergraph partitioned_hg(k, hypergraph, parallel_tag_t { });
+  std::vector<PartitionID> partition;
+  io::readPartitionFile("../tests/instances/delaunay_n10.graph.part8",
+    hypergraph.initialNumNodes(), partition);
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    partitioned_hg.setOnlyNodePart(hn, partition[hn]);
+  });
+  partitioned_hg.initializePartition();
+
+  // A small factor forces the gain cache to compute gains on the fly
+  GraphCutGainCache gain_cache;
+  gain_cache.setOnTheFlyFactor(0.1);
+  gain_cache.initializeGainCache(partitioned_hg);
+  ASSERT_TRUE(gain_cache.computesOnTheFly());
+
+  utils::Randomize& rand = utils::Randomize::instance();
+  ds::ThreadSafeFastResetFlagArray<> was_moved(hypergraph.initialNumNodes());
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    if ( rand.flipCoin(THREAD_ID) ) {
+      const PartitionID from = partitioned_hg.partID(hn);
+      const PartitionID to = rand.getRandomInt(0, k - 1, THREAD_ID);
+      if ( from != to && was_moved.compare_and_set_to_true(hn) ) {
+        partitioned_hg.changeNodePart(gain_cache, hn, from, to);
+      }
+    }
+  });
+
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    ASSERT_EQ(gain_cache.recomputePenaltyTerm(partitioned_hg, hn),
+      gain_cache.penaltyTerm(hn, partitioned_hg.partID(hn))) << V(hn);
+    for ( PartitionID block = 0; block < k; ++block ) {
+      ASSERT_EQ(gain_cache.recomputeBenefitTerm(partitioned_hg, hn, block),
+        gain_cache.benefitTerm(hn, block)) << V(hn) << V(block);
+    }
+  }
+}
+
+#endif
+
+TEST(ALazyKm1GainCache, HasCorrectGainsAfterMovingNodesAtRandom) {
+  using Hypergraph = typename StaticHypergraphTypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
+  const PartitionID k = 8;
+  Hypergraph hypergraph = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_unweighted_ibm01.hgr", FileFormat::hMetis, true);
+  PartitionedHypergraph partitioned_hg(k, hypergraph, parallel_tag_t { });
+  std::vector<PartitionID> partition;
+  io::readPartitionFile("../tests/instances/contracted_unweighted_ibm01.hgr.part8",
+    hypergraph.initialNumNodes(), partition);
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    partitioned_hg.setOnlyNodePart(hn, partition[hn]);
+  });
+  partitioned_hg.initializePartition();
+  size_t num_interior_nodes = 0;
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    num_interior_nodes += !partitioned_hg.isBorderNode(hn);
+  }
+  ASSERT_GT(num_interior_nodes, 0);
+
+  Context context;
+  context.partition.k = k;
+  context.refinement.lazy_gain_cache_initialization = true;
+  Km1GainCache gain_cache(context);
+  gain_cache.initializeGainCache(partitioned_hg);
+
+  utils::Randomize& rand = utils::Randomize::instance();
+  ds::ThreadSafeFastResetFlagArray<> was_moved(hypergraph.initialNumNodes());
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    if ( rand.flipCoin(THREAD_ID) && partitioned_hg.isBorderNode(hn) ) {
+      const PartitionID from = partitioned_hg.partID(hn);
+      const PartitionID to = rand.getRandomInt(0, k - 1, THREAD_ID);
+      if ( from != to && was_moved.compare_and_set_to_true(hn) ) {
+        partitioned_hg.changeNodePart(gain_cache, hn, from, to);
+      }
+    }
+  });
+  partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    if ( was_moved[hn] ) {
+      gain_cache.recomputeInvalidTerms(partitioned_hg, hn);
+    }
+  });
+
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    ASSERT_EQ(gain_cache.recomputePenaltyTerm(partitioned_hg, hn),
+      gain_cache.penaltyTerm(hn, partitioned_hg.partID(hn))) << V(hn);
+    for ( PartitionID block = 0; block < k; ++block ) {
+      ASSERT_EQ(gain_cache.recomputeBenefitTerm(partitioned_hg, hn, block),
+        gain_cache.benefitTerm(hn, block)) << V(hn) << V(block);
+    }
+  }
+}
+
+TEST(ABenefitAggregation, AddsWeightsToAllBlocksInConnectivitySets) {
+  utils::Randomize& rand = utils::Randomize::instance();
+  for ( const PartitionID k : { 2, 7, 8, 13, 32, 33, 64 } ) {
+    vec<Gain> benefits(k, 0);
+    vec<Gain> expected_benefits(k, 0);
+    {
+      benefit_aggregation::BenefitAggregationBuffer buffer(k, benefits.data());
+      for ( size_t i = 0; i < 3 * benefit_aggregation::BATCH_SIZE + 5; ++i ) {
+        uint64_t connectivity_set = 0;
+        for ( PartitionID block = 0; block < k; ++block ) {
+          if ( rand.flipCoin(THREAD_ID) ) {
+            connectivity_set |= UL(1) << block;
+          }
+        }
+        const HyperedgeWeight weight = rand.getRandomInt(1, 10, THREAD_ID);
+        buffer.add(connectivity_set, weight);
+        for ( PartitionID block = 0; block < k; ++block ) {
+          if ( (connectivity_set >> block) & UL(1) ) {
+            expected_benefits[block] += weight;
+          }
+        }
+      }
+    }
+    for ( PartitionID block = 0; block < k; ++block ) {
+      ASSERT_EQ(expected_benefits[block], benefits[block]) << V(k) << V(block);
+    }
+  }
+}
+
 }
@@ -114,6 +114,26 @@ TEST_F(AKm1PolicyK2, ComputesCorrectMoveGainForVertex3) {
   ASSERT_EQ(0, move.gain);
 }
 
+TEST_F(AKm1PolicyK2, ComputesCorrectMoveGainInParallel) {
+  assignPartitionIDs({ 1, 0, 0, 0, 0, 1, 1 });
+  Move move = gain->computeMaxGainMoveInParallel(hypergraph, 0);
+  ASSERT_EQ(1, move.from);
+  ASSERT_EQ(0, move.to);
+  ASSERT_EQ(-2, move.gain);
+}
+
+TEST_F(AKm1PolicyK2, ComputesSameGainsWithBipartitionSpecialization) {
+  // The sequential gain computation uses the specialization for k = 2,
+  // while the parallel gain computation iterates over the connectivity sets
+  assignPartitionIDs({ 1, 0, 0, 1, 0, 1, 1 });
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    const Move move = gain->computeMaxGainMove(hypergraph, hn);
+    const Move expected = gain->computeMaxGainMoveInParallel(hypergraph, hn);
+    ASSERT_EQ(expected.to, move.to);
+    ASSERT_EQ(expected.gain, move.gain);
+  }
+}
+
 using ACutPolicyK2 = AGainPolicy<CutGainComputation, 2>;
 
 TEST_F(ACutPolicyK2, ComputesCorrectMoveGainForVertex1) {
@@ -124,6 +144,24 @@ TEST_F(ACutPolicyK2, ComputesCorrectMoveGainForVertex1) {
   ASSERT_EQ(-2, move.gain);
 }
 
+TEST_F(ACutPolicyK2, ComputesSameGainsWithBipartitionSpecialization) {
+  assignPartitionIDs({ 1, 0, 0, 1, 0, 1, 1 });
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    const Move move = gain->computeMaxGainMove(hypergraph, hn);
+    const Move expected = gain->computeMaxGainMoveInParallel(hypergraph, hn);
+    ASSERT_EQ(expected.to, move.to);
+    ASSERT_EQ(expected.gain, move.gain);
+  }
+}
+
+TEST_F(ACutPolicyK2, ComputesCorrectMoveGainInParallel) {
+  assignPartitionIDs({ 0, 0, 0, 1, 0, 1, 1 });
+  Move move = gain->computeMaxGainMoveInParallel(hypergraph, 3);
+  ASSERT_EQ(1, move.from);
+  ASSERT_EQ(0, move.to);
+  ASSERT_EQ(-1, move.gain);
+}
+
 TEST_F(ACutPolicyK2, ComputesCorrectObjectiveDelta1) {
   assignPartitionIDs({ 1, 0, 0, 0, 0, 1, 1 });
   ASSERT_TRUE(hypergraph.changeNodePart(0, 1, 0,
@@ -245,4 +283,34 @@ TEST_F(ACutPolicyK4, ComputesCorrectMoveGainForVertex3) {
   ASSERT_EQ(2, move.to);
   ASSERT_EQ(0, move.gain);
 }
+
+using AKm1PolicyLargeK = AGainPolicy<Km1GainComputation, 2048>;
+
+TEST_F(AKm1PolicyLargeK, ComputesSameGainsWithHashedRatingMap) {
+  // The sequential gain computation aggregates the scores of low degree nodes in a
+  // hash map, while the parallel gain computation uses the k-sized rating map
+  assignPartitionIDs({ 0, 2047, 1, 1024, 1024, 0, 2047 });
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    const Move move = gain->computeMaxGainMove(hypergraph, hn);
+    const Move expected = gain->computeMaxGainMoveInParallel(hypergraph, hn);
+    ASSERT_EQ(expected.to, move.to);
+    ASSERT_EQ(expected.gain, move.gain);
+  }
+  Move move = gain->computeMaxGainMove(hypergraph, 2);
+  ASSERT_EQ(1, move.from);
+  ASSERT_EQ(0, move.to);
+  ASSERT_EQ(-2, move.gain);
+}
+
+using ACutPolicyLargeK = AGainPolicy<CutGainComputation, 2048>;
+
+TEST_F(ACutPolicyLargeK, ComputesSameGainsWithHashedRatingMap) {
+  assignPartitionIDs({ 0, 2047, 1, 1024, 1024, 0, 2047 });
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    const Move move = gain->computeMaxGainMove(hypergraph, hn);
+    const Move expected = gain->computeMaxGainMoveInParallel(hypergraph, hn);
+    ASSERT_EQ(expected.to, move.to);
+    ASSERT_EQ(expected.gain, move.gain);
+  }
+}
 }  // namespace mt_kahypar
@@ -200,6 +200,18 @@ TYPED_TEST(MultiTryFMTest, AlsoWorksWithNonDefaultFeatures) {
   ASSERT_DOUBLE_EQ(metrics::imbalance(this->partitioned_hypergraph, this->context), this->metrics.imbalance);
 }
 
+TYPED_TEST(MultiTryFMTest, WorksWithGainOrderedSeedNodes) {
+  this->context.refinement.fm.gain_ordered_seeds = true;
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_LE(this->metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon);
+  ASSERT_DOUBLE_EQ(metrics::imbalance(this->partitioned_hypergraph, this->context), this->metrics.imbalance);
+}
+
 TYPED_TEST(MultiTryFMTest, WorksWithRefinementNodes) {
   parallel::scalable_vector<HypernodeID> refinement_nodes;
   for (HypernodeID u = 0; u < this->partitioned_hypergraph.initialNumNodes(); ++u) {
@@ -253,6 +265,45 @@ TYPED_TEST(MultiTryFMTest, ChangesTheNumberOfBlocks) {
             this->metrics.quality);
 }
 
+TYPED_TEST(MultiTryFMTest, ComputesSamePartitionInDeterministicMode) {
+  using PartitionedHypergraph = typename TestFixture::PartitionedHypergraph;
+  using Refiner = typename TestFixture::Refiner;
+  using Rebalancer = AdvancedRebalancer<GraphAndGainTypes<typename TestFixture::TypeTraits, Km1GainTypes>>;
+  this->context.partition.deterministic = true;
+  this->context.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+  const HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+
+  auto refine = [&](PartitionedHypergraph& phg) {
+    this->partitioned_hypergraph.doParallelForAllNodes([&](const HypernodeID hn) {
+      phg.setOnlyNodePart(hn, this->partitioned_hypergraph.partID(hn));
+    });
+    phg.initializePartition();
+    Km1GainCache gain_cache;
+    Rebalancer rebalancer(this->hypergraph.initialNumNodes(), this->context, gain_cache);
+    Refiner refiner(this->hypergraph.initialNumNodes(), this->hypergraph.initialNumEdges(),
+      this->context, gain_cache, rebalancer);
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(phg);
+    rebalancer.initialize(partitioned_hg);
+    refiner.initialize(partitioned_hg);
+    Metrics metrics = this->metrics;
+    refiner.refine(partitioned_hg, {}, metrics, std::numeric_limits<double>::max());
+    return metrics;
+  };
+
+  PartitionedHypergraph first_phg(this->context.partition.k, this->hypergraph, parallel_tag_t());
+  PartitionedHypergraph second_phg(this->context.partition.k, this->hypergraph, parallel_tag_t());
+  const Metrics first_metrics = refine(first_phg);
+  const Metrics second_metrics = refine(second_phg);
+
+  ASSERT_LE(first_metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(first_phg, this->context.partition.objective), first_metrics.quality);
+  ASSERT_LE(first_metrics.imbalance, this->context.partition.epsilon);
+  ASSERT_EQ(first_metrics.quality, second_metrics.quality);
+  for ( const HypernodeID& hn : this->hypergraph.nodes() ) {
+    ASSERT_EQ(first_phg.partID(hn), second_phg.partID(hn));
+  }
+}
+
 TEST(UnconstrainedFMDataTest, CorrectlyComputesPenalty) {
   using TypeTraits = StaticHypergraphTypeTraits;
   using Hypergraph = typename TypeTraits::Hypergraph;
@@ -291,4 +342,75 @@ TEST(UnconstrainedFMDataTest, CorrectlyComputesPenalty) {
   ASSERT_GE(30000, ufm_data.estimatePenaltyForImbalancedMove(1, 0, 2));
 }
 
+TEST(UnconstrainedFMDataTest, ComputesSamePenaltiesIfReinitializedAfterMoves) {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using TypesForGains = GraphAndGainTypes<TypeTraits, Km1GainTypes>;
+
+  Context context;
+  context.partition.k = 4;
+  context.refinement.fm.treshold_border_node_inclusion = 0.0;
+
+  Hypergraph hg = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  PartitionedHypergraph phg(context.partition.k, hg, parallel_tag_t());
+  for ( const HypernodeID& hn : phg.nodes() ) {
+    phg.setOnlyNodePart(hn, hn % context.partition.k);
+  }
+  phg.initializePartition();
+  Km1GainCache gain_cache;
+  gain_cache.initializeGainCache(phg);
+
+  UnconstrainedFMData ufm_data(hg.initialNumNodes());
+  ufm_data.initialize<TypesForGains>(context, phg, gain_cache);
+  // the incident weights computed in the first round are reused after the moves
+  for ( HypernodeID hn = 0; hn < hg.initialNumNodes(); hn += 3 ) {
+    const PartitionID from = phg.partID(hn);
+    phg.changeNodePart(gain_cache, hn, from, (from + 1) % context.partition.k);
+  }
+  ufm_data.initialize<TypesForGains>(context, phg, gain_cache);
+
+  UnconstrainedFMData expected_ufm_data(hg.initialNumNodes());
+  expected_ufm_data.initialize<TypesForGains>(context, phg, gain_cache);
+  for ( PartitionID block = 0; block < context.partition.k; ++block ) {
+    for ( HypernodeWeight weight = 1; weight < 64; weight *= 2 ) {
+      for ( HypernodeWeight imbalance = -64; imbalance <= 64; imbalance += 8 ) {
+        ASSERT_EQ(expected_ufm_data.estimatePenaltyForImbalancedMove(block, imbalance, weight),
+                  ufm_data.estimatePenaltyForImbalancedMove(block, imbalance, weight));
+      }
+    }
+  }
+}
+
+TEST(FMStopStatisticsTest, ComputesMaxMovesWithoutImprovementFromQuantile) {
+  FMStopStatistics stats;
+  // not enough improvements observed so far
+  ASSERT_EQ(std::numeric_limits<size_t>::max(), stats.maxMovesWithoutImprovement(2.0));
+
+  for ( size_t i = 0; i < 95; ++i ) {
+    stats.addImprovement(40);
+  }
+  for ( size_t i = 0; i < 5; ++i ) {
+    stats.addImprovement(5000);
+  }
+  // 95% of the improvements are found after at most 63 moves
+  ASSERT_EQ(126, stats.maxMovesWithoutImprovement(2.0));
+  ASSERT_EQ(std::numeric_limits<size_t>::max(), stats.maxMovesWithoutImprovement(0.0));
+
+  StopRule stop_rule(1000, stats.maxMovesWithoutImprovement(0.5));
+  for ( size_t i = 0; i < 31; ++i ) {
+    ASSERT_FALSE(stop_rule.searchShouldStop());
+    // alternating gains keep the random walk stopping rule from stopping the search
+    stop_rule.update(i % 2 == 0 ? 1000 : -999);
+  }
+  ASSERT_TRUE(stop_rule.searchShouldStop());
+
+  stats.addSearch(100, 20);
+  ASSERT_EQ(100, stats.numMoves());
+  ASSERT_EQ(20, stats.numWastedMoves());
+  stats.reset();
+  ASSERT_EQ(std::numeric_limits<size_t>::max(), stats.maxMovesWithoutImprovement(2.0));
+}
+
 }  // namespace mt_kahypar
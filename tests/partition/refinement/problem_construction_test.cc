@@ -196,4 +196,246 @@ TEST_F(AProblemConstruction, GrowTwoFlowProblemAroundTwoBlocksSimultanously) {
   verifyThatVertexSetAreDisjoint(sub_hg_1, sub_hg_2);
 }
 
-}
\ No newline at end of file
+TEST_F(AProblemConstruction, GrowsFlowProblemInParallelWithSameSizeLimitsAsSequentialBFS) {
+  context.refinement.flows.alpha = 16.0;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  const BlockPair blocks = qg.getBlockPair(search_id);
+  Subhypergraph sequential_sub_hg = constructor.construct(search_id, qg, phg, 1);
+  Subhypergraph sub_hg = constructor.construct(search_id, qg, phg, 4);
+  ASSERT_EQ(blocks.i, sub_hg.block_0);
+  ASSERT_EQ(blocks.j, sub_hg.block_1);
+  ASSERT_GT(sub_hg.numNodes(), 0);
+  ASSERT_EQ(sequential_sub_hg.numNodes() > 0, sub_hg.numNodes() > 0);
+
+  // A node is only added if the weight of its block is below the limit
+  const double scaling = 1.0 + context.refinement.flows.alpha * std::min(0.05, context.partition.epsilon);
+  const HypernodeWeight max_weight_block_0 =
+    scaling * context.partition.perfect_balance_part_weights[blocks.j] - phg.partWeight(blocks.j);
+  const HypernodeWeight max_weight_block_1 =
+    scaling * context.partition.perfect_balance_part_weights[blocks.i] - phg.partWeight(blocks.i);
+  HypernodeWeight max_node_weight = 0;
+  for ( const HypernodeID& hn : phg.nodes() ) {
+    max_node_weight = std::max(max_node_weight, phg.nodeWeight(hn));
+  }
+  ASSERT_LT(sub_hg.weight_of_block_0, std::max(max_weight_block_0, 1) + max_node_weight);
+  ASSERT_LT(sub_hg.weight_of_block_1, std::max(max_weight_block_1, 1) + max_node_weight);
+
+  // The region contains each node once and exactly the incident hyperedges of its nodes
+  std::set<HypernodeID> nodes;
+  std::set<HyperedgeID> expected_hes;
+  HypernodeWeight weight_of_block_0 = 0;
+  HypernodeWeight weight_of_block_1 = 0;
+  size_t num_pins = 0;
+  for ( const HypernodeID& hn : sub_hg.nodes_of_block_0 ) {
+    ASSERT_EQ(blocks.i, phg.partID(hn));
+    ASSERT_TRUE(nodes.insert(hn).second);
+    weight_of_block_0 += phg.nodeWeight(hn);
+    num_pins += phg.nodeDegree(hn);
+    for ( const HyperedgeID& he : phg.incidentEdges(hn) ) expected_hes.insert(he);
+  }
+  for ( const HypernodeID& hn : sub_hg.nodes_of_block_1 ) {
+    ASSERT_EQ(blocks.j, phg.partID(hn));
+    ASSERT_TRUE(nodes.insert(hn).second);
+    weight_of_block_1 += phg.nodeWeight(hn);
+    num_pins += phg.nodeDegree(hn);
+    for ( const HyperedgeID& he : phg.incidentEdges(hn) ) expected_hes.insert(he);
+  }
+  ASSERT_EQ(weight_of_block_0, sub_hg.weight_of_block_0);
+  ASSERT_EQ(weight_of_block_1, sub_hg.weight_of_block_1);
+  ASSERT_EQ(num_pins, sub_hg.num_pins);
+  ASSERT_EQ(expected_hes, std::set<HyperedgeID>(sub_hg.hes.begin(), sub_hg.hes.end()));
+  ASSERT_EQ(expected_hes.size(), sub_hg.hes.size());
+}
+
+TEST_F(AProblemConstruction, ReusesProblemOfBlockPairIfNoHyperedgeChanged) {
+  context.refinement.flows.reuse_problem_construction = true;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+  constructor.resetCachedProblems();
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  Subhypergraph sub_hg_1 = constructor.construct(search_id, qg, phg);
+  Subhypergraph sub_hg_2 = constructor.construct(search_id, qg, phg);
+  ASSERT_EQ(sub_hg_1.nodes_of_block_0, sub_hg_2.nodes_of_block_0);
+  ASSERT_EQ(sub_hg_1.nodes_of_block_1, sub_hg_2.nodes_of_block_1);
+  ASSERT_EQ(sub_hg_1.hes, sub_hg_2.hes);
+}
+
+TEST_F(AProblemConstruction, ReconstructsProblemOfBlockPairIfHyperedgeChanged) {
+  context.refinement.flows.reuse_problem_construction = true;
+  context.refinement.flows.alpha = 16.0;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+  constructor.resetCachedProblems();
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  Subhypergraph sub_hg_1 = constructor.construct(search_id, qg, phg);
+  ASSERT_FALSE(sub_hg_1.nodes_of_block_0.empty());
+
+  // Move a node of the problem to a block that is not part of the block pair
+  const HypernodeID hn = sub_hg_1.nodes_of_block_0[0];
+  const BlockPair blocks = qg.getBlockPair(search_id);
+  PartitionID to = 0;
+  while ( to == blocks.i || to == blocks.j ) ++to;
+  constructor.startMoveSequence();
+  phg.changeNodePart(hn, blocks.i, to, std::numeric_limits<HypernodeWeight>::max(), [] { },
+    [&](const SynchronizedEdgeUpdate& sync_update) {
+      constructor.notifyChangedHyperedge(phg.uniqueEdgeID(sync_update.he));
+    });
+
+  Subhypergraph sub_hg_2 = constructor.construct(search_id, qg, phg);
+  for ( const HypernodeID& u : sub_hg_2.nodes_of_block_0 ) {
+    ASSERT_NE(hn, u);
+  }
+  for ( const HypernodeID& u : sub_hg_2.nodes_of_block_1 ) {
+    ASSERT_NE(hn, u);
+  }
+}
+
+TEST_F(AProblemConstruction, SkipsUnchangedProblemIfPreviousFlowComputationFoundNoImprovement) {
+  context.refinement.flows.reuse_problem_construction = true;
+  context.refinement.flows.skip_unchanged_problems = true;
+  context.refinement.flows.alpha = 16.0;
+  ProblemConstruction<TypeTraits> constructor(
+    hg.initialNumNodes(), hg.initialNumEdges(), context);
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+  qg.initialize(phg);
+  constructor.resetCachedProblems();
+
+  SearchID search_id = qg.requestNewSearch(refiner);
+  const BlockPair blocks = qg.getBlockPair(search_id);
+  Subhypergraph sub_hg = constructor.construct(search_id, qg, phg);
+  ASSERT_FALSE(sub_hg.nodes_of_block_0.empty());
+  ASSERT_FALSE(constructor.isUnimprovable(search_id, blocks));
+  constructor.markAsUnimprovable(search_id, blocks);
+  sub_hg = constructor.construct(search_id, qg, phg);
+  ASSERT_TRUE(constructor.isUnimprovable(search_id, blocks));
+
+  // Moving a node outside of the problem changes the weight of one of the blocks
+  std::set<HyperedgeID> hes(sub_hg.hes.begin(), sub_hg.hes.end());
+  HypernodeID hn = kInvalidHypernode;
+  for ( const HypernodeID& u : phg.nodes() ) {
+    bool is_incident_to_problem = false;
+    for ( const HyperedgeID& he : phg.incidentEdges(u) ) {
+      is_incident_to_problem |= hes.count(he) > 0;
+    }
+    if ( phg.partID(u) == blocks.i && !is_incident_to_problem ) {
+      hn = u;
+      break;
+    }
+  }
+  ASSERT_NE(kInvalidHypernode, hn);
+  PartitionID to = 0;
+  while ( to == blocks.i || to == blocks.j ) ++to;
+  constructor.startMoveSequence();
+  phg.changeNodePart(hn, blocks.i, to, std::numeric_limits<HypernodeWeight>::max(), [] { },
+    [&](const SynchronizedEdgeUpdate& sync_update) {
+      constructor.notifyChangedHyperedge(phg.uniqueEdgeID(sync_update.he));
+    });
+  constructor.construct(search_id, qg, phg);
+  ASSERT_FALSE(constructor.isUnimprovable(search_id, blocks));
+
+  // Moving a node of the problem invalidates the cached problem
+  constructor.markAsUnimprovable(search_id, blocks);
+  constructor.startMoveSequence();
+  phg.changeNodePart(sub_hg.nodes_of_block_0[0], blocks.i, to, std::numeric_limits<HypernodeWeight>::max(), [] { },
+    [&](const SynchronizedEdgeUpdate& sync_update) {
+      constructor.notifyChangedHyperedge(phg.uniqueEdgeID(sync_update.he));
+    });
+  constructor.construct(search_id, qg, phg);
+  ASSERT_FALSE(constructor.isUnimprovable(search_id, blocks));
+}
+
+TEST_F(AProblemConstruction, PostponesBlockPairWithoutImprovementsIfBlockPairsArePrioritized) {
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.shared_memory.num_threads);
+
+  // Without prioritization, the block pair with the heaviest cut is always scheduled first
+  BlockPair heaviest_blocks;
+  for ( size_t i = 0; i < 5; ++i ) {
+    qg.initialize(phg);
+    SearchID search_id = qg.requestNewSearch(refiner);
+    const BlockPair blocks = qg.getBlockPair(search_id);
+    if ( i > 0 ) {
+      ASSERT_EQ(heaviest_blocks.i, blocks.i);
+      ASSERT_EQ(heaviest_blocks.j, blocks.j);
+    }
+    heaviest_blocks = blocks;
+    qg.finalizeConstruction(search_id);
+    qg.finalizeSearch(search_id, 0);
+    refiner.finalizeSearch(search_id);
+  }
+
+  context.refinement.flows.prioritize_block_pairs = true;
+  qg.initialize(phg);
+  SearchID search_id = qg.requestNewSearch(refiner);
+  const BlockPair blocks = qg.getBlockPair(search_id);
+  ASSERT_FALSE(blocks.i == heaviest_blocks.i && blocks.j == heaviest_blocks.j);
+}
+
+TEST_F(AProblemConstruction, SchedulesDisjointBlockPairsIfMatchingBasedSchedulingIsEnabled) {
+  context.refinement.flows.matching_based_scheduling = true;
+  FlowRefinerAdapter<TypeTraits> refiner(hg.initialNumEdges(), context);
+  QuotientGraph<TypeTraits> qg(hg.initialNumEdges(), context);
+  refiner.initialize(context.partition.k / 2);
+  qg.initialize(phg);
+
+  HyperedgeWeight max_cut_weight = 0;
+  for ( PartitionID i = 0; i < context.partition.k; ++i ) {
+    for ( PartitionID j = i + 1; j < context.partition.k; ++j ) {
+      max_cut_weight = std::max(max_cut_weight, qg.getCutHyperedgeWeightOfBlockPair(i, j));
+    }
+  }
+
+  // Running searches form a greedy matching (heaviest block pair first)
+  vec<bool> matched(context.partition.k, false);
+  vec<SearchID> search_ids;
+  for ( PartitionID s = 0; s < context.partition.k / 2; ++s ) {
+    bool has_disjoint_block_pair = false;
+    for ( PartitionID i = 0; i < context.partition.k; ++i ) {
+      for ( PartitionID j = i + 1; j < context.partition.k; ++j ) {
+        has_disjoint_block_pair |= !matched[i] && !matched[j] &&
+          qg.getCutHyperedgeWeightOfBlockPair(i, j) > 0;
+      }
+    }
+    const SearchID search_id = qg.requestNewSearch(refiner);
+    ASSERT_NE(QuotientGraph<TypeTraits>::INVALID_SEARCH_ID, search_id);
+    const BlockPair blocks = qg.getBlockPair(search_id);
+    if ( s == 0 ) {
+      ASSERT_EQ(max_cut_weight, qg.getCutHyperedgeWeightOfBlockPair(blocks.i, blocks.j));
+    }
+    if ( has_disjoint_block_pair ) {
+      ASSERT_FALSE(matched[blocks.i]);
+      ASSERT_FALSE(matched[blocks.j]);
+    }
+    matched[blocks.i] = true;
+    matched[blocks.j] = true;
+    qg.finalizeConstruction(search_id);
+    search_ids.push_back(search_id);
+  }
+
+  for ( const SearchID search_id : search_ids ) {
+    qg.finalizeSearch(search_id, 0);
+    refiner.finalizeSearch(search_id);
+  }
+}
+
+}
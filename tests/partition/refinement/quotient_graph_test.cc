@@ -24,8 +24,15 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <map>
+#include <set>
+
 #include "gmock/gmock.h"
 
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/partition/refinement/flows/quotient_graph.h"
 #include "tests/partition/refinement/flow_refiner_mock.h"
@@ -36,6 +43,197 @@ using ::testing::Test;
 
 namespace mt_kahypar {
 
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+}
+
+template<PartitionID K>
+struct NumBlocks {
+  static constexpr PartitionID k = K;
+};
+
+template<typename Config>
+class AQuotientGraph : public Test {
+
+  using BlockPairKey = std::pair<PartitionID, PartitionID>;
+
+ public:
+  AQuotientGraph() :
+    hg(io::readInputFile<Hypergraph>(
+      "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true)),
+    phg(Config::k, hg, parallel_tag_t()),
+    context() {
+    context.partition.k = Config::k;
+    context.partition.epsilon = 0.03;
+    context.partition.objective = Objective::km1;
+    context.shared_memory.num_threads = std::thread::hardware_concurrency();
+    context.refinement.flows.algorithm = FlowAlgorithm::mock;
+    context.setupPartWeights(hg.totalWeight());
+    FlowRefinerMockControl::instance().reset();
+  }
+
+  // ! Assigns consecutive node IDs to the same block such that
+  // ! only some of the block pairs are adjacent for large k
+  PartitionID blockOf(const HypernodeID hn) const {
+    return static_cast<PartitionID>(
+      ( static_cast<size_t>(hn) * Config::k ) / hg.initialNumNodes());
+  }
+
+  // ! Computes the cut hyperedges of each adjacent block pair
+  std::map<BlockPairKey, std::set<HyperedgeID>> cutHyperedgesOfBlockPairs() const {
+    std::map<BlockPairKey, std::set<HyperedgeID>> cut_hes;
+    for ( const HyperedgeID& he : phg.edges() ) {
+      for ( const PartitionID i : phg.connectivitySet(he) ) {
+        for ( const PartitionID j : phg.connectivitySet(he) ) {
+          if ( i < j ) {
+            cut_hes[std::make_pair(i, j)].insert(he);
+          }
+        }
+      }
+    }
+    return cut_hes;
+  }
+
+  HyperedgeWeight weightOf(const std::set<HyperedgeID>& hes) const {
+    HyperedgeWeight weight = 0;
+    for ( const HyperedgeID& he : hes ) {
+      weight += phg.edgeWeight(he);
+    }
+    return weight;
+  }
+
+  Hypergraph hg;
+  PartitionedHypergraph phg;
+  Context context;
+};
+
+// Small k uses a dense index of the block pairs, large k a hash map
+typedef ::testing::Types<NumBlocks<8>, NumBlocks<300>> NumBlocksConfigs;
+
+TYPED_TEST_SUITE(AQuotientGraph, NumBlocksConfigs);
+
+TYPED_TEST(AQuotientGraph, ContainsOnlyAdjacentBlockPairs) {
+  this->phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    this->phg.setOnlyNodePart(hn, this->blockOf(hn));
+  });
+  this->phg.initializePartition();
+
+  QuotientGraph<TypeTraits> qg(this->hg.initialNumEdges(), this->context);
+  qg.initialize(this->phg);
+
+  const auto expected_cut_hes = this->cutHyperedgesOfBlockPairs();
+  for ( PartitionID i = 0; i < this->context.partition.k; ++i ) {
+    for ( PartitionID j = i + 1; j < this->context.partition.k; ++j ) {
+      auto it = expected_cut_hes.find(std::make_pair(i, j));
+      if ( it != expected_cut_hes.end() ) {
+        ASSERT_EQ(it->second.size(), qg.numCutHyperedges(BlockPair { i, j }));
+        ASSERT_EQ(this->weightOf(it->second), qg.getCutHyperedgeWeightOfBlockPair(i, j));
+      } else {
+        ASSERT_EQ(0, qg.numCutHyperedges(BlockPair { i, j }));
+        ASSERT_EQ(0, qg.getCutHyperedgeWeightOfBlockPair(i, j));
+      }
+    }
+  }
+}
+
+TYPED_TEST(AQuotientGraph, SchedulesEachAdjacentBlockPairOnce) {
+  this->phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    this->phg.setOnlyNodePart(hn, this->blockOf(hn));
+  });
+  this->phg.initializePartition();
+
+  QuotientGraph<TypeTraits> qg(this->hg.initialNumEdges(), this->context);
+  FlowRefinerAdapter<TypeTraits> refiner(this->hg.initialNumEdges(), this->context);
+  qg.initialize(this->phg);
+  refiner.initialize(this->context.shared_memory.num_threads);
+
+  const auto expected_cut_hes = this->cutHyperedgesOfBlockPairs();
+  ASSERT_EQ(expected_cut_hes.size(), qg.numActiveBlockPairs());
+  std::map<std::pair<PartitionID, PartitionID>, size_t> num_searches;
+  while ( true ) {
+    const SearchID search_id = qg.requestNewSearch(refiner);
+    if ( search_id == QuotientGraph<TypeTraits>::INVALID_SEARCH_ID ) {
+      break;
+    }
+    const BlockPair blocks = qg.getBlockPair(search_id);
+    ASSERT_LT(blocks.i, blocks.j);
+    ++num_searches[std::make_pair(blocks.i, blocks.j)];
+    qg.finalizeConstruction(search_id);
+    qg.finalizeSearch(search_id, 0);
+    refiner.finalizeSearch(search_id);
+  }
+
+  ASSERT_EQ(expected_cut_hes.size(), num_searches.size());
+  for ( const auto& entry : expected_cut_hes ) {
+    ASSERT_EQ(1, num_searches[entry.first])
+      << "Blocks (" << entry.first.first << "," << entry.first.second << ")";
+  }
+  ASSERT_EQ(0, qg.numActiveBlockPairs());
+}
+
+TYPED_TEST(AQuotientGraph, RegistersCutHyperedgesOfConcurrentMoves) {
+  // All nodes start in block 0 => the quotient graph has no edges
+  this->phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    this->phg.setOnlyNodePart(hn, 0);
+  });
+  this->phg.initializePartition();
+
+  QuotientGraph<TypeTraits> qg(this->hg.initialNumEdges(), this->context);
+  qg.initialize(this->phg);
+  ASSERT_EQ(0, qg.numActiveBlockPairs());
+
+  // Move all nodes concurrently and collect the hyperedges that become
+  // part of a new block (as the flow refinement scheduler does)
+  tbb::enumerable_thread_specific<vec<std::pair<HyperedgeID, PartitionID>>> new_cut_hes;
+  this->phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+    const PartitionID to = this->blockOf(hn);
+    if ( to != 0 ) {
+      this->phg.changeNodePart(hn, 0, to, [&](const SynchronizedEdgeUpdate& sync_update) {
+        if ( sync_update.pin_count_in_to_part_after == 1 ) {
+          new_cut_hes.local().emplace_back(sync_update.he, sync_update.to);
+        }
+      });
+    }
+  });
+  vec<std::pair<HyperedgeID, PartitionID>> all_new_cut_hes;
+  for ( const auto& local_new_cut_hes : new_cut_hes ) {
+    all_new_cut_hes.insert(all_new_cut_hes.end(),
+      local_new_cut_hes.begin(), local_new_cut_hes.end());
+  }
+  // Edges of the quotient graph are created concurrently
+  tbb::parallel_for(UL(0), all_new_cut_hes.size(), [&](const size_t i) {
+    qg.addNewCutHyperedge(all_new_cut_hes[i].first, all_new_cut_hes[i].second);
+  });
+
+  // Each block except block 0 became new in all of its hyperedges. Thus, a hyperedge
+  // is registered once for each block of the pair other than block 0.
+  const auto expected_cut_hes = this->cutHyperedgesOfBlockPairs();
+  for ( PartitionID i = 0; i < this->context.partition.k; ++i ) {
+    for ( PartitionID j = i + 1; j < this->context.partition.k; ++j ) {
+      auto it = expected_cut_hes.find(std::make_pair(i, j));
+      if ( it == expected_cut_hes.end() ) {
+        ASSERT_EQ(0, qg.numCutHyperedges(BlockPair { i, j }));
+        continue;
+      }
+      const size_t num_registrations = i == 0 ? 1 : 2;
+      ASSERT_EQ(num_registrations * it->second.size(), qg.numCutHyperedges(BlockPair { i, j }));
+      ASSERT_EQ(static_cast<HyperedgeWeight>(num_registrations) * this->weightOf(it->second),
+        qg.getCutHyperedgeWeightOfBlockPair(i, j));
+
+      std::set<HyperedgeID> cut_hes_of_search;
+      const SearchID search_id = qg.registerDeterministicSearch(BlockPair { i, j });
+      qg.doForAllCutHyperedgesOfSearch(search_id, [&](const HyperedgeID he) {
+        cut_hes_of_search.insert(he);
+      });
+      qg.finalizeConstruction(search_id);
+      qg.finalizeDeterministicSearch(search_id, 0);
+      ASSERT_EQ(it->second, cut_hes_of_search);
+    }
+  }
+}
+
 /*class AQuotientGraph : public Test {
  public:
   AQuotientGraph() :
@@ -120,4 +120,36 @@ TEST(RebalanceTests, FindsMoves) {
   ASSERT_EQ(moves_to_empty_blocks.size(), 0);
 }
 
+TEST(RebalanceTests, RebalancesHeavilyOverloadedBlocks) {
+  PartitionID k = 4;
+  Context context;
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  context.partition.objective = Objective::km1;
+  context.partition.gain_policy = GainPolicy::km1;
+  Hypergraph hg = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_unweighted_ibm01.hgr", FileFormat::hMetis,
+    true /* enable stable construction */);
+  context.setupPartWeights(hg.totalWeight());
+  PartitionedHypergraph phg = PartitionedHypergraph(k, hg);
+
+  // Three quarters of the nodes are assigned to block 0
+  for ( const HypernodeID& hn : hg.nodes() ) {
+    phg.setOnlyNodePart(hn, hn % 4 == 0 ? hn % 3 + 1 : 0);
+  }
+  phg.initializePartition();
+
+  Metrics metrics;
+  metrics.quality = metrics::quality(phg, context);
+  metrics.imbalance = metrics::imbalance(phg, context);
+  Km1Rebalancer rebalancer(context);
+  mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(phg);
+  rebalancer.refine(partitioned_hg, {}, metrics, std::numeric_limits<double>::max());
+
+  for ( PartitionID block = 0; block < k; ++block ) {
+    ASSERT_LE(phg.partWeight(block), context.partition.max_part_weights[block]);
+  }
+  ASSERT_EQ(metrics::quality(phg, context), metrics.quality);
+}
+
 }
\ No newline at end of file
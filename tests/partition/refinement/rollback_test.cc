@@ -161,4 +161,179 @@ TEST(RollbackTests, GainRecalculation2) {
   grb.verifyGains(phg, sharedData);
 }
 
+TEST(RollbackTests, ParallelAndSequentialRollbackRevertToSamePrefix) {
+  Hypergraph hg = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  PartitionID k = 4;
+
+  Context context;
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  context.setupPartWeights(hg.totalWeight());
+  context.refinement.fm.rollback_balance_violation_factor = 0.0;
+
+  using Rollback = GlobalRollback<GraphAndGainTypes<TypeTraits, Km1GainTypes>>;
+  PartitionedHypergraph par_phg(k, hg);
+  PartitionedHypergraph seq_phg(k, hg);
+  for (const HypernodeID& u : hg.nodes()) {
+    par_phg.setOnlyNodePart(u, u % k);
+    seq_phg.setOnlyNodePart(u, u % k);
+  }
+  par_phg.initializePartition();
+  seq_phg.initializePartition();
+  Km1GainCache par_gain_cache;
+  Km1GainCache seq_gain_cache;
+  par_gain_cache.initializeGainCache(par_phg);
+  seq_gain_cache.initializeGainCache(seq_phg);
+  FMSharedData par_shared_data(hg.initialNumNodes(), false);
+  FMSharedData seq_shared_data(hg.initialNumNodes(), false);
+  Rollback par_grb(hg.initialNumEdges(), context, par_gain_cache);
+  Rollback seq_grb(hg.initialNumEdges(), context, seq_gain_cache);
+
+  vec<HypernodeWeight> part_weights(k, 0);
+  for (PartitionID i = 0; i < k; ++i) {
+    part_weights[i] = par_phg.partWeight(i);
+  }
+
+  // perform the same sequence of mostly positive gain moves on both partitions
+  std::mt19937 rng(42);
+  for (const HypernodeID& u : hg.nodes()) {
+    const PartitionID from = par_phg.partID(u);
+    PartitionID to = (from + 1 + rng() % (k - 1)) % k;
+    for (PartitionID i = 0; i < k; ++i) {
+      if (i != from && par_gain_cache.gain(u, from, i) > par_gain_cache.gain(u, from, to)) {
+        to = i;
+      }
+    }
+    if (par_gain_cache.gain(u, from, to) >= 0 || rng() % 4 == 0) {
+      Move m = { from, to, u, 0 };
+      par_phg.changeNodePart(par_gain_cache, u, from, to);
+      seq_phg.changeNodePart(seq_gain_cache, u, from, to);
+      par_shared_data.moveTracker.insertMove(m);
+      seq_shared_data.moveTracker.insertMove(m);
+    }
+  }
+
+  const HyperedgeWeight par_gain = par_grb.revertToBestPrefixParallel(
+    par_phg, par_shared_data, part_weights, context.partition.max_part_weights);
+  const HyperedgeWeight seq_gain = seq_grb.revertToBestPrefixSequential(
+    seq_phg, seq_shared_data, part_weights, context.partition.max_part_weights);
+  ASSERT_EQ(par_gain, seq_gain);
+  for (const HypernodeID& u : hg.nodes()) {
+    ASSERT_EQ(par_phg.partID(u), seq_phg.partID(u));
+  }
+  for (PartitionID i = 0; i < k; ++i) {
+    ASSERT_LE(par_phg.partWeight(i), context.partition.max_part_weights[i]);
+  }
+}
+
+TEST(RollbackTests, SkipsReservedMoveIDsOfInvalidMoves) {
+  Hypergraph hg = io::readInputFile<Hypergraph>(
+    "../tests/instances/contracted_ibm01.hgr", FileFormat::hMetis, true);
+  PartitionID k = 4;
+
+  Context context;
+  context.partition.k = k;
+  context.partition.epsilon = 0.03;
+  context.setupPartWeights(hg.totalWeight());
+  context.refinement.fm.rollback_balance_violation_factor = 0.0;
+
+  using Rollback = GlobalRollback<GraphAndGainTypes<TypeTraits, Km1GainTypes>>;
+  PartitionedHypergraph par_phg(k, hg);
+  PartitionedHypergraph seq_phg(k, hg);
+  for (const HypernodeID& u : hg.nodes()) {
+    par_phg.setOnlyNodePart(u, u % k);
+    seq_phg.setOnlyNodePart(u, u % k);
+  }
+  par_phg.initializePartition();
+  seq_phg.initializePartition();
+  Km1GainCache par_gain_cache;
+  Km1GainCache seq_gain_cache;
+  par_gain_cache.initializeGainCache(par_phg);
+  seq_gain_cache.initializeGainCache(seq_phg);
+  FMSharedData par_shared_data(hg.initialNumNodes(), false);
+  FMSharedData seq_shared_data(hg.initialNumNodes(), false);
+  Rollback par_grb(hg.initialNumEdges(), context, par_gain_cache);
+  Rollback seq_grb(hg.initialNumEdges(), context, seq_gain_cache);
+
+  vec<HypernodeWeight> part_weights(k, 0);
+  for (PartitionID i = 0; i < k; ++i) {
+    part_weights[i] = par_phg.partWeight(i);
+  }
+  const HyperedgeWeight km1_before = metrics::quality(par_phg, Objective::km1);
+
+  // Apply move sequences as localized searches do: the IDs of a sequence are reserved
+  // at once and each move that is not applied fills its reserved ID with an invalid move
+  const size_t sequence_length = 8;
+  std::mt19937 rng(42);
+  vec<HypernodeID> nodes_of_invalid_moves;
+  vec<Move> sequence;
+  auto apply_sequence = [&] {
+    const MoveID par_first_id = par_shared_data.moveTracker.reserveMoveIDs(sequence.size());
+    const MoveID seq_first_id = seq_shared_data.moveTracker.reserveMoveIDs(sequence.size());
+    for (size_t i = 0; i < sequence.size(); ++i) {
+      const Move& m = sequence[i];
+      if (rng() % 3 == 0) {
+        par_shared_data.moveTracker.insertInvalidMove(m, par_first_id + i);
+        seq_shared_data.moveTracker.insertInvalidMove(m, seq_first_id + i);
+        nodes_of_invalid_moves.push_back(m.node);
+      } else {
+        par_phg.changeNodePart(par_gain_cache, m.node, m.from, m.to);
+        seq_phg.changeNodePart(seq_gain_cache, m.node, m.from, m.to);
+        par_shared_data.moveTracker.insertMove(m, par_first_id + i);
+        seq_shared_data.moveTracker.insertMove(m, seq_first_id + i);
+      }
+    }
+    sequence.clear();
+  };
+  for (const HypernodeID& u : hg.nodes()) {
+    const PartitionID from = par_phg.partID(u);
+    PartitionID to = (from + 1 + rng() % (k - 1)) % k;
+    for (PartitionID i = 0; i < k; ++i) {
+      if (i != from && par_gain_cache.gain(u, from, i) > par_gain_cache.gain(u, from, to)) {
+        to = i;
+      }
+    }
+    if (par_gain_cache.gain(u, from, to) >= 0 || rng() % 4 == 0) {
+      sequence.push_back(Move { from, to, u, 0 });
+      if (sequence.size() == sequence_length) {
+        apply_sequence();
+      }
+    }
+  }
+  apply_sequence();
+  ASSERT_FALSE(nodes_of_invalid_moves.empty());
+  const HyperedgeWeight km1_after_moves = metrics::quality(par_phg, Objective::km1);
+
+  // The recalculated gains of the valid moves add up to the total improvement
+  par_grb.recalculateGains(par_phg, par_shared_data);
+  HyperedgeWeight sum_of_gains = 0;
+  for (MoveID i = 0; i < par_shared_data.moveTracker.numPerformedMoves(); ++i) {
+    const Move& m = par_shared_data.moveTracker.moveOrder[i];
+    if (m.isValid()) {
+      sum_of_gains += m.gain;
+    }
+  }
+  ASSERT_EQ(km1_before - km1_after_moves, sum_of_gains);
+
+  const HyperedgeWeight par_gain = par_grb.revertToBestPrefixParallel(
+    par_phg, par_shared_data, part_weights, context.partition.max_part_weights);
+  const HyperedgeWeight seq_gain = seq_grb.revertToBestPrefixSequential(
+    seq_phg, seq_shared_data, part_weights, context.partition.max_part_weights);
+  ASSERT_EQ(par_gain, seq_gain);
+  ASSERT_EQ(km1_before - par_gain, metrics::quality(par_phg, Objective::km1));
+  ASSERT_EQ(km1_before - seq_gain, metrics::quality(seq_phg, Objective::km1));
+  for (const HypernodeID& u : hg.nodes()) {
+    ASSERT_EQ(par_phg.partID(u), seq_phg.partID(u));
+  }
+  // Nodes of invalid moves were never moved and are not touched by the rollback
+  for (const HypernodeID& u : nodes_of_invalid_moves) {
+    ASSERT_EQ(u % k, par_phg.partID(u));
+    ASSERT_FALSE(par_shared_data.moveTracker.wasNodeMovedInThisRound(u));
+  }
+  for (PartitionID i = 0; i < k; ++i) {
+    ASSERT_LE(par_phg.partWeight(i), context.partition.max_part_weights[i]);
+  }
+}
+
 }   // namespace mt_kahypar
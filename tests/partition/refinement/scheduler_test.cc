@@ -388,4 +388,42 @@ TEST_F(AFlowRefinementEndToEnd, SmokeTestWithFourBlocksPerRefiner) {
   }
 }
 
-}
\ No newline at end of file
+TEST_F(AFlowRefinementEndToEnd, ComputesSamePartitionInDeterministicMode) {
+  context.partition.deterministic = true;
+  context.refinement.flows.num_parallel_searches = 4;
+  context.refinement.flows.min_relative_improvement_per_round = 0.0;
+  // The mock refiner moves each vertex to its max gain block without random tie breaking
+  mover = std::make_unique<Km1GainComputation>(context, true);
+  const HyperedgeWeight objective_before = metrics::quality(phg, context);
+
+  auto refine = [&](PartitionedHypergraph& partitioned_hypergraph) {
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      partitioned_hypergraph.setOnlyNodePart(hn, phg.partID(hn));
+    });
+    partitioned_hypergraph.initializePartition();
+    Km1GainCache gain_cache;
+    FlowRefinementScheduler<GraphAndGainTypes<TypeTraits, Km1GainTypes>> scheduler(
+      hg.initialNumNodes(), hg.initialNumEdges(), context, gain_cache);
+    Metrics metrics;
+    metrics.quality = metrics::quality(partitioned_hypergraph, context);
+    metrics.imbalance = metrics::imbalance(partitioned_hypergraph, context);
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg = utils::partitioned_hg_cast(partitioned_hypergraph);
+    scheduler.initialize(partitioned_hg);
+    scheduler.refine(partitioned_hg, {}, metrics, 0.0);
+    return metrics;
+  };
+
+  PartitionedHypergraph first_phg(context.partition.k, hg, parallel_tag_t());
+  PartitionedHypergraph second_phg(context.partition.k, hg, parallel_tag_t());
+  const Metrics first_metrics = refine(first_phg);
+  const Metrics second_metrics = refine(second_phg);
+
+  ASSERT_LT(first_metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(first_phg, Objective::km1), first_metrics.quality);
+  ASSERT_EQ(first_metrics.quality, second_metrics.quality);
+  for ( const HypernodeID& hn : hg.nodes() ) {
+    ASSERT_EQ(first_phg.partID(hn), second_phg.partID(hn));
+  }
+}
+
+}
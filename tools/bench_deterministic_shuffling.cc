@@ -1,5 +1,7 @@
 #include "mt-kahypar/utils/reproducible_random.h"
+#include "mt-kahypar/utils/randomize.h"
 
+#include <chrono>
 #include <iostream>
 #include <random>
 #include <tbb/global_control.h>
@@ -43,6 +45,34 @@ void benchShuffle(size_t n, int num_threads) {
   assert(is_permutation(comp, shuffle_hash.permutation));
 }
 
+// Compares std::shuffle with std::mt19937 (the previous generator of utils::Randomize)
+// against the generator and the parallel shuffle of utils::Randomize
+void benchRandomize(size_t n, int num_threads) {
+  tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+
+  auto time = [&](const std::string& name, const auto& f) {
+    vec<int> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    auto start = std::chrono::high_resolution_clock::now();
+    f(values);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << name << " " << std::chrono::duration<double>(end - start).count() << " s" << std::endl;
+  };
+
+  time("sequential shuffle (mt19937)", [&](vec<int>& values) {
+    std::mt19937 rng(420);
+    std::shuffle(values.begin(), values.end(), rng);
+  });
+  time("sequential shuffle (xoshiro256**)", [&](vec<int>& values) {
+    Xoshiro256 rng(420);
+    std::shuffle(values.begin(), values.end(), rng);
+  });
+  Randomize::instance().setSeed(420);
+  time("parallel shuffle (Randomize)", [&](vec<int>& values) {
+    Randomize::instance().parallelShuffleVector(values, UL(0), values.size());
+  });
+}
+
 void testGroupingReproducibility(size_t n, int num_threads) {
   tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
 
@@ -102,6 +132,7 @@ int main(int argc, char* argv[]) {
   int num_threads = std::stoi(argv[1]);
   size_t n = std::stoi(argv[2]);
   // mt_kahypar::utils::benchShuffle(n, num_threads);
+  // mt_kahypar::utils::benchRandomize(n, num_threads);
   mt_kahypar::utils::testGroupingReproducibility(n, num_threads);
 
   // mt_kahypar::utils::testFeistel();
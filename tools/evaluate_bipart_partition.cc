@@ -30,6 +30,9 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <cstdlib>
+
+#include <tbb/parallel_for.h>
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/static_hypergraph.h"
@@ -53,22 +56,40 @@ void readBipartPartitionFile(const std::string& bipart_partition_file,
                              PartitionedHypergraph& hypergraph,
                              const PartitionID k) {
   ASSERT(!bipart_partition_file.empty(), "No filename for partition file specified");
-  std::ifstream file(bipart_partition_file);
+  std::ifstream file(bipart_partition_file, std::ios::binary);
   if (file) {
-    for ( PartitionID block = 0; block < k; ++block ) {
-      std::string line;
-      std::getline(file, line);
-      std::istringstream line_stream(line);
-      HypernodeID hn = 0;
-      PartitionID bipart_block = 0;
-      line_stream >> bipart_block;
-      ASSERT(block == bipart_block - 1);
-      while ( line_stream >> hn ) {
+    // Each line contains the nodes of one block. We read the whole file at once
+    // and parse the lines (i.e., blocks) in parallel.
+    std::ostringstream content_stream;
+    content_stream << file.rdbuf();
+    const std::string content = content_stream.str();
+    file.close();
+    std::vector<size_t> line_starts;
+    size_t pos = 0;
+    while ( static_cast<PartitionID>(line_starts.size()) < k && pos < content.size() ) {
+      line_starts.push_back(pos);
+      pos = content.find('\n', pos);
+      pos = pos == std::string::npos ? content.size() : pos + 1;
+    }
+    line_starts.push_back(pos);
+
+    tbb::parallel_for(UL(0), line_starts.size() - 1, [&](const size_t block) {
+      const char* current = content.data() + line_starts[block];
+      const char* end = content.data() + line_starts[block + 1];
+      char* next = nullptr;
+      const PartitionID bipart_block = std::strtol(current, &next, 10);
+      ASSERT(static_cast<PartitionID>(block) == bipart_block - 1); unused(bipart_block);
+      current = next;
+      while ( current < end ) {
+        const HypernodeID hn = std::strtoul(current, &next, 10);
+        if ( next == current || next > end ) {
+          break;
+        }
         hypergraph.setOnlyNodePart(hn - 1, block);
+        current = next;
       }
-    }
+    });
     hypergraph.initializePartition();
-    file.close();
   } else {
     std::cerr << "Error: File not found: " << std::endl;
   }
@@ -82,6 +103,20 @@ int main(int argc, char* argv[]) {
           ("hypergraph,h",
            po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
            "Hypergraph Filename")
+          ("input-file-format",
+            po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& s) {
+              if (s == "hmetis") {
+                context.partition.file_format = FileFormat::hMetis;
+              } else if (s == "metis") {
+                context.partition.file_format = FileFormat::Metis;
+              } else if (s == "binary") {
+                context.partition.file_format = FileFormat::binary;
+              }
+            }),
+            "Input file format: \n"
+            " - hmetis : hMETIS hypergraph file format \n"
+            " - metis : METIS graph file format \n"
+            " - binary : binary snapshot (see input_to_binary)")
           ("bipart-partition-file,b",
            po::value<std::string>(&context.partition.graph_partition_filename)->value_name("<string>")->required(),
            "BiPart Partition Filename")
@@ -97,7 +132,7 @@ int main(int argc, char* argv[]) {
   mt_kahypar_hypergraph_t hypergraph =
     mt_kahypar::io::readInputFile(
       context.partition.graph_filename, PresetType::default_preset,
-      InstanceType::hypergraph, FileFormat::hMetis, true);
+      InstanceType::hypergraph, context.partition.file_format, true);
   Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
   PartitionedHypergraph phg(context.partition.k, hg, parallel_tag_t());
 
@@ -109,12 +144,13 @@ int main(int argc, char* argv[]) {
   readBipartPartitionFile(context.partition.graph_partition_filename, phg,
                           context.partition.k);
 
+  const PartitionMetrics partition_metrics = metrics::allMetrics(phg, context);
   std::cout << "RESULT"
             << " graph=" << context.partition.graph_filename
             << " k=" << context.partition.k
-            << " imbalance=" << metrics::imbalance(phg, context)
-            << " cut=" << metrics::quality(phg, Objective::cut)
-            << " km1=" << metrics::quality(phg, Objective::km1) << std::endl;
+            << " imbalance=" << partition_metrics.imbalance
+            << " cut=" << partition_metrics.cut
+            << " km1=" << partition_metrics.km1 << std::endl;
 
   utils::delete_hypergraph(hypergraph);
 
@@ -50,22 +50,13 @@ using PartitionedHypergraph = ds::PartitionedHypergraph<Hypergraph, ds::Connecti
 
 void readPartitionFile(const std::string& partition_file, PartitionedHypergraph& hypergraph) {
   ASSERT(!partition_file.empty(), "No filename for partition file specified");
-  std::ifstream file(partition_file);
-  if (file) {
-    PartitionID part_id;
-    HypernodeID node = 0;
-    while (file >> part_id) {
-      hypergraph.setOnlyNodePart(node, part_id);
-      node++;
-    }
-    if (node != hypergraph.initialNumNodes()) {
-      std::cerr << "Number of nodes doesnt match partition file size" << std::endl;
-    }
-    hypergraph.initializePartition();
-    file.close();
-  } else {
-    std::cerr << "Error: File not found: " << std::endl;
-  }
+  // Parses text and binary partition files in parallel
+  std::vector<PartitionID> partition;
+  io::readPartitionFile(partition_file, hypergraph.initialNumNodes(), partition);
+  hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+    hypergraph.setOnlyNodePart(hn, partition[hn]);
+  });
+  hypergraph.initializePartition();
 }
 
 int main(int argc, char* argv[]) {
@@ -76,6 +67,20 @@ int main(int argc, char* argv[]) {
           ("hypergraph,h",
            po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
            "Hypergraph Filename")
+          ("input-file-format",
+            po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& s) {
+              if (s == "hmetis") {
+                context.partition.file_format = FileFormat::hMetis;
+              } else if (s == "metis") {
+                context.partition.file_format = FileFormat::Metis;
+              } else if (s == "binary") {
+                context.partition.file_format = FileFormat::binary;
+              }
+            }),
+            "Input file format: \n"
+            " - hmetis : hMETIS hypergraph file format \n"
+            " - metis : METIS graph file format \n"
+            " - binary : binary snapshot (see input_to_binary)")
           ("partition-file,b",
            po::value<std::string>(&context.partition.graph_partition_filename)->value_name("<string>")->required(),
            "Partition Filename")
@@ -91,7 +96,7 @@ int main(int argc, char* argv[]) {
   mt_kahypar_hypergraph_t hypergraph =
     mt_kahypar::io::readInputFile(
       context.partition.graph_filename, PresetType::default_preset,
-      InstanceType::hypergraph, FileFormat::hMetis, true);
+      InstanceType::hypergraph, context.partition.file_format, true);
   Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
   PartitionedHypergraph phg(context.partition.k, hg, parallel_tag_t());
 
@@ -102,12 +107,13 @@ int main(int argc, char* argv[]) {
   // Read Partition File
   readPartitionFile(context.partition.graph_partition_filename, phg);
 
+  const PartitionMetrics partition_metrics = metrics::allMetrics(phg, context);
   std::cout << "RESULT"
             << " graph=" << context.partition.graph_filename
             << " k=" << context.partition.k
-            << " imbalance=" << metrics::imbalance(phg, context)
-            << " cut=" << metrics::quality(phg, Objective::cut)
-            << " km1=" << metrics::quality(phg, Objective::km1) << std::endl;
+            << " imbalance=" << partition_metrics.imbalance
+            << " cut=" << partition_metrics.cut
+            << " km1=" << partition_metrics.km1 << std::endl;
 
   utils::delete_hypergraph(hypergraph);
 
@@ -26,6 +26,7 @@
 
 #include <boost/program_options.hpp>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -57,6 +58,7 @@ struct Statistic {
   uint64_t med = 0;
   uint64_t q3 = 0;
   uint64_t top90 = 0;
+  uint64_t top99 = 0;
   uint64_t max = 0;
   double avg = 0.0;
   double sd = 0.0;
@@ -72,6 +74,7 @@ Statistic createStats(const std::vector<T>& vec, const double avg, const double
     stats.med = kahypar::math::median(vec);
     stats.q3 = quartiles.second;
     stats.top90 = vec[ceil(90.0 / 100 * (vec.size() - 1))];
+    stats.top99 = vec[ceil(99.0 / 100 * (vec.size() - 1))];
     stats.max = vec.back();
     stats.avg = avg;
     stats.sd = stdev;
@@ -79,8 +82,60 @@ Statistic createStats(const std::vector<T>& vec, const double avg, const double
   return stats;
 }
 
+template <typename T>
+void moveToStdVector(vec<T>& from, std::vector<T>& to) {
+  to.assign(from.begin(), from.end());
+  vec<T>().swap(from);
+}
+
+// ! Rough estimate of the peak memory consumption of each preset in bytes, which
+// ! is intended to route instances to presets before partitioning them.
+struct MemoryEstimate {
+  size_t deterministic = 0;
+  size_t default_preset = 0;
+  size_t quality = 0;
+  size_t highest_quality = 0;
+  size_t large_k = 0;
+};
+
+MemoryEstimate estimateMemory(const size_t num_nodes,
+                              const size_t num_edges,
+                              const size_t num_pins,
+                              const size_t num_sparse_pin_count_entries,
+                              const size_t max_edge_size,
+                              const size_t k) {
+  // The hypergraph stores the pins of each hyperedge and the incident nets of each node,
+  // the coarsening hierarchy at most doubles that and the input is kept during construction
+  const size_t hypergraph = 32 * (num_nodes + num_edges) + 2 * num_pins * sizeof(HypernodeID);
+  const size_t input = num_pins * sizeof(HypernodeID) + 8 * (num_nodes + num_edges);
+  const size_t hierarchy = 2 * hypergraph;
+  // Pin counts are bit-packed and each hyperedge has a connectivity set
+  const size_t bits_per_pin_count = std::ceil(std::log2(max_edge_size + 1));
+  const size_t pin_counts = num_edges * k * (bits_per_pin_count + 1) / 8;
+  const size_t gain_cache = num_nodes * (k + 1) * sizeof(HyperedgeWeight);
+  // Large k uses sparse pin counts and gain caches with one entry per (hyper)edge/block pair
+  const size_t sparse_partition = 2 * num_sparse_pin_count_entries * 2 * sizeof(uint32_t);
+  // The n-level hierarchy keeps the contraction history and incident net versions
+  const size_t n_level_hierarchy = 3 * hypergraph;
+
+  MemoryEstimate estimate;
+  estimate.deterministic = input + hierarchy + pin_counts;
+  estimate.default_preset = input + hierarchy + pin_counts + gain_cache;
+  // Flow networks are bounded by the size of the refinement regions
+  estimate.quality = estimate.default_preset + hypergraph / 4;
+  estimate.highest_quality = input + n_level_hierarchy + pin_counts + gain_cache + hypergraph / 4;
+  estimate.large_k = input + hierarchy + sparse_partition;
+  return estimate;
+}
+
+double toMB(const size_t bytes) {
+  return static_cast<double>(bytes) / 1000000.0;
+}
+
 int main(int argc, char* argv[]) {
   Context context;
+  bool streaming = false;
+  size_t k = 2;
 
   po::options_description options("Options");
   options.add_options()
@@ -97,66 +152,90 @@ int main(int argc, char* argv[]) {
             }),
             "Input file format: \n"
             " - hmetis : hMETIS hypergraph file format \n"
-            " - metis : METIS graph file format");
+            " - metis : METIS graph file format")
+          ("streaming",
+           po::value<bool>(&streaming)->value_name("<bool>")->default_value(false),
+           "If true, the statistics are computed in a single pass over the input file "
+           "without constructing the hypergraph (memory linear in the number of nodes and edges)")
+          ("blocks,k",
+           po::value<size_t>(&k)->value_name("<size_t>")->default_value(2),
+           "Number of blocks used to estimate the memory consumption of each preset");
 
   po::variables_map cmd_vm;
   po::store(po::parse_command_line(argc, argv, options), cmd_vm);
   po::notify(cmd_vm);
 
-  // Read Hypergraph
-  mt_kahypar_hypergraph_t hypergraph =
-    mt_kahypar::io::readInputFile(
-      context.partition.graph_filename, PresetType::default_preset,
-      InstanceType::hypergraph, context.partition.file_format, true);
-  Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
-
   std::vector<HypernodeID> he_sizes;
   std::vector<HyperedgeWeight> he_weights;
   std::vector<HyperedgeID> hn_degrees;
   std::vector<HypernodeWeight> hn_weights;
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  size_t num_pins = 0;
 
-  tbb::parallel_invoke([&] {
-    he_sizes.resize(hg.initialNumEdges());
-  }, [&] {
-    he_weights.resize(hg.initialNumEdges());
-  }, [&] {
-    hn_degrees.resize(hg.initialNumNodes());
-  }, [&] {
-    hn_weights.resize(hg.initialNumNodes());
-  });
+  if ( streaming ) {
+    io::InputStatistics input_stats = io::readInputStatistics(
+      context.partition.graph_filename, context.partition.file_format);
+    num_hypernodes = input_stats.num_nodes;
+    num_hyperedges = input_stats.num_edges;
+    num_pins = input_stats.num_pins;
+    moveToStdVector(input_stats.edge_sizes, he_sizes);
+    moveToStdVector(input_stats.edge_weights, he_weights);
+    moveToStdVector(input_stats.node_degrees, hn_degrees);
+    moveToStdVector(input_stats.node_weights, hn_weights);
+  } else {
+    // Read Hypergraph
+    mt_kahypar_hypergraph_t hypergraph =
+      mt_kahypar::io::readInputFile(
+        context.partition.graph_filename, PresetType::default_preset,
+        InstanceType::hypergraph, context.partition.file_format, true);
+    Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+    num_hypernodes = hg.initialNumNodes();
+    num_hyperedges = hg.initialNumEdges();
+    num_pins = hg.initialNumPins();
 
-  HypernodeID num_hypernodes = hg.initialNumNodes();
-  const double avg_hn_degree = utils::avgHypernodeDegree(hg);
-  hg.doParallelForAllNodes([&](const HypernodeID& hn) {
-    hn_degrees[hn] = hg.nodeDegree(hn);
-    hn_weights[hn] = hg.nodeWeight(hn);
-  });
+    tbb::parallel_invoke([&] {
+      he_sizes.resize(num_hyperedges);
+    }, [&] {
+      he_weights.resize(num_hyperedges);
+    }, [&] {
+      hn_degrees.resize(num_hypernodes);
+    }, [&] {
+      hn_weights.resize(num_hypernodes);
+    });
+
+    hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      hn_degrees[hn] = hg.nodeDegree(hn);
+      hn_weights[hn] = hg.nodeWeight(hn);
+    });
+    hg.doParallelForAllEdges([&](const HyperedgeID& he) {
+      he_sizes[he] = hg.edgeSize(he);
+      he_weights[he] = hg.edgeWeight(he);
+    });
+    utils::delete_hypergraph(hypergraph);
+  }
+
+  const double avg_hn_degree = static_cast<double>(num_pins) / num_hypernodes;
   const double avg_hn_weight = utils::parallel_avg(hn_weights, num_hypernodes);
   const double stdev_hn_degree = utils::parallel_stdev(hn_degrees, avg_hn_degree, num_hypernodes);
   const double stdev_hn_weight = utils::parallel_stdev(hn_weights, avg_hn_weight, num_hypernodes);
 
-  HyperedgeID num_hyperedges = hg.initialNumEdges();
-  const double avg_he_size = utils::avgHyperedgeDegree(hg);
-  tbb::enumerable_thread_specific<size_t> single_pin_hes(0);
-  hg.doParallelForAllEdges([&](const HyperedgeID& he) {
-    he_sizes[he] = hg.edgeSize(he);
-    he_weights[he] = hg.edgeWeight(he);
-    if ( hg.edgeSize(he) == 1 ) {
-      ++single_pin_hes.local();
-    }
-  });
+  const double avg_he_size = static_cast<double>(num_pins) / num_hyperedges;
   const double avg_he_weight = utils::parallel_avg(he_weights, num_hyperedges);
   const double stdev_he_size = utils::parallel_stdev(he_sizes, avg_he_size, num_hyperedges);
   const double stdev_he_weight = utils::parallel_stdev(he_weights, avg_he_weight, num_hyperedges);
 
+  tbb::enumerable_thread_specific<size_t> single_pin_hes(0);
   tbb::enumerable_thread_specific<size_t> graph_edge_count(0);
-  hg.doParallelForAllEdges([&](const HyperedgeID& he) {
-    if (hg.edgeSize(he) == 2) {
-      graph_edge_count.local() += 1;
-    }
+  tbb::enumerable_thread_specific<size_t> sparse_pin_count_entries(0);
+  tbb::parallel_for(UL(0), he_sizes.size(), [&](const size_t he) {
+    single_pin_hes.local() += he_sizes[he] == 1;
+    graph_edge_count.local() += he_sizes[he] == 2;
+    sparse_pin_count_entries.local() += std::min(static_cast<size_t>(he_sizes[he]), k);
   });
 
   HyperedgeWeight total_he_weight = 0;
+  HypernodeWeight total_hn_weight = 0;
   tbb::parallel_invoke([&] {
     tbb::parallel_sort(he_sizes.begin(), he_sizes.end());
   }, [&] {
@@ -174,24 +253,40 @@ int main(int argc, char* argv[]) {
           }
           return running_total;
       }, std::plus<HyperedgeWeight>() );
+  }, [&] {
+    total_hn_weight = tbb::parallel_reduce(
+      tbb::blocked_range<size_t>(0, hn_weights.size()), 0,
+      [&](tbb::blocked_range<size_t> r, HypernodeWeight running_total) {
+          for (size_t i = r.begin(); i < r.end(); ++i) {
+              running_total += hn_weights[i];
+          }
+          return running_total;
+      }, std::plus<HypernodeWeight>() );
   });
 
   Statistic he_size_stats = createStats(he_sizes, avg_he_size, stdev_he_size);
   Statistic he_weight_stats = createStats(he_weights, avg_he_weight, stdev_he_weight);
   Statistic hn_degree_stats = createStats(hn_degrees, avg_hn_degree, stdev_hn_degree);
   Statistic hn_weight_stats = createStats(hn_weights, avg_hn_weight, stdev_hn_weight);
+  const size_t num_graph_edges = graph_edge_count.combine(std::plus<size_t>());
+  const MemoryEstimate memory = estimateMemory(num_hypernodes, num_hyperedges, num_pins,
+    sparse_pin_count_entries.combine(std::plus<size_t>()), he_size_stats.max, k);
 
   std::string graph_name = context.partition.graph_filename.substr(
     context.partition.graph_filename.find_last_of("/") + 1);
   std::cout  << "RESULT graph=" << graph_name
-             << " HNs=" << hg.initialNumNodes()
-             << " HEs=" << hg.initialNumEdges()
-             << " pins=" << hg.initialNumPins()
+             << " HNs=" << num_hypernodes
+             << " HEs=" << num_hyperedges
+             << " pins=" << num_pins
              << " numSingleNodeHEs=" << single_pin_hes.combine(std::plus<size_t>())
+             << " numGraphEdges=" << num_graph_edges
+             << " graphEdgeFraction=" << (num_hyperedges > 0 ?
+                  static_cast<double>(num_graph_edges) / num_hyperedges : 0.0)
              << " avgHEsize=" << he_size_stats.avg
              << " sdHEsize=" << he_size_stats.sd
              << " minHEsize=" << he_size_stats.min
              << " heSize90thPercentile=" << he_size_stats.top90
+             << " heSize99thPercentile=" << he_size_stats.top99
              << " Q1HEsize=" << he_size_stats.q1
              << " medHEsize=" << he_size_stats.med
              << " Q3HEsize=" << he_size_stats.q3
@@ -208,11 +303,12 @@ int main(int argc, char* argv[]) {
              << " sdHNdegree=" << hn_degree_stats.sd
              << " minHnDegree=" << hn_degree_stats.min
              << " hnDegree90thPercentile=" << hn_degree_stats.top90
+             << " hnDegree99thPercentile=" << hn_degree_stats.top99
              << " maxHnDegree=" << hn_degree_stats.max
              << " Q1HNdegree=" << hn_degree_stats.q1
              << " medHNdegree=" << hn_degree_stats.med
              << " Q3HNdegree=" << hn_degree_stats.q3
-             << " totalHNweight=" << hg.totalWeight()
+             << " totalHNweight=" << total_hn_weight
              << " avgHNweight=" << hn_weight_stats.avg
              << " sdHNweight=" << hn_weight_stats.sd
              << " minHNweight=" << hn_weight_stats.min
@@ -220,10 +316,14 @@ int main(int argc, char* argv[]) {
              << " medHNweight=" << hn_weight_stats.med
              << " Q3HNweight=" << hn_weight_stats.q3
              << " maxHNweight=" << hn_weight_stats.max
-             << " density=" << static_cast<double>(hg.initialNumEdges()) / hg.initialNumNodes()
+             << " density=" << static_cast<double>(num_hyperedges) / num_hypernodes
+             << " k=" << k
+             << " estMemoryDeterministicMB=" << toMB(memory.deterministic)
+             << " estMemoryDefaultMB=" << toMB(memory.default_preset)
+             << " estMemoryQualityMB=" << toMB(memory.quality)
+             << " estMemoryHighestQualityMB=" << toMB(memory.highest_quality)
+             << " estMemoryLargeKMB=" << toMB(memory.large_k)
              << std::endl;
 
-  utils::delete_hypergraph(hypergraph);
-
   return 0;
 }
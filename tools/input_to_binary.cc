@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+int main(int argc, char* argv[]) {
+  std::string input_filename;
+  std::string binary_filename;
+  std::string input_format;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("input,i",
+    po::value<std::string>(&input_filename)->value_name("<string>")->required(),
+    "Input (hyper)graph filename")
+    ("output,o",
+    po::value<std::string>(&binary_filename)->value_name("<string>")->required(),
+    "Output filename of the binary snapshot")
+    ("input-file-format,f",
+    po::value<std::string>(&input_format)->value_name("<string>")->default_value("hmetis"),
+    "Input file format: \n"
+    " - hmetis : hMETIS hypergraph file format \n"
+    " - metis : METIS graph file format");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  HyperedgeID num_edges = 0;
+  HypernodeID num_nodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  io::HyperedgeVector hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+
+  bool is_graph = false;
+  if ( input_format == "hmetis" ) {
+    io::readHypergraphFile(input_filename, num_edges, num_nodes, num_removed_single_pin_hyperedges,
+                           hyperedges, hyperedges_weight, hypernodes_weight);
+  } else if ( input_format == "metis" ) {
+    io::readGraphFile(input_filename, num_edges, num_nodes,
+                      hyperedges, hyperedges_weight, hypernodes_weight);
+    is_graph = true;
+  } else {
+    std::cerr << "Unknown input file format: " << input_format << std::endl;
+    return 1;
+  }
+  ALWAYS_ASSERT(hyperedges.size() == num_edges);
+
+  io::writeBinaryFile(binary_filename, num_nodes, hyperedges, hyperedges_weight,
+                      hypernodes_weight, is_graph, num_removed_single_pin_hyperedges);
+
+  std::cout << "Wrote " << (is_graph ? "graph" : "hypergraph") << " with " << num_nodes
+            << " nodes and " << num_edges << " edges to " << binary_filename << std::endl;
+  return 0;
+}
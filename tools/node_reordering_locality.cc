@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2026 Mt-KaHyPar Developers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/preprocessing/reordering/node_reordering.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/timer.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using TypeTraits = StaticHypergraphTypeTraits;
+using Hypergraph = ds::StaticHypergraph;
+
+struct Locality {
+  // ! Average difference between the largest and smallest node ID of a net
+  double avg_net_span = 0.0;
+  // ! Average of log2(1 + d) over the differences d of consecutive node IDs of a net,
+  // ! i.e., roughly the number of bits needed to encode the pins of a net
+  double avg_log_gap = 0.0;
+};
+
+// ! Measures the locality of the hypergraph if node u is stored at position node_id(u)
+template<typename F>
+Locality measureLocality(const Hypergraph& hypergraph, const F& node_id) {
+  tbb::enumerable_thread_specific<double> local_span(0.0);
+  tbb::enumerable_thread_specific<double> local_log_gap(0.0);
+  tbb::enumerable_thread_specific<vec<HypernodeID>> local_pins;
+  hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+    vec<HypernodeID>& pins = local_pins.local();
+    pins.clear();
+    for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+      pins.push_back(node_id(pin));
+    }
+    if ( pins.empty() ) {
+      return;
+    }
+    std::sort(pins.begin(), pins.end());
+    local_span.local() += pins.back() - pins.front();
+    for ( size_t i = 1; i < pins.size(); ++i ) {
+      local_log_gap.local() += std::log2(1.0 + pins[i] - pins[i - 1]);
+    }
+  });
+
+  Locality locality;
+  const double num_edges = std::max(HyperedgeID(1), hypergraph.initialNumEdges());
+  const double num_gaps = std::max(1.0,
+    static_cast<double>(hypergraph.initialNumPins()) - hypergraph.initialNumEdges());
+  locality.avg_net_span = local_span.combine(std::plus<double>()) / num_edges;
+  locality.avg_log_gap = local_log_gap.combine(std::plus<double>()) / num_gaps;
+  return locality;
+}
+
+int main(int argc, char* argv[]) {
+  Context context;
+
+  po::options_description options("Options");
+  options.add_options()
+          ("hypergraph,h",
+           po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
+           "Hypergraph Filename")
+          ("input-file-format",
+            po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& s) {
+              if (s == "hmetis") {
+                context.partition.file_format = FileFormat::hMetis;
+              } else if (s == "metis") {
+                context.partition.file_format = FileFormat::Metis;
+              }
+            }),
+            "Input file format: \n"
+            " - hmetis : hMETIS hypergraph file format \n"
+            " - metis : METIS graph file format")
+          ("max-net-size",
+           po::value<HypernodeID>(&context.partition.ignore_hyperedge_size_threshold)->value_name("<uint32_t>")->default_value(1000),
+           "Nets larger than this threshold are not expanded by the breadth-first search");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  mt_kahypar_hypergraph_t hypergraph =
+    mt_kahypar::io::readInputFile(
+      context.partition.graph_filename, PresetType::default_preset,
+      InstanceType::hypergraph, context.partition.file_format, true);
+  Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+
+  const Locality before = measureLocality(hg, [](const HypernodeID& hn) { return hn; });
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  const vec<HypernodeID> new_node_id = NodeReordering<TypeTraits>::computeOrder(
+    hg, context.partition.ignore_hyperedge_size_threshold);
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  const Locality after = measureLocality(hg, [&](const HypernodeID& hn) { return new_node_id[hn]; });
+
+  std::string graph_name = context.partition.graph_filename.substr(
+    context.partition.graph_filename.find_last_of("/") + 1);
+  std::cout << "RESULT graph=" << graph_name
+            << " avgNetSpanBefore=" << before.avg_net_span
+            << " avgNetSpanAfter=" << after.avg_net_span
+            << " avgLogGapBefore=" << before.avg_log_gap
+            << " avgLogGapAfter=" << after.avg_log_gap
+            << " reorderingTime=" << std::chrono::duration<double>(end - start).count()
+            << std::endl;
+
+  utils::delete_hypergraph(hypergraph);
+  return 0;
+}
@@ -0,0 +1,158 @@
+#!/usr/bin/python3
+# Scaling benchmark: Runs Mt-KaHyPar on a set of instances for several thread counts and
+# presets, extracts the running time of each phase from the JSON timing export and reports
+# the speedup and parallel efficiency of each phase relative to the smallest thread count.
+#
+# Strong scaling (default): every instance is partitioned with every thread count.
+# Weak scaling (--weak):    the i-th instance is partitioned with the i-th thread count, i.e.,
+#                           the instances should grow proportionally to the number of threads.
+#                           Efficiency is then T(t_0) / T(t_i) and speedup is efficiency * t_i / t_0.
+#
+# Usage: scaling_benchmark.py --executable <MtKaHyPar> -k <int> --instances <file> ...
+#          [--threads 1 2 4 ...] [--presets default quality ...] [--csv <file>]
+import argparse
+import csv
+import json
+import os
+import os.path
+import statistics
+import subprocess
+import sys
+import tempfile
+
+mt_kahypar_dir = os.path.abspath(os.path.join(os.path.dirname(__file__), "..")) + "/"
+default_executable = mt_kahypar_dir + "build/mt-kahypar/application/MtKaHyPar"
+default_phases = [ "preprocessing", "coarsening", "initial_partitioning", "refinement",
+                   "label_propagation", "fm", "flow_refinement_scheduler" ]
+
+def print_error(msg):
+  print("\033[1;91m[ERROR]\033[0m \033[1m" + msg + "\033[0m", file=sys.stderr)
+
+def command(args, instance, preset, threads, json_file):
+  return [ args.executable,
+           "-h" + instance,
+           "--preset-type=" + preset,
+           "-k" + str(args.k),
+           "-e" + str(args.epsilon),
+           "-t" + str(threads),
+           "-m" + args.mode,
+           "-o" + args.objective,
+           "--seed=" + str(args.seed),
+           "--verbose=false",
+           "--json-output-file=" + json_file ] + args.parameters
+
+# Sums up the timings of all timer scopes with the given key
+def phase_time(timings, key):
+  time = 0.0
+  for timing in timings:
+    if timing["key"] == key:
+      time += timing["time"]
+    else:
+      time += phase_time(timing["children"], key)
+  return time
+
+# Runs the partitioner several times and returns the median time of each phase
+def measure(cmd, json_file, phases, runs):
+  measurements = []
+  for _ in range(runs):
+    result = subprocess.run(cmd, stdout=subprocess.DEVNULL)
+    if result.returncode != 0:
+      print_error("Partitioner terminates with non-zero exit code (Command = " + " ".join(cmd) + ")")
+      sys.exit(-1)
+    with open(json_file) as f:
+      timings = json.load(f)
+    measurement = { "total_time": timings["total_time"] }
+    for phase in phases:
+      measurement[phase] = phase_time(timings["timings"], phase)
+    measurements.append(measurement)
+  return { key: statistics.median([ m[key] for m in measurements ]) for key in measurements[0] }
+
+# Sums up the phase timings of all instances that were run with the same thread count
+def accumulate(times, measurement):
+  for key, value in measurement.items():
+    times[key] = times.get(key, 0.0) + value
+
+def scaling_rows(preset, times, threads, weak):
+  rows = []
+  t0 = threads[0]
+  for key in times[t0]:
+    base = times[t0][key]
+    if all(times[t][key] == 0.0 for t in threads):
+      # Phase is not executed by this preset
+      continue
+    for t in threads:
+      time = times[t][key]
+      if base == 0.0 or time == 0.0:
+        speedup, efficiency = float("nan"), float("nan")
+      elif weak:
+        efficiency = base / time
+        speedup = efficiency * t / t0
+      else:
+        speedup = base / time
+        efficiency = speedup * t0 / t
+      rows.append({ "preset": preset, "phase": key, "threads": t, "time": time,
+                    "speedup": speedup, "efficiency": efficiency })
+  return rows
+
+def print_table(preset, rows, threads):
+  print("\033[1m" + preset + "\033[0m")
+  header = "phase".ljust(28) + "".join(("t=" + str(t)).rjust(20) for t in threads)
+  print(header)
+  print("".ljust(len(header), "-"))
+  phases = list(dict.fromkeys(row["phase"] for row in rows))
+  for phase in phases:
+    line = phase.ljust(28)
+    for row in rows:
+      if row["phase"] == phase:
+        line += ("%.3fs %5.2fx %3.0f%%" % (row["time"], row["speedup"], 100.0 * row["efficiency"])).rjust(20)
+    print(line)
+  print()
+
+def main():
+  parser = argparse.ArgumentParser(description="Mt-KaHyPar scaling benchmark")
+  parser.add_argument("--executable", default=default_executable)
+  parser.add_argument("--instances", nargs="+", required=True)
+  parser.add_argument("--threads", nargs="+", type=int, default=[ 1, 2, 4, 8, 16, 32, 64, 128 ])
+  parser.add_argument("--presets", nargs="+", default=[ "default" ])
+  parser.add_argument("--phases", nargs="+", default=default_phases)
+  parser.add_argument("-k", type=int, required=True)
+  parser.add_argument("-e", "--epsilon", type=float, default=0.03)
+  parser.add_argument("-m", "--mode", default="direct")
+  parser.add_argument("-o", "--objective", default="km1")
+  parser.add_argument("--seed", type=int, default=1)
+  parser.add_argument("--runs", type=int, default=1,
+                      help="number of repetitions per configuration (the median is reported)")
+  parser.add_argument("--weak", action="store_true",
+                      help="weak scaling: the i-th instance is run with the i-th thread count")
+  parser.add_argument("--csv", help="writes all rows as CSV to the given file")
+  parser.add_argument("parameters", nargs="*",
+                      help="additional parameters passed to Mt-KaHyPar (after --)")
+  args = parser.parse_args()
+
+  threads = sorted(args.threads)
+  if args.weak and len(args.instances) != len(threads):
+    print_error("Weak scaling requires one instance per thread count")
+    sys.exit(-1)
+
+  rows = []
+  with tempfile.TemporaryDirectory() as tmp_dir:
+    json_file = os.path.join(tmp_dir, "result.json")
+    for preset in args.presets:
+      times = { t: { } for t in threads }
+      for i, t in enumerate(threads):
+        instances = [ args.instances[i] ] if args.weak else args.instances
+        for instance in instances:
+          cmd = command(args, instance, preset, t, json_file)
+          accumulate(times[t], measure(cmd, json_file, args.phases, args.runs))
+      preset_rows = scaling_rows(preset, times, threads, args.weak)
+      print_table(preset, preset_rows, threads)
+      rows += preset_rows
+
+  if args.csv:
+    with open(args.csv, "w", newline="") as csv_file:
+      writer = csv.DictWriter(csv_file, fieldnames=[ "preset", "phase", "threads", "time", "speedup", "efficiency" ])
+      writer.writeheader()
+      writer.writerows(rows)
+
+if __name__ == "__main__":
+  main()
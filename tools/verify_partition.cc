@@ -30,6 +30,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <atomic>
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/static_hypergraph.h"
@@ -48,22 +49,36 @@ namespace po = boost::program_options;
 using Hypergraph = ds::StaticHypergraph;
 using PartitionedHypergraph = ds::PartitionedHypergraph<Hypergraph, ds::ConnectivityInfo>;
 
+bool isValidBlock(const PartitionID block, const PartitionID k) {
+  return block != kInvalidPartition && block < k;
+}
+
 bool readPartitionFile(const std::string& partition_file, PartitionedHypergraph& hypergraph) {
-  bool success = true;
   std::vector<PartitionID> partition;
   mt_kahypar::io::readPartitionFile(partition_file, hypergraph.initialNumNodes(), partition);
-  for ( const HypernodeID& hn : hypergraph.nodes() ) {
-    if ( partition[hn] == kInvalidPartition ) {
-      LOG << RED << "[ERROR]" << END << "Hypernode" << hn << "is not assigned to a block";
-      success = false;
-    } else if ( partition[hn] >= hypergraph.k() ) {
-      LOG << RED << "[ERROR]" << END << "Hypernode" << hn << "is assigned to block"
-          << ( partition[hn] + 1 ) << ", but there are only" << hypergraph.k() << "blocks";
-      success = false;
+  const PartitionID k = hypergraph.k();
+  std::atomic<bool> success(true);
+  hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+    if ( isValidBlock(partition[hn], k) ) {
+      hypergraph.setOnlyNodePart(hn, partition[hn]);
+    } else {
+      success.store(false, std::memory_order_relaxed);
     }
-    hypergraph.setOnlyNodePart(hn, partition[hn]);
+  });
+
+  if ( !success ) {
+    // Invalid partitions are rare, thus we report the affected nodes sequentially
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      if ( partition[hn] == kInvalidPartition ) {
+        LOG << RED << "[ERROR]" << END << "Hypernode" << hn << "is not assigned to a block";
+      } else if ( partition[hn] >= k ) {
+        LOG << RED << "[ERROR]" << END << "Hypernode" << hn << "is assigned to block"
+            << ( partition[hn] + 1 ) << ", but there are only" << k << "blocks";
+      }
+    }
+  } else {
+    hypergraph.initializePartition();
   }
-  hypergraph.initializePartition();
   return success;
 }
 
@@ -75,6 +90,20 @@ int main(int argc, char* argv[]) {
           ("hypergraph,h",
            po::value<std::string>(&context.partition.graph_filename)->value_name("<string>")->required(),
            "Hypergraph Filename")
+          ("input-file-format",
+            po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& s) {
+              if (s == "hmetis") {
+                context.partition.file_format = FileFormat::hMetis;
+              } else if (s == "metis") {
+                context.partition.file_format = FileFormat::Metis;
+              } else if (s == "binary") {
+                context.partition.file_format = FileFormat::binary;
+              }
+            }),
+            "Input file format: \n"
+            " - hmetis : hMETIS hypergraph file format \n"
+            " - metis : METIS graph file format \n"
+            " - binary : binary snapshot (see input_to_binary)")
           ("partition-file,b",
            po::value<std::string>(&context.partition.graph_partition_filename)->value_name("<string>")->required(),
            "Partition Filename")
@@ -96,7 +125,7 @@ int main(int argc, char* argv[]) {
   mt_kahypar_hypergraph_t hypergraph =
     mt_kahypar::io::readInputFile(
       context.partition.graph_filename, PresetType::default_preset,
-      InstanceType::hypergraph, FileFormat::hMetis, true);
+      InstanceType::hypergraph, context.partition.file_format, true);
   Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
   PartitionedHypergraph phg(context.partition.k, hg, parallel_tag_t());
 
@@ -111,14 +140,21 @@ int main(int argc, char* argv[]) {
 
   // Read Partition File
   bool success = readPartitionFile(context.partition.graph_partition_filename, phg);
+  if ( !success ) {
+    // The metrics are undefined if not all nodes are assigned to a valid block
+    utils::delete_hypergraph(hypergraph);
+    return -1;
+  }
 
+  // Computes all objectives and block weights in one parallel pass
+  const PartitionMetrics partition_metrics = metrics::allMetrics(phg, context);
   for ( PartitionID i = 0; i < context.partition.k; ++i ) {
-    if ( phg.partWeight(i) == 0 ) {
+    if ( partition_metrics.block_weights[i] == 0 ) {
       LOG << RED << "[ERROR]" << END << "Block" << (i + 1) << "is empty" << END;
       success = false;
-    } else if ( phg.partWeight(i) > context.partition.max_part_weights[i] ) {
+    } else if ( partition_metrics.block_weights[i] > context.partition.max_part_weights[i] ) {
       LOG << RED << "[ERROR]" << END << "Block" << (i + 1) << "has weight"
-          << phg.partWeight(i) << ", but maximum allowed block weight is"
+          << partition_metrics.block_weights[i] << ", but maximum allowed block weight is"
           << context.partition.max_part_weights[i] << END;
       success = false;
     }
@@ -126,21 +162,29 @@ int main(int argc, char* argv[]) {
 
   // Check fixed vertices
   if ( phg.hasFixedVertices() ) {
-    for ( const HypernodeID& hn : phg.nodes() ) {
+    std::atomic<bool> violates_fixed_vertices(false);
+    phg.doParallelForAllNodes([&](const HypernodeID& hn) {
       if ( phg.isFixed(hn) && phg.fixedVertexBlock(hn) != phg.partID(hn) ) {
-        LOG << RED << "Node" << hn << "is fixed to block" << phg.fixedVertexBlock(hn)
-            << ", but assigned to block" << phg.partID(hn) << END;
-        success = false;
+        violates_fixed_vertices.store(true, std::memory_order_relaxed);
       }
+    });
+    if ( violates_fixed_vertices ) {
+      for ( const HypernodeID& hn : phg.nodes() ) {
+        if ( phg.isFixed(hn) && phg.fixedVertexBlock(hn) != phg.partID(hn) ) {
+          LOG << RED << "Node" << hn << "is fixed to block" << phg.fixedVertexBlock(hn)
+              << ", but assigned to block" << phg.partID(hn) << END;
+        }
+      }
+      success = false;
     }
   }
 
   std::cout << "***********************" << context.partition.k
             << "-way Partition Result************************" << std::endl;
-  std::cout << "cut =" << metrics::quality(phg, Objective::cut) << std::endl;
-  std::cout << "soed =" << metrics::quality(phg, Objective::soed) << std::endl;
-  std::cout << "km1 = " << metrics::quality(phg, Objective::km1) << std::endl;
-  std::cout << "imbalance = " << metrics::imbalance(phg, context) << std::endl;
+  std::cout << "cut =" << partition_metrics.cut << std::endl;
+  std::cout << "soed =" << partition_metrics.soed << std::endl;
+  std::cout << "km1 = " << partition_metrics.km1 << std::endl;
+  std::cout << "imbalance = " << partition_metrics.imbalance << std::endl;
 
   utils::delete_hypergraph(hypergraph);
 
@@ -70,11 +70,14 @@ int main(int argc, char* argv[]) {
           context.partition.file_format = FileFormat::hMetis;
         } else if (s == "metis") {
           context.partition.file_format = FileFormat::Metis;
+        } else if (s == "binary") {
+          context.partition.file_format = FileFormat::binary;
         }
       }),
       "Input file format: \n"
       " - hmetis : hMETIS hypergraph file format \n"
-      " - metis : METIS graph file format")
+      " - metis : METIS graph file format \n"
+      " - binary : binary snapshot (see input_to_binary)")
     ("verbose,v",
      po::value<bool>(&context.partition.verbose_output)->value_name("<bool>")->default_value(false),
      "Enables logging");
@@ -122,6 +125,8 @@ int main(int argc, char* argv[]) {
     io::printPartitioningResults(partitioned_hg, context, elapsed_seconds);
   }
 
+  // Computes all objectives (including the steiner tree metric) in one parallel pass
+  const PartitionMetrics partition_metrics = metrics::allMetrics(partitioned_hg, context);
   std::cout << "RESULT"
             << " graph=" << context.partition.graph_filename.substr(
                 context.partition.graph_filename.find_last_of('/') + 1)
@@ -132,12 +137,12 @@ int main(int argc, char* argv[]) {
             << " objective=" << context.partition.objective
             << " k=" << context.partition.k
             << " epsilon=" << context.partition.epsilon
-            << " imbalance=" << metrics::imbalance(partitioned_hg, context)
-            << " steiner_tree=" << metrics::quality(partitioned_hg, Objective::steiner_tree)
+            << " imbalance=" << partition_metrics.imbalance
+            << " steiner_tree=" << partition_metrics.steiner_tree
             << " approximation_factor=" << metrics::approximationFactorForProcessMapping(partitioned_hg, context)
-            << " cut=" << metrics::quality(partitioned_hg, Objective::cut)
-            << " km1=" << metrics::quality(partitioned_hg, Objective::km1)
-            << " soed=" << metrics::quality(partitioned_hg, Objective::soed)
+            << " cut=" << partition_metrics.cut
+            << " km1=" << partition_metrics.km1
+            << " soed=" << partition_metrics.soed
             << std::endl;
 
   return 0;